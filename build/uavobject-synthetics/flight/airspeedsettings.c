@@ -0,0 +1,176 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AirspeedSettings AirspeedSettings
+ * @brief Settings for the @ref BaroAirspeed module used on CopterControl or Revolution
+ *
+ * Autogenerated files and functions for AirspeedSettings Object
+ * @{ 
+ *
+ * @file       airspeedsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AirspeedSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: airspeedsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "airspeedsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AirspeedSettingsInitialize(void)
+{
+    // Compile time assertion that the AirspeedSettingsDataPacked and AirspeedSettingsData structs
+    // have the same size (though instances of AirspeedSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AirspeedSettingsDataPacked) == sizeof(AirspeedSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(AIRSPEEDSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(AIRSPEEDSETTINGS_OBJID,
+        AIRSPEEDSETTINGS_ISSINGLEINST, AIRSPEEDSETTINGS_ISSETTINGS, AIRSPEEDSETTINGS_ISPRIORITY, AIRSPEEDSETTINGS_NUMBYTES, &AirspeedSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AirspeedSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AirspeedSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AirspeedSettingsData));
+    data.Scale = 1.000000e+00f;
+    data.IMUBasedEstimationLowPassPeriod1 = 5.000000e-01f;
+    data.IMUBasedEstimationLowPassPeriod2 = 1.000000e+01f;
+    data.ZeroPoint = 0;
+    data.SamplePeriod = 100;
+    data.AirspeedSensorType = 5;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AirspeedSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AirspeedSettingsScaleSet(float *NewScale)
+{
+    UAVObjSetDataField(AirspeedSettingsHandle(), (void *)NewScale, offsetof(AirspeedSettingsData, Scale), sizeof(float));
+}
+void AirspeedSettingsScaleGet(float *NewScale)
+{
+    UAVObjGetDataField(AirspeedSettingsHandle(), (void *)NewScale, offsetof(AirspeedSettingsData, Scale), sizeof(float));
+}
+void AirspeedSettingsIMUBasedEstimationLowPassPeriod1Set(float *NewIMUBasedEstimationLowPassPeriod1)
+{
+    UAVObjSetDataField(AirspeedSettingsHandle(), (void *)NewIMUBasedEstimationLowPassPeriod1, offsetof(AirspeedSettingsData, IMUBasedEstimationLowPassPeriod1), sizeof(float));
+}
+void AirspeedSettingsIMUBasedEstimationLowPassPeriod1Get(float *NewIMUBasedEstimationLowPassPeriod1)
+{
+    UAVObjGetDataField(AirspeedSettingsHandle(), (void *)NewIMUBasedEstimationLowPassPeriod1, offsetof(AirspeedSettingsData, IMUBasedEstimationLowPassPeriod1), sizeof(float));
+}
+void AirspeedSettingsIMUBasedEstimationLowPassPeriod2Set(float *NewIMUBasedEstimationLowPassPeriod2)
+{
+    UAVObjSetDataField(AirspeedSettingsHandle(), (void *)NewIMUBasedEstimationLowPassPeriod2, offsetof(AirspeedSettingsData, IMUBasedEstimationLowPassPeriod2), sizeof(float));
+}
+void AirspeedSettingsIMUBasedEstimationLowPassPeriod2Get(float *NewIMUBasedEstimationLowPassPeriod2)
+{
+    UAVObjGetDataField(AirspeedSettingsHandle(), (void *)NewIMUBasedEstimationLowPassPeriod2, offsetof(AirspeedSettingsData, IMUBasedEstimationLowPassPeriod2), sizeof(float));
+}
+void AirspeedSettingsZeroPointSet(uint16_t *NewZeroPoint)
+{
+    UAVObjSetDataField(AirspeedSettingsHandle(), (void *)NewZeroPoint, offsetof(AirspeedSettingsData, ZeroPoint), sizeof(uint16_t));
+}
+void AirspeedSettingsZeroPointGet(uint16_t *NewZeroPoint)
+{
+    UAVObjGetDataField(AirspeedSettingsHandle(), (void *)NewZeroPoint, offsetof(AirspeedSettingsData, ZeroPoint), sizeof(uint16_t));
+}
+void AirspeedSettingsSamplePeriodSet(uint8_t *NewSamplePeriod)
+{
+    UAVObjSetDataField(AirspeedSettingsHandle(), (void *)NewSamplePeriod, offsetof(AirspeedSettingsData, SamplePeriod), sizeof(uint8_t));
+}
+void AirspeedSettingsSamplePeriodGet(uint8_t *NewSamplePeriod)
+{
+    UAVObjGetDataField(AirspeedSettingsHandle(), (void *)NewSamplePeriod, offsetof(AirspeedSettingsData, SamplePeriod), sizeof(uint8_t));
+}
+void AirspeedSettingsAirspeedSensorTypeSet(uint8_t *NewAirspeedSensorType)
+{
+    UAVObjSetDataField(AirspeedSettingsHandle(), (void *)NewAirspeedSensorType, offsetof(AirspeedSettingsData, AirspeedSensorType), sizeof(uint8_t));
+}
+void AirspeedSettingsAirspeedSensorTypeGet(uint8_t *NewAirspeedSensorType)
+{
+    UAVObjGetDataField(AirspeedSettingsHandle(), (void *)NewAirspeedSensorType, offsetof(AirspeedSettingsData, AirspeedSensorType), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AirspeedState AirspeedState
+ * @brief UAVO for true airspeed and calibrated airspeed state estimation.
+ *
+ * Autogenerated files and functions for AirspeedState Object
+ * @{ 
+ *
+ * @file       airspeedstate.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AirspeedState object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: airspeedstate.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "airspeedstate.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AirspeedStateInitialize(void)
+{
+    // Compile time assertion that the AirspeedStateDataPacked and AirspeedStateData structs
+    // have the same size (though instances of AirspeedStateData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AirspeedStateDataPacked) == sizeof(AirspeedStateData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(AIRSPEEDSTATE_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(AIRSPEEDSTATE_OBJID,
+        AIRSPEEDSTATE_ISSINGLEINST, AIRSPEEDSTATE_ISSETTINGS, AIRSPEEDSTATE_ISPRIORITY, AIRSPEEDSTATE_NUMBYTES, &AirspeedStateSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AirspeedStateSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AirspeedStateData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AirspeedStateData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AirspeedStateHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AirspeedStateCalibratedAirspeedSet(float *NewCalibratedAirspeed)
+{
+    UAVObjSetDataField(AirspeedStateHandle(), (void *)NewCalibratedAirspeed, offsetof(AirspeedStateData, CalibratedAirspeed), sizeof(float));
+}
+void AirspeedStateCalibratedAirspeedGet(float *NewCalibratedAirspeed)
+{
+    UAVObjGetDataField(AirspeedStateHandle(), (void *)NewCalibratedAirspeed, offsetof(AirspeedStateData, CalibratedAirspeed), sizeof(float));
+}
+void AirspeedStateTrueAirspeedSet(float *NewTrueAirspeed)
+{
+    UAVObjSetDataField(AirspeedStateHandle(), (void *)NewTrueAirspeed, offsetof(AirspeedStateData, TrueAirspeed), sizeof(float));
+}
+void AirspeedStateTrueAirspeedGet(float *NewTrueAirspeed)
+{
+    UAVObjGetDataField(AirspeedStateHandle(), (void *)NewTrueAirspeed, offsetof(AirspeedStateData, TrueAirspeed), sizeof(float));
+}
+
+
+/**
+ * @}
+ */
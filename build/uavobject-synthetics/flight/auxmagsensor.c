@@ -0,0 +1,155 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup AuxMagSensor AuxMagSensor
+ * @brief Calibrated sensor data from aux 3 axis magnetometer in MilliGauss.
+ *
+ * Autogenerated files and functions for AuxMagSensor Object
+ * @{ 
+ *
+ * @file       auxmagsensor.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the AuxMagSensor object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: auxmagsensor.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "auxmagsensor.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AuxMagSensorInitialize(void)
+{
+    // Compile time assertion that the AuxMagSensorDataPacked and AuxMagSensorData structs
+    // have the same size (though instances of AuxMagSensorData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(AuxMagSensorDataPacked) == sizeof(AuxMagSensorData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(AUXMAGSENSOR_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(AUXMAGSENSOR_OBJID,
+        AUXMAGSENSOR_ISSINGLEINST, AUXMAGSENSOR_ISSETTINGS, AUXMAGSENSOR_ISPRIORITY, AUXMAGSENSOR_NUMBYTES, &AuxMagSensorSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AuxMagSensorSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    AuxMagSensorData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(AuxMagSensorData));
+    data.Status = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 10000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AuxMagSensorHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AuxMagSensorxSet(float *Newx)
+{
+    UAVObjSetDataField(AuxMagSensorHandle(), (void *)Newx, offsetof(AuxMagSensorData, x), sizeof(float));
+}
+void AuxMagSensorxGet(float *Newx)
+{
+    UAVObjGetDataField(AuxMagSensorHandle(), (void *)Newx, offsetof(AuxMagSensorData, x), sizeof(float));
+}
+void AuxMagSensorySet(float *Newy)
+{
+    UAVObjSetDataField(AuxMagSensorHandle(), (void *)Newy, offsetof(AuxMagSensorData, y), sizeof(float));
+}
+void AuxMagSensoryGet(float *Newy)
+{
+    UAVObjGetDataField(AuxMagSensorHandle(), (void *)Newy, offsetof(AuxMagSensorData, y), sizeof(float));
+}
+void AuxMagSensorzSet(float *Newz)
+{
+    UAVObjSetDataField(AuxMagSensorHandle(), (void *)Newz, offsetof(AuxMagSensorData, z), sizeof(float));
+}
+void AuxMagSensorzGet(float *Newz)
+{
+    UAVObjGetDataField(AuxMagSensorHandle(), (void *)Newz, offsetof(AuxMagSensorData, z), sizeof(float));
+}
+void AuxMagSensorStatusSet(uint8_t *NewStatus)
+{
+    UAVObjSetDataField(AuxMagSensorHandle(), (void *)NewStatus, offsetof(AuxMagSensorData, Status), sizeof(uint8_t));
+}
+void AuxMagSensorStatusGet(uint8_t *NewStatus)
+{
+    UAVObjGetDataField(AuxMagSensorHandle(), (void *)NewStatus, offsetof(AuxMagSensorData, Status), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,186 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup DebugLogEntry DebugLogEntry
+ * @brief Log Entry in Flash
+ *
+ * Autogenerated files and functions for DebugLogEntry Object
+ * @{ 
+ *
+ * @file       debuglogentry.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the DebugLogEntry object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: debuglogentry.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "debuglogentry.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t DebugLogEntryInitialize(void)
+{
+    // Compile time assertion that the DebugLogEntryDataPacked and DebugLogEntryData structs
+    // have the same size (though instances of DebugLogEntryData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(DebugLogEntryDataPacked) == sizeof(DebugLogEntryData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(DEBUGLOGENTRY_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(DEBUGLOGENTRY_OBJID,
+        DEBUGLOGENTRY_ISSINGLEINST, DEBUGLOGENTRY_ISSETTINGS, DEBUGLOGENTRY_ISPRIORITY, DEBUGLOGENTRY_NUMBYTES, &DebugLogEntrySetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void DebugLogEntrySetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    DebugLogEntryData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(DebugLogEntryData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle DebugLogEntryHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void DebugLogEntryFlightTimeSet(uint32_t *NewFlightTime)
+{
+    UAVObjSetDataField(DebugLogEntryHandle(), (void *)NewFlightTime, offsetof(DebugLogEntryData, FlightTime), sizeof(uint32_t));
+}
+void DebugLogEntryFlightTimeGet(uint32_t *NewFlightTime)
+{
+    UAVObjGetDataField(DebugLogEntryHandle(), (void *)NewFlightTime, offsetof(DebugLogEntryData, FlightTime), sizeof(uint32_t));
+}
+void DebugLogEntryObjectIDSet(uint32_t *NewObjectID)
+{
+    UAVObjSetDataField(DebugLogEntryHandle(), (void *)NewObjectID, offsetof(DebugLogEntryData, ObjectID), sizeof(uint32_t));
+}
+void DebugLogEntryObjectIDGet(uint32_t *NewObjectID)
+{
+    UAVObjGetDataField(DebugLogEntryHandle(), (void *)NewObjectID, offsetof(DebugLogEntryData, ObjectID), sizeof(uint32_t));
+}
+void DebugLogEntryFlightSet(uint16_t *NewFlight)
+{
+    UAVObjSetDataField(DebugLogEntryHandle(), (void *)NewFlight, offsetof(DebugLogEntryData, Flight), sizeof(uint16_t));
+}
+void DebugLogEntryFlightGet(uint16_t *NewFlight)
+{
+    UAVObjGetDataField(DebugLogEntryHandle(), (void *)NewFlight, offsetof(DebugLogEntryData, Flight), sizeof(uint16_t));
+}
+void DebugLogEntryEntrySet(uint16_t *NewEntry)
+{
+    UAVObjSetDataField(DebugLogEntryHandle(), (void *)NewEntry, offsetof(DebugLogEntryData, Entry), sizeof(uint16_t));
+}
+void DebugLogEntryEntryGet(uint16_t *NewEntry)
+{
+    UAVObjGetDataField(DebugLogEntryHandle(), (void *)NewEntry, offsetof(DebugLogEntryData, Entry), sizeof(uint16_t));
+}
+void DebugLogEntryInstanceIDSet(uint16_t *NewInstanceID)
+{
+    UAVObjSetDataField(DebugLogEntryHandle(), (void *)NewInstanceID, offsetof(DebugLogEntryData, InstanceID), sizeof(uint16_t));
+}
+void DebugLogEntryInstanceIDGet(uint16_t *NewInstanceID)
+{
+    UAVObjGetDataField(DebugLogEntryHandle(), (void *)NewInstanceID, offsetof(DebugLogEntryData, InstanceID), sizeof(uint16_t));
+}
+void DebugLogEntrySizeSet(uint16_t *NewSize)
+{
+    UAVObjSetDataField(DebugLogEntryHandle(), (void *)NewSize, offsetof(DebugLogEntryData, Size), sizeof(uint16_t));
+}
+void DebugLogEntrySizeGet(uint16_t *NewSize)
+{
+    UAVObjGetDataField(DebugLogEntryHandle(), (void *)NewSize, offsetof(DebugLogEntryData, Size), sizeof(uint16_t));
+}
+void DebugLogEntryTypeSet(uint8_t *NewType)
+{
+    UAVObjSetDataField(DebugLogEntryHandle(), (void *)NewType, offsetof(DebugLogEntryData, Type), sizeof(uint8_t));
+}
+void DebugLogEntryTypeGet(uint8_t *NewType)
+{
+    UAVObjGetDataField(DebugLogEntryHandle(), (void *)NewType, offsetof(DebugLogEntryData, Type), sizeof(uint8_t));
+}
+void DebugLogEntryDataSet( uint8_t *NewData )
+{
+    UAVObjSetDataField(DebugLogEntryHandle(), (void *)NewData, offsetof(DebugLogEntryData, Data), 200*sizeof(uint8_t));
+}
+void DebugLogEntryDataGet( uint8_t *NewData )
+{
+    UAVObjGetDataField(DebugLogEntryHandle(), (void *)NewData, offsetof(DebugLogEntryData, Data), 200*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
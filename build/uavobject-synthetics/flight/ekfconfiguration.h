@@ -0,0 +1,253 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup EKFConfiguration EKFConfiguration 
+ * @brief Extended Kalman Filter initialisation
+ *
+ * Autogenerated files and functions for EKFConfiguration Object
+ *
+ * @{ 
+ *
+ * @file       ekfconfiguration.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the EKFConfiguration object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: ekfconfiguration.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EKFCONFIGURATION_H
+#define EKFCONFIGURATION_H
+
+/* Object constants */
+#define EKFCONFIGURATION_OBJID 0x5E91213C
+#define EKFCONFIGURATION_ISSINGLEINST 1
+#define EKFCONFIGURATION_ISSETTINGS 1
+#define EKFCONFIGURATION_ISPRIORITY 0
+#define EKFCONFIGURATION_NUMBYTES sizeof(EKFConfigurationData)
+
+/* Generic interface functions */
+int32_t EKFConfigurationInitialize();
+UAVObjHandle EKFConfigurationHandle();
+void EKFConfigurationSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+typedef struct __attribute__ ((__packed__)) {
+    float PositionNorth;
+    float PositionEast;
+    float PositionDown;
+    float VelocityNorth;
+    float VelocityEast;
+    float VelocityDown;
+    float AttitudeQ1;
+    float AttitudeQ2;
+    float AttitudeQ3;
+    float AttitudeQ4;
+    float GyroDriftX;
+    float GyroDriftY;
+    float GyroDriftZ;
+}  EKFConfigurationPData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[13];
+}  EKFConfigurationPDataArray ;
+#define EKFConfigurationPToArray( var ) UAVObjectFieldToArray( EKFConfigurationPData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float GyroX;
+    float GyroY;
+    float GyroZ;
+    float AccelX;
+    float AccelY;
+    float AccelZ;
+    float GyroDriftX;
+    float GyroDriftY;
+    float GyroDriftZ;
+}  EKFConfigurationQData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[9];
+}  EKFConfigurationQDataArray ;
+#define EKFConfigurationQToArray( var ) UAVObjectFieldToArray( EKFConfigurationQData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float GPSPosNorth;
+    float GPSPosEast;
+    float GPSPosDown;
+    float GPSVelNorth;
+    float GPSVelEast;
+    float GPSVelDown;
+    float MagX;
+    float MagY;
+    float MagZ;
+    float BaroZ;
+}  EKFConfigurationRData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[10];
+}  EKFConfigurationRDataArray ;
+#define EKFConfigurationRToArray( var ) UAVObjectFieldToArray( EKFConfigurationRData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float FakeGPSPosIndoor;
+    float FakeGPSVelIndoor;
+    float FakeGPSVelAirspeed;
+}  EKFConfigurationFakeRData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  EKFConfigurationFakeRDataArray ;
+#define EKFConfigurationFakeRToArray( var ) UAVObjectFieldToArray( EKFConfigurationFakeRData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+    EKFConfigurationPData P;
+    EKFConfigurationQData Q;
+    EKFConfigurationRData R;
+    EKFConfigurationFakeRData FakeR;
+} __attribute__((packed)) EKFConfigurationDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef EKFConfigurationDataPacked __attribute__((aligned(4))) EKFConfigurationData;
+    
+/* Typesafe Object access functions */
+static inline int32_t EKFConfigurationGet(EKFConfigurationData *dataOut) { return UAVObjGetData(EKFConfigurationHandle(), dataOut); }
+static inline int32_t EKFConfigurationSet(const EKFConfigurationData *dataIn) { return UAVObjSetData(EKFConfigurationHandle(), dataIn); }
+static inline int32_t EKFConfigurationInstGet(uint16_t instId, EKFConfigurationData *dataOut) { return UAVObjGetInstanceData(EKFConfigurationHandle(), instId, dataOut); }
+static inline int32_t EKFConfigurationInstSet(uint16_t instId, const EKFConfigurationData *dataIn) { return UAVObjSetInstanceData(EKFConfigurationHandle(), instId, dataIn); }
+static inline int32_t EKFConfigurationConnectQueue(xQueueHandle queue) { return UAVObjConnectQueue(EKFConfigurationHandle(), queue, EV_MASK_ALL_UPDATES); }
+static inline int32_t EKFConfigurationConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(EKFConfigurationHandle(), cb, EV_MASK_ALL_UPDATES); }
+static inline uint16_t EKFConfigurationCreateInstance() { return UAVObjCreateInstance(EKFConfigurationHandle(), &EKFConfigurationSetDefaults); }
+static inline void EKFConfigurationRequestUpdate() { UAVObjRequestUpdate(EKFConfigurationHandle()); }
+static inline void EKFConfigurationRequestInstUpdate(uint16_t instId) { UAVObjRequestInstanceUpdate(EKFConfigurationHandle(), instId); }
+static inline void EKFConfigurationUpdated() { UAVObjUpdated(EKFConfigurationHandle()); }
+static inline void EKFConfigurationInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(EKFConfigurationHandle(), instId); }
+static inline void EKFConfigurationLogging() { UAVObjLogging(EKFConfigurationHandle()); }
+static inline void EKFConfigurationInstLogging(uint16_t instId) { UAVObjInstanceLogging(EKFConfigurationHandle(), instId); }
+static inline int32_t EKFConfigurationGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(EKFConfigurationHandle(), dataOut); }
+static inline int32_t EKFConfigurationSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(EKFConfigurationHandle(), dataIn); }
+static inline int8_t EKFConfigurationReadOnly() { return UAVObjReadOnly(EKFConfigurationHandle()); }
+
+/* Field P information */
+
+// Array element names for field P
+typedef enum {
+    EKFCONFIGURATION_P_POSITIONNORTH=0,
+    EKFCONFIGURATION_P_POSITIONEAST=1,
+    EKFCONFIGURATION_P_POSITIONDOWN=2,
+    EKFCONFIGURATION_P_VELOCITYNORTH=3,
+    EKFCONFIGURATION_P_VELOCITYEAST=4,
+    EKFCONFIGURATION_P_VELOCITYDOWN=5,
+    EKFCONFIGURATION_P_ATTITUDEQ1=6,
+    EKFCONFIGURATION_P_ATTITUDEQ2=7,
+    EKFCONFIGURATION_P_ATTITUDEQ3=8,
+    EKFCONFIGURATION_P_ATTITUDEQ4=9,
+    EKFCONFIGURATION_P_GYRODRIFTX=10,
+    EKFCONFIGURATION_P_GYRODRIFTY=11,
+    EKFCONFIGURATION_P_GYRODRIFTZ=12
+} EKFConfigurationPElem;
+
+// Number of elements for field P
+#define EKFCONFIGURATION_P_NUMELEM 13
+
+/* Field Q information */
+
+// Array element names for field Q
+typedef enum {
+    EKFCONFIGURATION_Q_GYROX=0,
+    EKFCONFIGURATION_Q_GYROY=1,
+    EKFCONFIGURATION_Q_GYROZ=2,
+    EKFCONFIGURATION_Q_ACCELX=3,
+    EKFCONFIGURATION_Q_ACCELY=4,
+    EKFCONFIGURATION_Q_ACCELZ=5,
+    EKFCONFIGURATION_Q_GYRODRIFTX=6,
+    EKFCONFIGURATION_Q_GYRODRIFTY=7,
+    EKFCONFIGURATION_Q_GYRODRIFTZ=8
+} EKFConfigurationQElem;
+
+// Number of elements for field Q
+#define EKFCONFIGURATION_Q_NUMELEM 9
+
+/* Field R information */
+
+// Array element names for field R
+typedef enum {
+    EKFCONFIGURATION_R_GPSPOSNORTH=0,
+    EKFCONFIGURATION_R_GPSPOSEAST=1,
+    EKFCONFIGURATION_R_GPSPOSDOWN=2,
+    EKFCONFIGURATION_R_GPSVELNORTH=3,
+    EKFCONFIGURATION_R_GPSVELEAST=4,
+    EKFCONFIGURATION_R_GPSVELDOWN=5,
+    EKFCONFIGURATION_R_MAGX=6,
+    EKFCONFIGURATION_R_MAGY=7,
+    EKFCONFIGURATION_R_MAGZ=8,
+    EKFCONFIGURATION_R_BAROZ=9
+} EKFConfigurationRElem;
+
+// Number of elements for field R
+#define EKFCONFIGURATION_R_NUMELEM 10
+
+/* Field FakeR information */
+
+// Array element names for field FakeR
+typedef enum {
+    EKFCONFIGURATION_FAKER_FAKEGPSPOSINDOOR=0,
+    EKFCONFIGURATION_FAKER_FAKEGPSVELINDOOR=1,
+    EKFCONFIGURATION_FAKER_FAKEGPSVELAIRSPEED=2
+} EKFConfigurationFakeRElem;
+
+// Number of elements for field FakeR
+#define EKFCONFIGURATION_FAKER_NUMELEM 3
+
+
+
+/* Set/Get functions */
+extern void EKFConfigurationPSet(EKFConfigurationPData *NewP);
+extern void EKFConfigurationPGet(EKFConfigurationPData *NewP);
+extern void EKFConfigurationPArraySet(float *NewP);
+extern void EKFConfigurationPArrayGet(float *NewP);
+extern void EKFConfigurationQSet(EKFConfigurationQData *NewQ);
+extern void EKFConfigurationQGet(EKFConfigurationQData *NewQ);
+extern void EKFConfigurationQArraySet(float *NewQ);
+extern void EKFConfigurationQArrayGet(float *NewQ);
+extern void EKFConfigurationRSet(EKFConfigurationRData *NewR);
+extern void EKFConfigurationRGet(EKFConfigurationRData *NewR);
+extern void EKFConfigurationRArraySet(float *NewR);
+extern void EKFConfigurationRArrayGet(float *NewR);
+extern void EKFConfigurationFakeRSet(EKFConfigurationFakeRData *NewFakeR);
+extern void EKFConfigurationFakeRGet(EKFConfigurationFakeRData *NewFakeR);
+extern void EKFConfigurationFakeRArraySet(float *NewFakeR);
+extern void EKFConfigurationFakeRArrayGet(float *NewFakeR);
+
+
+#endif // EKFCONFIGURATION_H
+
+/**
+ * @}
+ * @}
+ */
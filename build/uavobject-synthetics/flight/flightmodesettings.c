@@ -0,0 +1,346 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup FlightModeSettings FlightModeSettings
+ * @brief Settings to control arming and flight mode
+ *
+ * Autogenerated files and functions for FlightModeSettings Object
+ * @{ 
+ *
+ * @file       flightmodesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the FlightModeSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: flightmodesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "flightmodesettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FlightModeSettingsInitialize(void)
+{
+    // Compile time assertion that the FlightModeSettingsDataPacked and FlightModeSettingsData structs
+    // have the same size (though instances of FlightModeSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(FlightModeSettingsDataPacked) == sizeof(FlightModeSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(FLIGHTMODESETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(FLIGHTMODESETTINGS_OBJID,
+        FLIGHTMODESETTINGS_ISSINGLEINST, FLIGHTMODESETTINGS_ISSETTINGS, FLIGHTMODESETTINGS_ISPRIORITY, FLIGHTMODESETTINGS_NUMBYTES, &FlightModeSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FlightModeSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    FlightModeSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(FlightModeSettingsData));
+    data.ReturnToBaseAltitudeOffset = 1.000000e+01f;
+    data.LandingVelocity = 4.000000e-01f;
+    data.PositionHoldOffset.Horizontal = 3.000000e+01f;
+    data.PositionHoldOffset.Vertical = 1.500000e+01f;
+    data.VarioControlLowPassAlpha = 9.800000e-01f;
+    data.ArmedTimeout = 30000;
+    data.ArmingSequenceTime = 1000;
+    data.DisarmingSequenceTime = 1000;
+    data.Arming = 0;
+    data.Stabilization1Settings.Roll = 2;
+    data.Stabilization1Settings.Pitch = 2;
+    data.Stabilization1Settings.Yaw = 3;
+    data.Stabilization1Settings.Thrust = 0;
+    data.Stabilization2Settings.Roll = 2;
+    data.Stabilization2Settings.Pitch = 2;
+    data.Stabilization2Settings.Yaw = 1;
+    data.Stabilization2Settings.Thrust = 0;
+    data.Stabilization3Settings.Roll = 1;
+    data.Stabilization3Settings.Pitch = 1;
+    data.Stabilization3Settings.Yaw = 1;
+    data.Stabilization3Settings.Thrust = 0;
+    data.Stabilization4Settings.Roll = 2;
+    data.Stabilization4Settings.Pitch = 2;
+    data.Stabilization4Settings.Yaw = 3;
+    data.Stabilization4Settings.Thrust = 10;
+    data.Stabilization5Settings.Roll = 2;
+    data.Stabilization5Settings.Pitch = 2;
+    data.Stabilization5Settings.Yaw = 1;
+    data.Stabilization5Settings.Thrust = 10;
+    data.Stabilization6Settings.Roll = 1;
+    data.Stabilization6Settings.Pitch = 1;
+    data.Stabilization6Settings.Yaw = 1;
+    data.Stabilization6Settings.Thrust = 0;
+    data.FlightModePosition[0] = 1;
+    data.FlightModePosition[1] = 2;
+    data.FlightModePosition[2] = 3;
+    data.FlightModePosition[3] = 4;
+    data.FlightModePosition[4] = 5;
+    data.FlightModePosition[5] = 6;
+    data.DisableSanityChecks = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FlightModeSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void FlightModeSettingsReturnToBaseAltitudeOffsetSet(float *NewReturnToBaseAltitudeOffset)
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewReturnToBaseAltitudeOffset, offsetof(FlightModeSettingsData, ReturnToBaseAltitudeOffset), sizeof(float));
+}
+void FlightModeSettingsReturnToBaseAltitudeOffsetGet(float *NewReturnToBaseAltitudeOffset)
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewReturnToBaseAltitudeOffset, offsetof(FlightModeSettingsData, ReturnToBaseAltitudeOffset), sizeof(float));
+}
+void FlightModeSettingsLandingVelocitySet(float *NewLandingVelocity)
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewLandingVelocity, offsetof(FlightModeSettingsData, LandingVelocity), sizeof(float));
+}
+void FlightModeSettingsLandingVelocityGet(float *NewLandingVelocity)
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewLandingVelocity, offsetof(FlightModeSettingsData, LandingVelocity), sizeof(float));
+}
+void FlightModeSettingsPositionHoldOffsetSet( FlightModeSettingsPositionHoldOffsetData *NewPositionHoldOffset )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+void FlightModeSettingsPositionHoldOffsetGet( FlightModeSettingsPositionHoldOffsetData *NewPositionHoldOffset )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+void FlightModeSettingsPositionHoldOffsetArraySet( float *NewPositionHoldOffset )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+void FlightModeSettingsPositionHoldOffsetArrayGet( float *NewPositionHoldOffset )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewPositionHoldOffset, offsetof(FlightModeSettingsData, PositionHoldOffset), 2*sizeof(float));
+}
+void FlightModeSettingsVarioControlLowPassAlphaSet(float *NewVarioControlLowPassAlpha)
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewVarioControlLowPassAlpha, offsetof(FlightModeSettingsData, VarioControlLowPassAlpha), sizeof(float));
+}
+void FlightModeSettingsVarioControlLowPassAlphaGet(float *NewVarioControlLowPassAlpha)
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewVarioControlLowPassAlpha, offsetof(FlightModeSettingsData, VarioControlLowPassAlpha), sizeof(float));
+}
+void FlightModeSettingsArmedTimeoutSet(uint16_t *NewArmedTimeout)
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewArmedTimeout, offsetof(FlightModeSettingsData, ArmedTimeout), sizeof(uint16_t));
+}
+void FlightModeSettingsArmedTimeoutGet(uint16_t *NewArmedTimeout)
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewArmedTimeout, offsetof(FlightModeSettingsData, ArmedTimeout), sizeof(uint16_t));
+}
+void FlightModeSettingsArmingSequenceTimeSet(uint16_t *NewArmingSequenceTime)
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewArmingSequenceTime, offsetof(FlightModeSettingsData, ArmingSequenceTime), sizeof(uint16_t));
+}
+void FlightModeSettingsArmingSequenceTimeGet(uint16_t *NewArmingSequenceTime)
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewArmingSequenceTime, offsetof(FlightModeSettingsData, ArmingSequenceTime), sizeof(uint16_t));
+}
+void FlightModeSettingsDisarmingSequenceTimeSet(uint16_t *NewDisarmingSequenceTime)
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewDisarmingSequenceTime, offsetof(FlightModeSettingsData, DisarmingSequenceTime), sizeof(uint16_t));
+}
+void FlightModeSettingsDisarmingSequenceTimeGet(uint16_t *NewDisarmingSequenceTime)
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewDisarmingSequenceTime, offsetof(FlightModeSettingsData, DisarmingSequenceTime), sizeof(uint16_t));
+}
+void FlightModeSettingsArmingSet(uint8_t *NewArming)
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewArming, offsetof(FlightModeSettingsData, Arming), sizeof(uint8_t));
+}
+void FlightModeSettingsArmingGet(uint8_t *NewArming)
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewArming, offsetof(FlightModeSettingsData, Arming), sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization1SettingsSet( FlightModeSettingsStabilization1SettingsData *NewStabilization1Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization1SettingsGet( FlightModeSettingsStabilization1SettingsData *NewStabilization1Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization1SettingsArraySet( uint8_t *NewStabilization1Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization1SettingsArrayGet( uint8_t *NewStabilization1Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization1Settings, offsetof(FlightModeSettingsData, Stabilization1Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization2SettingsSet( FlightModeSettingsStabilization2SettingsData *NewStabilization2Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization2SettingsGet( FlightModeSettingsStabilization2SettingsData *NewStabilization2Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization2SettingsArraySet( uint8_t *NewStabilization2Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization2SettingsArrayGet( uint8_t *NewStabilization2Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization2Settings, offsetof(FlightModeSettingsData, Stabilization2Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization3SettingsSet( FlightModeSettingsStabilization3SettingsData *NewStabilization3Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization3SettingsGet( FlightModeSettingsStabilization3SettingsData *NewStabilization3Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization3SettingsArraySet( uint8_t *NewStabilization3Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization3SettingsArrayGet( uint8_t *NewStabilization3Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization3Settings, offsetof(FlightModeSettingsData, Stabilization3Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization4SettingsSet( FlightModeSettingsStabilization4SettingsData *NewStabilization4Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization4SettingsGet( FlightModeSettingsStabilization4SettingsData *NewStabilization4Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization4SettingsArraySet( uint8_t *NewStabilization4Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization4SettingsArrayGet( uint8_t *NewStabilization4Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization4Settings, offsetof(FlightModeSettingsData, Stabilization4Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization5SettingsSet( FlightModeSettingsStabilization5SettingsData *NewStabilization5Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization5SettingsGet( FlightModeSettingsStabilization5SettingsData *NewStabilization5Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization5SettingsArraySet( uint8_t *NewStabilization5Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization5SettingsArrayGet( uint8_t *NewStabilization5Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization5Settings, offsetof(FlightModeSettingsData, Stabilization5Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization6SettingsSet( FlightModeSettingsStabilization6SettingsData *NewStabilization6Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization6SettingsGet( FlightModeSettingsStabilization6SettingsData *NewStabilization6Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization6SettingsArraySet( uint8_t *NewStabilization6Settings )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsStabilization6SettingsArrayGet( uint8_t *NewStabilization6Settings )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewStabilization6Settings, offsetof(FlightModeSettingsData, Stabilization6Settings), 4*sizeof(uint8_t));
+}
+void FlightModeSettingsFlightModePositionSet( uint8_t *NewFlightModePosition )
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewFlightModePosition, offsetof(FlightModeSettingsData, FlightModePosition), 6*sizeof(uint8_t));
+}
+void FlightModeSettingsFlightModePositionGet( uint8_t *NewFlightModePosition )
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewFlightModePosition, offsetof(FlightModeSettingsData, FlightModePosition), 6*sizeof(uint8_t));
+}
+void FlightModeSettingsDisableSanityChecksSet(uint8_t *NewDisableSanityChecks)
+{
+    UAVObjSetDataField(FlightModeSettingsHandle(), (void *)NewDisableSanityChecks, offsetof(FlightModeSettingsData, DisableSanityChecks), sizeof(uint8_t));
+}
+void FlightModeSettingsDisableSanityChecksGet(uint8_t *NewDisableSanityChecks)
+{
+    UAVObjGetDataField(FlightModeSettingsHandle(), (void *)NewDisableSanityChecks, offsetof(FlightModeSettingsData, DisableSanityChecks), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
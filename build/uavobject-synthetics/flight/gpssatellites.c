@@ -0,0 +1,162 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup GPSSatellites GPSSatellites
+ * @brief Contains information about the GPS satellites in view from @ref GPSModule.
+ *
+ * Autogenerated files and functions for GPSSatellites Object
+ * @{ 
+ *
+ * @file       gpssatellites.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the GPSSatellites object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gpssatellites.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "gpssatellites.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GPSSatellitesInitialize(void)
+{
+    // Compile time assertion that the GPSSatellitesDataPacked and GPSSatellitesData structs
+    // have the same size (though instances of GPSSatellitesData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(GPSSatellitesDataPacked) == sizeof(GPSSatellitesData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(GPSSATELLITES_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(GPSSATELLITES_OBJID,
+        GPSSATELLITES_ISSINGLEINST, GPSSATELLITES_ISSETTINGS, GPSSATELLITES_ISPRIORITY, GPSSATELLITES_NUMBYTES, &GPSSatellitesSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GPSSatellitesSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    GPSSatellitesData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(GPSSatellitesData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 10000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GPSSatellitesHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void GPSSatellitesAzimuthSet( int16_t *NewAzimuth )
+{
+    UAVObjSetDataField(GPSSatellitesHandle(), (void *)NewAzimuth, offsetof(GPSSatellitesData, Azimuth), 16*sizeof(int16_t));
+}
+void GPSSatellitesAzimuthGet( int16_t *NewAzimuth )
+{
+    UAVObjGetDataField(GPSSatellitesHandle(), (void *)NewAzimuth, offsetof(GPSSatellitesData, Azimuth), 16*sizeof(int16_t));
+}
+void GPSSatellitesSatsInViewSet(int8_t *NewSatsInView)
+{
+    UAVObjSetDataField(GPSSatellitesHandle(), (void *)NewSatsInView, offsetof(GPSSatellitesData, SatsInView), sizeof(int8_t));
+}
+void GPSSatellitesSatsInViewGet(int8_t *NewSatsInView)
+{
+    UAVObjGetDataField(GPSSatellitesHandle(), (void *)NewSatsInView, offsetof(GPSSatellitesData, SatsInView), sizeof(int8_t));
+}
+void GPSSatellitesPRNSet( int8_t *NewPRN )
+{
+    UAVObjSetDataField(GPSSatellitesHandle(), (void *)NewPRN, offsetof(GPSSatellitesData, PRN), 16*sizeof(int8_t));
+}
+void GPSSatellitesPRNGet( int8_t *NewPRN )
+{
+    UAVObjGetDataField(GPSSatellitesHandle(), (void *)NewPRN, offsetof(GPSSatellitesData, PRN), 16*sizeof(int8_t));
+}
+void GPSSatellitesElevationSet( int8_t *NewElevation )
+{
+    UAVObjSetDataField(GPSSatellitesHandle(), (void *)NewElevation, offsetof(GPSSatellitesData, Elevation), 16*sizeof(int8_t));
+}
+void GPSSatellitesElevationGet( int8_t *NewElevation )
+{
+    UAVObjGetDataField(GPSSatellitesHandle(), (void *)NewElevation, offsetof(GPSSatellitesData, Elevation), 16*sizeof(int8_t));
+}
+void GPSSatellitesSNRSet( int8_t *NewSNR )
+{
+    UAVObjSetDataField(GPSSatellitesHandle(), (void *)NewSNR, offsetof(GPSSatellitesData, SNR), 16*sizeof(int8_t));
+}
+void GPSSatellitesSNRGet( int8_t *NewSNR )
+{
+    UAVObjGetDataField(GPSSatellitesHandle(), (void *)NewSNR, offsetof(GPSSatellitesData, SNR), 16*sizeof(int8_t));
+}
+
+
+/**
+ * @}
+ */
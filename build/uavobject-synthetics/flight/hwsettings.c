@@ -0,0 +1,339 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup HwSettings HwSettings
+ * @brief Selection of optional hardware configurations.
+ *
+ * Autogenerated files and functions for HwSettings Object
+ * @{ 
+ *
+ * @file       hwsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the HwSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "hwsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwSettingsInitialize(void)
+{
+    // Compile time assertion that the HwSettingsDataPacked and HwSettingsData structs
+    // have the same size (though instances of HwSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(HwSettingsDataPacked) == sizeof(HwSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(HWSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(HWSETTINGS_OBJID,
+        HWSETTINGS_ISSINGLEINST, HWSETTINGS_ISSETTINGS, HWSETTINGS_ISPRIORITY, HWSETTINGS_NUMBYTES, &HwSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    HwSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(HwSettingsData));
+    data.CC_RcvrPort = 1;
+    data.CC_MainPort = 1;
+    data.CC_FlexiPort = 0;
+    data.RV_RcvrPort = 1;
+    data.RV_AuxPort = 0;
+    data.RV_AuxSBusPort = 0;
+    data.RV_FlexiPort = 0;
+    data.RV_TelemetryPort = 1;
+    data.RV_GPSPort = 2;
+    data.RM_RcvrPort = 1;
+    data.RM_MainPort = 0;
+    data.RM_FlexiPort = 0;
+    data.TelemetrySpeed = 5;
+    data.GPSSpeed = 5;
+    data.ComUsbBridgeSpeed = 5;
+    data.USB_HIDPort = 0;
+    data.USB_VCPPort = 3;
+    data.OptionalModules.CameraStab = 0;
+    data.OptionalModules.GPS = 0;
+    data.OptionalModules.Fault = 0;
+    data.OptionalModules.Altitude = 0;
+    data.OptionalModules.Airspeed = 0;
+    data.OptionalModules.TxPID = 0;
+    data.OptionalModules.Battery = 0;
+    data.OptionalModules.Overo = 0;
+    data.OptionalModules.MagBaro = 0;
+    data.OptionalModules.OsdHk = 0;
+    data.ADCRouting.adc0 = 0;
+    data.ADCRouting.adc1 = 0;
+    data.ADCRouting.adc2 = 0;
+    data.ADCRouting.adc3 = 0;
+    data.DSMxBind = 0;
+    data.WS2811LED_Out = 8;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwSettingsCC_RcvrPortSet(uint8_t *NewCC_RcvrPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewCC_RcvrPort, offsetof(HwSettingsData, CC_RcvrPort), sizeof(uint8_t));
+}
+void HwSettingsCC_RcvrPortGet(uint8_t *NewCC_RcvrPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewCC_RcvrPort, offsetof(HwSettingsData, CC_RcvrPort), sizeof(uint8_t));
+}
+void HwSettingsCC_MainPortSet(uint8_t *NewCC_MainPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewCC_MainPort, offsetof(HwSettingsData, CC_MainPort), sizeof(uint8_t));
+}
+void HwSettingsCC_MainPortGet(uint8_t *NewCC_MainPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewCC_MainPort, offsetof(HwSettingsData, CC_MainPort), sizeof(uint8_t));
+}
+void HwSettingsCC_FlexiPortSet(uint8_t *NewCC_FlexiPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewCC_FlexiPort, offsetof(HwSettingsData, CC_FlexiPort), sizeof(uint8_t));
+}
+void HwSettingsCC_FlexiPortGet(uint8_t *NewCC_FlexiPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewCC_FlexiPort, offsetof(HwSettingsData, CC_FlexiPort), sizeof(uint8_t));
+}
+void HwSettingsRV_RcvrPortSet(uint8_t *NewRV_RcvrPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_RcvrPort, offsetof(HwSettingsData, RV_RcvrPort), sizeof(uint8_t));
+}
+void HwSettingsRV_RcvrPortGet(uint8_t *NewRV_RcvrPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_RcvrPort, offsetof(HwSettingsData, RV_RcvrPort), sizeof(uint8_t));
+}
+void HwSettingsRV_AuxPortSet(uint8_t *NewRV_AuxPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_AuxPort, offsetof(HwSettingsData, RV_AuxPort), sizeof(uint8_t));
+}
+void HwSettingsRV_AuxPortGet(uint8_t *NewRV_AuxPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_AuxPort, offsetof(HwSettingsData, RV_AuxPort), sizeof(uint8_t));
+}
+void HwSettingsRV_AuxSBusPortSet(uint8_t *NewRV_AuxSBusPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_AuxSBusPort, offsetof(HwSettingsData, RV_AuxSBusPort), sizeof(uint8_t));
+}
+void HwSettingsRV_AuxSBusPortGet(uint8_t *NewRV_AuxSBusPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_AuxSBusPort, offsetof(HwSettingsData, RV_AuxSBusPort), sizeof(uint8_t));
+}
+void HwSettingsRV_FlexiPortSet(uint8_t *NewRV_FlexiPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_FlexiPort, offsetof(HwSettingsData, RV_FlexiPort), sizeof(uint8_t));
+}
+void HwSettingsRV_FlexiPortGet(uint8_t *NewRV_FlexiPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_FlexiPort, offsetof(HwSettingsData, RV_FlexiPort), sizeof(uint8_t));
+}
+void HwSettingsRV_TelemetryPortSet(uint8_t *NewRV_TelemetryPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_TelemetryPort, offsetof(HwSettingsData, RV_TelemetryPort), sizeof(uint8_t));
+}
+void HwSettingsRV_TelemetryPortGet(uint8_t *NewRV_TelemetryPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_TelemetryPort, offsetof(HwSettingsData, RV_TelemetryPort), sizeof(uint8_t));
+}
+void HwSettingsRV_GPSPortSet(uint8_t *NewRV_GPSPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRV_GPSPort, offsetof(HwSettingsData, RV_GPSPort), sizeof(uint8_t));
+}
+void HwSettingsRV_GPSPortGet(uint8_t *NewRV_GPSPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRV_GPSPort, offsetof(HwSettingsData, RV_GPSPort), sizeof(uint8_t));
+}
+void HwSettingsRM_RcvrPortSet(uint8_t *NewRM_RcvrPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRM_RcvrPort, offsetof(HwSettingsData, RM_RcvrPort), sizeof(uint8_t));
+}
+void HwSettingsRM_RcvrPortGet(uint8_t *NewRM_RcvrPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRM_RcvrPort, offsetof(HwSettingsData, RM_RcvrPort), sizeof(uint8_t));
+}
+void HwSettingsRM_MainPortSet(uint8_t *NewRM_MainPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRM_MainPort, offsetof(HwSettingsData, RM_MainPort), sizeof(uint8_t));
+}
+void HwSettingsRM_MainPortGet(uint8_t *NewRM_MainPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRM_MainPort, offsetof(HwSettingsData, RM_MainPort), sizeof(uint8_t));
+}
+void HwSettingsRM_FlexiPortSet(uint8_t *NewRM_FlexiPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewRM_FlexiPort, offsetof(HwSettingsData, RM_FlexiPort), sizeof(uint8_t));
+}
+void HwSettingsRM_FlexiPortGet(uint8_t *NewRM_FlexiPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewRM_FlexiPort, offsetof(HwSettingsData, RM_FlexiPort), sizeof(uint8_t));
+}
+void HwSettingsTelemetrySpeedSet(uint8_t *NewTelemetrySpeed)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewTelemetrySpeed, offsetof(HwSettingsData, TelemetrySpeed), sizeof(uint8_t));
+}
+void HwSettingsTelemetrySpeedGet(uint8_t *NewTelemetrySpeed)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewTelemetrySpeed, offsetof(HwSettingsData, TelemetrySpeed), sizeof(uint8_t));
+}
+void HwSettingsGPSSpeedSet(uint8_t *NewGPSSpeed)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewGPSSpeed, offsetof(HwSettingsData, GPSSpeed), sizeof(uint8_t));
+}
+void HwSettingsGPSSpeedGet(uint8_t *NewGPSSpeed)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewGPSSpeed, offsetof(HwSettingsData, GPSSpeed), sizeof(uint8_t));
+}
+void HwSettingsComUsbBridgeSpeedSet(uint8_t *NewComUsbBridgeSpeed)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewComUsbBridgeSpeed, offsetof(HwSettingsData, ComUsbBridgeSpeed), sizeof(uint8_t));
+}
+void HwSettingsComUsbBridgeSpeedGet(uint8_t *NewComUsbBridgeSpeed)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewComUsbBridgeSpeed, offsetof(HwSettingsData, ComUsbBridgeSpeed), sizeof(uint8_t));
+}
+void HwSettingsUSB_HIDPortSet(uint8_t *NewUSB_HIDPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewUSB_HIDPort, offsetof(HwSettingsData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSettingsUSB_HIDPortGet(uint8_t *NewUSB_HIDPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewUSB_HIDPort, offsetof(HwSettingsData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwSettingsUSB_VCPPortSet(uint8_t *NewUSB_VCPPort)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewUSB_VCPPort, offsetof(HwSettingsData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSettingsUSB_VCPPortGet(uint8_t *NewUSB_VCPPort)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewUSB_VCPPort, offsetof(HwSettingsData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwSettingsOptionalModulesSet( HwSettingsOptionalModulesData *NewOptionalModules )
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewOptionalModules, offsetof(HwSettingsData, OptionalModules), 10*sizeof(uint8_t));
+}
+void HwSettingsOptionalModulesGet( HwSettingsOptionalModulesData *NewOptionalModules )
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewOptionalModules, offsetof(HwSettingsData, OptionalModules), 10*sizeof(uint8_t));
+}
+void HwSettingsOptionalModulesArraySet( uint8_t *NewOptionalModules )
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewOptionalModules, offsetof(HwSettingsData, OptionalModules), 10*sizeof(uint8_t));
+}
+void HwSettingsOptionalModulesArrayGet( uint8_t *NewOptionalModules )
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewOptionalModules, offsetof(HwSettingsData, OptionalModules), 10*sizeof(uint8_t));
+}
+void HwSettingsADCRoutingSet( HwSettingsADCRoutingData *NewADCRouting )
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewADCRouting, offsetof(HwSettingsData, ADCRouting), 4*sizeof(uint8_t));
+}
+void HwSettingsADCRoutingGet( HwSettingsADCRoutingData *NewADCRouting )
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewADCRouting, offsetof(HwSettingsData, ADCRouting), 4*sizeof(uint8_t));
+}
+void HwSettingsADCRoutingArraySet( uint8_t *NewADCRouting )
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewADCRouting, offsetof(HwSettingsData, ADCRouting), 4*sizeof(uint8_t));
+}
+void HwSettingsADCRoutingArrayGet( uint8_t *NewADCRouting )
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewADCRouting, offsetof(HwSettingsData, ADCRouting), 4*sizeof(uint8_t));
+}
+void HwSettingsDSMxBindSet(uint8_t *NewDSMxBind)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewDSMxBind, offsetof(HwSettingsData, DSMxBind), sizeof(uint8_t));
+}
+void HwSettingsDSMxBindGet(uint8_t *NewDSMxBind)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewDSMxBind, offsetof(HwSettingsData, DSMxBind), sizeof(uint8_t));
+}
+void HwSettingsWS2811LED_OutSet(uint8_t *NewWS2811LED_Out)
+{
+    UAVObjSetDataField(HwSettingsHandle(), (void *)NewWS2811LED_Out, offsetof(HwSettingsData, WS2811LED_Out), sizeof(uint8_t));
+}
+void HwSettingsWS2811LED_OutGet(uint8_t *NewWS2811LED_Out)
+{
+    UAVObjGetDataField(HwSettingsHandle(), (void *)NewWS2811LED_Out, offsetof(HwSettingsData, WS2811LED_Out), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup Mpu6000Settings Mpu6000Settings
+ * @brief Settings for the @ref MPU6000 sensor used on CC3D and Revolution. Reboot the board for this to takes effect
+ *
+ * Autogenerated files and functions for Mpu6000Settings Object
+ * @{ 
+ *
+ * @file       mpu6000settings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the Mpu6000Settings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: mpu6000settings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "mpu6000settings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t Mpu6000SettingsInitialize(void)
+{
+    // Compile time assertion that the Mpu6000SettingsDataPacked and Mpu6000SettingsData structs
+    // have the same size (though instances of Mpu6000SettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(Mpu6000SettingsDataPacked) == sizeof(Mpu6000SettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(MPU6000SETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(MPU6000SETTINGS_OBJID,
+        MPU6000SETTINGS_ISSINGLEINST, MPU6000SETTINGS_ISSETTINGS, MPU6000SETTINGS_ISPRIORITY, MPU6000SETTINGS_NUMBYTES, &Mpu6000SettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void Mpu6000SettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    Mpu6000SettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(Mpu6000SettingsData));
+    data.GyroScale = 3;
+    data.AccelScale = 2;
+    data.FilterSetting = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle Mpu6000SettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void Mpu6000SettingsGyroScaleSet(uint8_t *NewGyroScale)
+{
+    UAVObjSetDataField(Mpu6000SettingsHandle(), (void *)NewGyroScale, offsetof(Mpu6000SettingsData, GyroScale), sizeof(uint8_t));
+}
+void Mpu6000SettingsGyroScaleGet(uint8_t *NewGyroScale)
+{
+    UAVObjGetDataField(Mpu6000SettingsHandle(), (void *)NewGyroScale, offsetof(Mpu6000SettingsData, GyroScale), sizeof(uint8_t));
+}
+void Mpu6000SettingsAccelScaleSet(uint8_t *NewAccelScale)
+{
+    UAVObjSetDataField(Mpu6000SettingsHandle(), (void *)NewAccelScale, offsetof(Mpu6000SettingsData, AccelScale), sizeof(uint8_t));
+}
+void Mpu6000SettingsAccelScaleGet(uint8_t *NewAccelScale)
+{
+    UAVObjGetDataField(Mpu6000SettingsHandle(), (void *)NewAccelScale, offsetof(Mpu6000SettingsData, AccelScale), sizeof(uint8_t));
+}
+void Mpu6000SettingsFilterSettingSet(uint8_t *NewFilterSetting)
+{
+    UAVObjSetDataField(Mpu6000SettingsHandle(), (void *)NewFilterSetting, offsetof(Mpu6000SettingsData, FilterSetting), sizeof(uint8_t));
+}
+void Mpu6000SettingsFilterSettingGet(uint8_t *NewFilterSetting)
+{
+    UAVObjGetDataField(Mpu6000SettingsHandle(), (void *)NewFilterSetting, offsetof(Mpu6000SettingsData, FilterSetting), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
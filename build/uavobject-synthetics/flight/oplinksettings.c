@@ -0,0 +1,230 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup OPLinkSettings OPLinkSettings
+ * @brief OPLink configurations options.
+ *
+ * Autogenerated files and functions for OPLinkSettings Object
+ * @{ 
+ *
+ * @file       oplinksettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the OPLinkSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: oplinksettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "oplinksettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OPLinkSettingsInitialize(void)
+{
+    // Compile time assertion that the OPLinkSettingsDataPacked and OPLinkSettingsData structs
+    // have the same size (though instances of OPLinkSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(OPLinkSettingsDataPacked) == sizeof(OPLinkSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(OPLINKSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(OPLINKSETTINGS_OBJID,
+        OPLINKSETTINGS_ISSINGLEINST, OPLINKSETTINGS_ISSETTINGS, OPLINKSETTINGS_ISPRIORITY, OPLINKSETTINGS_NUMBYTES, &OPLinkSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OPLinkSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    OPLinkSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(OPLinkSettingsData));
+    data.CoordID = 0;
+    data.Coordinator = 0;
+    data.OneWay = 0;
+    data.PPM = 0;
+    data.PPMOnly = 0;
+    data.MainPort = 0;
+    data.FlexiPort = 0;
+    data.VCPPort = 0;
+    data.ComSpeed = 3;
+    data.MaxRFPower = 0;
+    data.MinChannel = 0;
+    data.MaxChannel = 250;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OPLinkSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OPLinkSettingsCoordIDSet(uint32_t *NewCoordID)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewCoordID, offsetof(OPLinkSettingsData, CoordID), sizeof(uint32_t));
+}
+void OPLinkSettingsCoordIDGet(uint32_t *NewCoordID)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewCoordID, offsetof(OPLinkSettingsData, CoordID), sizeof(uint32_t));
+}
+void OPLinkSettingsCoordinatorSet(uint8_t *NewCoordinator)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewCoordinator, offsetof(OPLinkSettingsData, Coordinator), sizeof(uint8_t));
+}
+void OPLinkSettingsCoordinatorGet(uint8_t *NewCoordinator)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewCoordinator, offsetof(OPLinkSettingsData, Coordinator), sizeof(uint8_t));
+}
+void OPLinkSettingsOneWaySet(uint8_t *NewOneWay)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewOneWay, offsetof(OPLinkSettingsData, OneWay), sizeof(uint8_t));
+}
+void OPLinkSettingsOneWayGet(uint8_t *NewOneWay)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewOneWay, offsetof(OPLinkSettingsData, OneWay), sizeof(uint8_t));
+}
+void OPLinkSettingsPPMSet(uint8_t *NewPPM)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewPPM, offsetof(OPLinkSettingsData, PPM), sizeof(uint8_t));
+}
+void OPLinkSettingsPPMGet(uint8_t *NewPPM)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewPPM, offsetof(OPLinkSettingsData, PPM), sizeof(uint8_t));
+}
+void OPLinkSettingsPPMOnlySet(uint8_t *NewPPMOnly)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewPPMOnly, offsetof(OPLinkSettingsData, PPMOnly), sizeof(uint8_t));
+}
+void OPLinkSettingsPPMOnlyGet(uint8_t *NewPPMOnly)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewPPMOnly, offsetof(OPLinkSettingsData, PPMOnly), sizeof(uint8_t));
+}
+void OPLinkSettingsMainPortSet(uint8_t *NewMainPort)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewMainPort, offsetof(OPLinkSettingsData, MainPort), sizeof(uint8_t));
+}
+void OPLinkSettingsMainPortGet(uint8_t *NewMainPort)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewMainPort, offsetof(OPLinkSettingsData, MainPort), sizeof(uint8_t));
+}
+void OPLinkSettingsFlexiPortSet(uint8_t *NewFlexiPort)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewFlexiPort, offsetof(OPLinkSettingsData, FlexiPort), sizeof(uint8_t));
+}
+void OPLinkSettingsFlexiPortGet(uint8_t *NewFlexiPort)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewFlexiPort, offsetof(OPLinkSettingsData, FlexiPort), sizeof(uint8_t));
+}
+void OPLinkSettingsVCPPortSet(uint8_t *NewVCPPort)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewVCPPort, offsetof(OPLinkSettingsData, VCPPort), sizeof(uint8_t));
+}
+void OPLinkSettingsVCPPortGet(uint8_t *NewVCPPort)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewVCPPort, offsetof(OPLinkSettingsData, VCPPort), sizeof(uint8_t));
+}
+void OPLinkSettingsComSpeedSet(uint8_t *NewComSpeed)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewComSpeed, offsetof(OPLinkSettingsData, ComSpeed), sizeof(uint8_t));
+}
+void OPLinkSettingsComSpeedGet(uint8_t *NewComSpeed)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewComSpeed, offsetof(OPLinkSettingsData, ComSpeed), sizeof(uint8_t));
+}
+void OPLinkSettingsMaxRFPowerSet(uint8_t *NewMaxRFPower)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewMaxRFPower, offsetof(OPLinkSettingsData, MaxRFPower), sizeof(uint8_t));
+}
+void OPLinkSettingsMaxRFPowerGet(uint8_t *NewMaxRFPower)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewMaxRFPower, offsetof(OPLinkSettingsData, MaxRFPower), sizeof(uint8_t));
+}
+void OPLinkSettingsMinChannelSet(uint8_t *NewMinChannel)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewMinChannel, offsetof(OPLinkSettingsData, MinChannel), sizeof(uint8_t));
+}
+void OPLinkSettingsMinChannelGet(uint8_t *NewMinChannel)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewMinChannel, offsetof(OPLinkSettingsData, MinChannel), sizeof(uint8_t));
+}
+void OPLinkSettingsMaxChannelSet(uint8_t *NewMaxChannel)
+{
+    UAVObjSetDataField(OPLinkSettingsHandle(), (void *)NewMaxChannel, offsetof(OPLinkSettingsData, MaxChannel), sizeof(uint8_t));
+}
+void OPLinkSettingsMaxChannelGet(uint8_t *NewMaxChannel)
+{
+    UAVObjGetDataField(OPLinkSettingsHandle(), (void *)NewMaxChannel, offsetof(OPLinkSettingsData, MaxChannel), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup PositionState PositionState
+ * @brief Contains the estimate of the current position relative to @ref HomeLocation, in NED coordinates
+ *
+ * Autogenerated files and functions for PositionState Object
+ * @{ 
+ *
+ * @file       positionstate.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the PositionState object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: positionstate.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "positionstate.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PositionStateInitialize(void)
+{
+    // Compile time assertion that the PositionStateDataPacked and PositionStateData structs
+    // have the same size (though instances of PositionStateData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(PositionStateDataPacked) == sizeof(PositionStateData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(POSITIONSTATE_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(POSITIONSTATE_OBJID,
+        POSITIONSTATE_ISSINGLEINST, POSITIONSTATE_ISSETTINGS, POSITIONSTATE_ISPRIORITY, POSITIONSTATE_NUMBYTES, &PositionStateSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PositionStateSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    PositionStateData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(PositionStateData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PositionStateHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void PositionStateNorthSet(float *NewNorth)
+{
+    UAVObjSetDataField(PositionStateHandle(), (void *)NewNorth, offsetof(PositionStateData, North), sizeof(float));
+}
+void PositionStateNorthGet(float *NewNorth)
+{
+    UAVObjGetDataField(PositionStateHandle(), (void *)NewNorth, offsetof(PositionStateData, North), sizeof(float));
+}
+void PositionStateEastSet(float *NewEast)
+{
+    UAVObjSetDataField(PositionStateHandle(), (void *)NewEast, offsetof(PositionStateData, East), sizeof(float));
+}
+void PositionStateEastGet(float *NewEast)
+{
+    UAVObjGetDataField(PositionStateHandle(), (void *)NewEast, offsetof(PositionStateData, East), sizeof(float));
+}
+void PositionStateDownSet(float *NewDown)
+{
+    UAVObjSetDataField(PositionStateHandle(), (void *)NewDown, offsetof(PositionStateData, Down), sizeof(float));
+}
+void PositionStateDownGet(float *NewDown)
+{
+    UAVObjGetDataField(PositionStateHandle(), (void *)NewDown, offsetof(PositionStateData, Down), sizeof(float));
+}
+
+
+/**
+ * @}
+ */
@@ -0,0 +1,198 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup SystemSettings SystemSettings
+ * @brief Select airframe type.  Currently used by @ref ActuatorModule to choose mixing from @ref ActuatorDesired to @ref ActuatorCommand
+ *
+ * Autogenerated files and functions for SystemSettings Object
+ * @{ 
+ *
+ * @file       systemsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the SystemSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: systemsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "systemsettings.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SystemSettingsInitialize(void)
+{
+    // Compile time assertion that the SystemSettingsDataPacked and SystemSettingsData structs
+    // have the same size (though instances of SystemSettingsData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(SystemSettingsDataPacked) == sizeof(SystemSettingsData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(SYSTEMSETTINGS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(SYSTEMSETTINGS_OBJID,
+        SYSTEMSETTINGS_ISSINGLEINST, SYSTEMSETTINGS_ISSETTINGS, SYSTEMSETTINGS_ISPRIORITY, SYSTEMSETTINGS_NUMBYTES, &SystemSettingsSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SystemSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    SystemSettingsData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(SystemSettingsData));
+    data.GUIConfigData[0] = 0;
+    data.GUIConfigData[1] = 0;
+    data.GUIConfigData[2] = 0;
+    data.GUIConfigData[3] = 0;
+    data.AirSpeedMax = 3.000000e+01f;
+    data.AirSpeedMin = 1.000000e+01f;
+    data.AirframeType = 5;
+    data.VehicleName[0] = 0;
+    data.VehicleName[1] = 0;
+    data.VehicleName[2] = 0;
+    data.VehicleName[3] = 0;
+    data.VehicleName[4] = 0;
+    data.VehicleName[5] = 0;
+    data.VehicleName[6] = 0;
+    data.VehicleName[7] = 0;
+    data.VehicleName[8] = 0;
+    data.VehicleName[9] = 0;
+    data.VehicleName[10] = 0;
+    data.VehicleName[11] = 0;
+    data.VehicleName[12] = 0;
+    data.VehicleName[13] = 0;
+    data.VehicleName[14] = 0;
+    data.VehicleName[15] = 0;
+    data.VehicleName[16] = 0;
+    data.VehicleName[17] = 0;
+    data.VehicleName[18] = 0;
+    data.VehicleName[19] = 0;
+    data.ThrustControl = 0;
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 0;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SystemSettingsHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SystemSettingsGUIConfigDataSet( uint32_t *NewGUIConfigData )
+{
+    UAVObjSetDataField(SystemSettingsHandle(), (void *)NewGUIConfigData, offsetof(SystemSettingsData, GUIConfigData), 4*sizeof(uint32_t));
+}
+void SystemSettingsGUIConfigDataGet( uint32_t *NewGUIConfigData )
+{
+    UAVObjGetDataField(SystemSettingsHandle(), (void *)NewGUIConfigData, offsetof(SystemSettingsData, GUIConfigData), 4*sizeof(uint32_t));
+}
+void SystemSettingsAirSpeedMaxSet(float *NewAirSpeedMax)
+{
+    UAVObjSetDataField(SystemSettingsHandle(), (void *)NewAirSpeedMax, offsetof(SystemSettingsData, AirSpeedMax), sizeof(float));
+}
+void SystemSettingsAirSpeedMaxGet(float *NewAirSpeedMax)
+{
+    UAVObjGetDataField(SystemSettingsHandle(), (void *)NewAirSpeedMax, offsetof(SystemSettingsData, AirSpeedMax), sizeof(float));
+}
+void SystemSettingsAirSpeedMinSet(float *NewAirSpeedMin)
+{
+    UAVObjSetDataField(SystemSettingsHandle(), (void *)NewAirSpeedMin, offsetof(SystemSettingsData, AirSpeedMin), sizeof(float));
+}
+void SystemSettingsAirSpeedMinGet(float *NewAirSpeedMin)
+{
+    UAVObjGetDataField(SystemSettingsHandle(), (void *)NewAirSpeedMin, offsetof(SystemSettingsData, AirSpeedMin), sizeof(float));
+}
+void SystemSettingsAirframeTypeSet(uint8_t *NewAirframeType)
+{
+    UAVObjSetDataField(SystemSettingsHandle(), (void *)NewAirframeType, offsetof(SystemSettingsData, AirframeType), sizeof(uint8_t));
+}
+void SystemSettingsAirframeTypeGet(uint8_t *NewAirframeType)
+{
+    UAVObjGetDataField(SystemSettingsHandle(), (void *)NewAirframeType, offsetof(SystemSettingsData, AirframeType), sizeof(uint8_t));
+}
+void SystemSettingsVehicleNameSet( uint8_t *NewVehicleName )
+{
+    UAVObjSetDataField(SystemSettingsHandle(), (void *)NewVehicleName, offsetof(SystemSettingsData, VehicleName), 20*sizeof(uint8_t));
+}
+void SystemSettingsVehicleNameGet( uint8_t *NewVehicleName )
+{
+    UAVObjGetDataField(SystemSettingsHandle(), (void *)NewVehicleName, offsetof(SystemSettingsData, VehicleName), 20*sizeof(uint8_t));
+}
+void SystemSettingsThrustControlSet(uint8_t *NewThrustControl)
+{
+    UAVObjSetDataField(SystemSettingsHandle(), (void *)NewThrustControl, offsetof(SystemSettingsData, ThrustControl), sizeof(uint8_t));
+}
+void SystemSettingsThrustControlGet(uint8_t *NewThrustControl)
+{
+    UAVObjGetDataField(SystemSettingsHandle(), (void *)NewThrustControl, offsetof(SystemSettingsData, ThrustControl), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ */
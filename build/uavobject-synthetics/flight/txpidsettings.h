@@ -0,0 +1,314 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup TxPIDSettings TxPIDSettings 
+ * @brief Settings used by @ref TxPID optional module to tune PID settings using R/C transmitter
+ *
+ * Autogenerated files and functions for TxPIDSettings Object
+ *
+ * @{ 
+ *
+ * @file       txpidsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the TxPIDSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: txpidsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef TXPIDSETTINGS_H
+#define TXPIDSETTINGS_H
+
+/* Object constants */
+#define TXPIDSETTINGS_OBJID 0x857B51F2
+#define TXPIDSETTINGS_ISSINGLEINST 1
+#define TXPIDSETTINGS_ISSETTINGS 1
+#define TXPIDSETTINGS_ISPRIORITY 0
+#define TXPIDSETTINGS_NUMBYTES sizeof(TxPIDSettingsData)
+
+/* Generic interface functions */
+int32_t TxPIDSettingsInitialize();
+UAVObjHandle TxPIDSettingsHandle();
+void TxPIDSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+typedef struct __attribute__ ((__packed__)) {
+    float Min;
+    float Max;
+}  TxPIDSettingsThrottleRangeData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[2];
+}  TxPIDSettingsThrottleRangeDataArray ;
+#define TxPIDSettingsThrottleRangeToArray( var ) UAVObjectFieldToArray( TxPIDSettingsThrottleRangeData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Instance1;
+    float Instance2;
+    float Instance3;
+}  TxPIDSettingsMinPIDData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  TxPIDSettingsMinPIDDataArray ;
+#define TxPIDSettingsMinPIDToArray( var ) UAVObjectFieldToArray( TxPIDSettingsMinPIDData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    float Instance1;
+    float Instance2;
+    float Instance3;
+}  TxPIDSettingsMaxPIDData ;
+typedef struct __attribute__ ((__packed__)) {
+    float array[3];
+}  TxPIDSettingsMaxPIDDataArray ;
+#define TxPIDSettingsMaxPIDToArray( var ) UAVObjectFieldToArray( TxPIDSettingsMaxPIDData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t Instance1;
+    uint8_t Instance2;
+    uint8_t Instance3;
+}  TxPIDSettingsInputsData ;
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t array[3];
+}  TxPIDSettingsInputsDataArray ;
+#define TxPIDSettingsInputsToArray( var ) UAVObjectFieldToArray( TxPIDSettingsInputsData, var )
+
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t Instance1;
+    uint8_t Instance2;
+    uint8_t Instance3;
+}  TxPIDSettingsPIDsData ;
+typedef struct __attribute__ ((__packed__)) {
+    uint8_t array[3];
+}  TxPIDSettingsPIDsDataArray ;
+#define TxPIDSettingsPIDsToArray( var ) UAVObjectFieldToArray( TxPIDSettingsPIDsData, var )
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+    TxPIDSettingsThrottleRangeData ThrottleRange;
+    TxPIDSettingsMinPIDData MinPID;
+    TxPIDSettingsMaxPIDData MaxPID;
+    uint8_t UpdateMode;
+    uint8_t BankNumber;
+    TxPIDSettingsInputsData Inputs;
+    TxPIDSettingsPIDsData PIDs;
+} __attribute__((packed)) TxPIDSettingsDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef TxPIDSettingsDataPacked __attribute__((aligned(4))) TxPIDSettingsData;
+    
+/* Typesafe Object access functions */
+static inline int32_t TxPIDSettingsGet(TxPIDSettingsData *dataOut) { return UAVObjGetData(TxPIDSettingsHandle(), dataOut); }
+static inline int32_t TxPIDSettingsSet(const TxPIDSettingsData *dataIn) { return UAVObjSetData(TxPIDSettingsHandle(), dataIn); }
+static inline int32_t TxPIDSettingsInstGet(uint16_t instId, TxPIDSettingsData *dataOut) { return UAVObjGetInstanceData(TxPIDSettingsHandle(), instId, dataOut); }
+static inline int32_t TxPIDSettingsInstSet(uint16_t instId, const TxPIDSettingsData *dataIn) { return UAVObjSetInstanceData(TxPIDSettingsHandle(), instId, dataIn); }
+static inline int32_t TxPIDSettingsConnectQueue(xQueueHandle queue) { return UAVObjConnectQueue(TxPIDSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+static inline int32_t TxPIDSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(TxPIDSettingsHandle(), cb, EV_MASK_ALL_UPDATES); }
+static inline uint16_t TxPIDSettingsCreateInstance() { return UAVObjCreateInstance(TxPIDSettingsHandle(), &TxPIDSettingsSetDefaults); }
+static inline void TxPIDSettingsRequestUpdate() { UAVObjRequestUpdate(TxPIDSettingsHandle()); }
+static inline void TxPIDSettingsRequestInstUpdate(uint16_t instId) { UAVObjRequestInstanceUpdate(TxPIDSettingsHandle(), instId); }
+static inline void TxPIDSettingsUpdated() { UAVObjUpdated(TxPIDSettingsHandle()); }
+static inline void TxPIDSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(TxPIDSettingsHandle(), instId); }
+static inline void TxPIDSettingsLogging() { UAVObjLogging(TxPIDSettingsHandle()); }
+static inline void TxPIDSettingsInstLogging(uint16_t instId) { UAVObjInstanceLogging(TxPIDSettingsHandle(), instId); }
+static inline int32_t TxPIDSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(TxPIDSettingsHandle(), dataOut); }
+static inline int32_t TxPIDSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(TxPIDSettingsHandle(), dataIn); }
+static inline int8_t TxPIDSettingsReadOnly() { return UAVObjReadOnly(TxPIDSettingsHandle()); }
+
+/* Field ThrottleRange information */
+
+// Array element names for field ThrottleRange
+typedef enum {
+    TXPIDSETTINGS_THROTTLERANGE_MIN=0,
+    TXPIDSETTINGS_THROTTLERANGE_MAX=1
+} TxPIDSettingsThrottleRangeElem;
+
+// Number of elements for field ThrottleRange
+#define TXPIDSETTINGS_THROTTLERANGE_NUMELEM 2
+
+/* Field MinPID information */
+
+// Array element names for field MinPID
+typedef enum {
+    TXPIDSETTINGS_MINPID_INSTANCE1=0,
+    TXPIDSETTINGS_MINPID_INSTANCE2=1,
+    TXPIDSETTINGS_MINPID_INSTANCE3=2
+} TxPIDSettingsMinPIDElem;
+
+// Number of elements for field MinPID
+#define TXPIDSETTINGS_MINPID_NUMELEM 3
+
+/* Field MaxPID information */
+
+// Array element names for field MaxPID
+typedef enum {
+    TXPIDSETTINGS_MAXPID_INSTANCE1=0,
+    TXPIDSETTINGS_MAXPID_INSTANCE2=1,
+    TXPIDSETTINGS_MAXPID_INSTANCE3=2
+} TxPIDSettingsMaxPIDElem;
+
+// Number of elements for field MaxPID
+#define TXPIDSETTINGS_MAXPID_NUMELEM 3
+
+/* Field UpdateMode information */
+
+// Enumeration options for field UpdateMode
+typedef enum {
+    TXPIDSETTINGS_UPDATEMODE_NEVER=0,
+    TXPIDSETTINGS_UPDATEMODE_WHENARMED=1,
+    TXPIDSETTINGS_UPDATEMODE_ALWAYS=2
+} TxPIDSettingsUpdateModeOptions;
+
+/* Field BankNumber information */
+
+// Enumeration options for field BankNumber
+typedef enum {
+    TXPIDSETTINGS_BANKNUMBER_BANK1=0,
+    TXPIDSETTINGS_BANKNUMBER_BANK2=1,
+    TXPIDSETTINGS_BANKNUMBER_BANK3=2
+} TxPIDSettingsBankNumberOptions;
+
+/* Field Inputs information */
+
+// Enumeration options for field Inputs
+typedef enum {
+    TXPIDSETTINGS_INPUTS_THROTTLE=0,
+    TXPIDSETTINGS_INPUTS_ACCESSORY0=1,
+    TXPIDSETTINGS_INPUTS_ACCESSORY1=2,
+    TXPIDSETTINGS_INPUTS_ACCESSORY2=3,
+    TXPIDSETTINGS_INPUTS_ACCESSORY3=4,
+    TXPIDSETTINGS_INPUTS_ACCESSORY4=5,
+    TXPIDSETTINGS_INPUTS_ACCESSORY5=6
+} TxPIDSettingsInputsOptions;
+
+// Array element names for field Inputs
+typedef enum {
+    TXPIDSETTINGS_INPUTS_INSTANCE1=0,
+    TXPIDSETTINGS_INPUTS_INSTANCE2=1,
+    TXPIDSETTINGS_INPUTS_INSTANCE3=2
+} TxPIDSettingsInputsElem;
+
+// Number of elements for field Inputs
+#define TXPIDSETTINGS_INPUTS_NUMELEM 3
+
+/* Field PIDs information */
+
+// Enumeration options for field PIDs
+typedef enum {
+    TXPIDSETTINGS_PIDS_DISABLED=0,
+    TXPIDSETTINGS_PIDS_ROLLRATEKP=1,
+    TXPIDSETTINGS_PIDS_ROLLRATEKI=2,
+    TXPIDSETTINGS_PIDS_ROLLRATEKD=3,
+    TXPIDSETTINGS_PIDS_ROLLRATEILIMIT=4,
+    TXPIDSETTINGS_PIDS_ROLLRATERESP=5,
+    TXPIDSETTINGS_PIDS_PITCHRATEKP=6,
+    TXPIDSETTINGS_PIDS_PITCHRATEKI=7,
+    TXPIDSETTINGS_PIDS_PITCHRATEKD=8,
+    TXPIDSETTINGS_PIDS_PITCHRATEILIMIT=9,
+    TXPIDSETTINGS_PIDS_PITCHRATERESP=10,
+    TXPIDSETTINGS_PIDS_ROLLPITCHRATEKP=11,
+    TXPIDSETTINGS_PIDS_ROLLPITCHRATEKI=12,
+    TXPIDSETTINGS_PIDS_ROLLPITCHRATEKD=13,
+    TXPIDSETTINGS_PIDS_ROLLPITCHRATEILIMIT=14,
+    TXPIDSETTINGS_PIDS_ROLLPITCHRATERESP=15,
+    TXPIDSETTINGS_PIDS_YAWRATEKP=16,
+    TXPIDSETTINGS_PIDS_YAWRATEKI=17,
+    TXPIDSETTINGS_PIDS_YAWRATEKD=18,
+    TXPIDSETTINGS_PIDS_YAWRATEILIMIT=19,
+    TXPIDSETTINGS_PIDS_YAWRATERESP=20,
+    TXPIDSETTINGS_PIDS_ROLLATTITUDEKP=21,
+    TXPIDSETTINGS_PIDS_ROLLATTITUDEKI=22,
+    TXPIDSETTINGS_PIDS_ROLLATTITUDEILIMIT=23,
+    TXPIDSETTINGS_PIDS_ROLLATTITUDERESP=24,
+    TXPIDSETTINGS_PIDS_PITCHATTITUDEKP=25,
+    TXPIDSETTINGS_PIDS_PITCHATTITUDEKI=26,
+    TXPIDSETTINGS_PIDS_PITCHATTITUDEILIMIT=27,
+    TXPIDSETTINGS_PIDS_PITCHATTITUDERESP=28,
+    TXPIDSETTINGS_PIDS_ROLLPITCHATTITUDEKP=29,
+    TXPIDSETTINGS_PIDS_ROLLPITCHATTITUDEKI=30,
+    TXPIDSETTINGS_PIDS_ROLLPITCHATTITUDEILIMIT=31,
+    TXPIDSETTINGS_PIDS_ROLLPITCHATTITUDERESP=32,
+    TXPIDSETTINGS_PIDS_YAWATTITUDEKP=33,
+    TXPIDSETTINGS_PIDS_YAWATTITUDEKI=34,
+    TXPIDSETTINGS_PIDS_YAWATTITUDEILIMIT=35,
+    TXPIDSETTINGS_PIDS_YAWATTITUDERESP=36,
+    TXPIDSETTINGS_PIDS_ROLLEXPO=37,
+    TXPIDSETTINGS_PIDS_PITCHEXPO=38,
+    TXPIDSETTINGS_PIDS_ROLLPITCHEXPO=39,
+    TXPIDSETTINGS_PIDS_YAWEXPO=40,
+    TXPIDSETTINGS_PIDS_GYROTAU=41,
+    TXPIDSETTINGS_PIDS_ACROPLUSFACTOR=42
+} TxPIDSettingsPIDsOptions;
+
+// Array element names for field PIDs
+typedef enum {
+    TXPIDSETTINGS_PIDS_INSTANCE1=0,
+    TXPIDSETTINGS_PIDS_INSTANCE2=1,
+    TXPIDSETTINGS_PIDS_INSTANCE3=2
+} TxPIDSettingsPIDsElem;
+
+// Number of elements for field PIDs
+#define TXPIDSETTINGS_PIDS_NUMELEM 3
+
+
+
+/* Set/Get functions */
+extern void TxPIDSettingsThrottleRangeSet(TxPIDSettingsThrottleRangeData *NewThrottleRange);
+extern void TxPIDSettingsThrottleRangeGet(TxPIDSettingsThrottleRangeData *NewThrottleRange);
+extern void TxPIDSettingsThrottleRangeArraySet(float *NewThrottleRange);
+extern void TxPIDSettingsThrottleRangeArrayGet(float *NewThrottleRange);
+extern void TxPIDSettingsMinPIDSet(TxPIDSettingsMinPIDData *NewMinPID);
+extern void TxPIDSettingsMinPIDGet(TxPIDSettingsMinPIDData *NewMinPID);
+extern void TxPIDSettingsMinPIDArraySet(float *NewMinPID);
+extern void TxPIDSettingsMinPIDArrayGet(float *NewMinPID);
+extern void TxPIDSettingsMaxPIDSet(TxPIDSettingsMaxPIDData *NewMaxPID);
+extern void TxPIDSettingsMaxPIDGet(TxPIDSettingsMaxPIDData *NewMaxPID);
+extern void TxPIDSettingsMaxPIDArraySet(float *NewMaxPID);
+extern void TxPIDSettingsMaxPIDArrayGet(float *NewMaxPID);
+extern void TxPIDSettingsUpdateModeSet(uint8_t *NewUpdateMode);
+extern void TxPIDSettingsUpdateModeGet(uint8_t *NewUpdateMode);
+extern void TxPIDSettingsBankNumberSet(uint8_t *NewBankNumber);
+extern void TxPIDSettingsBankNumberGet(uint8_t *NewBankNumber);
+extern void TxPIDSettingsInputsSet(TxPIDSettingsInputsData *NewInputs);
+extern void TxPIDSettingsInputsGet(TxPIDSettingsInputsData *NewInputs);
+extern void TxPIDSettingsInputsArraySet(uint8_t *NewInputs);
+extern void TxPIDSettingsInputsArrayGet(uint8_t *NewInputs);
+extern void TxPIDSettingsPIDsSet(TxPIDSettingsPIDsData *NewPIDs);
+extern void TxPIDSettingsPIDsGet(TxPIDSettingsPIDsData *NewPIDs);
+extern void TxPIDSettingsPIDsArraySet(uint8_t *NewPIDs);
+extern void TxPIDSettingsPIDsArrayGet(uint8_t *NewPIDs);
+
+
+#endif // TXPIDSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup VelocityDesired VelocityDesired
+ * @brief Used within @ref GuidanceModule to communicate between the task computing the desired velocity and the PID loop to achieve it (running at different rates).
+ *
+ * Autogenerated files and functions for VelocityDesired Object
+ * @{ 
+ *
+ * @file       velocitydesired.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the VelocityDesired object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: velocitydesired.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "velocitydesired.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t VelocityDesiredInitialize(void)
+{
+    // Compile time assertion that the VelocityDesiredDataPacked and VelocityDesiredData structs
+    // have the same size (though instances of VelocityDesiredData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(VelocityDesiredDataPacked) == sizeof(VelocityDesiredData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(VELOCITYDESIRED_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(VELOCITYDESIRED_OBJID,
+        VELOCITYDESIRED_ISSINGLEINST, VELOCITYDESIRED_ISSETTINGS, VELOCITYDESIRED_ISPRIORITY, VELOCITYDESIRED_NUMBYTES, &VelocityDesiredSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void VelocityDesiredSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    VelocityDesiredData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(VelocityDesiredData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 1000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle VelocityDesiredHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void VelocityDesiredNorthSet(float *NewNorth)
+{
+    UAVObjSetDataField(VelocityDesiredHandle(), (void *)NewNorth, offsetof(VelocityDesiredData, North), sizeof(float));
+}
+void VelocityDesiredNorthGet(float *NewNorth)
+{
+    UAVObjGetDataField(VelocityDesiredHandle(), (void *)NewNorth, offsetof(VelocityDesiredData, North), sizeof(float));
+}
+void VelocityDesiredEastSet(float *NewEast)
+{
+    UAVObjSetDataField(VelocityDesiredHandle(), (void *)NewEast, offsetof(VelocityDesiredData, East), sizeof(float));
+}
+void VelocityDesiredEastGet(float *NewEast)
+{
+    UAVObjGetDataField(VelocityDesiredHandle(), (void *)NewEast, offsetof(VelocityDesiredData, East), sizeof(float));
+}
+void VelocityDesiredDownSet(float *NewDown)
+{
+    UAVObjSetDataField(VelocityDesiredHandle(), (void *)NewDown, offsetof(VelocityDesiredData, Down), sizeof(float));
+}
+void VelocityDesiredDownGet(float *NewDown)
+{
+    UAVObjGetDataField(VelocityDesiredHandle(), (void *)NewDown, offsetof(VelocityDesiredData, Down), sizeof(float));
+}
+
+
+/**
+ * @}
+ */
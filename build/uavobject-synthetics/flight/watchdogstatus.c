@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup WatchdogStatus WatchdogStatus
+ * @brief For monitoring the flags in the watchdog and especially the bootup flags
+ *
+ * Autogenerated files and functions for WatchdogStatus Object
+ * @{ 
+ *
+ * @file       watchdogstatus.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the WatchdogStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: watchdogstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <openpilot.h>
+#include "watchdogstatus.h"
+
+// Private variables
+#if (defined(__MACH__) && defined(__APPLE__))
+static UAVObjHandle handle __attribute__((section("__DATA,_uavo_handles")));
+#else
+static UAVObjHandle handle __attribute__((section("_uavo_handles")));
+#endif
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t WatchdogStatusInitialize(void)
+{
+    // Compile time assertion that the WatchdogStatusDataPacked and WatchdogStatusData structs
+    // have the same size (though instances of WatchdogStatusData
+    // should be placed in memory by the linker/compiler on a 4 byte alignment).
+    PIOS_STATIC_ASSERT(sizeof(WatchdogStatusDataPacked) == sizeof(WatchdogStatusData));
+    
+    // Don't set the handle to null if already registered
+    if (UAVObjGetByID(WATCHDOGSTATUS_OBJID)) {
+        return -2;
+    }
+
+    // Register object with the object manager
+    handle = UAVObjRegister(WATCHDOGSTATUS_OBJID,
+        WATCHDOGSTATUS_ISSINGLEINST, WATCHDOGSTATUS_ISSETTINGS, WATCHDOGSTATUS_ISPRIORITY, WATCHDOGSTATUS_NUMBYTES, &WatchdogStatusSetDefaults);
+
+    // Done
+    return handle ? 0 : -1;
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void WatchdogStatusSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+    WatchdogStatusData data;
+
+    // Initialize object fields to their default values
+    UAVObjGetInstanceData(obj, instId, &data);
+    memset(&data, 0, sizeof(WatchdogStatusData));
+
+    UAVObjSetInstanceData(obj, instId, &data);
+
+    // Initialize object metadata to their default values
+    if ( instId == 0 ) {
+        UAVObjMetadata metadata;
+        metadata.flags =
+            ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+            ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+            0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+            0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+            UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT |
+            UPDATEMODE_MANUAL << UAVOBJ_LOGGING_UPDATE_MODE_SHIFT;
+        metadata.telemetryUpdatePeriod = 5000;
+        metadata.gcsTelemetryUpdatePeriod = 0;
+        metadata.loggingUpdatePeriod = 0;
+        UAVObjSetMetadata(obj, &metadata);
+    }
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle WatchdogStatusHandle()
+{
+    return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void WatchdogStatusBootupFlagsSet(uint16_t *NewBootupFlags)
+{
+    UAVObjSetDataField(WatchdogStatusHandle(), (void *)NewBootupFlags, offsetof(WatchdogStatusData, BootupFlags), sizeof(uint16_t));
+}
+void WatchdogStatusBootupFlagsGet(uint16_t *NewBootupFlags)
+{
+    UAVObjGetDataField(WatchdogStatusHandle(), (void *)NewBootupFlags, offsetof(WatchdogStatusData, BootupFlags), sizeof(uint16_t));
+}
+void WatchdogStatusActiveFlagsSet(uint16_t *NewActiveFlags)
+{
+    UAVObjSetDataField(WatchdogStatusHandle(), (void *)NewActiveFlags, offsetof(WatchdogStatusData, ActiveFlags), sizeof(uint16_t));
+}
+void WatchdogStatusActiveFlagsGet(uint16_t *NewActiveFlags)
+{
+    UAVObjGetDataField(WatchdogStatusHandle(), (void *)NewActiveFlags, offsetof(WatchdogStatusData, ActiveFlags), sizeof(uint16_t));
+}
+
+
+/**
+ * @}
+ */
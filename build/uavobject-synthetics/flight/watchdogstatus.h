@@ -0,0 +1,109 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects OpenPilot UAVObjects
+ * @{ 
+ * @addtogroup WatchdogStatus WatchdogStatus 
+ * @brief For monitoring the flags in the watchdog and especially the bootup flags
+ *
+ * Autogenerated files and functions for WatchdogStatus Object
+ *
+ * @{ 
+ *
+ * @file       watchdogstatus.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010-2013.
+ * @brief      Implementation of the WatchdogStatus object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: watchdogstatus.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef WATCHDOGSTATUS_H
+#define WATCHDOGSTATUS_H
+
+/* Object constants */
+#define WATCHDOGSTATUS_OBJID 0xA207FA7C
+#define WATCHDOGSTATUS_ISSINGLEINST 1
+#define WATCHDOGSTATUS_ISSETTINGS 0
+#define WATCHDOGSTATUS_ISPRIORITY 0
+#define WATCHDOGSTATUS_NUMBYTES sizeof(WatchdogStatusData)
+
+/* Generic interface functions */
+int32_t WatchdogStatusInitialize();
+UAVObjHandle WatchdogStatusHandle();
+void WatchdogStatusSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+
+/*
+ * Packed Object data (unaligned).
+ * Should only be used where 4 byte alignment can be guaranteed
+ * (eg a single instance on the heap)
+ */
+typedef struct {
+    uint16_t BootupFlags;
+    uint16_t ActiveFlags;
+} __attribute__((packed)) WatchdogStatusDataPacked;
+
+/*
+ * Packed Object data.
+ * Alignment is forced to 4 bytes so as to avoid the potential for CPU usage faults
+ * on Cortex M4F during load/store of float UAVO fields
+ */
+typedef WatchdogStatusDataPacked __attribute__((aligned(4))) WatchdogStatusData;
+    
+/* Typesafe Object access functions */
+static inline int32_t WatchdogStatusGet(WatchdogStatusData *dataOut) { return UAVObjGetData(WatchdogStatusHandle(), dataOut); }
+static inline int32_t WatchdogStatusSet(const WatchdogStatusData *dataIn) { return UAVObjSetData(WatchdogStatusHandle(), dataIn); }
+static inline int32_t WatchdogStatusInstGet(uint16_t instId, WatchdogStatusData *dataOut) { return UAVObjGetInstanceData(WatchdogStatusHandle(), instId, dataOut); }
+static inline int32_t WatchdogStatusInstSet(uint16_t instId, const WatchdogStatusData *dataIn) { return UAVObjSetInstanceData(WatchdogStatusHandle(), instId, dataIn); }
+static inline int32_t WatchdogStatusConnectQueue(xQueueHandle queue) { return UAVObjConnectQueue(WatchdogStatusHandle(), queue, EV_MASK_ALL_UPDATES); }
+static inline int32_t WatchdogStatusConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(WatchdogStatusHandle(), cb, EV_MASK_ALL_UPDATES); }
+static inline uint16_t WatchdogStatusCreateInstance() { return UAVObjCreateInstance(WatchdogStatusHandle(), &WatchdogStatusSetDefaults); }
+static inline void WatchdogStatusRequestUpdate() { UAVObjRequestUpdate(WatchdogStatusHandle()); }
+static inline void WatchdogStatusRequestInstUpdate(uint16_t instId) { UAVObjRequestInstanceUpdate(WatchdogStatusHandle(), instId); }
+static inline void WatchdogStatusUpdated() { UAVObjUpdated(WatchdogStatusHandle()); }
+static inline void WatchdogStatusInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(WatchdogStatusHandle(), instId); }
+static inline void WatchdogStatusLogging() { UAVObjLogging(WatchdogStatusHandle()); }
+static inline void WatchdogStatusInstLogging(uint16_t instId) { UAVObjInstanceLogging(WatchdogStatusHandle(), instId); }
+static inline int32_t WatchdogStatusGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(WatchdogStatusHandle(), dataOut); }
+static inline int32_t WatchdogStatusSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(WatchdogStatusHandle(), dataIn); }
+static inline int8_t WatchdogStatusReadOnly() { return UAVObjReadOnly(WatchdogStatusHandle()); }
+
+/* Field BootupFlags information */
+
+/* Field ActiveFlags information */
+
+
+
+/* Set/Get functions */
+extern void WatchdogStatusBootupFlagsSet(uint16_t *NewBootupFlags);
+extern void WatchdogStatusBootupFlagsGet(uint16_t *NewBootupFlags);
+extern void WatchdogStatusActiveFlagsSet(uint16_t *NewActiveFlags);
+extern void WatchdogStatusActiveFlagsGet(uint16_t *NewActiveFlags);
+
+
+#endif // WATCHDOGSTATUS_H
+
+/**
+ * @}
+ * @}
+ */
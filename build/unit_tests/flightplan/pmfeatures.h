@@ -0,0 +1,13 @@
+/* Automatically generated by /root/repo/flight/libraries/PyMite/tools/pmGenPmFeatures.py on Mon Oct 19 03:36:23 2026.  DO NOT EDIT. */
+#define HAVE_PRINT
+#define HAVE_CLASSES
+#define HAVE_REPLICATION
+#define HAVE_DEFAULTARGS
+#define HAVE_DEL
+#define HAVE_FLOAT
+#define HAVE_GC
+#define HAVE_GC_INCREMENTAL
+#define HAVE_ASSERT
+#define HAVE_GENERATORS
+#define HAVE_IMPORTS
+#define HAVE_DEBUG_INFO
@@ -0,0 +1,999 @@
+/**
+ * PyMite library image file.
+ *
+ * Automatically created from:
+ * 	/root/repo/flight/libraries/PyMite/lib/list.py
+ *	/root/repo/flight/libraries/PyMite/lib/dict.py
+ *	/root/repo/flight/libraries/PyMite/lib/__bi.py
+ *	/root/repo/flight/libraries/PyMite/lib/sys.py
+ *	/root/repo/flight/libraries/PyMite/lib/string.py
+ *	/root/repo/flight/modules/FlightPlan/lib/openpilot.py
+ *	/root/repo/flight/modules/FlightPlan/lib/uavobject.py
+ *	/root/repo/flight/tests/flightplan/testobject_native.py
+ *	img-list-terminator
+ * by pmImgCreator.py on
+ * Mon Oct 19 04:27:02 2026.
+ * 
+ * Byte count: 7523
+ * 
+ * Selected memspace type: FLASH
+ * 
+ * DO NOT EDIT THIS FILE.
+ * ANY CHANGES WILL BE LOST.
+ */
+
+/* Place the image into FLASH */
+#ifdef __cplusplus
+extern
+#endif
+unsigned char const
+#if defined(__AVR__)
+__attribute__((progmem))
+#endif
+stdlib_img[] =
+{
+
+
+/* /root/repo/flight/libraries/PyMite/lib/list.py */
+    0x0A, 0xF5, 0x01, 0x00, 0x40, 0x01, 0x00, 0x17, 
+    0x00, 0x04, 0x08, 0x03, 0x06, 0x00, 0x61, 0x70, 
+    0x70, 0x65, 0x6E, 0x64, 0x03, 0x05, 0x00, 0x63, 
+    0x6F, 0x75, 0x6E, 0x74, 0x03, 0x06, 0x00, 0x65, 
+    0x78, 0x74, 0x65, 0x6E, 0x64, 0x03, 0x05, 0x00, 
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x03, 0x06, 0x00, 
+    0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x03, 0x03, 
+    0x00, 0x70, 0x6F, 0x70, 0x03, 0x06, 0x00, 0x72, 
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x03, 0x04, 0x00, 
+    0x6C, 0x69, 0x73, 0x74, 0x03, 0x0C, 0x00, 0x09, 
+    0x17, 0x09, 0x08, 0x09, 0x05, 0x09, 0x22, 0x09, 
+    0x27, 0x09, 0x37, 0x03, 0x2F, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 
+    0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 0x65, 
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6C, 0x69, 0x73, 
+    0x74, 0x2E, 0x70, 0x79, 0x00, 0x04, 0x08, 0x0B, 
+    0x02, 0x00, 0x00, 0x0A, 0x93, 0x00, 0x02, 0x43, 
+    0x03, 0x04, 0x2E, 0x00, 0x04, 0x01, 0x03, 0x05, 
+    0x00, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x03, 0x0A, 
+    0x00, 0x00, 0x01, 0x06, 0x01, 0x0D, 0x01, 0x0C, 
+    0x01, 0x11, 0x01, 0x03, 0x2F, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 
+    0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 0x65, 
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6C, 0x69, 0x73, 
+    0x74, 0x2E, 0x70, 0x79, 0x00, 0x04, 0x03, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 
+    0x00, 0x00, 0x64, 0x01, 0x00, 0x7D, 0x02, 0x00, 
+    0x78, 0x27, 0x00, 0x7C, 0x00, 0x00, 0x44, 0x5D, 
+    0x1F, 0x00, 0x7D, 0x03, 0x00, 0x7C, 0x03, 0x00, 
+    0x7C, 0x01, 0x00, 0x6A, 0x02, 0x00, 0x72, 0x0D, 
+    0x00, 0x7C, 0x02, 0x00, 0x64, 0x02, 0x00, 0x17, 
+    0x7D, 0x02, 0x00, 0x71, 0x0D, 0x00, 0x71, 0x0D, 
+    0x00, 0x57, 0x7C, 0x02, 0x00, 0x53, 0x0A, 0x7B, 
+    0x00, 0x02, 0x43, 0x04, 0x03, 0x36, 0x00, 0x04, 
+    0x02, 0x03, 0x06, 0x00, 0x61, 0x70, 0x70, 0x65, 
+    0x6E, 0x64, 0x03, 0x06, 0x00, 0x65, 0x78, 0x74, 
+    0x65, 0x6E, 0x64, 0x03, 0x04, 0x00, 0x00, 0x01, 
+    0x0D, 0x01, 0x03, 0x2F, 0x00, 0x2F, 0x72, 0x6F, 
+    0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 
+    0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x6C, 
+    0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 
+    0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 0x65, 0x2F, 
+    0x6C, 0x69, 0x62, 0x2F, 0x6C, 0x69, 0x73, 0x74, 
+    0x2E, 0x70, 0x79, 0x00, 0x04, 0x01, 0x00, 0x78, 
+    0x1B, 0x00, 0x7C, 0x01, 0x00, 0x44, 0x5D, 0x13, 
+    0x00, 0x7D, 0x02, 0x00, 0x74, 0x00, 0x00, 0x7C, 
+    0x00, 0x00, 0x7C, 0x02, 0x00, 0x83, 0x02, 0x00, 
+    0x01, 0x71, 0x07, 0x00, 0x57, 0x64, 0x00, 0x00, 
+    0x53, 0x0B, 0x02, 0x01, 0x00, 0x0B, 0x03, 0x02, 
+    0x00, 0x0B, 0x02, 0x03, 0x00, 0x0B, 0x02, 0x04, 
+    0x00, 0x00, 0x64, 0x00, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x00, 0x00, 0x64, 0x01, 0x00, 0x84, 0x00, 
+    0x00, 0x5A, 0x01, 0x00, 0x64, 0x02, 0x00, 0x84, 
+    0x00, 0x00, 0x5A, 0x02, 0x00, 0x64, 0x03, 0x00, 
+    0x84, 0x00, 0x00, 0x5A, 0x03, 0x00, 0x64, 0x04, 
+    0x00, 0x84, 0x00, 0x00, 0x5A, 0x04, 0x00, 0x64, 
+    0x05, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x05, 0x00, 
+    0x64, 0x06, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x06, 
+    0x00, 0x64, 0x07, 0x00, 0x53, 
+
+/* /root/repo/flight/libraries/PyMite/lib/dict.py */
+    0x0A, 0x28, 0x01, 0x00, 0x40, 0x01, 0x00, 0x13, 
+    0x00, 0x04, 0x05, 0x03, 0x05, 0x00, 0x63, 0x6C, 
+    0x65, 0x61, 0x72, 0x03, 0x04, 0x00, 0x6B, 0x65, 
+    0x79, 0x73, 0x03, 0x07, 0x00, 0x68, 0x61, 0x73, 
+    0x5F, 0x6B, 0x65, 0x79, 0x03, 0x06, 0x00, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x73, 0x03, 0x04, 0x00, 
+    0x64, 0x69, 0x63, 0x74, 0x03, 0x06, 0x00, 0x09, 
+    0x18, 0x09, 0x2B, 0x09, 0x07, 0x03, 0x2F, 0x00, 
+    0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 
+    0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x2F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 
+    0x69, 0x65, 0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 
+    0x74, 0x65, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x64, 
+    0x69, 0x63, 0x74, 0x2E, 0x70, 0x79, 0x00, 0x04, 
+    0x05, 0x0B, 0x01, 0x05, 0x00, 0x0B, 0x01, 0x06, 
+    0x00, 0x0A, 0x82, 0x00, 0x02, 0x43, 0x03, 0x02, 
+    0x56, 0x00, 0x04, 0x02, 0x03, 0x04, 0x00, 0x6B, 
+    0x65, 0x79, 0x73, 0x03, 0x07, 0x00, 0x68, 0x61, 
+    0x73, 0x5F, 0x6B, 0x65, 0x79, 0x03, 0x06, 0x00, 
+    0x00, 0x01, 0x12, 0x01, 0x04, 0x02, 0x03, 0x2F, 
+    0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 
+    0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 
+    0x68, 0x74, 0x2F, 0x6C, 0x69, 0x62, 0x72, 0x61, 
+    0x72, 0x69, 0x65, 0x73, 0x2F, 0x50, 0x79, 0x4D, 
+    0x69, 0x74, 0x65, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 
+    0x64, 0x69, 0x63, 0x74, 0x2E, 0x70, 0x79, 0x00, 
+    0x04, 0x03, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x00, 
+    0x74, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x83, 0x01, 
+    0x00, 0x6A, 0x06, 0x00, 0x72, 0x16, 0x00, 0x64, 
+    0x01, 0x00, 0x53, 0x64, 0x02, 0x00, 0x53, 0x64, 
+    0x00, 0x00, 0x53, 0x0B, 0x01, 0x07, 0x00, 0x00, 
+    0x64, 0x00, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x00, 
+    0x00, 0x64, 0x01, 0x00, 0x84, 0x00, 0x00, 0x5A, 
+    0x01, 0x00, 0x64, 0x02, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x02, 0x00, 0x64, 0x03, 0x00, 0x84, 0x00, 
+    0x00, 0x5A, 0x03, 0x00, 0x64, 0x04, 0x00, 0x53, 
+
+/* /root/repo/flight/libraries/PyMite/lib/__bi.py */
+    0x0A, 0xE9, 0x06, 0x00, 0x40, 0x03, 0x00, 0x19, 
+    0x00, 0x04, 0x18, 0x03, 0x03, 0x00, 0x61, 0x62, 
+    0x73, 0x03, 0x03, 0x00, 0x63, 0x68, 0x72, 0x03, 
+    0x03, 0x00, 0x64, 0x69, 0x72, 0x03, 0x04, 0x00, 
+    0x65, 0x76, 0x61, 0x6C, 0x03, 0x06, 0x00, 0x66, 
+    0x69, 0x6C, 0x74, 0x65, 0x72, 0x03, 0x07, 0x00, 
+    0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x73, 0x03, 
+    0x02, 0x00, 0x69, 0x64, 0x03, 0x03, 0x00, 0x6C, 
+    0x65, 0x6E, 0x03, 0x06, 0x00, 0x6C, 0x6F, 0x63, 
+    0x61, 0x6C, 0x73, 0x03, 0x03, 0x00, 0x6D, 0x61, 
+    0x70, 0x03, 0x03, 0x00, 0x6F, 0x72, 0x64, 0x03, 
+    0x03, 0x00, 0x70, 0x6F, 0x77, 0x03, 0x05, 0x00, 
+    0x72, 0x61, 0x6E, 0x67, 0x65, 0x03, 0x03, 0x00, 
+    0x73, 0x75, 0x6D, 0x03, 0x04, 0x00, 0x74, 0x79, 
+    0x70, 0x65, 0x03, 0x02, 0x00, 0x43, 0x6F, 0x03, 
+    0x08, 0x00, 0x5F, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 
+    0x5F, 0x5F, 0x03, 0x06, 0x00, 0x6F, 0x62, 0x6A, 
+    0x65, 0x63, 0x74, 0x03, 0x09, 0x00, 0x45, 0x78, 
+    0x63, 0x65, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x03, 
+    0x0E, 0x00, 0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 
+    0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 
+    0x03, 0x04, 0x00, 0x63, 0x6F, 0x64, 0x65, 0x03, 
+    0x09, 0x00, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 
+    0x74, 0x6F, 0x72, 0x03, 0x06, 0x00, 0x69, 0x73, 
+    0x6D, 0x61, 0x69, 0x6E, 0x03, 0x04, 0x00, 0x5F, 
+    0x5F, 0x62, 0x69, 0x03, 0x2C, 0x00, 0x09, 0x05, 
+    0x09, 0x26, 0x09, 0x5B, 0x09, 0x64, 0x09, 0x04, 
+    0x09, 0x15, 0x09, 0x1B, 0x09, 0x43, 0x09, 0x15, 
+    0x09, 0x0E, 0x09, 0x22, 0x09, 0x04, 0x09, 0x61, 
+    0x09, 0x5A, 0x09, 0x25, 0x09, 0x23, 0x06, 0x06, 
+    0x13, 0x07, 0x16, 0x03, 0x16, 0x02, 0x09, 0x0B, 
+    0x16, 0xA2, 0x03, 0x2F, 0x00, 0x2F, 0x72, 0x6F, 
+    0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 
+    0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x6C, 
+    0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 
+    0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 0x65, 0x2F, 
+    0x6C, 0x69, 0x62, 0x2F, 0x5F, 0x5F, 0x62, 0x69, 
+    0x2E, 0x70, 0x79, 0x00, 0x04, 0x1D, 0x0A, 0x65, 
+    0x00, 0x01, 0x43, 0x03, 0x01, 0x19, 0x00, 0x04, 
+    0x01, 0x03, 0x03, 0x00, 0x61, 0x62, 0x73, 0x03, 
+    0x02, 0x00, 0x00, 0x02, 0x03, 0x2F, 0x00, 0x2F, 
+    0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 
+    0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 
+    0x2F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 
+    0x65, 0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 
+    0x65, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x5F, 0x5F, 
+    0x62, 0x69, 0x2E, 0x70, 0x79, 0x00, 0x04, 0x02, 
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 
+    0x00, 0x7C, 0x00, 0x00, 0x0B, 0x66, 0x02, 0x00, 
+    0x7C, 0x00, 0x00, 0x64, 0x01, 0x00, 0x6A, 0x00, 
+    0x00, 0x19, 0x53, 0x0B, 0x01, 0x08, 0x00, 0x0B, 
+    0x01, 0x09, 0x00, 0x0B, 0x03, 0x0A, 0x00, 0x0A, 
+    0x71, 0x00, 0x02, 0x43, 0x04, 0x03, 0x03, 0x01, 
+    0x04, 0x01, 0x03, 0x06, 0x00, 0x66, 0x69, 0x6C, 
+    0x74, 0x65, 0x72, 0x03, 0x02, 0x00, 0x00, 0x01, 
+    0x03, 0x2F, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 
+    0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 
+    0x69, 0x67, 0x68, 0x74, 0x2F, 0x6C, 0x69, 0x62, 
+    0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x2F, 0x50, 
+    0x79, 0x4D, 0x69, 0x74, 0x65, 0x2F, 0x6C, 0x69, 
+    0x62, 0x2F, 0x5F, 0x5F, 0x62, 0x69, 0x2E, 0x70, 
+    0x79, 0x00, 0x04, 0x01, 0x00, 0x67, 0x00, 0x00, 
+    0x7C, 0x01, 0x00, 0x44, 0x5D, 0x18, 0x00, 0x7D, 
+    0x02, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x02, 0x00, 
+    0x83, 0x01, 0x00, 0x72, 0x07, 0x00, 0x7C, 0x02, 
+    0x00, 0x5E, 0x02, 0x00, 0x71, 0x07, 0x00, 0x53, 
+    0x0B, 0x00, 0x0B, 0x00, 0x0B, 0x01, 0x0C, 0x00, 
+    0x0B, 0x01, 0x0D, 0x00, 0x0B, 0x00, 0x0E, 0x00, 
+    0x0A, 0xB4, 0x00, 0x02, 0x43, 0x04, 0x05, 0x8F, 
+    0x01, 0x04, 0x03, 0x03, 0x04, 0x00, 0x4E, 0x6F, 
+    0x6E, 0x65, 0x03, 0x03, 0x00, 0x6C, 0x65, 0x6E, 
+    0x03, 0x03, 0x00, 0x6D, 0x61, 0x70, 0x03, 0x0C, 
+    0x00, 0x00, 0x02, 0x13, 0x03, 0x06, 0x01, 0x0D, 
+    0x01, 0x10, 0x01, 0x0E, 0x03, 0x03, 0x2F, 0x00, 
+    0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 
+    0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x2F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 
+    0x69, 0x65, 0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 
+    0x74, 0x65, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x5F, 
+    0x5F, 0x62, 0x69, 0x2E, 0x70, 0x79, 0x00, 0x04, 
+    0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x01, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x67, 
+    0x01, 0x00, 0x74, 0x01, 0x00, 0x7C, 0x01, 0x00, 
+    0x83, 0x01, 0x00, 0x14, 0x7D, 0x02, 0x00, 0x64, 
+    0x01, 0x00, 0x7D, 0x03, 0x00, 0x78, 0x28, 0x00, 
+    0x7C, 0x01, 0x00, 0x44, 0x5D, 0x20, 0x00, 0x7D, 
+    0x04, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x04, 0x00, 
+    0x83, 0x01, 0x00, 0x7C, 0x02, 0x00, 0x7C, 0x03, 
+    0x00, 0x3C, 0x7C, 0x03, 0x00, 0x64, 0x02, 0x00, 
+    0x37, 0x7D, 0x03, 0x00, 0x71, 0x20, 0x00, 0x57, 
+    0x7C, 0x02, 0x00, 0x53, 0x0B, 0x01, 0x0F, 0x00, 
+    0x0A, 0x53, 0x00, 0x02, 0x43, 0x02, 0x02, 0xBF, 
+    0x01, 0x04, 0x01, 0x03, 0x03, 0x00, 0x70, 0x6F, 
+    0x77, 0x03, 0x02, 0x00, 0x00, 0x01, 0x03, 0x2F, 
+    0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 
+    0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 
+    0x68, 0x74, 0x2F, 0x6C, 0x69, 0x62, 0x72, 0x61, 
+    0x72, 0x69, 0x65, 0x73, 0x2F, 0x50, 0x79, 0x4D, 
+    0x69, 0x74, 0x65, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 
+    0x5F, 0x5F, 0x62, 0x69, 0x2E, 0x70, 0x79, 0x00, 
+    0x04, 0x01, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x01, 
+    0x00, 0x13, 0x53, 0x0B, 0x03, 0x10, 0x00, 0x0B, 
+    0x01, 0x11, 0x00, 0x0B, 0x01, 0x12, 0x00, 0x0B, 
+    0x01, 0x13, 0x00, 0x03, 0x03, 0x00, 0x54, 0x42, 
+    0x44, 0x03, 0x06, 0x00, 0x6F, 0x62, 0x6A, 0x65, 
+    0x63, 0x74, 0x0A, 0x6D, 0x00, 0x00, 0x42, 0x01, 
+    0x00, 0xCC, 0x02, 0x04, 0x03, 0x03, 0x08, 0x00, 
+    0x5F, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 
+    0x03, 0x0A, 0x00, 0x5F, 0x5F, 0x6D, 0x6F, 0x64, 
+    0x75, 0x6C, 0x65, 0x5F, 0x5F, 0x03, 0x06, 0x00, 
+    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x03, 0x02, 
+    0x00, 0x06, 0x01, 0x03, 0x2F, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 
+    0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 0x65, 
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x5F, 0x5F, 0x62, 
+    0x69, 0x2E, 0x70, 0x79, 0x00, 0x04, 0x00, 0x65, 
+    0x00, 0x00, 0x5A, 0x01, 0x00, 0x52, 0x53, 0x03, 
+    0x09, 0x00, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 
+    0x69, 0x6F, 0x6E, 0x0A, 0x70, 0x00, 0x00, 0x42, 
+    0x01, 0x00, 0xD3, 0x02, 0x04, 0x03, 0x03, 0x08, 
+    0x00, 0x5F, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 
+    0x5F, 0x03, 0x0A, 0x00, 0x5F, 0x5F, 0x6D, 0x6F, 
+    0x64, 0x75, 0x6C, 0x65, 0x5F, 0x5F, 0x03, 0x09, 
+    0x00, 0x45, 0x78, 0x63, 0x65, 0x70, 0x74, 0x69, 
+    0x6F, 0x6E, 0x03, 0x02, 0x00, 0x06, 0x01, 0x03, 
+    0x2F, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 
+    0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 
+    0x67, 0x68, 0x74, 0x2F, 0x6C, 0x69, 0x62, 0x72, 
+    0x61, 0x72, 0x69, 0x65, 0x73, 0x2F, 0x50, 0x79, 
+    0x4D, 0x69, 0x74, 0x65, 0x2F, 0x6C, 0x69, 0x62, 
+    0x2F, 0x5F, 0x5F, 0x62, 0x69, 0x2E, 0x70, 0x79, 
+    0x00, 0x04, 0x00, 0x65, 0x00, 0x00, 0x5A, 0x01, 
+    0x00, 0x52, 0x53, 0x03, 0x0E, 0x00, 0x41, 0x73, 
+    0x73, 0x65, 0x72, 0x74, 0x69, 0x6F, 0x6E, 0x45, 
+    0x72, 0x72, 0x6F, 0x72, 0x0A, 0x75, 0x00, 0x00, 
+    0x42, 0x01, 0x00, 0xD6, 0x02, 0x04, 0x03, 0x03, 
+    0x08, 0x00, 0x5F, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 
+    0x5F, 0x5F, 0x03, 0x0A, 0x00, 0x5F, 0x5F, 0x6D, 
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x5F, 0x5F, 0x03, 
+    0x0E, 0x00, 0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 
+    0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 
+    0x03, 0x02, 0x00, 0x06, 0x01, 0x03, 0x2F, 0x00, 
+    0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 
+    0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x2F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 
+    0x69, 0x65, 0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 
+    0x74, 0x65, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x5F, 
+    0x5F, 0x62, 0x69, 0x2E, 0x70, 0x79, 0x00, 0x04, 
+    0x00, 0x65, 0x00, 0x00, 0x5A, 0x01, 0x00, 0x52, 
+    0x53, 0x01, 0xE4, 0x00, 0x00, 0x00, 0x03, 0x09, 
+    0x00, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 
+    0x6F, 0x72, 0x0A, 0x17, 0x01, 0x00, 0x42, 0x01, 
+    0x00, 0xE3, 0x02, 0x04, 0x06, 0x03, 0x08, 0x00, 
+    0x5F, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 
+    0x03, 0x0A, 0x00, 0x5F, 0x5F, 0x6D, 0x6F, 0x64, 
+    0x75, 0x6C, 0x65, 0x5F, 0x5F, 0x03, 0x08, 0x00, 
+    0x5F, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x5F, 0x5F, 
+    0x03, 0x04, 0x00, 0x6E, 0x65, 0x78, 0x74, 0x03, 
+    0x04, 0x00, 0x73, 0x65, 0x6E, 0x64, 0x03, 0x09, 
+    0x00, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 
+    0x6F, 0x72, 0x03, 0x06, 0x00, 0x06, 0x02, 0x09, 
+    0x37, 0x09, 0x04, 0x03, 0x2F, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 
+    0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 0x65, 
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x5F, 0x5F, 0x62, 
+    0x69, 0x2E, 0x70, 0x79, 0x00, 0x04, 0x03, 0x0B, 
+    0x02, 0x14, 0x00, 0x0A, 0x67, 0x00, 0x01, 0x43, 
+    0x02, 0x01, 0x1C, 0x03, 0x04, 0x03, 0x03, 0x04, 
+    0x00, 0x73, 0x65, 0x6E, 0x64, 0x03, 0x04, 0x00, 
+    0x4E, 0x6F, 0x6E, 0x65, 0x03, 0x04, 0x00, 0x6E, 
+    0x65, 0x78, 0x74, 0x03, 0x02, 0x00, 0x00, 0x01, 
+    0x03, 0x2F, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 
+    0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 
+    0x69, 0x67, 0x68, 0x74, 0x2F, 0x6C, 0x69, 0x62, 
+    0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x2F, 0x50, 
+    0x79, 0x4D, 0x69, 0x74, 0x65, 0x2F, 0x6C, 0x69, 
+    0x62, 0x2F, 0x5F, 0x5F, 0x62, 0x69, 0x2E, 0x70, 
+    0x79, 0x00, 0x04, 0x01, 0x00, 0x7C, 0x00, 0x00, 
+    0x69, 0x00, 0x00, 0x64, 0x00, 0x00, 0x83, 0x01, 
+    0x00, 0x53, 0x0B, 0x02, 0x15, 0x00, 0x65, 0x00, 
+    0x00, 0x5A, 0x01, 0x00, 0x64, 0x00, 0x00, 0x84, 
+    0x00, 0x00, 0x5A, 0x02, 0x00, 0x64, 0x01, 0x00, 
+    0x84, 0x00, 0x00, 0x5A, 0x03, 0x00, 0x64, 0x02, 
+    0x00, 0x84, 0x00, 0x00, 0x5A, 0x04, 0x00, 0x52, 
+    0x53, 0x0B, 0x00, 0x16, 0x00, 0x00, 0x04, 0x00, 
+    0x64, 0x00, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x00, 
+    0x00, 0x64, 0x01, 0x00, 0x84, 0x00, 0x00, 0x5A, 
+    0x01, 0x00, 0x64, 0x02, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x02, 0x00, 0x64, 0x03, 0x00, 0x84, 0x00, 
+    0x00, 0x5A, 0x03, 0x00, 0x64, 0x04, 0x00, 0x84, 
+    0x00, 0x00, 0x5A, 0x04, 0x00, 0x64, 0x05, 0x00, 
+    0x84, 0x00, 0x00, 0x5A, 0x05, 0x00, 0x64, 0x06, 
+    0x00, 0x84, 0x00, 0x00, 0x5A, 0x06, 0x00, 0x64, 
+    0x07, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x07, 0x00, 
+    0x64, 0x08, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x08, 
+    0x00, 0x64, 0x09, 0x00, 0x84, 0x00, 0x00, 0x5A, 
+    0x09, 0x00, 0x64, 0x0A, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x0A, 0x00, 0x64, 0x0B, 0x00, 0x84, 0x00, 
+    0x00, 0x5A, 0x0B, 0x00, 0x64, 0x0C, 0x00, 0x84, 
+    0x00, 0x00, 0x5A, 0x0C, 0x00, 0x64, 0x0D, 0x00, 
+    0x84, 0x00, 0x00, 0x5A, 0x0D, 0x00, 0x64, 0x0E, 
+    0x00, 0x84, 0x00, 0x00, 0x5A, 0x0E, 0x00, 0x64, 
+    0x0F, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x0F, 0x00, 
+    0x64, 0x10, 0x00, 0x5A, 0x10, 0x00, 0x64, 0x11, 
+    0x00, 0x64, 0x1C, 0x00, 0x64, 0x12, 0x00, 0x84, 
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x59, 0x5A, 0x11, 
+    0x00, 0x64, 0x13, 0x00, 0x65, 0x11, 0x00, 0x66, 
+    0x01, 0x00, 0x64, 0x14, 0x00, 0x84, 0x00, 0x00, 
+    0x83, 0x00, 0x00, 0x59, 0x5A, 0x12, 0x00, 0x64, 
+    0x15, 0x00, 0x65, 0x12, 0x00, 0x66, 0x01, 0x00, 
+    0x64, 0x16, 0x00, 0x84, 0x00, 0x00, 0x83, 0x00, 
+    0x00, 0x59, 0x5A, 0x13, 0x00, 0x64, 0x17, 0x00, 
+    0x65, 0x13, 0x00, 0x5F, 0x14, 0x00, 0x64, 0x18, 
+    0x00, 0x65, 0x11, 0x00, 0x66, 0x01, 0x00, 0x64, 
+    0x19, 0x00, 0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 
+    0x59, 0x5A, 0x15, 0x00, 0x64, 0x1A, 0x00, 0x84, 
+    0x00, 0x00, 0x5A, 0x16, 0x00, 0x64, 0x1B, 0x00, 
+    0x53, 
+
+/* /root/repo/flight/libraries/PyMite/lib/sys.py */
+    0x0A, 0xA7, 0x01, 0x00, 0x40, 0x01, 0x00, 0x1D, 
+    0x00, 0x04, 0x0B, 0x03, 0x06, 0x00, 0x6D, 0x61, 
+    0x78, 0x69, 0x6E, 0x74, 0x03, 0x04, 0x00, 0x65, 
+    0x78, 0x69, 0x74, 0x03, 0x02, 0x00, 0x67, 0x63, 
+    0x03, 0x07, 0x00, 0x67, 0x63, 0x73, 0x74, 0x61, 
+    0x74, 0x73, 0x03, 0x04, 0x00, 0x67, 0x65, 0x74, 
+    0x62, 0x03, 0x04, 0x00, 0x68, 0x65, 0x61, 0x70, 
+    0x03, 0x04, 0x00, 0x70, 0x75, 0x74, 0x62, 0x03, 
+    0x0B, 0x00, 0x72, 0x75, 0x6E, 0x49, 0x6E, 0x54, 
+    0x68, 0x72, 0x65, 0x61, 0x64, 0x03, 0x04, 0x00, 
+    0x74, 0x69, 0x6D, 0x65, 0x03, 0x04, 0x00, 0x77, 
+    0x61, 0x69, 0x74, 0x03, 0x03, 0x00, 0x73, 0x79, 
+    0x73, 0x03, 0x12, 0x00, 0x06, 0x03, 0x09, 0x23, 
+    0x09, 0x19, 0x09, 0x3A, 0x09, 0x1A, 0x09, 0x30, 
+    0x09, 0x21, 0x09, 0x1E, 0x09, 0x26, 0x03, 0x2E, 
+    0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 
+    0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 
+    0x68, 0x74, 0x2F, 0x6C, 0x69, 0x62, 0x72, 0x61, 
+    0x72, 0x69, 0x65, 0x73, 0x2F, 0x50, 0x79, 0x4D, 
+    0x69, 0x74, 0x65, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 
+    0x73, 0x79, 0x73, 0x2E, 0x70, 0x79, 0x00, 0x04, 
+    0x0B, 0x01, 0xFF, 0xFF, 0xFF, 0x7F, 0x0B, 0x01, 
+    0x17, 0x00, 0x0B, 0x00, 0x18, 0x00, 0x0B, 0x00, 
+    0x19, 0x00, 0x0B, 0x00, 0x1A, 0x00, 0x0B, 0x00, 
+    0x1B, 0x00, 0x0B, 0x01, 0x1C, 0x00, 0x0B, 0x01, 
+    0x1D, 0x00, 0x0B, 0x00, 0x1E, 0x00, 0x0A, 0x7D, 
+    0x00, 0x01, 0x43, 0x02, 0x02, 0x45, 0x01, 0x04, 
+    0x02, 0x03, 0x04, 0x00, 0x74, 0x69, 0x6D, 0x65, 
+    0x03, 0x04, 0x00, 0x77, 0x61, 0x69, 0x74, 0x03, 
+    0x06, 0x00, 0x00, 0x01, 0x0D, 0x01, 0x12, 0x01, 
+    0x03, 0x2E, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 
+    0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 
+    0x69, 0x67, 0x68, 0x74, 0x2F, 0x6C, 0x69, 0x62, 
+    0x72, 0x61, 0x72, 0x69, 0x65, 0x73, 0x2F, 0x50, 
+    0x79, 0x4D, 0x69, 0x74, 0x65, 0x2F, 0x6C, 0x69, 
+    0x62, 0x2F, 0x73, 0x79, 0x73, 0x2E, 0x70, 0x79, 
+    0x00, 0x04, 0x01, 0x00, 0x74, 0x00, 0x00, 0x83, 
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x17, 0x7D, 0x01, 
+    0x00, 0x78, 0x13, 0x00, 0x74, 0x00, 0x00, 0x83, 
+    0x00, 0x00, 0x7C, 0x01, 0x00, 0x6A, 0x00, 0x00, 
+    0x72, 0x22, 0x00, 0x71, 0x10, 0x00, 0x57, 0x64, 
+    0x00, 0x00, 0x53, 0x00, 0x64, 0x00, 0x00, 0x5A, 
+    0x00, 0x00, 0x64, 0x01, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x01, 0x00, 0x64, 0x02, 0x00, 0x84, 0x00, 
+    0x00, 0x5A, 0x02, 0x00, 0x64, 0x03, 0x00, 0x84, 
+    0x00, 0x00, 0x5A, 0x03, 0x00, 0x64, 0x04, 0x00, 
+    0x84, 0x00, 0x00, 0x5A, 0x04, 0x00, 0x64, 0x05, 
+    0x00, 0x84, 0x00, 0x00, 0x5A, 0x05, 0x00, 0x64, 
+    0x06, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x06, 0x00, 
+    0x64, 0x07, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x07, 
+    0x00, 0x64, 0x08, 0x00, 0x84, 0x00, 0x00, 0x5A, 
+    0x08, 0x00, 0x64, 0x09, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x09, 0x00, 0x64, 0x0A, 0x00, 0x53, 
+
+/* /root/repo/flight/libraries/PyMite/lib/string.py */
+    0x0A, 0x23, 0x02, 0x00, 0x40, 0x02, 0x00, 0x17, 
+    0x00, 0x04, 0x09, 0x03, 0x07, 0x00, 0x5F, 0x5F, 
+    0x64, 0x6F, 0x63, 0x5F, 0x5F, 0x03, 0x06, 0x00, 
+    0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x03, 0x09, 
+    0x00, 0x68, 0x65, 0x78, 0x64, 0x69, 0x67, 0x69, 
+    0x74, 0x73, 0x03, 0x07, 0x00, 0x6C, 0x65, 0x74, 
+    0x74, 0x65, 0x72, 0x73, 0x03, 0x04, 0x00, 0x61, 
+    0x74, 0x6F, 0x69, 0x03, 0x05, 0x00, 0x63, 0x6F, 
+    0x75, 0x6E, 0x74, 0x03, 0x04, 0x00, 0x66, 0x69, 
+    0x6E, 0x64, 0x03, 0x04, 0x00, 0x6A, 0x6F, 0x69, 
+    0x6E, 0x03, 0x06, 0x00, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x03, 0x0E, 0x00, 0x06, 0x03, 0x06, 
+    0x01, 0x06, 0x01, 0x06, 0x07, 0x09, 0x45, 0x09, 
+    0x57, 0x09, 0x3B, 0x03, 0x31, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 0x65, 
+    0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 0x65, 
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x2E, 0x70, 0x79, 0x00, 0x04, 
+    0x0A, 0x00, 0x03, 0x0A, 0x00, 0x30, 0x31, 0x32, 
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x03, 
+    0x16, 0x00, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 
+    0x36, 0x37, 0x38, 0x39, 0x61, 0x62, 0x63, 0x64, 
+    0x65, 0x66, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 
+    0x03, 0x34, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 
+    0x66, 0x67, 0x68, 0x69, 0x6A, 0x6B, 0x6C, 0x6D, 
+    0x6E, 0x6F, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 
+    0x76, 0x77, 0x78, 0x79, 0x7A, 0x41, 0x42, 0x43, 
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 
+    0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x52, 0x53, 
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x0B, 
+    0x02, 0x1F, 0x00, 0x0B, 0x02, 0x20, 0x00, 0x0B, 
+    0x02, 0x21, 0x00, 0x03, 0x01, 0x00, 0x20, 0x0A, 
+    0xD0, 0x00, 0x02, 0x43, 0x03, 0x05, 0xFA, 0x00, 
+    0x04, 0x02, 0x03, 0x03, 0x00, 0x6C, 0x65, 0x6E, 
+    0x03, 0x04, 0x00, 0x6A, 0x6F, 0x69, 0x6E, 0x03, 
+    0x12, 0x00, 0x00, 0x01, 0x0C, 0x01, 0x0C, 0x01, 
+    0x04, 0x01, 0x0A, 0x01, 0x06, 0x01, 0x0F, 0x01, 
+    0x12, 0x01, 0x0E, 0x01, 0x03, 0x31, 0x00, 0x2F, 
+    0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 
+    0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 
+    0x2F, 0x6C, 0x69, 0x62, 0x72, 0x61, 0x72, 0x69, 
+    0x65, 0x73, 0x2F, 0x50, 0x79, 0x4D, 0x69, 0x74, 
+    0x65, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x73, 0x74, 
+    0x72, 0x69, 0x6E, 0x67, 0x2E, 0x70, 0x79, 0x00, 
+    0x04, 0x04, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 
+    0x74, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x83, 0x01, 
+    0x00, 0x7D, 0x02, 0x00, 0x7C, 0x02, 0x00, 0x64, 
+    0x01, 0x00, 0x6A, 0x02, 0x00, 0x72, 0x1C, 0x00, 
+    0x64, 0x02, 0x00, 0x53, 0x7C, 0x00, 0x00, 0x64, 
+    0x01, 0x00, 0x19, 0x7D, 0x03, 0x00, 0x64, 0x03, 
+    0x00, 0x7D, 0x04, 0x00, 0x78, 0x2C, 0x00, 0x7C, 
+    0x04, 0x00, 0x7C, 0x02, 0x00, 0x6A, 0x00, 0x00, 
+    0x72, 0x5A, 0x00, 0x7C, 0x03, 0x00, 0x7C, 0x01, 
+    0x00, 0x17, 0x7C, 0x00, 0x00, 0x7C, 0x04, 0x00, 
+    0x19, 0x17, 0x7D, 0x03, 0x00, 0x7C, 0x04, 0x00, 
+    0x64, 0x03, 0x00, 0x37, 0x7D, 0x04, 0x00, 0x71, 
+    0x2F, 0x00, 0x57, 0x7C, 0x03, 0x00, 0x53, 0x00, 
+    0x64, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x64, 0x01, 
+    0x00, 0x5A, 0x01, 0x00, 0x64, 0x02, 0x00, 0x5A, 
+    0x02, 0x00, 0x64, 0x03, 0x00, 0x5A, 0x03, 0x00, 
+    0x64, 0x04, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x04, 
+    0x00, 0x64, 0x05, 0x00, 0x84, 0x00, 0x00, 0x5A, 
+    0x05, 0x00, 0x64, 0x06, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x06, 0x00, 0x64, 0x07, 0x00, 0x64, 0x08, 
+    0x00, 0x84, 0x01, 0x00, 0x5A, 0x07, 0x00, 0x64, 
+    0x09, 0x00, 0x53, 
+
+/* /root/repo/flight/modules/FlightPlan/lib/openpilot.py */
+    0x0A, 0xFB, 0x00, 0x00, 0x40, 0x01, 0x00, 0x21, 
+    0x00, 0x04, 0x07, 0x03, 0x07, 0x00, 0x5F, 0x5F, 
+    0x64, 0x6F, 0x63, 0x5F, 0x5F, 0x03, 0x05, 0x00, 
+    0x64, 0x65, 0x6C, 0x61, 0x79, 0x03, 0x0A, 0x00, 
+    0x64, 0x65, 0x6C, 0x61, 0x79, 0x55, 0x6E, 0x74, 
+    0x69, 0x6C, 0x03, 0x05, 0x00, 0x64, 0x65, 0x62, 
+    0x75, 0x67, 0x03, 0x0E, 0x00, 0x68, 0x61, 0x73, 
+    0x53, 0x74, 0x6F, 0x70, 0x52, 0x65, 0x71, 0x75, 
+    0x65, 0x73, 0x74, 0x03, 0x14, 0x00, 0x77, 0x61, 
+    0x69, 0x74, 0x46, 0x6F, 0x72, 0x4F, 0x62, 0x6A, 
+    0x65, 0x63, 0x74, 0x55, 0x70, 0x64, 0x61, 0x74, 
+    0x65, 0x73, 0x03, 0x09, 0x00, 0x6F, 0x70, 0x65, 
+    0x6E, 0x70, 0x69, 0x6C, 0x6F, 0x74, 0x03, 0x0A, 
+    0x00, 0x06, 0x03, 0x09, 0x27, 0x09, 0x32, 0x09, 
+    0x31, 0x09, 0x1B, 0x03, 0x36, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 
+    0x46, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 
+    0x61, 0x6E, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x6F, 
+    0x70, 0x65, 0x6E, 0x70, 0x69, 0x6C, 0x6F, 0x74, 
+    0x2E, 0x70, 0x79, 0x00, 0x04, 0x07, 0x00, 0x0B, 
+    0x01, 0x22, 0x00, 0x0B, 0x02, 0x23, 0x00, 0x0B, 
+    0x02, 0x24, 0x00, 0x0B, 0x00, 0x25, 0x00, 0x0B, 
+    0x01, 0x26, 0x00, 0x00, 0x64, 0x00, 0x00, 0x5A, 
+    0x00, 0x00, 0x64, 0x01, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x01, 0x00, 0x64, 0x02, 0x00, 0x84, 0x00, 
+    0x00, 0x5A, 0x02, 0x00, 0x64, 0x03, 0x00, 0x84, 
+    0x00, 0x00, 0x5A, 0x03, 0x00, 0x64, 0x04, 0x00, 
+    0x84, 0x00, 0x00, 0x5A, 0x04, 0x00, 0x64, 0x05, 
+    0x00, 0x84, 0x00, 0x00, 0x5A, 0x05, 0x00, 0x64, 
+    0x06, 0x00, 0x53, 
+
+/* /root/repo/flight/modules/FlightPlan/lib/uavobject.py */
+    0x0A, 0x0D, 0x0C, 0x00, 0x40, 0x03, 0x00, 0x27, 
+    0x00, 0x04, 0x07, 0x03, 0x07, 0x00, 0x5F, 0x5F, 
+    0x64, 0x6F, 0x63, 0x5F, 0x5F, 0x03, 0x04, 0x00, 
+    0x6C, 0x69, 0x73, 0x74, 0x03, 0x06, 0x00, 0x61, 
+    0x70, 0x70, 0x65, 0x6E, 0x64, 0x03, 0x11, 0x00, 
+    0x55, 0x41, 0x56, 0x4F, 0x62, 0x6A, 0x65, 0x63, 
+    0x74, 0x4D, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 
+    0x61, 0x03, 0x0E, 0x00, 0x55, 0x41, 0x56, 0x4F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x46, 0x69, 0x65, 
+    0x6C, 0x64, 0x03, 0x09, 0x00, 0x55, 0x41, 0x56, 
+    0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x03, 0x09, 
+    0x00, 0x75, 0x61, 0x76, 0x6F, 0x62, 0x6A, 0x65, 
+    0x63, 0x74, 0x03, 0x08, 0x00, 0x06, 0x02, 0x10, 
+    0x02, 0x13, 0x1F, 0x13, 0x1D, 0x03, 0x36, 0x00, 
+    0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 
+    0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x2F, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 
+    0x73, 0x2F, 0x46, 0x6C, 0x69, 0x67, 0x68, 0x74, 
+    0x50, 0x6C, 0x61, 0x6E, 0x2F, 0x6C, 0x69, 0x62, 
+    0x2F, 0x75, 0x61, 0x76, 0x6F, 0x62, 0x6A, 0x65, 
+    0x63, 0x74, 0x2E, 0x70, 0x79, 0x00, 0x04, 0x0D, 
+    0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x01, 
+    0x03, 0x06, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6E, 
+    0x64, 0x03, 0x11, 0x00, 0x55, 0x41, 0x56, 0x4F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x4D, 0x65, 0x74, 
+    0x61, 0x64, 0x61, 0x74, 0x61, 0x0A, 0x52, 0x05, 
+    0x00, 0x42, 0x03, 0x00, 0x2B, 0x00, 0x04, 0x08, 
+    0x03, 0x08, 0x00, 0x5F, 0x5F, 0x6E, 0x61, 0x6D, 
+    0x65, 0x5F, 0x5F, 0x03, 0x0A, 0x00, 0x5F, 0x5F, 
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x5F, 0x5F, 
+    0x03, 0x0A, 0x00, 0x55, 0x70, 0x64, 0x61, 0x74, 
+    0x65, 0x4D, 0x6F, 0x64, 0x65, 0x03, 0x06, 0x00, 
+    0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x03, 0x08, 
+    0x00, 0x5F, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x5F, 
+    0x5F, 0x03, 0x04, 0x00, 0x72, 0x65, 0x61, 0x64, 
+    0x03, 0x05, 0x00, 0x77, 0x72, 0x69, 0x74, 0x65, 
+    0x03, 0x11, 0x00, 0x55, 0x41, 0x56, 0x4F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x4D, 0x65, 0x74, 0x61, 
+    0x64, 0x61, 0x74, 0x61, 0x03, 0x0A, 0x00, 0x06, 
+    0x01, 0x13, 0x06, 0x13, 0x04, 0x09, 0x0E, 0x09, 
+    0x03, 0x03, 0x36, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 
+    0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 
+    0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x6D, 0x6F, 
+    0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 0x46, 0x6C, 
+    0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 0x61, 0x6E, 
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x75, 0x61, 0x76, 
+    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 
+    0x79, 0x00, 0x04, 0x09, 0x03, 0x0A, 0x00, 0x55, 
+    0x70, 0x64, 0x61, 0x74, 0x65, 0x4D, 0x6F, 0x64, 
+    0x65, 0x0A, 0xD1, 0x00, 0x00, 0x42, 0x01, 0x00, 
+    0x2C, 0x00, 0x04, 0x07, 0x03, 0x08, 0x00, 0x5F, 
+    0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x03, 
+    0x0A, 0x00, 0x5F, 0x5F, 0x6D, 0x6F, 0x64, 0x75, 
+    0x6C, 0x65, 0x5F, 0x5F, 0x03, 0x08, 0x00, 0x50, 
+    0x45, 0x52, 0x49, 0x4F, 0x44, 0x49, 0x43, 0x03, 
+    0x08, 0x00, 0x4F, 0x4E, 0x43, 0x48, 0x41, 0x4E, 
+    0x47, 0x45, 0x03, 0x06, 0x00, 0x4D, 0x41, 0x4E, 
+    0x55, 0x41, 0x4C, 0x03, 0x05, 0x00, 0x4E, 0x45, 
+    0x56, 0x45, 0x52, 0x03, 0x0A, 0x00, 0x55, 0x70, 
+    0x64, 0x61, 0x74, 0x65, 0x4D, 0x6F, 0x64, 0x65, 
+    0x03, 0x08, 0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 
+    0x01, 0x06, 0x01, 0x03, 0x36, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 
+    0x46, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 
+    0x61, 0x6E, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x75, 
+    0x61, 0x76, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x2E, 0x70, 0x79, 0x00, 0x04, 0x04, 0x01, 0x00, 
+    0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 
+    0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 
+    0x00, 0x00, 0x65, 0x00, 0x00, 0x5A, 0x01, 0x00, 
+    0x64, 0x00, 0x00, 0x5A, 0x02, 0x00, 0x64, 0x01, 
+    0x00, 0x5A, 0x03, 0x00, 0x64, 0x02, 0x00, 0x5A, 
+    0x04, 0x00, 0x64, 0x03, 0x00, 0x5A, 0x05, 0x00, 
+    0x52, 0x53, 0x03, 0x06, 0x00, 0x41, 0x63, 0x63, 
+    0x65, 0x73, 0x73, 0x0A, 0xA3, 0x00, 0x00, 0x42, 
+    0x01, 0x00, 0x32, 0x00, 0x04, 0x05, 0x03, 0x08, 
+    0x00, 0x5F, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 
+    0x5F, 0x03, 0x0A, 0x00, 0x5F, 0x5F, 0x6D, 0x6F, 
+    0x64, 0x75, 0x6C, 0x65, 0x5F, 0x5F, 0x03, 0x09, 
+    0x00, 0x52, 0x45, 0x41, 0x44, 0x57, 0x52, 0x49, 
+    0x54, 0x45, 0x03, 0x08, 0x00, 0x52, 0x45, 0x41, 
+    0x44, 0x4F, 0x4E, 0x4C, 0x59, 0x03, 0x06, 0x00, 
+    0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x03, 0x04, 
+    0x00, 0x06, 0x01, 0x06, 0x01, 0x03, 0x36, 0x00, 
+    0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 
+    0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x2F, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 
+    0x73, 0x2F, 0x46, 0x6C, 0x69, 0x67, 0x68, 0x74, 
+    0x50, 0x6C, 0x61, 0x6E, 0x2F, 0x6C, 0x69, 0x62, 
+    0x2F, 0x75, 0x61, 0x76, 0x6F, 0x62, 0x6A, 0x65, 
+    0x63, 0x74, 0x2E, 0x70, 0x79, 0x00, 0x04, 0x02, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 
+    0x00, 0x00, 0x65, 0x00, 0x00, 0x5A, 0x01, 0x00, 
+    0x64, 0x00, 0x00, 0x5A, 0x02, 0x00, 0x64, 0x01, 
+    0x00, 0x5A, 0x03, 0x00, 0x52, 0x53, 0x0A, 0x1D, 
+    0x02, 0x02, 0x43, 0x02, 0x02, 0x36, 0x00, 0x04, 
+    0x13, 0x03, 0x11, 0x00, 0x55, 0x41, 0x56, 0x4F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x4D, 0x65, 0x74, 
+    0x61, 0x64, 0x61, 0x74, 0x61, 0x03, 0x06, 0x00, 
+    0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x03, 0x09, 
+    0x00, 0x52, 0x45, 0x41, 0x44, 0x57, 0x52, 0x49, 
+    0x54, 0x45, 0x03, 0x06, 0x00, 0x61, 0x63, 0x63, 
+    0x65, 0x73, 0x73, 0x03, 0x09, 0x00, 0x67, 0x63, 
+    0x73, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x03, 
+    0x05, 0x00, 0x46, 0x61, 0x6C, 0x73, 0x65, 0x03, 
+    0x0E, 0x00, 0x74, 0x65, 0x6C, 0x65, 0x6D, 0x65, 
+    0x74, 0x72, 0x79, 0x41, 0x63, 0x6B, 0x65, 0x64, 
+    0x03, 0x0A, 0x00, 0x55, 0x70, 0x64, 0x61, 0x74, 
+    0x65, 0x4D, 0x6F, 0x64, 0x65, 0x03, 0x06, 0x00, 
+    0x4D, 0x41, 0x4E, 0x55, 0x41, 0x4C, 0x03, 0x13, 
+    0x00, 0x74, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x74, 
+    0x72, 0x79, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 
+    0x4D, 0x6F, 0x64, 0x65, 0x03, 0x15, 0x00, 0x74, 
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x74, 0x72, 0x79, 
+    0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x50, 0x65, 
+    0x72, 0x69, 0x6F, 0x64, 0x03, 0x11, 0x00, 0x67, 
+    0x63, 0x73, 0x54, 0x65, 0x6C, 0x65, 0x6D, 0x65, 
+    0x74, 0x72, 0x79, 0x41, 0x63, 0x6B, 0x65, 0x64, 
+    0x03, 0x16, 0x00, 0x67, 0x63, 0x73, 0x54, 0x65, 
+    0x6C, 0x65, 0x6D, 0x65, 0x74, 0x72, 0x79, 0x55, 
+    0x70, 0x64, 0x61, 0x74, 0x65, 0x4D, 0x6F, 0x64, 
+    0x65, 0x03, 0x18, 0x00, 0x67, 0x63, 0x73, 0x54, 
+    0x65, 0x6C, 0x65, 0x6D, 0x65, 0x74, 0x72, 0x79, 
+    0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 0x50, 0x65, 
+    0x72, 0x69, 0x6F, 0x64, 0x03, 0x11, 0x00, 0x6C, 
+    0x6F, 0x67, 0x67, 0x69, 0x6E, 0x67, 0x55, 0x70, 
+    0x64, 0x61, 0x74, 0x65, 0x4D, 0x6F, 0x64, 0x65, 
+    0x03, 0x13, 0x00, 0x6C, 0x6F, 0x67, 0x67, 0x69, 
+    0x6E, 0x67, 0x55, 0x70, 0x64, 0x61, 0x74, 0x65, 
+    0x50, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x03, 0x05, 
+    0x00, 0x6F, 0x62, 0x6A, 0x49, 0x64, 0x03, 0x04, 
+    0x00, 0x72, 0x65, 0x61, 0x64, 0x03, 0x08, 0x00, 
+    0x5F, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x5F, 0x5F, 
+    0x03, 0x18, 0x00, 0x00, 0x01, 0x0F, 0x01, 0x0F, 
+    0x01, 0x09, 0x01, 0x0F, 0x01, 0x09, 0x01, 0x09, 
+    0x01, 0x0F, 0x01, 0x09, 0x01, 0x09, 0x01, 0x0F, 
+    0x01, 0x09, 0x01, 0x03, 0x36, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 
+    0x46, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 
+    0x61, 0x6E, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x75, 
+    0x61, 0x76, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x2E, 0x70, 0x79, 0x00, 0x04, 0x02, 0x00, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x69, 
+    0x01, 0x00, 0x69, 0x02, 0x00, 0x7C, 0x00, 0x00, 
+    0x5F, 0x03, 0x00, 0x74, 0x00, 0x00, 0x69, 0x01, 
+    0x00, 0x69, 0x02, 0x00, 0x7C, 0x00, 0x00, 0x5F, 
+    0x04, 0x00, 0x74, 0x05, 0x00, 0x7C, 0x00, 0x00, 
+    0x5F, 0x06, 0x00, 0x74, 0x00, 0x00, 0x69, 0x07, 
+    0x00, 0x69, 0x08, 0x00, 0x7C, 0x00, 0x00, 0x5F, 
+    0x09, 0x00, 0x64, 0x01, 0x00, 0x7C, 0x00, 0x00, 
+    0x5F, 0x0A, 0x00, 0x74, 0x05, 0x00, 0x7C, 0x00, 
+    0x00, 0x5F, 0x0B, 0x00, 0x74, 0x00, 0x00, 0x69, 
+    0x07, 0x00, 0x69, 0x08, 0x00, 0x7C, 0x00, 0x00, 
+    0x5F, 0x0C, 0x00, 0x64, 0x01, 0x00, 0x7C, 0x00, 
+    0x00, 0x5F, 0x0D, 0x00, 0x64, 0x01, 0x00, 0x7C, 
+    0x00, 0x00, 0x5F, 0x0E, 0x00, 0x74, 0x00, 0x00, 
+    0x69, 0x07, 0x00, 0x69, 0x08, 0x00, 0x7C, 0x00, 
+    0x00, 0x5F, 0x0F, 0x00, 0x7C, 0x01, 0x00, 0x7C, 
+    0x00, 0x00, 0x5F, 0x10, 0x00, 0x7C, 0x00, 0x00, 
+    0x69, 0x11, 0x00, 0x83, 0x00, 0x00, 0x01, 0x64, 
+    0x00, 0x00, 0x53, 0x0A, 0x57, 0x00, 0x01, 0x43, 
+    0x01, 0x01, 0x44, 0x00, 0x04, 0x01, 0x03, 0x04, 
+    0x00, 0x72, 0x65, 0x61, 0x64, 0x03, 0x02, 0x00, 
+    0x00, 0x01, 0x03, 0x36, 0x00, 0x2F, 0x72, 0x6F, 
+    0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 
+    0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x6D, 
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 0x46, 
+    0x6C, 0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 0x61, 
+    0x6E, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x75, 0x61, 
+    0x76, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 
+    0x70, 0x79, 0x00, 0x04, 0x01, 0x00, 0x64, 0x00, 
+    0x00, 0x53, 0x0A, 0x58, 0x00, 0x01, 0x43, 0x01, 
+    0x01, 0x47, 0x00, 0x04, 0x01, 0x03, 0x05, 0x00, 
+    0x77, 0x72, 0x69, 0x74, 0x65, 0x03, 0x02, 0x00, 
+    0x00, 0x01, 0x03, 0x36, 0x00, 0x2F, 0x72, 0x6F, 
+    0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 
+    0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x6D, 
+    0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 0x46, 
+    0x6C, 0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 0x61, 
+    0x6E, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x75, 0x61, 
+    0x76, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 
+    0x70, 0x79, 0x00, 0x04, 0x01, 0x00, 0x64, 0x00, 
+    0x00, 0x53, 0x04, 0x00, 0x04, 0x00, 0x65, 0x00, 
+    0x00, 0x5A, 0x01, 0x00, 0x64, 0x00, 0x00, 0x64, 
+    0x07, 0x00, 0x64, 0x01, 0x00, 0x84, 0x00, 0x00, 
+    0x83, 0x00, 0x00, 0x59, 0x5A, 0x02, 0x00, 0x64, 
+    0x02, 0x00, 0x64, 0x08, 0x00, 0x64, 0x03, 0x00, 
+    0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 0x59, 0x5A, 
+    0x03, 0x00, 0x64, 0x04, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x04, 0x00, 0x64, 0x05, 0x00, 0x84, 0x00, 
+    0x00, 0x5A, 0x05, 0x00, 0x64, 0x06, 0x00, 0x84, 
+    0x00, 0x00, 0x5A, 0x06, 0x00, 0x52, 0x53, 0x03, 
+    0x0E, 0x00, 0x55, 0x41, 0x56, 0x4F, 0x62, 0x6A, 
+    0x65, 0x63, 0x74, 0x46, 0x69, 0x65, 0x6C, 0x64, 
+    0x0A, 0x63, 0x03, 0x00, 0x42, 0x03, 0x00, 0x4A, 
+    0x00, 0x04, 0x05, 0x03, 0x08, 0x00, 0x5F, 0x5F, 
+    0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x03, 0x0A, 
+    0x00, 0x5F, 0x5F, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 
+    0x65, 0x5F, 0x5F, 0x03, 0x05, 0x00, 0x46, 0x54, 
+    0x79, 0x70, 0x65, 0x03, 0x08, 0x00, 0x5F, 0x5F, 
+    0x69, 0x6E, 0x69, 0x74, 0x5F, 0x5F, 0x03, 0x0E, 
+    0x00, 0x55, 0x41, 0x56, 0x4F, 0x62, 0x6A, 0x65, 
+    0x63, 0x74, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x03, 
+    0x04, 0x00, 0x06, 0x01, 0x13, 0x0A, 0x03, 0x36, 
+    0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 
+    0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 
+    0x68, 0x74, 0x2F, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 
+    0x65, 0x73, 0x2F, 0x46, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x50, 0x6C, 0x61, 0x6E, 0x2F, 0x6C, 0x69, 
+    0x62, 0x2F, 0x75, 0x61, 0x76, 0x6F, 0x62, 0x6A, 
+    0x65, 0x63, 0x74, 0x2E, 0x70, 0x79, 0x00, 0x04, 
+    0x04, 0x03, 0x05, 0x00, 0x46, 0x54, 0x79, 0x70, 
+    0x65, 0x0A, 0x1B, 0x01, 0x00, 0x42, 0x01, 0x00, 
+    0x4B, 0x00, 0x04, 0x0B, 0x03, 0x08, 0x00, 0x5F, 
+    0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x03, 
+    0x0A, 0x00, 0x5F, 0x5F, 0x6D, 0x6F, 0x64, 0x75, 
+    0x6C, 0x65, 0x5F, 0x5F, 0x03, 0x04, 0x00, 0x49, 
+    0x4E, 0x54, 0x38, 0x03, 0x05, 0x00, 0x49, 0x4E, 
+    0x54, 0x31, 0x36, 0x03, 0x05, 0x00, 0x49, 0x4E, 
+    0x54, 0x33, 0x32, 0x03, 0x05, 0x00, 0x55, 0x49, 
+    0x4E, 0x54, 0x38, 0x03, 0x06, 0x00, 0x55, 0x49, 
+    0x4E, 0x54, 0x31, 0x36, 0x03, 0x06, 0x00, 0x55, 
+    0x49, 0x4E, 0x54, 0x33, 0x32, 0x03, 0x07, 0x00, 
+    0x46, 0x4C, 0x4F, 0x41, 0x54, 0x33, 0x32, 0x03, 
+    0x04, 0x00, 0x45, 0x4E, 0x55, 0x4D, 0x03, 0x05, 
+    0x00, 0x46, 0x54, 0x79, 0x70, 0x65, 0x03, 0x10, 
+    0x00, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 
+    0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06, 
+    0x01, 0x03, 0x36, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 
+    0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 
+    0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x6D, 0x6F, 
+    0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 0x46, 0x6C, 
+    0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 0x61, 0x6E, 
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x75, 0x61, 0x76, 
+    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 
+    0x79, 0x00, 0x04, 0x08, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 
+    0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 
+    0x01, 0x04, 0x00, 0x00, 0x00, 0x01, 0x05, 0x00, 
+    0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x00, 0x01, 
+    0x07, 0x00, 0x00, 0x00, 0x65, 0x00, 0x00, 0x5A, 
+    0x01, 0x00, 0x64, 0x00, 0x00, 0x5A, 0x02, 0x00, 
+    0x64, 0x01, 0x00, 0x5A, 0x03, 0x00, 0x64, 0x02, 
+    0x00, 0x5A, 0x04, 0x00, 0x64, 0x03, 0x00, 0x5A, 
+    0x05, 0x00, 0x64, 0x04, 0x00, 0x5A, 0x06, 0x00, 
+    0x64, 0x05, 0x00, 0x5A, 0x07, 0x00, 0x64, 0x06, 
+    0x00, 0x5A, 0x08, 0x00, 0x64, 0x07, 0x00, 0x5A, 
+    0x09, 0x00, 0x52, 0x53, 0x0A, 0x91, 0x01, 0x03, 
+    0x43, 0x04, 0x04, 0x55, 0x00, 0x04, 0x09, 0x03, 
+    0x05, 0x00, 0x66, 0x74, 0x79, 0x70, 0x65, 0x03, 
+    0x0B, 0x00, 0x6E, 0x75, 0x6D, 0x45, 0x6C, 0x65, 
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x03, 0x0E, 0x00, 
+    0x55, 0x41, 0x56, 0x4F, 0x62, 0x6A, 0x65, 0x63, 
+    0x74, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x03, 0x05, 
+    0x00, 0x46, 0x54, 0x79, 0x70, 0x65, 0x03, 0x07, 
+    0x00, 0x46, 0x4C, 0x4F, 0x41, 0x54, 0x33, 0x32, 
+    0x03, 0x05, 0x00, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x03, 0x05, 0x00, 0x72, 0x61, 0x6E, 0x67, 0x65, 
+    0x03, 0x06, 0x00, 0x61, 0x70, 0x70, 0x65, 0x6E, 
+    0x64, 0x03, 0x08, 0x00, 0x5F, 0x5F, 0x69, 0x6E, 
+    0x69, 0x74, 0x5F, 0x5F, 0x03, 0x1A, 0x00, 0x00, 
+    0x01, 0x09, 0x01, 0x09, 0x01, 0x12, 0x01, 0x0C, 
+    0x01, 0x0C, 0x02, 0x09, 0x01, 0x16, 0x01, 0x17, 
+    0x02, 0x0C, 0x01, 0x0C, 0x02, 0x09, 0x01, 0x16, 
+    0x01, 0x03, 0x36, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 
+    0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 
+    0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 0x6D, 0x6F, 
+    0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 0x46, 0x6C, 
+    0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 0x61, 0x6E, 
+    0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x75, 0x61, 0x76, 
+    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 
+    0x79, 0x00, 0x04, 0x04, 0x00, 0x01, 0x01, 0x00, 
+    0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0x00, 0x7C, 
+    0x00, 0x00, 0x5F, 0x00, 0x00, 0x7C, 0x02, 0x00, 
+    0x7C, 0x00, 0x00, 0x5F, 0x01, 0x00, 0x7C, 0x01, 
+    0x00, 0x74, 0x02, 0x00, 0x69, 0x03, 0x00, 0x69, 
+    0x04, 0x00, 0x6A, 0x02, 0x00, 0x72, 0x72, 0x00, 
+    0x7C, 0x02, 0x00, 0x64, 0x01, 0x00, 0x6A, 0x02, 
+    0x00, 0x72, 0x3C, 0x00, 0x64, 0x02, 0x00, 0x7C, 
+    0x00, 0x00, 0x5F, 0x05, 0x00, 0x71, 0xBD, 0x00, 
+    0x67, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x5F, 0x05, 
+    0x00, 0x78, 0x75, 0x00, 0x74, 0x06, 0x00, 0x64, 
+    0x03, 0x00, 0x7C, 0x02, 0x00, 0x83, 0x02, 0x00, 
+    0x44, 0x5D, 0x16, 0x00, 0x7D, 0x03, 0x00, 0x74, 
+    0x07, 0x00, 0x7C, 0x00, 0x00, 0x69, 0x05, 0x00, 
+    0x64, 0x02, 0x00, 0x83, 0x02, 0x00, 0x01, 0x71, 
+    0x55, 0x00, 0x57, 0x6E, 0x4B, 0x00, 0x7C, 0x02, 
+    0x00, 0x64, 0x01, 0x00, 0x6A, 0x02, 0x00, 0x72, 
+    0x8A, 0x00, 0x64, 0x03, 0x00, 0x7C, 0x00, 0x00, 
+    0x5F, 0x05, 0x00, 0x6E, 0x33, 0x00, 0x67, 0x00, 
+    0x00, 0x7C, 0x00, 0x00, 0x5F, 0x05, 0x00, 0x78, 
+    0x27, 0x00, 0x74, 0x06, 0x00, 0x64, 0x03, 0x00, 
+    0x7C, 0x02, 0x00, 0x83, 0x02, 0x00, 0x44, 0x5D, 
+    0x16, 0x00, 0x7D, 0x03, 0x00, 0x74, 0x07, 0x00, 
+    0x7C, 0x00, 0x00, 0x69, 0x05, 0x00, 0x64, 0x03, 
+    0x00, 0x83, 0x02, 0x00, 0x01, 0x71, 0xA3, 0x00, 
+    0x57, 0x64, 0x00, 0x00, 0x53, 0x04, 0x00, 0x65, 
+    0x00, 0x00, 0x5A, 0x01, 0x00, 0x64, 0x00, 0x00, 
+    0x64, 0x03, 0x00, 0x64, 0x01, 0x00, 0x84, 0x00, 
+    0x00, 0x83, 0x00, 0x00, 0x59, 0x5A, 0x02, 0x00, 
+    0x64, 0x02, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x03, 
+    0x00, 0x52, 0x53, 0x03, 0x09, 0x00, 0x55, 0x41, 
+    0x56, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x0A, 
+    0x14, 0x02, 0x00, 0x42, 0x01, 0x00, 0x67, 0x00, 
+    0x04, 0x07, 0x03, 0x08, 0x00, 0x5F, 0x5F, 0x6E, 
+    0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x03, 0x0A, 0x00, 
+    0x5F, 0x5F, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 
+    0x5F, 0x5F, 0x03, 0x08, 0x00, 0x5F, 0x5F, 0x69, 
+    0x6E, 0x69, 0x74, 0x5F, 0x5F, 0x03, 0x08, 0x00, 
+    0x61, 0x64, 0x64, 0x46, 0x69, 0x65, 0x6C, 0x64, 
+    0x03, 0x04, 0x00, 0x72, 0x65, 0x61, 0x64, 0x03, 
+    0x05, 0x00, 0x77, 0x72, 0x69, 0x74, 0x65, 0x03, 
+    0x09, 0x00, 0x55, 0x41, 0x56, 0x4F, 0x62, 0x6A, 
+    0x65, 0x63, 0x74, 0x03, 0x08, 0x00, 0x06, 0x01, 
+    0x09, 0x06, 0x09, 0x29, 0x09, 0x7C, 0x03, 0x36, 
+    0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 
+    0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 
+    0x68, 0x74, 0x2F, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 
+    0x65, 0x73, 0x2F, 0x46, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x50, 0x6C, 0x61, 0x6E, 0x2F, 0x6C, 0x69, 
+    0x62, 0x2F, 0x75, 0x61, 0x76, 0x6F, 0x62, 0x6A, 
+    0x65, 0x63, 0x74, 0x2E, 0x70, 0x79, 0x00, 0x04, 
+    0x04, 0x0A, 0xC9, 0x00, 0x02, 0x43, 0x02, 0x02, 
+    0x68, 0x00, 0x04, 0x06, 0x03, 0x11, 0x00, 0x55, 
+    0x41, 0x56, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x4D, 0x65, 0x74, 0x61, 0x64, 0x61, 0x74, 0x61, 
+    0x03, 0x08, 0x00, 0x6D, 0x65, 0x74, 0x61, 0x64, 
+    0x61, 0x74, 0x61, 0x03, 0x05, 0x00, 0x6F, 0x62, 
+    0x6A, 0x49, 0x64, 0x03, 0x06, 0x00, 0x69, 0x6E, 
+    0x73, 0x74, 0x49, 0x64, 0x03, 0x06, 0x00, 0x66, 
+    0x69, 0x65, 0x6C, 0x64, 0x73, 0x03, 0x08, 0x00, 
+    0x5F, 0x5F, 0x69, 0x6E, 0x69, 0x74, 0x5F, 0x5F, 
+    0x03, 0x08, 0x00, 0x00, 0x01, 0x0F, 0x01, 0x09, 
+    0x01, 0x09, 0x01, 0x03, 0x36, 0x00, 0x2F, 0x72, 
+    0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 0x6F, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x2F, 
+    0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x73, 0x2F, 
+    0x46, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x50, 0x6C, 
+    0x61, 0x6E, 0x2F, 0x6C, 0x69, 0x62, 0x2F, 0x75, 
+    0x61, 0x76, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x2E, 0x70, 0x79, 0x00, 0x04, 0x02, 0x00, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x7C, 
+    0x01, 0x00, 0x83, 0x01, 0x00, 0x7C, 0x00, 0x00, 
+    0x5F, 0x01, 0x00, 0x7C, 0x01, 0x00, 0x7C, 0x00, 
+    0x00, 0x5F, 0x02, 0x00, 0x64, 0x01, 0x00, 0x7C, 
+    0x00, 0x00, 0x5F, 0x03, 0x00, 0x67, 0x00, 0x00, 
+    0x7C, 0x00, 0x00, 0x5F, 0x04, 0x00, 0x64, 0x00, 
+    0x00, 0x53, 0x0A, 0x7D, 0x00, 0x02, 0x43, 0x03, 
+    0x02, 0x6E, 0x00, 0x04, 0x03, 0x03, 0x06, 0x00, 
+    0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x03, 0x06, 
+    0x00, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x03, 
+    0x08, 0x00, 0x61, 0x64, 0x64, 0x46, 0x69, 0x65, 
+    0x6C, 0x64, 0x03, 0x02, 0x00, 0x00, 0x01, 0x03, 
+    0x36, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 
+    0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 
+    0x67, 0x68, 0x74, 0x2F, 0x6D, 0x6F, 0x64, 0x75, 
+    0x6C, 0x65, 0x73, 0x2F, 0x46, 0x6C, 0x69, 0x67, 
+    0x68, 0x74, 0x50, 0x6C, 0x61, 0x6E, 0x2F, 0x6C, 
+    0x69, 0x62, 0x2F, 0x75, 0x61, 0x76, 0x6F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x2E, 0x70, 0x79, 0x00, 
+    0x04, 0x01, 0x00, 0x74, 0x00, 0x00, 0x7C, 0x00, 
+    0x00, 0x69, 0x01, 0x00, 0x7C, 0x01, 0x00, 0x83, 
+    0x02, 0x00, 0x01, 0x64, 0x00, 0x00, 0x53, 0x0B, 
+    0x01, 0x27, 0x00, 0x0B, 0x01, 0x28, 0x00, 0x65, 
+    0x00, 0x00, 0x5A, 0x01, 0x00, 0x64, 0x00, 0x00, 
+    0x84, 0x00, 0x00, 0x5A, 0x02, 0x00, 0x64, 0x01, 
+    0x00, 0x84, 0x00, 0x00, 0x5A, 0x03, 0x00, 0x64, 
+    0x02, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x04, 0x00, 
+    0x64, 0x03, 0x00, 0x84, 0x00, 0x00, 0x5A, 0x05, 
+    0x00, 0x52, 0x53, 0x00, 0x04, 0x00, 0x04, 0x00, 
+    0x04, 0x00, 0x64, 0x00, 0x00, 0x5A, 0x00, 0x00, 
+    0x64, 0x01, 0x00, 0x64, 0x02, 0x00, 0x6B, 0x01, 
+    0x00, 0x6C, 0x02, 0x00, 0x5A, 0x02, 0x00, 0x01, 
+    0x64, 0x03, 0x00, 0x64, 0x0A, 0x00, 0x64, 0x04, 
+    0x00, 0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 0x59, 
+    0x5A, 0x03, 0x00, 0x64, 0x05, 0x00, 0x64, 0x0B, 
+    0x00, 0x64, 0x06, 0x00, 0x84, 0x00, 0x00, 0x83, 
+    0x00, 0x00, 0x59, 0x5A, 0x04, 0x00, 0x64, 0x07, 
+    0x00, 0x64, 0x0C, 0x00, 0x64, 0x08, 0x00, 0x84, 
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x59, 0x5A, 0x05, 
+    0x00, 0x64, 0x09, 0x00, 0x53, 
+
+/* /root/repo/flight/tests/flightplan/testobject_native.py */
+    0x0A, 0x8A, 0x02, 0x00, 0x40, 0x02, 0x00, 0x2A, 
+    0x00, 0x04, 0x16, 0x03, 0x07, 0x00, 0x5F, 0x5F, 
+    0x64, 0x6F, 0x63, 0x5F, 0x5F, 0x03, 0x05, 0x00, 
+    0x4F, 0x42, 0x4A, 0x49, 0x44, 0x03, 0x0A, 0x00, 
+    0x50, 0x4F, 0x53, 0x49, 0x54, 0x49, 0x4F, 0x4E, 
+    0x5F, 0x58, 0x03, 0x0A, 0x00, 0x50, 0x4F, 0x53, 
+    0x49, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x59, 0x03, 
+    0x0A, 0x00, 0x50, 0x4F, 0x53, 0x49, 0x54, 0x49, 
+    0x4F, 0x4E, 0x5F, 0x5A, 0x03, 0x08, 0x00, 0x4D, 
+    0x4F, 0x44, 0x45, 0x5F, 0x4F, 0x46, 0x46, 0x03, 
+    0x07, 0x00, 0x4D, 0x4F, 0x44, 0x45, 0x5F, 0x4F, 
+    0x4E, 0x03, 0x09, 0x00, 0x4D, 0x4F, 0x44, 0x45, 
+    0x5F, 0x41, 0x55, 0x54, 0x4F, 0x03, 0x0B, 0x00, 
+    0x67, 0x65, 0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x03, 0x0B, 0x00, 0x73, 0x65, 
+    0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x03, 0x08, 0x00, 0x67, 0x65, 0x74, 0x43, 
+    0x6F, 0x75, 0x6E, 0x74, 0x03, 0x08, 0x00, 0x73, 
+    0x65, 0x74, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x03, 
+    0x09, 0x00, 0x67, 0x65, 0x74, 0x55, 0x70, 0x74, 
+    0x69, 0x6D, 0x65, 0x03, 0x09, 0x00, 0x73, 0x65, 
+    0x74, 0x55, 0x70, 0x74, 0x69, 0x6D, 0x65, 0x03, 
+    0x09, 0x00, 0x67, 0x65, 0x74, 0x50, 0x65, 0x72, 
+    0x69, 0x6F, 0x64, 0x03, 0x09, 0x00, 0x73, 0x65, 
+    0x74, 0x50, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x03, 
+    0x07, 0x00, 0x67, 0x65, 0x74, 0x54, 0x72, 0x69, 
+    0x6D, 0x03, 0x07, 0x00, 0x73, 0x65, 0x74, 0x54, 
+    0x72, 0x69, 0x6D, 0x03, 0x07, 0x00, 0x67, 0x65, 
+    0x74, 0x4D, 0x6F, 0x64, 0x65, 0x03, 0x07, 0x00, 
+    0x73, 0x65, 0x74, 0x4D, 0x6F, 0x64, 0x65, 0x03, 
+    0x05, 0x00, 0x77, 0x61, 0x74, 0x63, 0x68, 0x03, 
+    0x11, 0x00, 0x74, 0x65, 0x73, 0x74, 0x6F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x5F, 0x6E, 0x61, 0x74, 
+    0x69, 0x76, 0x65, 0x03, 0x28, 0x00, 0x06, 0x03, 
+    0x06, 0x02, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 
+    0x06, 0x01, 0x06, 0x01, 0x06, 0x03, 0x0C, 0x07, 
+    0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 
+    0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x07, 
+    0x0C, 0x07, 0x0C, 0x07, 0x0C, 0x08, 0x03, 0x38, 
+    0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 
+    0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 
+    0x68, 0x74, 0x2F, 0x74, 0x65, 0x73, 0x74, 0x73, 
+    0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x70, 
+    0x6C, 0x61, 0x6E, 0x2F, 0x74, 0x65, 0x73, 0x74, 
+    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x5F, 0x6E, 
+    0x61, 0x74, 0x69, 0x76, 0x65, 0x2E, 0x70, 0x79, 
+    0x00, 0x04, 0x13, 0x00, 0x01, 0xA8, 0xA7, 0x1F, 
+    0x0E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 
+    0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 
+    0x0B, 0x02, 0x29, 0x00, 0x0B, 0x03, 0x2A, 0x00, 
+    0x0B, 0x01, 0x2B, 0x00, 0x0B, 0x02, 0x2C, 0x00, 
+    0x0B, 0x01, 0x2D, 0x00, 0x0B, 0x02, 0x2E, 0x00, 
+    0x0B, 0x01, 0x2F, 0x00, 0x0B, 0x02, 0x30, 0x00, 
+    0x0B, 0x01, 0x31, 0x00, 0x0B, 0x02, 0x32, 0x00, 
+    0x0B, 0x01, 0x33, 0x00, 0x0B, 0x02, 0x34, 0x00, 
+    0x0B, 0x00, 0x35, 0x00, 0x00, 0x64, 0x00, 0x00, 
+    0x5A, 0x00, 0x00, 0x64, 0x01, 0x00, 0x5A, 0x01, 
+    0x00, 0x64, 0x02, 0x00, 0x5A, 0x02, 0x00, 0x64, 
+    0x03, 0x00, 0x5A, 0x03, 0x00, 0x64, 0x04, 0x00, 
+    0x5A, 0x04, 0x00, 0x64, 0x02, 0x00, 0x5A, 0x05, 
+    0x00, 0x64, 0x03, 0x00, 0x5A, 0x06, 0x00, 0x64, 
+    0x04, 0x00, 0x5A, 0x07, 0x00, 0x64, 0x02, 0x00, 
+    0x64, 0x05, 0x00, 0x84, 0x01, 0x00, 0x5A, 0x08, 
+    0x00, 0x64, 0x02, 0x00, 0x64, 0x06, 0x00, 0x84, 
+    0x01, 0x00, 0x5A, 0x09, 0x00, 0x64, 0x02, 0x00, 
+    0x64, 0x07, 0x00, 0x84, 0x01, 0x00, 0x5A, 0x0A, 
+    0x00, 0x64, 0x02, 0x00, 0x64, 0x08, 0x00, 0x84, 
+    0x01, 0x00, 0x5A, 0x0B, 0x00, 0x64, 0x02, 0x00, 
+    0x64, 0x09, 0x00, 0x84, 0x01, 0x00, 0x5A, 0x0C, 
+    0x00, 0x64, 0x02, 0x00, 0x64, 0x0A, 0x00, 0x84, 
+    0x01, 0x00, 0x5A, 0x0D, 0x00, 0x64, 0x02, 0x00, 
+    0x64, 0x0B, 0x00, 0x84, 0x01, 0x00, 0x5A, 0x0E, 
+    0x00, 0x64, 0x02, 0x00, 0x64, 0x0C, 0x00, 0x84, 
+    0x01, 0x00, 0x5A, 0x0F, 0x00, 0x64, 0x02, 0x00, 
+    0x64, 0x0D, 0x00, 0x84, 0x01, 0x00, 0x5A, 0x10, 
+    0x00, 0x64, 0x02, 0x00, 0x64, 0x0E, 0x00, 0x84, 
+    0x01, 0x00, 0x5A, 0x11, 0x00, 0x64, 0x02, 0x00, 
+    0x64, 0x0F, 0x00, 0x84, 0x01, 0x00, 0x5A, 0x12, 
+    0x00, 0x64, 0x02, 0x00, 0x64, 0x10, 0x00, 0x84, 
+    0x01, 0x00, 0x5A, 0x13, 0x00, 0x64, 0x11, 0x00, 
+    0x84, 0x00, 0x00, 0x5A, 0x14, 0x00, 0x64, 0x12, 
+    0x00, 0x53, 
+
+/* img-list-terminator */
+    0xFF, 
+};
@@ -0,0 +1,284 @@
+/**
+ * PyMite library image file.
+ *
+ * Automatically created from:
+ * 	/root/repo/flight/tests/flightplan/fp_badindex.py
+ *	/root/repo/flight/tests/flightplan/fp_badinstance.py
+ *	/root/repo/flight/tests/flightplan/fp_badtype.py
+ *	/root/repo/flight/tests/flightplan/fp_fields.py
+ *	/root/repo/flight/tests/flightplan/fp_readonly.py
+ *	/root/repo/flight/tests/flightplan/fp_wait.py
+ *	img-list-terminator
+ * by pmImgCreator.py on
+ * Mon Oct 19 04:27:02 2026.
+ * 
+ * Byte count: 1877
+ * 
+ * Selected memspace type: RAM
+ * 
+ * DO NOT EDIT THIS FILE.
+ * ANY CHANGES WILL BE LOST.
+ */
+
+/* Place the image into RAM */
+#ifdef __cplusplus
+extern
+#endif
+unsigned char const
+usrlib_img[] =
+{
+
+
+/* /root/repo/flight/tests/flightplan/fp_badindex.py */
+    0x0A, 0x9F, 0x00, 0x00, 0x40, 0x02, 0x00, 0x03, 
+    0x00, 0x04, 0x03, 0x03, 0x11, 0x00, 0x74, 0x65, 
+    0x73, 0x74, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x5F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x03, 
+    0x0B, 0x00, 0x67, 0x65, 0x74, 0x50, 0x6F, 0x73, 
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x03, 0x0B, 0x00, 
+    0x66, 0x70, 0x5F, 0x62, 0x61, 0x64, 0x69, 0x6E, 
+    0x64, 0x65, 0x78, 0x03, 0x02, 0x00, 0x0C, 0x02, 
+    0x03, 0x32, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 
+    0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 
+    0x69, 0x67, 0x68, 0x74, 0x2F, 0x74, 0x65, 0x73, 
+    0x74, 0x73, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x70, 0x6C, 0x61, 0x6E, 0x2F, 0x66, 0x70, 
+    0x5F, 0x62, 0x61, 0x64, 0x69, 0x6E, 0x64, 0x65, 
+    0x78, 0x2E, 0x70, 0x79, 0x00, 0x04, 0x03, 0x01, 
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x03, 0x00, 
+    0x00, 0x00, 0x64, 0x00, 0x00, 0x64, 0x01, 0x00, 
+    0x6B, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x65, 0x00, 
+    0x00, 0x69, 0x01, 0x00, 0x64, 0x02, 0x00, 0x83, 
+    0x01, 0x00, 0x01, 0x64, 0x01, 0x00, 0x53, 
+
+/* /root/repo/flight/tests/flightplan/fp_badinstance.py */
+    0x0A, 0xAA, 0x00, 0x00, 0x40, 0x03, 0x00, 0x03, 
+    0x00, 0x04, 0x03, 0x03, 0x11, 0x00, 0x74, 0x65, 
+    0x73, 0x74, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x5F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x03, 
+    0x08, 0x00, 0x73, 0x65, 0x74, 0x43, 0x6F, 0x75, 
+    0x6E, 0x74, 0x03, 0x0E, 0x00, 0x66, 0x70, 0x5F, 
+    0x62, 0x61, 0x64, 0x69, 0x6E, 0x73, 0x74, 0x61, 
+    0x6E, 0x63, 0x65, 0x03, 0x02, 0x00, 0x0C, 0x02, 
+    0x03, 0x35, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 
+    0x2F, 0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 
+    0x69, 0x67, 0x68, 0x74, 0x2F, 0x74, 0x65, 0x73, 
+    0x74, 0x73, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x70, 0x6C, 0x61, 0x6E, 0x2F, 0x66, 0x70, 
+    0x5F, 0x62, 0x61, 0x64, 0x69, 0x6E, 0x73, 0x74, 
+    0x61, 0x6E, 0x63, 0x65, 0x2E, 0x70, 0x79, 0x00, 
+    0x04, 0x04, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 
+    0x00, 0x00, 0x64, 0x00, 0x00, 0x64, 0x01, 0x00, 
+    0x6B, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x65, 0x00, 
+    0x00, 0x69, 0x01, 0x00, 0x64, 0x02, 0x00, 0x64, 
+    0x03, 0x00, 0x83, 0x02, 0x00, 0x01, 0x64, 0x01, 
+    0x00, 0x53, 
+
+/* /root/repo/flight/tests/flightplan/fp_badtype.py */
+    0x0A, 0x99, 0x00, 0x00, 0x40, 0x02, 0x00, 0x03, 
+    0x00, 0x04, 0x03, 0x03, 0x11, 0x00, 0x74, 0x65, 
+    0x73, 0x74, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x5F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x03, 
+    0x08, 0x00, 0x73, 0x65, 0x74, 0x43, 0x6F, 0x75, 
+    0x6E, 0x74, 0x03, 0x0A, 0x00, 0x66, 0x70, 0x5F, 
+    0x62, 0x61, 0x64, 0x74, 0x79, 0x70, 0x65, 0x03, 
+    0x02, 0x00, 0x0C, 0x02, 0x03, 0x31, 0x00, 0x2F, 
+    0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 0x70, 
+    0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 
+    0x2F, 0x74, 0x65, 0x73, 0x74, 0x73, 0x2F, 0x66, 
+    0x6C, 0x69, 0x67, 0x68, 0x74, 0x70, 0x6C, 0x61, 
+    0x6E, 0x2F, 0x66, 0x70, 0x5F, 0x62, 0x61, 0x64, 
+    0x74, 0x79, 0x70, 0x65, 0x2E, 0x70, 0x79, 0x00, 
+    0x04, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+    0x03, 0x01, 0x00, 0x31, 0x64, 0x00, 0x00, 0x64, 
+    0x01, 0x00, 0x6B, 0x00, 0x00, 0x5A, 0x00, 0x00, 
+    0x65, 0x00, 0x00, 0x69, 0x01, 0x00, 0x64, 0x02, 
+    0x00, 0x83, 0x01, 0x00, 0x01, 0x64, 0x01, 0x00, 
+    0x53, 
+
+/* /root/repo/flight/tests/flightplan/fp_fields.py */
+    0x0A, 0x19, 0x03, 0x00, 0x40, 0x03, 0x00, 0x04, 
+    0x00, 0x04, 0x12, 0x03, 0x11, 0x00, 0x74, 0x65, 
+    0x73, 0x74, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x5F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x03, 
+    0x0B, 0x00, 0x67, 0x65, 0x74, 0x50, 0x6F, 0x73, 
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x03, 0x0E, 0x00, 
+    0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6F, 
+    0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x03, 0x0A, 
+    0x00, 0x50, 0x4F, 0x53, 0x49, 0x54, 0x49, 0x4F, 
+    0x4E, 0x5F, 0x5A, 0x03, 0x08, 0x00, 0x67, 0x65, 
+    0x74, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x03, 0x09, 
+    0x00, 0x67, 0x65, 0x74, 0x55, 0x70, 0x74, 0x69, 
+    0x6D, 0x65, 0x03, 0x09, 0x00, 0x67, 0x65, 0x74, 
+    0x50, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x03, 0x07, 
+    0x00, 0x67, 0x65, 0x74, 0x54, 0x72, 0x69, 0x6D, 
+    0x03, 0x07, 0x00, 0x67, 0x65, 0x74, 0x4D, 0x6F, 
+    0x64, 0x65, 0x03, 0x07, 0x00, 0x4D, 0x4F, 0x44, 
+    0x45, 0x5F, 0x4F, 0x4E, 0x03, 0x0B, 0x00, 0x73, 
+    0x65, 0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x03, 0x0A, 0x00, 0x50, 0x4F, 0x53, 
+    0x49, 0x54, 0x49, 0x4F, 0x4E, 0x5F, 0x59, 0x03, 
+    0x08, 0x00, 0x73, 0x65, 0x74, 0x43, 0x6F, 0x75, 
+    0x6E, 0x74, 0x03, 0x09, 0x00, 0x73, 0x65, 0x74, 
+    0x50, 0x65, 0x72, 0x69, 0x6F, 0x64, 0x03, 0x07, 
+    0x00, 0x73, 0x65, 0x74, 0x54, 0x72, 0x69, 0x6D, 
+    0x03, 0x07, 0x00, 0x73, 0x65, 0x74, 0x4D, 0x6F, 
+    0x64, 0x65, 0x03, 0x09, 0x00, 0x4D, 0x4F, 0x44, 
+    0x45, 0x5F, 0x41, 0x55, 0x54, 0x4F, 0x03, 0x09, 
+    0x00, 0x66, 0x70, 0x5F, 0x66, 0x69, 0x65, 0x6C, 
+    0x64, 0x73, 0x03, 0x22, 0x00, 0x0C, 0x02, 0x1B, 
+    0x01, 0x1E, 0x01, 0x18, 0x01, 0x1B, 0x01, 0x18, 
+    0x01, 0x18, 0x01, 0x18, 0x01, 0x1B, 0x02, 0x13, 
+    0x01, 0x0D, 0x01, 0x10, 0x01, 0x0D, 0x01, 0x0D, 
+    0x01, 0x10, 0x02, 0x1B, 0x01, 0x18, 0x01, 0x03, 
+    0x30, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 
+    0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 
+    0x67, 0x68, 0x74, 0x2F, 0x74, 0x65, 0x73, 0x74, 
+    0x73, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 
+    0x70, 0x6C, 0x61, 0x6E, 0x2F, 0x66, 0x70, 0x5F, 
+    0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x2E, 0x70, 
+    0x79, 0x00, 0x04, 0x11, 0x01, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 
+    0x00, 0x00, 0xC0, 0x3F, 0x02, 0x00, 0x00, 0x50, 
+    0x40, 0x01, 0x28, 0x00, 0x00, 0x00, 0x01, 0x01, 
+    0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 
+    0x01, 0xA0, 0x86, 0x01, 0x00, 0x01, 0xF4, 0x01, 
+    0x00, 0x00, 0x01, 0xFD, 0xFF, 0xFF, 0xFF, 0x02, 
+    0x00, 0x00, 0x90, 0x40, 0x01, 0x29, 0x00, 0x00, 
+    0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 
+    0xC0, 0x7A, 0x43, 0x01, 0x9C, 0xFF, 0xFF, 0xFF, 
+    0x01, 0xFA, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 
+    0x64, 0x01, 0x00, 0x6B, 0x00, 0x00, 0x5A, 0x00, 
+    0x00, 0x65, 0x00, 0x00, 0x69, 0x01, 0x00, 0x64, 
+    0x02, 0x00, 0x83, 0x01, 0x00, 0x64, 0x03, 0x00, 
+    0x6A, 0x02, 0x00, 0x73, 0x27, 0x00, 0x74, 0x02, 
+    0x00, 0x82, 0x01, 0x00, 0x65, 0x00, 0x00, 0x69, 
+    0x01, 0x00, 0x65, 0x00, 0x00, 0x69, 0x03, 0x00, 
+    0x83, 0x01, 0x00, 0x64, 0x04, 0x00, 0x6A, 0x02, 
+    0x00, 0x73, 0x45, 0x00, 0x74, 0x02, 0x00, 0x82, 
+    0x01, 0x00, 0x65, 0x00, 0x00, 0x69, 0x04, 0x00, 
+    0x83, 0x00, 0x00, 0x64, 0x05, 0x00, 0x6A, 0x02, 
+    0x00, 0x73, 0x5D, 0x00, 0x74, 0x02, 0x00, 0x82, 
+    0x01, 0x00, 0x65, 0x00, 0x00, 0x69, 0x04, 0x00, 
+    0x64, 0x06, 0x00, 0x83, 0x01, 0x00, 0x64, 0x07, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0x78, 0x00, 0x74, 
+    0x02, 0x00, 0x82, 0x01, 0x00, 0x65, 0x00, 0x00, 
+    0x69, 0x05, 0x00, 0x83, 0x00, 0x00, 0x64, 0x08, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0x90, 0x00, 0x74, 
+    0x02, 0x00, 0x82, 0x01, 0x00, 0x65, 0x00, 0x00, 
+    0x69, 0x06, 0x00, 0x83, 0x00, 0x00, 0x64, 0x09, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0xA8, 0x00, 0x74, 
+    0x02, 0x00, 0x82, 0x01, 0x00, 0x65, 0x00, 0x00, 
+    0x69, 0x07, 0x00, 0x83, 0x00, 0x00, 0x64, 0x0A, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0xC0, 0x00, 0x74, 
+    0x02, 0x00, 0x82, 0x01, 0x00, 0x65, 0x00, 0x00, 
+    0x69, 0x08, 0x00, 0x83, 0x00, 0x00, 0x65, 0x00, 
+    0x00, 0x69, 0x09, 0x00, 0x6A, 0x02, 0x00, 0x73, 
+    0xDB, 0x00, 0x74, 0x02, 0x00, 0x82, 0x01, 0x00, 
+    0x65, 0x00, 0x00, 0x69, 0x0A, 0x00, 0x65, 0x00, 
+    0x00, 0x69, 0x0B, 0x00, 0x64, 0x0B, 0x00, 0x83, 
+    0x02, 0x00, 0x01, 0x65, 0x00, 0x00, 0x69, 0x0C, 
+    0x00, 0x64, 0x0C, 0x00, 0x83, 0x01, 0x00, 0x01, 
+    0x65, 0x00, 0x00, 0x69, 0x0C, 0x00, 0x64, 0x0D, 
+    0x00, 0x64, 0x06, 0x00, 0x83, 0x02, 0x00, 0x01, 
+    0x65, 0x00, 0x00, 0x69, 0x0D, 0x00, 0x64, 0x0E, 
+    0x00, 0x83, 0x01, 0x00, 0x01, 0x65, 0x00, 0x00, 
+    0x69, 0x0E, 0x00, 0x64, 0x0F, 0x00, 0x83, 0x01, 
+    0x00, 0x01, 0x65, 0x00, 0x00, 0x69, 0x0F, 0x00, 
+    0x65, 0x00, 0x00, 0x69, 0x10, 0x00, 0x83, 0x01, 
+    0x00, 0x01, 0x65, 0x00, 0x00, 0x69, 0x01, 0x00, 
+    0x64, 0x06, 0x00, 0x83, 0x01, 0x00, 0x64, 0x0B, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0x50, 0x01, 0x74, 
+    0x02, 0x00, 0x82, 0x01, 0x00, 0x65, 0x00, 0x00, 
+    0x69, 0x04, 0x00, 0x83, 0x00, 0x00, 0x64, 0x0C, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0x68, 0x01, 0x74, 
+    0x02, 0x00, 0x82, 0x01, 0x00, 0x65, 0x00, 0x00, 
+    0x69, 0x06, 0x00, 0x83, 0x00, 0x00, 0x64, 0x10, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0x80, 0x01, 0x74, 
+    0x02, 0x00, 0x82, 0x01, 0x00, 0x64, 0x01, 0x00, 
+    0x53, 
+
+/* /root/repo/flight/tests/flightplan/fp_readonly.py */
+    0x0A, 0x9C, 0x00, 0x00, 0x40, 0x02, 0x00, 0x03, 
+    0x00, 0x04, 0x03, 0x03, 0x11, 0x00, 0x74, 0x65, 
+    0x73, 0x74, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x5F, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x03, 
+    0x08, 0x00, 0x73, 0x65, 0x74, 0x43, 0x6F, 0x75, 
+    0x6E, 0x74, 0x03, 0x0B, 0x00, 0x66, 0x70, 0x5F, 
+    0x72, 0x65, 0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 
+    0x03, 0x02, 0x00, 0x0C, 0x02, 0x03, 0x32, 0x00, 
+    0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 0x72, 0x65, 
+    0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 
+    0x74, 0x2F, 0x74, 0x65, 0x73, 0x74, 0x73, 0x2F, 
+    0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 0x70, 0x6C, 
+    0x61, 0x6E, 0x2F, 0x66, 0x70, 0x5F, 0x72, 0x65, 
+    0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x2E, 0x70, 
+    0x79, 0x00, 0x04, 0x03, 0x01, 0xFF, 0xFF, 0xFF, 
+    0xFF, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x64, 
+    0x00, 0x00, 0x64, 0x01, 0x00, 0x6B, 0x00, 0x00, 
+    0x5A, 0x00, 0x00, 0x65, 0x00, 0x00, 0x69, 0x01, 
+    0x00, 0x64, 0x02, 0x00, 0x83, 0x01, 0x00, 0x01, 
+    0x64, 0x01, 0x00, 0x53, 
+
+/* /root/repo/flight/tests/flightplan/fp_wait.py */
+    0x0A, 0xBD, 0x01, 0x00, 0x40, 0x02, 0x00, 0x03, 
+    0x00, 0x04, 0x08, 0x03, 0x09, 0x00, 0x6F, 0x70, 
+    0x65, 0x6E, 0x70, 0x69, 0x6C, 0x6F, 0x74, 0x03, 
+    0x11, 0x00, 0x74, 0x65, 0x73, 0x74, 0x6F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x5F, 0x6E, 0x61, 0x74, 
+    0x69, 0x76, 0x65, 0x03, 0x05, 0x00, 0x77, 0x61, 
+    0x74, 0x63, 0x68, 0x03, 0x14, 0x00, 0x77, 0x61, 
+    0x69, 0x74, 0x46, 0x6F, 0x72, 0x4F, 0x62, 0x6A, 
+    0x65, 0x63, 0x74, 0x55, 0x70, 0x64, 0x61, 0x74, 
+    0x65, 0x73, 0x03, 0x0E, 0x00, 0x41, 0x73, 0x73, 
+    0x65, 0x72, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x72, 
+    0x72, 0x6F, 0x72, 0x03, 0x08, 0x00, 0x73, 0x65, 
+    0x74, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x03, 0x05, 
+    0x00, 0x4F, 0x42, 0x4A, 0x49, 0x44, 0x03, 0x07, 
+    0x00, 0x66, 0x70, 0x5F, 0x77, 0x61, 0x69, 0x74, 
+    0x03, 0x14, 0x00, 0x0C, 0x01, 0x0C, 0x02, 0x0A, 
+    0x01, 0x0A, 0x02, 0x1B, 0x01, 0x0D, 0x01, 0x1E, 
+    0x01, 0x1B, 0x03, 0x0D, 0x01, 0x1E, 0x01, 0x03, 
+    0x2E, 0x00, 0x2F, 0x72, 0x6F, 0x6F, 0x74, 0x2F, 
+    0x72, 0x65, 0x70, 0x6F, 0x2F, 0x66, 0x6C, 0x69, 
+    0x67, 0x68, 0x74, 0x2F, 0x74, 0x65, 0x73, 0x74, 
+    0x73, 0x2F, 0x66, 0x6C, 0x69, 0x67, 0x68, 0x74, 
+    0x70, 0x6C, 0x61, 0x6E, 0x2F, 0x66, 0x70, 0x5F, 
+    0x77, 0x61, 0x69, 0x74, 0x2E, 0x70, 0x79, 0x00, 
+    0x04, 0x08, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 
+    0x01, 0x14, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 
+    0xE8, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 
+    0x00, 0x02, 0x00, 0x00, 0x20, 0xC0, 0x64, 0x00, 
+    0x00, 0x64, 0x01, 0x00, 0x6B, 0x00, 0x00, 0x5A, 
+    0x00, 0x00, 0x64, 0x00, 0x00, 0x64, 0x01, 0x00, 
+    0x6B, 0x01, 0x00, 0x5A, 0x01, 0x00, 0x65, 0x01, 
+    0x00, 0x69, 0x02, 0x00, 0x83, 0x00, 0x00, 0x01, 
+    0x65, 0x01, 0x00, 0x69, 0x02, 0x00, 0x83, 0x00, 
+    0x00, 0x01, 0x65, 0x00, 0x00, 0x69, 0x03, 0x00, 
+    0x64, 0x02, 0x00, 0x83, 0x01, 0x00, 0x64, 0x03, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0x47, 0x00, 0x74, 
+    0x04, 0x00, 0x82, 0x01, 0x00, 0x65, 0x01, 0x00, 
+    0x69, 0x05, 0x00, 0x64, 0x04, 0x00, 0x83, 0x01, 
+    0x00, 0x01, 0x65, 0x00, 0x00, 0x69, 0x03, 0x00, 
+    0x64, 0x05, 0x00, 0x83, 0x01, 0x00, 0x65, 0x01, 
+    0x00, 0x69, 0x06, 0x00, 0x6A, 0x02, 0x00, 0x73, 
+    0x72, 0x00, 0x74, 0x04, 0x00, 0x82, 0x01, 0x00, 
+    0x65, 0x00, 0x00, 0x69, 0x03, 0x00, 0x64, 0x03, 
+    0x00, 0x83, 0x01, 0x00, 0x64, 0x03, 0x00, 0x6A, 
+    0x02, 0x00, 0x73, 0x8D, 0x00, 0x74, 0x04, 0x00, 
+    0x82, 0x01, 0x00, 0x65, 0x01, 0x00, 0x69, 0x05, 
+    0x00, 0x64, 0x06, 0x00, 0x83, 0x01, 0x00, 0x01, 
+    0x65, 0x00, 0x00, 0x69, 0x03, 0x00, 0x64, 0x07, 
+    0x00, 0x83, 0x01, 0x00, 0x65, 0x01, 0x00, 0x69, 
+    0x06, 0x00, 0x6A, 0x02, 0x00, 0x73, 0xB8, 0x00, 
+    0x74, 0x04, 0x00, 0x82, 0x01, 0x00, 0x65, 0x00, 
+    0x00, 0x69, 0x03, 0x00, 0x64, 0x00, 0x00, 0x83, 
+    0x01, 0x00, 0x64, 0x03, 0x00, 0x6A, 0x02, 0x00, 
+    0x73, 0xD3, 0x00, 0x74, 0x04, 0x00, 0x82, 0x01, 
+    0x00, 0x64, 0x01, 0x00, 0x53, 
+
+/* img-list-terminator */
+    0xFF, 
+};
@@ -0,0 +1,37 @@
+#undef __FILE_ID__
+#define __FILE_ID__ 0x0A
+/**
+ * PyMite usr native function file
+ *
+ * automatically created by pmImgCreator.py
+ * on Mon Oct 19 04:27:02 2026
+ *
+ * DO NOT EDIT THIS FILE.
+ * ANY CHANGES WILL BE LOST.
+ *
+ * @file    /root/repo/build/unit_tests/flightplan/pmlibusr_nat.c
+ */
+
+#define __IN_LIBNATIVE_C__
+#include "pm.h"
+
+PmReturn_t
+nat_placeholder_func(pPmFrame_t *ppframe)
+{
+
+    /*
+     * Use placeholder because an index 
+     * value of zero denotes the stdlib.
+     * This function should not be called.
+     */
+    PmReturn_t retval;
+    PM_RAISE(retval, PM_RET_EX_SYS);
+    return retval;
+
+}
+
+/* Native function lookup table */
+pPmNativeFxn_t const usr_nat_fxn_table[] =
+{
+    nat_placeholder_func,
+};
@@ -0,0 +1,220 @@
+/**
+ * PyMite library image file.
+ *
+ * Automatically created from:
+ * 	/root/repo/flight/tests/pymitebench/bench_call.py
+ *	/root/repo/flight/tests/pymitebench/bench_float.py
+ *	/root/repo/flight/tests/pymitebench/bench_int.py
+ *	/root/repo/flight/tests/pymitebench/bench_seq.py
+ *	img-list-terminator
+ * by pmImgCreator.py on
+ * Mon Oct 19 03:29:53 2026.
+ * 
+ * Byte count: 1424
+ * 
+ * Selected memspace type: RAM
+ * 
+ * DO NOT EDIT THIS FILE.
+ * ANY CHANGES WILL BE LOST.
+ */
+
+/* Place the image into RAM */
+#ifdef __cplusplus
+extern
+#endif
+unsigned char const
+usrlib_img[] =
+{
+
+
+/* /root/repo/flight/tests/pymitebench/bench_call.py */
+    0x0A, 0x5A, 0x01, 0x00, 0x40, 0x08, 0x00, 0x04, 
+    0x07, 0x03, 0x0A, 0x00, 0x49, 0x54, 0x45, 0x52, 
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x03, 0x05, 
+    0x00, 0x63, 0x6C, 0x61, 0x6D, 0x70, 0x03, 0x05, 
+    0x00, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x03, 0x01, 
+    0x00, 0x69, 0x03, 0x05, 0x00, 0x74, 0x6F, 0x74, 
+    0x61, 0x6C, 0x03, 0x0E, 0x00, 0x41, 0x73, 0x73, 
+    0x65, 0x72, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x72, 
+    0x72, 0x6F, 0x72, 0x03, 0x0A, 0x00, 0x62, 0x65, 
+    0x6E, 0x63, 0x68, 0x5F, 0x63, 0x61, 0x6C, 0x6C, 
+    0x04, 0x0F, 0x01, 0x88, 0x13, 0x00, 0x00, 0x0A, 
+    0x38, 0x00, 0x03, 0x43, 0x02, 0x03, 0x04, 0x01, 
+    0x03, 0x05, 0x00, 0x63, 0x6C, 0x61, 0x6D, 0x70, 
+    0x04, 0x01, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x01, 
+    0x00, 0x6A, 0x00, 0x00, 0x72, 0x10, 0x00, 0x7C, 
+    0x01, 0x00, 0x53, 0x7C, 0x00, 0x00, 0x7C, 0x02, 
+    0x00, 0x6A, 0x04, 0x00, 0x72, 0x20, 0x00, 0x7C, 
+    0x02, 0x00, 0x53, 0x7C, 0x00, 0x00, 0x53, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 
+    0x00, 0x01, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x0C, 
+    0x00, 0x00, 0x00, 0x01, 0x07, 0x00, 0x00, 0x00, 
+    0x01, 0xF7, 0xFF, 0xFF, 0xFF, 0x01, 0x0F, 0x00, 
+    0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 
+    0xF6, 0xFF, 0xFF, 0xFF, 0x01, 0x0A, 0x00, 0x00, 
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0xB6, 
+    0x35, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 0x5A, 
+    0x00, 0x00, 0x64, 0x01, 0x00, 0x84, 0x00, 0x00, 
+    0x5A, 0x01, 0x00, 0x64, 0x02, 0x00, 0x64, 0x03, 
+    0x00, 0x64, 0x04, 0x00, 0x64, 0x05, 0x00, 0x64, 
+    0x06, 0x00, 0x64, 0x07, 0x00, 0x64, 0x08, 0x00, 
+    0x64, 0x09, 0x00, 0x67, 0x08, 0x00, 0x5A, 0x02, 
+    0x00, 0x64, 0x02, 0x00, 0x5A, 0x03, 0x00, 0x64, 
+    0x02, 0x00, 0x5A, 0x04, 0x00, 0x78, 0x3C, 0x00, 
+    0x65, 0x03, 0x00, 0x65, 0x00, 0x00, 0x6A, 0x00, 
+    0x00, 0x72, 0x77, 0x00, 0x65, 0x04, 0x00, 0x65, 
+    0x01, 0x00, 0x65, 0x02, 0x00, 0x65, 0x03, 0x00, 
+    0x64, 0x06, 0x00, 0x40, 0x19, 0x64, 0x09, 0x00, 
+    0x14, 0x64, 0x0A, 0x00, 0x64, 0x0B, 0x00, 0x83, 
+    0x03, 0x00, 0x17, 0x5A, 0x04, 0x00, 0x65, 0x03, 
+    0x00, 0x64, 0x0C, 0x00, 0x37, 0x5A, 0x03, 0x00, 
+    0x71, 0x3C, 0x00, 0x57, 0x65, 0x04, 0x00, 0x64, 
+    0x0D, 0x00, 0x6A, 0x02, 0x00, 0x73, 0x8A, 0x00, 
+    0x74, 0x05, 0x00, 0x82, 0x01, 0x00, 0x64, 0x0E, 
+    0x00, 0x53, 
+
+/* /root/repo/flight/tests/pymitebench/bench_float.py */
+    0x0A, 0x90, 0x01, 0x00, 0x40, 0x03, 0x00, 0x04, 
+    0x0F, 0x03, 0x0A, 0x00, 0x49, 0x54, 0x45, 0x52, 
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x03, 0x02, 
+    0x00, 0x6B, 0x70, 0x03, 0x02, 0x00, 0x6B, 0x69, 
+    0x03, 0x02, 0x00, 0x6B, 0x64, 0x03, 0x02, 0x00, 
+    0x64, 0x74, 0x03, 0x08, 0x00, 0x73, 0x65, 0x74, 
+    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x03, 0x08, 0x00, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x03, 0x08, 0x00, 0x69, 0x6E, 0x74, 0x65, 0x67, 
+    0x72, 0x61, 0x6C, 0x03, 0x07, 0x00, 0x6C, 0x61, 
+    0x73, 0x74, 0x65, 0x72, 0x72, 0x03, 0x01, 0x00, 
+    0x69, 0x03, 0x03, 0x00, 0x65, 0x72, 0x72, 0x03, 
+    0x05, 0x00, 0x64, 0x65, 0x72, 0x69, 0x76, 0x03, 
+    0x03, 0x00, 0x6F, 0x75, 0x74, 0x03, 0x0E, 0x00, 
+    0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6F, 
+    0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x03, 0x0B, 
+    0x00, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x5F, 0x66, 
+    0x6C, 0x6F, 0x61, 0x74, 0x04, 0x0B, 0x01, 0x10, 
+    0x27, 0x00, 0x00, 0x02, 0xCD, 0xCC, 0x4C, 0x3F, 
+    0x02, 0xCD, 0xCC, 0x4C, 0x3D, 0x02, 0x0A, 0xD7, 
+    0x23, 0x3C, 0x02, 0x00, 0x00, 0x20, 0x41, 0x02, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x66, 
+    0x66, 0x1E, 0x41, 0x02, 0x9A, 0x99, 0x21, 0x41, 
+    0x00, 0x64, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x64, 
+    0x01, 0x00, 0x5A, 0x01, 0x00, 0x64, 0x02, 0x00, 
+    0x5A, 0x02, 0x00, 0x64, 0x03, 0x00, 0x5A, 0x03, 
+    0x00, 0x64, 0x03, 0x00, 0x5A, 0x04, 0x00, 0x64, 
+    0x04, 0x00, 0x5A, 0x05, 0x00, 0x64, 0x05, 0x00, 
+    0x5A, 0x06, 0x00, 0x64, 0x05, 0x00, 0x5A, 0x07, 
+    0x00, 0x64, 0x05, 0x00, 0x5A, 0x08, 0x00, 0x64, 
+    0x06, 0x00, 0x5A, 0x09, 0x00, 0x78, 0x6E, 0x00, 
+    0x65, 0x09, 0x00, 0x65, 0x00, 0x00, 0x6A, 0x00, 
+    0x00, 0x72, 0xAC, 0x00, 0x65, 0x05, 0x00, 0x65, 
+    0x06, 0x00, 0x18, 0x5A, 0x0A, 0x00, 0x65, 0x07, 
+    0x00, 0x65, 0x0A, 0x00, 0x65, 0x04, 0x00, 0x14, 
+    0x17, 0x5A, 0x07, 0x00, 0x65, 0x0A, 0x00, 0x65, 
+    0x08, 0x00, 0x18, 0x65, 0x04, 0x00, 0x15, 0x5A, 
+    0x0B, 0x00, 0x65, 0x01, 0x00, 0x65, 0x0A, 0x00, 
+    0x14, 0x65, 0x02, 0x00, 0x65, 0x07, 0x00, 0x14, 
+    0x17, 0x65, 0x03, 0x00, 0x65, 0x0B, 0x00, 0x14, 
+    0x17, 0x5A, 0x0C, 0x00, 0x65, 0x06, 0x00, 0x65, 
+    0x0C, 0x00, 0x65, 0x04, 0x00, 0x14, 0x17, 0x5A, 
+    0x06, 0x00, 0x65, 0x0A, 0x00, 0x5A, 0x08, 0x00, 
+    0x65, 0x09, 0x00, 0x64, 0x07, 0x00, 0x37, 0x5A, 
+    0x09, 0x00, 0x71, 0x3F, 0x00, 0x57, 0x65, 0x06, 
+    0x00, 0x64, 0x08, 0x00, 0x6A, 0x04, 0x00, 0x72, 
+    0xC5, 0x00, 0x65, 0x06, 0x00, 0x64, 0x09, 0x00, 
+    0x6A, 0x00, 0x00, 0x73, 0xCB, 0x00, 0x74, 0x0D, 
+    0x00, 0x82, 0x01, 0x00, 0x64, 0x0A, 0x00, 0x53, 
+
+/* /root/repo/flight/tests/pymitebench/bench_int.py */
+    0x0A, 0xE9, 0x00, 0x00, 0x40, 0x03, 0x00, 0x04, 
+    0x05, 0x03, 0x0A, 0x00, 0x49, 0x54, 0x45, 0x52, 
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x03, 0x01, 
+    0x00, 0x69, 0x03, 0x03, 0x00, 0x61, 0x63, 0x63, 
+    0x03, 0x0E, 0x00, 0x41, 0x73, 0x73, 0x65, 0x72, 
+    0x74, 0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 
+    0x72, 0x03, 0x09, 0x00, 0x62, 0x65, 0x6E, 0x63, 
+    0x68, 0x5F, 0x69, 0x6E, 0x74, 0x04, 0x0A, 0x01, 
+    0x20, 0x4E, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 
+    0x01, 0x07, 0x00, 0x00, 0x00, 0x01, 0x55, 0x00, 
+    0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 
+    0x4E, 0x09, 0x00, 0x00, 0x00, 0x64, 0x00, 0x00, 
+    0x5A, 0x00, 0x00, 0x64, 0x01, 0x00, 0x5A, 0x01, 
+    0x00, 0x64, 0x01, 0x00, 0x5A, 0x02, 0x00, 0x78, 
+    0x51, 0x00, 0x65, 0x01, 0x00, 0x65, 0x00, 0x00, 
+    0x6A, 0x00, 0x00, 0x72, 0x65, 0x00, 0x65, 0x02, 
+    0x00, 0x65, 0x01, 0x00, 0x64, 0x02, 0x00, 0x14, 
+    0x17, 0x65, 0x01, 0x00, 0x64, 0x03, 0x00, 0x3F, 
+    0x18, 0x64, 0x04, 0x00, 0x40, 0x5A, 0x02, 0x00, 
+    0x65, 0x02, 0x00, 0x64, 0x05, 0x00, 0x16, 0x64, 
+    0x01, 0x00, 0x6A, 0x02, 0x00, 0x72, 0x58, 0x00, 
+    0x65, 0x02, 0x00, 0x64, 0x06, 0x00, 0x41, 0x5A, 
+    0x02, 0x00, 0x6E, 0x00, 0x00, 0x65, 0x01, 0x00, 
+    0x64, 0x07, 0x00, 0x37, 0x5A, 0x01, 0x00, 0x71, 
+    0x15, 0x00, 0x57, 0x65, 0x02, 0x00, 0x64, 0x08, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0x78, 0x00, 0x74, 
+    0x03, 0x00, 0x82, 0x01, 0x00, 0x64, 0x09, 0x00, 
+    0x53, 
+
+/* /root/repo/flight/tests/pymitebench/bench_seq.py */
+    0x0A, 0xBC, 0x01, 0x00, 0x40, 0x05, 0x00, 0x04, 
+    0x0B, 0x03, 0x0A, 0x00, 0x49, 0x54, 0x45, 0x52, 
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x03, 0x09, 
+    0x00, 0x77, 0x61, 0x79, 0x70, 0x6F, 0x69, 0x6E, 
+    0x74, 0x73, 0x03, 0x06, 0x00, 0x73, 0x74, 0x61, 
+    0x74, 0x75, 0x73, 0x03, 0x01, 0x00, 0x69, 0x03, 
+    0x05, 0x00, 0x6E, 0x6F, 0x72, 0x74, 0x68, 0x03, 
+    0x04, 0x00, 0x65, 0x61, 0x73, 0x74, 0x03, 0x03, 
+    0x00, 0x61, 0x62, 0x73, 0x03, 0x01, 0x00, 0x64, 
+    0x03, 0x03, 0x00, 0x6C, 0x65, 0x6E, 0x03, 0x0E, 
+    0x00, 0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 
+    0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x03, 
+    0x09, 0x00, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x5F, 
+    0x73, 0x65, 0x71, 0x04, 0x0E, 0x01, 0xD0, 0x07, 
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0x64, 0x00, 0x00, 0x00, 0x03, 0x07, 0x00, 0x76, 
+    0x69, 0x73, 0x69, 0x74, 0x65, 0x64, 0x03, 0x08, 
+    0x00, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6E, 0x63, 
+    0x65, 0x01, 0x32, 0x00, 0x00, 0x00, 0x01, 0x01, 
+    0x00, 0x00, 0x00, 0x01, 0x04, 0x00, 0x00, 0x00, 
+    0x01, 0x90, 0x01, 0x00, 0x00, 0x00, 0x04, 0x02, 
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+    0x00, 0x00, 0x04, 0x02, 0x01, 0x64, 0x00, 0x00, 
+    0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x04, 0x02, 
+    0x01, 0x64, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 
+    0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0x64, 0x00, 0x00, 0x00, 0x64, 0x00, 
+    0x00, 0x5A, 0x00, 0x00, 0x64, 0x0A, 0x00, 0x64, 
+    0x0B, 0x00, 0x64, 0x0C, 0x00, 0x64, 0x0D, 0x00, 
+    0x67, 0x04, 0x00, 0x5A, 0x01, 0x00, 0x68, 0x02, 
+    0x00, 0x64, 0x01, 0x00, 0x64, 0x03, 0x00, 0x36, 
+    0x64, 0x01, 0x00, 0x64, 0x04, 0x00, 0x36, 0x5A, 
+    0x02, 0x00, 0x64, 0x01, 0x00, 0x5A, 0x03, 0x00, 
+    0x78, 0x79, 0x00, 0x65, 0x03, 0x00, 0x65, 0x00, 
+    0x00, 0x6A, 0x00, 0x00, 0x72, 0xAD, 0x00, 0x78, 
+    0x44, 0x00, 0x65, 0x01, 0x00, 0x44, 0x5D, 0x3C, 
+    0x00, 0x5C, 0x02, 0x00, 0x5A, 0x04, 0x00, 0x5A, 
+    0x05, 0x00, 0x65, 0x06, 0x00, 0x65, 0x04, 0x00, 
+    0x64, 0x05, 0x00, 0x18, 0x83, 0x01, 0x00, 0x65, 
+    0x06, 0x00, 0x65, 0x05, 0x00, 0x64, 0x05, 0x00, 
+    0x18, 0x83, 0x01, 0x00, 0x17, 0x5A, 0x07, 0x00, 
+    0x65, 0x02, 0x00, 0x64, 0x04, 0x00, 0x19, 0x65, 
+    0x07, 0x00, 0x17, 0x65, 0x02, 0x00, 0x64, 0x04, 
+    0x00, 0x3C, 0x71, 0x48, 0x00, 0x57, 0x65, 0x02, 
+    0x00, 0x64, 0x03, 0x00, 0x19, 0x65, 0x08, 0x00, 
+    0x65, 0x01, 0x00, 0x83, 0x01, 0x00, 0x17, 0x65, 
+    0x02, 0x00, 0x64, 0x03, 0x00, 0x3C, 0x65, 0x03, 
+    0x00, 0x64, 0x06, 0x00, 0x37, 0x5A, 0x03, 0x00, 
+    0x71, 0x35, 0x00, 0x57, 0x65, 0x02, 0x00, 0x64, 
+    0x03, 0x00, 0x19, 0x65, 0x00, 0x00, 0x64, 0x07, 
+    0x00, 0x14, 0x6A, 0x02, 0x00, 0x73, 0xC8, 0x00, 
+    0x74, 0x09, 0x00, 0x82, 0x01, 0x00, 0x65, 0x02, 
+    0x00, 0x64, 0x04, 0x00, 0x19, 0x65, 0x00, 0x00, 
+    0x64, 0x08, 0x00, 0x14, 0x6A, 0x02, 0x00, 0x73, 
+    0xE2, 0x00, 0x74, 0x09, 0x00, 0x82, 0x01, 0x00, 
+    0x64, 0x09, 0x00, 0x53, 
+
+/* img-list-terminator */
+    0xFF, 
+};
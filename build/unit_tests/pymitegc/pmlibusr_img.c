@@ -0,0 +1,217 @@
+/**
+ * PyMite library image file.
+ *
+ * Automatically created from:
+ * 	/root/repo/flight/tests/pymitegc/gc_dicts.py
+ *	/root/repo/flight/tests/pymitegc/gc_lists.py
+ *	/root/repo/flight/tests/pymitegc/gc_objects.py
+ *	/root/repo/flight/tests/pymitegc/gc_strings.py
+ *	img-list-terminator
+ * by pmImgCreator.py on
+ * Mon Oct 19 03:29:35 2026.
+ * 
+ * Byte count: 1413
+ * 
+ * Selected memspace type: RAM
+ * 
+ * DO NOT EDIT THIS FILE.
+ * ANY CHANGES WILL BE LOST.
+ */
+
+/* Place the image into RAM */
+#ifdef __cplusplus
+extern
+#endif
+unsigned char const
+usrlib_img[] =
+{
+
+
+/* /root/repo/flight/tests/pymitegc/gc_dicts.py */
+    0x0A, 0x57, 0x01, 0x00, 0x40, 0x05, 0x00, 0x04, 
+    0x08, 0x03, 0x0A, 0x00, 0x49, 0x54, 0x45, 0x52, 
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x03, 0x01, 
+    0x00, 0x64, 0x03, 0x01, 0x00, 0x69, 0x03, 0x03, 
+    0x00, 0x63, 0x68, 0x72, 0x03, 0x03, 0x00, 0x6B, 
+    0x65, 0x79, 0x03, 0x03, 0x00, 0x6C, 0x65, 0x6E, 
+    0x03, 0x0E, 0x00, 0x41, 0x73, 0x73, 0x65, 0x72, 
+    0x74, 0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 
+    0x72, 0x03, 0x08, 0x00, 0x67, 0x63, 0x5F, 0x64, 
+    0x69, 0x63, 0x74, 0x73, 0x04, 0x0E, 0x01, 0x2C, 
+    0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+    0x03, 0x01, 0x00, 0x6B, 0x01, 0x41, 0x00, 0x00, 
+    0x00, 0x01, 0x1A, 0x00, 0x00, 0x00, 0x01, 0x05, 
+    0x00, 0x00, 0x00, 0x01, 0x06, 0x00, 0x00, 0x00, 
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, 
+    0x00, 0x00, 0x03, 0x02, 0x00, 0x6B, 0x4D, 0x01, 
+    0x2A, 0x01, 0x00, 0x00, 0x03, 0x02, 0x00, 0x6B, 
+    0x4E, 0x01, 0x2B, 0x01, 0x00, 0x00, 0x00, 0x64, 
+    0x00, 0x00, 0x5A, 0x00, 0x00, 0x68, 0x00, 0x00, 
+    0x5A, 0x01, 0x00, 0x64, 0x01, 0x00, 0x5A, 0x02, 
+    0x00, 0x78, 0x71, 0x00, 0x65, 0x02, 0x00, 0x65, 
+    0x00, 0x00, 0x6A, 0x00, 0x00, 0x72, 0x85, 0x00, 
+    0x64, 0x02, 0x00, 0x65, 0x03, 0x00, 0x64, 0x03, 
+    0x00, 0x65, 0x02, 0x00, 0x64, 0x04, 0x00, 0x16, 
+    0x17, 0x83, 0x01, 0x00, 0x17, 0x5A, 0x04, 0x00, 
+    0x65, 0x02, 0x00, 0x65, 0x01, 0x00, 0x65, 0x04, 
+    0x00, 0x3C, 0x65, 0x02, 0x00, 0x64, 0x05, 0x00, 
+    0x16, 0x64, 0x01, 0x00, 0x6A, 0x02, 0x00, 0x72, 
+    0x5D, 0x00, 0x65, 0x01, 0x00, 0x65, 0x04, 0x00, 
+    0x3D, 0x6E, 0x00, 0x00, 0x65, 0x05, 0x00, 0x65, 
+    0x01, 0x00, 0x83, 0x01, 0x00, 0x64, 0x06, 0x00, 
+    0x6A, 0x04, 0x00, 0x72, 0x78, 0x00, 0x68, 0x00, 
+    0x00, 0x5A, 0x01, 0x00, 0x6E, 0x00, 0x00, 0x65, 
+    0x02, 0x00, 0x64, 0x07, 0x00, 0x37, 0x5A, 0x02, 
+    0x00, 0x71, 0x15, 0x00, 0x57, 0x65, 0x05, 0x00, 
+    0x65, 0x01, 0x00, 0x83, 0x01, 0x00, 0x64, 0x08, 
+    0x00, 0x6A, 0x02, 0x00, 0x73, 0x9E, 0x00, 0x74, 
+    0x06, 0x00, 0x82, 0x01, 0x00, 0x65, 0x01, 0x00, 
+    0x64, 0x09, 0x00, 0x19, 0x64, 0x0A, 0x00, 0x6A, 
+    0x02, 0x00, 0x72, 0xBE, 0x00, 0x65, 0x01, 0x00, 
+    0x64, 0x0B, 0x00, 0x19, 0x64, 0x0C, 0x00, 0x6A, 
+    0x02, 0x00, 0x73, 0xC4, 0x00, 0x74, 0x06, 0x00, 
+    0x82, 0x01, 0x00, 0x64, 0x0D, 0x00, 0x53, 
+
+/* /root/repo/flight/tests/pymitegc/gc_lists.py */
+    0x0A, 0x2D, 0x01, 0x00, 0x40, 0x04, 0x00, 0x04, 
+    0x08, 0x03, 0x0A, 0x00, 0x49, 0x54, 0x45, 0x52, 
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x03, 0x04, 
+    0x00, 0x4E, 0x6F, 0x6E, 0x65, 0x03, 0x04, 0x00, 
+    0x6B, 0x65, 0x65, 0x70, 0x03, 0x01, 0x00, 0x69, 
+    0x03, 0x04, 0x00, 0x69, 0x74, 0x65, 0x6D, 0x03, 
+    0x05, 0x00, 0x74, 0x6F, 0x74, 0x61, 0x6C, 0x03, 
+    0x0E, 0x00, 0x41, 0x73, 0x73, 0x65, 0x72, 0x74, 
+    0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 0x6F, 0x72, 
+    0x03, 0x08, 0x00, 0x67, 0x63, 0x5F, 0x6C, 0x69, 
+    0x73, 0x74, 0x73, 0x04, 0x08, 0x01, 0x90, 0x01, 
+    0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 
+    0xD0, 0x07, 0x00, 0x00, 0x01, 0x03, 0x00, 0x00, 
+    0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x01, 0x01, 
+    0x00, 0x00, 0x00, 0x01, 0x0B, 0x46, 0x18, 0x00, 
+    0x00, 0x64, 0x00, 0x00, 0x5A, 0x00, 0x00, 0x64, 
+    0x07, 0x00, 0x64, 0x07, 0x00, 0x67, 0x02, 0x00, 
+    0x5A, 0x02, 0x00, 0x64, 0x01, 0x00, 0x5A, 0x03, 
+    0x00, 0x78, 0x52, 0x00, 0x65, 0x03, 0x00, 0x65, 
+    0x00, 0x00, 0x6A, 0x00, 0x00, 0x72, 0x6C, 0x00, 
+    0x65, 0x03, 0x00, 0x65, 0x03, 0x00, 0x64, 0x02, 
+    0x00, 0x14, 0x67, 0x01, 0x00, 0x67, 0x02, 0x00, 
+    0x5A, 0x04, 0x00, 0x65, 0x03, 0x00, 0x64, 0x03, 
+    0x00, 0x16, 0x64, 0x01, 0x00, 0x6A, 0x02, 0x00, 
+    0x72, 0x5F, 0x00, 0x65, 0x04, 0x00, 0x65, 0x02, 
+    0x00, 0x65, 0x03, 0x00, 0x64, 0x03, 0x00, 0x15, 
+    0x64, 0x04, 0x00, 0x16, 0x3C, 0x6E, 0x00, 0x00, 
+    0x65, 0x03, 0x00, 0x64, 0x05, 0x00, 0x37, 0x5A, 
+    0x03, 0x00, 0x71, 0x1B, 0x00, 0x57, 0x64, 0x01, 
+    0x00, 0x5A, 0x05, 0x00, 0x78, 0x28, 0x00, 0x65, 
+    0x02, 0x00, 0x44, 0x5D, 0x20, 0x00, 0x5A, 0x04, 
+    0x00, 0x65, 0x05, 0x00, 0x65, 0x04, 0x00, 0x64, 
+    0x01, 0x00, 0x19, 0x17, 0x65, 0x04, 0x00, 0x64, 
+    0x05, 0x00, 0x19, 0x64, 0x01, 0x00, 0x19, 0x17, 
+    0x5A, 0x05, 0x00, 0x71, 0x7A, 0x00, 0x57, 0x65, 
+    0x05, 0x00, 0x64, 0x06, 0x00, 0x6A, 0x02, 0x00, 
+    0x73, 0xB0, 0x00, 0x74, 0x06, 0x00, 0x82, 0x01, 
+    0x00, 0x64, 0x07, 0x00, 0x53, 
+
+/* /root/repo/flight/tests/pymitegc/gc_objects.py */
+    0x0A, 0xC0, 0x01, 0x00, 0x40, 0x03, 0x00, 0x04, 
+    0x0C, 0x03, 0x0A, 0x00, 0x49, 0x54, 0x45, 0x52, 
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x03, 0x04, 
+    0x00, 0x4E, 0x6F, 0x64, 0x65, 0x03, 0x04, 0x00, 
+    0x4E, 0x6F, 0x6E, 0x65, 0x03, 0x04, 0x00, 0x68, 
+    0x65, 0x61, 0x64, 0x03, 0x06, 0x00, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x03, 0x01, 0x00, 0x69, 
+    0x03, 0x04, 0x00, 0x6E, 0x6F, 0x64, 0x65, 0x03, 
+    0x01, 0x00, 0x6E, 0x03, 0x03, 0x00, 0x6E, 0x78, 
+    0x74, 0x03, 0x05, 0x00, 0x74, 0x6F, 0x74, 0x61, 
+    0x6C, 0x03, 0x0E, 0x00, 0x41, 0x73, 0x73, 0x65, 
+    0x72, 0x74, 0x69, 0x6F, 0x6E, 0x45, 0x72, 0x72, 
+    0x6F, 0x72, 0x03, 0x0A, 0x00, 0x67, 0x63, 0x5F, 
+    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x73, 0x04, 
+    0x0A, 0x01, 0x2C, 0x01, 0x00, 0x00, 0x03, 0x04, 
+    0x00, 0x4E, 0x6F, 0x64, 0x65, 0x0A, 0x32, 0x00, 
+    0x00, 0x42, 0x01, 0x00, 0x04, 0x03, 0x03, 0x08, 
+    0x00, 0x5F, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x5F, 
+    0x5F, 0x03, 0x0A, 0x00, 0x5F, 0x5F, 0x6D, 0x6F, 
+    0x64, 0x75, 0x6C, 0x65, 0x5F, 0x5F, 0x03, 0x04, 
+    0x00, 0x4E, 0x6F, 0x64, 0x65, 0x04, 0x00, 0x65, 
+    0x00, 0x00, 0x5A, 0x01, 0x00, 0x52, 0x53, 0x01, 
+    0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x03, 0x00, 
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x02, 
+    0x00, 0x00, 0x00, 0x01, 0x08, 0x1C, 0x09, 0x00, 
+    0x00, 0x04, 0x00, 0x64, 0x00, 0x00, 0x5A, 0x00, 
+    0x00, 0x64, 0x01, 0x00, 0x64, 0x09, 0x00, 0x64, 
+    0x02, 0x00, 0x84, 0x00, 0x00, 0x83, 0x00, 0x00, 
+    0x59, 0x5A, 0x01, 0x00, 0x64, 0x08, 0x00, 0x5A, 
+    0x03, 0x00, 0x64, 0x03, 0x00, 0x5A, 0x04, 0x00, 
+    0x64, 0x03, 0x00, 0x5A, 0x05, 0x00, 0x78, 0x6A, 
+    0x00, 0x65, 0x05, 0x00, 0x65, 0x00, 0x00, 0x6A, 
+    0x00, 0x00, 0x72, 0x97, 0x00, 0x65, 0x01, 0x00, 
+    0x83, 0x00, 0x00, 0x5A, 0x06, 0x00, 0x65, 0x05, 
+    0x00, 0x64, 0x04, 0x00, 0x14, 0x65, 0x06, 0x00, 
+    0x5F, 0x07, 0x00, 0x65, 0x03, 0x00, 0x65, 0x06, 
+    0x00, 0x5F, 0x08, 0x00, 0x65, 0x06, 0x00, 0x5A, 
+    0x03, 0x00, 0x65, 0x04, 0x00, 0x64, 0x05, 0x00, 
+    0x37, 0x5A, 0x04, 0x00, 0x65, 0x04, 0x00, 0x64, 
+    0x06, 0x00, 0x6A, 0x04, 0x00, 0x72, 0x8A, 0x00, 
+    0x64, 0x08, 0x00, 0x65, 0x03, 0x00, 0x69, 0x08, 
+    0x00, 0x5F, 0x08, 0x00, 0x64, 0x06, 0x00, 0x5A, 
+    0x04, 0x00, 0x6E, 0x00, 0x00, 0x65, 0x05, 0x00, 
+    0x64, 0x05, 0x00, 0x37, 0x5A, 0x05, 0x00, 0x71, 
+    0x2E, 0x00, 0x57, 0x64, 0x03, 0x00, 0x5A, 0x09, 
+    0x00, 0x65, 0x03, 0x00, 0x5A, 0x06, 0x00, 0x78, 
+    0x26, 0x00, 0x65, 0x06, 0x00, 0x64, 0x08, 0x00, 
+    0x6A, 0x03, 0x00, 0x72, 0xCC, 0x00, 0x65, 0x09, 
+    0x00, 0x65, 0x06, 0x00, 0x69, 0x07, 0x00, 0x17, 
+    0x5A, 0x09, 0x00, 0x65, 0x06, 0x00, 0x69, 0x08, 
+    0x00, 0x5A, 0x06, 0x00, 0x71, 0xA7, 0x00, 0x57, 
+    0x65, 0x04, 0x00, 0x64, 0x06, 0x00, 0x6A, 0x02, 
+    0x00, 0x73, 0xDF, 0x00, 0x74, 0x0A, 0x00, 0x82, 
+    0x01, 0x00, 0x65, 0x09, 0x00, 0x64, 0x07, 0x00, 
+    0x6A, 0x02, 0x00, 0x73, 0xF1, 0x00, 0x74, 0x0A, 
+    0x00, 0x82, 0x01, 0x00, 0x64, 0x08, 0x00, 0x53, 
+
+/* /root/repo/flight/tests/pymitegc/gc_strings.py */
+    0x0A, 0x40, 0x01, 0x00, 0x40, 0x05, 0x00, 0x04, 
+    0x08, 0x03, 0x0A, 0x00, 0x49, 0x54, 0x45, 0x52, 
+    0x41, 0x54, 0x49, 0x4F, 0x4E, 0x53, 0x03, 0x04, 
+    0x00, 0x6B, 0x65, 0x65, 0x70, 0x03, 0x01, 0x00, 
+    0x69, 0x03, 0x03, 0x00, 0x63, 0x68, 0x72, 0x03, 
+    0x04, 0x00, 0x77, 0x6F, 0x72, 0x64, 0x03, 0x03, 
+    0x00, 0x6C, 0x65, 0x6E, 0x03, 0x0E, 0x00, 0x41, 
+    0x73, 0x73, 0x65, 0x72, 0x74, 0x69, 0x6F, 0x6E, 
+    0x45, 0x72, 0x72, 0x6F, 0x72, 0x03, 0x0A, 0x00, 
+    0x67, 0x63, 0x5F, 0x73, 0x74, 0x72, 0x69, 0x6E, 
+    0x67, 0x73, 0x04, 0x0B, 0x01, 0xC8, 0x00, 0x00, 
+    0x00, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 
+    0x00, 0x01, 0x61, 0x00, 0x00, 0x00, 0x01, 0x1A, 
+    0x00, 0x00, 0x00, 0x03, 0x01, 0x00, 0x2C, 0x01, 
+    0x03, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 
+    0x00, 0x01, 0x08, 0x00, 0x00, 0x00, 0x03, 0x08, 
+    0x00, 0x72, 0x68, 0x2C, 0x72, 0x68, 0x2C, 0x72, 
+    0x68, 0x00, 0x64, 0x00, 0x00, 0x5A, 0x00, 0x00, 
+    0x64, 0x01, 0x00, 0x64, 0x01, 0x00, 0x64, 0x01, 
+    0x00, 0x67, 0x03, 0x00, 0x5A, 0x01, 0x00, 0x64, 
+    0x02, 0x00, 0x5A, 0x02, 0x00, 0x78, 0x62, 0x00, 
+    0x65, 0x02, 0x00, 0x65, 0x00, 0x00, 0x6A, 0x00, 
+    0x00, 0x72, 0x7F, 0x00, 0x65, 0x03, 0x00, 0x64, 
+    0x03, 0x00, 0x65, 0x02, 0x00, 0x64, 0x04, 0x00, 
+    0x16, 0x17, 0x83, 0x01, 0x00, 0x65, 0x03, 0x00, 
+    0x64, 0x03, 0x00, 0x65, 0x02, 0x00, 0x64, 0x04, 
+    0x00, 0x15, 0x64, 0x04, 0x00, 0x16, 0x17, 0x83, 
+    0x01, 0x00, 0x17, 0x5A, 0x04, 0x00, 0x65, 0x04, 
+    0x00, 0x64, 0x05, 0x00, 0x17, 0x65, 0x04, 0x00, 
+    0x17, 0x64, 0x05, 0x00, 0x17, 0x65, 0x04, 0x00, 
+    0x17, 0x65, 0x01, 0x00, 0x65, 0x02, 0x00, 0x64, 
+    0x06, 0x00, 0x16, 0x3C, 0x65, 0x02, 0x00, 0x64, 
+    0x07, 0x00, 0x37, 0x5A, 0x02, 0x00, 0x71, 0x1E, 
+    0x00, 0x57, 0x65, 0x05, 0x00, 0x65, 0x01, 0x00, 
+    0x64, 0x02, 0x00, 0x19, 0x83, 0x01, 0x00, 0x64, 
+    0x08, 0x00, 0x6A, 0x02, 0x00, 0x73, 0x9C, 0x00, 
+    0x74, 0x06, 0x00, 0x82, 0x01, 0x00, 0x65, 0x01, 
+    0x00, 0x64, 0x07, 0x00, 0x19, 0x64, 0x09, 0x00, 
+    0x6A, 0x02, 0x00, 0x73, 0xB2, 0x00, 0x74, 0x06, 
+    0x00, 0x82, 0x01, 0x00, 0x64, 0x0A, 0x00, 0x53, 
+
+/* img-list-terminator */
+    0xFF, 
+};
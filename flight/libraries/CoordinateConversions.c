@@ -29,7 +29,10 @@
 
 #include <math.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <pios_math.h>
+#include <mathmisc.h>
+#include <fastmath.h>
 #include "CoordinateConversions.h"
 
 #define MIN_ALLOWABLE_MAGNITUDE 1e-30f
@@ -141,9 +144,9 @@ void Quaternion2RPY(const float q[4], float rpy[3])
     R23    = 2.0f * (q[2] * q[3] + q[0] * q[1]);
     R33    = q0s - q1s - q2s + q3s;
 
-    rpy[1] = RAD2DEG(asinf(-R13)); // pitch always between -pi/2 to pi/2
-    rpy[2] = RAD2DEG(atan2f(R12, R11));
-    rpy[0] = RAD2DEG(atan2f(R23, R33));
+    rpy[1] = RAD2DEG(fast_asinf(-R13, FASTMATH_HIGH)); // pitch always between -pi/2 to pi/2
+    rpy[2] = RAD2DEG(fast_atan2f(R12, R11, FASTMATH_HIGH));
+    rpy[0] = RAD2DEG(fast_atan2f(R23, R33, FASTMATH_HIGH));
 
     // TODO: consider the cases where |R13| ~= 1, |pitch| ~= pi/2
 }
@@ -157,12 +160,9 @@ void RPY2Quaternion(const float rpy[3], float q[4])
     phi    = DEG2RAD(rpy[0] / 2);
     theta  = DEG2RAD(rpy[1] / 2);
     psi    = DEG2RAD(rpy[2] / 2);
-    cphi   = cosf(phi);
-    sphi   = sinf(phi);
-    ctheta = cosf(theta);
-    stheta = sinf(theta);
-    cpsi   = cosf(psi);
-    spsi   = sinf(psi);
+    fast_sincosf(phi, &sphi, &cphi, FASTMATH_HIGH);
+    fast_sincosf(theta, &stheta, &ctheta, FASTMATH_HIGH);
+    fast_sincosf(psi, &spsi, &cpsi, FASTMATH_HIGH);
 
     q[0]   = cphi * ctheta * cpsi + sphi * stheta * spsi;
     q[1]   = sphi * ctheta * cpsi - cphi * stheta * spsi;
@@ -495,3 +495,110 @@ void rot_mult(float R[3][3], const float vec[3], float vec_out[3])
     vec_out[1] = R[1][0] * vec[0] + R[1][1] * vec[1] + R[1][2] * vec[2];
     vec_out[2] = R[2][0] * vec[0] + R[2][1] * vec[1] + R[2][2] * vec[2];
 }
+
+/**
+ * @brief Find Rbe and its transpose Reb from a quaternion, sharing the products
+ * @param[in] q unit quaternion
+ * @param[out] Rbe rotation from earth fixed to body frame, as Quaternion2R()
+ * @param[out] Reb rotation from body to earth fixed frame
+ */
+void Quaternion2RT(const float q[4], float Rbe[3][3], float Reb[3][3])
+{
+    const float q0s = q[0] * q[0], q1s = q[1] * q[1], q2s = q[2] * q[2], q3s = q[3] * q[3];
+    const float q1q2 = 2 * q[1] * q[2], q0q3 = 2 * q[0] * q[3];
+    const float q1q3 = 2 * q[1] * q[3], q0q2 = 2 * q[0] * q[2];
+    const float q2q3 = 2 * q[2] * q[3], q0q1 = 2 * q[0] * q[1];
+
+    Rbe[0][0] = Reb[0][0] = q0s + q1s - q2s - q3s;
+    Rbe[1][1] = Reb[1][1] = q0s - q1s + q2s - q3s;
+    Rbe[2][2] = Reb[2][2] = q0s - q1s - q2s + q3s;
+    Rbe[0][1] = Reb[1][0] = q1q2 + q0q3;
+    Rbe[1][0] = Reb[0][1] = q1q2 - q0q3;
+    Rbe[0][2] = Reb[2][0] = q1q3 - q0q2;
+    Rbe[2][0] = Reb[0][2] = q1q3 + q0q2;
+    Rbe[1][2] = Reb[2][1] = q2q3 + q0q1;
+    Rbe[2][1] = Reb[1][2] = q2q3 - q0q1;
+}
+
+/**
+ * @brief Rotate a vector from earth fixed to body frame, same as rot_mult()
+ * with the Rbe from Quaternion2R() but without building the matrix
+ * @param[in] q unit quaternion
+ * @param[in] vec the vector in earth fixed frame
+ * @param[out] vec_out the vector in body frame
+ */
+void quat_rotate_vector(const float q[4], const float vec[3], float vec_out[3])
+{
+    // t = 2 * (qv x vec), vec_out = vec - q0 * t + qv x t
+    const float t0 = 2 * (q[2] * vec[2] - q[3] * vec[1]);
+    const float t1 = 2 * (q[3] * vec[0] - q[1] * vec[2]);
+    const float t2 = 2 * (q[1] * vec[1] - q[2] * vec[0]);
+
+    vec_out[0] = vec[0] - q[0] * t0 + q[2] * t2 - q[3] * t1;
+    vec_out[1] = vec[1] - q[0] * t1 + q[3] * t0 - q[1] * t2;
+    vec_out[2] = vec[2] - q[0] * t2 + q[1] * t1 - q[2] * t0;
+}
+
+/**
+ * @brief Rotate a vector from body to earth fixed frame, the inverse of
+ * quat_rotate_vector()
+ * @param[in] q unit quaternion
+ * @param[in] vec the vector in body frame
+ * @param[out] vec_out the vector in earth fixed frame
+ */
+void quat_rotate_vector_transpose(const float q[4], const float vec[3], float vec_out[3])
+{
+    // t = 2 * (qv x vec), vec_out = vec + q0 * t + qv x t
+    const float t0 = 2 * (q[2] * vec[2] - q[3] * vec[1]);
+    const float t1 = 2 * (q[3] * vec[0] - q[1] * vec[2]);
+    const float t2 = 2 * (q[1] * vec[1] - q[2] * vec[0]);
+
+    vec_out[0] = vec[0] + q[0] * t0 + q[2] * t2 - q[3] * t1;
+    vec_out[1] = vec[1] + q[0] * t1 + q[3] * t0 - q[1] * t2;
+    vec_out[2] = vec[2] + q[0] * t2 + q[1] * t1 - q[2] * t0;
+}
+
+/**
+ * @brief Take a time step of the attitude quaternion with the body rates and
+ * renormalize it, keeping q[0] positive
+ * @param[in][out] q the attitude quaternion
+ * @param[in] gyro body rates in deg/s
+ * @param[in] dT time step in s
+ * @return false if the quaternion has become too short or nan, it is left
+ * unnormalized then
+ */
+bool quat_integrate_normalize(float q[4], const float gyro[3], float dT)
+{
+    // Time derivative from INSAlgo writeup, gyros are in deg/s
+    const float k  = dT * (M_PI_F / 180.0f / 2.0f);
+    const float g0 = gyro[0] * k, g1 = gyro[1] * k, g2 = gyro[2] * k;
+
+    const float q0 = q[0] - q[1] * g0 - q[2] * g1 - q[3] * g2;
+    const float q1 = q[1] + q[0] * g0 - q[3] * g1 + q[2] * g2;
+    const float q2 = q[2] + q[3] * g0 + q[0] * g1 - q[1] * g2;
+    const float q3 = q[3] - q[2] * g0 + q[1] * g1 + q[0] * g2;
+
+    const float qmag2 = q0 * q0 + q1 * q1 + q2 * q2 + q3 * q3;
+
+    if (!(qmag2 >= 1.0e-6f) || isinf(qmag2)) {
+        q[0] = q0;
+        q[1] = q1;
+        q[2] = q2;
+        q[3] = q3;
+        return false;
+    }
+
+    // As good as 1 / sqrtf() in float, without a divide or a square root
+    float inv_qmag = fast_rsqrtf(qmag2, FASTMATH_HIGH);
+
+    // q0 always positive for uniqueness
+    if (q0 < 0.0f) {
+        inv_qmag = -inv_qmag;
+    }
+
+    q[0] = q0 * inv_qmag;
+    q[1] = q1 * inv_qmag;
+    q[2] = q2 * inv_qmag;
+    q[3] = q3 * inv_qmag;
+    return true;
+}
@@ -84,6 +84,65 @@ def gc():
     pass
 
 
+#
+# Returns the pause statistics of the incremental Garbage Collector as a tuple
+# (cycles, steps, most work in a step, full runs, most work in a full run),
+# or None if it is not built in
+#
+def gcstats():
+    """__NATIVE__
+    PmReturn_t retval = PM_RET_OK;
+#ifdef HAVE_GC_INCREMENTAL
+    PmGcStats_t stats;
+    int32_t vals[5];
+    pPmObj_t ptup;
+    pPmObj_t pint;
+    uint8_t objid;
+    uint8_t i;
+#endif
+
+    /* If wrong number of args, raise TypeError */
+    if (NATIVE_GET_NUM_ARGS() != 0)
+    {
+        PM_RAISE(retval, PM_RET_EX_TYPE);
+        return retval;
+    }
+
+#ifdef HAVE_GC_INCREMENTAL
+    heap_gcGetStats(&stats);
+    vals[0] = stats.cycles;
+    vals[1] = stats.steps;
+    vals[2] = stats.maxStepWork;
+    vals[3] = stats.fullRuns;
+    vals[4] = stats.maxFullWork;
+
+    /* Allocate a tuple to store the return values */
+    retval = tuple_new(5, &ptup);
+    PM_RETURN_IF_ERROR(retval);
+
+    heap_gcPushTempRoot(ptup, &objid);
+    for (i = 0; i < 5; i++)
+    {
+        retval = int_new(vals[i], &pint);
+        if (retval != PM_RET_OK)
+        {
+            break;
+        }
+        ((pPmTuple_t)ptup)->val[i] = pint;
+    }
+    heap_gcPopTempRoot(objid);
+    PM_RETURN_IF_ERROR(retval);
+
+    NATIVE_SET_TOS(ptup);
+#else
+    NATIVE_SET_TOS(PM_NONE);
+#endif
+
+    return retval;
+    """
+    pass
+
+
 #
 # Gets a byte from the platform's default I/O
 # Returns the byte in the LSB of the returned integer
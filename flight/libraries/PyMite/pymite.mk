@@ -16,6 +16,13 @@ PYMITEINC	+= $(OUTDIR)
 FLIGHTPLANLIB	?= $(OPMODULEDIR)/FlightPlan/lib
 FLIGHTPLANS	?= $(OPMODULEDIR)/FlightPlan/flightplans
 
+# Generated UAVObject modules the flight plans import, the object class and
+# its native field accessors (made by the python target of the uavobjgenerator)
+FLIGHTPLANUAVOS	?= flightplanstatus mixersettings
+FLIGHTPLANUAVODIR ?= $(OPUAVSYNTHDIR)/../python
+PYUAVOS		:= $(addprefix $(FLIGHTPLANUAVODIR)/, $(addsuffix .py, $(FLIGHTPLANUAVOS)))
+PYUAVOS		+= $(addprefix $(FLIGHTPLANUAVODIR)/, $(addsuffix _native.py, $(FLIGHTPLANUAVOS)))
+
 # Extra modules
 PYMODULES	?= FlightPlan
 
@@ -35,6 +42,7 @@ PYSCRIPTS	+= $(wildcard $(PYMITELIB)/*.py)
 PYSCRIPTS	+= $(wildcard $(PYMITEPLAT)/*.py)
 PYSCRIPTS	+= $(wildcard $(FLIGHTPLANLIB)/*.py)
 PYSCRIPTS	+= $(wildcard $(FLIGHTPLANS)/*.py)
+PYSCRIPTS	+= $(PYUAVOS)
 
 # Generate code for PyMite
 $(PYSRC): | $(PYLIB) $(OUTDIR)/pmfeatures.h
@@ -56,7 +64,8 @@ $(OUTDIR)/pmlib_nat.c: $(PYSCRIPTS)
 			$(PYMITELIB)/__bi.py \
 			$(PYMITELIB)/sys.py \
 			$(PYMITELIB)/string.py \
-			$(wildcard $(FLIGHTPLANLIB)/*.py)
+			$(wildcard $(FLIGHTPLANLIB)/*.py) \
+			$(PYUAVOS)
 
 $(OUTDIR)/pmlibusr_img.c: | $(OUTDIR)/pmlibusr_nat.c
 
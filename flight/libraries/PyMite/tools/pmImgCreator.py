@@ -158,8 +158,27 @@ UNIMPLEMENTED_BCODES = [
     "BUILD_SLICE",
     "CALL_FUNCTION_VAR", "CALL_FUNCTION_KW", "CALL_FUNCTION_VAR_KW",
     "EXTENDED_ARG",
+    "BUILD_SET", "SET_ADD", "MAP_ADD",
+    "SETUP_WITH",
     ]
 
+# Python 2.7 renumbered a few bytecodes and replaced the relative conditional
+# jumps with absolute ones.  The VM keeps the Python 2.6 numbering, so images
+# made on a 2.7 host are translated by mnemonic to the VM's bytecode value.
+# The absolute jumps live in bytecodes that are unused in Python 2.6, as does
+# the Python 2.7 LIST_APPEND, which takes the depth of the list as argument.
+PY27_BCODE_TO_VM = {
+    "BUILD_MAP": 104,
+    "LOAD_ATTR": 105,
+    "COMPARE_OP": 106,
+    "IMPORT_NAME": 107,
+    "IMPORT_FROM": 108,
+    "JUMP_IF_FALSE_OR_POP": 109,
+    "POP_JUMP_IF_FALSE": 114,
+    "POP_JUMP_IF_TRUE": 115,
+    "JUMP_IF_TRUE_OR_POP": 117,
+    }
+
 
 ################################################################
 # CLASS
@@ -262,6 +281,12 @@ class PmImgCreator:
         # set class variables
         self.bcodes = bcodes
 
+        # host bcode to VM bcode conversion (identity on a Python 2.6 host)
+        self.vmbcodes = range(256)
+        if "POP_JUMP_IF_FALSE" in dis.opmap:
+            for bcname, vmbc in PY27_BCODE_TO_VM.items():
+                self.vmbcodes[dis.opmap[bcname]] = vmbc
+
         # function renames
         self._U8_to_str = chr
         self._str_to_U8 = ord
@@ -632,7 +657,7 @@ class PmImgCreator:
 
             #if simple bcode, copy one byte
             if c < dis.HAVE_ARGUMENT:
-                code += s[i]
+                code += chr(self.vmbcodes[c])
                 i += 1
 
             #else copy three bytes
@@ -650,7 +675,7 @@ class PmImgCreator:
                             (c, hex(c), dis.opname[c], i, co.co_filename))
 
                 # Otherwise, copy the code (3 bytes)
-                code += s[i:i+3]
+                code += chr(self.vmbcodes[c]) + s[i+1:i+3]
                 i += 3
 
         # if the first const is a String,
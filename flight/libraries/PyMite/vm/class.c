@@ -79,6 +79,9 @@ class_instantiate(pPmObj_t pclass, pPmObj_t *r_pobj)
     /* Set the instance's class */
     ((pPmInstance_t)pobj)->cli_class = (pPmClass_t)pclass;
 
+    /* Set to null in case a GC occurs before the dict is alloc'd */
+    ((pPmInstance_t)pobj)->cli_attrs = C_NULL;
+
     /* Create the attributes dict */
     heap_gcPushTempRoot(pobj, &objid);
     retval = dict_new(&pattrs);
@@ -111,6 +114,9 @@ class_method(pPmObj_t pinstance, pPmObj_t pfunc, pPmObj_t *r_pmeth)
     pmeth->m_instance = (pPmInstance_t)pinstance;
     pmeth->m_func = (pPmFunc_t)pfunc;
 
+    /* Set to null in case a GC occurs before the dict is alloc'd */
+    pmeth->m_attrs = C_NULL;
+
     /* Create the attributes dict */
     heap_gcPushTempRoot((pPmObj_t)pmeth, &objid);
     retval = dict_new(&pattrs);
@@ -49,6 +49,7 @@ func_new(pPmObj_t pco, pPmObj_t pglobals, pPmObj_t *r_pfunc)
     /* Init func */
     OBJ_SET_TYPE(pfunc, OBJ_TYPE_FXN);
     pfunc->f_co = (pPmCo_t)pco;
+    pfunc->f_attrs = C_NULL;
     pfunc->f_globals = C_NULL;
 
 #ifdef HAVE_DEFAULTARGS
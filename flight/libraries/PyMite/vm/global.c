@@ -45,6 +45,7 @@ global_init(void)
     uint8_t *codestr = (uint8_t *)"code";
     uint8_t *pchunk;
     pPmObj_t pobj;
+    int16_t i;
 #ifdef HAVE_CLASSES
     uint8_t const *initstr = (uint8_t const *)"__init__"; 
 #endif /* HAVE_CLASSES */
@@ -65,29 +66,17 @@ global_init(void)
     /* Set the PyMite release num (for debug and post mortem) */
     gVmGlobal.errVmRelease = PM_RELEASE;
 
-    /* Init zero */
-    retval = heap_getChunk(sizeof(PmInt_t), &pchunk);
-    PM_RETURN_IF_ERROR(retval);
-    pobj = (pPmObj_t)pchunk;
-    OBJ_SET_TYPE(pobj, OBJ_TYPE_INT);
-    ((pPmInt_t)pobj)->val = (int32_t)0;
-    gVmGlobal.pzero = (pPmInt_t)pobj;
-
-    /* Init one */
-    retval = heap_getChunk(sizeof(PmInt_t), &pchunk);
-    PM_RETURN_IF_ERROR(retval);
-    pobj = (pPmObj_t)pchunk;
-    OBJ_SET_TYPE(pobj, OBJ_TYPE_INT);
-    ((pPmInt_t)pobj)->val = (int32_t)1;
-    gVmGlobal.pone = (pPmInt_t)pobj;
-
-    /* Init negone */
-    retval = heap_getChunk(sizeof(PmInt_t), &pchunk);
-    PM_RETURN_IF_ERROR(retval);
-    pobj = (pPmObj_t)pchunk;
-    OBJ_SET_TYPE(pobj, OBJ_TYPE_INT);
-    ((pPmInt_t)pobj)->val = (int32_t)-1;
-    gVmGlobal.pnegone = (pPmInt_t)pobj;
+    /* Init the small int cache; zero, one and negone are part of it */
+    for (i = 0; i < PM_INT_CACHE_SIZE; i++)
+    {
+        pobj = (pPmObj_t)&gVmGlobal.intCache[i];
+        OBJ_SET_TYPE(pobj, OBJ_TYPE_INT);
+        OBJ_SET_SIZE(pobj, sizeof(PmInt_t));
+        ((pPmInt_t)pobj)->val = (int32_t)(i + PM_INT_CACHE_MIN);
+    }
+    gVmGlobal.pzero = (pPmInt_t)&gVmGlobal.intCache[0 - PM_INT_CACHE_MIN];
+    gVmGlobal.pone = (pPmInt_t)&gVmGlobal.intCache[1 - PM_INT_CACHE_MIN];
+    gVmGlobal.pnegone = (pPmInt_t)&gVmGlobal.intCache[-1 - PM_INT_CACHE_MIN];
 
     /* Init False */
     retval = heap_getChunk(sizeof(PmBoolean_t), &pchunk);
@@ -216,6 +205,7 @@ global_loadBuiltins(void)
     pPmObj_t pstr = C_NULL;
     pPmObj_t pbimod;
     uint8_t const *pbistr = bistr;
+    uint8_t objid;
 
     /* Import the builtins */
     retval = string_new(&pbistr, &pstr);
@@ -223,35 +213,48 @@ global_loadBuiltins(void)
     retval = mod_import(pstr, &pbimod);
     PM_RETURN_IF_ERROR(retval);
 
+    /*
+     * Nothing refers to the module once its thread has ended, keep it from
+     * being collected (and reused) before it is deallocated below.
+     */
+    heap_gcPushTempRoot(pbimod, &objid);
+
     /* Must interpret builtins' root code to set the attrs */
     C_ASSERT(gVmGlobal.threadList->length == 0);
     interp_addThread((pPmFunc_t)pbimod);
     retval = interpret(INTERP_RETURN_ON_NO_THREADS);
+    heap_gcPopTempRoot(objid);
     PM_RETURN_IF_ERROR(retval);
 
     /* Builtins points to the builtins module's attrs dict */
     gVmGlobal.builtins = ((pPmFunc_t)pbimod)->f_attrs;
 
+    /* Deallocate builtins module before anything else is allocated */
+    retval = heap_freeChunk((pPmObj_t)pbimod);
+    PM_RETURN_IF_ERROR(retval);
+
     /* Set None manually */
     retval = string_new(&nonestr, &pkey);
     PM_RETURN_IF_ERROR(retval);
+    heap_gcPushTempRoot(pkey, &objid);
     retval = dict_setItem(PM_PBUILTINS, pkey, PM_NONE);
+    heap_gcPopTempRoot(objid);
     PM_RETURN_IF_ERROR(retval);
 
     /* Set False manually */
     retval = string_new(&falsestr, &pkey);
     PM_RETURN_IF_ERROR(retval);
+    heap_gcPushTempRoot(pkey, &objid);
     retval = dict_setItem(PM_PBUILTINS, pkey, PM_FALSE);
+    heap_gcPopTempRoot(objid);
     PM_RETURN_IF_ERROR(retval);
 
     /* Set True manually */
     retval = string_new(&truestr, &pkey);
     PM_RETURN_IF_ERROR(retval);
+    heap_gcPushTempRoot(pkey, &objid);
     retval = dict_setItem(PM_PBUILTINS, pkey, PM_TRUE);
-    PM_RETURN_IF_ERROR(retval);
-
-    /* Deallocate builtins module */
-    retval = heap_freeChunk((pPmObj_t)pbimod);
+    heap_gcPopTempRoot(objid);
 
     return retval;
 }
@@ -153,6 +153,9 @@ typedef struct PmVmGlobal_s
 
     /** Flag to trigger rescheduling */
     uint8_t reschedule;
+
+    /** Small int cache, static so it won't be GC'd */
+    PmInt_t intCache[PM_INT_CACHE_SIZE];
 } PmVmGlobal_t,
  *pPmVmGlobal_t;
 
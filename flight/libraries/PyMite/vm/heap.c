@@ -37,6 +37,10 @@
 #error PM_HEAP_SIZE is not a multiple of four
 #endif
 
+#if defined(HAVE_GC_INCREMENTAL) && !defined(HAVE_GC)
+#error HAVE_GC_INCREMENTAL requires HAVE_GC
+#endif
+
 
 /** The size of the temporary roots stack */
 #define HEAP_NUM_TEMP_ROOTS 24
@@ -61,6 +65,43 @@
 #define HEAP_MIN_CHUNK_SIZE ((sizeof(PmHeapDesc_t) + 3) & ~3)
 
 
+#ifdef HAVE_GC_INCREMENTAL
+/**
+ * The size of the stack of objects marked but not yet scanned.
+ * When it is full, objects are scanned as they are marked (recursively).
+ */
+#define HEAP_GC_GRAY_SIZE 32
+
+/**
+ * The most work one incremental step does, in objects scanned plus
+ * references followed plus chunks swept.  A step may go over by the
+ * references of the last object it scans.
+ */
+#ifndef PM_GC_STEP_WORK
+#define PM_GC_STEP_WORK 64
+#endif
+
+/** An incremental cycle starts when fewer bytes than this are available */
+#ifndef PM_GC_START_THRESHOLD
+#define PM_GC_START_THRESHOLD (PM_HEAP_SIZE / 4)
+#endif
+
+/** Work budget of a cycle finished in one go */
+#define HEAP_GC_NO_LIMIT 0xFFFFFFFF
+
+/* Phases of an incremental cycle */
+#define HEAP_GC_IDLE  0
+#define HEAP_GC_MARK  1
+#define HEAP_GC_PURGE 2
+#define HEAP_GC_SWEEP 3
+
+/** Adds to the work done by the collector */
+#define HEAP_GC_WORK(n) (pmHeap.work += (n))
+#else
+#define HEAP_GC_WORK(n)
+#endif /* HAVE_GC_INCREMENTAL */
+
+
 /**
  * Gets the GC's mark bit for the object.
  * This MUST NOT be called on objects that are free.
@@ -150,6 +191,34 @@ typedef struct PmHeap_s
     pPmObj_t temp_roots[HEAP_NUM_TEMP_ROOTS];
 
     uint8_t temp_root_index;
+
+#ifdef HAVE_GC_INCREMENTAL
+    /** Phase of the incremental cycle, HEAP_GC_IDLE between cycles */
+    uint8_t gcphase;
+
+    /** Number of objects on the gray stack */
+    uint8_t gray_index;
+
+    /** Stack of objects marked but whose references are not yet marked */
+    pPmObj_t gray[HEAP_GC_GRAY_SIZE];
+
+#if USE_STRING_CACHE
+    /** Last string kept by the cache purge, C_NULL before the first */
+    pPmString_t purge_cursor;
+#endif
+
+    /** Next chunk to sweep */
+    pPmHeapDesc_t sweep_cursor;
+
+    /** Work budget of one step, zero to collect only when out of memory */
+    uint16_t step_work;
+
+    /** Work done by the current step or full run */
+    uint32_t work;
+
+    /** Pause statistics */
+    PmGcStats_t stats;
+#endif                          /* HAVE_GC_INCREMENTAL */
 #endif                          /* HAVE_GC */
 
 } PmHeap_t,
@@ -371,11 +440,23 @@ heap_init(void)
     pmHeap.gcval = (uint8_t)0;
     pmHeap.temp_root_index = (uint8_t)0;
     heap_gcSetAuto(C_TRUE);
+#ifdef HAVE_GC_INCREMENTAL
+    pmHeap.gcphase = HEAP_GC_IDLE;
+    pmHeap.gray_index = (uint8_t)0;
+    pmHeap.step_work = PM_GC_STEP_WORK;
+    heap_gcResetStats();
+#endif /* HAVE_GC_INCREMENTAL */
 #endif /* HAVE_GC */
 
-    /* Create as many max-sized chunks as possible in the freelist */
+    /*
+     * Create as many max-sized chunks as possible in the freelist.
+     * The sweep walks the chunks up to the end of the heap, so no leftover
+     * too small for a chunk may be left at the end: the last max-sized
+     * chunk is shortened instead.
+     */
     for (pchunk = (pPmHeapDesc_t)pmHeap.base, hs = PM_HEAP_SIZE;
-         hs >= HEAP_MAX_FREE_CHUNK_SIZE; hs -= HEAP_MAX_FREE_CHUNK_SIZE)
+         hs >= HEAP_MAX_FREE_CHUNK_SIZE + HEAP_MIN_CHUNK_SIZE;
+         hs -= HEAP_MAX_FREE_CHUNK_SIZE)
     {
         OBJ_SET_FREE(pchunk, 1);
         OBJ_SET_SIZE(pchunk, HEAP_MAX_FREE_CHUNK_SIZE);
@@ -383,6 +464,15 @@ heap_init(void)
         pchunk =
             (pPmHeapDesc_t)((uint8_t *)pchunk + HEAP_MAX_FREE_CHUNK_SIZE);
     }
+    if (hs > HEAP_MAX_FREE_CHUNK_SIZE)
+    {
+        hs = hs & ~3;
+        OBJ_SET_FREE(pchunk, 1);
+        OBJ_SET_SIZE(pchunk, hs - HEAP_MIN_CHUNK_SIZE);
+        heap_linkToFreelist(pchunk);
+        pchunk = (pPmHeapDesc_t)((uint8_t *)pchunk + hs - HEAP_MIN_CHUNK_SIZE);
+        hs = HEAP_MIN_CHUNK_SIZE;
+    }
 
     /* Add any leftover memory to the freelist */
     if (hs >= HEAP_MIN_CHUNK_SIZE)
@@ -488,6 +578,12 @@ heap_getChunkImpl(uint16_t size, uint8_t **r_pchunk)
 }
 
 
+#ifdef HAVE_GC_INCREMENTAL
+static PmReturn_t heap_gcStep(void);
+static PmReturn_t heap_gcFinish(void);
+#endif /* HAVE_GC_INCREMENTAL */
+
+
 /*
  * Allocates chunk of memory.
  * Filters out invalid sizes.
@@ -518,9 +614,33 @@ heap_getChunk(uint16_t requestedsize, uint8_t **r_pchunk)
      */
     adjustedsize = ((requestedsize + 3) & ~3);
 
+#ifdef HAVE_GC_INCREMENTAL
+    /* Do a bounded amount of collection if gc is enabled and not in native session */
+    if ((pmHeap.step_work != 0) && (pmHeap.auto_gc == C_TRUE)
+        && (gVmGlobal.nativeframe.nf_active == C_FALSE))
+    {
+        retval = heap_gcStep();
+        PM_RETURN_IF_ERROR(retval);
+    }
+#endif /* HAVE_GC_INCREMENTAL */
+
     /* Attempt to get a chunk */
     retval = heap_getChunkImpl(adjustedsize, r_pchunk);
 
+#ifdef HAVE_GC_INCREMENTAL
+    /* If out of memory during a cycle, finish the cycle first */
+    if ((retval == PM_RET_EX_MEM) && (pmHeap.gcphase != HEAP_GC_IDLE)
+        && (pmHeap.auto_gc == C_TRUE)
+        && (gVmGlobal.nativeframe.nf_active == C_FALSE))
+    {
+        retval = heap_gcFinish();
+        PM_RETURN_IF_ERROR(retval);
+
+        /* Attempt to get a chunk */
+        retval = heap_getChunkImpl(adjustedsize, r_pchunk);
+    }
+#endif /* HAVE_GC_INCREMENTAL */
+
 #ifdef HAVE_GC
     /* Perform GC if out of memory, gc is enabled and not in native session */
     if ((retval == PM_RET_EX_MEM) && (pmHeap.auto_gc == C_TRUE)
@@ -544,6 +664,11 @@ heap_getChunk(uint16_t requestedsize, uint8_t **r_pchunk)
 }
 
 
+#ifdef HAVE_GC
+static PmReturn_t heap_gcScanObj(pPmObj_t pobj);
+#endif /* HAVE_GC */
+
+
 /* Releases chunk to the free list */
 PmReturn_t
 heap_freeChunk(pPmObj_t ptr)
@@ -557,6 +682,29 @@ heap_freeChunk(pPmObj_t ptr)
     C_ASSERT(((uint8_t *)ptr >= pmHeap.base)
              && ((uint8_t *)ptr < pmHeap.base + PM_HEAP_SIZE));
 
+#ifdef HAVE_GC_INCREMENTAL
+    /*
+     * The chunk must not be scanned once it is free.  A gray chunk is scanned
+     * now instead, what it refers to may be reachable through nothing else,
+     * like the block under a loop block that is popped.
+     */
+    if (pmHeap.gcphase == HEAP_GC_MARK)
+    {
+        uint8_t i;
+
+        for (i = 0; i < pmHeap.gray_index; i++)
+        {
+            if (pmHeap.gray[i] == ptr)
+            {
+                pmHeap.gray[i] = pmHeap.gray[--pmHeap.gray_index];
+                retval = heap_gcScanObj(ptr);
+                PM_RETURN_IF_ERROR(retval);
+                break;
+            }
+        }
+    }
+#endif /* HAVE_GC_INCREMENTAL */
+
     /* Insert the chunk into the freelist */
     OBJ_SET_FREE(ptr, 1);
 
@@ -582,28 +730,38 @@ heap_getAvail(void)
 
 
 #ifdef HAVE_GC
+
 /*
  * Marks the given object and the objects it references.
  *
+ * With HAVE_GC_INCREMENTAL the object is pushed on the gray stack and the
+ * objects it references are marked when it is popped, or right away when
+ * the stack is full.
+ *
  * @param   pobj Any non-free heap object
  * @return  Return code
  */
 static PmReturn_t
 heap_gcMarkObj(pPmObj_t pobj)
 {
-    PmReturn_t retval = PM_RET_OK;
-    int16_t i = 0;
-    int16_t n;
     PmType_t type;
 
     /* Return if ptr is null or object is already marked */
     if (pobj == C_NULL)
     {
-        return retval;
+        return PM_RET_OK;
     }
+
+    /* Ints from the small int cache are static, they are never collected */
+    if (((uint8_t *)pobj >= (uint8_t *)&gVmGlobal.intCache[0])
+        && ((uint8_t *)pobj < (uint8_t *)&gVmGlobal.intCache[PM_INT_CACHE_SIZE]))
+    {
+        return PM_RET_OK;
+    }
+    HEAP_GC_WORK(1);
     if (OBJ_GET_GCVAL(pobj) == pmHeap.gcval)
     {
-        return retval;
+        return PM_RET_OK;
     }
 
     /* The pointer must be within the heap (native frame is special case) */
@@ -614,6 +772,47 @@ heap_gcMarkObj(pPmObj_t pobj)
     /* The object must not already be free */
     C_ASSERT(OBJ_GET_FREE(pobj) == 0);
 
+    OBJ_SET_GCVAL(pobj, pmHeap.gcval);
+
+    /* Objects with no references to other objects are done */
+    type = (PmType_t)OBJ_GET_TYPE(pobj);
+    if ((type == OBJ_TYPE_NON) || (type == OBJ_TYPE_INT)
+        || (type == OBJ_TYPE_FLT) || (type == OBJ_TYPE_STR)
+        || (type == OBJ_TYPE_NOB) || (type == OBJ_TYPE_BOOL)
+        || (type == OBJ_TYPE_CIO))
+    {
+        return PM_RET_OK;
+    }
+
+#ifdef HAVE_GC_INCREMENTAL
+    /* Leave the references for later if there is room on the gray stack */
+    if (pmHeap.gray_index < HEAP_GC_GRAY_SIZE)
+    {
+        pmHeap.gray[pmHeap.gray_index++] = pobj;
+        return PM_RET_OK;
+    }
+    pmHeap.stats.grayOverflows++;
+#endif /* HAVE_GC_INCREMENTAL */
+
+    return heap_gcScanObj(pobj);
+}
+
+
+/*
+ * Marks the objects referenced by the given marked object.
+ *
+ * @param   pobj Any marked heap object
+ * @return  Return code
+ */
+static PmReturn_t
+heap_gcScanObj(pPmObj_t pobj)
+{
+    PmReturn_t retval = PM_RET_OK;
+    int16_t i = 0;
+    PmType_t type;
+
+    HEAP_GC_WORK(1);
+
     type = (PmType_t)OBJ_GET_TYPE(pobj);
     switch (type)
     {
@@ -625,15 +824,11 @@ heap_gcMarkObj(pPmObj_t pobj)
         case OBJ_TYPE_NOB:
         case OBJ_TYPE_BOOL:
         case OBJ_TYPE_CIO:
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
             break;
 
         case OBJ_TYPE_TUP:
             i = ((pPmTuple_t)pobj)->length;
 
-            /* Mark tuple head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark each obj in tuple */
             while (--i >= 0)
             {
@@ -643,18 +838,11 @@ heap_gcMarkObj(pPmObj_t pobj)
             break;
 
         case OBJ_TYPE_LST:
-
-            /* Mark the list */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the seglist */
             retval = heap_gcMarkObj((pPmObj_t)((pPmList_t)pobj)->val);
             break;
 
         case OBJ_TYPE_DIC:
-            /* Mark the dict head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the keys seglist */
             retval = heap_gcMarkObj((pPmObj_t)((pPmDict_t)pobj)->d_keys);
             PM_RETURN_IF_ERROR(retval);
@@ -664,9 +852,6 @@ heap_gcMarkObj(pPmObj_t pobj)
             break;
 
         case OBJ_TYPE_COB:
-            /* Mark the code obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the names tuple */
             retval = heap_gcMarkObj((pPmObj_t)((pPmCo_t)pobj)->co_names);
             PM_RETURN_IF_ERROR(retval);
@@ -693,9 +878,6 @@ heap_gcMarkObj(pPmObj_t pobj)
         case OBJ_TYPE_MOD:
         case OBJ_TYPE_FXN:
             /* Module and Func objs are implemented via the PmFunc_t */
-            /* Mark the func obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the code obj */
             retval = heap_gcMarkObj((pPmObj_t)((pPmFunc_t)pobj)->f_co);
             PM_RETURN_IF_ERROR(retval);
@@ -722,9 +904,6 @@ heap_gcMarkObj(pPmObj_t pobj)
 
 #ifdef HAVE_CLASSES
         case OBJ_TYPE_CLI:
-            /* Mark the obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the class */
             retval = heap_gcMarkObj((pPmObj_t)((pPmInstance_t)pobj)->cli_class);
             PM_RETURN_IF_ERROR(retval);
@@ -734,9 +913,6 @@ heap_gcMarkObj(pPmObj_t pobj)
             break;
 
         case OBJ_TYPE_MTH:
-            /* Mark the obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the instance */
             retval = heap_gcMarkObj((pPmObj_t)((pPmMethod_t)pobj)->m_instance);
             PM_RETURN_IF_ERROR(retval);
@@ -750,9 +926,6 @@ heap_gcMarkObj(pPmObj_t pobj)
             break;
 
         case OBJ_TYPE_CLO:
-            /* Mark the obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the attrs dict */
             retval = heap_gcMarkObj((pPmObj_t)((pPmClass_t)pobj)->cl_attrs);
             PM_RETURN_IF_ERROR(retval);
@@ -775,9 +948,6 @@ heap_gcMarkObj(pPmObj_t pobj)
         {
             pPmObj_t *ppobj2 = C_NULL;
 
-            /* Mark the frame obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the previous frame, if this isn't a generator's frame */
             /* Issue #129: Fix iterator losing its object */
             if ((((pPmFrame_t)pobj)->fo_func->f_co->co_flags & CO_GENERATOR) == 0)
@@ -815,70 +985,77 @@ heap_gcMarkObj(pPmObj_t pobj)
         }
 
         case OBJ_TYPE_BLK:
-            /* Mark the block obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the next block in the stack */
             retval = heap_gcMarkObj((pPmObj_t)((pPmBlock_t)pobj)->next);
             break;
 
         case OBJ_TYPE_SGL:
-            /* Mark the seglist obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the seglist's segments */
-            n = ((pSeglist_t)pobj)->sl_length;
-            pobj = (pPmObj_t)((pSeglist_t)pobj)->sl_rootseg;
-            for (i = 0; i < n; i++)
+            retval = heap_gcMarkObj((pPmObj_t)((pSeglist_t)pobj)->sl_rootseg);
+            break;
+
+        case OBJ_TYPE_SEG:
+        {
+            pPmObj_t pnext;
+
+            /*
+             * Mark the items of this segment and the ones after it.
+             * The unused slots of a seglist's segments are always null.
+             * The following segment goes on the gray stack before the items
+             * if there is room, so it is scanned after them and a long
+             * seglist is scanned over several steps without filling the stack.
+             */
+            for (;;)
             {
-                /* Mark the segment item */
-                retval = heap_gcMarkObj(((pSegment_t)pobj)->s_val[i % SEGLIST_OBJS_PER_SEG]);
-                PM_RETURN_IF_ERROR(retval);
+                pnext = (pPmObj_t)((pSegment_t)pobj)->next;
+                if ((pnext != C_NULL) && (OBJ_GET_GCVAL(pnext) == pmHeap.gcval))
+                {
+                    pnext = C_NULL;
+                }
 
-                /* Mark the segment obj head */
-                if ((i % SEGLIST_OBJS_PER_SEG) == 0)
+#ifdef HAVE_GC_INCREMENTAL
+                if ((pnext != C_NULL) && (pmHeap.gray_index < HEAP_GC_GRAY_SIZE))
                 {
-                    OBJ_SET_GCVAL(pobj, pmHeap.gcval);
+                    OBJ_SET_GCVAL(pnext, pmHeap.gcval);
+                    HEAP_GC_WORK(1);
+                    pmHeap.gray[pmHeap.gray_index++] = pnext;
+                    pnext = C_NULL;
+                }
+#endif /* HAVE_GC_INCREMENTAL */
+
+                for (i = 0; i < SEGLIST_OBJS_PER_SEG; i++)
+                {
+                    retval = heap_gcMarkObj(((pSegment_t)pobj)->s_val[i]);
+                    PM_RETURN_IF_ERROR(retval);
                 }
 
-                /* Point to the next segment */
-                else
-                if ((i % SEGLIST_OBJS_PER_SEG) == (SEGLIST_OBJS_PER_SEG - 1))
+                /* Continue with the next segment if it was not pushed */
+                if ((pnext == C_NULL) || (OBJ_GET_GCVAL(pnext) == pmHeap.gcval))
                 {
-                    pobj = (pPmObj_t)((pSegment_t)pobj)->next;
-                    if (pobj == C_NULL)
-                    {
-                        break;
-                    }
+                    break;
                 }
+                OBJ_SET_GCVAL(pnext, pmHeap.gcval);
+                HEAP_GC_WORK(1);
+                pobj = pnext;
             }
             break;
+        }
 
         case OBJ_TYPE_SQI:
-            /* Mark the sequence iterator obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the sequence */
             retval = heap_gcMarkObj(((pPmSeqIter_t)pobj)->si_sequence);
             break;
 
         case OBJ_TYPE_THR:
-            /* Mark the thread obj head */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             /* Mark the current frame */
             retval = heap_gcMarkObj((pPmObj_t)((pPmThread_t)pobj)->pframe);
             break;
 
         case OBJ_TYPE_NFM:
             /*
-             * Mark the obj desc.  This doesn't really do much since the
-             * native frame is declared static (not from the heap), but this
-             * is here in case that ever changes
+             * The native frame is declared static (not from the heap),
+             * so only its remaining fields are marked, if it is active
              */
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
-            /* Mark the native frame's remaining fields if active */
             if (gVmGlobal.nativeframe.nf_active)
             {
                 /* Mark the frame stack */
@@ -907,13 +1084,10 @@ heap_gcMarkObj(pPmObj_t pobj)
 
 #ifdef HAVE_BYTEARRAY
         case OBJ_TYPE_BYA:
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
-
             retval = heap_gcMarkObj((pPmObj_t)((pPmBytearray_t)pobj)->val);
             break;
 
         case OBJ_TYPE_BYS:
-            OBJ_SET_GCVAL(pobj, pmHeap.gcval);
             break;
 #endif /* HAVE_BYTEARRAY */
 
@@ -946,12 +1120,6 @@ heap_gcMarkRoots(void)
     PM_RETURN_IF_ERROR(retval);
     retval = heap_gcMarkObj(PM_TRUE);
     PM_RETURN_IF_ERROR(retval);
-    retval = heap_gcMarkObj(PM_ZERO);
-    PM_RETURN_IF_ERROR(retval);
-    retval = heap_gcMarkObj(PM_ONE);
-    PM_RETURN_IF_ERROR(retval);
-    retval = heap_gcMarkObj(PM_NEGONE);
-    PM_RETURN_IF_ERROR(retval);
     retval = heap_gcMarkObj(PM_CODE_STR);
     PM_RETURN_IF_ERROR(retval);
 
@@ -978,6 +1146,7 @@ heap_gcMarkRoots(void)
 }
 
 
+#ifndef HAVE_GC_INCREMENTAL
 #if USE_STRING_CACHE
 /**
  * Unlinks free objects from the string cache.
@@ -1127,6 +1296,243 @@ heap_gcSweep(void)
 
     return PM_RET_OK;
 }
+#endif /* !HAVE_GC_INCREMENTAL */
+
+
+#ifdef HAVE_GC_INCREMENTAL
+/* Starts a collection cycle by marking the roots */
+static PmReturn_t
+heap_gcStartCycle(void)
+{
+    PmReturn_t retval;
+
+    /* #239: Fix GC when 2+ unlinked allocs occur */
+    C_ASSERT(pmHeap.temp_root_index < HEAP_NUM_TEMP_ROOTS);
+
+    C_DEBUG_PRINT(VERBOSITY_LOW, "heap_gcStartCycle()\n");
+
+    pmHeap.gray_index = (uint8_t)0;
+    pmHeap.gcphase = HEAP_GC_MARK;
+    retval = heap_gcMarkRoots();
+    PM_RETURN_IF_ERROR(retval);
+
+    /* The active frame changes without write barriers, so scan it now */
+    if (gVmGlobal.pthread != C_NULL)
+    {
+        heap_gcFrameBarrier(PM_FP);
+    }
+
+    return retval;
+}
+
+
+/*
+ * Takes the next string of the cache, unlinks it if it is not marked.
+ * Starts the sweep after the last string.
+ */
+static void
+heap_gcPurgeStep(void)
+{
+#if USE_STRING_CACHE
+    pPmString_t *ppstrcache;
+    pPmString_t *ppstr;
+
+    HEAP_GC_WORK(1);
+
+    /* Start at the head of the cache, then continue after the last kept */
+    string_getCache(&ppstrcache);
+    ppstr = (pmHeap.purge_cursor == C_NULL)
+        ? ppstrcache : &pmHeap.purge_cursor->next;
+
+    if (*ppstr != C_NULL)
+    {
+        if (OBJ_GET_GCVAL(*ppstr) != pmHeap.gcval)
+        {
+            *ppstr = (*ppstr)->next;
+        }
+        else
+        {
+            pmHeap.purge_cursor = *ppstr;
+        }
+        return;
+    }
+#endif /* USE_STRING_CACHE */
+
+    pmHeap.gcphase = HEAP_GC_SWEEP;
+    pmHeap.sweep_cursor = (pPmHeapDesc_t)pmHeap.base;
+}
+
+
+/*
+ * Sweeps the next chunk: skips it if it is marked, otherwise coalesces it
+ * with the free or unmarked chunks following it.  The coalescing is cut
+ * short when the work budget is used up.  Ends the cycle at the end of
+ * the heap.
+ */
+static PmReturn_t
+heap_gcSweepStep(uint32_t budget)
+{
+    pPmHeapDesc_t pchunk;
+    pPmHeapDesc_t pnext;
+    uint16_t totalchunksize = 0;
+
+    pchunk = pmHeap.sweep_cursor;
+    if ((uint8_t *)pchunk >= &pmHeap.base[PM_HEAP_SIZE])
+    {
+        pmHeap.gcphase = HEAP_GC_IDLE;
+        pmHeap.stats.cycles++;
+        return PM_RET_OK;
+    }
+
+    /* Skip a marked chunk */
+    HEAP_GC_WORK(1);
+    if (!OBJ_GET_FREE(pchunk) && (OBJ_GET_GCVAL(pchunk) == pmHeap.gcval))
+    {
+        pmHeap.sweep_cursor =
+            (pPmHeapDesc_t)((uint8_t *)pchunk + OBJ_GET_SIZE(pchunk));
+        return PM_RET_OK;
+    }
+
+    /* Coalesce the contiguous free and unmarked chunks */
+    pnext = pchunk;
+    do
+    {
+        if ((totalchunksize + OBJ_GET_SIZE(pnext)) > HEAP_MAX_FREE_CHUNK_SIZE)
+        {
+            break;
+        }
+        totalchunksize = totalchunksize + OBJ_GET_SIZE(pnext);
+
+        /*
+         * If the chunk is already free, unlink it because its size
+         * is about to change
+         */
+        if (OBJ_GET_FREE(pnext))
+        {
+            PM_RETURN_IF_ERROR(heap_unlinkFromFreelist(pnext));
+        }
+
+        /* Otherwise free and reclaim the unmarked chunk */
+        else
+        {
+            OBJ_SET_TYPE(pnext, 0);
+            OBJ_SET_FREE(pnext, 1);
+        }
+
+        C_DEBUG_PRINT(VERBOSITY_HIGH, "heap_gcSweepStep(), id=%p, s=%d\n",
+                      pnext, OBJ_GET_SIZE(pnext));
+
+        pnext = (pPmHeapDesc_t)((uint8_t *)pnext + OBJ_GET_SIZE(pnext));
+        HEAP_GC_WORK(1);
+    }
+    while (((uint8_t *)pnext < &pmHeap.base[PM_HEAP_SIZE])
+           && (pmHeap.work < budget)
+           && (OBJ_GET_FREE(pnext)
+               || (OBJ_GET_GCVAL(pnext) != pmHeap.gcval)));
+
+    /* Set the heap descriptor data and insert chunk into free list */
+    OBJ_SET_FREE(pchunk, 1);
+    OBJ_SET_SIZE(pchunk, totalchunksize);
+    pmHeap.sweep_cursor = pnext;
+
+    return heap_linkToFreelist(pchunk);
+}
+
+
+/* Does collector work until the budget is used up or the cycle ends */
+static PmReturn_t
+heap_gcWork(uint32_t budget)
+{
+    PmReturn_t retval = PM_RET_OK;
+
+    while ((pmHeap.gcphase != HEAP_GC_IDLE) && (pmHeap.work < budget))
+    {
+        if (pmHeap.gcphase == HEAP_GC_MARK)
+        {
+            /* Marking is complete when no gray objects are left */
+            if (pmHeap.gray_index == 0)
+            {
+                pmHeap.gcphase = HEAP_GC_PURGE;
+#if USE_STRING_CACHE
+                pmHeap.purge_cursor = C_NULL;
+#endif
+                continue;
+            }
+
+            retval = heap_gcScanObj(pmHeap.gray[--pmHeap.gray_index]);
+        }
+        else if (pmHeap.gcphase == HEAP_GC_PURGE)
+        {
+            heap_gcPurgeStep();
+        }
+        else
+        {
+            retval = heap_gcSweepStep(budget);
+        }
+        PM_RETURN_IF_ERROR(retval);
+    }
+
+    return retval;
+}
+
+
+/* Does one step of collector work, starts a cycle when the heap runs low */
+static PmReturn_t
+heap_gcStep(void)
+{
+    PmReturn_t retval = PM_RET_OK;
+
+    pmHeap.work = 0;
+    if (pmHeap.gcphase == HEAP_GC_IDLE)
+    {
+        if (pmHeap.avail >= PM_GC_START_THRESHOLD)
+        {
+            return retval;
+        }
+
+        retval = heap_gcStartCycle();
+        PM_RETURN_IF_ERROR(retval);
+    }
+
+    retval = heap_gcWork(pmHeap.step_work);
+
+    pmHeap.stats.steps++;
+    if (pmHeap.work > pmHeap.stats.maxStepWork)
+    {
+        pmHeap.stats.maxStepWork = pmHeap.work;
+    }
+
+    return retval;
+}
+
+
+/* Records the pause of a cycle finished in one go */
+static void
+heap_gcCountFullRun(void)
+{
+    pmHeap.stats.fullRuns++;
+    if (pmHeap.work > pmHeap.stats.maxFullWork)
+    {
+        pmHeap.stats.maxFullWork = pmHeap.work;
+    }
+}
+
+
+/* Finishes the cycle in progress in one go */
+static PmReturn_t
+heap_gcFinish(void)
+{
+    PmReturn_t retval;
+
+    C_DEBUG_PRINT(VERBOSITY_LOW, "heap_gcFinish()\n");
+
+    pmHeap.work = 0;
+    retval = heap_gcWork(HEAP_GC_NO_LIMIT);
+    heap_gcCountFullRun();
+
+    return retval;
+}
+#endif /* HAVE_GC_INCREMENTAL */
 
 
 /* Runs the mark-sweep garbage collector */
@@ -1144,10 +1550,26 @@ heap_gcRun(void)
     C_DEBUG_PRINT(VERBOSITY_LOW, "heap_gcRun()\n");
     /*heap_dump();*/
 
+#ifdef HAVE_GC_INCREMENTAL
+    /*
+     * Finish the cycle in progress, then run a whole one to also reclaim
+     * what became garbage after the first one started
+     */
+    pmHeap.work = 0;
+    retval = heap_gcWork(HEAP_GC_NO_LIMIT);
+    PM_RETURN_IF_ERROR(retval);
+
+    retval = heap_gcStartCycle();
+    PM_RETURN_IF_ERROR(retval);
+
+    retval = heap_gcWork(HEAP_GC_NO_LIMIT);
+    heap_gcCountFullRun();
+#else
     retval = heap_gcMarkRoots();
     PM_RETURN_IF_ERROR(retval);
 
     retval = heap_gcSweep();
+#endif /* HAVE_GC_INCREMENTAL */
     /*heap_dump();*/
     return retval;
 }
@@ -1161,6 +1583,86 @@ heap_gcSetAuto(uint8_t auto_gc)
     return PM_RET_OK;
 }
 
+
+#ifdef HAVE_GC_INCREMENTAL
+void
+heap_gcSetStepWork(uint16_t work)
+{
+    pmHeap.step_work = work;
+}
+
+
+void
+heap_gcGetStats(pPmGcStats_t r_stats)
+{
+    *r_stats = pmHeap.stats;
+}
+
+
+void
+heap_gcResetStats(void)
+{
+    sli_memset((unsigned char *)&pmHeap.stats, 0, sizeof(PmGcStats_t));
+}
+
+
+void
+heap_gcWriteBarrier(pPmObj_t pobj)
+{
+    /* Only the mark phase can lose an object */
+    if (pmHeap.gcphase == HEAP_GC_MARK)
+    {
+        heap_gcMarkObj(pobj);
+    }
+}
+
+
+void
+heap_gcFrameBarrier(pPmFrame_t pframe)
+{
+    uint8_t i;
+
+    if (pmHeap.gcphase != HEAP_GC_MARK)
+    {
+        return;
+    }
+
+    /* A marked frame that is not gray has been scanned already */
+    if (OBJ_GET_GCVAL(pframe) == pmHeap.gcval)
+    {
+        for (i = 0; i < pmHeap.gray_index; i++)
+        {
+            if (pmHeap.gray[i] == (pPmObj_t)pframe)
+            {
+                break;
+            }
+        }
+        if (i == pmHeap.gray_index)
+        {
+            return;
+        }
+        pmHeap.gray[i] = pmHeap.gray[--pmHeap.gray_index];
+    }
+    else
+    {
+        OBJ_SET_GCVAL(pframe, pmHeap.gcval);
+    }
+
+    heap_gcScanObj((pPmObj_t)pframe);
+}
+
+
+void
+heap_gcRevive(pPmObj_t pobj)
+{
+    /* Keep it from being purged or swept by the cycle in progress */
+    if (pmHeap.gcphase != HEAP_GC_IDLE)
+    {
+        OBJ_SET_GCVAL(pobj, pmHeap.gcval);
+    }
+}
+#endif /* HAVE_GC_INCREMENTAL */
+
 void heap_gcPushTempRoot(pPmObj_t pobj, uint8_t *r_objid)
 {
     if (pmHeap.temp_root_index < HEAP_NUM_TEMP_ROOTS)
@@ -91,8 +91,92 @@ PmReturn_t heap_gcRun(void);
  */
 PmReturn_t heap_gcSetAuto(uint8_t auto_gc);
 
+#ifdef HAVE_GC_INCREMENTAL
+/**
+ * Pause statistics of the incremental collector.
+ *
+ * Work is counted in units of one object scanned, one reference followed,
+ * one string purged from the cache or one chunk swept.
+ */
+typedef struct PmGcStats_s
+{
+    /** Number of collection cycles completed */
+    uint16_t cycles;
+
+    /** Number of incremental steps taken */
+    uint32_t steps;
+
+    /** Most work done by one incremental step */
+    uint32_t maxStepWork;
+
+    /** Number of times a cycle was finished in one go (heap_gcRun or OOM) */
+    uint16_t fullRuns;
+
+    /** Most work done by one such full run */
+    uint32_t maxFullWork;
+
+    /** Number of times the gray stack was full and an object was marked
+     * recursively instead */
+    uint16_t grayOverflows;
+} PmGcStats_t,
+ *pPmGcStats_t;
+
+/**
+ * Sets the most work the collector does per allocation.
+ *
+ * Zero disables the incremental steps, the heap is then only collected
+ * all at once when it is exhausted, like without HAVE_GC_INCREMENTAL.
+ *
+ * @param   work Work budget of one step
+ */
+void heap_gcSetStepWork(uint16_t work);
+
+/**
+ * Copies the collector's pause statistics.
+ *
+ * @param   r_stats Statistics (return)
+ */
+void heap_gcGetStats(pPmGcStats_t r_stats);
+
+/** Clears the collector's pause statistics */
+void heap_gcResetStats(void);
+
+/**
+ * Write barrier, called with the reference an object field or seglist slot
+ * held before it is overwritten or dropped, so an incremental mark can not
+ * lose an object the mutator moved behind it.
+ *
+ * @param   pobj Previous value of the field, may be C_NULL
+ */
+void heap_gcWriteBarrier(pPmObj_t pobj);
+
+/**
+ * Frame barrier, called when a frame becomes the active frame.
+ * The active frame is changed without write barriers, so it is scanned
+ * before that happens.
+ *
+ * @param   pframe The new active frame
+ */
+struct PmFrame_s;
+void heap_gcFrameBarrier(struct PmFrame_s *pframe);
+
+/**
+ * Keeps an object the collector has no reference to, used for strings
+ * handed out again by the string cache.
+ *
+ * @param   pobj Object without references to other objects
+ */
+void heap_gcRevive(pPmObj_t pobj);
+#endif /* HAVE_GC_INCREMENTAL */
+
 #endif /* HAVE_GC */
 
+#if !defined(HAVE_GC) || !defined(HAVE_GC_INCREMENTAL)
+#define heap_gcWriteBarrier(pobj)
+#define heap_gcFrameBarrier(pframe)
+#define heap_gcRevive(pobj)
+#endif
+
 /**
  * Pushes an object onto the temporary roots stack if there is room
  * to protect the objects from a potential garbage collection
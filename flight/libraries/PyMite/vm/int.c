@@ -51,20 +51,10 @@ int_new(int32_t n, pPmObj_t *r_pint)
 {
     PmReturn_t retval = PM_RET_OK;
 
-    /* If n is 0,1,-1, return static int objects from global struct */
-    if (n == 0)
+    /* If n is a small int, return the static int obj from the cache */
+    if ((n >= PM_INT_CACHE_MIN) && (n <= PM_INT_CACHE_MAX))
     {
-        *r_pint = PM_ZERO;
-        return PM_RET_OK;
-    }
-    if (n == 1)
-    {
-        *r_pint = PM_ONE;
-        return PM_RET_OK;
-    }
-    if (n == -1)
-    {
-        *r_pint = PM_NEGONE;
+        *r_pint = (pPmObj_t)&gVmGlobal.intCache[n - PM_INT_CACHE_MIN];
         return PM_RET_OK;
     }
 
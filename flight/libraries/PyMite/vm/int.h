@@ -40,6 +40,14 @@ typedef struct PmInt_s
  *pPmInt_t;
 
 
+/** Number of ints in the small int cache (see pmEmptyPlatformDefs.h) */
+#define PM_INT_CACHE_SIZE (PM_INT_CACHE_MAX - PM_INT_CACHE_MIN + 1)
+
+#if (PM_INT_CACHE_MIN > -1) || (PM_INT_CACHE_MAX < 1)
+#error The small int cache must include -1, 0 and 1
+#endif
+
+
 /**
  * Creates a duplicate Integer object
  *
@@ -54,6 +62,9 @@ PmReturn_t int_dup(pPmObj_t pint, pPmObj_t *r_pint);
 /**
  * Creates a new Integer object
  *
+ * Values from PM_INT_CACHE_MIN to PM_INT_CACHE_MAX come from the static
+ * small int cache and are not allocated.
+ *
  * @param   val Value to assign int (signed 32-bit).
  * @param   r_pint Return by ref, ptr to new int
  * @return  Return status
@@ -28,6 +28,33 @@
 #include "pm.h"
 
 
+/*
+ * Threaded dispatch: where the compiler has labels as values, each handler
+ * fetches the next bcode and jumps straight to its handler through a table,
+ * instead of going back through the loop and the switch.  Handlers that are
+ * compiled conditionally are reached through the switch.  Other compilers,
+ * or PM_NO_COMPUTED_GOTO, use the switch for every bcode.
+ */
+#if defined(__GNUC__) && !defined(PM_NO_COMPUTED_GOTO)
+#define HAVE_COMPUTED_GOTO
+
+/** Labels the handler of the bcode for the dispatch table */
+#define PM_TARGET(bc) target_##bc:
+
+/** Ends a handler; goes through the loop only to reschedule threads */
+#define PM_DISPATCH() \
+    if (!gVmGlobal.reschedule) \
+    { \
+        bc = mem_getByte(PM_FP->fo_memspace, &PM_IP); \
+        goto *dispatchTable[bc]; \
+    } \
+    else continue
+#else
+#define PM_TARGET(bc)
+#define PM_DISPATCH() continue
+#endif /* __GNUC__ */
+
+
 PmReturn_t
 interpret(const uint8_t returnOnNoThreads)
 {
@@ -40,6 +67,90 @@ interpret(const uint8_t returnOnNoThreads)
     uint8_t bc;
     uint8_t objid, objid2;
 
+#ifdef HAVE_COMPUTED_GOTO
+    /* Handler of each bcode; the others are reached through the switch */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Woverride-init"
+    static void *const dispatchTable[256] = {
+        [0 ... 255] = &&dispatch_switch,
+        [POP_TOP] = &&target_POP_TOP,
+        [ROT_TWO] = &&target_ROT_TWO,
+        [ROT_THREE] = &&target_ROT_THREE,
+        [DUP_TOP] = &&target_DUP_TOP,
+        [ROT_FOUR] = &&target_ROT_FOUR,
+        [NOP] = &&target_NOP,
+        [UNARY_POSITIVE] = &&target_UNARY_POSITIVE,
+        [UNARY_NEGATIVE] = &&target_UNARY_NEGATIVE,
+        [UNARY_NOT] = &&target_UNARY_NOT,
+        [UNARY_INVERT] = &&target_UNARY_INVERT,
+        [LIST_APPEND] = &&target_LIST_APPEND,
+        [LIST_APPEND_N] = &&target_LIST_APPEND_N,
+        [BINARY_POWER] = &&target_BINARY_POWER,
+        [INPLACE_POWER] = &&target_BINARY_POWER,
+        [GET_ITER] = &&target_GET_ITER,
+        [BINARY_MULTIPLY] = &&target_BINARY_MULTIPLY,
+        [INPLACE_MULTIPLY] = &&target_BINARY_MULTIPLY,
+        [BINARY_DIVIDE] = &&target_BINARY_DIVIDE,
+        [INPLACE_DIVIDE] = &&target_BINARY_DIVIDE,
+        [BINARY_FLOOR_DIVIDE] = &&target_BINARY_DIVIDE,
+        [INPLACE_FLOOR_DIVIDE] = &&target_BINARY_DIVIDE,
+        [BINARY_MODULO] = &&target_BINARY_MODULO,
+        [INPLACE_MODULO] = &&target_BINARY_MODULO,
+        [STORE_MAP] = &&target_STORE_MAP,
+        [BINARY_ADD] = &&target_BINARY_ADD,
+        [INPLACE_ADD] = &&target_BINARY_ADD,
+        [BINARY_SUBTRACT] = &&target_BINARY_SUBTRACT,
+        [INPLACE_SUBTRACT] = &&target_BINARY_SUBTRACT,
+        [BINARY_SUBSCR] = &&target_BINARY_SUBSCR,
+        [SLICE_0] = &&target_SLICE_0,
+        [STORE_SUBSCR] = &&target_STORE_SUBSCR,
+        [BINARY_LSHIFT] = &&target_BINARY_LSHIFT,
+        [INPLACE_LSHIFT] = &&target_BINARY_LSHIFT,
+        [BINARY_RSHIFT] = &&target_BINARY_RSHIFT,
+        [INPLACE_RSHIFT] = &&target_BINARY_RSHIFT,
+        [BINARY_AND] = &&target_BINARY_AND,
+        [INPLACE_AND] = &&target_BINARY_AND,
+        [BINARY_XOR] = &&target_BINARY_XOR,
+        [INPLACE_XOR] = &&target_BINARY_XOR,
+        [BINARY_OR] = &&target_BINARY_OR,
+        [INPLACE_OR] = &&target_BINARY_OR,
+        [BREAK_LOOP] = &&target_BREAK_LOOP,
+        [LOAD_LOCALS] = &&target_LOAD_LOCALS,
+        [RETURN_VALUE] = &&target_RETURN_VALUE,
+        [POP_BLOCK] = &&target_POP_BLOCK,
+        [STORE_NAME] = &&target_STORE_NAME,
+        [UNPACK_SEQUENCE] = &&target_UNPACK_SEQUENCE,
+        [FOR_ITER] = &&target_FOR_ITER,
+        [STORE_ATTR] = &&target_STORE_ATTR,
+        [STORE_GLOBAL] = &&target_STORE_GLOBAL,
+        [DUP_TOPX] = &&target_DUP_TOPX,
+        [LOAD_CONST] = &&target_LOAD_CONST,
+        [LOAD_NAME] = &&target_LOAD_NAME,
+        [BUILD_TUPLE] = &&target_BUILD_TUPLE,
+        [BUILD_LIST] = &&target_BUILD_LIST,
+        [BUILD_MAP] = &&target_BUILD_MAP,
+        [LOAD_ATTR] = &&target_LOAD_ATTR,
+        [COMPARE_OP] = &&target_COMPARE_OP,
+        [IMPORT_NAME] = &&target_IMPORT_NAME,
+        [JUMP_FORWARD] = &&target_JUMP_FORWARD,
+        [JUMP_IF_FALSE] = &&target_JUMP_IF_FALSE,
+        [JUMP_IF_TRUE] = &&target_JUMP_IF_TRUE,
+        [JUMP_ABSOLUTE] = &&target_JUMP_ABSOLUTE,
+        [CONTINUE_LOOP] = &&target_JUMP_ABSOLUTE,
+        [LOAD_GLOBAL] = &&target_LOAD_GLOBAL,
+        [SETUP_LOOP] = &&target_SETUP_LOOP,
+        [LOAD_FAST] = &&target_LOAD_FAST,
+        [STORE_FAST] = &&target_STORE_FAST,
+        [CALL_FUNCTION] = &&target_CALL_FUNCTION,
+        [MAKE_FUNCTION] = &&target_MAKE_FUNCTION,
+        [POP_JUMP_IF_FALSE] = &&target_POP_JUMP_IF_FALSE,
+        [POP_JUMP_IF_TRUE] = &&target_POP_JUMP_IF_TRUE,
+        [JUMP_IF_FALSE_OR_POP] = &&target_JUMP_IF_FALSE_OR_POP,
+        [JUMP_IF_TRUE_OR_POP] = &&target_JUMP_IF_TRUE_OR_POP,
+    };
+#pragma GCC diagnostic pop
+#endif /* HAVE_COMPUTED_GOTO */
+
     /* Activate a thread the first time */
     retval = interp_reschedule();
     PM_RETURN_IF_ERROR(retval);
@@ -73,42 +184,53 @@ interpret(const uint8_t returnOnNoThreads)
 
         /* Get byte; the func post-incrs PM_IP */
         bc = mem_getByte(PM_FP->fo_memspace, &PM_IP);
+#ifdef HAVE_COMPUTED_GOTO
+        goto *dispatchTable[bc];
+dispatch_switch:
+#endif /* HAVE_COMPUTED_GOTO */
         switch (bc)
         {
             case POP_TOP:
+            PM_TARGET(POP_TOP)
                 pobj1 = PM_POP();
-                continue;
+                PM_DISPATCH();
 
             case ROT_TWO:
+            PM_TARGET(ROT_TWO)
                 pobj1 = TOS;
                 TOS = TOS1;
                 TOS1 = pobj1;
-                continue;
+                PM_DISPATCH();
 
             case ROT_THREE:
+            PM_TARGET(ROT_THREE)
                 pobj1 = TOS;
                 TOS = TOS1;
                 TOS1 = TOS2;
                 TOS2 = pobj1;
-                continue;
+                PM_DISPATCH();
 
             case DUP_TOP:
+            PM_TARGET(DUP_TOP)
                 pobj1 = TOS;
                 PM_PUSH(pobj1);
-                continue;
+                PM_DISPATCH();
 
             case ROT_FOUR:
+            PM_TARGET(ROT_FOUR)
                 pobj1 = TOS;
                 TOS = TOS1;
                 TOS1 = TOS2;
                 TOS2 = TOS3;
                 TOS3 = pobj1;
-                continue;
+                PM_DISPATCH();
 
             case NOP:
-                continue;
+            PM_TARGET(NOP)
+                PM_DISPATCH();
 
             case UNARY_POSITIVE:
+            PM_TARGET(UNARY_POSITIVE)
                 /* Raise TypeError if TOS is not an int */
                 if ((OBJ_GET_TYPE(TOS) != OBJ_TYPE_INT)
 #ifdef HAVE_FLOAT
@@ -121,9 +243,10 @@ interpret(const uint8_t returnOnNoThreads)
                 }
 
                 /* When TOS is an int, this is a no-op */
-                continue;
+                PM_DISPATCH();
 
             case UNARY_NEGATIVE:
+            PM_TARGET(UNARY_NEGATIVE)
 #ifdef HAVE_FLOAT
                 if (OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
                 {
@@ -136,9 +259,10 @@ interpret(const uint8_t returnOnNoThreads)
                 }
                 PM_BREAK_IF_ERROR(retval);
                 TOS = pobj2;
-                continue;
+                PM_DISPATCH();
 
             case UNARY_NOT:
+            PM_TARGET(UNARY_NOT)
                 pobj1 = PM_POP();
                 if (obj_isFalse(pobj1))
                 {
@@ -148,7 +272,7 @@ interpret(const uint8_t returnOnNoThreads)
                 {
                     PM_PUSH(PM_FALSE);
                 }
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_BACKTICK
             /* #244 Add support for the backtick operation (UNARY_CONVERT) */
@@ -156,10 +280,11 @@ interpret(const uint8_t returnOnNoThreads)
                 retval = obj_repr(TOS, &pobj3);
                 PM_BREAK_IF_ERROR(retval);
                 TOS = pobj3;
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_BACKTICK */
 
             case UNARY_INVERT:
+            PM_TARGET(UNARY_INVERT)
                 /* Raise TypeError if it's not an int */
                 if (OBJ_GET_TYPE(TOS) != OBJ_TYPE_INT)
                 {
@@ -171,16 +296,27 @@ interpret(const uint8_t returnOnNoThreads)
                 retval = int_bitInvert(TOS, &pobj2);
                 PM_BREAK_IF_ERROR(retval);
                 TOS = pobj2;
-                continue;
+                PM_DISPATCH();
 
             case LIST_APPEND:
+            PM_TARGET(LIST_APPEND)
                 /* list_append will raise a TypeError if TOS1 is not a list */
                 retval = list_append(TOS1, TOS);
                 PM_SP -= 2;
-                continue;
+                PM_DISPATCH();
+
+            case LIST_APPEND_N:
+            PM_TARGET(LIST_APPEND_N)
+                /* The list is under the value and arg - 1 other objs */
+                t16 = GET_ARG();
+                retval = list_append(STACK(t16), TOS);
+                PM_BREAK_IF_ERROR(retval);
+                PM_SP--;
+                PM_DISPATCH();
 
             case BINARY_POWER:
             case INPLACE_POWER:
+            PM_TARGET(BINARY_POWER)
 
 #ifdef HAVE_FLOAT
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
@@ -191,7 +327,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 #endif /* HAVE_FLOAT */
 
@@ -202,9 +338,10 @@ interpret(const uint8_t returnOnNoThreads)
                 /* Set return value */
                 PM_SP--;
                 TOS = pobj3;
-                continue;
+                PM_DISPATCH();
 
             case GET_ITER:
+            PM_TARGET(GET_ITER)
 #ifdef HAVE_GENERATORS
                 /* Raise TypeError if TOS is an instance, but not iterable */
                 if (OBJ_GET_TYPE(TOS) == OBJ_TYPE_CLI)
@@ -226,10 +363,11 @@ interpret(const uint8_t returnOnNoThreads)
                     /* Put sequence-iterator on top of stack */
                     TOS = pobj1;
                 }
-                continue;
+                PM_DISPATCH();
 
             case BINARY_MULTIPLY:
             case INPLACE_MULTIPLY:
+            PM_TARGET(BINARY_MULTIPLY)
                 /* If both objs are ints, perform the op */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
                     && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
@@ -239,10 +377,22 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
 #ifdef HAVE_FLOAT
+                /* If both objs are floats, perform the op without float_op */
+                else if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
+                         && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
+                {
+                    retval = float_new(((pPmFloat_t)TOS1)->val *
+                                       ((pPmFloat_t)TOS)->val, &pobj3);
+                    PM_BREAK_IF_ERROR(retval);
+                    PM_SP--;
+                    TOS = pobj3;
+                    PM_DISPATCH();
+                }
+
                 else if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
                          || (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
                 {
@@ -250,7 +400,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 #endif /* HAVE_FLOAT */
 
@@ -269,7 +419,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* If it's a tuple replication operation */
@@ -286,7 +436,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* If it's a string replication operation */
@@ -306,7 +456,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 #endif /* HAVE_REPLICATION */
 
@@ -318,6 +468,7 @@ interpret(const uint8_t returnOnNoThreads)
             case INPLACE_DIVIDE:
             case BINARY_FLOOR_DIVIDE:
             case INPLACE_FLOOR_DIVIDE:
+            PM_TARGET(BINARY_DIVIDE)
 
 #ifdef HAVE_FLOAT
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
@@ -327,7 +478,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 #endif /* HAVE_FLOAT */
 
@@ -352,10 +503,11 @@ interpret(const uint8_t returnOnNoThreads)
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP--;
                 TOS = pobj3;
-                continue;
+                PM_DISPATCH();
 
             case BINARY_MODULO:
             case INPLACE_MODULO:
+            PM_TARGET(BINARY_MODULO)
 
 #ifdef HAVE_STRING_FORMAT
                 /* If it's a string, perform string format */
@@ -365,7 +517,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 #endif /* HAVE_STRING_FORMAT */
 
@@ -377,7 +529,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 #endif /* HAVE_FLOAT */
 
@@ -402,42 +554,57 @@ interpret(const uint8_t returnOnNoThreads)
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP--;
                 TOS = pobj3;
-                continue;
+                PM_DISPATCH();
 
             case STORE_MAP:
+            PM_TARGET(STORE_MAP)
                 /* #213: Add support for Python 2.6 bytecodes */
                 C_ASSERT(OBJ_GET_TYPE(TOS2) == OBJ_TYPE_DIC);
                 retval = dict_setItem(TOS2, TOS, TOS1);
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP -= 2;
-                continue;
+                PM_DISPATCH();
 
             case BINARY_ADD:
             case INPLACE_ADD:
+            PM_TARGET(BINARY_ADD)
+
+                /* If both objs are ints, perform the op */
+                if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
+                    && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
+                {
+                    retval = int_new(((pPmInt_t)TOS1)->val +
+                                     ((pPmInt_t)TOS)->val, &pobj3);
+                    PM_BREAK_IF_ERROR(retval);
+                    PM_SP--;
+                    TOS = pobj3;
+                    PM_DISPATCH();
+                }
 
 #ifdef HAVE_FLOAT
+                /* If both objs are floats, perform the op without float_op */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
-                    || (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
+                    && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
                 {
-                    retval = float_op(TOS1, TOS, &pobj3, '+');
+                    retval = float_new(((pPmFloat_t)TOS1)->val +
+                                       ((pPmFloat_t)TOS)->val, &pobj3);
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
-#endif /* HAVE_FLOAT */
 
-                /* If both objs are ints, perform the op */
-                if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
-                    && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
+                /* Mixed int and float */
+                if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
+                    || (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
                 {
-                    retval = int_new(((pPmInt_t)TOS1)->val +
-                                     ((pPmInt_t)TOS)->val, &pobj3);
+                    retval = float_op(TOS1, TOS, &pobj3, '+');
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
+#endif /* HAVE_FLOAT */
 
                 /* #242: If both objs are strings, perform concatenation */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_STR)
@@ -449,7 +616,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* Otherwise raise a TypeError */
@@ -458,36 +625,51 @@ interpret(const uint8_t returnOnNoThreads)
 
             case BINARY_SUBTRACT:
             case INPLACE_SUBTRACT:
+            PM_TARGET(BINARY_SUBTRACT)
+
+                /* If both objs are ints, perform the op */
+                if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
+                    && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
+                {
+                    retval = int_new(((pPmInt_t)TOS1)->val -
+                                     ((pPmInt_t)TOS)->val, &pobj3);
+                    PM_BREAK_IF_ERROR(retval);
+                    PM_SP--;
+                    TOS = pobj3;
+                    PM_DISPATCH();
+                }
 
 #ifdef HAVE_FLOAT
+                /* If both objs are floats, perform the op without float_op */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
-                    || (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
+                    && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
                 {
-                    retval = float_op(TOS1, TOS, &pobj3, '-');
+                    retval = float_new(((pPmFloat_t)TOS1)->val -
+                                       ((pPmFloat_t)TOS)->val, &pobj3);
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
-#endif /* HAVE_FLOAT */
 
-                /* If both objs are ints, perform the op */
-                if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
-                    && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
+                /* Mixed int and float */
+                if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
+                    || (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
                 {
-                    retval = int_new(((pPmInt_t)TOS1)->val -
-                                     ((pPmInt_t)TOS)->val, &pobj3);
+                    retval = float_op(TOS1, TOS, &pobj3, '-');
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
+#endif /* HAVE_FLOAT */
 
                 /* Otherwise raise a TypeError */
                 PM_RAISE(retval, PM_RET_EX_TYPE);
                 break;
 
             case BINARY_SUBSCR:
+            PM_TARGET(BINARY_SUBSCR)
                 /* Implements TOS = TOS1[TOS]. */
 
                 if (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_DIC)
@@ -526,7 +708,7 @@ interpret(const uint8_t returnOnNoThreads)
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP--;
                 TOS = pobj3;
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_FLOAT
             /* #213: Add support for Python 2.6 bytecodes */
@@ -538,10 +720,11 @@ interpret(const uint8_t returnOnNoThreads)
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP--;
                 TOS = pobj3;
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_FLOAT */
 
             case SLICE_0:
+            PM_TARGET(SLICE_0)
                 /* Implements TOS = TOS[:], push a copy of the sequence */
 
                 /* Create a copy if it is a list */
@@ -562,9 +745,10 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_RAISE(retval, PM_RET_EX_TYPE);
                     break;
                 }
-                continue;
+                PM_DISPATCH();
 
             case STORE_SUBSCR:
+            PM_TARGET(STORE_SUBSCR)
                 /* Implements TOS1[TOS] = TOS2 */
 
                 /* If it's a list */
@@ -584,7 +768,7 @@ interpret(const uint8_t returnOnNoThreads)
                                           TOS2);
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP -= 3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* If it's a dict */
@@ -594,7 +778,7 @@ interpret(const uint8_t returnOnNoThreads)
                     retval = dict_setItem(TOS1, TOS, TOS2);
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP -= 3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
 #ifdef HAVE_BYTEARRAY
@@ -627,7 +811,7 @@ interpret(const uint8_t returnOnNoThreads)
                                                TOS2);
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP -= 3;
-                    continue;
+                    PM_DISPATCH();
                 }
 #endif /* HAVE_BYTEARRAY */
 
@@ -659,11 +843,12 @@ interpret(const uint8_t returnOnNoThreads)
 
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP -= 2;
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_DEL */
 
             case BINARY_LSHIFT:
             case INPLACE_LSHIFT:
+            PM_TARGET(BINARY_LSHIFT)
                 /* If both objs are ints, perform the op */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
                     && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
@@ -673,7 +858,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* Otherwise raise a TypeError */
@@ -682,6 +867,7 @@ interpret(const uint8_t returnOnNoThreads)
 
             case BINARY_RSHIFT:
             case INPLACE_RSHIFT:
+            PM_TARGET(BINARY_RSHIFT)
                 /* If both objs are ints, perform the op */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
                     && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
@@ -691,7 +877,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* Otherwise raise a TypeError */
@@ -700,6 +886,7 @@ interpret(const uint8_t returnOnNoThreads)
 
             case BINARY_AND:
             case INPLACE_AND:
+            PM_TARGET(BINARY_AND)
                 /* If both objs are ints, perform the op */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
                     && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
@@ -709,7 +896,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* Otherwise raise a TypeError */
@@ -718,6 +905,7 @@ interpret(const uint8_t returnOnNoThreads)
 
             case BINARY_XOR:
             case INPLACE_XOR:
+            PM_TARGET(BINARY_XOR)
                 /* If both objs are ints, perform the op */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
                     && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
@@ -727,7 +915,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* Otherwise raise a TypeError */
@@ -736,6 +924,7 @@ interpret(const uint8_t returnOnNoThreads)
 
             case BINARY_OR:
             case INPLACE_OR:
+            PM_TARGET(BINARY_OR)
                 /* If both objs are ints, perform the op */
                 if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
                     && (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_INT))
@@ -745,7 +934,7 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_BREAK_IF_ERROR(retval);
                     PM_SP--;
                     TOS = pobj3;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* Otherwise raise a TypeError */
@@ -771,7 +960,7 @@ interpret(const uint8_t returnOnNoThreads)
                 PM_SP--;
                 if (bc != PRINT_EXPR)
                 {
-                    continue;
+                    PM_DISPATCH();
                 }
                 /* If PRINT_EXPR, Fallthrough to print a newline */
 
@@ -783,10 +972,11 @@ interpret(const uint8_t returnOnNoThreads)
                     gVmGlobal.somethingPrinted = C_FALSE;
                 }
                 PM_BREAK_IF_ERROR(retval);
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_PRINT */
 
             case BREAK_LOOP:
+            PM_TARGET(BREAK_LOOP)
             {
                 pPmBlock_t pb1 = PM_FP->fo_blockstack;
 
@@ -816,15 +1006,17 @@ interpret(const uint8_t returnOnNoThreads)
                 retval = heap_freeChunk((pPmObj_t)pb1);
                 PM_BREAK_IF_ERROR(retval);
             }
-                continue;
+                PM_DISPATCH();
 
             case LOAD_LOCALS:
+            PM_TARGET(LOAD_LOCALS)
                 /* Pushes local attrs dict of current frame */
                 /* WARNING: does not copy fo_locals to attrs */
                 PM_PUSH((pPmObj_t)PM_FP->fo_attrs);
-                continue;
+                PM_DISPATCH();
 
             case RETURN_VALUE:
+            PM_TARGET(RETURN_VALUE)
                 /* Get expiring frame's TOS */
                 pobj2 = PM_POP();
 
@@ -855,6 +1047,7 @@ interpret(const uint8_t returnOnNoThreads)
 
                 /* Otherwise return to previous frame */
                 PM_FP = PM_FP->fo_back;
+                heap_gcFrameBarrier(PM_FP);
 
 #ifdef HAVE_GENERATORS
                 /* If returning function was a generator */
@@ -894,7 +1087,7 @@ interpret(const uint8_t returnOnNoThreads)
 
                 /* Deallocate expired frame */
                 PM_BREAK_IF_ERROR(heap_freeChunk(pobj1));
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_IMPORTS
             case IMPORT_STAR:
@@ -907,7 +1100,7 @@ interpret(const uint8_t returnOnNoThreads)
                                      (pPmObj_t)((pPmFunc_t)TOS)->f_attrs);
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP--;
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_IMPORTS */
 
 #ifdef HAVE_GENERATORS
@@ -926,13 +1119,15 @@ interpret(const uint8_t returnOnNoThreads)
 
                 /* Return to previous frame */
                 PM_FP = PM_FP->fo_back;
+                heap_gcFrameBarrier(PM_FP);
 
                 /* Push yield value onto caller's TOS */
                 PM_PUSH(pobj1);
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_GENERATORS */
 
             case POP_BLOCK:
+            PM_TARGET(POP_BLOCK)
                 /* Get ptr to top block */
                 pobj1 = (pPmObj_t)PM_FP->fo_blockstack;
 
@@ -947,7 +1142,7 @@ interpret(const uint8_t returnOnNoThreads)
                 PM_IP = ((pPmBlock_t)pobj1)->b_handler;
 
                 PM_BREAK_IF_ERROR(heap_freeChunk(pobj1));
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_CLASSES
             case BUILD_CLASS:
@@ -956,7 +1151,7 @@ interpret(const uint8_t returnOnNoThreads)
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP -= 2;
                 TOS = pobj2;
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_CLASSES */
 
 
@@ -966,6 +1161,7 @@ interpret(const uint8_t returnOnNoThreads)
              **************************************************/
 
             case STORE_NAME:
+            PM_TARGET(STORE_NAME)
                 /* Get name index */
                 t16 = GET_ARG();
 
@@ -976,7 +1172,7 @@ interpret(const uint8_t returnOnNoThreads)
                 retval = dict_setItem((pPmObj_t)PM_FP->fo_attrs, pobj2, TOS);
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP--;
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_DEL
             case DELETE_NAME:
@@ -989,10 +1185,11 @@ interpret(const uint8_t returnOnNoThreads)
                 /* Remove key,val pair from current frame's attrs dict */
                 retval = dict_delItem((pPmObj_t)PM_FP->fo_attrs, pobj2);
                 PM_BREAK_IF_ERROR(retval);
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_DEL */
 
             case UNPACK_SEQUENCE:
+            PM_TARGET(UNPACK_SEQUENCE)
                 /* Get ptr to sequence */
                 pobj1 = PM_POP();
 
@@ -1038,9 +1235,10 @@ interpret(const uint8_t returnOnNoThreads)
 
                 /* Test again outside the for loop */
                 PM_BREAK_IF_ERROR(retval);
-                continue;
+                PM_DISPATCH();
 
             case FOR_ITER:
+            PM_TARGET(FOR_ITER)
                 t16 = GET_ARG();
 
 #ifdef HAVE_GENERATORS
@@ -1073,15 +1271,16 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_SP--;
                     retval = PM_RET_OK;
                     PM_IP += t16;
-                    continue;
+                    PM_DISPATCH();
                 }
                 PM_BREAK_IF_ERROR(retval);
 
                 /* Push the next item onto the stack */
                 PM_PUSH(pobj2);
-                continue;
+                PM_DISPATCH();
 
             case STORE_ATTR:
+            PM_TARGET(STORE_ATTR)
                 /* TOS.name = TOS1 */
                 /* Get names index */
                 t16 = GET_ARG();
@@ -1129,7 +1328,7 @@ interpret(const uint8_t returnOnNoThreads)
                 retval = dict_setItem(pobj2, pobj3, TOS1);
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP -= 2;
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_DEL
             case DELETE_ATTR:
@@ -1187,10 +1386,11 @@ interpret(const uint8_t returnOnNoThreads)
 
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP--;
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_DEL */
 
             case STORE_GLOBAL:
+            PM_TARGET(STORE_GLOBAL)
                 /* Get name index */
                 t16 = GET_ARG();
 
@@ -1201,7 +1401,7 @@ interpret(const uint8_t returnOnNoThreads)
                 retval = dict_setItem((pPmObj_t)PM_FP->fo_globals, pobj2, TOS);
                 PM_BREAK_IF_ERROR(retval);
                 PM_SP--;
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_DEL
             case DELETE_GLOBAL:
@@ -1214,10 +1414,11 @@ interpret(const uint8_t returnOnNoThreads)
                 /* Remove key,val from globals */
                 retval = dict_delItem((pPmObj_t)PM_FP->fo_globals, pobj2);
                 PM_BREAK_IF_ERROR(retval);
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_DEL */
 
             case DUP_TOPX:
+            PM_TARGET(DUP_TOPX)
                 t16 = GET_ARG();
                 C_ASSERT(t16 <= 3);
 
@@ -1230,17 +1431,19 @@ interpret(const uint8_t returnOnNoThreads)
                     PM_PUSH(pobj2);
                 if (t16 >= 1)
                     PM_PUSH(pobj1);
-                continue;
+                PM_DISPATCH();
 
             case LOAD_CONST:
+            PM_TARGET(LOAD_CONST)
                 /* Get const's index in CO */
                 t16 = GET_ARG();
 
                 /* Push const on stack */
                 PM_PUSH(PM_FP->fo_func->f_co->co_consts->val[t16]);
-                continue;
+                PM_DISPATCH();
 
             case LOAD_NAME:
+            PM_TARGET(LOAD_NAME)
                 /* Get name index */
                 t16 = GET_ARG();
 
@@ -1270,9 +1473,10 @@ interpret(const uint8_t returnOnNoThreads)
                 }
                 PM_BREAK_IF_ERROR(retval);
                 PM_PUSH(pobj2);
-                continue;
+                PM_DISPATCH();
 
             case BUILD_TUPLE:
+            PM_TARGET(BUILD_TUPLE)
                 /* Get num items */
                 t16 = GET_ARG();
                 retval = tuple_new(t16, &pobj1);
@@ -1284,9 +1488,10 @@ interpret(const uint8_t returnOnNoThreads)
                     ((pPmTuple_t)pobj1)->val[t16] = PM_POP();
                 }
                 PM_PUSH(pobj1);
-                continue;
+                PM_DISPATCH();
 
             case BUILD_LIST:
+            PM_TARGET(BUILD_LIST)
                 t16 = GET_ARG();
                 retval = list_new(&pobj1);
                 PM_BREAK_IF_ERROR(retval);
@@ -1304,17 +1509,19 @@ interpret(const uint8_t returnOnNoThreads)
 
                 /* push list onto stack */
                 PM_PUSH(pobj1);
-                continue;
+                PM_DISPATCH();
 
             case BUILD_MAP:
+            PM_TARGET(BUILD_MAP)
                 /* Argument is ignored */
                 t16 = GET_ARG();
                 retval = dict_new(&pobj1);
                 PM_BREAK_IF_ERROR(retval);
                 PM_PUSH(pobj1);
-                continue;
+                PM_DISPATCH();
 
             case LOAD_ATTR:
+            PM_TARGET(LOAD_ATTR)
                 /* Implements TOS.attr */
                 t16 = GET_ARG();
 
@@ -1393,23 +1600,13 @@ interpret(const uint8_t returnOnNoThreads)
 
                 /* Put attr on the stack */
                 TOS = pobj3;
-                continue;
+                PM_DISPATCH();
 
             case COMPARE_OP:
+            PM_TARGET(COMPARE_OP)
                 retval = PM_RET_OK;
                 t16 = GET_ARG();
 
-#ifdef HAVE_FLOAT
-                if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
-                    || (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
-                {
-                    retval = float_compare(TOS1, TOS, &pobj3, (PmCompare_t)t16);
-                    PM_SP--;
-                    TOS = pobj3;
-                    continue;
-                }
-#endif /* HAVE_FLOAT */
-
                 /* Handle all integer-to-integer (or bool) comparisons */
                 if (((OBJ_GET_TYPE(TOS) == OBJ_TYPE_INT)
                      || (OBJ_GET_TYPE(TOS) == OBJ_TYPE_BOOL))
@@ -1445,6 +1642,15 @@ interpret(const uint8_t returnOnNoThreads)
                     pobj3 = (t8) ? PM_TRUE : PM_FALSE;
                 }
 
+#ifdef HAVE_FLOAT
+                else if ((OBJ_GET_TYPE(TOS) == OBJ_TYPE_FLT)
+                         || (OBJ_GET_TYPE(TOS1) == OBJ_TYPE_FLT))
+                {
+                    retval = float_compare(TOS1, TOS, &pobj3, (PmCompare_t)t16);
+                    PM_BREAK_IF_ERROR(retval);
+                }
+#endif /* HAVE_FLOAT */
+
                 /* Handle non-integer comparisons */
                 else
                 {
@@ -1494,9 +1700,10 @@ interpret(const uint8_t returnOnNoThreads)
                 }
                 PM_SP--;
                 TOS = pobj3;
-                continue;
+                PM_DISPATCH();
 
             case IMPORT_NAME:
+            PM_TARGET(IMPORT_NAME)
                 /* Get name index */
                 t16 = GET_ARG();
 
@@ -1517,7 +1724,7 @@ interpret(const uint8_t returnOnNoThreads)
                     && (OBJ_GET_TYPE(pobj2) == OBJ_TYPE_MOD))
                 {
                     TOS = pobj2;
-                    continue;
+                    PM_DISPATCH();
                 }
 
                 /* Load module from image */
@@ -1544,7 +1751,8 @@ interpret(const uint8_t returnOnNoThreads)
 
                 /* Set new frame */
                 PM_FP = (pPmFrame_t)pobj3;
-                continue;
+                heap_gcFrameBarrier(PM_FP);
+                PM_DISPATCH();
 
 #ifdef HAVE_IMPORTS
             case IMPORT_FROM:
@@ -1564,40 +1772,92 @@ interpret(const uint8_t returnOnNoThreads)
 
                 /* Push the object onto the top of the stack */
                 PM_PUSH(pobj3);
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_IMPORTS */
 
             case JUMP_FORWARD:
+            PM_TARGET(JUMP_FORWARD)
                 t16 = GET_ARG();
                 PM_IP += t16;
-                continue;
+                PM_DISPATCH();
 
             case JUMP_IF_FALSE:
+            PM_TARGET(JUMP_IF_FALSE)
                 t16 = GET_ARG();
                 if (obj_isFalse(TOS))
                 {
                     PM_IP += t16;
                 }
-                continue;
+                PM_DISPATCH();
 
             case JUMP_IF_TRUE:
+            PM_TARGET(JUMP_IF_TRUE)
                 t16 = GET_ARG();
                 if (!obj_isFalse(TOS))
                 {
                     PM_IP += t16;
                 }
-                continue;
+                PM_DISPATCH();
 
             case JUMP_ABSOLUTE:
             case CONTINUE_LOOP:
+            PM_TARGET(JUMP_ABSOLUTE)
                 /* Get target offset (bytes) */
                 t16 = GET_ARG();
 
                 /* Jump to base_ip + arg */
                 PM_IP = PM_FP->fo_func->f_co->co_codeaddr + t16;
-                continue;
+                PM_DISPATCH();
+
+            /* Python 2.7 conditional jumps go to base_ip + arg */
+            case POP_JUMP_IF_FALSE:
+            PM_TARGET(POP_JUMP_IF_FALSE)
+                t16 = GET_ARG();
+                pobj1 = PM_POP();
+                if (obj_isFalse(pobj1))
+                {
+                    PM_IP = PM_FP->fo_func->f_co->co_codeaddr + t16;
+                }
+                PM_DISPATCH();
+
+            case POP_JUMP_IF_TRUE:
+            PM_TARGET(POP_JUMP_IF_TRUE)
+                t16 = GET_ARG();
+                pobj1 = PM_POP();
+                if (!obj_isFalse(pobj1))
+                {
+                    PM_IP = PM_FP->fo_func->f_co->co_codeaddr + t16;
+                }
+                PM_DISPATCH();
+
+            case JUMP_IF_FALSE_OR_POP:
+            PM_TARGET(JUMP_IF_FALSE_OR_POP)
+                t16 = GET_ARG();
+                if (obj_isFalse(TOS))
+                {
+                    PM_IP = PM_FP->fo_func->f_co->co_codeaddr + t16;
+                }
+                else
+                {
+                    PM_SP--;
+                }
+                PM_DISPATCH();
+
+            case JUMP_IF_TRUE_OR_POP:
+            PM_TARGET(JUMP_IF_TRUE_OR_POP)
+                t16 = GET_ARG();
+                if (!obj_isFalse(TOS))
+                {
+                    PM_IP = PM_FP->fo_func->f_co->co_codeaddr + t16;
+                }
+                else
+                {
+                    PM_SP--;
+                }
+                PM_DISPATCH();
 
             case LOAD_GLOBAL:
+            PM_TARGET(LOAD_GLOBAL)
                 /* Get name */
                 t16 = GET_ARG();
                 pobj1 = PM_FP->fo_func->f_co->co_names->val[t16];
@@ -1620,9 +1880,10 @@ interpret(const uint8_t returnOnNoThreads)
                 }
                 PM_BREAK_IF_ERROR(retval);
                 PM_PUSH(pobj2);
-                continue;
+                PM_DISPATCH();
 
             case SETUP_LOOP:
+            PM_TARGET(SETUP_LOOP)
             {
                 uint8_t *pchunk;
 
@@ -1645,24 +1906,26 @@ interpret(const uint8_t returnOnNoThreads)
                 /* Insert block into blockstack */
                 ((pPmBlock_t)pobj1)->next = PM_FP->fo_blockstack;
                 PM_FP->fo_blockstack = (pPmBlock_t)pobj1;
-                continue;
+                PM_DISPATCH();
             }
 
             case LOAD_FAST:
+            PM_TARGET(LOAD_FAST)
                 t16 = GET_ARG();
                 PM_PUSH(PM_FP->fo_locals[t16]);
-                continue;
+                PM_DISPATCH();
 
             case STORE_FAST:
+            PM_TARGET(STORE_FAST)
                 t16 = GET_ARG();
                 PM_FP->fo_locals[t16] = PM_POP();
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_DEL
             case DELETE_FAST:
                 t16 = GET_ARG();
                 PM_FP->fo_locals[t16] = PM_NONE;
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_DEL */
 
 #ifdef HAVE_ASSERT
@@ -1709,6 +1972,7 @@ interpret(const uint8_t returnOnNoThreads)
 #endif /* HAVE_ASSERT */
 
             case CALL_FUNCTION:
+            PM_TARGET(CALL_FUNCTION)
                 /* Get num args */
                 t16 = GET_ARG();
 
@@ -1807,7 +2071,7 @@ interpret(const uint8_t returnOnNoThreads)
 
                         /* Otherwise, continue with instance */
                         heap_gcPopTempRoot(objid);
-                        continue;
+                        PM_DISPATCH();
                     }
                     else if (retval != PM_RET_OK)
                     {
@@ -1979,6 +2243,7 @@ CALL_FUNC_FOR_ITER:
 
                     /* Set new frame */
                     PM_FP = (pPmFrame_t)pobj2;
+                    heap_gcFrameBarrier(PM_FP);
                 }
 
                 /* If it's native func */
@@ -1994,12 +2259,24 @@ CALL_FUNC_FOR_ITER:
                         gVmGlobal.nativeframe.nf_locals[t16] = PM_POP();
                     }
 
+                    /*
+                     * Set flag, so the GC knows a native session is active.
+                     * The args are only held by the native frame from here,
+                     * the last native's return obj may have been freed.
+                     */
+                    gVmGlobal.nativeframe.nf_stack = PM_NONE;
+                    gVmGlobal.nativeframe.nf_active = C_TRUE;
+
 #ifdef HAVE_GC
                     /* If the heap is low on memory, run the GC */
                     if (heap_getAvail() < HEAP_GC_NF_THRESHOLD)
                     {
                         retval = heap_gcRun();
-                        PM_GOTO_IF_ERROR(retval, CALL_FUNC_CLEANUP);
+                        if (retval != PM_RET_OK)
+                        {
+                            gVmGlobal.nativeframe.nf_active = C_FALSE;
+                            goto CALL_FUNC_CLEANUP;
+                        }
                     }
 #endif /* HAVE_GC */
 
@@ -2010,9 +2287,6 @@ CALL_FUNC_FOR_ITER:
                     pobj2 = (pPmObj_t)((pPmFunc_t)pobj1)->f_co;
                     t16 = ((pPmNo_t)pobj2)->no_funcindx;
 
-                    /* Set flag, so the GC knows a native session is active */
-                    gVmGlobal.nativeframe.nf_active = C_TRUE;
-
                     /*
                      * CALL NATIVE FXN: pass caller's frame and numargs
                      */
@@ -2053,6 +2327,7 @@ CALL_FUNC_FOR_ITER:
                     /* If the frame pointer was switched, do nothing to TOS */
                     if (retval == PM_RET_FRAME_SWITCH)
                     {
+                        heap_gcFrameBarrier(PM_FP);
                         retval = PM_RET_OK;
                     }
 
@@ -2065,9 +2340,10 @@ CALL_FUNC_FOR_ITER:
 CALL_FUNC_CLEANUP:
                 heap_gcPopTempRoot(objid);
                 PM_BREAK_IF_ERROR(retval);
-                continue;
+                PM_DISPATCH();
 
             case MAKE_FUNCTION:
+            PM_TARGET(MAKE_FUNCTION)
                 /* Get num default args to fxn */
                 t16 = GET_ARG();
 
@@ -2110,7 +2386,7 @@ CALL_FUNC_CLEANUP:
 
                 /* Push func obj */
                 PM_PUSH(pobj2);
-                continue;
+                PM_DISPATCH();
 
 #ifdef HAVE_CLOSURES
             case MAKE_CLOSURE:
@@ -2140,7 +2416,7 @@ CALL_FUNC_CLEANUP:
 
                 /* Push new func with closure */
                 PM_PUSH(pobj2);
-                continue;
+                PM_DISPATCH();
 
             case LOAD_CLOSURE:
             case LOAD_DEREF:
@@ -2153,13 +2429,13 @@ CALL_FUNC_CLEANUP:
                     break;
                 }
                 PM_PUSH(pobj1);
-                continue;
+                PM_DISPATCH();
 
             case STORE_DEREF:
                 /* Stores TOS into the i'th cell of free variable storage */
                 t16 = GET_ARG();
                 PM_FP->fo_locals[PM_FP->fo_func->f_co->co_nlocals + t16] = PM_POP();
-                continue;
+                PM_DISPATCH();
 #endif /* HAVE_CLOSURES */
 
 
@@ -2184,6 +2460,7 @@ CALL_FUNC_CLEANUP:
                         /* Resume execution where the block handler says */
                         /* Set PM_FP first, so PM_SP and PM_IP are set in the frame */
                         PM_FP = (pPmFrame_t)pobj1;
+                        heap_gcFrameBarrier(PM_FP);
                         PM_SP = ((pPmBlock_t)pobj2)->b_sp;
                         PM_IP = ((pPmBlock_t)pobj2)->b_handler;
                         ((pPmFrame_t)pobj1)->fo_blockstack =
@@ -2254,6 +2531,7 @@ interp_reschedule(void)
                               &pobj);
         gVmGlobal.pthread = (pPmThread_t)pobj;
         PM_RETURN_IF_ERROR(retval);
+        heap_gcFrameBarrier(PM_FP);
     }
 
     /* Clear flag to indicate a reschedule has occurred */
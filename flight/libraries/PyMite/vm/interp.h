@@ -200,7 +200,7 @@ typedef enum PmBcode_e
     DELETE_NAME,
     UNPACK_SEQUENCE,
     FOR_ITER,
-    UNUSED_5E,
+    LIST_APPEND_N,              /* Python 2.7 LIST_APPEND */
     STORE_ATTR,
     DELETE_ATTR,                /* 0x60 */
     STORE_GLOBAL,
@@ -215,15 +215,15 @@ typedef enum PmBcode_e
     COMPARE_OP,
     IMPORT_NAME,
     IMPORT_FROM,
-    UNUSED_6D,
+    JUMP_IF_FALSE_OR_POP,       /* Python 2.7, absolute */
     JUMP_FORWARD,               /* d110 */
     JUMP_IF_FALSE,
     JUMP_IF_TRUE,               /* 0x70 */
     JUMP_ABSOLUTE,
-    UNUSED_72,
-    UNUSED_73,
+    POP_JUMP_IF_FALSE,          /* Python 2.7, absolute */
+    POP_JUMP_IF_TRUE,           /* Python 2.7, absolute */
     LOAD_GLOBAL,
-    UNUSED_75,
+    JUMP_IF_TRUE_OR_POP,        /* Python 2.7, absolute */
     UNUSED_76,
     CONTINUE_LOOP,
     SETUP_LOOP,                 /* d120 */
@@ -50,6 +50,10 @@ mod_new(pPmObj_t pco, pPmObj_t *pmod)
     OBJ_SET_TYPE(*pmod, OBJ_TYPE_MOD);
     ((pPmFunc_t)*pmod)->f_co = (pPmCo_t)pco;
 
+    /* Set these to null in case a GC occurs before the dict is alloc'd */
+    ((pPmFunc_t)*pmod)->f_attrs = C_NULL;
+    ((pPmFunc_t)*pmod)->f_globals = C_NULL;
+
 #ifdef HAVE_DEFAULTARGS
     /* Clear the default args (only used by funcs) */
     ((pPmFunc_t)*pmod)->f_defaultargs = C_NULL;
@@ -72,6 +72,7 @@ pm_run(uint8_t const *modstr)
     pPmObj_t pmod;
     pPmObj_t pstring;
     uint8_t const *pmodstr = modstr;
+    uint8_t objid;
 
     /* Import module from global struct */
     retval = string_new(&pmodstr, &pstring);
@@ -79,12 +80,20 @@ pm_run(uint8_t const *modstr)
     retval = mod_import(pstring, &pmod);
     PM_RETURN_IF_ERROR(retval);
 
+    /*
+     * Nothing refers to the module until its thread is added, keep it from
+     * being collected while the builtins run and the thread is made.
+     */
+    heap_gcPushTempRoot(pmod, &objid);
+
     /* Load builtins into thread */
     retval = global_setBuiltins((pPmFunc_t)pmod);
-    PM_RETURN_IF_ERROR(retval);
-
-    /* Interpret the module's bcode */
-    retval = interp_addThread((pPmFunc_t)pmod);
+    if (retval == PM_RET_OK)
+    {
+        /* Interpret the module's bcode */
+        retval = interp_addThread((pPmFunc_t)pmod);
+    }
+    heap_gcPopTempRoot(objid);
     PM_RETURN_IF_ERROR(retval);
     retval = interpret(INTERP_RETURN_ON_NO_THREADS);
 
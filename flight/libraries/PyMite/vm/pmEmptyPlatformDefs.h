@@ -35,4 +35,18 @@
 #define PM_PLAT_HEAP_ATTR
 #endif
 
+/**
+ * Define the range of the small ints that int_new() returns from a static
+ * cache instead of allocating them in the heap.
+ * If not defined, cache -5 through 64.
+ * The range must include -1, 0 and 1.
+ */
+#if !defined(PM_INT_CACHE_MIN) || defined(__DOXYGEN__)
+#define PM_INT_CACHE_MIN (-5)
+#endif
+
+#if !defined(PM_INT_CACHE_MAX) || defined(__DOXYGEN__)
+#define PM_INT_CACHE_MAX 64
+#endif
+
 #endif /* __PM_EMPTY_PLATFORM_DEFS_H__ */
@@ -46,6 +46,17 @@
  * will occur.
  *
  *
+ * HAVE_GC_INCREMENTAL
+ * -------------------
+ *
+ * When defined, the garbage collector marks and sweeps the heap in small
+ * steps taken on each allocation once the free heap drops below
+ * PM_GC_START_THRESHOLD, instead of stopping the interpreter for a whole
+ * collection when the heap is exhausted.  The work of one step is limited by
+ * PM_GC_STEP_WORK, which may be set in plat.h or at run time with
+ * heap_gcSetStepWork().  Pause statistics are kept by the heap.
+ *
+ *
  * HAVE_FLOAT
  * ----------
  *
@@ -154,6 +165,11 @@
 
 /* Check for dependencies */
 
+#if defined(HAVE_GC_INCREMENTAL) && !defined(HAVE_GC)
+#error HAVE_GC_INCREMENTAL requires HAVE_GC
+#endif
+
+
 #if defined(HAVE_ASSERT) && !defined(HAVE_CLASSES)
 #error HAVE_ASSERT requires HAVE_CLASSES
 #endif
@@ -71,6 +71,20 @@ seglist_clear(pSeglist_t pseglist)
     pSegment_t pseg1 = C_NULL;
     pSegment_t pseg2 = C_NULL;
 
+#ifdef HAVE_GC_INCREMENTAL
+    uint8_t i;
+
+    /* The items are dropped, let a mark in progress see them */
+    for (pseg1 = ((pSeglist_t)pseglist)->sl_rootseg; pseg1 != C_NULL;
+         pseg1 = pseg1->next)
+    {
+        for (i = 0; i < SEGLIST_OBJS_PER_SEG; i++)
+        {
+            heap_gcWriteBarrier(pseg1->s_val[i]);
+        }
+    }
+#endif /* HAVE_GC_INCREMENTAL */
+
 #if SEGLIST_CLEAR_SEGMENTS
     /* Deallocate all linked segments */
     pseg1 = ((pSeglist_t)pseglist)->sl_rootseg;
@@ -225,6 +239,12 @@ seglist_insertItem(pSeglist_t pseglist, pPmObj_t pobj, int16_t index)
     {
         pobj2 = pseg->s_val[indx];
         pseg->s_val[indx] = pobj1;
+
+        /* An item moving on to the next seg may leave a scanned seg */
+        if (indx == (SEGLIST_OBJS_PER_SEG - 1))
+        {
+            heap_gcWriteBarrier(pobj2);
+        }
         pobj1 = pobj2;
         indx++;
 
@@ -275,6 +295,7 @@ seglist_setItem(pSeglist_t pseglist, pPmObj_t pobj, int16_t index)
     }
 
     /* Set item in this seg at the index */
+    heap_gcWriteBarrier(pseg->s_val[index % SEGLIST_OBJS_PER_SEG]);
     pseg->s_val[index % SEGLIST_OBJS_PER_SEG] = pobj;
     return PM_RET_OK;
 }
@@ -298,6 +319,9 @@ seglist_removeItem(pSeglist_t pseglist, uint16_t index)
         C_ASSERT(pseg != C_NULL);
     }
 
+    /* The removed item may be referenced from nowhere else */
+    heap_gcWriteBarrier(pseg->s_val[index % SEGLIST_OBJS_PER_SEG]);
+
     /*
      * pseg now points to the correct segment of the item to be removed, so
      * start ripple copying all following items up to the last
@@ -311,7 +335,8 @@ seglist_removeItem(pSeglist_t pseglist, uint16_t index)
         /* Copy element i+1 to slot i */
         if ((k + 1) == SEGLIST_OBJS_PER_SEG)
         {
-            /* Source is first item in next segment */
+            /* Source is first item in next segment, it may not be scanned */
+            heap_gcWriteBarrier((pseg->next)->s_val[0]);
             pseg->s_val[i % SEGLIST_OBJS_PER_SEG] = (pseg->next)->s_val[0];
             pseg = pseg->next;
         }
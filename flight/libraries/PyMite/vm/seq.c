@@ -220,6 +220,7 @@ seqiter_getNext(pPmObj_t pobj, pPmObj_t *r_pitem)
     if (((pPmSeqIter_t)pobj)->si_index == length)
     {
         /* Make null the pointer to the sequence */
+        heap_gcWriteBarrier(((pPmSeqIter_t)pobj)->si_sequence);
         ((pPmSeqIter_t)pobj)->si_sequence = C_NULL;
         PM_RAISE(retval, PM_RET_EX_STOP);
         return retval;
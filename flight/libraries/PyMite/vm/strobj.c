@@ -102,7 +102,8 @@ string_create(PmMemSpace_t memspace, uint8_t const **paddr, int16_t len,
             /* Free the string */
             retval = heap_freeChunk((pPmObj_t)pstr);
 
-            /* Return ptr to old */
+            /* Return ptr to old, it may be garbage a collection has not reclaimed yet */
+            heap_gcRevive((pPmObj_t)pcacheentry);
             *r_pstring = (pPmObj_t)pcacheentry;
             return retval;
         }
@@ -301,7 +302,8 @@ string_concat(pPmString_t pstr1, pPmString_t pstr2, pPmObj_t *r_pstring)
             /* Free the string */
             retval = heap_freeChunk((pPmObj_t)pstr);
 
-            /* Return ptr to old */
+            /* Return ptr to old, it may be garbage a collection has not reclaimed yet */
+            heap_gcRevive((pPmObj_t)pcacheentry);
             *r_pstring = (pPmObj_t)pcacheentry;
             return retval;
         }
@@ -527,7 +529,8 @@ string_format(pPmString_t pstr, pPmObj_t parg, pPmObj_t *r_pstring)
             /* Free the string */
             retval = heap_freeChunk((pPmObj_t)pnewstr);
 
-            /* Return ptr to old */
+            /* Return ptr to old, it may be garbage a collection has not reclaimed yet */
+            heap_gcRevive((pPmObj_t)pcacheentry);
             *r_pstring = (pPmObj_t)pcacheentry;
             return retval;
         }
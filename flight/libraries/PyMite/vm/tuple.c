@@ -93,7 +93,16 @@ tuple_new(uint16_t n, pPmObj_t *r_ptuple)
     /* Set the number of objs in the tuple */
     ((pPmTuple_t)*r_ptuple)->length = n;
 
+#ifdef HAVE_GC_INCREMENTAL
+    /*
+     * The ptrs are set by the caller, but an incremental GC step may scan
+     * the tuple before the caller is done, so null them
+     */
+    sli_memset((unsigned char *)((pPmTuple_t)*r_ptuple)->val, 0,
+               n * sizeof(pPmObj_t));
+#else
     /* No need to null the ptrs because they are set by the caller */
+#endif /* HAVE_GC_INCREMENTAL */
     return retval;
 }
 
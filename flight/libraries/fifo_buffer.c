@@ -273,6 +273,39 @@ uint16_t fifoBuf_putData(t_fifo_buffer *buf, const void *data, uint16_t len)
     return i; // return number of bytes copied
 }
 
+uint16_t fifoBuf_reserve(t_fifo_buffer *buf, uint16_t len, uint8_t **first, uint16_t *first_len, uint8_t **second)
+{ // hand out room for len bytes after the data, to be written in place and added with fifoBuf_commit()
+  // the room wraps around to second once first_len bytes are written at first
+    uint16_t wr       = buf->wr;
+    uint16_t buf_size = buf->buf_size;
+
+    if (len < 1 || len > fifoBuf_getFree(buf)) {
+        return 0; // return number of bytes reserved
+    }
+
+    uint16_t block_len = buf_size - wr;
+    if (block_len > len) {
+        block_len = len;
+    }
+
+    *first     = buf->buf_ptr + wr;
+    *first_len = block_len;
+    *second    = buf->buf_ptr;
+
+    return len; // return number of bytes reserved
+}
+
+void fifoBuf_commit(t_fifo_buffer *buf, uint16_t len)
+{ // add len bytes written in the room from fifoBuf_reserve() to the buffer
+    uint16_t wr = buf->wr + len;
+
+    if (wr >= buf->buf_size) {
+        wr -= buf->buf_size;
+    }
+
+    buf->wr = wr;
+}
+
 void fifoBuf_init(t_fifo_buffer *buf, const void *buffer, const uint16_t buffer_size)
 {
     buf->buf_ptr  = (uint8_t *)buffer;
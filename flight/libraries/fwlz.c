@@ -0,0 +1,378 @@
+/**
+ ******************************************************************************
+ *
+ * @file       fwlz.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+ * @brief      Compressed firmware images: the streaming decompressor used by
+ *             the bootloader and the compressor used by the uploader.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <string.h>
+
+#include "fwlz.h"
+
+// Decoder states, the errors are negative
+enum {
+    FWLZ_STATE_HEADER,
+    FWLZ_STATE_TOKEN,
+    FWLZ_STATE_LITERAL_LENGTH,
+    FWLZ_STATE_LITERALS,
+    FWLZ_STATE_OFFSET_LOW,
+    FWLZ_STATE_OFFSET_HIGH,
+    FWLZ_STATE_MATCH_LENGTH,
+    FWLZ_STATE_DONE,
+};
+
+static const uint8_t magic[4] = { 'F', 'W', 'L', 'Z' };
+
+// CRC of the STM32 CRC unit, four bits at a time
+static const uint32_t crcTable[16] = {
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9,
+    0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61,
+    0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+};
+
+uint32_t fwlz_crc32(uint32_t crc, uint32_t word)
+{
+    crc ^= word;
+    for (uint8_t i = 0; i < 8; i++) {
+        crc = (crc << 4) ^ crcTable[crc >> 28];
+    }
+    return crc;
+}
+
+/**
+ * Prepares the decoder for an image of at most maxSize bytes, the flash it
+ * programs must be erased
+ */
+void fwlz_decode_init(struct fwlz_decoder *dec, uint32_t maxSize, fwlz_program_t program, fwlz_read_t read, void *ctx)
+{
+    memset(dec, 0, sizeof(*dec));
+    dec->program = program;
+    dec->read    = read;
+    dec->ctx     = ctx;
+    dec->maxSize = maxSize;
+    dec->crc     = 0xFFFFFFFF;
+    dec->state   = FWLZ_STATE_HEADER;
+}
+
+/**
+ * True once the whole image is in flash and matches its CRC
+ */
+bool fwlz_decode_done(const struct fwlz_decoder *dec)
+{
+    return dec->state == FWLZ_STATE_DONE;
+}
+
+static int32_t flushWord(struct fwlz_decoder *dec)
+{
+    uint32_t offset = (dec->written - 1) & ~3;
+
+    if (!dec->program(dec->ctx, offset, dec->word)) {
+        return FWLZ_ERR_PROGRAM;
+    }
+    dec->crc  = fwlz_crc32(dec->crc, dec->word);
+    dec->word = 0;
+    return 0;
+}
+
+static int32_t putByte(struct fwlz_decoder *dec, uint8_t byte)
+{
+    int32_t ret;
+
+    if (dec->written >= dec->size) {
+        return FWLZ_ERR_CORRUPT;
+    }
+    dec->word |= (uint32_t)byte << (8 * (dec->written & 3));
+    dec->written++;
+
+    if ((dec->written & 3) == 0) {
+        ret = flushWord(dec);
+        if (ret < 0) {
+            return ret;
+        }
+    }
+    if (dec->written == dec->size) {
+        // The last word is padded as erased flash
+        if (dec->written & 3) {
+            dec->word |= 0xFFFFFFFF << (8 * (dec->written & 3));
+            ret = flushWord(dec);
+            if (ret < 0) {
+                return ret;
+            }
+        }
+        if (dec->crc != dec->expectedCrc) {
+            return FWLZ_ERR_CRC;
+        }
+        dec->state = FWLZ_STATE_DONE;
+    }
+    return 0;
+}
+
+/**
+ * Copies a match, the bytes of the word still being built come from it and
+ * the others are read back from flash
+ */
+static int32_t copyMatch(struct fwlz_decoder *dec)
+{
+    int32_t ret;
+
+    if ((dec->offset == 0) || (dec->offset > dec->written)) {
+        return FWLZ_ERR_CORRUPT;
+    }
+    while (dec->length > 0) {
+        uint32_t src = dec->written - dec->offset;
+        uint8_t byte;
+
+        if (src >= (dec->written & ~3)) {
+            byte = dec->word >> (8 * (src & 3));
+        } else {
+            byte = dec->read(dec->ctx, src);
+        }
+        ret = putByte(dec, byte);
+        if (ret < 0) {
+            return ret;
+        }
+        dec->length--;
+    }
+    return 0;
+}
+
+static int32_t headerByte(struct fwlz_decoder *dec, uint8_t byte)
+{
+    uint32_t n = dec->length++;
+
+    if (n < sizeof(magic)) {
+        return (byte == magic[n]) ? 0 : FWLZ_ERR_HEADER;
+    } else if (n < 8) {
+        dec->size |= (uint32_t)byte << (8 * (n - 4));
+        return 0;
+    }
+    dec->expectedCrc |= (uint32_t)byte << (8 * (n - 8));
+
+    if (dec->length == FWLZ_HEADER_SIZE) {
+        if (dec->size > dec->maxSize) {
+            return FWLZ_ERR_HEADER;
+        }
+        dec->length = 0;
+        dec->state  = FWLZ_STATE_TOKEN;
+        if ((dec->size == 0) && (dec->crc == dec->expectedCrc)) {
+            dec->state = FWLZ_STATE_DONE;
+        }
+    }
+    return 0;
+}
+
+/**
+ * Ends the literals of a sequence, the last one also ends the image
+ */
+static void endLiterals(struct fwlz_decoder *dec)
+{
+    dec->state = (dec->written == dec->size) ? FWLZ_STATE_DONE : FWLZ_STATE_OFFSET_LOW;
+}
+
+static void startMatch(struct fwlz_decoder *dec)
+{
+    dec->length = (dec->token & 0x0F) + FWLZ_MIN_MATCH;
+    dec->state  = ((dec->token & 0x0F) == 0x0F) ? FWLZ_STATE_MATCH_LENGTH : FWLZ_STATE_TOKEN;
+}
+
+/**
+ * Decompresses the next len bytes of the image straight into flash, as they
+ * arrive. Once the image is complete whatever follows is ignored.
+ * \return 0 on success, a negative FWLZ_ERR code that sticks otherwise
+ */
+int32_t fwlz_decode(struct fwlz_decoder *dec, const uint8_t *data, uint32_t len)
+{
+    int32_t ret = 0;
+
+    if (dec->state < 0) {
+        return dec->state;
+    }
+    for (uint32_t i = 0; (i < len) && (ret == 0) && (dec->state != FWLZ_STATE_DONE); i++) {
+        uint8_t byte = data[i];
+
+        switch (dec->state) {
+        case FWLZ_STATE_HEADER:
+            ret = headerByte(dec, byte);
+            break;
+        case FWLZ_STATE_TOKEN:
+            dec->token  = byte;
+            dec->length = byte >> 4;
+            if (dec->length == 0x0F) {
+                dec->state = FWLZ_STATE_LITERAL_LENGTH;
+            } else if (dec->length > 0) {
+                dec->state = FWLZ_STATE_LITERALS;
+            } else {
+                endLiterals(dec);
+            }
+            break;
+        case FWLZ_STATE_LITERAL_LENGTH:
+            dec->length += byte;
+            if (byte != 0xFF) {
+                dec->state = FWLZ_STATE_LITERALS;
+            }
+            break;
+        case FWLZ_STATE_LITERALS:
+            ret = putByte(dec, byte);
+            if ((ret == 0) && (--dec->length == 0) && (dec->state != FWLZ_STATE_DONE)) {
+                endLiterals(dec);
+            }
+            break;
+        case FWLZ_STATE_OFFSET_LOW:
+            dec->offset = byte;
+            dec->state  = FWLZ_STATE_OFFSET_HIGH;
+            break;
+        case FWLZ_STATE_OFFSET_HIGH:
+            dec->offset |= (uint16_t)byte << 8;
+            startMatch(dec);
+            if (dec->state == FWLZ_STATE_TOKEN) {
+                ret = copyMatch(dec);
+            }
+            break;
+        case FWLZ_STATE_MATCH_LENGTH:
+            dec->length += byte;
+            if (byte != 0xFF) {
+                dec->state = FWLZ_STATE_TOKEN;
+                ret = copyMatch(dec);
+            }
+            break;
+        }
+    }
+    if (ret < 0) {
+        dec->state = ret;
+    }
+    return ret;
+}
+
+#ifndef BOOTLOADER
+/* The bootloaders only ever decode, keep the compressor out of them */
+
+static uint32_t read32(const uint8_t *p)
+{
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t hash32(uint32_t v)
+{
+    return (v * 2654435761U) >> (32 - FWLZ_HASH_BITS);
+}
+
+static uint8_t *putLength(uint8_t *op, uint32_t length)
+{
+    while (length >= 0xFF) {
+        *op++   = 0xFF;
+        length -= 0xFF;
+    }
+    *op++ = length;
+    return op;
+}
+
+/**
+ * Compresses an image with a greedy parse. Not meant for the flight side,
+ * table is a work area of FWLZ_HASH_SIZE words.
+ * \return the size of the compressed image, or -1 if out is too small
+ */
+int32_t fwlz_compress(const uint8_t *in, uint32_t len, uint8_t *out, uint32_t outSize, uint32_t *table)
+{
+    uint8_t *op     = out;
+    uint32_t anchor = 0;
+    uint32_t ip     = 0;
+    uint32_t crc    = 0xFFFFFFFF;
+
+    if (outSize < FWLZ_COMPRESS_BOUND(len)) {
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < len; i += 4) {
+        uint32_t word = 0xFFFFFFFF;
+        for (uint32_t b = 0; (b < 4) && (i + b < len); b++) {
+            word &= ~((uint32_t)0xFF << (8 * b));
+            word |= (uint32_t)in[i + b] << (8 * b);
+        }
+        crc = fwlz_crc32(crc, word);
+    }
+    memcpy(op, magic, sizeof(magic));
+    op += sizeof(magic);
+    for (uint8_t b = 0; b < 4; b++) {
+        *op++ = len >> (8 * b);
+    }
+    for (uint8_t b = 0; b < 4; b++) {
+        *op++ = crc >> (8 * b);
+    }
+
+    // Positions plus one, zero is an empty slot
+    memset(table, 0, FWLZ_HASH_SIZE * sizeof(uint32_t));
+
+    while (ip + FWLZ_MIN_MATCH <= len) {
+        uint32_t v   = read32(in + ip);
+        uint32_t h   = hash32(v);
+        uint32_t ref = table[h];
+
+        table[h] = ip + 1;
+        if ((ref == 0) || (ip - (ref - 1) > FWLZ_MAX_OFFSET) || (read32(in + ref - 1) != v)) {
+            ip++;
+            continue;
+        }
+        ref--;
+
+        uint32_t match = FWLZ_MIN_MATCH;
+        while ((ip + match < len) && (in[ref + match] == in[ip + match])) {
+            match++;
+        }
+
+        uint32_t literals = ip - anchor;
+        uint8_t *token    = op++;
+        *token = ((literals < 0x0F) ? literals : 0x0F) << 4;
+        if (literals >= 0x0F) {
+            op = putLength(op, literals - 0x0F);
+        }
+        memcpy(op, in + anchor, literals);
+        op   += literals;
+        *op++ = (ip - ref);
+        *op++ = (ip - ref) >> 8;
+        if (match - FWLZ_MIN_MATCH < 0x0F) {
+            *token |= match - FWLZ_MIN_MATCH;
+        } else {
+            *token |= 0x0F;
+            op = putLength(op, match - FWLZ_MIN_MATCH - 0x0F);
+        }
+
+        // Index what the match covers, for the matches to come
+        for (uint32_t p = ip + 1; (p < ip + match) && (p + FWLZ_MIN_MATCH <= len); p++) {
+            table[hash32(read32(in + p))] = p + 1;
+        }
+        ip    += match;
+        anchor = ip;
+    }
+
+    if (anchor < len) {
+        uint32_t literals = len - anchor;
+        *op++ = ((literals < 0x0F) ? literals : 0x0F) << 4;
+        if (literals >= 0x0F) {
+            op = putLength(op, literals - 0x0F);
+        }
+        memcpy(op, in + anchor, literals);
+        op += literals;
+    }
+    return op - out;
+}
+#endif /* BOOTLOADER */
@@ -90,6 +90,12 @@ void quat_inverse(float q[4]);
 void quat_copy(const float q[4], float qnew[4]);
 void quat_mult(const float q1[4], const float q2[4], float qout[4]);
 void rot_mult(float R[3][3], const float vec[3], float vec_out[3]);
+
+// ****** fused kernels for the attitude estimators, q must be a unit quaternion ********
+void Quaternion2RT(const float q[4], float Rbe[3][3], float Reb[3][3]);
+void quat_rotate_vector(const float q[4], const float vec[3], float vec_out[3]);
+void quat_rotate_vector_transpose(const float q[4], const float vec[3], float vec_out[3]);
+bool quat_integrate_normalize(float q[4], const float gyro[3], float dT);
 /**
  * matrix_mult_3x3f - perform a multiplication between two 3x3 float matrices
  * result = a*b
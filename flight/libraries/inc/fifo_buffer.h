@@ -57,6 +57,9 @@ uint16_t fifoBuf_putByte(t_fifo_buffer *buf, const uint8_t b);
 
 uint16_t fifoBuf_putData(t_fifo_buffer *buf, const void *data, uint16_t len);
 
+uint16_t fifoBuf_reserve(t_fifo_buffer *buf, uint16_t len, uint8_t **first, uint16_t *first_len, uint8_t **second);
+void fifoBuf_commit(t_fifo_buffer *buf, uint16_t len);
+
 void fifoBuf_init(t_fifo_buffer *buf, const void *buffer, const uint16_t buffer_size);
 
 // *********************
@@ -0,0 +1,111 @@
+/**
+ ******************************************************************************
+ *
+ * @file       fwlz.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+ * @brief      Compressed firmware images: the streaming decompressor used by
+ *             the bootloader and the compressor used by the uploader.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FWLZ_H
+#define FWLZ_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A compressed image is a 12 byte header followed by LZ77 sequences.
+ *
+ * The header is the magic "FWLZ", then the size of the image and the CRC of
+ * the image, both little endian. The CRC is the one of the STM32 CRC unit
+ * (polynomial 0x04C11DB7, initial value 0xFFFFFFFF) over the image as little
+ * endian words, the last one padded with 0xFF as in erased flash.
+ *
+ * Each sequence is a token, whose high nibble is the number of literals and
+ * whose low nibble is the match length minus FWLZ_MIN_MATCH, followed by the
+ * literals, a little endian 16 bit offset back into the image and the match.
+ * A nibble of 15 is extended by the bytes that follow, each added to it, up
+ * to the first one below 255.
+ * The last sequence stops after its literals, once the image is complete.
+ *
+ * Matches are copied from what was already written, so the decompressor
+ * reads its window back from flash and needs no buffer of its own.
+ */
+#define FWLZ_HEADER_SIZE 12
+#define FWLZ_MIN_MATCH   4
+#define FWLZ_MAX_OFFSET  65535
+
+// Work area of the compressor, in words
+#define FWLZ_HASH_BITS   14
+#define FWLZ_HASH_SIZE   (1 << FWLZ_HASH_BITS)
+
+// Largest compressed size of an image of n bytes
+#define FWLZ_COMPRESS_BOUND(n) (FWLZ_HEADER_SIZE + (n) + (n) / 255 + 16)
+
+#define FWLZ_ERR_HEADER  -1 // Not a compressed image, or too big
+#define FWLZ_ERR_CORRUPT -2 // Sequence outside of the image
+#define FWLZ_ERR_PROGRAM -3 // The flash did not take a word
+#define FWLZ_ERR_CRC     -4 // The image does not match its CRC
+
+/**
+ * Programs one word at offset bytes into the image, returns false when it
+ * does not read back as written
+ */
+typedef bool (*fwlz_program_t)(void *ctx, uint32_t offset, uint32_t word);
+
+/**
+ * Reads back the byte at offset bytes into the image
+ */
+typedef uint8_t (*fwlz_read_t)(void *ctx, uint32_t offset);
+
+struct fwlz_decoder {
+    fwlz_program_t program;
+    fwlz_read_t    read;
+    void     *ctx;
+    uint32_t maxSize;
+    uint32_t size;
+    uint32_t expectedCrc;
+    uint32_t crc;
+    uint32_t written;
+    uint32_t word;    // Bytes not programmed yet, little endian
+    uint32_t length;  // Literals or match left, header bytes seen
+    uint16_t offset;
+    uint8_t  token;
+    int8_t   state;
+};
+
+void fwlz_decode_init(struct fwlz_decoder *dec, uint32_t maxSize, fwlz_program_t program, fwlz_read_t read, void *ctx);
+int32_t fwlz_decode(struct fwlz_decoder *dec, const uint8_t *data, uint32_t len);
+bool fwlz_decode_done(const struct fwlz_decoder *dec);
+
+#ifndef BOOTLOADER
+int32_t fwlz_compress(const uint8_t *in, uint32_t len, uint8_t *out, uint32_t outSize, uint32_t *table);
+#endif
+uint32_t fwlz_crc32(uint32_t crc, uint32_t word);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // FWLZ_H
@@ -0,0 +1,92 @@
+/**
+ ******************************************************************************
+ *
+ * @file       logstream.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+ * @brief      Bulk readout of the onboard log: the chunks the flight side
+ *             streams and the checks the GCS runs on them.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef LOGSTREAM_H
+#define LOGSTREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A chunk is a 12 byte header followed by up to LOGSTREAM_MAX_ENTRIES
+ * consecutive log entries of one flight, each a packed DebugLogEntry.
+ *
+ * The header is the flight, the first entry, the number of entries and the
+ * flags, all 16 bit little endian, then the CRC of the chunk. The CRC is
+ * the CRC-32 (polynomial 0x04C11DB7, initial value 0xFFFFFFFF, msb first)
+ * of the chunk without the CRC field itself.
+ *
+ * Chunks are sent back to back without acks. The last one of a stream, which
+ * may hold no entries, has LOGSTREAM_FLAG_LAST set. A receiver that misses
+ * or rejects a chunk asks for a new stream from the first entry it lacks.
+ */
+#define LOGSTREAM_HEADER_SIZE            12
+#define LOGSTREAM_MAX_ENTRIES            4
+#define LOGSTREAM_CHUNK_SIZE(entrySize) (LOGSTREAM_HEADER_SIZE + LOGSTREAM_MAX_ENTRIES * (entrySize))
+
+#define LOGSTREAM_FLAG_LAST              0x0001 // No entries after this chunk
+
+#define LOGSTREAM_ERR_LENGTH             -1 // Not a whole number of entries
+#define LOGSTREAM_ERR_CRC                -2 // The chunk does not match its CRC
+
+struct logstream_header {
+    uint16_t flight;
+    uint16_t entry;
+    uint16_t count;
+    uint16_t flags;
+    uint32_t crc;
+};
+
+/**
+ * Reads one entry of a flight into out, returns false when there is none
+ */
+typedef bool (*logstream_read_t)(void *ctx, uint16_t flight, uint16_t entry, uint8_t *out);
+
+struct logstream {
+    logstream_read_t read;
+    void     *ctx;
+    uint16_t entrySize;
+    uint16_t flight;
+    uint16_t entry;     // Next entry to send
+    uint16_t remaining; // Entries left to send
+    bool     done;
+};
+
+void logstream_init(struct logstream *stream, uint16_t entrySize, logstream_read_t read, void *ctx);
+void logstream_start(struct logstream *stream, uint16_t flight, uint16_t entry, uint16_t count);
+uint32_t logstream_next(struct logstream *stream, uint8_t *chunk);
+int32_t logstream_check(const uint8_t *chunk, uint32_t length, uint16_t entrySize, struct logstream_header *header);
+uint32_t logstream_crc32(uint32_t crc, const uint8_t *data, uint32_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // LOGSTREAM_H
@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ *
+ * @file       telemetrysched.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+ * @brief      Bandwidth aware scheduling of the telemetry updates
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef TELEMETRYSCHED_H
+#define TELEMETRYSCHED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Updates wait in one ring per priority class and leave highest class
+ * first. The caller provides the rings, as deep as its event queue so that
+ * a burst of updates fits. When a class is full a periodic update is
+ * dropped, it is sent again next period anyway. Any other update is refused
+ * and has to be pushed again once the class has room. A token bucket,
+ * filled at the estimated capacity of the link, holds back the normal and
+ * low classes so that the transmit buffer of the port stays short and a
+ * high priority update never queues behind seconds of bulk data. High priority updates are never held back, they
+ * borrow from the bucket instead.
+ *
+ * The capacity starts at the nominal rate of the port. Over each window
+ * the bytes written to the port are counted: when the writer had to wait
+ * for room in the transmit buffer the link, not the bucket, was the limit
+ * and the count is a measure of what it carries. Windows where the bucket
+ * held updates back but the writer never waited let the estimate grow back
+ * towards the nominal rate.
+ *
+ * While low priority updates come faster than they leave, so that they
+ * merge while waiting, or the link is full, the periods of the low
+ * priority periodic updates are stretched, doubling per window up
+ * to TELEMETRYSCHED_MAX_SCALE, and shrunk again after
+ * TELEMETRYSCHED_CALM_WINDOWS quiet windows.
+ *
+ * All times are in ms from any free running clock.
+ */
+#define TELEMETRYSCHED_WINDOW_MS    1000 // Capacity and congestion window
+#define TELEMETRYSCHED_BURST_MS     100  // Bucket size, in ms at the link capacity
+#define TELEMETRYSCHED_MIN_RATE     50   // Floor of the capacity estimate, bytes/s
+#define TELEMETRYSCHED_MAX_SCALE    8
+#define TELEMETRYSCHED_CALM_WINDOWS 4
+
+#define TELEMETRYSCHED_COALESCED    1  // Merged with an update already waiting
+#define TELEMETRYSCHED_ERR_FULL     -1 // No room left in the class, update not queued
+
+enum telemetrysched_class {
+    TELEMETRYSCHED_HIGH = 0,
+    TELEMETRYSCHED_NORMAL,
+    TELEMETRYSCHED_LOW,
+    TELEMETRYSCHED_CLASSES
+};
+
+struct telemetrysched_item {
+    const void *obj;
+    uint16_t   instId;
+    uint8_t    event;
+    uint8_t    priority; // telemetrysched_class
+    bool       periodic; // Sent again next period, may be dropped
+    uint16_t   length;   // Bytes the update takes on the link
+    uint32_t   queued;   // When the update was first queued
+};
+
+struct telemetrysched_ring {
+    struct telemetrysched_item *items;
+    uint16_t head;
+    uint16_t count;
+};
+
+struct telemetrysched_stats {
+    uint16_t latencyMean[TELEMETRYSCHED_CLASSES]; // ms from queued to written
+    uint16_t latencyMax[TELEMETRYSCHED_CLASSES];
+    uint32_t sent[TELEMETRYSCHED_CLASSES];
+    uint32_t dropped[TELEMETRYSCHED_CLASSES]; // Periodic updates only
+    uint32_t coalesced;
+    uint32_t capacity; // bytes/s
+    uint8_t  periodScale;
+};
+
+struct telemetrysched {
+    struct telemetrysched_ring pending[TELEMETRYSCHED_CLASSES];
+    uint16_t depth;        // Updates waiting per class
+    int32_t  tokens;       // Bytes, below zero after a high priority burst
+    uint32_t capacity;     // Estimated link rate, bytes/s
+    uint32_t nominal;      // Rate of the port, bytes/s
+    uint32_t lastRefill;
+    uint32_t refillRemainder;
+
+    uint32_t windowStart;
+    uint32_t windowBytes;
+    bool     windowCongested; // The writer waited for room in the port
+    bool     windowHeld;      // The bucket held updates back
+    bool     windowThrottled; // Low priority updates came faster than they left
+    uint8_t  calmWindows;
+    uint8_t  periodScale;
+
+    uint32_t latencySum[TELEMETRYSCHED_CLASSES];
+    uint16_t latencyMax[TELEMETRYSCHED_CLASSES];
+    uint32_t sent[TELEMETRYSCHED_CLASSES];
+    uint32_t dropped[TELEMETRYSCHED_CLASSES];
+    uint32_t coalesced;
+};
+
+void telemetrysched_init(struct telemetrysched *sched, struct telemetrysched_item *items, uint16_t depth, uint32_t rate, uint32_t now);
+void telemetrysched_set_rate(struct telemetrysched *sched, uint32_t rate);
+int32_t telemetrysched_push(struct telemetrysched *sched, const struct telemetrysched_item *item);
+bool telemetrysched_pop(struct telemetrysched *sched, uint32_t now, struct telemetrysched_item *item);
+bool telemetrysched_pending(const struct telemetrysched *sched);
+void telemetrysched_sent(struct telemetrysched *sched, const struct telemetrysched_item *item, uint32_t now);
+void telemetrysched_link(struct telemetrysched *sched, uint32_t bytes, bool congested, uint32_t now);
+uint32_t telemetrysched_period(const struct telemetrysched *sched, uint8_t priority, uint32_t periodMs);
+void telemetrysched_get_stats(struct telemetrysched *sched, struct telemetrysched_stats *stats, bool reset);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TELEMETRYSCHED_H
@@ -0,0 +1,160 @@
+/**
+ ******************************************************************************
+ *
+ * @file       logstream.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+ * @brief      Bulk readout of the onboard log: the chunks the flight side
+ *             streams and the checks the GCS runs on them.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <string.h>
+
+#include "logstream.h"
+
+// Offset of the CRC field in the header
+#define CRC_OFFSET 8
+
+// Same CRC as PIOS_CRC32_updateCRC(), four bits at a time so that the GCS
+// can share it without the 1kB table
+static const uint32_t crcTable[16] = {
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9,
+    0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61,
+    0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+};
+
+uint32_t logstream_crc32(uint32_t crc, const uint8_t *data, uint32_t length)
+{
+    while (length--) {
+        crc ^= (uint32_t)*data++ << 24;
+        crc  = (crc << 4) ^ crcTable[crc >> 28];
+        crc  = (crc << 4) ^ crcTable[crc >> 28];
+    }
+    return crc;
+}
+
+static uint32_t chunkCrc(const uint8_t *chunk, uint32_t length)
+{
+    uint32_t crc = logstream_crc32(0xFFFFFFFF, chunk, CRC_OFFSET);
+
+    return logstream_crc32(crc, chunk + LOGSTREAM_HEADER_SIZE, length - LOGSTREAM_HEADER_SIZE);
+}
+
+static void put16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)(value & 0xFF);
+    p[1] = (uint8_t)((value >> 8) & 0xFF);
+}
+
+static uint16_t get16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/**
+ * Prepares a stream of entries of entrySize bytes, read by read
+ */
+void logstream_init(struct logstream *stream, uint16_t entrySize, logstream_read_t read, void *ctx)
+{
+    memset(stream, 0, sizeof(*stream));
+    stream->read = read;
+    stream->ctx  = ctx;
+    stream->entrySize = entrySize;
+    stream->done = true;
+}
+
+/**
+ * Restarts the stream at an entry of a flight, for count entries or up to
+ * the last entry of the flight when count is zero
+ */
+void logstream_start(struct logstream *stream, uint16_t flight, uint16_t entry, uint16_t count)
+{
+    stream->flight    = flight;
+    stream->entry     = entry;
+    stream->remaining = count ? count : UINT16_MAX;
+    stream->done = false;
+}
+
+/**
+ * Reads the next chunk of the stream, which must have room for
+ * LOGSTREAM_CHUNK_SIZE(entrySize) bytes
+ * \return the length of the chunk, 0 once the last one was read
+ */
+uint32_t logstream_next(struct logstream *stream, uint8_t *chunk)
+{
+    uint16_t count = 0;
+    uint16_t flags = 0;
+
+    if (stream->done) {
+        return 0;
+    }
+
+    while (count < LOGSTREAM_MAX_ENTRIES && stream->remaining > 0) {
+        uint8_t *out = chunk + LOGSTREAM_HEADER_SIZE + count * stream->entrySize;
+        if (!stream->read(stream->ctx, stream->flight, stream->entry, out)) {
+            flags |= LOGSTREAM_FLAG_LAST;
+            break;
+        }
+        count++;
+        stream->entry++;
+        stream->remaining--;
+    }
+    if (stream->remaining == 0) {
+        flags |= LOGSTREAM_FLAG_LAST;
+    }
+    stream->done = (flags & LOGSTREAM_FLAG_LAST) != 0;
+
+    uint32_t length = LOGSTREAM_HEADER_SIZE + count * stream->entrySize;
+    put16(chunk, stream->flight);
+    put16(chunk + 2, stream->entry - count);
+    put16(chunk + 4, count);
+    put16(chunk + 6, flags);
+
+    uint32_t crc = chunkCrc(chunk, length);
+    put16(chunk + CRC_OFFSET, (uint16_t)(crc & 0xFFFF));
+    put16(chunk + CRC_OFFSET + 2, (uint16_t)(crc >> 16));
+
+    return length;
+}
+
+/**
+ * Checks a received chunk and decodes its header
+ * \return the number of entries in the chunk or a negative LOGSTREAM_ERR_
+ */
+int32_t logstream_check(const uint8_t *chunk, uint32_t length, uint16_t entrySize, struct logstream_header *header)
+{
+    if (length < LOGSTREAM_HEADER_SIZE) {
+        return LOGSTREAM_ERR_LENGTH;
+    }
+
+    header->flight = get16(chunk);
+    header->entry  = get16(chunk + 2);
+    header->count  = get16(chunk + 4);
+    header->flags  = get16(chunk + 6);
+    header->crc    = get16(chunk + CRC_OFFSET) | ((uint32_t)get16(chunk + CRC_OFFSET + 2) << 16);
+
+    if (header->count > LOGSTREAM_MAX_ENTRIES || length != LOGSTREAM_HEADER_SIZE + (uint32_t)header->count * entrySize) {
+        return LOGSTREAM_ERR_LENGTH;
+    }
+    if (header->crc != chunkCrc(chunk, length)) {
+        return LOGSTREAM_ERR_CRC;
+    }
+    return header->count;
+}
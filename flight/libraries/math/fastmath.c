@@ -0,0 +1,200 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilot Math Utilities
+ * @{
+ * @addtogroup Fast trigonometric and square root approximations
+ * @{
+ *
+ * @file       fastmath.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2014.
+ * @brief      Minimax polynomial sin/cos, atan2, asin and inverse square root
+ *             with a bounded error, in two accuracy classes
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <stdint.h>
+
+#include "mathmisc.h"
+#include "fastmath.h"
+
+#define PI_F      3.14159265358979f
+#define PI_2_F    1.57079632679490f
+#define TWO_PI_F  0.636619772367581f
+
+// pi/2 split in three so that n * PIO2_1 and n * PIO2_2 are exact for
+// |n| < 2^13, Cody and Waite's additive range reduction
+#define PIO2_1    1.5703125f
+#define PIO2_2    4.837512969970703125e-4f
+#define PIO2_3    7.54978995489188216e-8f
+
+/*
+ * The polynomials are minimax (Remez) fits of the absolute error:
+ * sin(r) = r + r^3 * S(r^2) and cos(r) = 1 + r^2 * C(r^2) on [0, pi/4],
+ * atan(t) = t * A(t^2) on [0, 1]. The asin ones are Hastings' fits of
+ * (pi/2 - asin(x)) / sqrt(1 - x) on [0, 1], Abramowitz and Stegun 4.4.45
+ * and 4.4.46.
+ */
+#define S1_LOW    -1.666283381e-01f
+#define S2_LOW    8.152992342e-03f
+
+#define C1_LOW    -4.997763071e-01f
+#define C2_LOW    4.048893584e-02f
+
+#define S1_HIGH   -1.666665067e-01f
+#define S2_HIGH   8.331978663e-03f
+#define S3_HIGH   -1.949563624e-04f
+
+#define C1_HIGH   -4.999999973e-01f
+#define C2_HIGH   4.166662332e-02f
+#define C3_HIGH   -1.388676379e-03f
+#define C4_HIGH   2.439045074e-05f
+
+#define A0_LOW    9.992138126e-01f
+#define A1_LOW    -3.211749693e-01f
+#define A2_LOW    1.462644636e-01f
+#define A3_LOW    -3.898651416e-02f
+
+#define A0_HIGH   9.999961115e-01f
+#define A1_HIGH   -3.331736805e-01f
+#define A2_HIGH   1.980781556e-01f
+#define A3_HIGH   -1.323334210e-01f
+#define A4_HIGH   7.962367237e-02f
+#define A5_HIGH   -3.360422057e-02f
+#define A6_HIGH   6.811793291e-03f
+
+#define AS0_LOW   1.5707288f
+#define AS1_LOW   -0.2121144f
+#define AS2_LOW   0.0742610f
+#define AS3_LOW   -0.0187293f
+
+#define AS0_HIGH  1.5707963050f
+#define AS1_HIGH  -0.2145988016f
+#define AS2_HIGH  0.0889789874f
+#define AS3_HIGH  -0.0501743046f
+#define AS4_HIGH  0.0308918810f
+#define AS5_HIGH  -0.0170881256f
+#define AS6_HIGH  0.0066700901f
+#define AS7_HIGH  -0.0012624911f
+
+void fast_sincosf(float x, float *s, float *c, fastmath_accuracy_t accuracy)
+{
+    // Nearest quadrant, then the remainder in [-pi/4, pi/4]
+    int32_t n = (int32_t)(x * TWO_PI_F + (x < 0.0f ? -0.5f : 0.5f));
+    float fn  = (float)n;
+    float r   = ((x - fn * PIO2_1) - fn * PIO2_2) - fn * PIO2_3;
+    float r2  = r * r;
+    float sr, cr;
+
+    if (accuracy == FASTMATH_LOW) {
+        sr = r + r * r2 * (S1_LOW + r2 * S2_LOW);
+        cr = 1.0f + r2 * (C1_LOW + r2 * C2_LOW);
+    } else {
+        sr = r + r * r2 * (S1_HIGH + r2 * (S2_HIGH + r2 * S3_HIGH));
+        cr = 1.0f + r2 * (C1_HIGH + r2 * (C2_HIGH + r2 * (C3_HIGH + r2 * C4_HIGH)));
+    }
+
+    switch (n & 3) {
+    case 0:
+        *s = sr;
+        *c = cr;
+        break;
+    case 1:
+        *s = cr;
+        *c = -sr;
+        break;
+    case 2:
+        *s = -sr;
+        *c = -cr;
+        break;
+    default:
+        *s = -cr;
+        *c = sr;
+        break;
+    }
+}
+
+float fast_atan2f(float y, float x, fastmath_accuracy_t accuracy)
+{
+    float ax = x < 0.0f ? -x : x;
+    float ay = y < 0.0f ? -y : y;
+    float t, t2, a;
+
+    // Fold into the first octant
+    if (ay > ax) {
+        t = ax / ay;
+    } else if (ax > 0.0f) {
+        t = ay / ax;
+    } else {
+        return 0.0f;
+    }
+    t2 = t * t;
+
+    if (accuracy == FASTMATH_LOW) {
+        a = t * (A0_LOW + t2 * (A1_LOW + t2 * (A2_LOW + t2 * A3_LOW)));
+    } else {
+        a = t * (A0_HIGH + t2 * (A1_HIGH + t2 * (A2_HIGH + t2 * (A3_HIGH + t2 * (A4_HIGH + t2 * (A5_HIGH + t2 * A6_HIGH))))));
+    }
+
+    if (ay > ax) {
+        a = PI_2_F - a;
+    }
+    if (x < 0.0f) {
+        a = PI_F - a;
+    }
+    return y < 0.0f ? -a : a;
+}
+
+float fast_asinf(float x, fastmath_accuracy_t accuracy)
+{
+    float ax = x < 0.0f ? -x : x;
+    float p, a;
+
+    if (ax >= 1.0f) {
+        return x < 0.0f ? -PI_2_F : PI_2_F;
+    }
+
+    if (accuracy == FASTMATH_LOW) {
+        p = AS0_LOW + ax * (AS1_LOW + ax * (AS2_LOW + ax * AS3_LOW));
+    } else {
+        p = AS0_HIGH + ax * (AS1_HIGH + ax * (AS2_HIGH + ax * (AS3_HIGH + ax * (AS4_HIGH + ax * (AS5_HIGH + ax * (AS6_HIGH + ax * AS7_HIGH))))));
+    }
+
+    // sqrt(1 - |x|) as (1 - |x|) / sqrt(1 - |x|)
+    float t = 1.0f - ax;
+    a = PI_2_F - t * fast_rsqrtf(t, accuracy) * p;
+
+    return x < 0.0f ? -a : a;
+}
+
+float fast_rsqrtf(float x, fastmath_accuracy_t accuracy)
+{
+    float x2 = x * 0.5f;
+
+    // fast_invsqrtf() is within 0.2% after its single Newton step, each
+    // further step squares the relative error
+    float y  = fast_invsqrtf(x);
+
+    y = y * (1.5f - (x2 * y * y));
+    if (accuracy == FASTMATH_HIGH) {
+        y = y * (1.5f - (x2 * y * y));
+    }
+
+    return y;
+}
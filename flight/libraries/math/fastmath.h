@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilot Math Utilities
+ * @{
+ * @addtogroup Fast trigonometric and square root approximations
+ * @{
+ *
+ * @file       fastmath.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2014.
+ * @brief      Minimax polynomial sin/cos, atan2, asin and inverse square root
+ *             with a bounded error, in two accuracy classes
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+/*
+ * Each call site picks the accuracy it needs. The maximum errors below are
+ * the ones measured over the whole domain by flight/tests/fastmath, against
+ * the double precision libm functions.
+ *
+ *                       FASTMATH_LOW        FASTMATH_HIGH
+ * fast_sincosf          1.3e-5              1.0e-7           absolute
+ * fast_atan2f           8.5e-5 rad          6.0e-7 rad       absolute
+ * fast_asinf            7.6e-5 rad          5.0e-7 rad       absolute
+ * fast_rsqrtf           4.8e-6              2.0e-7           relative
+ *
+ * FASTMATH_LOW is for control loops and anything shown in degrees,
+ * FASTMATH_HIGH is within a few float ulp of the result and can replace
+ * libm in the attitude math.
+ */
+typedef enum {
+    FASTMATH_LOW,
+    FASTMATH_HIGH,
+} fastmath_accuracy_t;
+
+// Largest |x| for which fast_sincosf() keeps its bound
+#define FASTMATH_SINCOS_MAX 8192.0f
+
+/**
+ * Sine and cosine of x in radians, |x| <= FASTMATH_SINCOS_MAX
+ */
+void fast_sincosf(float x, float *s, float *c, fastmath_accuracy_t accuracy);
+
+/**
+ * Angle of (x, y) in radians, in [-pi, pi]. Returns 0 for (0, 0), either
+ * argument may be infinite but not both.
+ */
+float fast_atan2f(float y, float x, fastmath_accuracy_t accuracy);
+
+/**
+ * Arc sine in radians, x outside [-1, 1] is clamped
+ */
+float fast_asinf(float x, fastmath_accuracy_t accuracy);
+
+/**
+ * 1 / sqrt(x) for positive normal x
+ */
+float fast_rsqrtf(float x, fastmath_accuracy_t accuracy);
+
+#endif /* FASTMATH_H */
@@ -31,6 +31,7 @@
 #include <stdbool.h>
 #include "op_dfu.h"
 #include "pios_bl_helper.h"
+#include "fwlz.h"
 #include <pios_board_info.h>
 // programmable devices
 Device devicesTable[10];
@@ -67,6 +68,9 @@ uint32_t downSizeOfLastPacket = 0;
 uint32_t downPacketTotal = 0;
 uint32_t downPacketCurrent    = 0;
 DFUTransfer downType = 0;
+
+// Compressed firmware, decompressed into flash as the packets come
+static struct fwlz_decoder decoder;
 /* Extern variables ----------------------------------------------------------*/
 extern DFUStates DeviceState;
 extern uint8_t JumpToApp;
@@ -75,6 +79,8 @@ extern int32_t platform_senddata(const uint8_t *msg, uint16_t msg_len);
 static uint32_t baseOfAdressType(uint8_t type);
 static uint8_t isBiggerThanAvailable(uint8_t type, uint32_t size);
 static void OPDfuIni(uint8_t discover);
+static bool programFirmwareWord(void *ctx, uint32_t offset, uint32_t word);
+static uint8_t readFirmwareByte(void *ctx, uint32_t offset);
 bool flash_read(uint8_t *buffer, uint32_t adr, DFUProgType type);
 /* Private functions ---------------------------------------------------------*/
 void sendData(uint8_t *buf, uint16_t size);
@@ -200,7 +206,7 @@ void processComand(uint8_t *xReceive_Buffer)
                     Aditionals  = (uint32_t)Command;
                 } else {
                     uint8_t result = 1;
-                    if (TransferType == FW) {
+                    if ((TransferType == FW) || (TransferType == FWCompressed)) {
                         switch (currentProgrammingDestination) {
                         case Self_flash:
                             result = PIOS_BL_HELPER_FLASH_Start();
@@ -217,6 +223,10 @@ void processComand(uint8_t *xReceive_Buffer)
                         Aditionals  = (uint32_t)Command;
                     } else {
                         DeviceState = uploading;
+                        if (TransferType == FWCompressed) {
+                            fwlz_decode_init(&decoder, currentDevice.sizeOfCode,
+                                             programFirmwareWord, readFirmwareByte, NULL);
+                        }
                     }
                 }
             } else if ((StartFlag != 1) && (Next_Packet != 0)) {
@@ -233,6 +243,20 @@ void processComand(uint8_t *xReceive_Buffer)
                     uint32_t aux;;
                     switch (currentProgrammingDestination) {
                     case Self_flash:
+                        if (TransferType == FWCompressed) {
+                            // Words are sent big endian, the stream is in
+                            // flash byte order like the raw image
+                            uint8_t bytes[14 * 4];
+                            for (uint8_t x = 0; x < numberOfWords; ++x) {
+                                Data = unpack_uint32(&xReceive_Buffer[DATA + 4 * x]);
+                                bytes[4 * x]     = Data;
+                                bytes[4 * x + 1] = Data >> 8;
+                                bytes[4 * x + 2] = Data >> 16;
+                                bytes[4 * x + 3] = Data >> 24;
+                            }
+                            result = (fwlz_decode(&decoder, bytes, numberOfWords * 4) == 0) ? 1 : 0;
+                            break;
+                        }
                         for (uint8_t x = 0; x < numberOfWords; ++x) {
                             offset = 4 * x;
                             Data   = unpack_uint32(&xReceive_Buffer[DATA + offset]);
@@ -325,7 +349,10 @@ void processComand(uint8_t *xReceive_Buffer)
         if (DeviceState == uploading) {
             if (Next_Packet - 1 == SizeOfTransfer) {
                 Next_Packet = 0;
-                if ((TransferType != FW) || (Expected_CRC == CalcFirmCRC())) {
+                if ((TransferType == FWCompressed) && !fwlz_decode_done(&decoder)) {
+                    DeviceState = CRC_Fail;
+                } else if (((TransferType != FW) && (TransferType != FWCompressed))
+                           || (Expected_CRC == CalcFirmCRC())) {
                     DeviceState = Last_operation_Success;
                 } else {
                     DeviceState = CRC_Fail;
@@ -425,6 +452,7 @@ uint8_t isBiggerThanAvailable(DFUTransfer type, uint32_t size)
 {
     switch (type) {
     case FW:
+    case FWCompressed:
         return (size > currentDevice.sizeOfCode) ? 1 : 0;
 
         break;
@@ -454,6 +482,26 @@ uint32_t CalcFirmCRC()
         break;
     }
 }
+
+static bool programFirmwareWord(__attribute__((unused)) void *ctx, uint32_t offset, uint32_t word)
+{
+    uint32_t aux = currentDevice.startOfUserCode + offset;
+    uint8_t result = 0;
+
+    for (int retry = 0; retry < MAX_WRI_RETRYS; ++retry) {
+        if (result == 0) {
+            result = (FLASH_ProgramWord(aux, word) == FLASH_COMPLETE) ? 1 : 0;
+        }
+    }
+    // Matches are read back from flash, so it has to hold what was written
+    return (result == 1) && (*(uint32_t *)PIOS_BL_HELPER_FLASH_If_Read(aux) == word);
+}
+
+static uint8_t readFirmwareByte(__attribute__((unused)) void *ctx, uint32_t offset)
+{
+    return *PIOS_BL_HELPER_FLASH_If_Read(currentDevice.startOfUserCode + offset);
+}
+
 void sendData(uint8_t *buf, uint16_t size)
 {
     platform_senddata(buf, size);
@@ -0,0 +1,271 @@
+/**
+ ******************************************************************************
+ *
+ * @file       telemetrysched.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+ * @brief      Bandwidth aware scheduling of the telemetry updates: priority
+ *             classes, a token bucket at the measured link capacity and
+ *             stretching of the low priority periods under congestion.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <string.h>
+
+#include "telemetrysched.h"
+
+static int32_t burst(const struct telemetrysched *sched)
+{
+    return (int32_t)(sched->capacity * TELEMETRYSCHED_BURST_MS / 1000);
+}
+
+static void refill(struct telemetrysched *sched, uint32_t now)
+{
+    uint32_t elapsed = now - sched->lastRefill;
+
+    sched->lastRefill = now;
+    if (elapsed > TELEMETRYSCHED_WINDOW_MS) {
+        elapsed = TELEMETRYSCHED_WINDOW_MS;
+    }
+
+    uint32_t added = sched->capacity * elapsed + sched->refillRemainder;
+    sched->refillRemainder = added % 1000;
+    sched->tokens += (int32_t)(added / 1000);
+    if (sched->tokens > burst(sched)) {
+        sched->tokens = burst(sched);
+        sched->refillRemainder = 0;
+    }
+}
+
+/**
+ * Closes the window once it is over: updates the capacity estimate and the
+ * stretching of the low priority periods
+ */
+static void updateWindow(struct telemetrysched *sched, uint32_t now)
+{
+    uint32_t elapsed = now - sched->windowStart;
+
+    if (elapsed < TELEMETRYSCHED_WINDOW_MS) {
+        return;
+    }
+
+    if (sched->windowCongested) {
+        // The port was full, what went out is what the link carries. Move
+        // half way there, the buffer blurs a single window.
+        uint32_t measured = (uint32_t)((uint64_t)sched->windowBytes * 1000 / elapsed);
+        if (measured < sched->capacity) {
+            sched->capacity = (sched->capacity + measured) / 2;
+        }
+    } else if (sched->windowHeld) {
+        // The bucket held updates back and the port kept up, probe for more
+        sched->capacity += sched->capacity / 16;
+    }
+    if (sched->capacity > sched->nominal) {
+        sched->capacity = sched->nominal;
+    }
+    if (sched->capacity < TELEMETRYSCHED_MIN_RATE) {
+        sched->capacity = TELEMETRYSCHED_MIN_RATE;
+    }
+
+    if (sched->windowCongested || sched->windowThrottled || sched->pending[TELEMETRYSCHED_LOW].count == sched->depth) {
+        sched->calmWindows = 0;
+        if (sched->periodScale < TELEMETRYSCHED_MAX_SCALE) {
+            sched->periodScale *= 2;
+        }
+    } else if (++sched->calmWindows >= TELEMETRYSCHED_CALM_WINDOWS) {
+        sched->calmWindows = 0;
+        if (sched->periodScale > 1) {
+            sched->periodScale /= 2;
+        }
+    }
+
+    sched->windowStart     = now;
+    sched->windowBytes     = 0;
+    sched->windowCongested = false;
+    sched->windowHeld      = false;
+    sched->windowThrottled = false;
+}
+
+/**
+ * Starts with an empty schedule for a port of rate bytes/s
+ * \param[in] items Room for the rings, TELEMETRYSCHED_CLASSES * depth updates
+ * \param[in] depth Updates waiting per class
+ */
+void telemetrysched_init(struct telemetrysched *sched, struct telemetrysched_item *items, uint16_t depth, uint32_t rate, uint32_t now)
+{
+    memset(sched, 0, sizeof(*sched));
+    for (uint8_t priority = 0; priority < TELEMETRYSCHED_CLASSES; priority++) {
+        sched->pending[priority].items = &items[priority * depth];
+    }
+    sched->depth       = depth;
+    sched->nominal     = rate > TELEMETRYSCHED_MIN_RATE ? rate : TELEMETRYSCHED_MIN_RATE;
+    sched->capacity    = sched->nominal;
+    sched->tokens      = burst(sched);
+    sched->lastRefill  = now;
+    sched->windowStart = now;
+    sched->periodScale = 1;
+}
+
+/**
+ * Changes the nominal rate, when the updates go to another port
+ */
+void telemetrysched_set_rate(struct telemetrysched *sched, uint32_t rate)
+{
+    sched->nominal  = rate > TELEMETRYSCHED_MIN_RATE ? rate : TELEMETRYSCHED_MIN_RATE;
+    sched->capacity = sched->nominal;
+    if (sched->tokens > burst(sched)) {
+        sched->tokens = burst(sched);
+    }
+}
+
+/**
+ * Queues an update in its class. An update of an object instance with the
+ * same event already waiting replaces it, keeping its place and age.
+ * \return 0 when queued
+ * \return TELEMETRYSCHED_COALESCED when merged with a waiting update
+ * \return TELEMETRYSCHED_ERR_FULL when the class is full. A periodic update is
+ * dropped, any other has to be pushed again later.
+ */
+int32_t telemetrysched_push(struct telemetrysched *sched, const struct telemetrysched_item *item)
+{
+    struct telemetrysched_ring *ring = &sched->pending[item->priority];
+
+    for (uint16_t n = 0; n < ring->count; n++) {
+        struct telemetrysched_item *waiting = &ring->items[(ring->head + n) % sched->depth];
+        if (waiting->obj == item->obj && waiting->instId == item->instId && waiting->event == item->event) {
+            waiting->length = item->length;
+            sched->coalesced++;
+            sched->windowThrottled |= (item->priority == TELEMETRYSCHED_LOW);
+            return TELEMETRYSCHED_COALESCED;
+        }
+    }
+
+    if (ring->count == sched->depth) {
+        if (item->periodic) {
+            sched->dropped[item->priority]++;
+        }
+        return TELEMETRYSCHED_ERR_FULL;
+    }
+    ring->items[(ring->head + ring->count) % sched->depth] = *item;
+    ring->count++;
+    return 0;
+}
+
+/**
+ * Takes the next update to send, highest class first. Normal and low
+ * priority updates wait for the bucket, in order.
+ * \return false when nothing may be sent now
+ */
+bool telemetrysched_pop(struct telemetrysched *sched, uint32_t now, struct telemetrysched_item *item)
+{
+    refill(sched, now);
+    updateWindow(sched, now);
+
+    for (uint8_t priority = 0; priority < TELEMETRYSCHED_CLASSES; priority++) {
+        struct telemetrysched_ring *ring = &sched->pending[priority];
+        if (ring->count == 0) {
+            continue;
+        }
+        if (priority != TELEMETRYSCHED_HIGH && sched->tokens < 0) {
+            sched->windowHeld = true;
+            return false;
+        }
+        *item = ring->items[ring->head];
+        ring->head = (ring->head + 1) % sched->depth;
+        ring->count--;
+        sched->tokens -= item->length;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * \return true if any update is waiting
+ */
+bool telemetrysched_pending(const struct telemetrysched *sched)
+{
+    for (uint8_t priority = 0; priority < TELEMETRYSCHED_CLASSES; priority++) {
+        if (sched->pending[priority].count) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Accounts an update taken with telemetrysched_pop() once it is written
+ */
+void telemetrysched_sent(struct telemetrysched *sched, const struct telemetrysched_item *item, uint32_t now)
+{
+    uint32_t latency = now - item->queued;
+
+    if (latency > UINT16_MAX) {
+        latency = UINT16_MAX;
+    }
+    sched->latencySum[item->priority] += latency;
+    sched->sent[item->priority]++;
+    if (latency > sched->latencyMax[item->priority]) {
+        sched->latencyMax[item->priority] = (uint16_t)latency;
+    }
+}
+
+/**
+ * Accounts bytes written to the port, congested if the writer had to wait
+ * for room in the transmit buffer
+ */
+void telemetrysched_link(struct telemetrysched *sched, uint32_t bytes, bool congested, uint32_t now)
+{
+    updateWindow(sched, now);
+    sched->windowBytes     += bytes;
+    sched->windowCongested |= congested;
+}
+
+/**
+ * \return the period to use for a periodic update of a class
+ */
+uint32_t telemetrysched_period(const struct telemetrysched *sched, uint8_t priority, uint32_t periodMs)
+{
+    if (priority == TELEMETRYSCHED_LOW) {
+        return periodMs * sched->periodScale;
+    }
+    return periodMs;
+}
+
+/**
+ * Reads the statistics, the latencies and counts since the last reset
+ */
+void telemetrysched_get_stats(struct telemetrysched *sched, struct telemetrysched_stats *stats, bool reset)
+{
+    for (uint8_t priority = 0; priority < TELEMETRYSCHED_CLASSES; priority++) {
+        stats->latencyMean[priority] = sched->sent[priority] ? (uint16_t)(sched->latencySum[priority] / sched->sent[priority]) : 0;
+        stats->latencyMax[priority]  = sched->latencyMax[priority];
+        stats->sent[priority]    = sched->sent[priority];
+        stats->dropped[priority] = sched->dropped[priority];
+    }
+    stats->coalesced   = sched->coalesced;
+    stats->capacity    = sched->capacity;
+    stats->periodScale = sched->periodScale;
+
+    if (reset) {
+        memset(sched->latencySum, 0, sizeof(sched->latencySum));
+        memset(sched->latencyMax, 0, sizeof(sched->latencyMax));
+        memset(sched->sent, 0, sizeof(sched->sent));
+        memset(sched->dropped, 0, sizeof(sched->dropped));
+        sched->coalesced = 0;
+    }
+}
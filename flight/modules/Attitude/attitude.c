@@ -662,44 +662,14 @@ __attribute__((optimize("O3"))) static void updateAttitude(AccelStateData *accel
     gyros[1] += accel_err[1] * kpInvdT;
     gyros[2] += accel_err[2] * kpInvdT;
 
-    { // scoping variables to save memory
-      // Work out time derivative from INSAlgo writeup
-      // Also accounts for the fact that gyros are in deg/s
-        float qdot[4];
-        qdot[0] = (-q[1] * gyros[0] - q[2] * gyros[1] - q[3] * gyros[2]) * dT * (M_PI_F / 180.0f / 2.0f);
-        qdot[1] = (q[0] * gyros[0] - q[3] * gyros[1] + q[2] * gyros[2]) * dT * (M_PI_F / 180.0f / 2.0f);
-        qdot[2] = (q[3] * gyros[0] + q[0] * gyros[1] - q[1] * gyros[2]) * dT * (M_PI_F / 180.0f / 2.0f);
-        qdot[3] = (-q[2] * gyros[0] + q[1] * gyros[1] + q[0] * gyros[2]) * dT * (M_PI_F / 180.0f / 2.0f);
-
-        // Take a time step
-        q[0]    = q[0] + qdot[0];
-        q[1]    = q[1] + qdot[1];
-        q[2]    = q[2] + qdot[2];
-        q[3]    = q[3] + qdot[3];
-
-        if (q[0] < 0) {
-            q[0] = -q[0];
-            q[1] = -q[1];
-            q[2] = -q[2];
-            q[3] = -q[3];
-        }
-    }
-
-    // Renomalize
-    float inv_qmag = fast_invsqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
-
+    // Take a time step and renormalize
     // If quaternion has become inappropriately short or is nan reinit.
     // THIS SHOULD NEVER ACTUALLY HAPPEN
-    if ((fabsf(inv_qmag) > 1e3f) || isnan(inv_qmag)) {
+    if (!quat_integrate_normalize(q, gyros, dT)) {
         q[0] = 1;
         q[1] = 0;
         q[2] = 0;
         q[3] = 0;
-    } else {
-        q[0] = q[0] * inv_qmag;
-        q[1] = q[1] * inv_qmag;
-        q[2] = q[2] * inv_qmag;
-        q[3] = q[3] * inv_qmag;
     }
 
     AttitudeStateData attitudeState;
@@ -60,6 +60,7 @@ static void updateSettings(UAVObjEvent *ev);
 static xTaskHandle com2UsbBridgeTaskHandle;
 static xTaskHandle usb2ComBridgeTaskHandle;
 
+// Drain what the other port has no room for
 static uint8_t *com2usb_buf;
 static uint8_t *usb2com_buf;
 
@@ -136,15 +137,20 @@ static void com2UsbBridgeTask(__attribute__((unused)) void *parameters)
     volatile uint32_t tx_errors = 0;
 
     while (1) {
-        uint32_t rx_bytes;
-
-        rx_bytes = PIOS_COM_ReceiveBuffer(usart_port, com2usb_buf, BRIDGE_BUF_LEN, 500);
-        if (rx_bytes > 0) {
-            /* Bytes available to transfer */
-            if (PIOS_COM_SendBuffer(vcp_port, com2usb_buf, rx_bytes) != (int32_t)rx_bytes) {
-                /* Error on transmit */
-                tx_errors++;
+        struct pios_com_span span;
+        uint16_t rx_bytes;
+
+        /* Receive straight into the transmit buffer of the vcp. Nothing else
+         * writes to a bridged port, holding it while waiting keeps nobody out. */
+        if (PIOS_COM_ReserveBuffer(vcp_port, BRIDGE_BUF_LEN, &span, 500) == 0) {
+            rx_bytes = PIOS_COM_ReceiveBuffer(usart_port, span.first, span.first_len, 500);
+            if (rx_bytes == span.first_len && rx_bytes < BRIDGE_BUF_LEN) {
+                rx_bytes += PIOS_COM_ReceiveBuffer(usart_port, span.second, BRIDGE_BUF_LEN - rx_bytes, 0);
             }
+            PIOS_COM_CommitBuffer(vcp_port, rx_bytes);
+        } else if (PIOS_COM_ReceiveBuffer(usart_port, com2usb_buf, BRIDGE_BUF_LEN, 500) > 0) {
+            /* No room or vcp down, the bytes are lost */
+            tx_errors++;
         }
     }
 }
@@ -155,15 +161,20 @@ static void usb2ComBridgeTask(__attribute__((unused)) void *parameters)
     volatile uint32_t tx_errors = 0;
 
     while (1) {
-        uint32_t rx_bytes;
-
-        rx_bytes = PIOS_COM_ReceiveBuffer(vcp_port, usb2com_buf, BRIDGE_BUF_LEN, 500);
-        if (rx_bytes > 0) {
-            /* Bytes available to transfer */
-            if (PIOS_COM_SendBuffer(usart_port, usb2com_buf, rx_bytes) != (int32_t)rx_bytes) {
-                /* Error on transmit */
-                tx_errors++;
+        struct pios_com_span span;
+        uint16_t rx_bytes;
+
+        /* Receive straight into the transmit buffer of the usart. Nothing else
+         * writes to a bridged port, holding it while waiting keeps nobody out. */
+        if (PIOS_COM_ReserveBuffer(usart_port, BRIDGE_BUF_LEN, &span, 500) == 0) {
+            rx_bytes = PIOS_COM_ReceiveBuffer(vcp_port, span.first, span.first_len, 500);
+            if (rx_bytes == span.first_len && rx_bytes < BRIDGE_BUF_LEN) {
+                rx_bytes += PIOS_COM_ReceiveBuffer(vcp_port, span.second, BRIDGE_BUF_LEN - rx_bytes, 0);
             }
+            PIOS_COM_CommitBuffer(usart_port, rx_bytes);
+        } else if (PIOS_COM_ReceiveBuffer(vcp_port, usb2com_buf, BRIDGE_BUF_LEN, 500) > 0) {
+            /* No room or usart down, the bytes are lost */
+            tx_errors++;
         }
     }
 }
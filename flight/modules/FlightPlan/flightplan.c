@@ -35,6 +35,7 @@
 #include "flightplancontrol.h"
 #include "flightplansettings.h"
 #include "taskinfo.h"
+#include "flightplanuavo.h"
 
 #include "pm.h"
 
@@ -81,6 +82,11 @@ int32_t FlightPlanInitialize()
     FlightPlanControlInitialize();
     FlightPlanSettingsInitialize();
 
+    // Create the queue of the objects watched by the scripts
+    if (FlightPlanUAVOInitialize() != 0) {
+        return -1;
+    }
+
     // Listen for object updates
     FlightPlanControlConnectCallback(&objectUpdatedCb);
 
@@ -131,6 +137,8 @@ static void flightPlanTask(__attribute__((unused)) void *parameters)
                 FlightPlanStatusSet(&status);
                 // Run the test script (TODO: load from SD card)
                 retval = pm_run((uint8_t *)"test");
+                // Drop the objects watched by the script
+                FlightPlanUAVOReset();
                 // Check if an error or exception was thrown
                 if (retval == PM_RET_OK || retval == PM_RET_EX_EXIT) {
                     status.Status    = FLIGHTPLANSTATUS_STATUS_STOPPED;
@@ -229,6 +237,7 @@ static void objectUpdatedCb(UAVObjEvent *ev)
                 PIOS_TASK_MONITOR_UnregisterTask(TASKINFO_RUNNING_FLIGHTPLAN);
                 vTaskDelete(taskHandle);
                 taskHandle = NULL;
+                FlightPlanUAVOReset();
                 // Update status object
                 statusData.Status       = FLIGHTPLANSTATUS_STATUS_STOPPED;
                 statusData.ErrorFileID  = 0;
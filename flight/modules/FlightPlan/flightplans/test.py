@@ -8,10 +8,10 @@ import openpilot
 #print(mb-ma)
 #mb = sys.heap()
 #mb = mb[0]
-import flightplanstatus
+import flightplanstatus_native
 #ma = sys.heap()
 #ma = ma[0]
-#print('import flightplanstatus')
+#print('import flightplanstatus_native')
 #print(mb-ma)
 #mb = sys.heap()
 #mb = mb[0]
@@ -23,15 +23,12 @@ import mixersettings
 
 n = 0
 timenow = sys.time()
-fpStatus = flightplanstatus.FlightPlanStatus()
 
 while n < 120:
 	n = n+1 
 	#openpilot.debug(n, timenow)
-	fpStatus.read()
-	fpStatus.Debug.value[0] = n
-	fpStatus.Debug.value[1] = timenow
-	fpStatus.write()
+	flightplanstatus_native.setDebug(0, n)
+	flightplanstatus_native.setDebug(1, timenow)
 	timenow = openpilot.delayUntil(timenow, 1000)
 	if openpilot.hasStopRequest():
 		sys.exit()
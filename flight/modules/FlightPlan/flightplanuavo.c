@@ -0,0 +1,369 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup FlightPlan Flight Plan Module
+ * @{
+ *
+ * @file       flightplanuavo.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+ * @brief      Native UAVObject field access and update events for the
+ *             generated FlightPlan object modules
+ *
+ * The native functions generated for each object field call in here with the
+ * field's type, offset and length. Only the addressed element is copied out
+ * of (or into) the object, no object data or field lists are built in the VM
+ * heap. Reading an integer field within the VM's small int cache does not
+ * allocate at all, a float field allocates just the returned float.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "flightplanuavo.h"
+
+#undef __FILE_ID__
+#define __FILE_ID__ 0x71
+
+// Private constants
+#define MAX_QUEUE_SIZE 8
+
+// Private types
+typedef union {
+    int8_t   i8;
+    int16_t  i16;
+    int32_t  i32;
+    uint8_t  u8;
+    uint16_t u16;
+    uint32_t u32;
+    float    f32;
+} FieldValue;
+
+// Private variables
+static const uint8_t typeSize[] = { 1, 2, 4, 1, 2, 4, 4, 1 };
+static xQueueHandle queue;
+static UAVObjHandle watches[FLIGHTPLANUAVO_MAX_WATCHES];
+static uint8_t numWatches;
+
+// Private functions
+static PmReturn_t getFieldArgs(uint16_t numElements, bool set, uint16_t *instId, uint32_t *element, pPmObj_t *value);
+
+/**
+ * Create the update queue, called on module initialization
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t FlightPlanUAVOInitialize()
+{
+    numWatches = 0;
+    queue = xQueueCreate(MAX_QUEUE_SIZE, sizeof(UAVObjEvent));
+    if (queue == NULL) {
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * Disconnect all watched objects and drop the pending updates,
+ * called when a script ends so the next one starts without watches.
+ */
+void FlightPlanUAVOReset()
+{
+    UAVObjEvent ev;
+
+    while (numWatches > 0) {
+        UAVObjDisconnectQueue(watches[--numWatches], queue);
+    }
+    while (xQueueReceive(queue, &ev, 0) == pdTRUE) {
+        ;
+    }
+}
+
+/**
+ * Native get<Field>([index,] [instId]), returns one element of a field.
+ * The index is only taken by array fields.
+ * \param[in] obj The object
+ * \param[in] type The field type
+ * \param[in] offset Offset of the field in the object data
+ * \param[in] numElements Number of elements of the field
+ */
+PmReturn_t FlightPlanUAVOGetField(UAVObjHandle obj, FlightPlanUAVOFieldType type, uint32_t offset, uint16_t numElements)
+{
+    pPmObj_t pobj;
+    PmReturn_t retval;
+    FieldValue value;
+    uint16_t instId;
+    uint32_t element;
+
+    retval = getFieldArgs(numElements, false, &instId, &element, C_NULL);
+    PM_RETURN_IF_ERROR(retval);
+
+    // Copy out just this element
+    if (UAVObjGetInstanceDataField(obj, instId, &value, offset + element * typeSize[type], typeSize[type]) != 0) {
+        PM_RAISE(retval, PM_RET_EX_INDX);
+        return retval;
+    }
+
+    switch (type) {
+    case FLIGHTPLANUAVO_TYPE_INT8:
+        retval = int_new(value.i8, &pobj);
+        break;
+    case FLIGHTPLANUAVO_TYPE_INT16:
+        retval = int_new(value.i16, &pobj);
+        break;
+    case FLIGHTPLANUAVO_TYPE_INT32:
+        retval = int_new(value.i32, &pobj);
+        break;
+    case FLIGHTPLANUAVO_TYPE_UINT8:
+    case FLIGHTPLANUAVO_TYPE_ENUM:
+        retval = int_new(value.u8, &pobj);
+        break;
+    case FLIGHTPLANUAVO_TYPE_UINT16:
+        retval = int_new(value.u16, &pobj);
+        break;
+    case FLIGHTPLANUAVO_TYPE_UINT32:
+        retval = int_new((int32_t)value.u32, &pobj);
+        break;
+    case FLIGHTPLANUAVO_TYPE_FLOAT32:
+        retval = float_new(value.f32, &pobj);
+        break;
+    default:
+        PM_RAISE(retval, PM_RET_EX_TYPE);
+        return retval;
+    }
+    PM_RETURN_IF_ERROR(retval);
+
+    NATIVE_SET_TOS(pobj);
+    return PM_RET_OK;
+}
+
+/**
+ * Native set<Field>([index,] value, [instId]), writes one element of a field.
+ * Setting an element raises the object's update event like any other write.
+ * \param[in] obj The object
+ * \param[in] type The field type
+ * \param[in] offset Offset of the field in the object data
+ * \param[in] numElements Number of elements of the field
+ */
+PmReturn_t FlightPlanUAVOSetField(UAVObjHandle obj, FlightPlanUAVOFieldType type, uint32_t offset, uint16_t numElements)
+{
+    pPmObj_t pobj;
+    PmReturn_t retval;
+    FieldValue value;
+    uint16_t instId;
+    uint32_t element;
+    int32_t ival;
+    float fval;
+
+    retval = getFieldArgs(numElements, true, &instId, &element, &pobj);
+    PM_RETURN_IF_ERROR(retval);
+
+    // Ints and floats are accepted for any field type
+    if (OBJ_GET_TYPE(pobj) == OBJ_TYPE_INT) {
+        ival = ((pPmInt_t)pobj)->val;
+        fval = (float)ival;
+    } else if (OBJ_GET_TYPE(pobj) == OBJ_TYPE_FLT) {
+        fval = ((pPmFloat_t)pobj)->val;
+        ival = (int32_t)fval;
+    } else {
+        PM_RAISE(retval, PM_RET_EX_TYPE);
+        return retval;
+    }
+
+    switch (type) {
+    case FLIGHTPLANUAVO_TYPE_INT8:
+        value.i8 = (int8_t)ival;
+        break;
+    case FLIGHTPLANUAVO_TYPE_INT16:
+        value.i16 = (int16_t)ival;
+        break;
+    case FLIGHTPLANUAVO_TYPE_INT32:
+        value.i32 = ival;
+        break;
+    case FLIGHTPLANUAVO_TYPE_UINT8:
+    case FLIGHTPLANUAVO_TYPE_ENUM:
+        value.u8 = (uint8_t)ival;
+        break;
+    case FLIGHTPLANUAVO_TYPE_UINT16:
+        value.u16 = (uint16_t)ival;
+        break;
+    case FLIGHTPLANUAVO_TYPE_UINT32:
+        value.u32 = (uint32_t)ival;
+        break;
+    case FLIGHTPLANUAVO_TYPE_FLOAT32:
+        value.f32 = fval;
+        break;
+    default:
+        PM_RAISE(retval, PM_RET_EX_TYPE);
+        return retval;
+    }
+
+    // A missing instance is an index error, anything else a read only object
+    if (instId >= UAVObjGetNumInstances(obj)) {
+        PM_RAISE(retval, PM_RET_EX_INDX);
+        return retval;
+    }
+    if (UAVObjSetInstanceDataField(obj, instId, &value, offset + element * typeSize[type], typeSize[type]) != 0) {
+        PM_RAISE(retval, PM_RET_EX_IO);
+        return retval;
+    }
+
+    NATIVE_SET_TOS(PM_NONE);
+    return PM_RET_OK;
+}
+
+/**
+ * Native watch(), queue the updates of an object for waitForObjectUpdates()
+ * \param[in] obj The object
+ */
+PmReturn_t FlightPlanUAVOWatch(UAVObjHandle obj)
+{
+    PmReturn_t retval;
+    uint8_t n;
+
+    // Watching an object twice is harmless
+    for (n = 0; n < numWatches; n++) {
+        if (watches[n] == obj) {
+            NATIVE_SET_TOS(PM_NONE);
+            return PM_RET_OK;
+        }
+    }
+
+    if (numWatches >= FLIGHTPLANUAVO_MAX_WATCHES || UAVObjConnectQueue(obj, queue, EV_MASK_ALL_UPDATES) != 0) {
+        PM_RAISE(retval, PM_RET_EX_MEM);
+        return retval;
+    }
+    watches[numWatches++] = obj;
+
+    NATIVE_SET_TOS(PM_NONE);
+    return PM_RET_OK;
+}
+
+/**
+ * Native waitForObjectUpdates(timeoutMs), suspends the VM thread until one of
+ * the watched objects is updated. Returns the ID of the updated object, or 0
+ * if the timeout expired first. A negative timeout polls like a timeout of 0.
+ */
+PmReturn_t FlightPlanUAVOWait()
+{
+    pPmObj_t pobj;
+    PmReturn_t retval;
+    int32_t timeoutMs;
+    UAVObjEvent ev;
+    uint32_t objId;
+
+    // Check number of arguments
+    if (NATIVE_GET_NUM_ARGS() != 1) {
+        PM_RAISE(retval, PM_RET_EX_TYPE);
+        return retval;
+    }
+
+    // Get timeout argument
+    pobj = NATIVE_GET_LOCAL(0);
+    if (OBJ_GET_TYPE(pobj) == OBJ_TYPE_INT) {
+        timeoutMs = ((pPmInt_t)pobj)->val;
+    } else if (OBJ_GET_TYPE(pobj) == OBJ_TYPE_FLT) {
+        timeoutMs = (((pPmFloat_t)pobj)->val > 0.0f) ? (int32_t)(((pPmFloat_t)pobj)->val) : 0;
+    } else {
+        PM_RAISE(retval, PM_RET_EX_TYPE);
+        return retval;
+    }
+
+    // Cast to ticks a negative timeout would wait (almost) forever
+    if (timeoutMs < 0) {
+        timeoutMs = 0;
+    }
+
+    // Wait
+    if (xQueueReceive(queue, &ev, (portTickType)timeoutMs / portTICK_RATE_MS) == pdTRUE) {
+        objId = UAVObjGetID(ev.obj);
+    } else {
+        objId = 0;
+    }
+
+    retval = int_new((int32_t)objId, &pobj);
+    PM_RETURN_IF_ERROR(retval);
+    NATIVE_SET_TOS(pobj);
+    return PM_RET_OK;
+}
+
+/**
+ * Parse the arguments of the field natives, [index,] [value,] [instId]
+ * \param[in] numElements Number of elements of the field, an index is only taken for arrays
+ * \param[in] set True if a value is taken
+ * \param[out] instId The instance, 0 if not given
+ * \param[out] element The element index, 0 if not an array
+ * \param[out] value The value
+ */
+static PmReturn_t getFieldArgs(uint16_t numElements, bool set, uint16_t *instId, uint32_t *element, pPmObj_t *value)
+{
+    PmReturn_t retval = PM_RET_OK;
+    uint8_t numArgs   = NATIVE_GET_NUM_ARGS();
+    uint8_t n = 0;
+    pPmObj_t pobj;
+
+    *instId  = 0;
+    *element = 0;
+
+    // Element index
+    if (numElements > 1) {
+        if (numArgs <= n || OBJ_GET_TYPE(NATIVE_GET_LOCAL(n)) != OBJ_TYPE_INT) {
+            PM_RAISE(retval, PM_RET_EX_TYPE);
+            return retval;
+        }
+        pobj = NATIVE_GET_LOCAL(n++);
+        if (((pPmInt_t)pobj)->val < 0 || ((pPmInt_t)pobj)->val >= numElements) {
+            PM_RAISE(retval, PM_RET_EX_INDX);
+            return retval;
+        }
+        *element = ((pPmInt_t)pobj)->val;
+    }
+
+    // Value
+    if (set) {
+        if (numArgs <= n) {
+            PM_RAISE(retval, PM_RET_EX_TYPE);
+            return retval;
+        }
+        *value = NATIVE_GET_LOCAL(n++);
+    }
+
+    // Optional instance
+    if (numArgs > n) {
+        pobj = NATIVE_GET_LOCAL(n++);
+        if (OBJ_GET_TYPE(pobj) != OBJ_TYPE_INT) {
+            PM_RAISE(retval, PM_RET_EX_TYPE);
+            return retval;
+        }
+        if (((pPmInt_t)pobj)->val < 0 || ((pPmInt_t)pobj)->val > UINT16_MAX) {
+            PM_RAISE(retval, PM_RET_EX_INDX);
+            return retval;
+        }
+        *instId = ((pPmInt_t)pobj)->val;
+    }
+
+    if (numArgs != n) {
+        PM_RAISE(retval, PM_RET_EX_TYPE);
+    }
+    return retval;
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ * @addtogroup OpenPilotModules OpenPilot Modules
+ * @{
+ * @addtogroup FlightPlan Flight Plan Module
+ * @{
+ *
+ * @file       flightplanuavo.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+ * @brief      Native UAVObject field access and update events for the
+ *             generated FlightPlan object modules
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef FLIGHTPLANUAVO_H
+#define FLIGHTPLANUAVO_H
+
+#include "openpilot.h"
+#include "pm.h"
+
+// Maximum number of objects a script can wait for at the same time
+#define FLIGHTPLANUAVO_MAX_WATCHES 8
+
+/**
+ * Field types, numbered as the UAVObject XML types (and UAVObjectField.FType)
+ */
+typedef enum {
+    FLIGHTPLANUAVO_TYPE_INT8    = 0,
+    FLIGHTPLANUAVO_TYPE_INT16   = 1,
+    FLIGHTPLANUAVO_TYPE_INT32   = 2,
+    FLIGHTPLANUAVO_TYPE_UINT8   = 3,
+    FLIGHTPLANUAVO_TYPE_UINT16  = 4,
+    FLIGHTPLANUAVO_TYPE_UINT32  = 5,
+    FLIGHTPLANUAVO_TYPE_FLOAT32 = 6,
+    FLIGHTPLANUAVO_TYPE_ENUM    = 7
+} FlightPlanUAVOFieldType;
+
+int32_t FlightPlanUAVOInitialize();
+void FlightPlanUAVOReset();
+
+PmReturn_t FlightPlanUAVOGetField(UAVObjHandle obj, FlightPlanUAVOFieldType type, uint32_t offset, uint16_t numElements);
+PmReturn_t FlightPlanUAVOSetField(UAVObjHandle obj, FlightPlanUAVOFieldType type, uint32_t offset, uint16_t numElements);
+PmReturn_t FlightPlanUAVOWatch(UAVObjHandle obj);
+PmReturn_t FlightPlanUAVOWait();
+
+#endif // FLIGHTPLANUAVO_H
+
+/**
+ * @}
+ * @}
+ */
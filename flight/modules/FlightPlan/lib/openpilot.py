@@ -29,6 +29,7 @@
 #include "openpilot.h"
 #include "flightplanstatus.h"
 #include "flightplancontrol.h"
+#include "flightplanuavo.h"
 """
 
 # Delay (suspend VM thread) for timeToDelayMs ms
@@ -193,8 +194,14 @@ def hasStopRequest():
 	"""
 	pass
 
-# TODO: Wait for object updates in the event queue 
+# Wait for an update of one of the objects watched through their native module,
+# e.g. positionstate_native.watch(). Returns the OBJID of the updated object or 0 if
+# timeoutMs expired first, so a script can still check for stop requests. A
+# negative timeoutMs only polls.
 def waitForObjectUpdates(timeoutMs):
+	"""__NATIVE__
+	return FlightPlanUAVOWait();
+	"""
 	pass
 
 
@@ -36,6 +36,21 @@
 #include "debuglogstatus.h"
 #include "debuglogentry.h"
 #include "flightstatus.h"
+#include "callbackinfo.h"
+#include "telemetry.h"
+#include "logstream.h"
+
+// private constants
+#define STREAM_CALLBACK_PRIORITY CALLBACK_PRIORITY_LOW
+#define STREAM_CBTASK_PRIORITY   CALLBACK_TASK_AUXILIARY
+#define STREAM_STACK_SIZE_BYTES  1024
+#define STREAM_ENTRY_SIZE        sizeof(DebugLogEntryDataPacked)
+
+// private types
+typedef struct {
+    DebugLogEntryData entry; // entries are stored with their padding, the chunks hold them packed
+    uint8_t chunk[LOGSTREAM_CHUNK_SIZE(STREAM_ENTRY_SIZE)];
+} StreamBuffer;
 
 // private variables
 static DebugLogSettingsData settings;
@@ -43,12 +58,19 @@ static DebugLogControlData control;
 static DebugLogStatusData status;
 static FlightStatusData flightstatus;
 static DebugLogEntryData *entry; // would be better on stack but event dispatcher stack might be insufficient
+static DelayedCallbackInfo *streamCallback;
+static StreamBuffer *streamBuffer; // only allocated once a stream is asked for
+static struct logstream stream;
+static DebugLogControlData streamRequest;
+static volatile bool streamRestart;
 
 // private functions
 static void SettingsUpdatedCb(UAVObjEvent *ev);
 static void ControlUpdatedCb(UAVObjEvent *ev);
 static void StatusUpdatedCb(UAVObjEvent *ev);
 static void FlightStatusUpdatedCb(UAVObjEvent *ev);
+static void StreamCb(void);
+static bool StreamReadEntry(void *ctx, uint16_t flight, uint16_t num, uint8_t *out);
 
 int32_t LoggingInitialize(void)
 {
@@ -62,6 +84,8 @@ int32_t LoggingInitialize(void)
     if (!entry) {
         return -1;
     }
+    logstream_init(&stream, STREAM_ENTRY_SIZE, StreamReadEntry, NULL);
+    streamCallback = PIOS_CALLBACKSCHEDULER_Create(&StreamCb, STREAM_CALLBACK_PRIORITY, STREAM_CBTASK_PRIORITY, CALLBACKINFO_RUNNING_LOGGING, STREAM_STACK_SIZE_BYTES);
 
     return 0;
 }
@@ -139,10 +163,55 @@ static void ControlUpdatedCb(__attribute__((unused)) UAVObjEvent *ev)
         if (armed == FLIGHTSTATUS_ARMED_DISARMED) {
             PIOS_DEBUGLOG_Format();
         }
+    } else if (control.Operation == DEBUGLOGCONTROL_OPERATION_STREAM) {
+        if (!streamBuffer) {
+            streamBuffer = pios_malloc(sizeof(StreamBuffer));
+        }
+        if (streamBuffer) {
+            // picked up by the stream callback, which restarts where asked
+            streamRequest = control;
+            streamRestart = true;
+            PIOS_CALLBACKSCHEDULER_Dispatch(streamCallback);
+        }
     }
     StatusUpdatedCb(ev);
 }
 
+static bool StreamReadEntry(__attribute__((unused)) void *ctx, uint16_t flight, uint16_t num, uint8_t *out)
+{
+    if (PIOS_DEBUGLOG_Read(&streamBuffer->entry, flight, num) != 0) {
+        return false;
+    }
+    memcpy(out, &streamBuffer->entry, STREAM_ENTRY_SIZE);
+    return true;
+}
+
+/**
+ * Sends one chunk of the stream, and comes back for the next one until the
+ * stream is done. Nothing waits for the GCS, which asks for a new stream
+ * from where it lost track if a chunk does not make it.
+ */
+static void StreamCb(void)
+{
+    if (streamRestart) {
+        streamRestart = false;
+        logstream_start(&stream, streamRequest.Flight, streamRequest.Entry, streamRequest.Count);
+    }
+
+    uint32_t length = logstream_next(&stream, streamBuffer->chunk);
+    if (length == 0) {
+        return;
+    }
+    if (TelemetrySendStream(DEBUGLOGENTRY_OBJID, 0, streamBuffer->chunk, length) != 0) {
+        // the link is gone, the GCS will ask again
+        stream.done = true;
+        return;
+    }
+    if (!stream.done) {
+        PIOS_CALLBACKSCHEDULER_Dispatch(streamCallback);
+    }
+}
+
 
 /**
  * @}
@@ -76,6 +76,9 @@ typedef struct {
     UAVTalkConnection telemUAVTalkCon;
     UAVTalkConnection radioUAVTalkCon;
 
+    // The port the packet being written on the com side goes to.
+    uint32_t telemReservedPort;
+
     // Queue handles.
     xQueueHandle uavtalkEventQueue;
     xQueueHandle radioEventQueue;
@@ -108,6 +111,10 @@ static void radioRxTask(void *parameters);
 static void PPMInputTask(void *parameters);
 static int32_t UAVTalkSendHandler(uint8_t *buf, int32_t length);
 static int32_t RadioSendHandler(uint8_t *buf, int32_t length);
+static int32_t UAVTalkReserveHandler(uint16_t length, struct pios_com_span *span);
+static int32_t UAVTalkCommitHandler(uint16_t length);
+static int32_t RadioReserveHandler(uint16_t length, struct pios_com_span *span);
+static int32_t RadioCommitHandler(uint16_t length);
 static void ProcessTelemetryStream(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle, uint8_t rxbyte);
 static void ProcessRadioStream(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle, uint8_t rxbyte);
 static void objectPersistenceUpdatedCb(UAVObjEvent *objEv);
@@ -239,6 +246,8 @@ static int32_t RadioComBridgeInitialize(void)
     // Initialise UAVTalk
     data->telemUAVTalkCon    = UAVTalkInitialize(&UAVTalkSendHandler);
     data->radioUAVTalkCon    = UAVTalkInitialize(&RadioSendHandler);
+    UAVTalkSetOutputBuffer(data->telemUAVTalkCon, &UAVTalkReserveHandler, &UAVTalkCommitHandler);
+    UAVTalkSetOutputBuffer(data->radioUAVTalkCon, &RadioReserveHandler, &RadioCommitHandler);
 
     // Initialize the queues.
     data->uavtalkEventQueue  = xQueueCreate(EVENT_QUEUE_SIZE, sizeof(UAVObjEvent));
@@ -590,6 +599,89 @@ static int32_t RadioSendHandler(uint8_t *buf, int32_t length)
     }
 }
 
+/**
+ * @brief Reserve room for a packet in the transmit buffer of the com port.
+ *
+ * @param[in] length Length of the packet
+ * @param[out] span Where to write the packet
+ * @return -1 if the packet has to be sent with UAVTalkSendHandler()
+ * @return 0 on success
+ */
+static int32_t UAVTalkReserveHandler(uint16_t length, struct pios_com_span *span)
+{
+    int32_t ret;
+    uint32_t outputPort = data->parseUAVTalk ? PIOS_COM_TELEMETRY : 0;
+
+#if defined(PIOS_INCLUDE_USB)
+    // Determine output port (USB takes priority over telemetry port)
+    if (PIOS_COM_TELEM_USB_HID && PIOS_COM_Available(PIOS_COM_TELEM_USB_HID)) {
+        outputPort = PIOS_COM_TELEM_USB_HID;
+    }
+#endif /* PIOS_INCLUDE_USB */
+    data->telemReservedPort = outputPort;
+    if (outputPort) {
+        // Same retries as UAVTalkSendHandler
+        ret = -2;
+        uint8_t count = 5;
+        while (count-- > 0 && ret < -1) {
+            ret = PIOS_COM_ReserveBuffer(outputPort, length, span, 0);
+        }
+    } else {
+        ret = -1;
+    }
+    return ret;
+}
+
+/**
+ * @brief Transmit the packet written in the room from UAVTalkReserveHandler().
+ *
+ * @param[in] length Length of the packet
+ * @return -1 on failure
+ * @return number of bytes transmitted on success
+ */
+static int32_t UAVTalkCommitHandler(uint16_t length)
+{
+    return PIOS_COM_CommitBuffer(data->telemReservedPort, length);
+}
+
+/**
+ * Reserve room for a packet in the transmit buffer of the radio port.
+ *
+ * @param[in] length Length of the packet
+ * @param[out] span Where to write the packet
+ * @return -1 if the packet has to be sent with RadioSendHandler()
+ * @return 0 on success
+ */
+static int32_t RadioReserveHandler(uint16_t length, struct pios_com_span *span)
+{
+    uint32_t outputPort = PIOS_COM_RADIO;
+
+    // RadioSendHandler() drops the packet when not parsing UAVTalk.
+    if (data->parseUAVTalk && outputPort && PIOS_COM_Available(outputPort)) {
+        // Same retries as RadioSendHandler
+        int32_t ret   = -2;
+        uint8_t count = 5;
+        while (count-- > 0 && ret < -1) {
+            ret = PIOS_COM_ReserveBuffer(outputPort, length, span, 0);
+        }
+        return ret;
+    } else {
+        return -1;
+    }
+}
+
+/**
+ * Transmit the packet written in the room from RadioReserveHandler().
+ *
+ * @param[in] length Length of the packet
+ * @return -1 on failure
+ * @return number of bytes transmitted on success
+ */
+static int32_t RadioCommitHandler(uint16_t length)
+{
+    return PIOS_COM_CommitBuffer(PIOS_COM_RADIO, length);
+}
+
 /**
  * @brief Process a byte of data received on the telemetry stream
  *
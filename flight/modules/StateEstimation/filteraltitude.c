@@ -147,9 +147,9 @@ static filterResult filter(stateFilter *self, stateEstimation *state)
             // rotate accels into global coordinate frame
             AttitudeStateData att;
             AttitudeStateGet(&att);
-            float Rbe[3][3];
-            Quaternion2R(&att.q1, Rbe);
-            float current = -(Rbe[0][2] * state->accel[0] + Rbe[1][2] * state->accel[1] + Rbe[2][2] * state->accel[2] + this->gravity);
+            float accelNED[3];
+            quat_rotate_vector_transpose(&att.q1, state->accel, accelNED);
+            float current = -(accelNED[2] + this->gravity);
 
             // low pass filter accelerometers
             this->accelState = (1.0f - this->settings.AccelLowPassKp) * this->accelState + this->settings.AccelLowPassKp * current;
@@ -367,11 +367,8 @@ static filterResult complementaryFilter(struct data *this, float gyro[3], float
     if (this->magUpdated && this->useMag) {
         // Rotate gravity to body frame and cross with accels
         float brot[3];
-        float Rbe[3][3];
 
-        Quaternion2R(attitude, Rbe);
-
-        rot_mult(Rbe, this->homeLocation.Be, brot);
+        quat_rotate_vector(attitude, this->homeLocation.Be, brot);
 
         float mag_len = sqrtf(mag[0] * mag[0] + mag[1] * mag[1] + mag[2] * mag[2]);
         mag[0]  /= mag_len;
@@ -417,37 +414,10 @@ static filterResult complementaryFilter(struct data *this, float gyro[3], float
         gyrotmp[2] += accel_err[2] * this->attitudeSettings.AccelKp / dT;
     }
 
-    // Work out time derivative from INSAlgo writeup
-    // Also accounts for the fact that gyros are in deg/s
-    float qdot[4];
-    qdot[0]     = DEG2RAD(-attitude[1] * gyrotmp[0] - attitude[2] * gyrotmp[1] - attitude[3] * gyrotmp[2]) * dT / 2;
-    qdot[1]     = DEG2RAD(attitude[0] * gyrotmp[0] - attitude[3] * gyrotmp[1] + attitude[2] * gyrotmp[2]) * dT / 2;
-    qdot[2]     = DEG2RAD(attitude[3] * gyrotmp[0] + attitude[0] * gyrotmp[1] - attitude[1] * gyrotmp[2]) * dT / 2;
-    qdot[3]     = DEG2RAD(-attitude[2] * gyrotmp[0] + attitude[1] * gyrotmp[1] + attitude[0] * gyrotmp[2]) * dT / 2;
-
-    // Take a time step
-    attitude[0] = attitude[0] + qdot[0];
-    attitude[1] = attitude[1] + qdot[1];
-    attitude[2] = attitude[2] + qdot[2];
-    attitude[3] = attitude[3] + qdot[3];
-
-    if (attitude[0] < 0.0f) {
-        attitude[0] = -attitude[0];
-        attitude[1] = -attitude[1];
-        attitude[2] = -attitude[2];
-        attitude[3] = -attitude[3];
-    }
-
-    // Renomalize
-    float qmag = sqrtf(attitude[0] * attitude[0] + attitude[1] * attitude[1] + attitude[2] * attitude[2] + attitude[3] * attitude[3]);
-    attitude[0] = attitude[0] / qmag;
-    attitude[1] = attitude[1] / qmag;
-    attitude[2] = attitude[2] / qmag;
-    attitude[3] = attitude[3] / qmag;
-
+    // Take a time step and renormalize
     // If quaternion has become inappropriately short or is nan reinit.
     // THIS SHOULD NEVER ACTUALLY HAPPEN
-    if ((fabsf(qmag) < 1.0e-3f) || isnan(qmag)) {
+    if (!quat_integrate_normalize(attitude, gyrotmp, dT)) {
         this->first_run = 1;
         return FILTERRESULT_WARNING;
     }
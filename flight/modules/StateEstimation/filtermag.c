@@ -255,7 +255,6 @@ void magOffsetEstimation(struct data *this, float mag[3])
     const float Rz   = this->homeLocationBe[2];
 
     const float rate = this->revoCalibration.MagBiasNullingRate;
-    float Rot[3][3];
     float B_e[3];
     float xy[2];
     float delta[3];
@@ -263,13 +262,8 @@ void magOffsetEstimation(struct data *this, float mag[3])
     AttitudeStateData attitude;
     AttitudeStateGet(&attitude);
 
-    // Get the rotation matrix
-    Quaternion2R(&attitude.q1, Rot);
-
     // Rotate the mag into the NED frame
-    B_e[0] = Rot[0][0] * mag[0] + Rot[1][0] * mag[1] + Rot[2][0] * mag[2];
-    B_e[1] = Rot[0][1] * mag[0] + Rot[1][1] * mag[1] + Rot[2][1] * mag[2];
-    B_e[2] = Rot[0][2] * mag[0] + Rot[1][2] * mag[1] + Rot[2][2] * mag[2];
+    quat_rotate_vector_transpose(&attitude.q1, mag, B_e);
 
     float cy = cosf(DEG2RAD(attitude.Yaw));
     float sy = sinf(DEG2RAD(attitude.Yaw));
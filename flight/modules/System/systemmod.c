@@ -58,6 +58,7 @@
 #include <callbackinfo.h>
 #include <hwsettings.h>
 #include <pios_flashfs.h>
+#include <pios_flashfs_logfs_priv.h>
 #include <pios_notify.h>
 
 #ifdef PIOS_INCLUDE_INSTRUMENTATION
@@ -216,6 +217,15 @@ static void systemTask(__attribute__((unused)) void *parameters)
         updateStats();
         // Update the system alarms
         updateSystemAlarms();
+#if !defined(ARCH_POSIX) && !defined(ARCH_WIN32)
+        // Erase the flash for the next settings garbage collection in the background
+        if (pios_uavo_settings_fs_id) {
+            PIOS_FLASHFS_Logfs_Poll(pios_uavo_settings_fs_id);
+        }
+        if (pios_user_fs_id) {
+            PIOS_FLASHFS_Logfs_Poll(pios_user_fs_id);
+        }
+#endif
 #ifdef DIAG_I2C_WDG_STATS
         updateI2Cstats();
         updateWDGstats();
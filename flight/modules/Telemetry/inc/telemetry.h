@@ -37,6 +37,7 @@
 #define TELEMETRY_H
 
 int32_t TelemetryInitialize(void);
+int32_t TelemetrySendStream(uint32_t objId, uint16_t instId, const uint8_t *data, uint16_t length);
 
 #endif // TELEMETRY_H
 
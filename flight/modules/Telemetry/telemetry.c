@@ -38,6 +38,9 @@
 #include "gcstelemetrystats.h"
 #include "hwsettings.h"
 #include "taskinfo.h"
+#if defined(PIOS_TELEM_SCHEDULER)
+#include "telemetrysched.h"
+#endif
 
 // Private constants
 #define MAX_QUEUE_SIZE            TELEM_QUEUE_SIZE
@@ -61,8 +64,12 @@
 #define TASK_PRIORITY_RADRX       (tskIDLE_PRIORITY + 2)
 #define REQ_TIMEOUT_MS            250
 #define MAX_RETRIES               2
+#define TX_TIMEOUT_MS             5000  // Longest wait for room in a port, as PIOS_COM_SendBuffer()
 #define STATS_UPDATE_PERIOD_MS    4000
 #define CONNECTION_TIMEOUT_MS     8000
+#define FAST_PERIOD_MS            1000  // Periodic updates up to this fast carry flight state
+#define PACKET_OVERHEAD           13    // UAVTalk header and CRC
+#define USB_RATE                  64000 // bytes/s, a 64 byte report per ms
 
 // Private types
 
@@ -88,9 +95,25 @@ static uint32_t txErrors;
 static uint32_t txRetries;
 static uint32_t timeOfLastObjectUpdate;
 static UAVTalkConnection uavTalkCon;
+static uint32_t reservedPort;
 #ifdef PIOS_INCLUDE_RFM22B
 static UAVTalkConnection radioUavTalkCon;
 #endif
+static uint32_t telemetryBaud;
+#if defined(PIOS_TELEM_SCHEDULER)
+static struct telemetrysched sched;
+static struct telemetrysched_item schedItems[TELEMETRYSCHED_CLASSES * MAX_QUEUE_SIZE];
+// One update per class waiting for room, so that a full class holds up no other
+static struct telemetrysched_item parkedItems[TELEMETRYSCHED_CLASSES];
+static bool parked[TELEMETRYSCHED_CLASSES];
+static uint32_t scheduledPort;
+static uint8_t scheduledScale;
+// Written by whichever task sends, under the connection lock
+static volatile uint32_t linkBytes;
+static volatile uint32_t linkWaits;
+static uint32_t accountedBytes;
+static uint32_t accountedWaits;
+#endif
 
 // Private functions
 static void telemetryTxTask(void *parameters);
@@ -98,8 +121,12 @@ static void telemetryRxTask(void *parameters);
 #ifdef PIOS_INCLUDE_RFM22B
 static void radioRxTask(void *parameters);
 static int32_t transmitRadioData(uint8_t *data, int32_t length);
+static int32_t reserveRadioData(uint16_t length, struct pios_com_span *span);
+static int32_t commitRadioData(uint16_t length);
 #endif
 static int32_t transmitData(uint8_t *data, int32_t length);
+static int32_t reserveData(uint16_t length, struct pios_com_span *span);
+static int32_t commitData(uint16_t length);
 static void registerObject(UAVObjHandle obj);
 static void updateObject(UAVObjHandle obj, int32_t eventType);
 static int32_t setUpdatePeriod(UAVObjHandle obj, int32_t updatePeriodMs);
@@ -109,6 +136,14 @@ static void updateTelemetryStats();
 static void gcsTelemetryStatsUpdated();
 static void updateSettings();
 static uint32_t getComPort(bool input);
+#if defined(PIOS_TELEM_SCHEDULER)
+static bool scheduleParked();
+static bool scheduleQueue(xQueueHandle eventQueue);
+static bool scheduleEvent(UAVObjEvent *ev, struct telemetrysched_item *item);
+static uint8_t periodicPriority(UAVObjHandle obj, int32_t updatePeriodMs);
+static void rescheduleObject(UAVObjHandle obj);
+static void accountLink(uint32_t timeNow);
+#endif
 
 /**
  * Initialise the telemetry module
@@ -163,11 +198,18 @@ int32_t TelemetryInitialize(void)
 #endif
     HwSettingsInitialize();
     updateSettings();
+#if defined(PIOS_TELEM_SCHEDULER)
+    telemetrysched_init(&sched, schedItems, MAX_QUEUE_SIZE, telemetryBaud / 10, xTaskGetTickCount() * portTICK_RATE_MS);
+    scheduledPort  = telemetryPort;
+    scheduledScale = 1;
+#endif
 
     // Initialise UAVTalk
     uavTalkCon = UAVTalkInitialize(&transmitData);
+    UAVTalkSetOutputBuffer(uavTalkCon, &reserveData, &commitData);
 #ifdef PIOS_INCLUDE_RFM22B
     radioUavTalkCon = UAVTalkInitialize(&transmitRadioData);
+    UAVTalkSetOutputBuffer(radioUavTalkCon, &reserveRadioData, &commitRadioData);
 #endif
 
     // Create periodic event that will be used to update the telemetry stats
@@ -183,6 +225,17 @@ int32_t TelemetryInitialize(void)
 
 MODULE_INITCALL(TelemetryInitialize, TelemetryStart);
 
+/**
+ * Stream a block of data to the GCS, unacked, on the port objects go to
+ * (USB when connected). See UAVTalkSendStream().
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t TelemetrySendStream(uint32_t objId, uint16_t instId, const uint8_t *data, uint16_t length)
+{
+    return UAVTalkSendStream(uavTalkCon, objId, instId, data, length);
+}
+
 /**
  * Register a new object, adds object to local list and connects the queue depending on the object's
  * telemetry settings.
@@ -383,6 +436,203 @@ static void processObjEvent(UAVObjEvent *ev)
     }
 }
 
+#if defined(PIOS_TELEM_SCHEDULER)
+/**
+ * Telemetry transmit task, sends the scheduled updates as the link allows
+ */
+static void telemetryTxTask(__attribute__((unused)) void *parameters)
+{
+    UAVObjEvent ev;
+    struct telemetrysched_item item;
+    bool stalled;
+
+    // Loop forever
+    while (1) {
+        uint32_t outputPort = getComPort(false);
+
+        if (outputPort && outputPort != scheduledPort) {
+            scheduledPort = outputPort;
+            telemetrysched_set_rate(&sched, (outputPort == telemetryPort) ? telemetryBaud / 10 : USB_RATE);
+        }
+
+        // Sort everything waiting into the schedule, what waited longest first
+        stalled  = scheduleParked();
+        stalled |= scheduleQueue(priorityQueue);
+#if defined(PIOS_TELEM_PRIORITY_QUEUE)
+        stalled |= scheduleQueue(queue);
+#endif
+
+        if (telemetrysched_pop(&sched, xTaskGetTickCount() * portTICK_RATE_MS, &item)) {
+            ev.obj    = (UAVObjHandle)item.obj;
+            ev.instId = item.instId;
+            ev.event  = (UAVObjEventType)item.event;
+            ev.lowPriority = false;
+            processObjEvent(&ev);
+            telemetrysched_sent(&sched, &item, xTaskGetTickCount() * portTICK_RATE_MS);
+        } else if (stalled) {
+            // Nothing may go yet and an update waits for room in its class
+            vTaskDelay(1);
+        } else {
+            // Nothing may go yet, wait on priority queue for updates (1 tick) then repeat cycle
+            xQueuePeek(priorityQueue, &ev, 1);
+        }
+        accountLink(xTaskGetTickCount() * portTICK_RATE_MS);
+
+        // Stretch or restore the low priority periods
+        if (sched.periodScale != scheduledScale) {
+            scheduledScale = sched.periodScale;
+            UAVObjIterate(&rescheduleObject);
+        }
+    }
+}
+
+/**
+ * Pushes the parked updates again, each into the class that refused it
+ * \return true if an update is still parked
+ */
+static bool scheduleParked()
+{
+    bool stalled = false;
+
+    for (uint8_t n = 0; n < TELEMETRYSCHED_CLASSES; ++n) {
+        if (parked[n] && telemetrysched_push(&sched, &parkedItems[n]) != TELEMETRYSCHED_ERR_FULL) {
+            parked[n] = false;
+        }
+        stalled |= parked[n];
+    }
+    return stalled;
+}
+
+/**
+ * Moves the events of a queue into the schedule. An update whose class is
+ * full is parked for that class, the other classes keep going. When the
+ * class already has one parked, the event goes to the back of the queue,
+ * unless it is for the same update.
+ * \return true if an event was parked or sent back to the queue
+ */
+static bool scheduleQueue(xQueueHandle eventQueue)
+{
+    UAVObjEvent ev;
+    struct telemetrysched_item item;
+    unsigned portBASE_TYPE waiting = uxQueueMessagesWaiting(eventQueue);
+    bool stalled = false;
+
+    // Only the events there at the start, those sent back wait for the next pass
+    while (waiting-- > 0 && xQueueReceive(eventQueue, &ev, 0) == pdTRUE) {
+        if (scheduleEvent(&ev, &item)) {
+            continue;
+        }
+        stalled = true;
+        if (!parked[item.priority]) {
+            parkedItems[item.priority] = item;
+            parked[item.priority]      = true;
+        } else if (parkedItems[item.priority].obj != item.obj || parkedItems[item.priority].instId != item.instId ||
+                   parkedItems[item.priority].event != item.event) {
+            if (xQueueSendToBack(eventQueue, &ev, 0) != pdTRUE) {
+                ++txErrors;
+            }
+        }
+    }
+    return stalled;
+}
+
+/**
+ * Queues an event in the schedule, in the class its object and metadata
+ * give it. Events that send nothing go straight through.
+ * \return false if the class is full and the update in item has to be
+ * pushed again later, only periodic updates that are not acked are dropped
+ * instead
+ */
+static bool scheduleEvent(UAVObjEvent *ev, struct telemetrysched_item *item)
+{
+    UAVObjMetadata metadata;
+    UAVObjUpdateMode updateMode;
+    uint32_t length;
+
+    if (ev->obj == 0 || ev->obj == GCSTelemetryStatsHandle() || ev->event == EV_LOGGING_MANUAL || ev->event == EV_LOGGING_PERIODIC) {
+        processObjEvent(ev);
+        return true;
+    }
+
+    UAVObjGetMetadata(ev->obj, &metadata);
+    updateMode     = UAVObjGetTelemetryUpdateMode(&metadata);
+
+    item->obj      = ev->obj;
+    item->instId   = ev->instId;
+    item->event    = ev->event;
+    item->periodic = ev->event == EV_UPDATED_PERIODIC && !UAVObjGetTelemetryAcked(&metadata);
+    item->queued   = xTaskGetTickCount() * portTICK_RATE_MS;
+
+    // Requests and state changes first, and the objects marked priority
+    // (the settings are too, implicitly, but are bulk)
+    if (UAVObjIsMetaobject(ev->obj)) {
+        item->priority = TELEMETRYSCHED_NORMAL;
+    } else if (ev->event == EV_UPDATE_REQ || (UAVObjIsPriority(ev->obj) && !UAVObjIsSettings(ev->obj))) {
+        item->priority = TELEMETRYSCHED_HIGH;
+    } else if (UAVObjIsSettings(ev->obj)) {
+        item->priority = TELEMETRYSCHED_LOW;
+    } else if (updateMode == UPDATEMODE_PERIODIC) {
+        item->priority = periodicPriority(ev->obj, metadata.telemetryUpdatePeriod);
+    } else if (ev->event == EV_UPDATED) {
+        item->priority = TELEMETRYSCHED_HIGH;
+    } else {
+        item->priority = TELEMETRYSCHED_NORMAL;
+    }
+
+    if (ev->event == EV_UPDATE_REQ) {
+        length = PACKET_OVERHEAD;
+    } else if (ev->instId == UAVOBJ_ALL_INSTANCES) {
+        length = (uint32_t)UAVObjGetNumInstances(ev->obj) * (UAVObjGetNumBytes(ev->obj) + PACKET_OVERHEAD);
+    } else {
+        length = UAVObjGetNumBytes(ev->obj) + PACKET_OVERHEAD;
+    }
+    // A large multi instance object would wrap, it only has to cost a lot
+    item->length = (length > UINT16_MAX) ? UINT16_MAX : length;
+
+    return telemetrysched_push(&sched, item) != TELEMETRYSCHED_ERR_FULL || item->periodic;
+}
+
+/**
+ * Class of the periodic updates of an object: fast ones carry flight state,
+ * slow ones status and debug data
+ */
+static uint8_t periodicPriority(UAVObjHandle obj, int32_t updatePeriodMs)
+{
+    if (UAVObjIsPriority(obj) && !UAVObjIsSettings(obj)) {
+        return TELEMETRYSCHED_HIGH;
+    }
+    return (updatePeriodMs <= FAST_PERIOD_MS) ? TELEMETRYSCHED_NORMAL : TELEMETRYSCHED_LOW;
+}
+
+/**
+ * Sets the update period of a periodic object again, at the current scale
+ */
+static void rescheduleObject(UAVObjHandle obj)
+{
+    UAVObjMetadata metadata;
+
+    if (UAVObjIsMetaobject(obj)) {
+        return;
+    }
+    UAVObjGetMetadata(obj, &metadata);
+    if (UAVObjGetTelemetryUpdateMode(&metadata) == UPDATEMODE_PERIODIC) {
+        setUpdatePeriod(obj, metadata.telemetryUpdatePeriod);
+    }
+}
+
+/**
+ * Hands the bytes written to the port since the last call to the schedule
+ */
+static void accountLink(uint32_t timeNow)
+{
+    uint32_t bytes = linkBytes;
+    uint32_t waits = linkWaits;
+
+    telemetrysched_link(&sched, bytes - accountedBytes, waits != accountedWaits, timeNow);
+    accountedBytes = bytes;
+    accountedWaits = waits;
+}
+#else /* if defined(PIOS_TELEM_SCHEDULER) */
 /**
  * Telemetry transmit task, regular priority
  */
@@ -419,6 +669,7 @@ static void telemetryTxTask(__attribute__((unused)) void *parameters)
 #endif /* if defined(PIOS_TELEM_PRIORITY_QUEUE) */
     }
 }
+#endif /* if defined(PIOS_TELEM_SCHEDULER) */
 
 
 /**
@@ -486,6 +737,34 @@ static int32_t transmitRadioData(uint8_t *data, int32_t length)
 
     return -1;
 }
+
+/**
+ * Reserve room for a packet in the transmit buffer of the radioport.
+ * \param[in] length Length of the packet
+ * \param[out] span Where to write the packet
+ * \return -1 if the packet has to be sent with transmitRadioData()
+ * \return -2 or -3 if the port is busy, room is waited for up to TX_TIMEOUT_MS
+ * \return 0 on success
+ */
+static int32_t reserveRadioData(uint16_t length, struct pios_com_span *span)
+{
+    if (radioPort) {
+        return PIOS_COM_ReserveBuffer(radioPort, length, span, TX_TIMEOUT_MS);
+    }
+
+    return -1;
+}
+
+/**
+ * Transmit the packet written in the room from reserveRadioData().
+ * \param[in] length Length of the packet
+ * \return -1 on failure
+ * \return number of bytes transmitted on success
+ */
+static int32_t commitRadioData(uint16_t length)
+{
+    return PIOS_COM_CommitBuffer(radioPort, length);
+}
 #endif /* PIOS_INCLUDE_RFM22B */
 
 /**
@@ -506,6 +785,53 @@ static int32_t transmitData(uint8_t *data, int32_t length)
     return -1;
 }
 
+/**
+ * Reserve room for a packet in the transmit buffer of the modem or USB port.
+ * The port is kept for commitData(), the connection lock keeps the two together.
+ * \param[in] length Length of the packet
+ * \param[out] span Where to write the packet
+ * \return -1 if the packet has to be sent with transmitData()
+ * \return -2 or -3 if the port is busy, room is waited for up to TX_TIMEOUT_MS
+ * \return 0 on success
+ */
+static int32_t reserveData(uint16_t length, struct pios_com_span *span)
+{
+    reservedPort = getComPort(false);
+
+    if (reservedPort) {
+#if defined(PIOS_TELEM_SCHEDULER)
+        // Count what goes out and whether the port made us wait, for the
+        // capacity estimate of the schedule
+        int32_t ret = PIOS_COM_ReserveBuffer(reservedPort, length, span, 0);
+        if (ret == -2) {
+            linkWaits++;
+        }
+        if (ret == -2 || ret == -3) {
+            ret = PIOS_COM_ReserveBuffer(reservedPort, length, span, TX_TIMEOUT_MS);
+        }
+        if (ret == 0) {
+            linkBytes += length;
+        }
+        return ret;
+#else
+        return PIOS_COM_ReserveBuffer(reservedPort, length, span, TX_TIMEOUT_MS);
+#endif
+    }
+
+    return -1;
+}
+
+/**
+ * Transmit the packet written in the room from reserveData().
+ * \param[in] length Length of the packet
+ * \return -1 on failure
+ * \return number of bytes transmitted on success
+ */
+static int32_t commitData(uint16_t length)
+{
+    return PIOS_COM_CommitBuffer(reservedPort, length);
+}
+
 /**
  * Set update period of object (it must be already setup for periodic updates)
  * \param[in] obj The object to update
@@ -526,6 +852,11 @@ static int32_t setUpdatePeriod(UAVObjHandle obj, int32_t updatePeriodMs)
 
     xQueueHandle targetQueue = UAVObjIsPriority(obj) ? priorityQueue : queue;
 
+#if defined(PIOS_TELEM_SCHEDULER)
+    // Low priority updates slow down while the link is congested
+    updatePeriodMs = telemetrysched_period(&sched, periodicPriority(obj, updatePeriodMs), updatePeriodMs);
+#endif
+
     ret = EventPeriodicQueueUpdate(&ev, targetQueue, updatePeriodMs);
     if (ret == -1) {
         ret = EventPeriodicQueueCreate(&ev, targetQueue, updatePeriodMs);
@@ -626,6 +957,25 @@ static void updateTelemetryStats()
     txErrors  = 0;
     txRetries = 0;
 
+#if defined(PIOS_TELEM_SCHEDULER)
+    // Latencies and drops (of periodic updates) of the schedule since the last update
+    struct telemetrysched_stats schedStats;
+    telemetrysched_get_stats(&sched, &schedStats, true);
+    flightStats.TxLatencyMean.High   = schedStats.latencyMean[TELEMETRYSCHED_HIGH];
+    flightStats.TxLatencyMean.Normal = schedStats.latencyMean[TELEMETRYSCHED_NORMAL];
+    flightStats.TxLatencyMean.Low    = schedStats.latencyMean[TELEMETRYSCHED_LOW];
+    flightStats.TxLatencyMax.High    = schedStats.latencyMax[TELEMETRYSCHED_HIGH];
+    flightStats.TxLatencyMax.Normal  = schedStats.latencyMax[TELEMETRYSCHED_NORMAL];
+    flightStats.TxLatencyMax.Low     = schedStats.latencyMax[TELEMETRYSCHED_LOW];
+    flightStats.TxLinkCapacity = schedStats.capacity;
+    flightStats.TxPeriodScale  = schedStats.periodScale;
+    if (flightStats.Status == FLIGHTTELEMETRYSTATS_STATUS_CONNECTED) {
+        flightStats.TxDropped += schedStats.dropped[TELEMETRYSCHED_HIGH] + schedStats.dropped[TELEMETRYSCHED_NORMAL] + schedStats.dropped[TELEMETRYSCHED_LOW];
+    } else {
+        flightStats.TxDropped = 0;
+    }
+#endif
+
     // Check for connection timeout
     timeNow   = xTaskGetTickCount() * portTICK_RATE_MS;
     if (utalkStats.rxObjects > 0) {
@@ -693,27 +1043,30 @@ static void updateSettings()
         // Set port speed
         switch (speed) {
         case HWSETTINGS_TELEMETRYSPEED_2400:
-            PIOS_COM_ChangeBaud(telemetryPort, 2400);
+            telemetryBaud = 2400;
             break;
         case HWSETTINGS_TELEMETRYSPEED_4800:
-            PIOS_COM_ChangeBaud(telemetryPort, 4800);
+            telemetryBaud = 4800;
             break;
         case HWSETTINGS_TELEMETRYSPEED_9600:
-            PIOS_COM_ChangeBaud(telemetryPort, 9600);
+            telemetryBaud = 9600;
             break;
         case HWSETTINGS_TELEMETRYSPEED_19200:
-            PIOS_COM_ChangeBaud(telemetryPort, 19200);
+            telemetryBaud = 19200;
             break;
         case HWSETTINGS_TELEMETRYSPEED_38400:
-            PIOS_COM_ChangeBaud(telemetryPort, 38400);
+            telemetryBaud = 38400;
             break;
         case HWSETTINGS_TELEMETRYSPEED_57600:
-            PIOS_COM_ChangeBaud(telemetryPort, 57600);
+            telemetryBaud = 57600;
             break;
         case HWSETTINGS_TELEMETRYSPEED_115200:
-            PIOS_COM_ChangeBaud(telemetryPort, 115200);
+            telemetryBaud = 115200;
             break;
         }
+        if (telemetryBaud) {
+            PIOS_COM_ChangeBaud(telemetryPort, telemetryBaud);
+        }
     }
 }
 
@@ -0,0 +1,179 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_ADC ADC Functions
+ * @brief Hardware independent decimation and smoothing of ADC samples
+ * @{
+ *
+ * @file       pios_adc_filter.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Boxcar or CIC decimation with optional IIR smoothing, per channel.
+ * @see        The GNU Public License (GPL) Version 3
+ * @notes
+ *
+ * Runs from the ADC DMA interrupt on every completed buffer, so the cost
+ * is a fixed number of adds per input sample plus a fixed amount of work
+ * per output. Integer only, the results are bit exact on any host.
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <pios.h>
+
+#ifdef PIOS_INCLUDE_ADC
+
+#include <pios_adc_filter.h>
+
+#define IIR_EXTRA_BITS 8
+#define IIR_MAX_SHIFT  15
+
+/**
+ * Set up a channel, clearing all filter state
+ * \return 0 on success, -1 if the configuration is not supported
+ */
+int32_t PIOS_ADC_Filter_Init(struct pios_adc_filter *filter, const struct pios_adc_filter_cfg *cfg)
+{
+    uint32_t gain = 1;
+
+    if (cfg->iir_shift > IIR_MAX_SHIFT) {
+        return -1;
+    }
+
+    switch (cfg->decimation) {
+    case PIOS_ADC_FILTER_BOXCAR:
+        gain = cfg->ratio;
+        break;
+    case PIOS_ADC_FILTER_CIC:
+        if (cfg->order < 1 || cfg->order > PIOS_ADC_FILTER_MAX_ORDER) {
+            return -1;
+        }
+        /* The registers wrap, the full scale output must still fit */
+        for (uint8_t i = 0; i < cfg->order; i++) {
+            gain *= cfg->ratio;
+            if (gain > (1UL << (32 - PIOS_ADC_FILTER_INPUT_BITS))) {
+                return -1;
+            }
+        }
+        break;
+    default:
+        return -1;
+    }
+
+    memset(filter, 0, sizeof(*filter));
+    filter->cfg  = *cfg;
+    filter->gain = gain;
+    if (cfg->decimation == PIOS_ADC_FILTER_CIC) {
+        /* Outputs before the comb delays hold real history are partial sums */
+        filter->settle = cfg->order - 1;
+    }
+
+    return 0;
+}
+
+static bool PIOS_ADC_Filter_Output(struct pios_adc_filter *filter, uint32_t sum, uint32_t timestamp)
+{
+    if (filter->settle > 0) {
+        filter->settle--;
+        return false;
+    }
+
+    /* sum / gain with rounded fractional bits, without a 64 bit divide */
+    uint32_t quotient  = sum / filter->gain;
+    uint32_t remainder = sum % filter->gain;
+    uint32_t value     = (quotient << PIOS_ADC_FILTER_FRAC_BITS) +
+                         ((remainder << PIOS_ADC_FILTER_FRAC_BITS) + filter->gain / 2) / filter->gain;
+
+    if (filter->cfg.iir_shift) {
+        int32_t x = (int32_t)(value << IIR_EXTRA_BITS);
+
+        if (filter->count == 0) {
+            filter->iir = x;
+        } else {
+            filter->iir += (x - filter->iir) >> filter->cfg.iir_shift;
+        }
+        value = ((uint32_t)filter->iir + (1 << (IIR_EXTRA_BITS - 1))) >> IIR_EXTRA_BITS;
+    }
+
+    filter->value     = value;
+    filter->timestamp = timestamp;
+    filter->count++;
+
+    return true;
+}
+
+/**
+ * Feed a block of samples of one channel
+ * \param[in] samples first sample of the channel in the block
+ * \param[in] count number of samples of the channel
+ * \param[in] stride distance between two samples of the channel, the
+ * number of channels in an interleaved scan buffer
+ * \param[in] timestamp given to the outputs completed in this block
+ * \return true when a new value has been published
+ */
+bool PIOS_ADC_Filter_Process(struct pios_adc_filter *filter, const uint16_t *samples, uint16_t count, uint16_t stride, uint32_t timestamp)
+{
+    const uint16_t ratio = filter->cfg.ratio;
+    bool published = false;
+
+    if (ratio == 0) {
+        return false;
+    }
+
+    if (filter->cfg.decimation == PIOS_ADC_FILTER_BOXCAR) {
+        for (uint16_t i = 0; i < count; i++, samples += stride) {
+            filter->integrator[0] += *samples;
+            if (++filter->phase == ratio) {
+                published |= PIOS_ADC_Filter_Output(filter, filter->integrator[0], timestamp);
+                filter->integrator[0] = 0;
+                filter->phase = 0;
+            }
+        }
+        return published;
+    }
+
+    const uint8_t order = filter->cfg.order;
+    uint32_t *integrator = filter->integrator;
+
+    for (uint16_t i = 0; i < count; i++, samples += stride) {
+        uint32_t x = *samples;
+        for (uint8_t k = 0; k < order; k++) {
+            integrator[k] += x;
+            x = integrator[k];
+        }
+
+        if (++filter->phase == ratio) {
+            /* Combs at the output rate, differential delay of one output */
+            for (uint8_t k = 0; k < order; k++) {
+                uint32_t y = x - filter->comb[k];
+                filter->comb[k] = x;
+                x = y;
+            }
+            published |= PIOS_ADC_Filter_Output(filter, x, timestamp);
+            filter->phase = 0;
+        }
+    }
+
+    return published;
+}
+
+#endif /* PIOS_INCLUDE_ADC */
+
+/**
+ * @}
+ * @}
+ */
@@ -427,6 +427,105 @@ int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len
     return len;
 }
 
+/**
+ * Reserves room for a package in the transmit buffer of a port, so that the
+ * caller writes it in place instead of handing over a buffer to be copied.
+ * Nobody else can send on the port until PIOS_COM_CommitBuffer() is called.
+ * \param[in] port COM port
+ * \param[in] len room needed
+ * \param[out] span where to write the package
+ * \param[in] timeout_ms how long to wait for room (0 for non-blocking)
+ * \return -1 if port not available or the package does not fit in the
+ *            buffer at all, caller should use PIOS_COM_SendBuffer()
+ * \return -2 if there is no room (retry)
+ * \return -3 another thread is already sending, caller should
+ *            retry until com is available again
+ * \return 0 on success
+ */
+int32_t PIOS_COM_ReserveBuffer(uint32_t com_id, uint16_t len, struct pios_com_span *span, uint32_t timeout_ms)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+    PIOS_Assert(com_dev->has_tx);
+    PIOS_Assert(span);
+    PIOS_Assert(len);
+
+    if (len > fifoBuf_getSize(&com_dev->tx)) {
+        /* Has to go in fragments */
+        return -1;
+    }
+    if (com_dev->driver->available && !com_dev->driver->available(com_dev->lower_id)) {
+        /* Underlying device is down/unconnected, PIOS_COM_SendBuffer() drops the data */
+        return -1;
+    }
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (xSemaphoreTake(com_dev->sendbuffer_sem, timeout_ms ? 5 : 0) != pdTRUE) {
+        return -3;
+    }
+#endif /* PIOS_INCLUDE_FREERTOS */
+    while (fifoBuf_reserve(&com_dev->tx, len, &span->first, &span->first_len, &span->second) == 0) {
+        if (timeout_ms == 0) {
+#if defined(PIOS_INCLUDE_FREERTOS)
+            xSemaphoreGive(com_dev->sendbuffer_sem);
+#endif /* PIOS_INCLUDE_FREERTOS */
+            return -2;
+        }
+        /* Make sure the transmitter is running while we wait */
+        if (com_dev->driver->tx_start) {
+            (com_dev->driver->tx_start)(com_dev->lower_id,
+                                        fifoBuf_getUsed(&com_dev->tx));
+        }
+#if defined(PIOS_INCLUDE_FREERTOS)
+        if (xSemaphoreTake(com_dev->tx_sem, timeout_ms / portTICK_RATE_MS) != pdTRUE) {
+            xSemaphoreGive(com_dev->sendbuffer_sem);
+            return -2;
+        }
+#else
+        PIOS_DELAY_WaitmS(1);
+        timeout_ms--;
+#endif
+    }
+
+    return 0;
+}
+
+/**
+ * Sends what was written in the room from PIOS_COM_ReserveBuffer() and lets
+ * others send on the port again
+ * \param[in] port COM port
+ * \param[in] len bytes written, at most the room reserved (0 sends nothing)
+ * \return -1 if port not available
+ * \return number of bytes transmitted on success
+ */
+int32_t PIOS_COM_CommitBuffer(uint32_t com_id, uint16_t len)
+{
+    struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+    PIOS_Assert(com_dev->has_tx);
+
+    if (len > 0) {
+        fifoBuf_commit(&com_dev->tx, len);
+
+        /* More data has been put in the tx buffer, make sure the tx is started */
+        if (com_dev->driver->tx_start) {
+            com_dev->driver->tx_start(com_dev->lower_id,
+                                      fifoBuf_getUsed(&com_dev->tx));
+        }
+    }
+#if defined(PIOS_INCLUDE_FREERTOS)
+    xSemaphoreGive(com_dev->sendbuffer_sem);
+#endif /* PIOS_INCLUDE_FREERTOS */
+    return len;
+}
+
 /**
  * Sends a single character over given port
  * \param[in] port COM port
@@ -83,6 +83,12 @@ int32_t PIOS_FLASHFS_Logfs_Destroy(__attribute__((unused)) uintptr_t fs_id)
     return 0;
 }
 
+int32_t PIOS_FLASHFS_Logfs_Poll(__attribute__((unused)) uintptr_t fs_id)
+{
+    // stub, dosfs has nothing to do in the background
+    return 0;
+}
+
 /**********************************
  *
  * Provide a PIOS_FLASHFS_* driver
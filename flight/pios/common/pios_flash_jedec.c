@@ -54,10 +54,24 @@
 #define JEDEC_STATUS_SEC          0x40
 #define JEDEC_STATUS_SRP0         0x80
 
+/* Status polling intervals, doubled on every poll up to the maximum */
+#define JEDEC_POLL_PROGRAM_US     50
+#define JEDEC_POLL_ERASE_US       1000
+#define JEDEC_POLL_MAX_US         16000
+#define JEDEC_POLL_SUSPEND_US     5
+
 enum pios_jedec_dev_magic {
     PIOS_JEDEC_DEV_MAGIC = 0xcb55aa55,
 };
 
+// ! Operation the chip may still be executing
+enum jedec_flash_op {
+    JEDEC_OP_NONE,
+    JEDEC_OP_PROGRAM,
+    JEDEC_OP_ERASE_SECTOR,
+    JEDEC_OP_ERASE_CHIP,
+};
+
 // ! Device handle structure
 struct jedec_flash_dev {
     uint32_t spi_id;
@@ -69,6 +83,11 @@ struct jedec_flash_dev {
     uint8_t  capacity;
 
     const struct pios_flash_jedec_cfg *cfg;
+
+    /* Every command waits for (or suspends) the pending operation first */
+    volatile enum jedec_flash_op pending_op;
+    volatile bool suspended;
+    uint32_t erase_addr; /* Start of the sector a pending sector erase clears */
 #if defined(FLASH_FREERTOS)
     xSemaphoreHandle transaction_lock;
 #endif
@@ -88,6 +107,8 @@ static int32_t PIOS_Flash_Jedec_ClaimBus(struct jedec_flash_dev *flash_dev, bool
 static int32_t PIOS_Flash_Jedec_ReleaseBus(struct jedec_flash_dev *flash_dev);
 static int32_t PIOS_Flash_Jedec_WriteEnable(struct jedec_flash_dev *flash_dev);
 static int32_t PIOS_Flash_Jedec_Busy(struct jedec_flash_dev *flash_dev);
+static int32_t PIOS_Flash_Jedec_WaitReady(struct jedec_flash_dev *flash_dev);
+static int32_t PIOS_Flash_Jedec_Prepare(struct jedec_flash_dev *flash_dev, uint32_t addr, uint32_t len);
 
 /**
  * @brief Allocate a new device
@@ -101,8 +122,11 @@ static struct jedec_flash_dev *PIOS_Flash_Jedec_alloc(void)
         return NULL;
     }
 
-    flash_dev->claimed = false;
-    flash_dev->magic   = PIOS_JEDEC_DEV_MAGIC;
+    flash_dev->claimed    = false;
+    flash_dev->pending_op = JEDEC_OP_NONE;
+    flash_dev->suspended  = false;
+    flash_dev->erase_addr = 0;
+    flash_dev->magic = PIOS_JEDEC_DEV_MAGIC;
 #if defined(FLASH_FREERTOS)
     flash_dev->transaction_lock = xSemaphoreCreateMutex();
 #endif
@@ -270,6 +294,174 @@ static int32_t PIOS_Flash_Jedec_ReadID(struct jedec_flash_dev *flash_dev)
     return flash_dev->manufacturer;
 }
 
+/**
+ * @brief Sleep between two status polls, without holding the bus
+ */
+static void PIOS_Flash_Jedec_Sleep(uint32_t us)
+{
+#if defined(FLASH_FREERTOS)
+    if (us >= 1000 * portTICK_RATE_MS) {
+        vTaskDelay(us / (1000 * portTICK_RATE_MS));
+        return;
+    }
+#endif
+    PIOS_DELAY_WaituS(us);
+}
+
+/**
+ * @brief Check whether the pending erase or program has finished
+ * @returns -1 for failure, 0 when the chip is ready, 1 while an operation is pending
+ */
+static int32_t PIOS_Flash_Jedec_CheckReady(struct jedec_flash_dev *flash_dev)
+{
+    if (flash_dev->pending_op == JEDEC_OP_NONE) {
+        return 0;
+    }
+
+    /* A suspended erase makes no progress until it is resumed */
+    if (flash_dev->pending_op == JEDEC_OP_ERASE_SECTOR && flash_dev->suspended) {
+        return 1;
+    }
+
+    int32_t busy = PIOS_Flash_Jedec_Busy(flash_dev);
+    if (busy != 0) {
+        return busy;
+    }
+
+    /* A program issued while the erase was suspended leaves the erase behind */
+    flash_dev->pending_op = flash_dev->suspended ? JEDEC_OP_ERASE_SECTOR : JEDEC_OP_NONE;
+
+    return flash_dev->pending_op != JEDEC_OP_NONE;
+}
+
+/**
+ * @brief Poll with backoff for as long as the given operation is pending
+ * @returns 0 if successful, -1 on failure to read the status
+ */
+static int32_t PIOS_Flash_Jedec_WaitFor(struct jedec_flash_dev *flash_dev, enum jedec_flash_op op)
+{
+    uint32_t interval = (op == JEDEC_OP_PROGRAM) ? JEDEC_POLL_PROGRAM_US : JEDEC_POLL_ERASE_US;
+
+    while (op != JEDEC_OP_NONE && flash_dev->pending_op == op) {
+        int32_t rc = PIOS_Flash_Jedec_CheckReady(flash_dev);
+        if (rc < 0) {
+            return -1;
+        }
+        if (rc > 0 && flash_dev->pending_op == op) {
+            PIOS_Flash_Jedec_Sleep(interval);
+            interval = MIN(interval * 2, JEDEC_POLL_MAX_US);
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Resume a suspended sector erase
+ * @returns 0 if successful, -1 if unable to claim bus
+ */
+static int32_t PIOS_Flash_Jedec_Resume(struct jedec_flash_dev *flash_dev)
+{
+    if (!flash_dev->suspended) {
+        return 0;
+    }
+
+    /* A program issued during the suspend has to finish first */
+    if (PIOS_Flash_Jedec_WaitFor(flash_dev, JEDEC_OP_PROGRAM) != 0) {
+        return -1;
+    }
+
+    if (PIOS_Flash_Jedec_ClaimBus(flash_dev, true) != 0) {
+        return -1;
+    }
+
+    uint8_t out[] = { flash_dev->cfg->erase_resume };
+    PIOS_SPI_TransferBlock(flash_dev->spi_id, out, NULL, sizeof(out), NULL);
+    PIOS_Flash_Jedec_ReleaseBus(flash_dev);
+
+    flash_dev->suspended = false;
+
+    return 0;
+}
+
+/**
+ * @brief Suspend a running sector erase
+ * @returns 0 if successful, -1 if unable to claim bus
+ */
+static int32_t PIOS_Flash_Jedec_Suspend(struct jedec_flash_dev *flash_dev)
+{
+    int32_t rc = PIOS_Flash_Jedec_CheckReady(flash_dev);
+
+    if (rc <= 0 || flash_dev->suspended) {
+        /* Failed, or the erase has already completed on its own */
+        return rc;
+    }
+
+    if (PIOS_Flash_Jedec_ClaimBus(flash_dev, true) != 0) {
+        return -1;
+    }
+
+    uint8_t out[] = { flash_dev->cfg->erase_suspend };
+    PIOS_SPI_TransferBlock(flash_dev->spi_id, out, NULL, sizeof(out), NULL);
+    PIOS_Flash_Jedec_ReleaseBus(flash_dev);
+
+    flash_dev->suspended = true;
+
+    /* The chip reports ready once it has actually suspended, a few tens of us later */
+    while ((rc = PIOS_Flash_Jedec_Busy(flash_dev)) > 0) {
+        PIOS_DELAY_WaituS(JEDEC_POLL_SUSPEND_US);
+    }
+
+    return rc;
+}
+
+/**
+ * @brief Wait for any pending erase or program to finish, resuming a suspended erase
+ * @returns 0 if successful, -1 on failure to read the status
+ */
+static int32_t PIOS_Flash_Jedec_WaitReady(struct jedec_flash_dev *flash_dev)
+{
+    if (PIOS_Flash_Jedec_Resume(flash_dev) != 0) {
+        return -1;
+    }
+
+    return PIOS_Flash_Jedec_WaitFor(flash_dev, flash_dev->pending_op);
+}
+
+/**
+ * @brief Get the chip ready for a read or page program
+ * @param[in] addr Start of the range the command accesses
+ * @param[in] len Length of that range
+ * A running sector erase is suspended instead of waited for, if the chip supports
+ * it and the range lies outside of the sector being erased
+ * @returns 0 if successful, -1 on failure to read the status
+ */
+static int32_t PIOS_Flash_Jedec_Prepare(struct jedec_flash_dev *flash_dev, uint32_t addr, uint32_t len)
+{
+    if (!flash_dev->cfg->erase_suspend) {
+        return PIOS_Flash_Jedec_WaitReady(flash_dev);
+    }
+
+    if (PIOS_Flash_Jedec_WaitFor(flash_dev, JEDEC_OP_PROGRAM) != 0) {
+        return -1;
+    }
+
+    switch (flash_dev->pending_op) {
+    case JEDEC_OP_ERASE_SECTOR:
+        /* The sector being erased can't be accessed until the erase is done */
+        if (addr < flash_dev->erase_addr + flash_dev->cfg->sector_size && addr + len > flash_dev->erase_addr) {
+            return PIOS_Flash_Jedec_WaitReady(flash_dev);
+        }
+        return (PIOS_Flash_Jedec_Suspend(flash_dev) < 0) ? -1 : 0;
+
+    case JEDEC_OP_ERASE_CHIP:
+        return PIOS_Flash_Jedec_WaitReady(flash_dev);
+
+    default:
+        return 0;
+    }
+}
+
 /**********************************
  *
  * Provide a PIOS flash driver API
@@ -312,6 +504,9 @@ static int32_t PIOS_Flash_Jedec_EndTransaction(uintptr_t flash_id)
         return -1;
     }
 
+    /* Let a sector erase suspended during the transaction continue */
+    PIOS_Flash_Jedec_Resume(flash_dev);
+
 #if defined(PIOS_INCLUDE_FREERTOS)
     if (xSemaphoreGive(flash_dev->transaction_lock) != pdTRUE) {
         return -2;
@@ -328,21 +523,30 @@ static int32_t PIOS_Flash_Jedec_StartTransaction(__attribute__((unused)) uintptr
     return 0;
 }
 
-static int32_t PIOS_Flash_Jedec_EndTransaction(__attribute__((unused)) uintptr_t flash_id)
+static int32_t PIOS_Flash_Jedec_EndTransaction(uintptr_t flash_id)
 {
+    struct jedec_flash_dev *flash_dev = (struct jedec_flash_dev *)flash_id;
+
+    if (PIOS_Flash_Jedec_Validate(flash_dev) != 0) {
+        return -1;
+    }
+
+    /* Let a sector erase suspended during the transaction continue */
+    PIOS_Flash_Jedec_Resume(flash_dev);
+
     return 0;
 }
 
 #endif /* FLASH_USE_FREERTOS_LOCKS */
 
 /**
- * @brief Erase a sector on the flash chip
+ * @brief Start erasing a sector on the flash chip, without waiting for it to finish
  * @param[in] add Address of flash to erase
  * @returns 0 if successful
  * @retval -1 if unable to claim bus
- * @retval
+ * @retval -2 if the command could not be sent
  */
-static int32_t PIOS_Flash_Jedec_EraseSector(uintptr_t flash_id, uint32_t addr)
+static int32_t PIOS_Flash_Jedec_EraseSectorStart(uintptr_t flash_id, uint32_t addr)
 {
     struct jedec_flash_dev *flash_dev = (struct jedec_flash_dev *)flash_id;
 
@@ -353,6 +557,10 @@ static int32_t PIOS_Flash_Jedec_EraseSector(uintptr_t flash_id, uint32_t addr)
     uint8_t ret;
     uint8_t out[] = { flash_dev->cfg->sector_erase, (addr >> 16) & 0xff, (addr >> 8) & 0xff, addr & 0xff };
 
+    if (PIOS_Flash_Jedec_WaitReady(flash_dev) != 0) {
+        return -1;
+    }
+
     if ((ret = PIOS_Flash_Jedec_WriteEnable(flash_dev)) != 0) {
         return ret;
     }
@@ -368,16 +576,65 @@ static int32_t PIOS_Flash_Jedec_EraseSector(uintptr_t flash_id, uint32_t addr)
 
     PIOS_Flash_Jedec_ReleaseBus(flash_dev);
 
-    // Keep polling when bus is busy too
-    while (PIOS_Flash_Jedec_Busy(flash_dev) != 0) {
-#if defined(FLASH_FREERTOS)
-        vTaskDelay(2);
-#endif
+    flash_dev->pending_op = JEDEC_OP_ERASE_SECTOR;
+    flash_dev->erase_addr = addr & ~(flash_dev->cfg->sector_size - 1);
+
+    return 0;
+}
+
+/**
+ * @brief Erase a sector on the flash chip
+ * @param[in] add Address of flash to erase
+ * @returns 0 if successful
+ * @retval -1 if unable to claim bus
+ * @retval -2 if the command could not be sent
+ * @retval -3 if the erase could not be waited for
+ */
+static int32_t PIOS_Flash_Jedec_EraseSector(uintptr_t flash_id, uint32_t addr)
+{
+    struct jedec_flash_dev *flash_dev = (struct jedec_flash_dev *)flash_id;
+    int32_t ret;
+
+    if ((ret = PIOS_Flash_Jedec_EraseSectorStart(flash_id, addr)) != 0) {
+        return ret;
+    }
+
+    /* The bus is free for others between the status polls */
+    if (PIOS_Flash_Jedec_WaitReady(flash_dev) != 0) {
+        return -3;
     }
 
     return 0;
 }
 
+/**
+ * @brief Poll the erase started by PIOS_Flash_Jedec_EraseSectorStart.
+ * An erase suspended by a read in the meantime is resumed.
+ * @param[in] wait Wait for the erase to finish, releasing the bus between polls
+ * @returns 0 when the chip is ready, 1 while it is busy, -1 for failure
+ */
+static int32_t PIOS_Flash_Jedec_Poll(uintptr_t flash_id, bool wait)
+{
+    struct jedec_flash_dev *flash_dev = (struct jedec_flash_dev *)flash_id;
+
+    if (PIOS_Flash_Jedec_Validate(flash_dev) != 0) {
+        return -1;
+    }
+
+    if (wait) {
+        return PIOS_Flash_Jedec_WaitReady(flash_dev);
+    }
+
+    int32_t rc = PIOS_Flash_Jedec_CheckReady(flash_dev);
+    if (rc > 0 && flash_dev->suspended && flash_dev->pending_op == JEDEC_OP_ERASE_SECTOR) {
+        if (PIOS_Flash_Jedec_Resume(flash_dev) != 0) {
+            return -1;
+        }
+    }
+
+    return rc;
+}
+
 /**
  * @brief Execute the whole chip
  * @returns 0 if successful, -1 if unable to claim bus
@@ -393,6 +650,10 @@ static int32_t PIOS_Flash_Jedec_EraseChip(uintptr_t flash_id)
     uint8_t ret;
     uint8_t out[] = { flash_dev->cfg->chip_erase };
 
+    if (PIOS_Flash_Jedec_WaitReady(flash_dev) != 0) {
+        return -1;
+    }
+
     if ((ret = PIOS_Flash_Jedec_WriteEnable(flash_dev)) != 0) {
         return ret;
     }
@@ -408,9 +669,11 @@ static int32_t PIOS_Flash_Jedec_EraseChip(uintptr_t flash_id)
 
     PIOS_Flash_Jedec_ReleaseBus(flash_dev);
 
+    flash_dev->pending_op = JEDEC_OP_ERASE_CHIP;
+
     // Keep polling when bus is busy too
     int i = 0;
-    while (PIOS_Flash_Jedec_Busy(flash_dev) != 0) {
+    while (PIOS_Flash_Jedec_CheckReady(flash_dev) != 0) {
 #if defined(FLASH_FREERTOS)
         vTaskDelay(1);
         if ((i++) % 100 == 0) {
@@ -458,6 +721,9 @@ static int32_t PIOS_Flash_Jedec_WriteData(uintptr_t flash_id, uint32_t addr, uin
     if (((addr & 0xff) + len) > 0x100) {
         return -3;
     }
+    if (PIOS_Flash_Jedec_Prepare(flash_dev, addr, len) != 0) {
+        return -1;
+    }
     if ((ret = PIOS_Flash_Jedec_WriteEnable(flash_dev)) != 0) {
         return ret;
     }
@@ -479,26 +745,9 @@ static int32_t PIOS_Flash_Jedec_WriteData(uintptr_t flash_id, uint32_t addr, uin
 
     PIOS_Flash_Jedec_ReleaseBus(flash_dev);
 
-    // Keep polling when bus is busy too
-#if defined(FLASH_FREERTOS)
-    while (PIOS_Flash_Jedec_Busy(flash_dev) != 0) {
-        vTaskDelay(1);
-    }
-#else
+    // Don't wait for the program to finish, the next command will
+    flash_dev->pending_op = JEDEC_OP_PROGRAM;
 
-    // Query status this way to prevent accel chip locking us out
-    if (PIOS_Flash_Jedec_ClaimBus(flash_dev, true) < 0) {
-        return -1;
-    }
-
-    PIOS_SPI_TransferByte(flash_dev->spi_id, JEDEC_READ_STATUS);
-    while (PIOS_SPI_TransferByte(flash_dev->spi_id, JEDEC_READ_STATUS) & JEDEC_STATUS_BUSY) {
-        ;
-    }
-
-    PIOS_Flash_Jedec_ReleaseBus(flash_dev);
-
-#endif
     return 0;
 }
 
@@ -537,6 +786,9 @@ static int32_t PIOS_Flash_Jedec_WriteChunks(uintptr_t flash_id, uint32_t addr, s
     if (((addr & 0xff) + len) > 0x100) {
         return -3;
     }
+    if (PIOS_Flash_Jedec_Prepare(flash_dev, addr, len) != 0) {
+        return -1;
+    }
     if ((ret = PIOS_Flash_Jedec_WriteEnable(flash_dev)) != 0) {
         return ret;
     }
@@ -563,6 +815,7 @@ static int32_t PIOS_Flash_Jedec_WriteChunks(uintptr_t flash_id, uint32_t addr, s
     PIOS_Flash_Jedec_ReleaseBus(flash_dev);
 
     // Skip checking for busy with this to get OS running again fast
+    flash_dev->pending_op = JEDEC_OP_PROGRAM;
 
     return 0;
 }
@@ -582,6 +835,9 @@ static int32_t PIOS_Flash_Jedec_ReadData(uintptr_t flash_id, uint32_t addr, uint
     if (PIOS_Flash_Jedec_Validate(flash_dev) != 0) {
         return -1;
     }
+    if (PIOS_Flash_Jedec_Prepare(flash_dev, addr, len) != 0) {
+        return -1;
+    }
     bool fast_read = flash_dev->cfg->fast_read != 0;
     if (PIOS_Flash_Jedec_ClaimBus(flash_dev, fast_read) == -1) {
         return -1;
@@ -627,6 +883,8 @@ const struct pios_flash_driver pios_jedec_flash_driver = {
     .write_chunks = PIOS_Flash_Jedec_WriteChunks,
     .write_data   = PIOS_Flash_Jedec_WriteData,
     .read_data    = PIOS_Flash_Jedec_ReadData,
+    .erase_sector_start = PIOS_Flash_Jedec_EraseSectorStart,
+    .poll = PIOS_Flash_Jedec_Poll,
 };
 
 #endif /* PIOS_INCLUDE_FLASH */
@@ -59,6 +59,12 @@ struct logfs_state {
     /* Underlying flash driver glue */
     const struct pios_flash_driver *driver;
     uintptr_t flash_id;
+
+    /* Background erase of the arena the next garbage collection will fill */
+    bool     erase_pending; /* arena still has to be (fully) erased */
+    bool     erase_running; /* erase of erase_sector_id has been started */
+    uint8_t  erase_arena_id;
+    uint16_t erase_sector_id;
 };
 
 /*
@@ -146,6 +152,150 @@ static int32_t logfs_erase_arena(const struct logfs_state *logfs, uint8_t arena_
     return 0;
 }
 
+/**
+ * @brief Queue the arena the next garbage collection will fill to be erased by PIOS_FLASHFS_Logfs_Poll()
+ * @note Only does something if the flash driver can erase without blocking
+ * @note Must be called while holding the flash transaction lock
+ */
+static void logfs_erase_arena_background(struct logfs_state *logfs)
+{
+    if (!logfs->driver->erase_sector_start || !logfs->driver->poll) {
+        return;
+    }
+
+    uint8_t arena_id     = (logfs->active_arena_id + 1) % (logfs->cfg->total_fs_size / logfs->cfg->arena_size);
+    uintptr_t arena_addr = logfs_get_addr(logfs, arena_id, 0);
+
+    /* Nothing to do if the arena has been left erased */
+    struct arena_header arena_hdr;
+    if (logfs->driver->read_data(logfs->flash_id,
+                                 arena_addr,
+                                 (uint8_t *)&arena_hdr,
+                                 sizeof(arena_hdr)) == 0 &&
+        arena_hdr.magic == logfs->cfg->fs_magic &&
+        arena_hdr.state == ARENA_STATE_ERASED) {
+        return;
+    }
+
+    logfs->erase_pending   = true;
+    logfs->erase_running   = false;
+    logfs->erase_arena_id  = arena_id;
+    logfs->erase_sector_id = 0;
+}
+
+/**
+ * @brief Advance the background erase by at most one sector
+ * @param[in] wait Wait for the sector currently being erased instead of just checking it
+ * @return 0 when there is nothing left to erase, 1 while erasing, < 0 on failure
+ * @note A failed background erase is abandoned, the garbage collection erases the arena itself
+ * @note Must be called while holding the flash transaction lock
+ */
+static int32_t logfs_erase_arena_step(struct logfs_state *logfs, bool wait)
+{
+    int32_t rc;
+
+    if (!logfs->erase_pending) {
+        return 0;
+    }
+
+    if (logfs->erase_running) {
+        rc = logfs->driver->poll(logfs->flash_id, wait);
+        if (rc > 0) {
+            return 1;
+        }
+        logfs->erase_running = false;
+        if (rc < 0) {
+            rc = -1;
+            goto out_abandon;
+        }
+        logfs->erase_sector_id++;
+    }
+
+    uintptr_t arena_addr = logfs_get_addr(logfs, logfs->erase_arena_id, 0);
+
+    if (logfs->erase_sector_id < (logfs->cfg->arena_size / logfs->cfg->sector_size)) {
+        if (logfs->driver->erase_sector_start(logfs->flash_id,
+                                              arena_addr + (logfs->erase_sector_id * logfs->cfg->sector_size)) != 0) {
+            rc = -2;
+            goto out_abandon;
+        }
+        logfs->erase_running = true;
+        return 1;
+    }
+
+    /* Mark this arena as fully erased */
+    struct arena_header arena_hdr = {
+        .magic = logfs->cfg->fs_magic,
+        .state = ARENA_STATE_ERASED,
+    };
+
+    logfs->erase_pending = false;
+    if (logfs->driver->write_data(logfs->flash_id,
+                                  arena_addr,
+                                  (uint8_t *)&arena_hdr,
+                                  sizeof(arena_hdr)) != 0) {
+        return -3;
+    }
+
+    /* Arena is ready to be reserved */
+    return 0;
+
+out_abandon:
+    logfs->erase_pending = false;
+    return rc;
+}
+
+/**
+ * @brief Wait for a running background erase and drop the rest of it
+ * @note Must be called while holding the flash transaction lock
+ */
+static void logfs_erase_arena_cancel(struct logfs_state *logfs)
+{
+    if (logfs->erase_running) {
+        logfs->driver->poll(logfs->flash_id, true);
+    }
+    logfs->erase_running = false;
+    logfs->erase_pending = false;
+}
+
+/**
+ * @brief Makes sure the given arena is erased, finishing a background erase of it if there is one
+ * @return 0 if success, < 0 on failure
+ * @note Must be called while holding the flash transaction lock
+ */
+static int32_t logfs_erase_arena_finish(struct logfs_state *logfs, uint8_t arena_id)
+{
+    int32_t rc;
+
+    if (logfs->erase_pending && logfs->erase_arena_id == arena_id) {
+        while ((rc = logfs_erase_arena_step(logfs, true)) > 0) {
+#ifdef PIOS_INCLUDE_WDG
+            PIOS_WDG_Clear();
+#endif
+        }
+        if (rc == 0) {
+            return 0;
+        }
+    }
+    logfs_erase_arena_cancel(logfs);
+
+    /* A previous background erase may have completed already */
+    uintptr_t arena_addr = logfs_get_addr(logfs, arena_id, 0);
+    struct arena_header arena_hdr;
+    if (logfs->driver->read_data(logfs->flash_id,
+                                 arena_addr,
+                                 (uint8_t *)&arena_hdr,
+                                 sizeof(arena_hdr)) != 0) {
+        return -1;
+    }
+    if (arena_hdr.magic == logfs->cfg->fs_magic &&
+        arena_hdr.state == ARENA_STATE_ERASED) {
+        return 0;
+    }
+
+    return logfs_erase_arena(logfs, arena_id);
+}
+
 /**
  * @brief Marks the given arena as reserved so it can be filled.
  * @return 0 if success, < 0 on failure
@@ -559,6 +709,8 @@ int32_t PIOS_FLASHFS_Logfs_Init(uintptr_t *fs_id, const struct flashfs_logfs_cfg
     logfs->driver   = driver; /* lower-level flash driver */
     logfs->flash_id = flash_id; /* lower-level flash device id */
     logfs->mounted  = false;
+    logfs->erase_pending = false;
+    logfs->erase_running = false;
 
     if (logfs->driver->start_transaction(logfs->flash_id) != 0) {
         rc = -1;
@@ -598,6 +750,9 @@ int32_t PIOS_FLASHFS_Logfs_Init(uintptr_t *fs_id, const struct flashfs_logfs_cfg
         goto out_end_trans;
     }
 
+    /* Get the arena for the next garbage collection ready in the background */
+    logfs_erase_arena_background(logfs);
+
     /* Log has been mounted */
     rc     = 0;
 
@@ -639,8 +794,8 @@ static int32_t logfs_garbage_collect(struct logfs_state *logfs)
     /* Compute destination arena */
     uint8_t dst_arena_id = (logfs->active_arena_id + 1) % (logfs->cfg->total_fs_size / logfs->cfg->arena_size);
 
-    /* Erase destination arena */
-    if (logfs_erase_arena(logfs, dst_arena_id) != 0) {
+    /* Erase destination arena, unless that has been done in the background */
+    if (logfs_erase_arena_finish(logfs, dst_arena_id) != 0) {
         return -1;
     }
 
@@ -700,6 +855,9 @@ static int32_t logfs_garbage_collect(struct logfs_state *logfs)
         return -8;
     }
 
+    /* Don't wait for the erase of the next destination arena, it is done in the background */
+    logfs_erase_arena_background(logfs);
+
     return 0;
 }
 
@@ -1132,6 +1290,8 @@ int32_t PIOS_FLASHFS_Format(uintptr_t fs_id)
         goto out_exit;
     }
 
+    logfs_erase_arena_cancel(logfs);
+
     if (logfs_erase_all_arenas(logfs) != 0) {
         rc = -3;
         goto out_end_trans;
@@ -1176,6 +1336,48 @@ int32_t PIOS_FLASHFS_GetStats(uintptr_t fs_id, struct PIOS_FLASHFS_Stats *stats)
     stats->num_free_slots   = logfs->num_free_slots;
     return 0;
 }
+
+/**
+ * @brief Make progress on the background erase of the next arena.
+ * Meant to be called periodically from a low priority task, the flash bus
+ * is only used for a few status polls while a sector is being erased.
+ * @param[in] fs_id The filesystem to use for this action
+ * @return 0 if there is nothing left to erase, 1 while erasing, or error code
+ * @retval -1 if fs_id is not a valid filesystem instance
+ * @retval -2 if failed to start transaction
+ * @retval -3 if the erase failed, the next garbage collection will redo it
+ */
+int32_t PIOS_FLASHFS_Logfs_Poll(uintptr_t fs_id)
+{
+    int32_t rc;
+
+    struct logfs_state *logfs = (struct logfs_state *)fs_id;
+
+    if (!PIOS_FLASHFS_Logfs_validate(logfs)) {
+        rc = -1;
+        goto out_exit;
+    }
+
+    if (!logfs->erase_pending) {
+        rc = 0;
+        goto out_exit;
+    }
+
+    if (logfs->driver->start_transaction(logfs->flash_id) != 0) {
+        rc = -2;
+        goto out_exit;
+    }
+
+    rc = logfs_erase_arena_step(logfs, false);
+    if (rc < 0) {
+        rc = -3;
+    }
+
+    logfs->driver->end_transaction(logfs->flash_id);
+
+out_exit:
+    return rc;
+}
 #endif /* PIOS_INCLUDE_FLASH */
 
 /**
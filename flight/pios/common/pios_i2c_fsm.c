@@ -0,0 +1,1028 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_I2C I2C Functions
+ * @brief Hardware independent I2C master state machine and request queue
+ * @{
+ *
+ * @file       pios_i2c_fsm.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      I2C master state machine driven by the adapter interrupts.
+ * @see        The GNU Public License (GPL) Version 3
+ * @notes
+ *
+ * The low level driver translates its interrupts into the PIOS_I2C_FSM_*
+ * hardware events and provides the bus primitives through struct
+ * pios_i2c_fsm_driver. Requests are queued and chained from the interrupt
+ * that completes the previous one, the bus never has to be waited on.
+ *
+ * Multi-byte data phases are handed over to DMA when the driver enables it,
+ * otherwise every byte is moved by an interrupt.
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <pios.h>
+
+#ifdef PIOS_INCLUDE_I2C
+
+#include <pios_i2c_fsm.h>
+
+// #define I2C_HALT_ON_ERRORS
+
+static void go_fsm_fault(struct pios_i2c_fsm *fsm);
+static void go_bus_error(struct pios_i2c_fsm *fsm);
+static void go_stopping(struct pios_i2c_fsm *fsm);
+static void go_stopped(struct pios_i2c_fsm *fsm);
+static void go_starting(struct pios_i2c_fsm *fsm);
+
+static void go_r_any_txn_addr(struct pios_i2c_fsm *fsm);
+static void go_r_more_txn_pre_one(struct pios_i2c_fsm *fsm);
+static void go_r_last_txn_pre_one(struct pios_i2c_fsm *fsm);
+static void go_r_any_txn_pre_first(struct pios_i2c_fsm *fsm);
+static void go_r_any_txn_pre_middle(struct pios_i2c_fsm *fsm);
+static void go_r_last_txn_pre_last(struct pios_i2c_fsm *fsm);
+static void go_r_more_txn_pre_last(struct pios_i2c_fsm *fsm);
+static void go_r_any_txn_post_last(struct pios_i2c_fsm *fsm);
+static void go_r_any_txn_dma(struct pios_i2c_fsm *fsm);
+static void go_r_more_txn_dma_done(struct pios_i2c_fsm *fsm);
+static void go_r_last_txn_dma_done(struct pios_i2c_fsm *fsm);
+
+static void go_w_any_txn_addr(struct pios_i2c_fsm *fsm);
+static void go_w_any_txn_middle(struct pios_i2c_fsm *fsm);
+static void go_w_more_txn_last(struct pios_i2c_fsm *fsm);
+static void go_w_last_txn_last(struct pios_i2c_fsm *fsm);
+static void go_w_any_txn_dma(struct pios_i2c_fsm *fsm);
+static void go_w_more_txn_dma_done(struct pios_i2c_fsm *fsm);
+static void go_w_last_txn_dma_done(struct pios_i2c_fsm *fsm);
+
+static void go_nack(struct pios_i2c_fsm *fsm);
+
+struct i2c_fsm_transition {
+    void (*entry_fn)(struct pios_i2c_fsm *fsm);
+    enum pios_i2c_fsm_state next_state[I2C_EVENT_NUM_EVENTS];
+};
+
+static void i2c_fsm_process_auto(struct pios_i2c_fsm *fsm);
+static void i2c_fsm_inject_event(struct pios_i2c_fsm *fsm, enum pios_i2c_fsm_event event, bool *woken);
+static void i2c_fsm_start(struct pios_i2c_fsm *fsm, struct pios_i2c_request *req, bool *woken);
+static void i2c_fsm_finish(struct pios_i2c_fsm *fsm, int32_t result, bool *woken);
+
+static const struct i2c_fsm_transition i2c_fsm_transitions[I2C_STATE_NUM_STATES] = {
+    [I2C_STATE_FSM_FAULT] =             {
+        .entry_fn   = go_fsm_fault,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
+        },
+    },
+    [I2C_STATE_BUS_ERROR] =             {
+        .entry_fn   = go_bus_error,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
+        },
+    },
+
+    [I2C_STATE_STOPPED] =               {
+        .entry_fn   = go_stopped,
+        .next_state =                   {
+            [I2C_EVENT_START]     = I2C_STATE_STARTING,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_STOPPING] =              {
+        .entry_fn   = go_stopping,
+        .next_state =                   {
+            [I2C_EVENT_STOPPED]   = I2C_STATE_STOPPED,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_STARTING] =              {
+        .entry_fn   = go_starting,
+        .next_state =                   {
+            [I2C_EVENT_STARTED_MORE_TXN_READ]  = I2C_STATE_R_MORE_TXN_ADDR,
+            [I2C_EVENT_STARTED_MORE_TXN_WRITE] = I2C_STATE_W_MORE_TXN_ADDR,
+            [I2C_EVENT_STARTED_LAST_TXN_READ]  = I2C_STATE_R_LAST_TXN_ADDR,
+            [I2C_EVENT_STARTED_LAST_TXN_WRITE] = I2C_STATE_W_LAST_TXN_ADDR,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    /*
+     * Read with restart
+     */
+
+    [I2C_STATE_R_MORE_TXN_ADDR] =       {
+        .entry_fn   = go_r_any_txn_addr,
+        .next_state =                   {
+            [I2C_EVENT_ADDR_SENT_LEN_EQ_1] = I2C_STATE_R_MORE_TXN_PRE_ONE,
+            [I2C_EVENT_ADDR_SENT_LEN_EQ_2] = I2C_STATE_R_MORE_TXN_PRE_FIRST,
+            [I2C_EVENT_ADDR_SENT_LEN_GT_2] = I2C_STATE_R_MORE_TXN_PRE_FIRST,
+            [I2C_EVENT_ADDR_SENT_DMA] = I2C_STATE_R_MORE_TXN_DMA,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_MORE_TXN_PRE_ONE] =    {
+        .entry_fn   = go_r_more_txn_pre_one,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_R_MORE_TXN_POST_LAST,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_MORE_TXN_PRE_FIRST] =  {
+        .entry_fn   = go_r_any_txn_pre_first,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_R_MORE_TXN_PRE_LAST,
+            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_R_MORE_TXN_PRE_MIDDLE,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_MORE_TXN_PRE_MIDDLE] = {
+        .entry_fn   = go_r_any_txn_pre_middle,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_R_MORE_TXN_PRE_LAST,
+            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_R_MORE_TXN_PRE_MIDDLE,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_MORE_TXN_PRE_LAST] =   {
+        .entry_fn   = go_r_more_txn_pre_last,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_R_MORE_TXN_POST_LAST,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_MORE_TXN_POST_LAST] =  {
+        .entry_fn   = go_r_any_txn_post_last,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STARTING,
+        },
+    },
+
+    [I2C_STATE_R_MORE_TXN_DMA] =        {
+        .entry_fn   = go_r_any_txn_dma,
+        .next_state =                   {
+            [I2C_EVENT_DMA_DONE]  = I2C_STATE_R_MORE_TXN_DMA_DONE,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_MORE_TXN_DMA_DONE] =   {
+        .entry_fn   = go_r_more_txn_dma_done,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STARTING,
+        },
+    },
+
+    /*
+     * Read
+     */
+
+    [I2C_STATE_R_LAST_TXN_ADDR] =       {
+        .entry_fn   = go_r_any_txn_addr,
+        .next_state =                   {
+            [I2C_EVENT_ADDR_SENT_LEN_EQ_1] = I2C_STATE_R_LAST_TXN_PRE_ONE,
+            [I2C_EVENT_ADDR_SENT_LEN_EQ_2] = I2C_STATE_R_LAST_TXN_PRE_FIRST,
+            [I2C_EVENT_ADDR_SENT_LEN_GT_2] = I2C_STATE_R_LAST_TXN_PRE_FIRST,
+            [I2C_EVENT_ADDR_SENT_DMA] = I2C_STATE_R_LAST_TXN_DMA,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_LAST_TXN_PRE_ONE] =    {
+        .entry_fn   = go_r_last_txn_pre_one,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_R_LAST_TXN_POST_LAST,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_LAST_TXN_PRE_FIRST] =  {
+        .entry_fn   = go_r_any_txn_pre_first,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_R_LAST_TXN_PRE_LAST,
+            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_R_LAST_TXN_PRE_MIDDLE,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_LAST_TXN_PRE_MIDDLE] = {
+        .entry_fn   = go_r_any_txn_pre_middle,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_R_LAST_TXN_PRE_LAST,
+            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_R_LAST_TXN_PRE_MIDDLE,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_LAST_TXN_PRE_LAST] =   {
+        .entry_fn   = go_r_last_txn_pre_last,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_R_LAST_TXN_POST_LAST,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_LAST_TXN_POST_LAST] =  {
+        .entry_fn   = go_r_any_txn_post_last,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
+        },
+    },
+
+    [I2C_STATE_R_LAST_TXN_DMA] =        {
+        .entry_fn   = go_r_any_txn_dma,
+        .next_state =                   {
+            [I2C_EVENT_DMA_DONE]  = I2C_STATE_R_LAST_TXN_DMA_DONE,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_R_LAST_TXN_DMA_DONE] =   {
+        .entry_fn   = go_r_last_txn_dma_done,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
+        },
+    },
+
+    /*
+     * Write with restart
+     */
+
+    [I2C_STATE_W_MORE_TXN_ADDR] =       {
+        .entry_fn   = go_w_any_txn_addr,
+        .next_state =                   {
+            [I2C_EVENT_ADDR_SENT_LEN_EQ_1] = I2C_STATE_W_MORE_TXN_LAST,
+            [I2C_EVENT_ADDR_SENT_LEN_EQ_2] = I2C_STATE_W_MORE_TXN_MIDDLE,
+            [I2C_EVENT_ADDR_SENT_LEN_GT_2] = I2C_STATE_W_MORE_TXN_MIDDLE,
+            [I2C_EVENT_ADDR_SENT_DMA] = I2C_STATE_W_MORE_TXN_DMA,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_W_MORE_TXN_MIDDLE] =     {
+        .entry_fn   = go_w_any_txn_middle,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_W_MORE_TXN_LAST,
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_W_MORE_TXN_MIDDLE,
+            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_W_MORE_TXN_MIDDLE,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_W_MORE_TXN_LAST] =       {
+        .entry_fn   = go_w_more_txn_last,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_0] = I2C_STATE_STARTING,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_W_MORE_TXN_DMA] =        {
+        .entry_fn   = go_w_any_txn_dma,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_0] = I2C_STATE_W_MORE_TXN_DMA_DONE,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_W_MORE_TXN_DMA_DONE] =   {
+        .entry_fn   = go_w_more_txn_dma_done,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STARTING,
+        },
+    },
+
+    /*
+     * Write
+     */
+
+    [I2C_STATE_W_LAST_TXN_ADDR] =       {
+        .entry_fn   = go_w_any_txn_addr,
+        .next_state =                   {
+            [I2C_EVENT_ADDR_SENT_LEN_EQ_1] = I2C_STATE_W_LAST_TXN_LAST,
+            [I2C_EVENT_ADDR_SENT_LEN_EQ_2] = I2C_STATE_W_LAST_TXN_MIDDLE,
+            [I2C_EVENT_ADDR_SENT_LEN_GT_2] = I2C_STATE_W_LAST_TXN_MIDDLE,
+            [I2C_EVENT_ADDR_SENT_DMA] = I2C_STATE_W_LAST_TXN_DMA,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_W_LAST_TXN_MIDDLE] =     {
+        .entry_fn   = go_w_any_txn_middle,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_W_LAST_TXN_LAST,
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_W_LAST_TXN_MIDDLE,
+            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_W_LAST_TXN_MIDDLE,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_W_LAST_TXN_LAST] =       {
+        .entry_fn   = go_w_last_txn_last,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_0] = I2C_STATE_STOPPING,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_W_LAST_TXN_DMA] =        {
+        .entry_fn   = go_w_any_txn_dma,
+        .next_state =                   {
+            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_0] = I2C_STATE_W_LAST_TXN_DMA_DONE,
+            [I2C_EVENT_NACK] = I2C_STATE_NACK,
+            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
+        },
+    },
+
+    [I2C_STATE_W_LAST_TXN_DMA_DONE] =   {
+        .entry_fn   = go_w_last_txn_dma_done,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
+        },
+    },
+
+    [I2C_STATE_NACK] =                  {
+        .entry_fn   = go_nack,
+        .next_state =                   {
+            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
+        },
+    },
+};
+
+static void i2c_fsm_dma_stop(struct pios_i2c_fsm *fsm)
+{
+    if (fsm->dma) {
+        fsm->driver->dma_stop(fsm->i2c_id);
+    }
+}
+
+static void go_fsm_fault(struct pios_i2c_fsm *fsm)
+{
+#if defined(I2C_HALT_ON_ERRORS)
+    PIOS_DEBUG_Assert(0);
+#endif
+    /* Note that this transfer has hit a bus error */
+    fsm->bus_error = true;
+
+    i2c_fsm_dma_stop(fsm);
+    fsm->driver->reset_bus(fsm->i2c_id);
+}
+
+static void go_bus_error(struct pios_i2c_fsm *fsm)
+{
+    /* Note that this transfer has hit a bus error */
+    fsm->bus_error = true;
+
+    i2c_fsm_dma_stop(fsm);
+    fsm->driver->reset_bus(fsm->i2c_id);
+}
+
+static void go_stopping(struct pios_i2c_fsm *fsm)
+{
+    fsm->driver->irq_config(fsm->i2c_id, 0);
+    i2c_fsm_dma_stop(fsm);
+}
+
+static void go_stopped(struct pios_i2c_fsm *fsm)
+{
+    fsm->driver->irq_config(fsm->i2c_id, 0);
+    fsm->driver->ack(fsm->i2c_id, true);
+}
+
+static void go_starting(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn >= fsm->first_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+
+    // check for an empty read/write
+    if (fsm->active_txn->buf != NULL && fsm->active_txn->len != 0) {
+        // Data available
+        fsm->active_byte = &(fsm->active_txn->buf[0]);
+        fsm->last_byte   = &(fsm->active_txn->buf[fsm->active_txn->len - 1]);
+    } else {
+        // No Data available => Empty read/write
+        fsm->last_byte   = NULL;
+        fsm->active_byte = fsm->last_byte + 1;
+    }
+
+    fsm->driver->start(fsm->i2c_id);
+    if (fsm->active_txn->rw == PIOS_I2C_TXN_READ) {
+        fsm->driver->irq_config(fsm->i2c_id, PIOS_I2C_FSM_IRQ_ALL);
+    } else {
+        // For write operations, do not enable the IT_BUF events.
+        // The current driver does not act when the TX data register is not full, only when the complete byte is sent.
+        // With the IT_BUF enabled, we constantly get IRQs, See OP-326
+        fsm->driver->irq_config(fsm->i2c_id, PIOS_I2C_FSM_IRQ_EVT | PIOS_I2C_FSM_IRQ_ERR);
+    }
+}
+
+/* Common to 'more' and 'last' transaction */
+static void go_r_any_txn_addr(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn >= fsm->first_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+
+    PIOS_DEBUG_Assert(fsm->active_txn->rw == PIOS_I2C_TXN_READ);
+
+    fsm->driver->send_address(fsm->i2c_id, fsm->active_txn->addr, PIOS_I2C_TXN_READ);
+}
+
+static void go_r_more_txn_pre_one(struct pios_i2c_fsm *fsm)
+{
+    fsm->driver->ack(fsm->i2c_id, false);
+    fsm->driver->start(fsm->i2c_id);
+}
+
+static void go_r_last_txn_pre_one(struct pios_i2c_fsm *fsm)
+{
+    fsm->driver->ack(fsm->i2c_id, false);
+    fsm->driver->stop(fsm->i2c_id);
+}
+
+/* Common to 'more' and 'last' transaction */
+static void go_r_any_txn_pre_first(struct pios_i2c_fsm *fsm)
+{
+    fsm->driver->ack(fsm->i2c_id, true);
+}
+
+/* Common to 'more' and 'last' transaction */
+static void go_r_any_txn_pre_middle(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte <= fsm->last_byte);
+
+    *(fsm->active_byte) = fsm->driver->receive_byte(fsm->i2c_id);
+
+    /* Move to the next byte */
+    fsm->active_byte++;
+    PIOS_DEBUG_Assert(fsm->active_byte <= fsm->last_byte);
+}
+
+static void go_r_more_txn_pre_last(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte <= fsm->last_byte);
+
+    fsm->driver->ack(fsm->i2c_id, false);
+    PIOS_IRQ_Disable();
+    fsm->driver->irq_config(fsm->i2c_id, 0);
+    fsm->driver->start(fsm->i2c_id);
+    *(fsm->active_byte) = fsm->driver->receive_byte(fsm->i2c_id);
+    fsm->driver->irq_config(fsm->i2c_id, PIOS_I2C_FSM_IRQ_ALL);
+    PIOS_IRQ_Enable();
+
+    /* Move to the next byte */
+    fsm->active_byte++;
+    PIOS_DEBUG_Assert(fsm->active_byte <= fsm->last_byte);
+}
+
+static void go_r_last_txn_pre_last(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte <= fsm->last_byte);
+
+    fsm->driver->ack(fsm->i2c_id, false);
+    PIOS_IRQ_Disable();
+    fsm->driver->irq_config(fsm->i2c_id, 0);
+    fsm->driver->stop(fsm->i2c_id);
+    *(fsm->active_byte) = fsm->driver->receive_byte(fsm->i2c_id);
+    fsm->driver->irq_config(fsm->i2c_id, PIOS_I2C_FSM_IRQ_ALL);
+    PIOS_IRQ_Enable();
+
+    /* Move to the next byte */
+    fsm->active_byte++;
+    PIOS_DEBUG_Assert(fsm->active_byte <= fsm->last_byte);
+}
+
+/* Common to 'more' and 'last' transaction */
+static void go_r_any_txn_post_last(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte == fsm->last_byte);
+    PIOS_DEBUG_Assert(fsm->active_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn >= fsm->first_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+
+    *(fsm->active_byte) = fsm->driver->receive_byte(fsm->i2c_id);
+
+    /* Move to the next byte */
+    fsm->active_byte++;
+
+    /* Move to the next transaction */
+    fsm->active_txn++;
+}
+
+/* Common to 'more' and 'last' transaction */
+static void go_r_any_txn_dma(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte < fsm->last_byte);
+
+    /* Only errors interrupt us until the DMA has collected the whole phase */
+    fsm->driver->irq_config(fsm->i2c_id, PIOS_I2C_FSM_IRQ_ERR);
+    fsm->driver->ack(fsm->i2c_id, true);
+    fsm->driver->dma_start(fsm->i2c_id, PIOS_I2C_TXN_READ, fsm->active_byte, fsm->last_byte - fsm->active_byte + 1);
+}
+
+static void go_r_more_txn_dma_done(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_txn < fsm->last_txn);
+
+    fsm->driver->dma_stop(fsm->i2c_id);
+
+    /* Move past the data phase and on to the next transaction */
+    fsm->active_byte = fsm->last_byte + 1;
+    fsm->active_txn++;
+}
+
+static void go_r_last_txn_dma_done(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_txn == fsm->last_txn);
+
+    fsm->driver->dma_stop(fsm->i2c_id);
+    fsm->driver->stop(fsm->i2c_id);
+
+    fsm->active_byte = fsm->last_byte + 1;
+    fsm->active_txn++;
+}
+
+/* Common to 'more' and 'last' transaction */
+static void go_w_any_txn_addr(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn >= fsm->first_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+
+    PIOS_DEBUG_Assert(fsm->active_txn->rw == PIOS_I2C_TXN_WRITE);
+
+    fsm->driver->send_address(fsm->i2c_id, fsm->active_txn->addr, PIOS_I2C_TXN_WRITE);
+}
+
+static void go_w_any_txn_middle(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte < fsm->last_byte);
+    PIOS_DEBUG_Assert(fsm->active_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn >= fsm->first_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+
+    fsm->driver->send_byte(fsm->i2c_id, *(fsm->active_byte));
+
+    /* Move to the next byte */
+    fsm->active_byte++;
+    PIOS_DEBUG_Assert(fsm->active_byte <= fsm->last_byte);
+}
+
+static void go_w_more_txn_last(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte == fsm->last_byte);
+    PIOS_DEBUG_Assert(fsm->active_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn >= fsm->first_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+
+    fsm->driver->send_byte(fsm->i2c_id, *(fsm->active_byte));
+
+    /* Move to the next byte */
+    fsm->active_byte++;
+
+    /* Move to the next transaction */
+    fsm->active_txn++;
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+}
+
+static void go_w_last_txn_last(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte == fsm->last_byte);
+    PIOS_DEBUG_Assert(fsm->active_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn >= fsm->first_txn);
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+
+    fsm->driver->irq_config(fsm->i2c_id, PIOS_I2C_FSM_IRQ_EVT | PIOS_I2C_FSM_IRQ_ERR);
+    fsm->driver->send_byte(fsm->i2c_id, *(fsm->active_byte));
+
+// SHOULD MOVE THIS INTO A STOPPING STATE AND SET IT ONLY AFTER THE BYTE WAS SENT
+    fsm->driver->stop(fsm->i2c_id);
+
+    /* Move to the next byte */
+    fsm->active_byte++;
+}
+
+/* Common to 'more' and 'last' transaction */
+static void go_w_any_txn_dma(struct pios_i2c_fsm *fsm)
+{
+    PIOS_DEBUG_Assert(fsm->active_byte);
+    PIOS_DEBUG_Assert(fsm->active_byte < fsm->last_byte);
+
+    fsm->driver->dma_start(fsm->i2c_id, PIOS_I2C_TXN_WRITE, fsm->active_byte, fsm->last_byte - fsm->active_byte + 1);
+
+    /*
+     * The whole phase belongs to the DMA now. The next byte transfer
+     * finished event is the last byte leaving the shift register.
+     */
+    fsm->active_byte = fsm->last_byte + 1;
+}
+
+static void go_w_more_txn_dma_done(struct pios_i2c_fsm *fsm)
+{
+    fsm->driver->dma_stop(fsm->i2c_id);
+
+    /* Move to the next transaction */
+    fsm->active_txn++;
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+}
+
+static void go_w_last_txn_dma_done(struct pios_i2c_fsm *fsm)
+{
+    fsm->driver->dma_stop(fsm->i2c_id);
+    fsm->driver->stop(fsm->i2c_id);
+}
+
+static void go_nack(struct pios_i2c_fsm *fsm)
+{
+    fsm->nack = true;
+    fsm->driver->irq_config(fsm->i2c_id, 0);
+    i2c_fsm_dma_stop(fsm);
+    fsm->driver->ack(fsm->i2c_id, false);
+    fsm->driver->stop(fsm->i2c_id);
+}
+
+/**
+ * Bring a stopping bus to rest and hand the result of the request back
+ */
+static void i2c_fsm_complete(struct pios_i2c_fsm *fsm, bool *woken)
+{
+    int32_t result;
+
+    PIOS_IRQ_Disable();
+    if (fsm->curr_state != I2C_STATE_STOPPING) {
+        PIOS_IRQ_Enable();
+        return;
+    }
+
+    result = fsm->bus_error ? -1 :
+             fsm->nack ? -3 :
+             0;
+
+    if (fsm->driver->wait_stopped(fsm->i2c_id)) {
+        i2c_fsm_inject_event(fsm, I2C_EVENT_STOPPED, woken);
+    } else {
+        /* The stop condition never went out, start over from a clean bus */
+        fsm->driver->reset_bus(fsm->i2c_id);
+        fsm->curr_state = I2C_STATE_STOPPED;
+        result = -1;
+    }
+    PIOS_IRQ_Enable();
+
+    /* Late events can still fault an idle bus, there is nobody to report to then */
+    if (fsm->running) {
+        i2c_fsm_finish(fsm, result, woken);
+    }
+}
+
+static void i2c_fsm_inject_event(struct pios_i2c_fsm *fsm, enum pios_i2c_fsm_event event, bool *woken)
+{
+    PIOS_IRQ_Disable();
+
+#if defined(PIOS_I2C_DIAGNOSTICS)
+    fsm->event_history[fsm->event_history_pointer] = event;
+    fsm->event_history_pointer = (fsm->event_history_pointer + 1) % I2C_LOG_DEPTH;
+
+    fsm->state_history[fsm->state_history_pointer] = fsm->curr_state;
+    fsm->state_history_pointer = (fsm->state_history_pointer + 1) % I2C_LOG_DEPTH;
+
+    if (i2c_fsm_transitions[fsm->curr_state].next_state[event] == I2C_STATE_FSM_FAULT && fsm->driver->log_fault) {
+        fsm->driver->log_fault(fsm->i2c_id, PIOS_I2C_ERROR_FSM);
+    }
+#endif
+    /*
+     * Move to the next state
+     *
+     * This is done prior to calling the new state's entry function to
+     * guarantee that the entry function never depends on the previous
+     * state.  This way, it cannot ever know what the previous state was.
+     */
+    fsm->curr_state = i2c_fsm_transitions[fsm->curr_state].next_state[event];
+
+    /* Call the entry function (if any) for the next state. */
+    if (i2c_fsm_transitions[fsm->curr_state].entry_fn) {
+        i2c_fsm_transitions[fsm->curr_state].entry_fn(fsm);
+    }
+
+    /* Process any AUTO transitions in the FSM */
+    i2c_fsm_process_auto(fsm);
+
+    PIOS_IRQ_Enable();
+
+    if (fsm->curr_state == I2C_STATE_STOPPING) {
+        i2c_fsm_complete(fsm, woken);
+    }
+}
+
+static void i2c_fsm_process_auto(struct pios_i2c_fsm *fsm)
+{
+    PIOS_IRQ_Disable();
+
+    while (i2c_fsm_transitions[fsm->curr_state].next_state[I2C_EVENT_AUTO]) {
+        fsm->curr_state = i2c_fsm_transitions[fsm->curr_state].next_state[I2C_EVENT_AUTO];
+
+        /* Call the entry function (if any) for the next state. */
+        if (i2c_fsm_transitions[fsm->curr_state].entry_fn) {
+            i2c_fsm_transitions[fsm->curr_state].entry_fn(fsm);
+        }
+    }
+
+    PIOS_IRQ_Enable();
+}
+
+/**
+ * Initialise the state machine with an idle bus and an empty queue
+ * \param[in] fsm state machine to initialise
+ * \param[in] driver low level hooks of the adapter
+ * \param[in] i2c_id handle passed back to the hooks
+ * \param[in] dma PIOS_I2C_FSM_DMA_* directions the driver can move by DMA
+ */
+void PIOS_I2C_FSM_Init(struct pios_i2c_fsm *fsm, const struct pios_i2c_fsm_driver *driver, uint32_t i2c_id, uint8_t dma)
+{
+    PIOS_Assert(fsm);
+    PIOS_Assert(driver);
+    PIOS_Assert(!dma || (driver->dma_start && driver->dma_stop));
+
+    fsm->driver     = driver;
+    fsm->i2c_id     = i2c_id;
+    fsm->dma        = dma;
+    fsm->head       = NULL;
+    fsm->tail       = NULL;
+    fsm->running    = false;
+    fsm->completed  = 0;
+    fsm->failed     = 0;
+    fsm->timeouts   = 0;
+    fsm->bus_error  = false;
+    fsm->nack       = false;
+    fsm->active_txn = NULL;
+
+    fsm->driver->reset_bus(fsm->i2c_id);
+    fsm->curr_state = I2C_STATE_STOPPED;
+}
+
+static void i2c_fsm_start(struct pios_i2c_fsm *fsm, struct pios_i2c_request *req, bool *woken)
+{
+    PIOS_DEBUG_Assert(fsm->curr_state == I2C_STATE_STOPPED);
+
+    fsm->first_txn  = &req->txn_list[0];
+    fsm->last_txn   = &req->txn_list[req->num_txns - 1];
+    fsm->active_txn = fsm->first_txn;
+    fsm->bus_error  = false;
+    fsm->nack       = false;
+    fsm->started_us = PIOS_DELAY_GetuS();
+
+    i2c_fsm_inject_event(fsm, I2C_EVENT_START, woken);
+}
+
+/**
+ * Complete the request at the head of the queue and start the next one.
+ */
+static void i2c_fsm_finish(struct pios_i2c_fsm *fsm, int32_t result, bool *woken)
+{
+    struct pios_i2c_request *req = fsm->head;
+
+    PIOS_Assert(fsm->running && req);
+
+    PIOS_IRQ_Disable();
+    fsm->head = req->next;
+    if (!fsm->head) {
+        fsm->tail = NULL;
+    }
+    PIOS_IRQ_Enable();
+
+    if (result == 0) {
+        fsm->completed++;
+    } else {
+        fsm->failed++;
+    }
+
+    /* The request belongs to the caller again from here on, it may even be resubmitted by the callback */
+    req->next   = NULL;
+    req->result = result;
+    if (req->callback) {
+        req->callback(req, woken);
+    }
+
+    PIOS_IRQ_Disable();
+    req = fsm->head;
+    if (!req) {
+        fsm->running = false;
+        PIOS_IRQ_Enable();
+        return;
+    }
+    PIOS_IRQ_Enable();
+
+    i2c_fsm_start(fsm, req, woken);
+}
+
+/**
+ * Append a request to the queue and start it if the bus is idle.
+ * Safe to call from task or interrupt context.
+ * \param[in] fsm state machine of the adapter
+ * \param[in] req request, must not be queued already
+ * \param woken[in,out] If non-NULL, will be set to true if a higher priority task is now eligible to run
+ * \return 0 if queued
+ * \return -1 if the request is malformed
+ */
+int32_t PIOS_I2C_FSM_Submit(struct pios_i2c_fsm *fsm, struct pios_i2c_request *req, bool *woken)
+{
+    if (!req || !req->txn_list || req->num_txns == 0) {
+        return -1;
+    }
+
+    req->next   = NULL;
+    req->result = PIOS_I2C_REQUEST_PENDING;
+
+    PIOS_IRQ_Disable();
+    if (fsm->tail) {
+        fsm->tail->next = req;
+    } else {
+        fsm->head = req;
+    }
+    fsm->tail = req;
+
+    if (fsm->running) {
+        PIOS_IRQ_Enable();
+        return 0;
+    }
+    fsm->running = true;
+    PIOS_IRQ_Enable();
+
+    i2c_fsm_start(fsm, req, woken);
+
+    return 0;
+}
+
+/**
+ * Abort the request on the bus if it has been running for too long.
+ * The bus is reset and the request completes with -2. Meant to be called
+ * periodically, from task or interrupt context, as a hung bus raises no interrupt.
+ * \param[in] fsm state machine of the adapter
+ * \param[in] timeout_us how long a request may take
+ * \param woken[in,out] If non-NULL, will be set to true if a higher priority task is now eligible to run
+ * \return true if a request was aborted
+ */
+bool PIOS_I2C_FSM_CheckTimeout(struct pios_i2c_fsm *fsm, uint32_t timeout_us, bool *woken)
+{
+    PIOS_IRQ_Disable();
+    /* A stopped bus while running means the previous request is just being handed back */
+    if (!fsm->running || fsm->curr_state == I2C_STATE_STOPPED ||
+        PIOS_DELAY_GetuSSince(fsm->started_us) < timeout_us) {
+        PIOS_IRQ_Enable();
+        return false;
+    }
+
+    fsm->driver->irq_config(fsm->i2c_id, 0);
+    i2c_fsm_dma_stop(fsm);
+    fsm->driver->reset_bus(fsm->i2c_id);
+    fsm->curr_state = I2C_STATE_STOPPED;
+    fsm->timeouts++;
+    PIOS_IRQ_Enable();
+
+    i2c_fsm_finish(fsm, -2, woken);
+
+    return true;
+}
+
+/**
+ * Check if a request is in progress
+ * \param[in] fsm state machine of the adapter
+ * \return true if the bus is busy
+ */
+bool PIOS_I2C_FSM_Running(struct pios_i2c_fsm *fsm)
+{
+    return fsm->running;
+}
+
+/**
+ * A start condition has been sent
+ */
+void PIOS_I2C_FSM_Started(struct pios_i2c_fsm *fsm, bool *woken)
+{
+    enum pios_i2c_fsm_event event;
+
+    PIOS_DEBUG_Assert(fsm->active_txn <= fsm->last_txn);
+
+    if (fsm->active_txn->rw == PIOS_I2C_TXN_READ) {
+        event = (fsm->active_txn == fsm->last_txn) ? I2C_EVENT_STARTED_LAST_TXN_READ : I2C_EVENT_STARTED_MORE_TXN_READ;
+    } else {
+        event = (fsm->active_txn == fsm->last_txn) ? I2C_EVENT_STARTED_LAST_TXN_WRITE : I2C_EVENT_STARTED_MORE_TXN_WRITE;
+    }
+
+    i2c_fsm_inject_event(fsm, event, woken);
+}
+
+/**
+ * The slave address has been acknowledged
+ */
+void PIOS_I2C_FSM_AddrSent(struct pios_i2c_fsm *fsm, bool *woken)
+{
+    uint8_t dma = (fsm->active_txn->rw == PIOS_I2C_TXN_READ) ? PIOS_I2C_FSM_DMA_READ : PIOS_I2C_FSM_DMA_WRITE;
+
+    switch (fsm->last_byte - fsm->active_byte + 1) {
+    case 0:
+        i2c_fsm_inject_event(fsm, I2C_EVENT_ADDR_SENT_LEN_EQ_0, woken);
+        break;
+    case 1:
+        i2c_fsm_inject_event(fsm, I2C_EVENT_ADDR_SENT_LEN_EQ_1, woken);
+        break;
+    case 2:
+        i2c_fsm_inject_event(fsm, (fsm->dma & dma) ? I2C_EVENT_ADDR_SENT_DMA : I2C_EVENT_ADDR_SENT_LEN_EQ_2, woken);
+        break;
+    default:
+        i2c_fsm_inject_event(fsm, (fsm->dma & dma) ? I2C_EVENT_ADDR_SENT_DMA : I2C_EVENT_ADDR_SENT_LEN_GT_2, woken);
+        break;
+    }
+}
+
+/**
+ * A byte has been received or transmitted
+ */
+void PIOS_I2C_FSM_TransferDone(struct pios_i2c_fsm *fsm, bool *woken)
+{
+    switch (fsm->last_byte - fsm->active_byte + 1) {
+    case 0:
+        i2c_fsm_inject_event(fsm, I2C_EVENT_TRANSFER_DONE_LEN_EQ_0, woken);
+        break;
+    case 1:
+        i2c_fsm_inject_event(fsm, I2C_EVENT_TRANSFER_DONE_LEN_EQ_1, woken);
+        break;
+    case 2:
+        i2c_fsm_inject_event(fsm, I2C_EVENT_TRANSFER_DONE_LEN_EQ_2, woken);
+        break;
+    default:
+        i2c_fsm_inject_event(fsm, I2C_EVENT_TRANSFER_DONE_LEN_GT_2, woken);
+        break;
+    }
+}
+
+/**
+ * The DMA has received the last byte of a read phase
+ */
+void PIOS_I2C_FSM_DMADone(struct pios_i2c_fsm *fsm, bool *woken)
+{
+    i2c_fsm_inject_event(fsm, I2C_EVENT_DMA_DONE, woken);
+}
+
+/**
+ * The slave did not acknowledge
+ */
+void PIOS_I2C_FSM_Nack(struct pios_i2c_fsm *fsm, bool *woken)
+{
+    i2c_fsm_inject_event(fsm, I2C_EVENT_NACK, woken);
+}
+
+/**
+ * Arbitration lost, misplaced start/stop or an unexpected event
+ */
+void PIOS_I2C_FSM_BusError(struct pios_i2c_fsm *fsm, bool *woken)
+{
+    i2c_fsm_inject_event(fsm, I2C_EVENT_BUS_ERROR, woken);
+}
+
+#endif /* PIOS_INCLUDE_I2C */
+
+/**
+ * @}
+ * @}
+ */
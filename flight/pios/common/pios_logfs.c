@@ -96,6 +96,13 @@ int32_t PIOS_FLASHFS_Logfs_Destroy(
     return 0;
 }
 
+int32_t PIOS_FLASHFS_Logfs_Poll(
+    __attribute__((unused)) uintptr_t fs_id)
+{
+    // stub, files are written synchronously
+    return 0;
+}
+
 /**********************************
  *
  * Provide a PIOS_FLASHFS_* driver
@@ -116,6 +116,24 @@ static bool PIOS_MPU6000_ReadSensor(bool *woken);
 
 static int32_t PIOS_MPU6000_Test(void);
 
+#if defined(STM32F4XX)
+/*
+ * Samples are read with a queued transaction started from the EXTI handler
+ * and handled from the SPI DMA interrupt, nobody waits for the transfer.
+ */
+#define PIOS_MPU6000_QUEUED_READ
+
+static void PIOS_MPU6000_ReadDone(struct pios_spi_txn *txn, bool *woken);
+
+static const uint8_t mpu6000_send_buf[1 + PIOS_MPU6000_SAMPLES_BYTES] = { PIOS_MPU6000_SENSOR_FIRST_REG | 0x80 };
+static const struct pios_spi_segment mpu6000_read_segment = {
+    mpu6000_send_buf, mpu6000_data.buffer, sizeof(mpu6000_data_t)
+};
+static struct pios_spi_txn mpu6000_read_txn;
+// Set until the last sample has been handled, mpu6000_data is in use till then
+static volatile bool mpu6000_reading = false;
+#endif /* defined(STM32F4XX) */
+
 void PIOS_MPU6000_Register()
 {
     PIOS_SENSORS_Register(&PIOS_MPU6000_Driver, PIOS_SENSORS_TYPE_3AXIS_GYRO_ACCEL, 0);
@@ -174,6 +192,14 @@ int32_t PIOS_MPU6000_Init(uint32_t spi_id, uint32_t slave_num, const struct pios
     dev->slave_num = slave_num;
     dev->cfg = cfg;
 
+#ifdef PIOS_MPU6000_QUEUED_READ
+    mpu6000_read_txn.slave_id     = slave_num;
+    mpu6000_read_txn.segments     = &mpu6000_read_segment;
+    mpu6000_read_txn.num_segments = 1;
+    mpu6000_read_txn.prescaler    = cfg->fast_prescaler;
+    mpu6000_read_txn.callback     = PIOS_MPU6000_ReadDone;
+#endif
+
     /* Configure the MPU6000 Sensor */
     PIOS_MPU6000_Config(cfg);
 
@@ -328,6 +354,7 @@ static void PIOS_MPU6000_SetSpeed(const bool fast)
     }
 }
 
+#ifndef PIOS_MPU6000_QUEUED_READ
 /**
  * @brief Claim the SPI bus for the accel communications and select this chip
  * @return 0 if successful, -1 for invalid device, -2 if unable to claim bus
@@ -346,6 +373,7 @@ static int32_t PIOS_MPU6000_ClaimBusISR(bool *woken, bool fast_spi)
     PIOS_SPI_RC_PinSet(dev->spi_id, dev->slave_num, 0);
     return 0;
 }
+#endif /* ifndef PIOS_MPU6000_QUEUED_READ */
 
 /**
  * @brief Release the SPI bus for the accel communications and end the transaction
@@ -360,6 +388,7 @@ static int32_t PIOS_MPU6000_ReleaseBus()
     return PIOS_SPI_ReleaseBus(dev->spi_id);
 }
 
+#ifndef PIOS_MPU6000_QUEUED_READ
 /**
  * @brief Release the SPI bus for the accel communications and end the transaction
  * @return 0 if successful
@@ -374,6 +403,7 @@ static int32_t PIOS_MPU6000_ReleaseBusISR(bool *woken)
     PIOS_SPI_RC_PinSet(dev->spi_id, dev->slave_num, 1);
     return PIOS_SPI_ReleaseBusISR(dev->spi_id, woken);
 }
+#endif /* ifndef PIOS_MPU6000_QUEUED_READ */
 
 /**
  * @brief Read a register from MPU6000
@@ -549,10 +579,14 @@ bool PIOS_MPU6000_IRQHandler(void)
     bool read_ok = false;
     read_ok = PIOS_MPU6000_ReadSensor(&woken);
 
+#ifndef PIOS_MPU6000_QUEUED_READ
     if (read_ok) {
         bool woken2 = PIOS_MPU6000_HandleData();
         woken |= woken2;
     }
+#else
+    (void)read_ok;
+#endif
 
     return woken;
 }
@@ -605,6 +639,39 @@ static bool PIOS_MPU6000_HandleData()
     return higherPriorityTaskWoken == pdTRUE;
 }
 
+#ifdef PIOS_MPU6000_QUEUED_READ
+/**
+ * @brief Queue the read of a sample, handled by PIOS_MPU6000_ReadDone()
+ * @return true if the read has been queued
+ */
+static bool PIOS_MPU6000_ReadSensor(__attribute__((unused)) bool *woken)
+{
+    if (PIOS_MPU6000_Validate(dev) != 0) {
+        return false;
+    }
+    // The previous sample is still being read or handled, skip this one
+    if (mpu6000_reading) {
+        return false;
+    }
+    mpu6000_reading = true;
+    if (PIOS_SPI_QueueTransaction(dev->spi_id, &mpu6000_read_txn) < 0) {
+        mpu6000_reading = false;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Completion of the sample read, called from the SPI DMA interrupt
+ */
+static void PIOS_MPU6000_ReadDone(struct pios_spi_txn *txn, bool *woken)
+{
+    if (txn->result == 0 && PIOS_MPU6000_HandleData() && woken) {
+        *woken = true;
+    }
+    mpu6000_reading = false;
+}
+#else /* ifdef PIOS_MPU6000_QUEUED_READ */
 static bool PIOS_MPU6000_ReadSensor(bool *woken)
 {
     const uint8_t mpu6000_send_buf[1 + PIOS_MPU6000_SAMPLES_BYTES] = { PIOS_MPU6000_SENSOR_FIRST_REG | 0x80 };
@@ -619,6 +686,7 @@ static bool PIOS_MPU6000_ReadSensor(bool *woken)
     PIOS_MPU6000_ReleaseBusISR(woken);
     return true;
 }
+#endif /* ifdef PIOS_MPU6000_QUEUED_READ */
 
 // Sensor driver implementation
 bool PIOS_MPU6000_driver_Test(__attribute__((unused)) uintptr_t context)
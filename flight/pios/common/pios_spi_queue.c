@@ -0,0 +1,204 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_SPI SPI Functions
+ * @brief Hardware independent queue of chip select bracketed SPI transactions
+ * @{
+ *
+ * @file       pios_spi_queue.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Queues SPI transactions and chains them from the completion interrupt.
+ * @see        The GNU Public License (GPL) Version 3
+ * @notes
+ *
+ * The queue owns the bus (through the driver claim/release hooks) from the
+ * moment the first transaction is started until the queue runs empty. Each
+ * segment is started by the driver and reported back through
+ * PIOS_SPI_Queue_SegmentDone(), normally from the DMA transfer complete
+ * interrupt, which in turn starts the next segment or transaction. Nobody
+ * waits on the hardware.
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <pios.h>
+
+#ifdef PIOS_INCLUDE_SPI
+
+#include <pios_spi_queue.h>
+
+/**
+ * Initialise an empty queue
+ * \param[in] queue queue to initialise
+ * \param[in] driver low level hooks of the bus
+ * \param[in] spi_id handle passed back to the hooks
+ */
+void PIOS_SPI_Queue_Init(struct pios_spi_queue *queue, const struct pios_spi_queue_driver *driver, uint32_t spi_id)
+{
+    PIOS_Assert(queue);
+    PIOS_Assert(driver);
+
+    queue->driver    = driver;
+    queue->spi_id    = spi_id;
+    queue->head      = NULL;
+    queue->tail      = NULL;
+    queue->running   = false;
+    queue->completed = 0;
+    queue->failed    = 0;
+}
+
+/**
+ * Set the clock of a transaction, select its slave and start its first segment.
+ */
+static void PIOS_SPI_Queue_StartTxn(struct pios_spi_queue *queue, struct pios_spi_txn *txn)
+{
+    queue->driver->set_speed(queue->spi_id, txn->prescaler);
+    queue->driver->select(queue->spi_id, txn->slave_id, true);
+    queue->driver->start(queue->spi_id, &txn->segments[txn->segment]);
+}
+
+/**
+ * Append a transaction to the queue and start it if the bus is idle.
+ * Safe to call from task or interrupt context.
+ * \param[in] queue queue of the bus
+ * \param[in] txn transaction, must not be queued already
+ * \param woken[in,out] If non-NULL, will be set to true if a higher priority task is now eligible to run
+ * \return 0 if queued
+ * \return -1 if the transaction is malformed
+ */
+int32_t PIOS_SPI_Queue_Submit(struct pios_spi_queue *queue, struct pios_spi_txn *txn, bool *woken)
+{
+    if (!txn || !txn->segments || txn->num_segments == 0) {
+        return -1;
+    }
+    for (uint8_t i = 0; i < txn->num_segments; i++) {
+        if (txn->segments[i].len == 0) {
+            return -1;
+        }
+    }
+
+    txn->segment = 0;
+    txn->next    = NULL;
+    txn->result  = PIOS_SPI_TXN_PENDING;
+
+    PIOS_IRQ_Disable();
+    if (queue->tail) {
+        queue->tail->next = txn;
+    } else {
+        queue->head = txn;
+    }
+    queue->tail = txn;
+    PIOS_IRQ_Enable();
+
+    PIOS_SPI_Queue_Kick(queue, woken);
+
+    return 0;
+}
+
+/**
+ * Start processing pending transactions if the queue is idle and the bus can be taken.
+ * Has to be called whenever the bus has been released by someone else.
+ * \param[in] queue queue of the bus
+ * \param woken[in,out] If non-NULL, will be set to true if a higher priority task is now eligible to run
+ */
+void PIOS_SPI_Queue_Kick(struct pios_spi_queue *queue, bool *woken)
+{
+    struct pios_spi_txn *txn;
+
+    PIOS_IRQ_Disable();
+    txn = queue->head;
+    if (queue->running || !txn || !queue->driver->claim(queue->spi_id, woken)) {
+        PIOS_IRQ_Enable();
+        return;
+    }
+    queue->running = true;
+    PIOS_IRQ_Enable();
+
+    PIOS_SPI_Queue_StartTxn(queue, txn);
+}
+
+/**
+ * Report the end of the current segment. Starts the next segment, or completes
+ * the transaction and starts the next one. Releases the bus once the queue is empty.
+ * \param[in] queue queue of the bus
+ * \param[in] result 0 on success, < 0 aborts the remaining segments of the transaction
+ * \param woken[in,out] If non-NULL, will be set to true if a higher priority task is now eligible to run
+ */
+void PIOS_SPI_Queue_SegmentDone(struct pios_spi_queue *queue, int32_t result, bool *woken)
+{
+    struct pios_spi_txn *txn = queue->head;
+
+    PIOS_Assert(queue->running && txn);
+
+    if (result == 0 && ++txn->segment < txn->num_segments) {
+        queue->driver->start(queue->spi_id, &txn->segments[txn->segment]);
+        return;
+    }
+
+    queue->driver->select(queue->spi_id, txn->slave_id, false);
+
+    PIOS_IRQ_Disable();
+    queue->head = txn->next;
+    if (!queue->head) {
+        queue->tail = NULL;
+    }
+    PIOS_IRQ_Enable();
+
+    if (result == 0) {
+        queue->completed++;
+    } else {
+        queue->failed++;
+    }
+
+    /* The transaction belongs to the caller again from here on, it may even be resubmitted by the callback */
+    txn->next   = NULL;
+    txn->result = result;
+    if (txn->callback) {
+        txn->callback(txn, woken);
+    }
+
+    PIOS_IRQ_Disable();
+    txn = queue->head;
+    if (!txn) {
+        /* Released with interrupts off so that a concurrent submit can't see the bus still taken */
+        queue->driver->release(queue->spi_id, woken);
+        queue->running = false;
+        PIOS_IRQ_Enable();
+        return;
+    }
+    PIOS_IRQ_Enable();
+
+    PIOS_SPI_Queue_StartTxn(queue, txn);
+}
+
+/**
+ * Check if the queue currently owns the bus
+ * \param[in] queue queue of the bus
+ * \return true if a transaction is in progress
+ */
+bool PIOS_SPI_Queue_Running(struct pios_spi_queue *queue)
+{
+    return queue->running;
+}
+
+#endif /* PIOS_INCLUDE_SPI */
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,155 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_USART USART Functions
+ * @brief Hardware independent bookkeeping for DMA driven USARTs
+ * @{
+ *
+ * @file       pios_usart_dma.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Receive ring and transmit chunking between USART DMA and the COM layer.
+ * @see        The GNU Public License (GPL) Version 3
+ * @notes
+ *
+ * Both halves keep the rx_in/tx_out callback contract of the byte at a time
+ * drivers, the COM layer does not know whether a port runs on DMA. Neither
+ * touches hardware: the driver reports the stream's remaining count and
+ * starts the transfers, which keeps this code testable on the host.
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <pios.h>
+
+#ifdef PIOS_INCLUDE_USART
+
+#include <pios_usart_dma.h>
+
+/**
+ * Attach the receive ring to the buffer the DMA stream writes into
+ */
+void PIOS_USART_RxRing_Init(struct pios_usart_rx_ring *ring, uint8_t *buf, uint16_t size)
+{
+    PIOS_Assert(ring);
+    PIOS_Assert(buf);
+    PIOS_Assert(size > 0);
+
+    ring->buf     = buf;
+    ring->size    = size;
+    ring->tail    = 0;
+    ring->dropped = 0;
+}
+
+/**
+ * Hand everything the DMA stream wrote since the last call to the COM layer.
+ * Bytes it has no room for are dropped and counted, just like the interrupt
+ * driven receive path, since the stream overwrites them on its next lap.
+ * \param[in] remaining stream transfer counter (NDTR), counts down from size
+ * \param[out] need_yield set when a task has been woken, never cleared
+ * \return number of bytes accepted by the COM layer
+ */
+uint16_t PIOS_USART_RxRing_Drain(struct pios_usart_rx_ring *ring, uint16_t remaining, pios_com_callback rx_in_cb, uint32_t context, bool *need_yield)
+{
+    uint16_t accepted_total = 0;
+    uint16_t head;
+
+    /* The counter reloads to size on wrap, 0 is only seen in passing */
+    if (remaining == 0 || remaining > ring->size) {
+        head = 0;
+    } else {
+        head = ring->size - remaining;
+    }
+
+    /* At most two chunks, the second one when the stream wrapped */
+    while (ring->tail != head) {
+        uint16_t end = (head > ring->tail) ? head : ring->size;
+        uint16_t len = end - ring->tail;
+        uint16_t accepted = 0;
+
+        if (rx_in_cb) {
+            bool yield = false;
+            accepted = (rx_in_cb)(context, &ring->buf[ring->tail], len, NULL, &yield);
+            if (yield) {
+                *need_yield = true;
+            }
+        }
+        if (accepted < len) {
+            ring->dropped += len - accepted;
+        }
+        accepted_total += accepted;
+
+        ring->tail = (end == ring->size) ? 0 : end;
+    }
+
+    return accepted_total;
+}
+
+/**
+ * Attach the transmit bounce buffer
+ */
+void PIOS_USART_DMA_TxInit(struct pios_usart_dma_tx *tx, uint8_t *buf, uint16_t size)
+{
+    PIOS_Assert(tx);
+    PIOS_Assert(buf);
+    PIOS_Assert(size > 0);
+
+    tx->buf       = buf;
+    tx->size      = size;
+    tx->busy      = false;
+    tx->transfers = 0;
+}
+
+/**
+ * Decide what the transmit stream sends next. Called with done set when a
+ * transfer completed and without when the COM layer queued new data. The
+ * driver must call it from a single interrupt priority only.
+ * \param[out] need_yield set when a task has been woken, never cleared
+ * \return number of bytes in tx->buf to start a transfer for, 0 for none
+ */
+uint16_t PIOS_USART_DMA_TxNext(struct pios_usart_dma_tx *tx, bool done, pios_com_callback tx_out_cb, uint32_t context, bool *need_yield)
+{
+    if (tx->busy && !done) {
+        /* The completion of the running transfer picks up the new data */
+        return 0;
+    }
+    tx->busy = false;
+
+    if (!tx_out_cb) {
+        return 0;
+    }
+
+    bool yield     = false;
+    uint16_t bytes = (tx_out_cb)(context, tx->buf, tx->size, NULL, &yield);
+    if (yield) {
+        *need_yield = true;
+    }
+
+    if (bytes > 0) {
+        tx->busy = true;
+        tx->transfers++;
+    }
+
+    return bytes;
+}
+
+#endif /* PIOS_INCLUDE_USART */
+
+/**
+ * @}
+ * @}
+ */
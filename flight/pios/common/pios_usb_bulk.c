@@ -0,0 +1,308 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_USB USB Functions
+ * @brief Hardware independent packetization between the COM layer and USB endpoints
+ * @{
+ *
+ * @file       pios_usb_bulk.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Multi-packet, double buffered endpoint transfers for USB COM drivers.
+ * @see        The GNU Public License (GPL) Version 3
+ * @notes
+ *
+ * The class drivers decide when a transfer can start and tell the endpoint
+ * about it, everything about how COM data is cut into transfers and packets
+ * lives here. Nothing in this file touches the USB hardware.
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <pios.h>
+
+#if defined(PIOS_INCLUDE_USB_CDC) || defined(PIOS_INCLUDE_USB_HID)
+
+#include <pios_usb_bulk.h>
+
+/**
+ * Attach both transfer buffers
+ * \param[in] buf_size size of each buffer, a multiple of packet_size
+ * \param[in] header_len per packet report header, 0 for a byte stream
+ */
+void PIOS_USB_BulkTx_Init(struct pios_usb_bulk_tx *tx, uint8_t *buf0, uint8_t *buf1, uint16_t buf_size, uint16_t packet_size, uint8_t header_len)
+{
+    PIOS_Assert(tx);
+    PIOS_Assert(buf0 && buf1);
+    PIOS_Assert(packet_size > header_len);
+    PIOS_Assert(buf_size >= packet_size && (buf_size % packet_size) == 0);
+
+    tx->buf[0]      = buf0;
+    tx->buf[1]      = buf1;
+    tx->buf_size    = buf_size;
+    tx->packet_size = packet_size;
+    tx->header_len  = header_len;
+
+    tx->bytes       = 0;
+    tx->transfers   = 0;
+    tx->packets     = 0;
+    tx->zlps        = 0;
+
+    PIOS_USB_BulkTx_Reset(tx);
+}
+
+/**
+ * Forget about anything queued or on the bus, used when the interface goes away
+ */
+void PIOS_USB_BulkTx_Reset(struct pios_usb_bulk_tx *tx)
+{
+    tx->len[0] = 0;
+    tx->len[1] = 0;
+    tx->active = 0;
+    tx->busy   = false;
+}
+
+static uint16_t PIOS_USB_BulkTx_Fill(struct pios_usb_bulk_tx *tx, uint8_t *buf, pios_com_callback tx_out_cb, uint32_t context, bool *need_yield)
+{
+    if (!tx_out_cb) {
+        return 0;
+    }
+
+    bool yield = false;
+    uint16_t len;
+
+    if (tx->header_len == 0) {
+        len = (tx_out_cb)(context, buf, tx->buf_size, NULL, &yield);
+    } else {
+        uint16_t max_payload = tx->packet_size - tx->header_len;
+        len = 0;
+
+        /* One COM callback per report, stop at the first short one */
+        for (uint16_t offset = 0; offset < tx->buf_size; offset += tx->packet_size) {
+            uint8_t *packet = &buf[offset];
+            uint16_t payload;
+            bool packet_yield = false;
+
+            payload = (tx_out_cb)(context, &packet[tx->header_len], max_payload, NULL, &packet_yield);
+            if (packet_yield) {
+                yield = true;
+            }
+            if (payload == 0) {
+                break;
+            }
+
+            packet[0] = PIOS_USB_BULK_REPORT_ID;
+            if (tx->header_len > 1) {
+                packet[1] = payload;
+            }
+            /* Reports always go out whole */
+            len += tx->packet_size;
+            tx->bytes += payload;
+
+            if (payload < max_payload) {
+                break;
+            }
+        }
+    }
+
+    if (yield) {
+        *need_yield = true;
+    }
+
+    if (tx->header_len == 0) {
+        tx->bytes += len;
+    }
+
+    return len;
+}
+
+/**
+ * Decide what goes out on the endpoint next. Called with done set from the
+ * transfer complete interrupt and without when the COM layer queued data.
+ * The caller has to keep the two from running concurrently.
+ * \param[out] buf, len transfer to start when true is returned, len may be
+ * 0 for a zero length packet
+ * \param[out] need_yield set when a task has been woken, never cleared
+ * \return true when a transfer has to be started
+ */
+bool PIOS_USB_BulkTx_Next(struct pios_usb_bulk_tx *tx, bool done, pios_com_callback tx_out_cb, uint32_t context, bool *need_yield, uint8_t **buf, uint16_t *len)
+{
+    uint8_t spare = tx->active ^ 1;
+    bool zlp_due  = false;
+
+    if (done && tx->busy) {
+        uint16_t sent = tx->len[tx->active];
+
+        /*
+         * The host only sees the end of a stream transfer on a short packet,
+         * unless more data follows right away a full last packet needs a ZLP.
+         */
+        zlp_due    = (tx->header_len == 0) && (sent > 0) && ((sent % tx->packet_size) == 0);
+
+        tx->len[tx->active] = 0;
+        tx->busy   = false;
+        tx->active = spare;
+        spare ^= 1;
+    }
+
+    if (tx->busy) {
+        /* Have the next transfer ready for when this one completes */
+        if (tx->len[spare] == 0) {
+            tx->len[spare] = PIOS_USB_BulkTx_Fill(tx, tx->buf[spare], tx_out_cb, context, need_yield);
+        }
+        return false;
+    }
+
+    if (tx->len[tx->active] == 0) {
+        tx->len[tx->active] = PIOS_USB_BulkTx_Fill(tx, tx->buf[tx->active], tx_out_cb, context, need_yield);
+    }
+
+    if (tx->len[tx->active] > 0) {
+        *buf = tx->buf[tx->active];
+        *len = tx->len[tx->active];
+
+        tx->busy     = true;
+        tx->transfers++;
+        tx->packets += (*len + tx->packet_size - 1) / tx->packet_size;
+
+        if (tx->len[spare] == 0) {
+            tx->len[spare] = PIOS_USB_BulkTx_Fill(tx, tx->buf[spare], tx_out_cb, context, need_yield);
+        }
+        return true;
+    }
+
+    if (zlp_due) {
+        *buf = tx->buf[tx->active];
+        *len = 0;
+
+        tx->busy = true;
+        tx->transfers++;
+        tx->packets++;
+        tx->zlps++;
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Attach the receive buffer
+ * \param[in] header_len per packet report header, 0 for a byte stream
+ */
+void PIOS_USB_BulkRx_Init(struct pios_usb_bulk_rx *rx, uint8_t *buf, uint16_t size, uint8_t header_len)
+{
+    PIOS_Assert(rx);
+    PIOS_Assert(buf);
+    PIOS_Assert(size > header_len);
+
+    rx->buf        = buf;
+    rx->size       = size;
+    rx->header_len = header_len;
+
+    rx->bytes      = 0;
+    rx->transfers  = 0;
+    rx->dropped    = 0;
+    rx->oversize   = 0;
+}
+
+/**
+ * COM layer headroom needed before the endpoint may be armed
+ */
+uint16_t PIOS_USB_BulkRx_MaxPayload(const struct pios_usb_bulk_rx *rx)
+{
+    return rx->size - rx->header_len;
+}
+
+/**
+ * Hand a completed receive transfer to the COM layer
+ * \param[in] len number of bytes the endpoint received
+ * \param[out] need_yield set when a task has been woken, never cleared
+ * \return true when there is room for another transfer and the endpoint
+ * should be armed again, false to apply backpressure
+ */
+bool PIOS_USB_BulkRx_Done(struct pios_usb_bulk_rx *rx, uint16_t len, pios_com_callback rx_in_cb, uint32_t context, bool *need_yield)
+{
+    if (!rx_in_cb) {
+        /* Nobody is listening, leave the receiver disabled */
+        return false;
+    }
+
+    if (len > rx->size) {
+        rx->oversize++;
+        len = rx->size;
+    }
+
+    uint8_t *payload = &rx->buf[rx->header_len];
+    uint16_t payload_len;
+
+    if (rx->header_len == 0) {
+        payload_len = len;
+    } else if (rx->header_len == 1) {
+        payload_len = (len > 1) ? len - 1 : 0;
+    } else {
+        /* Length byte from the host, never trust it beyond the buffer */
+        payload_len = (len > rx->header_len) ? rx->buf[1] : 0;
+        if (payload_len > len - rx->header_len) {
+            rx->oversize++;
+            payload_len = len - rx->header_len;
+        }
+    }
+
+    rx->transfers++;
+
+    uint16_t headroom = 0;
+    bool yield = false;
+    uint16_t accepted = (rx_in_cb)(context, payload, payload_len, &headroom, &yield);
+    if (yield) {
+        *need_yield = true;
+    }
+
+    rx->bytes += accepted;
+    if (accepted < payload_len) {
+        rx->dropped += payload_len - accepted;
+    }
+
+    return headroom >= PIOS_USB_BulkRx_MaxPayload(rx);
+}
+
+/**
+ * Collect the counters of both directions, either may be NULL
+ */
+void PIOS_USB_Bulk_GetStats(const struct pios_usb_bulk_tx *tx, const struct pios_usb_bulk_rx *rx, struct pios_usb_bulk_stats *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+    if (tx) {
+        stats->tx_bytes     = tx->bytes;
+        stats->tx_transfers = tx->transfers;
+        stats->tx_packets   = tx->packets;
+        stats->tx_zlps      = tx->zlps;
+    }
+    if (rx) {
+        stats->rx_bytes     = rx->bytes;
+        stats->rx_transfers = rx->transfers;
+        stats->rx_dropped   = rx->dropped;
+        stats->rx_oversize  = rx->oversize;
+    }
+}
+
+#endif /* PIOS_INCLUDE_USB_CDC || PIOS_INCLUDE_USB_HID */
+
+/**
+ * @}
+ * @}
+ */
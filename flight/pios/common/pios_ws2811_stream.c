@@ -0,0 +1,148 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_WS2811 WS2811 Functions
+ * @brief Hardware independent bit expansion for the ws2811 driver
+ * @{
+ *
+ * @file       pios_ws2811_stream.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Expands led colors into a small ping-pong DMA buffer.
+ * @see        The GNU Public License (GPL) Version 3
+ * @notes
+ *
+ * Every bit sent to the strip takes one DMA word, expanding the whole strip
+ * up front costs 48 bytes of RAM per led. Here only two halves of a few
+ * leds each are expanded at a time, the driver calls in from the half and
+ * full transfer interrupts to have the finished half refilled.
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <pios.h>
+
+#ifdef PIOS_INCLUDE_WS2811
+
+#include <pios_ws2811_stream.h>
+
+/**
+ * Expand one color byte, most significant bit first
+ */
+void PIOS_WS2811_EncodeByte(ledbuf_t *buf, uint8_t value, ledbuf_t zero_bit)
+{
+    for (uint8_t i = 0; i < 8; i++) {
+        buf[i] = (value & (0x80 >> i)) ? 0 : zero_bit;
+    }
+}
+
+static void PIOS_WS2811_Stream_Fill(struct pios_ws2811_stream *stream, uint8_t half)
+{
+    const uint16_t half_words = stream->half_leds * PIOS_WS2811_BITS_PER_LED;
+    ledbuf_t *buf = &stream->buf[half * half_words];
+    uint16_t words = 0;
+
+    if (stream->next_led < stream->numleds) {
+        uint16_t leds = stream->numleds - stream->next_led;
+        if (leds > stream->half_leds) {
+            leds = stream->half_leds;
+        }
+
+        const uint8_t *src = &stream->grb[stream->next_led * PIOS_WS2811_BYTES_PER_LED];
+        for (uint16_t i = 0; i < leds * PIOS_WS2811_BYTES_PER_LED; i++) {
+            PIOS_WS2811_EncodeByte(&buf[words], src[i], stream->zero_bit);
+            words += 8;
+        }
+
+        stream->next_led += leds;
+        stream->halves_left++;
+    }
+
+    /*
+     * Past the end of the strip, and whatever the stream gets to send
+     * before the timer is stopped, goes out as zero bits.
+     */
+    while (words < half_words) {
+        buf[words++] = stream->zero_bit;
+    }
+}
+
+/**
+ * Attach the color storage and the DMA buffer
+ * \param[in] grb PIOS_WS2811_BYTES_PER_LED bytes per led, read while sending
+ * \param[in] half_leds leds expanded per half of buf
+ * \param[in] zero_bit word that ends the high time early
+ */
+void PIOS_WS2811_Stream_Init(struct pios_ws2811_stream *stream, const uint8_t *grb, uint16_t numleds, ledbuf_t *buf, uint8_t half_leds, ledbuf_t zero_bit)
+{
+    PIOS_Assert(stream);
+    PIOS_Assert(grb && buf);
+    PIOS_Assert(half_leds > 0);
+
+    stream->grb         = grb;
+    stream->numleds     = numleds;
+    stream->buf         = buf;
+    stream->half_leds   = half_leds;
+    stream->zero_bit    = zero_bit;
+
+    stream->next_led    = 0;
+    stream->next_half   = 0;
+    stream->halves_left = 0;
+}
+
+/**
+ * Expand the start of the strip into both halves, with the DMA stream stopped
+ * \return true when there is something to send
+ */
+bool PIOS_WS2811_Stream_Start(struct pios_ws2811_stream *stream)
+{
+    stream->next_led    = 0;
+    stream->next_half   = 0;
+    stream->halves_left = 0;
+
+    PIOS_WS2811_Stream_Fill(stream, 0);
+    PIOS_WS2811_Stream_Fill(stream, 1);
+
+    return stream->halves_left > 0;
+}
+
+/**
+ * Called each time the DMA stream has finished a half of the buffer
+ * \return false when the last led has been sent and the timer must be stopped
+ */
+bool PIOS_WS2811_Stream_HalfDone(struct pios_ws2811_stream *stream)
+{
+    if (stream->halves_left > 0) {
+        stream->halves_left--;
+    }
+    if (stream->halves_left == 0) {
+        return false;
+    }
+
+    /* The stream moved on to the other half, this one is free */
+    PIOS_WS2811_Stream_Fill(stream, stream->next_half);
+    stream->next_half ^= 1;
+
+    return true;
+}
+
+#endif /* PIOS_INCLUDE_WS2811 */
+
+/**
+ * @}
+ * @}
+ */
@@ -31,11 +31,25 @@
 #ifndef PIOS_ADC_H
 #define PIOS_ADC_H
 
+#include <pios_adc_filter.h>
+
 // Maximum of 50 oversampled points
 #define PIOS_ADC_MAX_SAMPLES ((((PIOS_ADC_NUM_CHANNELS + PIOS_ADC_USE_ADC2) >> PIOS_ADC_USE_ADC2) << PIOS_ADC_USE_ADC2) * PIOS_ADC_MAX_OVERSAMPLING * 2 / 2)
 
 typedef void (*ADCCallback)(float *data);
 
+struct pios_adc_sample {
+    float    value;     /* Filtered, in ADC counts */
+    uint32_t timestamp; /* PIOS_DELAY_GetuS() of the DMA buffer completing it */
+    uint32_t count;     /* Values published since the filter was configured */
+};
+
+struct pios_adc_stats {
+    uint32_t blocks;      /* DMA buffers processed */
+    uint32_t last_cycles; /* CPU cycles spent on the last buffer */
+    uint32_t max_cycles;
+};
+
 /* Public Functions */
 void PIOS_ADC_Config(uint32_t oversampling);
 int32_t PIOS_ADC_PinGet(uint32_t pin);
@@ -47,6 +61,9 @@ void PIOS_ADC_SetCallback(ADCCallback new_function);
 void PIOS_ADC_SetQueue(xQueueHandle data_queue);
 #endif
 extern void PIOS_ADC_DMA_Handler(void);
+int32_t PIOS_ADC_PinConfigFilter(uint32_t pin, const struct pios_adc_filter_cfg *cfg);
+int32_t PIOS_ADC_PinGetFiltered(uint32_t pin, struct pios_adc_sample *sample);
+void PIOS_ADC_GetStats(struct pios_adc_stats *stats);
 
 #endif /* PIOS_ADC_H */
 
@@ -0,0 +1,82 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_ADC ADC Functions
+ * @{
+ *
+ * @file       pios_adc_filter.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Per channel decimation and smoothing of ADC samples.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_ADC_FILTER_H
+#define PIOS_ADC_FILTER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Width of the raw samples */
+#define PIOS_ADC_FILTER_INPUT_BITS 12
+/* Fractional bits of the published values, in ADC counts */
+#define PIOS_ADC_FILTER_FRAC_BITS  8
+#define PIOS_ADC_FILTER_MAX_ORDER  3
+
+enum pios_adc_filter_decimation {
+    PIOS_ADC_FILTER_BOXCAR = 0, /* Average of each block of ratio samples */
+    PIOS_ADC_FILTER_CIC,        /* order boxcars in series, decimated by ratio */
+};
+
+struct pios_adc_filter_cfg {
+    uint16_t ratio;      /* Input samples per output, 0 disables the channel */
+    uint8_t  decimation; /* enum pios_adc_filter_decimation */
+    uint8_t  order;      /* CIC stages, ignored for the boxcar */
+    uint8_t  iir_shift;  /* Smoothing y += (x - y) / 2^iir_shift after decimation, 0 for none */
+};
+
+/*
+ * The CIC runs on wrapping 32 bit registers, which is exact as long as
+ * ratio^order * 2^PIOS_ADC_FILTER_INPUT_BITS fits. Every input sample
+ * costs one add per stage, combs, scaling and smoothing only run once per
+ * output.
+ */
+struct pios_adc_filter {
+    struct pios_adc_filter_cfg cfg;
+    uint32_t gain;
+    uint32_t integrator[PIOS_ADC_FILTER_MAX_ORDER];
+    uint32_t comb[PIOS_ADC_FILTER_MAX_ORDER];
+    uint16_t phase;   /* Input samples into the current output */
+    uint8_t  settle;  /* Outputs still to be discarded after a reset */
+    int32_t  iir;     /* PIOS_ADC_FILTER_FRAC_BITS + 8 fractional bits */
+
+    uint32_t value;   /* Latest output, PIOS_ADC_FILTER_FRAC_BITS fractional bits */
+    uint32_t timestamp;
+    uint32_t count;   /* Outputs published */
+};
+
+extern int32_t PIOS_ADC_Filter_Init(struct pios_adc_filter *filter, const struct pios_adc_filter_cfg *cfg);
+extern bool PIOS_ADC_Filter_Process(struct pios_adc_filter *filter, const uint16_t *samples, uint16_t count, uint16_t stride, uint32_t timestamp);
+
+#endif /* PIOS_ADC_FILTER_H */
+
+/**
+ * @}
+ * @}
+ */
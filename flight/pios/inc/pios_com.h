@@ -46,6 +46,15 @@ struct pios_com_driver {
     bool (*available)(uint32_t id);
 };
 
+/* Room in the transmit buffer of a port, handed out by PIOS_COM_ReserveBuffer().
+ * The buffer is a ring, so the room goes on at second once first_len bytes are
+ * written at first. */
+struct pios_com_span {
+    uint8_t  *first;
+    uint16_t first_len;
+    uint8_t  *second;
+};
+
 /* Public Functions */
 extern int32_t PIOS_COM_ChangeBaud(uint32_t com_id, uint32_t baud);
 extern int32_t PIOS_COM_SendCharNonBlocking(uint32_t com_id, char c);
@@ -56,6 +65,8 @@ extern int32_t PIOS_COM_SendStringNonBlocking(uint32_t com_id, const char *str);
 extern int32_t PIOS_COM_SendString(uint32_t com_id, const char *str);
 extern int32_t PIOS_COM_SendFormattedStringNonBlocking(uint32_t com_id, const char *format, ...);
 extern int32_t PIOS_COM_SendFormattedString(uint32_t com_id, const char *format, ...);
+extern int32_t PIOS_COM_ReserveBuffer(uint32_t com_id, uint16_t len, struct pios_com_span *span, uint32_t timeout_ms);
+extern int32_t PIOS_COM_CommitBuffer(uint32_t com_id, uint16_t len);
 extern uint16_t PIOS_COM_ReceiveBuffer(uint32_t com_id, uint8_t *buf, uint16_t buf_len, uint32_t timeout_ms);
 extern bool PIOS_COM_Available(uint32_t com_id);
 
@@ -28,6 +28,7 @@
 #define PIOS_FLASH_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
 struct pios_flash_chunk {
     uint8_t  *addr;
@@ -42,6 +43,11 @@ struct pios_flash_driver {
     int32_t (*write_data)(uintptr_t flash_id, uint32_t addr, uint8_t *data, uint16_t len);
     int32_t (*write_chunks)(uintptr_t flash_id, uint32_t addr, struct pios_flash_chunk chunks[], uint32_t num_chunks);
     int32_t (*read_data)(uintptr_t flash_id, uint32_t addr, uint8_t *data, uint16_t len);
+
+    /* Optional, non-blocking erase. erase_sector_start returns as soon as the
+     * erase is running, poll returns 0 once it has finished, 1 while it is busy */
+    int32_t (*erase_sector_start)(uintptr_t flash_id, uint32_t addr);
+    int32_t (*poll)(uintptr_t flash_id, bool wait);
 };
 
 #endif /* PIOS_FLASH_H */
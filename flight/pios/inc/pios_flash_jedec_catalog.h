@@ -41,6 +41,7 @@ const struct pios_flash_jedec_cfg pios_flash_jedec_catalog[] =
         .expect_memorytype   = 0x20,
         .expect_capacity     = 0x15,
         .sector_erase = 0xD8,
+        .sector_size  = 0x10000,
         .chip_erase   = 0xC7,
         .fast_read    = 0x0B,
         .fast_read_dummy_bytes = 1,
@@ -50,6 +51,7 @@ const struct pios_flash_jedec_cfg pios_flash_jedec_catalog[] =
         .expect_memorytype   = 0x71,
         .expect_capacity     = 0x15,
         .sector_erase = 0xD8,
+        .sector_size  = 0x10000,
         .chip_erase   = 0xC7,
         .fast_read    = 0x0B,
         .fast_read_dummy_bytes = 1,
@@ -59,6 +61,7 @@ const struct pios_flash_jedec_cfg pios_flash_jedec_catalog[] =
         .expect_memorytype   = 0x30,
         .expect_capacity     = 0x13,
         .sector_erase = 0x20,
+        .sector_size  = 0x1000,
         .chip_erase   = 0x60,
         .fast_read    = 0x0B,
         .fast_read_dummy_bytes = 1,
@@ -68,36 +71,48 @@ const struct pios_flash_jedec_cfg pios_flash_jedec_catalog[] =
         .expect_memorytype   = 0x40,
         .expect_capacity     = 0x15,
         .sector_erase = 0x20,
+        .sector_size  = 0x1000,
         .chip_erase   = 0x60,
         .fast_read    = 0x0B,
         .fast_read_dummy_bytes = 1,
+        .erase_suspend = 0x75,
+        .erase_resume  = 0x7A,
     },
     { // 25q512
         .expect_manufacturer = JEDEC_MANUFACTURER_MICRON,
         .expect_memorytype   = 0xBA,
         .expect_capacity     = 0x20,
         .sector_erase = 0xD8,
+        .sector_size  = 0x10000,
         .chip_erase   = 0xC7,
         .fast_read    = 0x0B,
         .fast_read_dummy_bytes = 1,
+        .erase_suspend = 0x75,
+        .erase_resume  = 0x7A,
     },
     { // 25q256
         .expect_manufacturer = JEDEC_MANUFACTURER_NUMORIX,
         .expect_memorytype   = 0xBA,
         .expect_capacity     = 0x19,
         .sector_erase = 0xD8,
+        .sector_size  = 0x10000,
         .chip_erase   = 0xC7,
         .fast_read    = 0x0B,
         .fast_read_dummy_bytes = 1,
+        .erase_suspend = 0x75,
+        .erase_resume  = 0x7A,
     },
     { // 25q128
         .expect_manufacturer = JEDEC_MANUFACTURER_MICRON,
         .expect_memorytype   = 0xBA,
         .expect_capacity     = 0x18,
         .sector_erase = 0xD8,
+        .sector_size  = 0x10000,
         .chip_erase   = 0xC7,
         .fast_read    = 0x0B,
         .fast_read_dummy_bytes = 1,
+        .erase_suspend = 0x75,
+        .erase_resume  = 0x7A,
     },
 };
 const uint32_t pios_flash_jedec_catalog_size = NELEMENTS(pios_flash_jedec_catalog);
@@ -46,9 +46,12 @@ struct pios_flash_jedec_cfg {
     uint8_t expect_memorytype;
     uint8_t expect_capacity;
     uint8_t sector_erase;
+    uint32_t sector_size; /* Bytes erased by sector_erase */
     uint8_t chip_erase;
     uint8_t fast_read;
     uint8_t fast_read_dummy_bytes;
+    uint8_t erase_suspend; /* 0 if reads and programs have to wait for a sector erase */
+    uint8_t erase_resume;
 };
 
 int32_t PIOS_Flash_Jedec_Init(uintptr_t *flash_id, uint32_t spi_id, uint32_t slave_num);
@@ -48,6 +48,33 @@ struct pios_i2c_txn {
     uint8_t    *buf;
 };
 
+/* Result of a request that has not completed yet */
+#define PIOS_I2C_REQUEST_PENDING 1
+
+struct pios_i2c_request;
+
+/*
+ * Completion callback. Called from interrupt context, or from the FreeRTOS
+ * timer task when the request is aborted on timeout. Must not block, use the
+ * FromISR API only.
+ */
+typedef void (*pios_i2c_request_callback)(struct pios_i2c_request *req, bool *woken);
+
+/*
+ * A list of transactions executed back to back with repeated starts.
+ * Owned by the driver from PIOS_I2C_QueueTransfer() until the callback.
+ */
+struct pios_i2c_request {
+    const struct pios_i2c_txn *txn_list;
+    uint32_t num_txns;
+    pios_i2c_request_callback callback;
+    void     *context;
+    volatile int32_t result; /* PIOS_I2C_REQUEST_PENDING, 0 on success, < 0 as for PIOS_I2C_Transfer() */
+
+    /* Private */
+    struct pios_i2c_request *next;
+};
+
 #define I2C_LOG_DEPTH 20
 enum pios_i2c_error_type {
     PIOS_I2C_ERROR_EVENT,
@@ -66,9 +93,11 @@ struct pios_i2c_fault_history {
 /* Public Functions */
 extern int32_t PIOS_I2C_Transfer(uint32_t i2c_id, const struct pios_i2c_txn txn_list[], uint32_t num_txns);
 extern int32_t PIOS_I2C_Transfer_Callback(uint32_t i2c_id, const struct pios_i2c_txn txn_list[], uint32_t num_txns, void *callback);
+extern int32_t PIOS_I2C_QueueTransfer(uint32_t i2c_id, struct pios_i2c_request *req);
 extern void PIOS_I2C_EV_IRQ_Handler(uint32_t i2c_id);
 extern void PIOS_I2C_ER_IRQ_Handler(uint32_t i2c_id);
 extern void PIOS_I2C_IRQ_Handler(uint32_t i2c_id);
+extern void PIOS_I2C_DMA_IRQ_Handler(uint32_t i2c_id);
 extern void PIOS_I2C_GetDiagnostics(struct pios_i2c_fault_history *data, uint8_t *error_counts);
 
 #endif /* PIOS_I2C_H */
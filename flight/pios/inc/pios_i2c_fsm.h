@@ -0,0 +1,189 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_I2C I2C Functions
+ * @{
+ *
+ * @file       pios_i2c_fsm.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Hardware independent I2C master state machine and request queue.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_I2C_FSM_H
+#define PIOS_I2C_FSM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pios_i2c.h>
+
+enum pios_i2c_fsm_state {
+    I2C_STATE_FSM_FAULT = 0, /* Must be zero so undefined transitions land here */
+
+    I2C_STATE_BUS_ERROR,
+
+    I2C_STATE_STOPPED,
+    I2C_STATE_STOPPING,
+    I2C_STATE_STARTING,
+
+    I2C_STATE_R_MORE_TXN_ADDR,
+    I2C_STATE_R_MORE_TXN_PRE_ONE,
+    I2C_STATE_R_MORE_TXN_PRE_FIRST,
+    I2C_STATE_R_MORE_TXN_PRE_MIDDLE,
+    I2C_STATE_R_MORE_TXN_PRE_LAST,
+    I2C_STATE_R_MORE_TXN_POST_LAST,
+    I2C_STATE_R_MORE_TXN_DMA,
+    I2C_STATE_R_MORE_TXN_DMA_DONE,
+
+    I2C_STATE_R_LAST_TXN_ADDR,
+    I2C_STATE_R_LAST_TXN_PRE_ONE,
+    I2C_STATE_R_LAST_TXN_PRE_FIRST,
+    I2C_STATE_R_LAST_TXN_PRE_MIDDLE,
+    I2C_STATE_R_LAST_TXN_PRE_LAST,
+    I2C_STATE_R_LAST_TXN_POST_LAST,
+    I2C_STATE_R_LAST_TXN_DMA,
+    I2C_STATE_R_LAST_TXN_DMA_DONE,
+
+    I2C_STATE_W_MORE_TXN_ADDR,
+    I2C_STATE_W_MORE_TXN_MIDDLE,
+    I2C_STATE_W_MORE_TXN_LAST,
+    I2C_STATE_W_MORE_TXN_DMA,
+    I2C_STATE_W_MORE_TXN_DMA_DONE,
+
+    I2C_STATE_W_LAST_TXN_ADDR,
+    I2C_STATE_W_LAST_TXN_MIDDLE,
+    I2C_STATE_W_LAST_TXN_LAST,
+    I2C_STATE_W_LAST_TXN_DMA,
+    I2C_STATE_W_LAST_TXN_DMA_DONE,
+
+    I2C_STATE_NACK,
+
+    I2C_STATE_NUM_STATES /* Must be last */
+};
+
+enum pios_i2c_fsm_event {
+    I2C_EVENT_BUS_ERROR,
+    I2C_EVENT_START,
+    I2C_EVENT_STARTED_MORE_TXN_READ,
+    I2C_EVENT_STARTED_MORE_TXN_WRITE,
+    I2C_EVENT_STARTED_LAST_TXN_READ,
+    I2C_EVENT_STARTED_LAST_TXN_WRITE,
+    I2C_EVENT_ADDR_SENT_LEN_EQ_0,
+    I2C_EVENT_ADDR_SENT_LEN_EQ_1,
+    I2C_EVENT_ADDR_SENT_LEN_EQ_2,
+    I2C_EVENT_ADDR_SENT_LEN_GT_2,
+    I2C_EVENT_ADDR_SENT_DMA,
+    I2C_EVENT_TRANSFER_DONE_LEN_EQ_0,
+    I2C_EVENT_TRANSFER_DONE_LEN_EQ_1,
+    I2C_EVENT_TRANSFER_DONE_LEN_EQ_2,
+    I2C_EVENT_TRANSFER_DONE_LEN_GT_2,
+    I2C_EVENT_DMA_DONE,
+    I2C_EVENT_NACK,
+    I2C_EVENT_STOPPED,
+    I2C_EVENT_AUTO, /* FIXME: remove this */
+
+    I2C_EVENT_NUM_EVENTS /* Must be last */
+};
+
+/* Interrupt sources for the irq_config hook */
+#define PIOS_I2C_FSM_IRQ_EVT       0x01
+#define PIOS_I2C_FSM_IRQ_BUF       0x02
+#define PIOS_I2C_FSM_IRQ_ERR       0x04
+#define PIOS_I2C_FSM_IRQ_ALL       (PIOS_I2C_FSM_IRQ_EVT | PIOS_I2C_FSM_IRQ_BUF | PIOS_I2C_FSM_IRQ_ERR)
+
+/* Directions that may be moved by DMA, passed to PIOS_I2C_FSM_Init() */
+#define PIOS_I2C_FSM_DMA_READ      0x01
+#define PIOS_I2C_FSM_DMA_WRITE     0x02
+
+/*
+ * Hooks into the low level driver. They are called from the state machine,
+ * mostly from interrupt context, and must not block.
+ */
+struct pios_i2c_fsm_driver {
+    /* Enable exactly the given PIOS_I2C_FSM_IRQ_* sources */
+    void    (*irq_config)(uint32_t i2c_id, uint8_t irqs);
+    void    (*ack)(uint32_t i2c_id, bool enable);
+    void    (*start)(uint32_t i2c_id);
+    void    (*stop)(uint32_t i2c_id);
+    void    (*send_address)(uint32_t i2c_id, uint16_t addr, enum pios_i2c_txn_direction rw);
+    void    (*send_byte)(uint32_t i2c_id, uint8_t byte);
+    uint8_t (*receive_byte)(uint32_t i2c_id);
+    /* Bounded wait for the stop condition to go out, false if it never did */
+    bool    (*wait_stopped)(uint32_t i2c_id);
+    /* Clock out a stuck slave and reinitialise the peripheral */
+    void    (*reset_bus)(uint32_t i2c_id);
+    /* Only needed when DMA is enabled. Reads must NACK the last byte on their own. */
+    void    (*dma_start)(uint32_t i2c_id, enum pios_i2c_txn_direction rw, uint8_t *buf, uint32_t len);
+    void    (*dma_stop)(uint32_t i2c_id);
+    /* Optional, diagnostics only */
+    void    (*log_fault)(uint32_t i2c_id, enum pios_i2c_error_type type);
+};
+
+struct pios_i2c_fsm {
+    const struct pios_i2c_fsm_driver *driver;
+    uint32_t i2c_id;
+    uint8_t  dma;
+
+    volatile enum pios_i2c_fsm_state curr_state;
+    const struct pios_i2c_txn *first_txn;
+    const struct pios_i2c_txn *active_txn;
+    const struct pios_i2c_txn *last_txn;
+    uint8_t  *active_byte;
+    uint8_t  *last_byte;
+    bool     bus_error;
+    bool     nack;
+
+    /* Request queue, head is the request on the bus while running */
+    struct pios_i2c_request *head;
+    struct pios_i2c_request *tail;
+    volatile bool running;
+    uint32_t started_us;
+
+    uint32_t completed;
+    uint32_t failed;
+    uint32_t timeouts;
+
+#if defined(PIOS_I2C_DIAGNOSTICS)
+    uint8_t  state_history[I2C_LOG_DEPTH];
+    uint8_t  state_history_pointer;
+    uint8_t  event_history[I2C_LOG_DEPTH];
+    uint8_t  event_history_pointer;
+#endif
+};
+
+extern void PIOS_I2C_FSM_Init(struct pios_i2c_fsm *fsm, const struct pios_i2c_fsm_driver *driver, uint32_t i2c_id, uint8_t dma);
+extern int32_t PIOS_I2C_FSM_Submit(struct pios_i2c_fsm *fsm, struct pios_i2c_request *req, bool *woken);
+extern bool PIOS_I2C_FSM_CheckTimeout(struct pios_i2c_fsm *fsm, uint32_t timeout_us, bool *woken);
+extern bool PIOS_I2C_FSM_Running(struct pios_i2c_fsm *fsm);
+
+/* Hardware events, reported by the low level driver */
+extern void PIOS_I2C_FSM_Started(struct pios_i2c_fsm *fsm, bool *woken);
+extern void PIOS_I2C_FSM_AddrSent(struct pios_i2c_fsm *fsm, bool *woken);
+extern void PIOS_I2C_FSM_TransferDone(struct pios_i2c_fsm *fsm, bool *woken);
+extern void PIOS_I2C_FSM_DMADone(struct pios_i2c_fsm *fsm, bool *woken);
+extern void PIOS_I2C_FSM_Nack(struct pios_i2c_fsm *fsm, bool *woken);
+extern void PIOS_I2C_FSM_BusError(struct pios_i2c_fsm *fsm, bool *woken);
+
+#endif /* PIOS_I2C_FSM_H */
+
+/**
+ * @}
+ * @}
+ */
@@ -29,6 +29,12 @@
 #include <pios.h>
 #include <pios_stm32.h>
 #include <stdbool.h>
+#if defined(STM32F4XX)
+#include <pios_i2c_fsm.h>
+#ifdef PIOS_INCLUDE_FREERTOS
+#include <timers.h>
+#endif
+#endif
 
 struct pios_i2c_adapter_cfg {
     I2C_TypeDef       *regs;
@@ -40,6 +46,9 @@ struct pios_i2c_adapter_cfg {
     struct stm32_gpio sda;
     struct stm32_irq  event;
     struct stm32_irq  error;
+
+    /* Optional, rx and/or tx channel may be left out. Only the rx stream interrupt is used. */
+    const struct stm32_dma *dma;
 };
 
 enum pios_i2c_adapter_magic {
@@ -56,6 +65,14 @@ struct pios_i2c_adapter {
     uint8_t busy;
 #endif
 
+#if defined(STM32F4XX)
+    struct pios_i2c_fsm fsm;
+    struct pios_i2c_request callback_req;
+    void    (*callback)();
+#ifdef PIOS_INCLUDE_FREERTOS
+    TimerHandle_t timeout_timer;
+#endif
+#else
     /* variables for transfer timeouts */
     uint32_t transfer_delay_uS; // approx time to transfer one byte, calculated later basen on setting use here time based on 100 kbits/s
     uint32_t transfer_timeout_ticks; // take something tha makes sense for small transaction, calculated later based upon transmission desired
@@ -72,6 +89,7 @@ struct pios_i2c_adapter {
 
     uint8_t *active_byte;
     uint8_t *last_byte;
+#endif /* defined(STM32F4XX) */
 };
 
 int32_t PIOS_I2C_Init(uint32_t *i2c_id, const struct pios_i2c_adapter_cfg *cfg);
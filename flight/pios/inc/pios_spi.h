@@ -42,6 +42,39 @@ typedef enum {
     PIOS_SPI_PRESCALER_256 = 7
 } SPIPrescalerTypeDef;
 
+/*
+ * Queued transactions.
+ *
+ * A transaction is a list of segments transferred back to back with the slave
+ * selected for the whole list. Transactions are owned by the caller and must
+ * stay valid until their callback has run (or result != PIOS_SPI_TXN_PENDING).
+ */
+#define PIOS_SPI_TXN_PENDING 1
+
+struct pios_spi_txn;
+
+typedef void (*pios_spi_txn_callback)(struct pios_spi_txn *txn, bool *woken);
+
+struct pios_spi_segment {
+    const uint8_t *send_buffer; /* NULL sends 0xFF */
+    uint8_t *receive_buffer; /* NULL discards received bytes */
+    uint16_t len;
+};
+
+struct pios_spi_txn {
+    uint32_t slave_id;
+    const struct pios_spi_segment *segments;
+    uint8_t num_segments;
+    SPIPrescalerTypeDef prescaler; /* Clock of the whole transaction */
+    pios_spi_txn_callback callback; /* Called from interrupt context, may be NULL */
+    void    *context;
+    volatile int32_t result; /* PIOS_SPI_TXN_PENDING, 0 on success, < 0 on error */
+
+    /* Private, only touched by the bus queue */
+    uint8_t segment;
+    struct pios_spi_txn *next;
+};
+
 /* Public Functions */
 extern int32_t PIOS_SPI_SetClockSpeed(uint32_t spi_id, SPIPrescalerTypeDef spi_prescaler);
 extern int32_t PIOS_SPI_RC_PinSet(uint32_t spi_id, uint32_t slave_id, uint8_t pin_value);
@@ -54,6 +87,8 @@ extern int32_t PIOS_SPI_ReleaseBus(uint32_t spi_id);
 extern int32_t PIOS_SPI_ReleaseBusISR(uint32_t spi_id, bool *woken);
 extern void    PIOS_SPI_IRQ_Handler(uint32_t spi_id);
 extern void    PIOS_SPI_SetPrescalar(uint32_t spi_id, uint32_t prescalar);
+extern int32_t PIOS_SPI_QueueTransaction(uint32_t spi_id, struct pios_spi_txn *txn);
+extern int32_t PIOS_SPI_Transaction(uint32_t spi_id, struct pios_spi_txn *txn);
 
 #endif /* PIOS_SPI_H */
 
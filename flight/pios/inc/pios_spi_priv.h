@@ -33,6 +33,7 @@
 
 #include <pios.h>
 #include <pios_stm32.h>
+#include <pios_spi_queue.h>
 
 struct pios_spi_cfg {
     SPI_TypeDef       *regs;
@@ -54,9 +55,14 @@ struct pios_spi_dev {
     uint8_t rx_dummy_byte;
 #if defined(PIOS_INCLUDE_FREERTOS)
     xSemaphoreHandle busy;
+    xSemaphoreHandle dma_done;
+    xSemaphoreHandle txn_lock;
+    xSemaphoreHandle txn_done;
 #else
     uint8_t busy;
 #endif
+    struct pios_spi_queue queue;
+    volatile bool queue_transfer;
 };
 
 extern int32_t PIOS_SPI_Init(uint32_t *spi_id, const struct pios_spi_cfg *cfg);
@@ -0,0 +1,73 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_SPI SPI Functions
+ * @{
+ *
+ * @file       pios_spi_queue.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Hardware independent SPI transaction queue.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_SPI_QUEUE_H
+#define PIOS_SPI_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pios_spi.h>
+
+/*
+ * Hooks into the low level driver. Every hook may be called from task or
+ * interrupt context and must not block.
+ */
+struct pios_spi_queue_driver {
+    /* Take the bus without blocking, returns false if somebody else owns it */
+    bool (*claim)(uint32_t spi_id, bool *woken);
+    void (*release)(uint32_t spi_id, bool *woken);
+    /* Called with no slave selected, before each transaction */
+    void (*set_speed)(uint32_t spi_id, SPIPrescalerTypeDef prescaler);
+    void (*select)(uint32_t spi_id, uint32_t slave_id, bool selected);
+    /* Start the segment, the driver calls PIOS_SPI_Queue_SegmentDone() when it has finished */
+    void (*start)(uint32_t spi_id, const struct pios_spi_segment *segment);
+};
+
+struct pios_spi_queue {
+    const struct pios_spi_queue_driver *driver;
+    uint32_t spi_id;
+    struct pios_spi_txn *head; /* Active transaction while running */
+    struct pios_spi_txn *tail;
+    volatile bool running;
+    uint32_t completed;
+    uint32_t failed;
+};
+
+extern void PIOS_SPI_Queue_Init(struct pios_spi_queue *queue, const struct pios_spi_queue_driver *driver, uint32_t spi_id);
+extern int32_t PIOS_SPI_Queue_Submit(struct pios_spi_queue *queue, struct pios_spi_txn *txn, bool *woken);
+extern void PIOS_SPI_Queue_Kick(struct pios_spi_queue *queue, bool *woken);
+extern void PIOS_SPI_Queue_SegmentDone(struct pios_spi_queue *queue, int32_t result, bool *woken);
+extern bool PIOS_SPI_Queue_Running(struct pios_spi_queue *queue);
+
+#endif /* PIOS_SPI_QUEUE_H */
+
+/**
+ * @}
+ * @}
+ */
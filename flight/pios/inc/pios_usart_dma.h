@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_USART USART Functions
+ * @{
+ *
+ * @file       pios_usart_dma.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Hardware independent bookkeeping for DMA driven USARTs.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_USART_DMA_H
+#define PIOS_USART_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pios_com.h>
+
+/*
+ * Receive side. The DMA stream writes into buf in circular mode, the
+ * driver drains everything between tail and the stream's write position
+ * on the half transfer, transfer complete and line idle interrupts.
+ */
+struct pios_usart_rx_ring {
+    uint8_t  *buf;
+    uint16_t size;
+    uint16_t tail;    /* Next byte to be handed to the COM layer */
+    uint32_t dropped; /* Bytes the COM layer had no room for */
+};
+
+/*
+ * Transmit side. Data is pulled from the COM layer into buf through the
+ * usual tx_out callback and sent by a normal mode DMA transfer.
+ */
+struct pios_usart_dma_tx {
+    uint8_t  *buf;
+    uint16_t size;
+    bool     busy;      /* A transfer is in flight */
+    uint32_t transfers;
+};
+
+extern void PIOS_USART_RxRing_Init(struct pios_usart_rx_ring *ring, uint8_t *buf, uint16_t size);
+extern uint16_t PIOS_USART_RxRing_Drain(struct pios_usart_rx_ring *ring, uint16_t remaining, pios_com_callback rx_in_cb, uint32_t context, bool *need_yield);
+
+extern void PIOS_USART_DMA_TxInit(struct pios_usart_dma_tx *tx, uint8_t *buf, uint16_t size);
+extern uint16_t PIOS_USART_DMA_TxNext(struct pios_usart_dma_tx *tx, bool done, pios_com_callback tx_out_cb, uint32_t context, bool *need_yield);
+
+#endif /* PIOS_USART_DMA_H */
+
+/**
+ * @}
+ * @}
+ */
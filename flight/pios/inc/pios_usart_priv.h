@@ -38,6 +38,22 @@
 
 extern const struct pios_com_driver pios_usart_com_driver;
 
+/*
+ * Optional DMA mode. Receive runs in circular mode on rx and is drained on
+ * its half/full transfer and the USART idle line interrupts, transmit sends
+ * chunks of up to tx_buf_len bytes. Both stream interrupts have to call
+ * PIOS_USART_DMA_IRQ_Handler() and share the priority of the USART irq.
+ */
+struct pios_usart_dma_cfg {
+    uint32_t ahb_clk; /* AHB clock for the DMA controller */
+    struct stm32_irq      rx_irq; /* .flags are cleared on every rx interrupt */
+    struct stm32_irq      tx_irq; /* .flags are cleared on every tx interrupt */
+    struct stm32_dma_chan rx;
+    struct stm32_dma_chan tx;
+    uint16_t rx_buf_len;
+    uint16_t tx_buf_len;
+};
+
 struct pios_usart_cfg {
     USART_TypeDef     *regs;
     uint32_t remap; /* GPIO_Remap_* */
@@ -45,10 +61,12 @@ struct pios_usart_cfg {
     struct stm32_gpio rx;
     struct stm32_gpio tx;
     struct stm32_irq  irq;
+    const struct pios_usart_dma_cfg *dma; /* Optional */
 };
 
 extern int32_t PIOS_USART_Init(uint32_t *usart_id, const struct pios_usart_cfg *cfg);
 extern const struct pios_usart_cfg *PIOS_USART_GetConfig(uint32_t usart_id);
+extern void PIOS_USART_DMA_IRQ_Handler(USART_TypeDef *regs);
 
 #endif /* PIOS_USART_PRIV_H */
 
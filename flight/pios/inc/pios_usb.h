@@ -38,6 +38,8 @@ extern int32_t PIOS_USB_ChangeConnectionState(bool connected);
 extern bool PIOS_USB_CableConnected(uint8_t id);
 extern bool PIOS_USB_CheckAvailable(uint32_t id);
 extern void PIOS_USB_RegisterDisconnectionCallback(void (*disconnectionCB)(void));
+extern uint32_t PIOS_USB_IRQ_Mask(uint32_t id);
+extern void PIOS_USB_IRQ_Restore(uint32_t mask);
 #endif /* PIOS_USB_H */
 
 /**
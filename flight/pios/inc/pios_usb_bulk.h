@@ -0,0 +1,106 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_USB USB Functions
+ * @{
+ *
+ * @file       pios_usb_bulk.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Hardware independent packetization between the COM layer and USB endpoints.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_USB_BULK_H
+#define PIOS_USB_BULK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pios_com.h>
+
+/* Report ID put in front of every packet when there is a packet header */
+#define PIOS_USB_BULK_REPORT_ID 1
+
+struct pios_usb_bulk_stats {
+    uint32_t tx_bytes;     /* Payload bytes taken from the COM layer */
+    uint32_t tx_transfers;
+    uint32_t tx_packets;   /* Including zero length packets */
+    uint32_t tx_zlps;
+    uint32_t rx_bytes;     /* Payload bytes accepted by the COM layer */
+    uint32_t rx_transfers;
+    uint32_t rx_dropped;
+    uint32_t rx_oversize;
+};
+
+/*
+ * Transmit side. Two transfer buffers of buf_size bytes are used in turn,
+ * the next one is filled while the other is on the bus. Transfers span as
+ * many packets as the COM layer has data for.
+ *
+ * With header_len 0 the data is a plain byte stream and a transfer that
+ * ends on a packet boundary is terminated by a zero length packet. Else
+ * every packet is a report: the report ID, for header_len 2 followed by
+ * the payload length, then the payload.
+ */
+struct pios_usb_bulk_tx {
+    uint8_t  *buf[2];
+    uint16_t len[2];
+    uint16_t buf_size;    /* Multiple of packet_size */
+    uint16_t packet_size;
+    uint8_t  header_len;
+    uint8_t  active;      /* Buffer on the bus, or the next one to go */
+    bool     busy;
+
+    uint32_t bytes;
+    uint32_t transfers;
+    uint32_t packets;
+    uint32_t zlps;
+};
+
+/*
+ * Receive side, a single transfer buffer. Only the payload is handed to
+ * the COM layer, the header is interpreted as described above.
+ */
+struct pios_usb_bulk_rx {
+    uint8_t  *buf;
+    uint16_t size;
+    uint8_t  header_len;
+
+    uint32_t bytes;
+    uint32_t transfers;
+    uint32_t dropped;
+    uint32_t oversize;
+};
+
+extern void PIOS_USB_BulkTx_Init(struct pios_usb_bulk_tx *tx, uint8_t *buf0, uint8_t *buf1, uint16_t buf_size, uint16_t packet_size, uint8_t header_len);
+extern void PIOS_USB_BulkTx_Reset(struct pios_usb_bulk_tx *tx);
+extern bool PIOS_USB_BulkTx_Next(struct pios_usb_bulk_tx *tx, bool done, pios_com_callback tx_out_cb, uint32_t context, bool *need_yield, uint8_t **buf, uint16_t *len);
+
+extern void PIOS_USB_BulkRx_Init(struct pios_usb_bulk_rx *rx, uint8_t *buf, uint16_t size, uint8_t header_len);
+extern uint16_t PIOS_USB_BulkRx_MaxPayload(const struct pios_usb_bulk_rx *rx);
+extern bool PIOS_USB_BulkRx_Done(struct pios_usb_bulk_rx *rx, uint16_t len, pios_com_callback rx_in_cb, uint32_t context, bool *need_yield);
+
+extern void PIOS_USB_Bulk_GetStats(const struct pios_usb_bulk_tx *tx, const struct pios_usb_bulk_rx *rx, struct pios_usb_bulk_stats *stats);
+
+#endif /* PIOS_USB_BULK_H */
+
+/**
+ * @}
+ * @}
+ */
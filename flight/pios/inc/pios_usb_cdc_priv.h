@@ -31,6 +31,8 @@
 #ifndef PIOS_USB_CDC_PRIV_H
 #define PIOS_USB_CDC_PRIV_H
 
+#include <pios_usb_bulk.h> /* struct pios_usb_bulk_stats */
+
 struct pios_usb_cdc_cfg {
     uint8_t ctrl_if;
     uint8_t ctrl_tx_ep;
@@ -43,6 +45,7 @@ struct pios_usb_cdc_cfg {
 extern const struct pios_com_driver pios_usb_cdc_com_driver;
 
 extern int32_t PIOS_USB_CDC_Init(uint32_t *usbcdc_id, const struct pios_usb_cdc_cfg *cfg, uint32_t lower_id);
+extern void PIOS_USB_CDC_GetStats(uint32_t usbcdc_id, struct pios_usb_bulk_stats *stats);
 
 /* From USB CDC Spec Section 6.2.14 SetControlLineState */
 #define USB_CDC_CONTROL_LINE_STATE_DTE_PRESENT 0x01
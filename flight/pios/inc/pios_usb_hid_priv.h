@@ -31,6 +31,8 @@
 #ifndef PIOS_USB_HID_PRIV_H
 #define PIOS_USB_HID_PRIV_H
 
+#include <pios_usb_bulk.h> /* struct pios_usb_bulk_stats */
+
 struct pios_usb_hid_cfg {
     uint8_t data_if;
     uint8_t data_rx_ep;
@@ -40,6 +42,7 @@ struct pios_usb_hid_cfg {
 extern const struct pios_com_driver pios_usb_hid_com_driver;
 
 extern int32_t PIOS_USB_HID_Init(uint32_t *usbhid_id, const struct pios_usb_hid_cfg *cfg, uint32_t lower_id);
+extern void PIOS_USB_HID_GetStats(uint32_t usbhid_id, struct pios_usb_bulk_stats *stats);
 
 #endif /* PIOS_USB_HID_PRIV_H */
 
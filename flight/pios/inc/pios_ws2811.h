@@ -31,7 +31,9 @@
 #include <stdint.h>
 #include <optypes.h>
 
+#ifndef PIOS_WS2811_NUMLEDS
 #define PIOS_WS2811_NUMLEDS 2
+#endif
 
 void PIOS_WS2811_setColorRGB(Color_t c, uint8_t led, bool update);
 void PIOS_WS2811_Update();
@@ -37,8 +37,13 @@
 #include <stm32f4xx_dma.h>
 #include <optypes.h>
 #include <pios_ws2811.h>
+#include <pios_ws2811_stream.h>
 
-#define PIOS_WS2811_BUFFER_SIZE        (((PIOS_WS2811_NUMLEDS) * 24))
+// leds expanded per half of the circular DMA buffer, RAM use does not depend on the strip length
+#ifndef PIOS_WS2811_STREAM_LEDS
+#define PIOS_WS2811_STREAM_LEDS        2
+#endif
+#define PIOS_WS2811_BUFFER_SIZE        (2 * (PIOS_WS2811_STREAM_LEDS) * PIOS_WS2811_BITS_PER_LED)
 #define PIOS_WS2811_MEMORYDATASIZE     DMA_MemoryDataSize_HalfWord
 #define PIOS_WS2811_PERIPHERALDATASIZE DMA_PeripheralDataSize_HalfWord
 #define PIOS_WS2811_TIM_PERIOD         20
@@ -103,8 +108,6 @@
         .DMA_Priority           = DMA_Priority_High }
 
 
-typedef uint16_t ledbuf_t;
-
 struct pios_ws2811_pin_cfg {
     GPIO_TypeDef     *gpio;
     GPIO_InitTypeDef gpioInit;
@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @addtogroup PIOS PIOS Core hardware abstraction layer
+ * @{
+ * @addtogroup   PIOS_WS2811 WS2811 Functions
+ * @{
+ *
+ * @file       pios_ws2811_stream.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Hardware independent bit expansion for the ws2811 driver.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef PIOS_WS2811_STREAM_H
+#define PIOS_WS2811_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* One DMA word per bit, written to the pin's reset register */
+typedef uint16_t ledbuf_t;
+
+#define PIOS_WS2811_BYTES_PER_LED 3
+#define PIOS_WS2811_BITS_PER_LED  (PIOS_WS2811_BYTES_PER_LED * 8)
+
+/*
+ * Colors are kept as three bytes per led in wire order (G, R, B) and only
+ * expanded to DMA words just before they are sent. The DMA stream runs
+ * circular over two halves of half_leds leds each, the half it has just
+ * finished is refilled while the other one is on the wire.
+ */
+struct pios_ws2811_stream {
+    const uint8_t *grb;
+    uint16_t numleds;
+
+    ledbuf_t *buf;        /* 2 * half_leds * PIOS_WS2811_BITS_PER_LED words */
+    uint8_t  half_leds;
+    ledbuf_t zero_bit;    /* Word that ends the high time early */
+
+    uint16_t next_led;    /* Next led to be expanded */
+    uint8_t  next_half;   /* Half to be refilled next */
+    uint8_t  halves_left; /* Halves with led data not yet sent */
+};
+
+extern void PIOS_WS2811_Stream_Init(struct pios_ws2811_stream *stream, const uint8_t *grb, uint16_t numleds, ledbuf_t *buf, uint8_t half_leds, ledbuf_t zero_bit);
+extern bool PIOS_WS2811_Stream_Start(struct pios_ws2811_stream *stream);
+extern bool PIOS_WS2811_Stream_HalfDone(struct pios_ws2811_stream *stream);
+extern void PIOS_WS2811_EncodeByte(ledbuf_t *buf, uint8_t value, ledbuf_t zero_bit);
+
+#endif /* PIOS_WS2811_STREAM_H */
+
+/**
+ * @}
+ * @}
+ */
@@ -288,7 +288,7 @@ int32_t PIOS_COM_ChangeBaud(uint32_t com_id, uint32_t baud)
  * \return -1 if port not available
  * \return -2 if non-blocking mode activated: buffer is full
  *            caller should retry until buffer is free again
- * \return 0 on success
+ * \return number of bytes transmitted on success
  */
 int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, uint16_t len)
 {
@@ -318,7 +318,7 @@ int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, u
         }
     }
 
-    return 0;
+    return bytes_into_fifo;
 }
 
 /**
@@ -328,7 +328,7 @@ int32_t PIOS_COM_SendBufferNonBlocking(uint32_t com_id, const uint8_t *buffer, u
  * \param[in] buffer character buffer
  * \param[in] len buffer length
  * \return -1 if port not available
- * \return 0 on success
+ * \return number of bytes transmitted on success
  */
 int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len)
 {
@@ -362,6 +362,92 @@ int32_t PIOS_COM_SendBuffer(uint32_t com_id, const uint8_t *buffer, uint16_t len
     return rc;
 }
 
+/**
+ * Reserves room for a package in the transmit buffer of a port, so that the
+ * caller writes it in place instead of handing over a buffer to be copied.
+ * The package is sent by PIOS_COM_CommitBuffer().
+ * \param[in] port COM port
+ * \param[in] len room needed
+ * \param[out] span where to write the package
+ * \param[in] timeout_ms how long to wait for room (0 for non-blocking)
+ * \return -1 if port not available or the package does not fit in the
+ *            buffer at all, caller should use PIOS_COM_SendBuffer()
+ * \return -2 if there is no room (retry)
+ * \return 0 on success
+ */
+int32_t PIOS_COM_ReserveBuffer(uint32_t com_id, uint16_t len, struct pios_com_span *span, uint32_t timeout_ms)
+{
+    struct pios_com_dev *com_dev = PIOS_COM_find_dev(com_id);
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+
+    PIOS_Assert(com_dev->has_tx);
+    PIOS_Assert(span);
+    PIOS_Assert(len);
+
+    if (len > fifoBuf_getSize(&com_dev->tx)) {
+        /* Has to go in fragments */
+        return -1;
+    }
+
+    while (fifoBuf_reserve(&com_dev->tx, len, &span->first, &span->first_len, &span->second) == 0) {
+        if (timeout_ms == 0) {
+            return -2;
+        }
+        /* Make sure the transmitter is running while we wait */
+        if (com_dev->driver->tx_start) {
+            (com_dev->driver->tx_start)(com_dev->lower_id,
+                                        fifoBuf_getUsed(&com_dev->tx));
+        }
+#if defined(PIOS_INCLUDE_FREERTOS)
+        if (xSemaphoreTake(com_dev->tx_sem, timeout_ms / portTICK_RATE_MS) != pdTRUE) {
+            return -2;
+        }
+#else
+        PIOS_DELAY_WaitmS(1);
+        timeout_ms--;
+#endif
+    }
+
+    return 0;
+}
+
+/**
+ * Sends what was written in the room from PIOS_COM_ReserveBuffer()
+ * \param[in] port COM port
+ * \param[in] len bytes written, at most the room reserved (0 sends nothing)
+ * \return -1 if port not available
+ * \return number of bytes transmitted on success
+ */
+int32_t PIOS_COM_CommitBuffer(uint32_t com_id, uint16_t len)
+{
+    struct pios_com_dev *com_dev = PIOS_COM_find_dev(com_id);
+
+    if (!PIOS_COM_validate(com_dev)) {
+        /* Undefined COM port for this board (see pios_board.c) */
+        return -1;
+    }
+
+    PIOS_Assert(com_dev->has_tx);
+
+    if (len > 0) {
+        PIOS_IRQ_Disable();
+        fifoBuf_commit(&com_dev->tx, len);
+        PIOS_IRQ_Enable();
+
+        /* More data has been put in the tx buffer, make sure the tx is started */
+        if (com_dev->driver->tx_start) {
+            com_dev->driver->tx_start(com_dev->lower_id,
+                                      fifoBuf_getUsed(&com_dev->tx));
+        }
+    }
+
+    return len;
+}
+
 /**
  * Sends a single character over given port
  * \param[in] port COM port
@@ -34,6 +34,12 @@
  * fetches so that relatively accurate measurements can be obtained without
  * forcing higher-level logic to poll aggressively.
  *
+ * Each pin can additionally be given a decimation and smoothing filter with
+ * PIOS_ADC_PinConfigFilter(). It runs on every DMA buffer flip, consumers
+ * pick up the latest timestamped value with PIOS_ADC_PinGetFiltered() at
+ * whatever rate they like. PIOS_ADC_GetStats() reports the time spent in
+ * the interrupt.
+ *
  * @todo This module needs more work to be more generally useful.  It should
  * almost certainly grow callback support so that e.g. voltage and current readings
  * can be shipped out for coulomb counting purposes.  The F1xx interface presumes
@@ -115,6 +121,8 @@ static const struct dma_config config[] = PIOS_DMA_PIN_CONFIG;
 #define PIOS_ADC_NUM_PINS (sizeof(config) / sizeof(config[0]))
 
 static struct adc_accumulator accumulator[PIOS_ADC_NUM_PINS];
+static struct pios_adc_filter filter[PIOS_ADC_NUM_PINS];
+static struct pios_adc_stats stats;
 
 // Two buffers here for double buffering
 static uint16_t adc_raw_buffer[2][PIOS_ADC_MAX_SAMPLES][PIOS_ADC_NUM_PINS];
@@ -329,6 +337,84 @@ float PIOS_ADC_PinGetVolt(uint32_t pin)
     return ((float)PIOS_ADC_PinGet(pin)) * PIOS_ADC_VOLTAGE_SCALE;
 }
 
+/**
+ * @brief Set up the filter pipeline of a pin, replacing any previous one
+ * @param[in] pin number
+ * @param[in] cfg decimation and smoothing, a ratio of 0 turns the filter off
+ * @return 0 on success
+ * @return -1 if pin doesn't exist
+ * @return -2 if the configuration is not supported
+ */
+int32_t PIOS_ADC_PinConfigFilter(uint32_t pin, const struct pios_adc_filter_cfg *cfg)
+{
+#if defined(PIOS_INCLUDE_ADC)
+    struct pios_adc_filter new_filter;
+
+    if (pin >= PIOS_ADC_NUM_PINS) {
+        return -1;
+    }
+
+    if (PIOS_ADC_Filter_Init(&new_filter, cfg) < 0) {
+        return -2;
+    }
+
+    PIOS_IRQ_Disable();
+    filter[pin] = new_filter;
+    PIOS_IRQ_Enable();
+
+    return 0;
+
+#else
+    return -1;
+#endif
+}
+
+/**
+ * Returns the latest filtered value of an ADC Pin
+ * @param[in] pin number
+ * @param[out] sample value, timestamp and number of values published so far
+ * @return 0 on success
+ * @return -1 if pin doesn't exist
+ * @return -2 if no value has been published yet
+ */
+int32_t PIOS_ADC_PinGetFiltered(uint32_t pin, struct pios_adc_sample *sample)
+{
+#if defined(PIOS_INCLUDE_ADC)
+    uint32_t value;
+
+    if (pin >= PIOS_ADC_NUM_PINS) {
+        return -1;
+    }
+
+    PIOS_IRQ_Disable();
+    value = filter[pin].value;
+    sample->timestamp = filter[pin].timestamp;
+    sample->count     = filter[pin].count;
+    PIOS_IRQ_Enable();
+
+    if (sample->count == 0) {
+        return -2;
+    }
+
+    sample->value = (float)value * (1.0f / (1 << PIOS_ADC_FILTER_FRAC_BITS));
+
+    return 0;
+
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Return the number of DMA buffers processed and the CPU cycles spent on them
+ */
+void PIOS_ADC_GetStats(struct pios_adc_stats *out)
+{
+    PIOS_IRQ_Disable();
+    *out = stats;
+    PIOS_IRQ_Enable();
+}
+
 /**
  * @brief Set a callback function that is executed whenever
  * the ADC double buffer swaps
@@ -447,9 +533,23 @@ void PIOS_ADC_DMA_Handler(void)
     if (DMA_GetITStatus(pios_adc_dev->cfg->dma.rx.channel, pios_adc_dev->cfg->full_flag)) {
         DMA_ClearITPendingBit(pios_adc_dev->cfg->dma.rx.channel, pios_adc_dev->cfg->full_flag);
 
+        uint32_t start     = PIOS_DELAY_GetRaw();
+        uint32_t timestamp = PIOS_DELAY_GetuS();
+        uint16_t *buffer   = &adc_raw_buffer[DMA_GetCurrentMemoryTarget(pios_adc_dev->cfg->dma.rx.channel) ? 0 : 1][0][0];
+
         /* accumulate results from the buffer that was just completed */
-        accumulate(&adc_raw_buffer[DMA_GetCurrentMemoryTarget(pios_adc_dev->cfg->dma.rx.channel) ? 0 : 1][0][0],
-                   PIOS_ADC_MAX_SAMPLES);
+        accumulate(buffer, PIOS_ADC_MAX_SAMPLES);
+
+        /* and run it through the filters, disabled ones return right away */
+        for (uint32_t i = 0; i < PIOS_ADC_NUM_PINS; ++i) {
+            PIOS_ADC_Filter_Process(&filter[i], &buffer[i], PIOS_ADC_MAX_SAMPLES, PIOS_ADC_NUM_PINS, timestamp);
+        }
+
+        stats.blocks++;
+        stats.last_cycles = PIOS_DELAY_GetRaw() - start;
+        if (stats.last_cycles > stats.max_cycles) {
+            stats.max_cycles = stats.last_cycles;
+        }
     }
 #endif
 }
@@ -43,65 +43,8 @@
 
 #include <pios_i2c_priv.h>
 
-enum i2c_adapter_state {
-    I2C_STATE_FSM_FAULT = 0, /* Must be zero so undefined transitions land here */
-
-    I2C_STATE_BUS_ERROR,
-
-    I2C_STATE_STOPPED,
-    I2C_STATE_STOPPING,
-    I2C_STATE_STARTING,
-
-    I2C_STATE_R_MORE_TXN_ADDR,
-    I2C_STATE_R_MORE_TXN_PRE_ONE,
-    I2C_STATE_R_MORE_TXN_PRE_FIRST,
-    I2C_STATE_R_MORE_TXN_PRE_MIDDLE,
-    I2C_STATE_R_MORE_TXN_PRE_LAST,
-    I2C_STATE_R_MORE_TXN_POST_LAST,
-
-    I2C_STATE_R_LAST_TXN_ADDR,
-    I2C_STATE_R_LAST_TXN_PRE_ONE,
-    I2C_STATE_R_LAST_TXN_PRE_FIRST,
-    I2C_STATE_R_LAST_TXN_PRE_MIDDLE,
-    I2C_STATE_R_LAST_TXN_PRE_LAST,
-    I2C_STATE_R_LAST_TXN_POST_LAST,
-
-    I2C_STATE_W_MORE_TXN_ADDR,
-    I2C_STATE_W_MORE_TXN_MIDDLE,
-    I2C_STATE_W_MORE_TXN_LAST,
-
-    I2C_STATE_W_LAST_TXN_ADDR,
-    I2C_STATE_W_LAST_TXN_MIDDLE,
-    I2C_STATE_W_LAST_TXN_LAST,
-
-    I2C_STATE_NACK,
-
-    I2C_STATE_NUM_STATES /* Must be last */
-};
-
 // #define I2C_HALT_ON_ERRORS
 
-enum i2c_adapter_event {
-    I2C_EVENT_BUS_ERROR,
-    I2C_EVENT_START,
-    I2C_EVENT_STARTED_MORE_TXN_READ,
-    I2C_EVENT_STARTED_MORE_TXN_WRITE,
-    I2C_EVENT_STARTED_LAST_TXN_READ,
-    I2C_EVENT_STARTED_LAST_TXN_WRITE,
-    I2C_EVENT_ADDR_SENT_LEN_EQ_0,
-    I2C_EVENT_ADDR_SENT_LEN_EQ_1,
-    I2C_EVENT_ADDR_SENT_LEN_EQ_2,
-    I2C_EVENT_ADDR_SENT_LEN_GT_2,
-    I2C_EVENT_TRANSFER_DONE_LEN_EQ_0,
-    I2C_EVENT_TRANSFER_DONE_LEN_EQ_1,
-    I2C_EVENT_TRANSFER_DONE_LEN_EQ_2,
-    I2C_EVENT_TRANSFER_DONE_LEN_GT_2,
-    I2C_EVENT_NACK,
-    I2C_EVENT_STOPPED,
-    I2C_EVENT_AUTO, /* FIXME: remove this */
-
-    I2C_EVENT_NUM_EVENTS /* Must be last */
-};
 
 #if defined(PIOS_I2C_DIAGNOSTICS)
 static struct pios_i2c_fault_history i2c_adapter_fault_history;
@@ -112,12 +55,6 @@ volatile uint8_t i2c_evirq_history_pointer = 0;
 volatile uint32_t i2c_erirq_history[I2C_LOG_DEPTH];
 volatile uint8_t i2c_erirq_history_pointer = 0;
 
-volatile enum i2c_adapter_state i2c_state_history[I2C_LOG_DEPTH];
-volatile uint8_t i2c_state_history_pointer = 0;
-
-volatile enum i2c_adapter_event i2c_state_event_history[I2C_LOG_DEPTH];
-volatile uint8_t i2c_state_event_history_pointer;
-
 static uint8_t i2c_fsm_fault_count   = 0;
 static uint8_t i2c_bad_event_counter = 0;
 static uint8_t i2c_error_interrupt_counter = 0;
@@ -125,592 +62,158 @@ static uint8_t i2c_nack_counter = 0;
 static uint8_t i2c_timeout_counter   = 0;
 #endif
 
-static void go_fsm_fault(struct pios_i2c_adapter *i2c_adapter);
-static void go_bus_error(struct pios_i2c_adapter *i2c_adapter);
-static void go_stopping(struct pios_i2c_adapter *i2c_adapter);
-static void go_stopped(struct pios_i2c_adapter *i2c_adapter);
-static void go_starting(struct pios_i2c_adapter *i2c_adapter);
-
-static void go_r_any_txn_addr(struct pios_i2c_adapter *i2c_adapter);
-static void go_r_more_txn_pre_one(struct pios_i2c_adapter *i2c_adapter);
-static void go_r_last_txn_pre_one(struct pios_i2c_adapter *i2c_adapter);
-static void go_r_any_txn_pre_first(struct pios_i2c_adapter *i2c_adapter);
-static void go_r_any_txn_pre_middle(struct pios_i2c_adapter *i2c_adapter);
-static void go_r_last_txn_pre_last(struct pios_i2c_adapter *i2c_adapter);
-static void go_r_more_txn_pre_last(struct pios_i2c_adapter *i2c_adapter);
-static void go_r_any_txn_post_last(struct pios_i2c_adapter *i2c_adapter);
-
-static void go_w_any_txn_addr(struct pios_i2c_adapter *i2c_adapter);
-static void go_w_any_txn_middle(struct pios_i2c_adapter *i2c_adapter);
-static void go_w_more_txn_last(struct pios_i2c_adapter *i2c_adapter);
-static void go_w_last_txn_last(struct pios_i2c_adapter *i2c_adapter);
-
-static void go_nack(struct pios_i2c_adapter *i2c_adapter);
-
-struct i2c_adapter_transition {
-    void (*entry_fn)(struct pios_i2c_adapter *i2c_adapter);
-    enum i2c_adapter_state next_state[I2C_EVENT_NUM_EVENTS];
-};
-
-static void i2c_adapter_process_auto(struct pios_i2c_adapter *i2c_adapter);
-static void i2c_adapter_inject_event(struct pios_i2c_adapter *i2c_adapter, enum i2c_adapter_event event);
-static void i2c_adapter_fsm_init(struct pios_i2c_adapter *i2c_adapter);
-static bool i2c_adapter_wait_for_stopped(struct pios_i2c_adapter *i2c_adapter);
 static void i2c_adapter_reset_bus(struct pios_i2c_adapter *i2c_adapter);
+static void i2c_adapter_log_fault(uint32_t i2c_id, enum pios_i2c_error_type type);
 
-static void i2c_adapter_log_fault(enum pios_i2c_error_type type);
-static bool i2c_adapter_callback_handler(struct pios_i2c_adapter *i2c_adapter);
-
-static const struct i2c_adapter_transition i2c_adapter_transitions[I2C_STATE_NUM_STATES] = {
-    [I2C_STATE_FSM_FAULT] =             {
-        .entry_fn   = go_fsm_fault,
-        .next_state =                   {
-            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
-        },
-    },
-    [I2C_STATE_BUS_ERROR] =             {
-        .entry_fn   = go_bus_error,
-        .next_state =                   {
-            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
-        },
-    },
-
-    [I2C_STATE_STOPPED] =               {
-        .entry_fn   = go_stopped,
-        .next_state =                   {
-            [I2C_EVENT_START]     = I2C_STATE_STARTING,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_STOPPING] =              {
-        .entry_fn   = go_stopping,
-        .next_state =                   {
-            [I2C_EVENT_STOPPED]   = I2C_STATE_STOPPED,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_STARTING] =              {
-        .entry_fn   = go_starting,
-        .next_state =                   {
-            [I2C_EVENT_STARTED_MORE_TXN_READ]  = I2C_STATE_R_MORE_TXN_ADDR,
-            [I2C_EVENT_STARTED_MORE_TXN_WRITE] = I2C_STATE_W_MORE_TXN_ADDR,
-            [I2C_EVENT_STARTED_LAST_TXN_READ]  = I2C_STATE_R_LAST_TXN_ADDR,
-            [I2C_EVENT_STARTED_LAST_TXN_WRITE] = I2C_STATE_W_LAST_TXN_ADDR,
-            [I2C_EVENT_NACK] = I2C_STATE_NACK,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    /*
-     * Read with restart
-     */
-
-    [I2C_STATE_R_MORE_TXN_ADDR] =       {
-        .entry_fn   = go_r_any_txn_addr,
-        .next_state =                   {
-            [I2C_EVENT_ADDR_SENT_LEN_EQ_1] = I2C_STATE_R_MORE_TXN_PRE_ONE,
-            [I2C_EVENT_ADDR_SENT_LEN_EQ_2] = I2C_STATE_R_MORE_TXN_PRE_FIRST,
-            [I2C_EVENT_ADDR_SENT_LEN_GT_2] = I2C_STATE_R_MORE_TXN_PRE_FIRST,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_MORE_TXN_PRE_ONE] =    {
-        .entry_fn   = go_r_more_txn_pre_one,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_R_MORE_TXN_POST_LAST,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_MORE_TXN_PRE_FIRST] =  {
-        .entry_fn   = go_r_any_txn_pre_first,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_R_MORE_TXN_PRE_LAST,
-            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_R_MORE_TXN_PRE_MIDDLE,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_MORE_TXN_PRE_MIDDLE] = {
-        .entry_fn   = go_r_any_txn_pre_middle,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_R_MORE_TXN_PRE_LAST,
-            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_R_MORE_TXN_PRE_MIDDLE,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_MORE_TXN_PRE_LAST] =   {
-        .entry_fn   = go_r_more_txn_pre_last,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_R_MORE_TXN_POST_LAST,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_MORE_TXN_POST_LAST] =  {
-        .entry_fn   = go_r_any_txn_post_last,
-        .next_state =                   {
-            [I2C_EVENT_AUTO] = I2C_STATE_STARTING,
-        },
-    },
-
-    /*
-     * Read
-     */
-
-    [I2C_STATE_R_LAST_TXN_ADDR] =       {
-        .entry_fn   = go_r_any_txn_addr,
-        .next_state =                   {
-            [I2C_EVENT_ADDR_SENT_LEN_EQ_1] = I2C_STATE_R_LAST_TXN_PRE_ONE,
-            [I2C_EVENT_ADDR_SENT_LEN_EQ_2] = I2C_STATE_R_LAST_TXN_PRE_FIRST,
-            [I2C_EVENT_ADDR_SENT_LEN_GT_2] = I2C_STATE_R_LAST_TXN_PRE_FIRST,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_LAST_TXN_PRE_ONE] =    {
-        .entry_fn   = go_r_last_txn_pre_one,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_R_LAST_TXN_POST_LAST,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_LAST_TXN_PRE_FIRST] =  {
-        .entry_fn   = go_r_any_txn_pre_first,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_R_LAST_TXN_PRE_LAST,
-            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_R_LAST_TXN_PRE_MIDDLE,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_LAST_TXN_PRE_MIDDLE] = {
-        .entry_fn   = go_r_any_txn_pre_middle,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_R_LAST_TXN_PRE_LAST,
-            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_R_LAST_TXN_PRE_MIDDLE,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_LAST_TXN_PRE_LAST] =   {
-        .entry_fn   = go_r_last_txn_pre_last,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_R_LAST_TXN_POST_LAST,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_R_LAST_TXN_POST_LAST] =  {
-        .entry_fn   = go_r_any_txn_post_last,
-        .next_state =                   {
-            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
-        },
-    },
-
-    /*
-     * Write with restart
-     */
-
-    [I2C_STATE_W_MORE_TXN_ADDR] =       {
-        .entry_fn   = go_w_any_txn_addr,
-        .next_state =                   {
-            [I2C_EVENT_ADDR_SENT_LEN_EQ_1] = I2C_STATE_W_MORE_TXN_LAST,
-            [I2C_EVENT_ADDR_SENT_LEN_EQ_2] = I2C_STATE_W_MORE_TXN_MIDDLE,
-            [I2C_EVENT_ADDR_SENT_LEN_GT_2] = I2C_STATE_W_MORE_TXN_MIDDLE,
-            [I2C_EVENT_NACK] = I2C_STATE_NACK,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_W_MORE_TXN_MIDDLE] =     {
-        .entry_fn   = go_w_any_txn_middle,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_W_MORE_TXN_LAST,
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_W_MORE_TXN_MIDDLE,
-            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_W_MORE_TXN_MIDDLE,
-            [I2C_EVENT_NACK] = I2C_STATE_NACK,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_W_MORE_TXN_LAST] =       {
-        .entry_fn   = go_w_more_txn_last,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_0] = I2C_STATE_STARTING,
-            [I2C_EVENT_NACK] = I2C_STATE_NACK,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    /*
-     * Write
-     */
-
-    [I2C_STATE_W_LAST_TXN_ADDR] =       {
-        .entry_fn   = go_w_any_txn_addr,
-        .next_state =                   {
-            [I2C_EVENT_ADDR_SENT_LEN_EQ_1] = I2C_STATE_W_LAST_TXN_LAST,
-            [I2C_EVENT_ADDR_SENT_LEN_EQ_2] = I2C_STATE_W_LAST_TXN_MIDDLE,
-            [I2C_EVENT_ADDR_SENT_LEN_GT_2] = I2C_STATE_W_LAST_TXN_MIDDLE,
-            [I2C_EVENT_NACK] = I2C_STATE_NACK,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_W_LAST_TXN_MIDDLE] =     {
-        .entry_fn   = go_w_any_txn_middle,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_1] = I2C_STATE_W_LAST_TXN_LAST,
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_2] = I2C_STATE_W_LAST_TXN_MIDDLE,
-            [I2C_EVENT_TRANSFER_DONE_LEN_GT_2] = I2C_STATE_W_LAST_TXN_MIDDLE,
-            [I2C_EVENT_NACK] = I2C_STATE_NACK,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-
-    [I2C_STATE_W_LAST_TXN_LAST] =       {
-        .entry_fn   = go_w_last_txn_last,
-        .next_state =                   {
-            [I2C_EVENT_TRANSFER_DONE_LEN_EQ_0] = I2C_STATE_STOPPING,
-            [I2C_EVENT_NACK] = I2C_STATE_NACK,
-            [I2C_EVENT_BUS_ERROR] = I2C_STATE_BUS_ERROR,
-        },
-    },
-    [I2C_STATE_NACK] =                  {
-        .entry_fn   = go_nack,
-        .next_state =                   {
-            [I2C_EVENT_AUTO] = I2C_STATE_STOPPING,
-        },
-    },
-};
-
-static void go_fsm_fault(struct pios_i2c_adapter *i2c_adapter)
-{
-#if defined(I2C_HALT_ON_ERRORS)
-    PIOS_DEBUG_Assert(0);
-#endif
-    /* Note that this transfer has hit a bus error */
-    i2c_adapter->bus_error = true;
-
-    i2c_adapter_reset_bus(i2c_adapter);
-}
-
-static void go_bus_error(struct pios_i2c_adapter *i2c_adapter)
-{
-    /* Note that this transfer has hit a bus error */
-    i2c_adapter->bus_error = true;
-
-    i2c_adapter_reset_bus(i2c_adapter);
-}
+/*
+ * State machine hooks
+ */
 
-static void go_stopping(struct pios_i2c_adapter *i2c_adapter)
+static void I2C_FSM_IRQConfig(uint32_t i2c_id, uint8_t irqs)
 {
-#ifdef USE_FREERTOS
-    signed portBASE_TYPE pxHigherPriorityTaskWoken = pdFALSE;
-#endif
-
-    I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
+    uint16_t cr2 = i2c_adapter->cfg->regs->CR2 & ~(I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR);
 
-#ifdef USE_FREERTOS
-    if (xSemaphoreGiveFromISR(i2c_adapter->sem_ready, &pxHigherPriorityTaskWoken) != pdTRUE) {
-#if defined(I2C_HALT_ON_ERRORS)
-        PIOS_DEBUG_Assert(0);
-#endif
+    if (irqs & PIOS_I2C_FSM_IRQ_EVT) {
+        cr2 |= I2C_IT_EVT;
     }
-    portEND_SWITCHING_ISR(pxHigherPriorityTaskWoken); /* FIXME: is this the right place for this? */
-#endif /* USE_FREERTOS */
-
-    if (i2c_adapter->callback) {
-        i2c_adapter_callback_handler(i2c_adapter);
+    if (irqs & PIOS_I2C_FSM_IRQ_BUF) {
+        cr2 |= I2C_IT_BUF;
     }
-}
-
-static void go_stopped(struct pios_i2c_adapter *i2c_adapter)
-{
-    I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
-    I2C_AcknowledgeConfig(i2c_adapter->cfg->regs, ENABLE);
-}
-
-static void go_starting(struct pios_i2c_adapter *i2c_adapter)
-{
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn >= i2c_adapter->first_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn <= i2c_adapter->last_txn);
-
-    // check for an empty read/write
-    if (i2c_adapter->active_txn->buf != NULL && i2c_adapter->active_txn->len != 0) {
-        // Data available
-        i2c_adapter->active_byte = &(i2c_adapter->active_txn->buf[0]);
-        i2c_adapter->last_byte   = &(i2c_adapter->active_txn->buf[i2c_adapter->active_txn->len - 1]);
-    } else {
-        // No Data available => Empty read/write
-        i2c_adapter->last_byte   = NULL;
-        i2c_adapter->active_byte = i2c_adapter->last_byte + 1;
+    if (irqs & PIOS_I2C_FSM_IRQ_ERR) {
+        cr2 |= I2C_IT_ERR;
     }
-
-    I2C_GenerateSTART(i2c_adapter->cfg->regs, ENABLE);
-    if (i2c_adapter->active_txn->rw == PIOS_I2C_TXN_READ) {
-        I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, ENABLE);
-    } else {
-        // For write operations, do not enable the IT_BUF events.
-        // The current driver does not act when the TX data register is not full, only when the complete byte is sent.
-        // With the IT_BUF enabled, we constantly get IRQs, See OP-326
-        I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_ERR, ENABLE);
-    }
-}
-
-/* Common to 'more' and 'last' transaction */
-static void go_r_any_txn_addr(struct pios_i2c_adapter *i2c_adapter)
-{
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn >= i2c_adapter->first_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn <= i2c_adapter->last_txn);
-
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn->rw == PIOS_I2C_TXN_READ);
-
-    I2C_Send7bitAddress(i2c_adapter->cfg->regs, (i2c_adapter->active_txn->addr) << 1, I2C_Direction_Receiver);
-}
-
-static void go_r_more_txn_pre_one(struct pios_i2c_adapter *i2c_adapter)
-{
-    I2C_AcknowledgeConfig(i2c_adapter->cfg->regs, DISABLE);
-    I2C_GenerateSTART(i2c_adapter->cfg->regs, ENABLE);
-}
-
-static void go_r_last_txn_pre_one(struct pios_i2c_adapter *i2c_adapter)
-{
-    I2C_AcknowledgeConfig(i2c_adapter->cfg->regs, DISABLE);
-    I2C_GenerateSTOP(i2c_adapter->cfg->regs, ENABLE);
-}
-
-/* Common to 'more' and 'last' transaction */
-static void go_r_any_txn_pre_first(struct pios_i2c_adapter *i2c_adapter)
-{
-    I2C_AcknowledgeConfig(i2c_adapter->cfg->regs, ENABLE);
+    i2c_adapter->cfg->regs->CR2 = cr2;
 }
 
-/* Common to 'more' and 'last' transaction */
-static void go_r_any_txn_pre_middle(struct pios_i2c_adapter *i2c_adapter)
+static void I2C_FSM_Ack(uint32_t i2c_id, bool enable)
 {
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte <= i2c_adapter->last_byte);
-
-    *(i2c_adapter->active_byte) = I2C_ReceiveData(i2c_adapter->cfg->regs);
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
 
-    /* Move to the next byte */
-    i2c_adapter->active_byte++;
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte <= i2c_adapter->last_byte);
+    I2C_AcknowledgeConfig(i2c_adapter->cfg->regs, enable ? ENABLE : DISABLE);
 }
 
-static void go_r_more_txn_pre_last(struct pios_i2c_adapter *i2c_adapter)
+static void I2C_FSM_Start(uint32_t i2c_id)
 {
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte <= i2c_adapter->last_byte);
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
 
-    I2C_AcknowledgeConfig(i2c_adapter->cfg->regs, DISABLE);
-    PIOS_IRQ_Disable();
-    I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
     I2C_GenerateSTART(i2c_adapter->cfg->regs, ENABLE);
-    *(i2c_adapter->active_byte) = I2C_ReceiveData(i2c_adapter->cfg->regs);
-    I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, ENABLE);
-    PIOS_IRQ_Enable();
-
-    /* Move to the next byte */
-    i2c_adapter->active_byte++;
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte <= i2c_adapter->last_byte);
 }
 
-static void go_r_last_txn_pre_last(struct pios_i2c_adapter *i2c_adapter)
+static void I2C_FSM_Stop(uint32_t i2c_id)
 {
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte <= i2c_adapter->last_byte);
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
 
-    I2C_AcknowledgeConfig(i2c_adapter->cfg->regs, DISABLE);
-    PIOS_IRQ_Disable();
-    I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
     I2C_GenerateSTOP(i2c_adapter->cfg->regs, ENABLE);
-    *(i2c_adapter->active_byte) = I2C_ReceiveData(i2c_adapter->cfg->regs);
-    I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, ENABLE);
-    PIOS_IRQ_Enable();
-
-    /* Move to the next byte */
-    i2c_adapter->active_byte++;
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte <= i2c_adapter->last_byte);
 }
 
-/* Common to 'more' and 'last' transaction */
-static void go_r_any_txn_post_last(struct pios_i2c_adapter *i2c_adapter)
+static void I2C_FSM_SendAddress(uint32_t i2c_id, uint16_t addr, enum pios_i2c_txn_direction rw)
 {
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte == i2c_adapter->last_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn >= i2c_adapter->first_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn <= i2c_adapter->last_txn);
-
-    *(i2c_adapter->active_byte) = I2C_ReceiveData(i2c_adapter->cfg->regs);
-
-    /* Move to the next byte */
-    i2c_adapter->active_byte++;
-
-    /* Move to the next transaction */
-    i2c_adapter->active_txn++;
-}
-
-/* Common to 'more' and 'last' transaction */
-static void go_w_any_txn_addr(struct pios_i2c_adapter *i2c_adapter)
-{
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn >= i2c_adapter->first_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn <= i2c_adapter->last_txn);
-
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn->rw == PIOS_I2C_TXN_WRITE);
-
-    I2C_Send7bitAddress(i2c_adapter->cfg->regs, (i2c_adapter->active_txn->addr) << 1, I2C_Direction_Transmitter);
-}
-
-static void go_w_any_txn_middle(struct pios_i2c_adapter *i2c_adapter)
-{
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte < i2c_adapter->last_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn >= i2c_adapter->first_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn <= i2c_adapter->last_txn);
-
-    I2C_SendData(i2c_adapter->cfg->regs, *(i2c_adapter->active_byte));
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
 
-    /* Move to the next byte */
-    i2c_adapter->active_byte++;
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte <= i2c_adapter->last_byte);
+    I2C_Send7bitAddress(i2c_adapter->cfg->regs, addr << 1,
+                        (rw == PIOS_I2C_TXN_READ) ? I2C_Direction_Receiver : I2C_Direction_Transmitter);
 }
 
-static void go_w_more_txn_last(struct pios_i2c_adapter *i2c_adapter)
+static void I2C_FSM_SendByte(uint32_t i2c_id, uint8_t byte)
 {
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte == i2c_adapter->last_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn >= i2c_adapter->first_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn <= i2c_adapter->last_txn);
-
-    I2C_SendData(i2c_adapter->cfg->regs, *(i2c_adapter->active_byte));
-
-    /* Move to the next byte */
-    i2c_adapter->active_byte++;
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
 
-    /* Move to the next transaction */
-    i2c_adapter->active_txn++;
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn <= i2c_adapter->last_txn);
+    I2C_SendData(i2c_adapter->cfg->regs, byte);
 }
 
-static void go_w_last_txn_last(struct pios_i2c_adapter *i2c_adapter)
+static uint8_t I2C_FSM_ReceiveByte(uint32_t i2c_id)
 {
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_byte == i2c_adapter->last_byte);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn >= i2c_adapter->first_txn);
-    PIOS_DEBUG_Assert(i2c_adapter->active_txn <= i2c_adapter->last_txn);
-
-    I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_BUF, DISABLE);
-    I2C_SendData(i2c_adapter->cfg->regs, *(i2c_adapter->active_byte));
-
-// SHOULD MOVE THIS INTO A STOPPING STATE AND SET IT ONLY AFTER THE BYTE WAS SENT
-    I2C_GenerateSTOP(i2c_adapter->cfg->regs, ENABLE);
-
-    /* Move to the next byte */
-    i2c_adapter->active_byte++;
-}
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
 
-static void go_nack(struct pios_i2c_adapter *i2c_adapter)
-{
-    i2c_adapter->nack = true;
-    I2C_ITConfig(i2c_adapter->cfg->regs, I2C_IT_EVT | I2C_IT_BUF | I2C_IT_ERR, DISABLE);
-    I2C_AcknowledgeConfig(i2c_adapter->cfg->regs, DISABLE);
-    I2C_GenerateSTOP(i2c_adapter->cfg->regs, ENABLE);
+    return I2C_ReceiveData(i2c_adapter->cfg->regs);
 }
 
-static void i2c_adapter_inject_event(struct pios_i2c_adapter *i2c_adapter, enum i2c_adapter_event event)
+static bool I2C_FSM_WaitStopped(uint32_t i2c_id)
 {
-    PIOS_IRQ_Disable();
-
-#if defined(PIOS_I2C_DIAGNOSTICS)
-    i2c_state_event_history[i2c_state_event_history_pointer] = event;
-    i2c_state_event_history_pointer = (i2c_state_event_history_pointer + 1) % I2C_LOG_DEPTH;
-
-    i2c_state_history[i2c_state_history_pointer] = i2c_adapter->curr_state;
-    i2c_state_history_pointer = (i2c_state_history_pointer + 1) % I2C_LOG_DEPTH;
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
+    uint32_t guard;
 
-    if (i2c_adapter_transitions[i2c_adapter->curr_state].next_state[event] == I2C_STATE_FSM_FAULT) {
-        i2c_adapter_log_fault(PIOS_I2C_ERROR_FSM);
-    }
-#endif
     /*
-     * Move to the next state
-     *
-     * This is done prior to calling the new state's entry function to
-     * guarantee that the entry function never depends on the previous
-     * state.  This way, it cannot ever know what the previous state was.
+     * Wait for the bus to return to the stopped state.
+     * The stop condition goes out within a bit time of being
+     * requested, the guard only protects against a wedged
+     * peripheral spinning in the ISR forever.
      */
-    i2c_adapter->curr_state = i2c_adapter_transitions[i2c_adapter->curr_state].next_state[event];
-
-    /* Call the entry function (if any) for the next state. */
-    if (i2c_adapter_transitions[i2c_adapter->curr_state].entry_fn) {
-        i2c_adapter_transitions[i2c_adapter->curr_state].entry_fn(i2c_adapter);
+    for (guard = 1000000; /* FIXME: should use the configured bus timeout */
+         guard && (i2c_adapter->cfg->regs->CR1 & I2C_CR1_STOP); guard--) {
+        continue;
+    }
+    if (!guard) {
+        /* We timed out waiting for the stop condition */
+        return false;
     }
 
-    /* Process any AUTO transitions in the FSM */
-    i2c_adapter_process_auto(i2c_adapter);
+    return true;
+}
 
-    PIOS_IRQ_Enable();
+static void I2C_FSM_ResetBus(uint32_t i2c_id)
+{
+    i2c_adapter_reset_bus((struct pios_i2c_adapter *)i2c_id);
 }
 
-static void i2c_adapter_process_auto(struct pios_i2c_adapter *i2c_adapter)
+static void I2C_FSM_DMAStart(uint32_t i2c_id, enum pios_i2c_txn_direction rw, uint8_t *buf, uint32_t len)
 {
-    PIOS_IRQ_Disable();
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
+    const struct stm32_dma_chan *chan;
+    DMA_InitTypeDef dma_init;
 
-    while (i2c_adapter_transitions[i2c_adapter->curr_state].next_state[I2C_EVENT_AUTO]) {
-        i2c_adapter->curr_state = i2c_adapter_transitions[i2c_adapter->curr_state].next_state[I2C_EVENT_AUTO];
+    chan = (rw == PIOS_I2C_TXN_READ) ? &i2c_adapter->cfg->dma->rx : &i2c_adapter->cfg->dma->tx;
 
-        /* Call the entry function (if any) for the next state. */
-        if (i2c_adapter_transitions[i2c_adapter->curr_state].entry_fn) {
-            i2c_adapter_transitions[i2c_adapter->curr_state].entry_fn(i2c_adapter);
-        }
-    }
+    /* Start with the default configuration for this peripheral */
+    dma_init = chan->init;
+    dma_init.DMA_Memory0BaseAddr = (uint32_t)buf;
+    dma_init.DMA_BufferSize = len;
+    DMA_DeInit(chan->channel);
+    DMA_Init(chan->channel, &dma_init);
 
-    PIOS_IRQ_Enable();
-}
+    if (rw == PIOS_I2C_TXN_READ) {
+        /*
+         * The peripheral NACKs the last byte by itself, the stop or
+         * restart is generated from the transfer complete interrupt.
+         */
+        I2C_DMALastTransferCmd(i2c_adapter->cfg->regs, ENABLE);
+        DMA_ITConfig(chan->channel, DMA_IT_TC, ENABLE);
+    }
+    /* Writes end on the byte transfer finished event, no DMA interrupt needed */
 
-static void i2c_adapter_fsm_init(struct pios_i2c_adapter *i2c_adapter)
-{
-    i2c_adapter_reset_bus(i2c_adapter);
-    i2c_adapter->curr_state = I2C_STATE_STOPPED;
+    DMA_Cmd(chan->channel, ENABLE);
+    I2C_DMACmd(i2c_adapter->cfg->regs, ENABLE);
 }
 
-static bool i2c_adapter_wait_for_stopped(struct pios_i2c_adapter *i2c_adapter)
+static void I2C_FSM_DMAStop(uint32_t i2c_id)
 {
-    uint32_t guard;
-
-    /*
-     * Wait for the bus to return to the stopped state.
-     * This was pulled out of the FSM due to occasional
-     * failures at this transition which previously resulted
-     * in spinning on this bit in the ISR forever.
-     */
-    for (guard = 1000000; /* FIXME: should use the configured bus timeout */
-         guard && (i2c_adapter->cfg->regs->CR1 & I2C_CR1_STOP); guard--) {
-        continue;
-    }
-    if (!guard) {
-        /* We timed out waiting for the stop condition */
-        return false;
-    }
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
 
-    return true;
-}
+    I2C_DMACmd(i2c_adapter->cfg->regs, DISABLE);
+    I2C_DMALastTransferCmd(i2c_adapter->cfg->regs, DISABLE);
+    if (i2c_adapter->cfg->dma->rx.channel) {
+        DMA_Cmd(i2c_adapter->cfg->dma->rx.channel, DISABLE);
+    }
+    if (i2c_adapter->cfg->dma->tx.channel) {
+        DMA_Cmd(i2c_adapter->cfg->dma->tx.channel, DISABLE);
+    }
+}
+
+static const struct pios_i2c_fsm_driver i2c_fsm_driver = {
+    .irq_config   = I2C_FSM_IRQConfig,
+    .ack          = I2C_FSM_Ack,
+    .start        = I2C_FSM_Start,
+    .stop         = I2C_FSM_Stop,
+    .send_address = I2C_FSM_SendAddress,
+    .send_byte    = I2C_FSM_SendByte,
+    .receive_byte = I2C_FSM_ReceiveByte,
+    .wait_stopped = I2C_FSM_WaitStopped,
+    .reset_bus    = I2C_FSM_ResetBus,
+    .dma_start    = I2C_FSM_DMAStart,
+    .dma_stop     = I2C_FSM_DMAStop,
+    .log_fault    = i2c_adapter_log_fault,
+};
 
 static void i2c_adapter_reset_bus(struct pios_i2c_adapter *i2c_adapter)
 {
@@ -790,11 +293,6 @@ static void i2c_adapter_reset_bus(struct pios_i2c_adapter *i2c_adapter)
     /* Initialize the I2C block */
     I2C_Init(i2c_adapter->cfg->regs, (I2C_InitTypeDef *)&(i2c_adapter->cfg->init));
 
-    // for delays during transfer timeouts
-    // one tick correspond to transmission of 1 byte i.e. 9 clock ticks
-    i2c_adapter->transfer_delay_uS = 9000000 / (((I2C_InitTypeDef *)&(i2c_adapter->cfg->init))->I2C_ClockSpeed);
-
-
     if (i2c_adapter->cfg->regs->SR2 & I2C_FLAG_BUSY) {
         /* Reset the I2C block */
         I2C_SoftwareResetCmd(i2c_adapter->cfg->regs, ENABLE);
@@ -803,81 +301,19 @@ static void i2c_adapter_reset_bus(struct pios_i2c_adapter *i2c_adapter)
 }
 
 
-/* Return true if the FSM is in a terminal state */
-static bool i2c_adapter_fsm_terminated(struct pios_i2c_adapter *i2c_adapter)
-{
-    switch (i2c_adapter->curr_state) {
-    case I2C_STATE_STOPPING:
-    case I2C_STATE_STOPPED:
-        return true;
-
-    default:
-        return false;
-    }
-}
-
-uint32_t i2c_cb_count = 0;
-static bool i2c_adapter_callback_handler(struct pios_i2c_adapter *i2c_adapter)
-{
-    bool semaphore_success = true;
-
-    /* Wait for the transfer to complete */
-#ifdef USE_FREERTOS
-    portTickType timeout;
-    timeout = i2c_adapter->cfg->transfer_timeout_ms / portTICK_RATE_MS;
-    semaphore_success &= (xSemaphoreTake(i2c_adapter->sem_ready, timeout) == pdTRUE);
-    xSemaphoreGive(i2c_adapter->sem_ready);
-#endif /* USE_FREERTOS */
-
-    /* transfer_timeout_ticks is set by PIOS_I2C_Transfer_Callback */
-    /* Spin waiting for the transfer to finish */
-    while (!i2c_adapter_fsm_terminated(i2c_adapter)) {
-        // sleep 1 byte, as FSM can't be faster
-        // FIXME: clock stretching could make problems, but citing NPX: alsmost no slave device implements clock stretching
-        // three times the expected time should cover clock delay
-        PIOS_DELAY_WaituS(i2c_adapter->transfer_delay_uS);
-
-        i2c_adapter->transfer_timeout_ticks--;
-        if (i2c_adapter->transfer_timeout_ticks == 0) {
-            break;
-        }
-    }
-
-    if (i2c_adapter_wait_for_stopped(i2c_adapter)) {
-        i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_STOPPED);
-    } else {
-        i2c_adapter_fsm_init(i2c_adapter);
-    }
-
-    // Execute user supplied function
-    i2c_adapter->callback();
-
-    i2c_cb_count++;
-
-#ifdef USE_FREERTOS
-    /* Unlock the bus */
-    xSemaphoreGive(i2c_adapter->sem_busy);
-    if (!semaphore_success) {
-        i2c_timeout_counter++;
-    }
-#else
-    PIOS_IRQ_Disable();
-    i2c_adapter->busy = 0;
-    PIOS_IRQ_Enable();
-#endif /* USE_FREERTOS */
-
-
-    return (!i2c_adapter->bus_error) && semaphore_success;
-}
 
 /**
  * Logs the last N state transitions and N IRQ events due to
  * an error condition
- * \param[in] i2c the adapter number to log an event for
+ * \param[in] i2c_id the adapter to log an event for
+ * \param[in] type kind of fault
  */
-void i2c_adapter_log_fault(enum pios_i2c_error_type type)
+static void i2c_adapter_log_fault(__attribute__((unused)) uint32_t i2c_id, __attribute__((unused)) enum pios_i2c_error_type type)
 {
 #if defined(PIOS_I2C_DIAGNOSTICS)
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
+    struct pios_i2c_fsm *fsm = &i2c_adapter->fsm;
+
     i2c_adapter_fault_history.type = type;
     for (uint8_t i = 0; i < I2C_LOG_DEPTH; i++) {
         i2c_adapter_fault_history.evirq[i] =
@@ -885,9 +321,9 @@ void i2c_adapter_log_fault(enum pios_i2c_error_type type)
         i2c_adapter_fault_history.erirq[i] =
             i2c_erirq_history[(I2C_LOG_DEPTH + i2c_erirq_history_pointer - 1 - i) % I2C_LOG_DEPTH];
         i2c_adapter_fault_history.event[i] =
-            i2c_state_event_history[(I2C_LOG_DEPTH + i2c_state_event_history_pointer - 1 - i) % I2C_LOG_DEPTH];
+            fsm->event_history[(I2C_LOG_DEPTH + fsm->event_history_pointer - 1 - i) % I2C_LOG_DEPTH];
         i2c_adapter_fault_history.state[i] =
-            i2c_state_history[(I2C_LOG_DEPTH + i2c_state_history_pointer - 1 - i) % I2C_LOG_DEPTH];
+            fsm->state_history[(I2C_LOG_DEPTH + fsm->state_history_pointer - 1 - i) % I2C_LOG_DEPTH];
     }
     switch (type) {
     case PIOS_I2C_ERROR_EVENT:
@@ -966,6 +402,10 @@ static struct pios_i2c_adapter *PIOS_I2C_alloc(void)
 #endif /* if defined(PIOS_INCLUDE_FREERTOS) && 0 */
 
 
+#ifdef USE_FREERTOS
+static void i2c_adapter_timeout_timer(TimerHandle_t timer);
+#endif
+
 /**
  * Initializes IIC driver
  * \param[in] mode currently only mode 0 supported
@@ -977,6 +417,7 @@ int32_t PIOS_I2C_Init(uint32_t *i2c_id, const struct pios_i2c_adapter_cfg *cfg)
     PIOS_DEBUG_Assert(cfg);
 
     struct pios_i2c_adapter *i2c_adapter;
+    uint8_t dma = 0;
 
     i2c_adapter = (struct pios_i2c_adapter *)PIOS_I2C_alloc();
     if (!i2c_adapter) {
@@ -987,18 +428,27 @@ int32_t PIOS_I2C_Init(uint32_t *i2c_id, const struct pios_i2c_adapter_cfg *cfg)
     i2c_adapter->cfg = cfg;
 
 #ifdef USE_FREERTOS
-    /*
-     * Must be done prior to calling i2c_adapter_fsm_init()
-     * since the sem_ready mutex is used in the initial state.
-     */
     vSemaphoreCreateBinary(i2c_adapter->sem_ready);
+    xSemaphoreTake(i2c_adapter->sem_ready, 0);
     i2c_adapter->sem_busy = xSemaphoreCreateMutex();
 #else
     i2c_adapter->busy     = 0;
 #endif // USE_FREERTOS
 
+    i2c_adapter->callback_req.result = 0;
+
+    if (cfg->dma) {
+        if (cfg->dma->rx.channel) {
+            dma |= PIOS_I2C_FSM_DMA_READ;
+            NVIC_Init((NVIC_InitTypeDef *)&(cfg->dma->irq.init));
+        }
+        if (cfg->dma->tx.channel) {
+            dma |= PIOS_I2C_FSM_DMA_WRITE;
+        }
+    }
+
     /* Initialize the state machine */
-    i2c_adapter_fsm_init(i2c_adapter);
+    PIOS_I2C_FSM_Init(&i2c_adapter->fsm, &i2c_fsm_driver, (uint32_t)i2c_adapter, dma);
 
     *i2c_id = (uint32_t)i2c_adapter;
 
@@ -1006,6 +456,14 @@ int32_t PIOS_I2C_Init(uint32_t *i2c_id, const struct pios_i2c_adapter_cfg *cfg)
     NVIC_Init((NVIC_InitTypeDef *)&(i2c_adapter->cfg->event.init));
     NVIC_Init((NVIC_InitTypeDef *)&(i2c_adapter->cfg->error.init));
 
+#ifdef USE_FREERTOS
+    /* A hung bus raises no interrupt, so look for expired requests periodically */
+    i2c_adapter->timeout_timer = xTimerCreate("I2C", i2c_adapter->cfg->transfer_timeout_ms / portTICK_RATE_MS,
+                                              pdTRUE, i2c_adapter, i2c_adapter_timeout_timer);
+    if (!i2c_adapter->timeout_timer || xTimerStart(i2c_adapter->timeout_timer, 0) != pdPASS) {
+        goto out_fail;
+    }
+#endif
 
     /* No error */
     return 0;
@@ -1014,6 +472,50 @@ out_fail:
     return -1;
 }
 
+/**
+ * Abort the request on the bus if it exceeded the configured transfer timeout
+ */
+static void i2c_adapter_check_timeout(struct pios_i2c_adapter *i2c_adapter, bool *woken)
+{
+    if (PIOS_I2C_FSM_CheckTimeout(&i2c_adapter->fsm, i2c_adapter->cfg->transfer_timeout_ms * 1000, woken)) {
+#if defined(PIOS_I2C_DIAGNOSTICS)
+        i2c_timeout_counter++;
+#endif
+    }
+}
+
+#ifdef USE_FREERTOS
+/**
+ * Adapter timer, aborts a request stuck on the bus without waiting for the next transfer.
+ * Runs in the timer task, which blocks right after so any task woken gets to run.
+ */
+static void i2c_adapter_timeout_timer(TimerHandle_t timer)
+{
+    i2c_adapter_check_timeout((struct pios_i2c_adapter *)pvTimerGetTimerID(timer), NULL);
+}
+
+static void i2c_adapter_transfer_done(struct pios_i2c_request *req, bool *woken)
+{
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)req->context;
+    signed portBASE_TYPE higherPriorityTaskWoken = pdFALSE;
+
+    xSemaphoreGiveFromISR(i2c_adapter->sem_ready, &higherPriorityTaskWoken);
+    if (woken) {
+        *woken = *woken || (higherPriorityTaskWoken == pdTRUE);
+    }
+}
+#endif
+
+/**
+ * Executes a list of transactions and waits for them to complete
+ * \param[in] i2c_id I2C adapter handle
+ * \param[in] txn_list transactions, run back to back with repeated starts
+ * \param[in] num_txns number of transactions
+ * \return 0 on success
+ * \return -1 on bus error or invalid arguments
+ * \return -2 on timeout
+ * \return -3 if the slave did not acknowledge
+ */
 int32_t PIOS_I2C_Transfer(uint32_t i2c_id, const struct pios_i2c_txn txn_list[], uint32_t num_txns)
 {
     struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
@@ -1025,15 +527,25 @@ int32_t PIOS_I2C_Transfer(uint32_t i2c_id, const struct pios_i2c_txn txn_list[],
     PIOS_DEBUG_Assert(txn_list);
     PIOS_DEBUG_Assert(num_txns);
 
-    bool semaphore_success = true;
+    struct pios_i2c_request req = {
+        .txn_list = txn_list,
+        .num_txns = num_txns,
+        .callback = NULL,
+        .context  = i2c_adapter,
+    };
 
 #ifdef USE_FREERTOS
-    /* Lock the bus */
+    /* Serialise the blocking callers, they share the completion semaphore */
     portTickType timeout;
     timeout = i2c_adapter->cfg->transfer_timeout_ms / portTICK_RATE_MS;
     if (xSemaphoreTake(i2c_adapter->sem_busy, timeout) == pdFALSE) {
         return -2;
     }
+
+    bool sleep = (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING);
+    if (sleep) {
+        req.callback = i2c_adapter_transfer_done;
+    }
 #else
     PIOS_IRQ_Disable();
     if (i2c_adapter->busy) {
@@ -1044,71 +556,60 @@ int32_t PIOS_I2C_Transfer(uint32_t i2c_id, const struct pios_i2c_txn txn_list[],
     PIOS_IRQ_Enable();
 #endif /* USE_FREERTOS */
 
-    PIOS_DEBUG_Assert(i2c_adapter->curr_state == I2C_STATE_STOPPED);
-
-    i2c_adapter->first_txn  = &txn_list[0];
-    i2c_adapter->last_txn   = &txn_list[num_txns - 1];
-    i2c_adapter->active_txn = i2c_adapter->first_txn;
-
-#ifdef USE_FREERTOS
-    /* Make sure the done/ready semaphore is consumed before we start */
-    semaphore_success &= (xSemaphoreTake(i2c_adapter->sem_ready, timeout) == pdTRUE);
-#endif
-
-    // Estimate bytes of transmission. Per txns: 1 adress byte + length
-    i2c_adapter->transfer_timeout_ticks = num_txns;
-    for (uint32_t i = 0; i < num_txns; i++) {
-        i2c_adapter->transfer_timeout_ticks += txn_list[i].len;
-    }
-    // timeout if it takes eight times the expected time
-    i2c_adapter->transfer_timeout_ticks <<= 3;
-
-    i2c_adapter->callback  = NULL;
-    i2c_adapter->bus_error = false;
-    i2c_adapter->nack = false;
-    i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_START);
+    i2c_adapter_check_timeout(i2c_adapter, NULL);
+    PIOS_I2C_FSM_Submit(&i2c_adapter->fsm, &req, NULL);
 
-    /* Wait for the transfer to complete */
+    /* Queued requests ahead of us get the same timeout, so this always ends */
+    while (req.result == PIOS_I2C_REQUEST_PENDING) {
 #ifdef USE_FREERTOS
-    semaphore_success &= (xSemaphoreTake(i2c_adapter->sem_ready, timeout) == pdTRUE);
-    xSemaphoreGive(i2c_adapter->sem_ready);
-#endif /* USE_FREERTOS */
-
-    /* Spin waiting for the transfer to finish */
-    while (!i2c_adapter_fsm_terminated(i2c_adapter)) {
-        /* sleep 9 clock ticks (1 byte), because FSM can't be faster than one byte
-           FIXME: clock stretching could make problems, but citing NPX: alsmost no slave device implements clock stretching
-           three times the expected time should cover clock delay */
-        PIOS_DELAY_WaituS(i2c_adapter->transfer_delay_uS);
-
-        i2c_adapter->transfer_timeout_ticks--;
-        if (i2c_adapter->transfer_timeout_ticks == 0) {
-            break;
+        if (sleep && xSemaphoreTake(i2c_adapter->sem_ready, timeout) == pdTRUE) {
+            continue;
         }
-    }
-
-    if (i2c_adapter_wait_for_stopped(i2c_adapter)) {
-        i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_STOPPED);
-    } else {
-        i2c_adapter_fsm_init(i2c_adapter);
+#endif
+        i2c_adapter_check_timeout(i2c_adapter, NULL);
     }
 
 #ifdef USE_FREERTOS
     /* Unlock the bus */
     xSemaphoreGive(i2c_adapter->sem_busy);
-    if (!semaphore_success) {
-        i2c_timeout_counter++;
-    }
 #else
     PIOS_IRQ_Disable();
     i2c_adapter->busy = 0;
     PIOS_IRQ_Enable();
 #endif /* USE_FREERTOS */
 
-    return !semaphore_success ? -2 :
-           i2c_adapter->bus_error ? -1 :
-           i2c_adapter->nack ? -3 :
-           0;
+    return req.result;
+}
+
+/**
+ * Queues a list of transactions without waiting for them. The callback of the
+ * request runs from interrupt context once it has completed. Requests that
+ * exceed the transfer timeout are aborted by the adapter timer (or the next
+ * time the adapter is used when built without FreeRTOS).
+ * \param[in] i2c_id I2C adapter handle
+ * \param[in] req request, must stay valid until its callback has been called
+ * \return 0 if queued
+ * \return -1 on invalid arguments
+ */
+int32_t PIOS_I2C_QueueTransfer(uint32_t i2c_id, struct pios_i2c_request *req)
+{
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
+
+    if (!PIOS_I2C_validate(i2c_adapter)) {
+        return -1;
+    }
+
+    i2c_adapter_check_timeout(i2c_adapter, NULL);
+
+    return PIOS_I2C_FSM_Submit(&i2c_adapter->fsm, req, NULL);
+}
+
+static void i2c_adapter_callback_done(struct pios_i2c_request *req, __attribute__((unused)) bool *woken)
+{
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)req->context;
+
+    // Execute user supplied function
+    i2c_adapter->callback();
 }
 
 int32_t PIOS_I2C_Transfer_Callback(uint32_t i2c_id, const struct pios_i2c_txn txn_list[], uint32_t num_txns, void *callback)
@@ -1124,52 +625,28 @@ int32_t PIOS_I2C_Transfer_Callback(uint32_t i2c_id, const struct pios_i2c_txn tx
     PIOS_DEBUG_Assert(txn_list);
     PIOS_DEBUG_Assert(num_txns);
 
-    bool semaphore_success = true;
-
-#ifdef USE_FREERTOS
-    /* Lock the bus */
-    portTickType timeout;
-    timeout = i2c_adapter->cfg->transfer_timeout_ms / portTICK_RATE_MS;
-    if (xSemaphoreTake(i2c_adapter->sem_busy, timeout) == pdFALSE) {
-        return -2;
-    }
-#else
-    if (i2c_adapter->busy) {
+    /* Only one callback transfer may be outstanding per adapter */
+    PIOS_IRQ_Disable();
+    if (i2c_adapter->callback_req.result == PIOS_I2C_REQUEST_PENDING) {
         PIOS_IRQ_Enable();
         return -2;
     }
-#endif /* USE_FREERTOS */
-
-    PIOS_DEBUG_Assert(i2c_adapter->curr_state == I2C_STATE_STOPPED);
-
-    i2c_adapter->first_txn  = &txn_list[0];
-    i2c_adapter->last_txn   = &txn_list[num_txns - 1];
-    i2c_adapter->active_txn = i2c_adapter->first_txn;
-
-#ifdef USE_FREERTOS
-    /* Make sure the done/ready semaphore is consumed before we start */
-    semaphore_success &= (xSemaphoreTake(i2c_adapter->sem_ready, timeout) == pdTRUE);
-#endif
-
-    // used in the i2c_adapter_callback_handler function
-    // Estimate bytes of transmission. Per txns: 1 adress byte + length
-    i2c_adapter->transfer_timeout_ticks = num_txns;
-    for (uint32_t i = 0; i < num_txns; i++) {
-        i2c_adapter->transfer_timeout_ticks += txn_list[i].len;
-    }
-    // timeout if it takes eight times the expected time
-    i2c_adapter->transfer_timeout_ticks <<= 3;
+    i2c_adapter->callback_req.result = PIOS_I2C_REQUEST_PENDING;
+    PIOS_IRQ_Enable();
 
-    i2c_adapter->callback  = callback;
-    i2c_adapter->bus_error = false;
-    i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_START);
+    i2c_adapter->callback = callback;
+    i2c_adapter->callback_req.txn_list = txn_list;
+    i2c_adapter->callback_req.num_txns = num_txns;
+    i2c_adapter->callback_req.callback = i2c_adapter_callback_done;
+    i2c_adapter->callback_req.context  = i2c_adapter;
 
-    return !semaphore_success ? -2 : 0;
+    return PIOS_I2C_QueueTransfer(i2c_id, &i2c_adapter->callback_req);
 }
 
 void PIOS_I2C_EV_IRQ_Handler(uint32_t i2c_id)
 {
     struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
+    bool woken = false;
 
     if (!PIOS_I2C_validate(i2c_adapter)) {
         return;
@@ -1190,7 +667,7 @@ void PIOS_I2C_EV_IRQ_Handler(uint32_t i2c_id)
     // throw event depends on the current state.  However when accelerated (-Os)
     // we definitely catch this event twice and there is no clean way to do deal
     // with that in the FMS short of a special state for it
-    if (i2c_adapter->curr_state == I2C_STATE_STARTING && event == 0x70084) {
+    if (i2c_adapter->fsm.curr_state == I2C_STATE_STARTING && event == 0x70084) {
         return;
     }
 
@@ -1201,50 +678,11 @@ void PIOS_I2C_EV_IRQ_Handler(uint32_t i2c_id)
         (void)I2C_ReceiveData(i2c_adapter->cfg->regs);
     /* Fall through */
     case I2C_EVENT_MASTER_MODE_SELECT: /* EV5 */
-        switch (i2c_adapter->active_txn->rw) {
-        case PIOS_I2C_TXN_READ:
-            if (i2c_adapter->active_txn == i2c_adapter->last_txn) {
-                /* Final transaction */
-                i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_STARTED_LAST_TXN_READ);
-            } else if (i2c_adapter->active_txn < i2c_adapter->last_txn) {
-                /* More transactions follow */
-                i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_STARTED_MORE_TXN_READ);
-            } else {
-                PIOS_DEBUG_Assert(0);
-            }
-            break;
-        case PIOS_I2C_TXN_WRITE:
-            if (i2c_adapter->active_txn == i2c_adapter->last_txn) {
-                /* Final transaction */
-                i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_STARTED_LAST_TXN_WRITE);
-            } else if (i2c_adapter->active_txn < i2c_adapter->last_txn) {
-                /* More transactions follow */
-                i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_STARTED_MORE_TXN_WRITE);
-            } else {
-                PIOS_DEBUG_Assert(0);
-            }
-            break;
-        default:
-            PIOS_DEBUG_Assert(0);
-            break;
-        }
+        PIOS_I2C_FSM_Started(&i2c_adapter->fsm, &woken);
         break;
     case I2C_EVENT_MASTER_TRANSMITTER_MODE_SELECTED: /* EV6 */
     case I2C_EVENT_MASTER_RECEIVER_MODE_SELECTED: /* EV6 */
-        switch (i2c_adapter->last_byte - i2c_adapter->active_byte + 1) {
-        case 0:
-            i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_ADDR_SENT_LEN_EQ_0);
-            break;
-        case 1:
-            i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_ADDR_SENT_LEN_EQ_1);
-            break;
-        case 2:
-            i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_ADDR_SENT_LEN_EQ_2);
-            break;
-        default:
-            i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_ADDR_SENT_LEN_GT_2);
-            break;
-        }
+        PIOS_I2C_FSM_AddrSent(&i2c_adapter->fsm, &woken);
         break;
     case 0x80: /* TxE only.  TRA + MSL + BUSY have been cleared before we got here. */
         /* Ignore */
@@ -1262,20 +700,7 @@ void PIOS_I2C_EV_IRQ_Handler(uint32_t i2c_id)
     case (I2C_EVENT_MASTER_BYTE_RECEIVED | 0x4): /* EV7 + BTF */
     case I2C_EVENT_MASTER_BYTE_TRANSMITTED: /* EV8_2 */
     case 0x84: /* TxE + BTF. EV8_2 but TRA + MSL + BUSY have already been cleared by HW. */
-        switch (i2c_adapter->last_byte - i2c_adapter->active_byte + 1) {
-        case 0:
-            i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_TRANSFER_DONE_LEN_EQ_0);
-            break;
-        case 1:
-            i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_TRANSFER_DONE_LEN_EQ_1);
-            break;
-        case 2:
-            i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_TRANSFER_DONE_LEN_EQ_2);
-            break;
-        default:
-            i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_TRANSFER_DONE_LEN_GT_2);
-            break;
-        }
+        PIOS_I2C_FSM_TransferDone(&i2c_adapter->fsm, &woken);
         break;
     case I2C_EVENT_MASTER_BYTE_TRANSMITTING: /* EV8 */
         /* Ignore this event and wait for TRANSMITTED in case we can't keep up */
@@ -1287,15 +712,18 @@ void PIOS_I2C_EV_IRQ_Handler(uint32_t i2c_id)
         goto skip_event;
         break;
     default:
-        i2c_adapter_log_fault(PIOS_I2C_ERROR_EVENT);
+        i2c_adapter_log_fault(i2c_id, PIOS_I2C_ERROR_EVENT);
 #if defined(I2C_HALT_ON_ERRORS)
         PIOS_DEBUG_Assert(0);
 #endif
-        i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_BUS_ERROR);
+        PIOS_I2C_FSM_BusError(&i2c_adapter->fsm, &woken);
         break;
     }
 
 skip_event:
+#ifdef USE_FREERTOS
+    portEND_SWITCHING_ISR(woken ? pdTRUE : pdFALSE);
+#endif
     ;
 }
 
@@ -1303,6 +731,7 @@ skip_event:
 void PIOS_I2C_ER_IRQ_Handler(uint32_t i2c_id)
 {
     struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
+    bool woken = false;
 
     if (!PIOS_I2C_validate(i2c_adapter)) {
         return;
@@ -1320,13 +749,39 @@ void PIOS_I2C_ER_IRQ_Handler(uint32_t i2c_id)
 
         I2C_ClearFlag(i2c_adapter->cfg->regs, I2C_FLAG_AF);
 
-        i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_NACK);
+        PIOS_I2C_FSM_Nack(&i2c_adapter->fsm, &woken);
     } else { /* Mostly bus errors here */
-        i2c_adapter_log_fault(PIOS_I2C_ERROR_INTERRUPT);
+        i2c_adapter_log_fault(i2c_id, PIOS_I2C_ERROR_INTERRUPT);
 
         /* Fail hard on any errors for now */
-        i2c_adapter_inject_event(i2c_adapter, I2C_EVENT_BUS_ERROR);
+        PIOS_I2C_FSM_BusError(&i2c_adapter->fsm, &woken);
     }
+
+#ifdef USE_FREERTOS
+    portEND_SWITCHING_ISR(woken ? pdTRUE : pdFALSE);
+#endif
+}
+
+/**
+ * Handles the transfer complete interrupt of the DMA receive stream
+ * \param[in] i2c_id I2C adapter handle
+ */
+void PIOS_I2C_DMA_IRQ_Handler(uint32_t i2c_id)
+{
+    struct pios_i2c_adapter *i2c_adapter = (struct pios_i2c_adapter *)i2c_id;
+    bool woken = false;
+
+    if (!PIOS_I2C_validate(i2c_adapter)) {
+        return;
+    }
+
+    DMA_ClearFlag(i2c_adapter->cfg->dma->rx.channel, i2c_adapter->cfg->dma->irq.flags);
+
+    PIOS_I2C_FSM_DMADone(&i2c_adapter->fsm, &woken);
+
+#ifdef USE_FREERTOS
+    portEND_SWITCHING_ISR(woken ? pdTRUE : pdFALSE);
+#endif
 }
 
 #endif /* PIOS_INCLUDE_I2C */
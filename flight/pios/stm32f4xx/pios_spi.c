@@ -44,6 +44,20 @@
 
 #define SPI_MAX_BLOCK_PIO 128
 
+static bool SPI_Queue_Claim(uint32_t spi_id, bool *woken);
+static void SPI_Queue_Release(uint32_t spi_id, bool *woken);
+static void SPI_Queue_SetSpeed(uint32_t spi_id, SPIPrescalerTypeDef prescaler);
+static void SPI_Queue_Select(uint32_t spi_id, uint32_t slave_id, bool selected);
+static void SPI_Queue_Start(uint32_t spi_id, const struct pios_spi_segment *segment);
+
+static const struct pios_spi_queue_driver spi_queue_driver = {
+    .claim     = SPI_Queue_Claim,
+    .release   = SPI_Queue_Release,
+    .set_speed = SPI_Queue_SetSpeed,
+    .select    = SPI_Queue_Select,
+    .start     = SPI_Queue_Start,
+};
+
 static bool PIOS_SPI_validate(__attribute__((unused)) struct pios_spi_dev *com_dev)
 {
     /* Should check device magic here */
@@ -93,11 +107,24 @@ int32_t PIOS_SPI_Init(uint32_t *spi_id, const struct pios_spi_cfg *cfg)
 #if defined(PIOS_INCLUDE_FREERTOS)
     vSemaphoreCreateBinary(spi_dev->busy);
     xSemaphoreGive(spi_dev->busy);
+
+    /* Completion semaphores start out taken, the DMA interrupt gives them */
+    vSemaphoreCreateBinary(spi_dev->dma_done);
+    xSemaphoreTake(spi_dev->dma_done, 0);
+    vSemaphoreCreateBinary(spi_dev->txn_done);
+    xSemaphoreTake(spi_dev->txn_done, 0);
+    spi_dev->txn_lock = xSemaphoreCreateMutex();
+#else
+    spi_dev->busy = 0;
 #endif
 
     /* Disable callback function */
     spi_dev->callback = NULL;
 
+    /* No queued transactions yet */
+    PIOS_SPI_Queue_Init(&spi_dev->queue, &spi_queue_driver, (uint32_t)spi_dev);
+    spi_dev->queue_transfer = false;
+
     /* Set rx/tx dummy bytes to a known value */
     spi_dev->rx_dummy_byte = 0xFF;
     spi_dev->tx_dummy_byte = 0xFF;
@@ -335,6 +362,9 @@ int32_t PIOS_SPI_ReleaseBus(uint32_t spi_id)
     spi_dev->busy = 0;
     PIOS_IRQ_Enable();
 #endif
+
+    /* Let transactions queued while the bus was claimed run now */
+    PIOS_SPI_Queue_Kick(&spi_dev->queue, NULL);
     return 0;
 }
 
@@ -358,6 +388,9 @@ int32_t PIOS_SPI_ReleaseBusISR(uint32_t spi_id, bool *woken)
     if (woken) {
         *woken = *woken || (higherPriorityTaskWoken == pdTRUE);
     }
+
+    /* Let transactions queued while the bus was claimed run now */
+    PIOS_SPI_Queue_Kick(&spi_dev->queue, woken);
     return 0;
 
 #else
@@ -444,36 +477,19 @@ int32_t PIOS_SPI_TransferByte(uint32_t spi_id, uint8_t b)
 }
 
 /**
- * Transfers a block of bytes via DMA.
- * \param[in] spi SPI number (0 or 1)
+ * Sets up both DMA streams for a block transfer and starts it. Does not wait.
+ * \param[in] spi_dev SPI device
  * \param[in] send_buffer pointer to buffer which should be sent.<BR>
  * If NULL, 0xff (all-one) will be sent.
  * \param[in] receive_buffer pointer to buffer which should get the received values.<BR>
  * If NULL, received bytes will be discarded.
  * \param[in] len number of bytes which should be transfered
- * \param[in] callback pointer to callback function which will be executed
- * from DMA channel interrupt once the transfer is finished.
- * If NULL, no callback function will be used, and PIOS_SPI_TransferBlock() will
- * block until the transfer is finished.
- * \return >= 0 if no error during transfer
- * \return -1 if disabled SPI port selected
- * \return -3 if function has been called during an ongoing DMA transfer
+ * \param[in] irq true to get PIOS_SPI_IRQ_Handler() called when the transfer is finished
  */
-static int32_t SPI_DMA_TransferBlock(uint32_t spi_id, const uint8_t *send_buffer, uint8_t *receive_buffer, uint16_t len, void *callback)
+static void SPI_DMA_StartTransfer(struct pios_spi_dev *spi_dev, const uint8_t *send_buffer, uint8_t *receive_buffer, uint16_t len, bool irq)
 {
-    struct pios_spi_dev *spi_dev = (struct pios_spi_dev *)spi_id;
-
-    bool valid = PIOS_SPI_validate(spi_dev);
-
-    PIOS_Assert(valid)
-
     DMA_InitTypeDef dma_init;
 
-    /* Exit if ongoing transfer */
-    if (DMA_GetCurrDataCounter(spi_dev->cfg->dma.rx.channel)) {
-        return -3;
-    }
-
     /* Disable the DMA channels */
     DMA_Cmd(spi_dev->cfg->dma.rx.channel, DISABLE);
     DMA_Cmd(spi_dev->cfg->dma.tx.channel, DISABLE);
@@ -500,9 +516,6 @@ static int32_t SPI_DMA_TransferBlock(uint32_t spi_id, const uint8_t *send_buffer
     /* Enable SPI interrupts to DMA */
     SPI_I2S_DMACmd(spi_dev->cfg->regs, SPI_I2S_DMAReq_Tx | SPI_I2S_DMAReq_Rx, ENABLE);
 
-    /* Set callback function */
-    spi_dev->callback = callback;
-
     /*
      * Configure Rx channel
      */
@@ -555,8 +568,8 @@ static int32_t SPI_DMA_TransferBlock(uint32_t spi_id, const uint8_t *send_buffer
 
     DMA_Init(spi_dev->cfg->dma.tx.channel, &(dma_init));
 
-    /* Enable DMA interrupt if callback function active */
-    DMA_ITConfig(spi_dev->cfg->dma.rx.channel, DMA_IT_TC, (callback != NULL) ? ENABLE : DISABLE);
+    /* Enable DMA interrupt if somebody is waiting for the completion */
+    DMA_ITConfig(spi_dev->cfg->dma.rx.channel, DMA_IT_TC, irq ? ENABLE : DISABLE);
 
     /* Flush out the CRC registers */
     SPI_CalculateCRC(spi_dev->cfg->regs, DISABLE);
@@ -577,28 +590,75 @@ static int32_t SPI_DMA_TransferBlock(uint32_t spi_id, const uint8_t *send_buffer
 
     /* Reenable the SPI device */
     SPI_Cmd(spi_dev->cfg->regs, ENABLE);
+}
+
+/**
+ * Transfers a block of bytes via DMA.
+ * \param[in] spi SPI number (0 or 1)
+ * \param[in] send_buffer pointer to buffer which should be sent.<BR>
+ * If NULL, 0xff (all-one) will be sent.
+ * \param[in] receive_buffer pointer to buffer which should get the received values.<BR>
+ * If NULL, received bytes will be discarded.
+ * \param[in] len number of bytes which should be transfered
+ * \param[in] callback pointer to callback function which will be executed
+ * from DMA channel interrupt once the transfer is finished.
+ * If NULL, no callback function will be used, and PIOS_SPI_TransferBlock() will
+ * block until the transfer is finished. Once the scheduler is running the
+ * calling task sleeps on the transfer complete interrupt instead of polling.
+ * \return >= 0 if no error during transfer
+ * \return -1 if disabled SPI port selected
+ * \return -3 if function has been called during an ongoing DMA transfer
+ */
+static int32_t SPI_DMA_TransferBlock(uint32_t spi_id, const uint8_t *send_buffer, uint8_t *receive_buffer, uint16_t len, void *callback)
+{
+    struct pios_spi_dev *spi_dev = (struct pios_spi_dev *)spi_id;
+
+    bool valid = PIOS_SPI_validate(spi_dev);
+
+    PIOS_Assert(valid)
+
+    /* Exit if ongoing transfer */
+    if (DMA_GetCurrDataCounter(spi_dev->cfg->dma.rx.channel)) {
+        return -3;
+    }
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+    bool sleep = (callback == NULL) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING);
+#else
+    bool sleep = false;
+#endif
+
+    /* Set callback function */
+    spi_dev->callback = callback;
+    spi_dev->queue_transfer = false;
+
+    SPI_DMA_StartTransfer(spi_dev, send_buffer, receive_buffer, len, (callback != NULL) || sleep);
 
     if (callback) {
         /* User has requested a callback, don't wait for the transfer to complete. */
         return 0;
     }
 
-    /* Wait until all bytes have been transmitted/received */
-    while (DMA_GetCurrDataCounter(spi_dev->cfg->dma.rx.channel)) {
+    if (sleep) {
 #if defined(PIOS_INCLUDE_FREERTOS)
-        vTaskDelay(0);
+        /* The interrupt handler waits for the final bytes and wakes us up */
+        xSemaphoreTake(spi_dev->dma_done, portMAX_DELAY);
 #endif
-        ;
-    }
+    } else {
+        /* Wait until all bytes have been transmitted/received */
+        while (DMA_GetCurrDataCounter(spi_dev->cfg->dma.rx.channel)) {
+            ;
+        }
 
-    /* Wait for the final bytes of the transfer to complete, including CRC byte(s). */
-    while (!(SPI_I2S_GetFlagStatus(spi_dev->cfg->regs, SPI_I2S_FLAG_TXE))) {
-        ;
-    }
+        /* Wait for the final bytes of the transfer to complete, including CRC byte(s). */
+        while (!(SPI_I2S_GetFlagStatus(spi_dev->cfg->regs, SPI_I2S_FLAG_TXE))) {
+            ;
+        }
 
-    /* Wait for the final bytes of the transfer to complete, including CRC byte(s). */
-    while (SPI_I2S_GetFlagStatus(spi_dev->cfg->regs, SPI_I2S_FLAG_BSY)) {
-        ;
+        /* Wait for the final bytes of the transfer to complete, including CRC byte(s). */
+        while (SPI_I2S_GetFlagStatus(spi_dev->cfg->regs, SPI_I2S_FLAG_BSY)) {
+            ;
+        }
     }
 
     /* Check the CRC on the transfer if enabled. */
@@ -702,6 +762,150 @@ int32_t PIOS_SPI_TransferBlock(uint32_t spi_id, const uint8_t *send_buffer, uint
     return SPI_PIO_TransferBlock(spi_id, send_buffer, receive_buffer, len);
 }
 
+/**
+ * Queues a transaction on the bus and returns immediately. The transaction is
+ * started as soon as the bus is free, chained from the DMA interrupt of the
+ * previous one. Can be called from task or interrupt context.
+ * \param[in] spi_id SPI device handle
+ * \param[in] txn transaction, owned by the driver until its callback has run
+ * \return 0 if queued
+ * \return -1 if the transaction is malformed
+ */
+int32_t PIOS_SPI_QueueTransaction(uint32_t spi_id, struct pios_spi_txn *txn)
+{
+    struct pios_spi_dev *spi_dev = (struct pios_spi_dev *)spi_id;
+
+    bool valid = PIOS_SPI_validate(spi_dev);
+
+    PIOS_Assert(valid)
+    PIOS_Assert(txn->slave_id < spi_dev->cfg->slave_count)
+
+    return PIOS_SPI_Queue_Submit(&spi_dev->queue, txn, NULL);
+}
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+static void SPI_Transaction_Done(struct pios_spi_txn *txn, bool *woken)
+{
+    struct pios_spi_dev *spi_dev = (struct pios_spi_dev *)txn->context;
+    signed portBASE_TYPE higherPriorityTaskWoken = pdFALSE;
+
+    xSemaphoreGiveFromISR(spi_dev->txn_done, &higherPriorityTaskWoken);
+    if (woken) {
+        *woken = *woken || (higherPriorityTaskWoken == pdTRUE);
+    }
+}
+#endif
+
+/**
+ * Queues a transaction and sleeps until it has completed. The callback and
+ * context of the transaction are used internally and get overwritten.
+ * Must not be called while holding the bus with PIOS_SPI_ClaimBus().
+ * \param[in] spi_id SPI device handle
+ * \param[in] txn transaction
+ * \return 0 if no error during transfer
+ * \return -1 if the transaction is malformed
+ * \return -4 on CRC error
+ */
+int32_t PIOS_SPI_Transaction(uint32_t spi_id, struct pios_spi_txn *txn)
+{
+    struct pios_spi_dev *spi_dev = (struct pios_spi_dev *)spi_id;
+
+    bool valid = PIOS_SPI_validate(spi_dev);
+
+    PIOS_Assert(valid)
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+    /* One synchronous waiter at a time, asynchronous users still interleave */
+    xSemaphoreTake(spi_dev->txn_lock, portMAX_DELAY);
+
+    txn->callback = SPI_Transaction_Done;
+    txn->context  = spi_dev;
+    if (PIOS_SPI_QueueTransaction(spi_id, txn) < 0) {
+        xSemaphoreGive(spi_dev->txn_lock);
+        return -1;
+    }
+    xSemaphoreTake(spi_dev->txn_done, portMAX_DELAY);
+
+    xSemaphoreGive(spi_dev->txn_lock);
+#else
+    txn->callback = NULL;
+    if (PIOS_SPI_QueueTransaction(spi_id, txn) < 0) {
+        return -1;
+    }
+    while (txn->result == PIOS_SPI_TXN_PENDING) {
+        ;
+    }
+#endif /* if defined(PIOS_INCLUDE_FREERTOS) */
+
+    return txn->result;
+}
+
+/*
+ * Transaction queue hooks, see pios_spi_queue.h
+ */
+static bool SPI_Queue_Claim(uint32_t spi_id, bool *woken)
+{
+    struct pios_spi_dev *spi_dev = (struct pios_spi_dev *)spi_id;
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+    signed portBASE_TYPE higherPriorityTaskWoken = pdFALSE;
+
+    if (xSemaphoreTakeFromISR(spi_dev->busy, &higherPriorityTaskWoken) != pdTRUE) {
+        return false;
+    }
+    if (woken) {
+        *woken = *woken || (higherPriorityTaskWoken == pdTRUE);
+    }
+#else
+    (void)woken;
+
+    /* Called with interrupts disabled */
+    if (spi_dev->busy) {
+        return false;
+    }
+    spi_dev->busy = 1;
+#endif
+    return true;
+}
+
+static void SPI_Queue_Release(uint32_t spi_id, bool *woken)
+{
+    struct pios_spi_dev *spi_dev = (struct pios_spi_dev *)spi_id;
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+    signed portBASE_TYPE higherPriorityTaskWoken = pdFALSE;
+
+    /* Not PIOS_SPI_ReleaseBusISR(), that would kick the queue again */
+    xSemaphoreGiveFromISR(spi_dev->busy, &higherPriorityTaskWoken);
+    if (woken) {
+        *woken = *woken || (higherPriorityTaskWoken == pdTRUE);
+    }
+#else
+    (void)woken;
+    spi_dev->busy = 0;
+#endif
+}
+
+static void SPI_Queue_SetSpeed(uint32_t spi_id, SPIPrescalerTypeDef prescaler)
+{
+    /* Only a byte clocked out with no slave selected, short enough for interrupt context */
+    PIOS_SPI_SetClockSpeed(spi_id, prescaler);
+}
+
+static void SPI_Queue_Select(uint32_t spi_id, uint32_t slave_id, bool selected)
+{
+    PIOS_SPI_RC_PinSet(spi_id, slave_id, selected ? 0 : 1);
+}
+
+static void SPI_Queue_Start(uint32_t spi_id, const struct pios_spi_segment *segment)
+{
+    struct pios_spi_dev *spi_dev = (struct pios_spi_dev *)spi_id;
+
+    spi_dev->callback = NULL;
+    spi_dev->queue_transfer = true;
+    SPI_DMA_StartTransfer(spi_dev, segment->send_buffer, segment->receive_buffer, segment->len, true);
+}
+
 /**
  * Check if a transfer is in progress
  * \param[in] spi SPI number (0 or 1)
@@ -751,7 +955,22 @@ void PIOS_SPI_IRQ_Handler(uint32_t spi_id)
         }
     }
 
-    if (spi_dev->callback != NULL) {
+    if (spi_dev->queue_transfer) {
+        bool woken = false;
+        int32_t result = 0;
+
+        spi_dev->queue_transfer = false;
+        if (spi_dev->cfg->use_crc && SPI_I2S_GetFlagStatus(spi_dev->cfg->regs, SPI_FLAG_CRCERR)) {
+            SPI_I2S_ClearFlag(spi_dev->cfg->regs, SPI_FLAG_CRCERR);
+            result = -4;
+        }
+
+        /* Starts the next segment or transaction straight away */
+        PIOS_SPI_Queue_SegmentDone(&spi_dev->queue, result, &woken);
+#if defined(PIOS_INCLUDE_FREERTOS)
+        portEND_SWITCHING_ISR(woken ? pdTRUE : pdFALSE);
+#endif
+    } else if (spi_dev->callback != NULL) {
         bool crc_ok = true;
         uint8_t crc_val;
 
@@ -761,6 +980,13 @@ void PIOS_SPI_IRQ_Handler(uint32_t spi_id)
         }
         crc_val = SPI_GetCRC(spi_dev->cfg->regs, SPI_CRC_Rx);
         spi_dev->callback(crc_ok, crc_val);
+    } else {
+#if defined(PIOS_INCLUDE_FREERTOS)
+        /* Blocking transfer, wake up the task sleeping in SPI_DMA_TransferBlock() */
+        signed portBASE_TYPE higherPriorityTaskWoken = pdFALSE;
+        xSemaphoreGiveFromISR(spi_dev->dma_done, &higherPriorityTaskWoken);
+        portEND_SWITCHING_ISR(higherPriorityTaskWoken);
+#endif
     }
 }
 
@@ -37,6 +37,7 @@
 #ifdef PIOS_INCLUDE_USART
 
 #include <pios_usart_priv.h>
+#include <pios_usart_dma.h>
 
 /* Provide a COM driver */
 static void PIOS_USART_ChangeBaud(uint32_t usart_id, uint32_t baud);
@@ -65,6 +66,10 @@ struct pios_usart_dev {
     uint32_t rx_in_context;
     pios_com_callback tx_out_cb;
     uint32_t tx_out_context;
+
+    /* Only used in DMA mode */
+    struct pios_usart_rx_ring rx_ring;
+    struct pios_usart_dma_tx  dma_tx;
 };
 
 static bool PIOS_USART_validate(struct pios_usart_dev *usart_dev)
@@ -156,6 +161,79 @@ static void PIOS_USART_6_irq_handler(void)
     PIOS_USART_generic_irq_handler(PIOS_USART_6_id);
 }
 
+static uint32_t PIOS_USART_id_from_regs(USART_TypeDef *regs)
+{
+    switch ((uint32_t)regs) {
+    case (uint32_t)USART1:
+        return PIOS_USART_1_id;
+
+    case (uint32_t)USART2:
+        return PIOS_USART_2_id;
+
+    case (uint32_t)USART3:
+        return PIOS_USART_3_id;
+
+    case (uint32_t)UART4:
+        return PIOS_USART_4_id;
+
+    case (uint32_t)UART5:
+        return PIOS_USART_5_id;
+
+    case (uint32_t)USART6:
+        return PIOS_USART_6_id;
+    }
+    return 0;
+}
+
+/**
+ * Set up both DMA streams, receive starts right away and never stops
+ */
+static int32_t PIOS_USART_DMA_Init(struct pios_usart_dev *usart_dev)
+{
+    const struct pios_usart_dma_cfg *dma = usart_dev->cfg->dma;
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+    uint8_t *rx_buf = (uint8_t *)pios_malloc(dma->rx_buf_len);
+    uint8_t *tx_buf = (uint8_t *)pios_malloc(dma->tx_buf_len);
+#else
+    uint8_t *rx_buf = NULL;
+    uint8_t *tx_buf = NULL;
+#endif
+    if (!rx_buf || !tx_buf) {
+        return -1;
+    }
+
+    PIOS_USART_RxRing_Init(&usart_dev->rx_ring, rx_buf, dma->rx_buf_len);
+    PIOS_USART_DMA_TxInit(&usart_dev->dma_tx, tx_buf, dma->tx_buf_len);
+
+    RCC_AHB1PeriphClockCmd(dma->ahb_clk, ENABLE);
+
+    DMA_InitTypeDef dma_init;
+
+    dma_init = dma->rx.init;
+    dma_init.DMA_Memory0BaseAddr = (uint32_t)rx_buf;
+    dma_init.DMA_BufferSize = dma->rx_buf_len;
+    DMA_DeInit(dma->rx.channel);
+    DMA_Init(dma->rx.channel, &dma_init);
+    DMA_ITConfig(dma->rx.channel, DMA_IT_HT | DMA_IT_TC, ENABLE);
+    NVIC_Init((NVIC_InitTypeDef *)&dma->rx_irq.init);
+    DMA_Cmd(dma->rx.channel, ENABLE);
+
+    /* The length is set for every transfer */
+    dma_init = dma->tx.init;
+    dma_init.DMA_Memory0BaseAddr = (uint32_t)tx_buf;
+    dma_init.DMA_BufferSize = dma->tx_buf_len;
+    DMA_DeInit(dma->tx.channel);
+    DMA_Init(dma->tx.channel, &dma_init);
+    DMA_ITConfig(dma->tx.channel, DMA_IT_TC, ENABLE);
+    NVIC_Init((NVIC_InitTypeDef *)&dma->tx_irq.init);
+
+    USART_DMACmd(usart_dev->cfg->regs, USART_DMAReq_Rx | USART_DMAReq_Tx, ENABLE);
+    USART_ITConfig(usart_dev->cfg->regs, USART_IT_IDLE, ENABLE);
+
+    return 0;
+}
+
 /**
  * Initialise a single USART device
  */
@@ -215,9 +293,15 @@ int32_t PIOS_USART_Init(uint32_t *usart_id, const struct pios_usart_cfg *cfg)
         PIOS_USART_6_id = (uint32_t)usart_dev;
         break;
     }
+    if (usart_dev->cfg->dma) {
+        if (PIOS_USART_DMA_Init(usart_dev)) {
+            goto out_fail;
+        }
+    } else {
+        USART_ITConfig(usart_dev->cfg->regs, USART_IT_RXNE, ENABLE);
+        USART_ITConfig(usart_dev->cfg->regs, USART_IT_TXE, ENABLE);
+    }
     NVIC_Init((NVIC_InitTypeDef *)&(usart_dev->cfg->irq.init));
-    USART_ITConfig(usart_dev->cfg->regs, USART_IT_RXNE, ENABLE);
-    USART_ITConfig(usart_dev->cfg->regs, USART_IT_TXE, ENABLE);
 
     // FIXME XXX Clear / reset uart here - sends NUL char else
 
@@ -238,6 +322,11 @@ static void PIOS_USART_RxStart(uint32_t usart_id, __attribute__((unused)) uint16
 
     PIOS_Assert(valid);
 
+    if (usart_dev->cfg->dma) {
+        /* Receive DMA never stops, whatever did not fit was dropped */
+        return;
+    }
+
     USART_ITConfig(usart_dev->cfg->regs, USART_IT_RXNE, ENABLE);
 }
 static void PIOS_USART_TxStart(uint32_t usart_id, __attribute__((unused)) uint16_t tx_bytes_avail)
@@ -248,6 +337,15 @@ static void PIOS_USART_TxStart(uint32_t usart_id, __attribute__((unused)) uint16
 
     PIOS_Assert(valid);
 
+    if (usart_dev->cfg->dma) {
+        /*
+         * Let the tx stream interrupt pull the data, the COM callback is
+         * then only ever called from that one context.
+         */
+        NVIC_SetPendingIRQ(usart_dev->cfg->dma->tx_irq.init.NVIC_IRQChannel);
+        return;
+    }
+
     USART_ITConfig(usart_dev->cfg->regs, USART_IT_TXE, ENABLE);
 }
 
@@ -308,6 +406,78 @@ static void PIOS_USART_RegisterTxCallback(uint32_t usart_id, pios_com_callback t
     usart_dev->tx_out_cb = tx_out_cb;
 }
 
+static void PIOS_USART_dma_rx_drain(struct pios_usart_dev *usart_dev, bool *need_yield)
+{
+    uint16_t remaining = DMA_GetCurrDataCounter(usart_dev->cfg->dma->rx.channel);
+
+    (void)PIOS_USART_RxRing_Drain(&usart_dev->rx_ring, remaining, usart_dev->rx_in_cb, usart_dev->rx_in_context, need_yield);
+}
+
+static void PIOS_USART_dma_idle_irq_handler(struct pios_usart_dev *usart_dev)
+{
+    uint16_t sr = usart_dev->cfg->regs->SR;
+
+    /*
+     * Only touch DR when the line went idle, any other time it may hold a
+     * byte the rx stream has not picked up yet. Reading it after SR clears
+     * IDLE and any error flags.
+     */
+    if (!(sr & USART_SR_IDLE)) {
+        return;
+    }
+    (void)usart_dev->cfg->regs->DR;
+
+    bool need_yield = false;
+    PIOS_USART_dma_rx_drain(usart_dev, &need_yield);
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (need_yield) {
+        vPortYield();
+    }
+#endif /* PIOS_INCLUDE_FREERTOS */
+}
+
+/**
+ * Handler for both DMA streams of a USART in DMA mode
+ * \param[in] regs USART the streams belong to
+ */
+void PIOS_USART_DMA_IRQ_Handler(USART_TypeDef *regs)
+{
+    struct pios_usart_dev *usart_dev = (struct pios_usart_dev *)PIOS_USART_id_from_regs(regs);
+
+    bool valid = PIOS_USART_validate(usart_dev);
+
+    PIOS_Assert(valid);
+    PIOS_Assert(usart_dev->cfg->dma);
+
+    const struct pios_usart_dma_cfg *dma = usart_dev->cfg->dma;
+
+    /* Half and full transfer of the circular receive, just drain what is there */
+    DMA_ClearFlag(dma->rx.channel, dma->rx_irq.flags);
+    bool rx_need_yield = false;
+    PIOS_USART_dma_rx_drain(usart_dev, &rx_need_yield);
+
+    /*
+     * Transfer complete disables the stream. Also entered through TxStart
+     * with the stream idle or still busy, TxNext sorts that out.
+     */
+    bool done = (DMA_GetCmdStatus(dma->tx.channel) == DISABLE);
+    DMA_ClearFlag(dma->tx.channel, dma->tx_irq.flags);
+
+    bool tx_need_yield = false;
+    uint16_t bytes_to_send = PIOS_USART_DMA_TxNext(&usart_dev->dma_tx, done, usart_dev->tx_out_cb, usart_dev->tx_out_context, &tx_need_yield);
+    if (bytes_to_send > 0) {
+        DMA_SetCurrDataCounter(dma->tx.channel, bytes_to_send);
+        DMA_Cmd(dma->tx.channel, ENABLE);
+    }
+
+#if defined(PIOS_INCLUDE_FREERTOS)
+    if (rx_need_yield || tx_need_yield) {
+        vPortYield();
+    }
+#endif /* PIOS_INCLUDE_FREERTOS */
+}
+
 static void PIOS_USART_generic_irq_handler(uint32_t usart_id)
 {
     struct pios_usart_dev *usart_dev = (struct pios_usart_dev *)usart_id;
@@ -316,6 +486,11 @@ static void PIOS_USART_generic_irq_handler(uint32_t usart_id)
 
     PIOS_Assert(valid);
 
+    if (usart_dev->cfg->dma) {
+        PIOS_USART_dma_idle_irq_handler(usart_dev);
+        return;
+    }
+
     /* Force read of dr after sr to make sure to clear error flags */
     volatile uint16_t sr = usart_dev->cfg->regs->SR;
     volatile uint8_t dr  = usart_dev->cfg->regs->DR;
@@ -215,6 +215,42 @@ void PIOS_USB_RegisterDisconnectionCallback(void (*disconnectionCB)(void))
     }
     PIOS_Assert(0);
 }
+
+/**
+ * Keep the USB interrupt, and those of the same or lower priority, from
+ * running. Higher priority interrupts are left alone. Nests, from task or
+ * interrupt context.
+ * \return mask to hand back to PIOS_USB_IRQ_Restore()
+ */
+uint32_t PIOS_USB_IRQ_Mask(__attribute__((unused)) uint32_t id)
+{
+    struct pios_usb_dev *usb_dev = (struct pios_usb_dev *)pios_usb_id;
+    uint32_t basepri = __get_BASEPRI();
+
+    if (!PIOS_USB_validate(usb_dev)) {
+        return basepri;
+    }
+
+    /* Priority 0 can't be masked through BASEPRI */
+    uint32_t level = (uint32_t)usb_dev->cfg->irq.init.NVIC_IRQChannelPreemptionPriority << (8 - __NVIC_PRIO_BITS);
+    PIOS_DEBUG_Assert(level != 0);
+
+    /* Only ever raise the mask, an enclosing section may have masked more already */
+    if (basepri == 0 || level < basepri) {
+        __set_BASEPRI(level);
+    }
+    return basepri;
+}
+
+/**
+ * End a section started with PIOS_USB_IRQ_Mask()
+ * \param[in] mask value returned by the matching PIOS_USB_IRQ_Mask()
+ */
+void PIOS_USB_IRQ_Restore(uint32_t mask)
+{
+    __set_BASEPRI(mask);
+}
+
 #ifdef PIOS_INCLUDE_FREERTOS
 static void raiseDisconnectionCallbacks(void)
 {
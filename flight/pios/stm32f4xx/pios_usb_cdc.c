@@ -36,6 +36,12 @@
 #include "pios_usb_cdc_priv.h"
 #include "pios_usb_board_data.h" /* PIOS_BOARD_*_DATA_LENGTH */
 #include "pios_usbhook.h" /* PIOS_USBHOOK_* */
+#include "pios_usb_bulk.h" /* PIOS_USB_Bulk* */
+
+/* Size of each of the two transmit buffers, a multiple of the packet size */
+#ifndef PIOS_USB_CDC_TX_BUF_LEN
+#define PIOS_USB_CDC_TX_BUF_LEN (4 * PIOS_USB_BOARD_CDC_DATA_LENGTH)
+#endif
 
 /* Implement COM layer driver API */
 static void PIOS_USB_CDC_RegisterTxCallback(uint32_t usbcdc_id, pios_com_callback tx_out_cb, uint32_t context);
@@ -72,20 +78,14 @@ struct pios_usb_cdc_dev {
 
     uint8_t  rx_packet_buffer[PIOS_USB_BOARD_CDC_DATA_LENGTH] __attribute__((aligned(4)));
     volatile bool rx_active;
+    struct pios_usb_bulk_rx rx;
 
-    /*
-     * NOTE: This is -1 as somewhat of a hack.  It ensures that we always send packets
-     * that are strictly < maxPacketSize for this interface which means we never have
-     * to bother with zero length packets (ZLP).
-     */
-    uint8_t  tx_packet_buffer[PIOS_USB_BOARD_CDC_DATA_LENGTH - 1] __attribute__((aligned(4)));
-    volatile bool tx_active;
+    /* Transfers span several packets, one buffer is filled while the other is sent */
+    uint8_t  tx_buffer[2][PIOS_USB_CDC_TX_BUF_LEN] __attribute__((aligned(4)));
+    struct pios_usb_bulk_tx tx;
 
     uint8_t  ctrl_tx_packet_buffer[PIOS_USB_BOARD_CDC_MGMT_LENGTH] __attribute__((aligned(4)));
 
-    uint32_t rx_dropped;
-    uint32_t rx_oversize;
-
     /*
      * Used to hold the current state of the simulated UART.  Changes to this
      * variable may trigger new USB CDC Notification packets to be sent to the host.
@@ -178,13 +178,18 @@ int32_t PIOS_USB_CDC_Init(uint32_t *usbcdc_id, const struct pios_usb_cdc_cfg *cf
 
     pios_usb_cdc_id  = (uint32_t)usb_cdc_dev;
 
-    /* Rx and Tx are not active yet */
+    /* Rx and Tx are not active yet, this also clears the stats */
     usb_cdc_dev->rx_active           = false;
-    usb_cdc_dev->tx_active           = false;
-
-    /* Clear stats */
-    usb_cdc_dev->rx_dropped          = 0;
-    usb_cdc_dev->rx_oversize         = 0;
+    PIOS_USB_BulkRx_Init(&usb_cdc_dev->rx,
+                         usb_cdc_dev->rx_packet_buffer,
+                         sizeof(usb_cdc_dev->rx_packet_buffer),
+                         0);
+    PIOS_USB_BulkTx_Init(&usb_cdc_dev->tx,
+                         usb_cdc_dev->tx_buffer[0],
+                         usb_cdc_dev->tx_buffer[1],
+                         sizeof(usb_cdc_dev->tx_buffer[0]),
+                         PIOS_USB_BOARD_CDC_DATA_LENGTH,
+                         0);
 
     /* Initialize the uart state */
     usb_cdc_dev->prev_uart_state     = 0;
@@ -205,33 +210,25 @@ out_fail:
     return -1;
 }
 
-static bool PIOS_USB_CDC_SendData(struct pios_usb_cdc_dev *usb_cdc_dev)
+/**
+ * Start the next transfer if the endpoint is free, else get the spare buffer ready
+ * \param[in] done the previous transfer just completed
+ * \return true when a transfer was started
+ */
+static bool PIOS_USB_CDC_SendData(struct pios_usb_cdc_dev *usb_cdc_dev, bool done)
 {
-    uint16_t bytes_to_tx;
-
-    if (!usb_cdc_dev->tx_out_cb) {
-        return false;
-    }
-
+    uint8_t *buf;
+    uint16_t len;
     bool need_yield = false;
-    bytes_to_tx = (usb_cdc_dev->tx_out_cb)(usb_cdc_dev->tx_out_context,
-                                           usb_cdc_dev->tx_packet_buffer,
-                                           sizeof(usb_cdc_dev->tx_packet_buffer),
-                                           NULL,
-                                           &need_yield);
-    if (bytes_to_tx == 0) {
-        return false;
-    }
-
-    /*
-     * Mark this endpoint as being tx active _before_ actually transmitting
-     * to make sure we don't race with the Tx completion interrupt
-     */
-    usb_cdc_dev->tx_active = true;
 
-    PIOS_USBHOOK_EndpointTx(usb_cdc_dev->cfg->data_tx_ep,
-                            usb_cdc_dev->tx_packet_buffer,
-                            bytes_to_tx);
+    bool start = PIOS_USB_BulkTx_Next(&usb_cdc_dev->tx, done,
+                                      usb_cdc_dev->tx_out_cb,
+                                      usb_cdc_dev->tx_out_context,
+                                      &need_yield, &buf, &len);
+    if (start) {
+        /* len is 0 for a zero length packet ending a transfer on a packet boundary */
+        PIOS_USBHOOK_EndpointTx(usb_cdc_dev->cfg->data_tx_ep, buf, len);
+    }
 
 #if defined(PIOS_INCLUDE_FREERTOS)
     if (need_yield) {
@@ -239,7 +236,7 @@ static bool PIOS_USB_CDC_SendData(struct pios_usb_cdc_dev *usb_cdc_dev)
     }
 #endif /* PIOS_INCLUDE_FREERTOS */
 
-    return true;
+    return start;
 }
 
 static void PIOS_USB_CDC_RxStart(uint32_t usbcdc_id, uint16_t rx_bytes_avail)
@@ -260,7 +257,7 @@ static void PIOS_USB_CDC_RxStart(uint32_t usbcdc_id, uint16_t rx_bytes_avail)
     }
 
     // If endpoint was stalled and there is now space make it valid
-    if (!usb_cdc_dev->rx_active && (rx_bytes_avail >= PIOS_USB_BOARD_CDC_DATA_LENGTH)) {
+    if (!usb_cdc_dev->rx_active && (rx_bytes_avail >= PIOS_USB_BulkRx_MaxPayload(&usb_cdc_dev->rx))) {
         PIOS_USBHOOK_EndpointRx(usb_cdc_dev->cfg->data_rx_ep,
                                 usb_cdc_dev->rx_packet_buffer,
                                 sizeof(usb_cdc_dev->rx_packet_buffer));
@@ -285,10 +282,28 @@ static void PIOS_USB_CDC_TxStart(uint32_t usbcdc_id, __attribute__((unused)) uin
         return;
     }
 
-    if (!usb_cdc_dev->tx_active) {
-        /* Transmitter is not currently active, send a report */
-        PIOS_USB_CDC_SendData(usb_cdc_dev);
-    }
+    /*
+     * Starts a transfer when the transmitter is idle, or fills the spare
+     * buffer for the completion interrupt to send. Either way the endpoint
+     * interrupt must not run in between, the others may.
+     */
+    uint32_t irq_mask = PIOS_USB_IRQ_Mask(usb_cdc_dev->lower_id);
+    PIOS_USB_CDC_SendData(usb_cdc_dev, false);
+    PIOS_USB_IRQ_Restore(irq_mask);
+}
+
+/**
+ * Get the transfer counters of the data interface
+ */
+void PIOS_USB_CDC_GetStats(uint32_t usbcdc_id, struct pios_usb_bulk_stats *stats)
+{
+    struct pios_usb_cdc_dev *usb_cdc_dev = (struct pios_usb_cdc_dev *)usbcdc_id;
+
+    bool valid = PIOS_USB_CDC_validate(usb_cdc_dev);
+
+    PIOS_Assert(valid);
+
+    PIOS_USB_Bulk_GetStats(&usb_cdc_dev->tx, &usb_cdc_dev->rx, stats);
 }
 
 static void PIOS_USB_CDC_RegisterRxCallback(uint32_t usbcdc_id, pios_com_callback rx_in_cb, uint32_t context)
@@ -553,13 +568,15 @@ static void PIOS_USB_CDC_DATA_IF_Init(uint32_t usb_cdc_id)
 
     /* Register endpoint specific callbacks with the USBHOOK layer */
     PIOS_USBHOOK_RegisterEpInCallback(usb_cdc_dev->cfg->data_tx_ep,
-                                      sizeof(usb_cdc_dev->tx_packet_buffer),
+                                      PIOS_USB_BOARD_CDC_DATA_LENGTH,
                                       PIOS_USB_CDC_DATA_EP_IN_Callback,
                                       (uint32_t)usb_cdc_dev);
     PIOS_USBHOOK_RegisterEpOutCallback(usb_cdc_dev->cfg->data_rx_ep,
                                        sizeof(usb_cdc_dev->rx_packet_buffer),
                                        PIOS_USB_CDC_DATA_EP_OUT_Callback,
                                        (uint32_t)usb_cdc_dev);
+    PIOS_USB_BulkTx_Reset(&usb_cdc_dev->tx);
+    usb_cdc_dev->rx_active = false;
     usb_cdc_dev->usb_data_if_enabled = true;
 }
 
@@ -573,6 +590,8 @@ static void PIOS_USB_CDC_DATA_IF_DeInit(uint32_t usb_cdc_id)
 
     /* DeRegister endpoint specific callbacks with the USBHOOK layer */
     usb_cdc_dev->usb_data_if_enabled = false;
+    PIOS_USB_BulkTx_Reset(&usb_cdc_dev->tx);
+    usb_cdc_dev->rx_active = false;
     PIOS_USBHOOK_DeRegisterEpInCallback(usb_cdc_dev->cfg->data_tx_ep);
     PIOS_USBHOOK_DeRegisterEpOutCallback(usb_cdc_dev->cfg->data_rx_ep);
 }
@@ -601,7 +620,7 @@ static void PIOS_USB_CDC_DATA_IF_CtrlDataOut(
 
 /**
  * @brief Callback used to indicate a transmission from device INto host completed
- * Checks if any data remains, pads it into HID packet and sends.
+ * Sends the buffer filled in the meantime, more data or a zero length packet.
  */
 static bool PIOS_USB_CDC_DATA_EP_IN_Callback(
     __attribute__((unused)) uint32_t usb_cdc_id,
@@ -614,13 +633,8 @@ static bool PIOS_USB_CDC_DATA_EP_IN_Callback(
 
     PIOS_Assert(valid);
 
-    bool rc = PIOS_USB_CDC_SendData(usb_cdc_dev);
-    if (!rc) {
-        /* No additional data was transmitted, note that tx is no longer active */
-        usb_cdc_dev->tx_active = false;
-    }
-
-    return rc;
+    /* false leaves the transmitter idle until the next TxStart */
+    return PIOS_USB_CDC_SendData(usb_cdc_dev, true);
 }
 
 static bool PIOS_USB_CDC_DATA_EP_OUT_Callback(
@@ -634,41 +648,20 @@ static bool PIOS_USB_CDC_DATA_EP_OUT_Callback(
         return false;
     }
 
-    if (len > sizeof(usb_cdc_dev->rx_packet_buffer)) {
-        len = sizeof(usb_cdc_dev->rx_packet_buffer);
-    }
-
-    if (!usb_cdc_dev->rx_in_cb) {
-        /* No Rx call back registered, disable the receiver */
-        usb_cdc_dev->rx_active = false;
-        return false;
-    }
-
-    uint16_t headroom;
     bool need_yield = false;
-    uint16_t bytes_rxed;
-    bytes_rxed = (usb_cdc_dev->rx_in_cb)(usb_cdc_dev->rx_in_context,
-                                         usb_cdc_dev->rx_packet_buffer,
-                                         len,
-                                         &headroom,
-                                         &need_yield);
-
-    if (bytes_rxed < len) {
-        /* Lost bytes on rx */
-        usb_cdc_dev->rx_dropped += (len - bytes_rxed);
-    }
+    bool rc = PIOS_USB_BulkRx_Done(&usb_cdc_dev->rx, len,
+                                   usb_cdc_dev->rx_in_cb,
+                                   usb_cdc_dev->rx_in_context,
+                                   &need_yield);
 
-    bool rc;
-    if (headroom >= sizeof(usb_cdc_dev->rx_packet_buffer)) {
+    if (rc) {
         /* We have room for a maximum length message */
         PIOS_USBHOOK_EndpointRx(usb_cdc_dev->cfg->data_rx_ep,
                                 usb_cdc_dev->rx_packet_buffer,
                                 sizeof(usb_cdc_dev->rx_packet_buffer));
-        rc = true;
     } else {
-        /* Not enough room left for a message, apply backpressure */
+        /* Not enough room left for a message or nobody listening, apply backpressure */
         usb_cdc_dev->rx_active = false;
-        rc = false;
     }
 
 #if defined(PIOS_INCLUDE_FREERTOS)
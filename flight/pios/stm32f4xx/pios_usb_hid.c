@@ -36,7 +36,21 @@
 #include <pios_usb_hid_priv.h>
 #include "pios_usb_board_data.h" /* PIOS_BOARD_*_DATA_LENGTH */
 #include <pios_usbhook.h> /* PIOS_USBHOOK_* */
+#include <pios_usb_bulk.h> /* PIOS_USB_Bulk* */
 #include <pios_delay.h>
+
+/* Reports sent back to back by one transfer */
+#ifndef PIOS_USB_HID_TX_REPORTS
+#define PIOS_USB_HID_TX_REPORTS 4
+#endif
+
+/* Report ID, then the payload length unless the bootloader protocol leaves it out */
+#ifdef PIOS_USB_BOARD_BL_HID_HAS_NO_LENGTH_BYTE
+#define PIOS_USB_HID_HEADER_LEN 1
+#else
+#define PIOS_USB_HID_HEADER_LEN 2
+#endif
+
 static void PIOS_USB_HID_RegisterTxCallback(uint32_t usbhid_id, pios_com_callback tx_out_cb, uint32_t context);
 static void PIOS_USB_HID_RegisterRxCallback(uint32_t usbhid_id, pios_com_callback rx_in_cb, uint32_t context);
 static void PIOS_USB_HID_TxStart(uint32_t usbhid_id, uint16_t tx_bytes_avail);
@@ -69,12 +83,11 @@ struct pios_usb_hid_dev {
 
     uint8_t  rx_packet_buffer[PIOS_USB_BOARD_HID_DATA_LENGTH] __attribute__((aligned(4)));
     volatile bool rx_active;
+    struct pios_usb_bulk_rx rx;
 
-    uint8_t  tx_packet_buffer[PIOS_USB_BOARD_HID_DATA_LENGTH] __attribute__((aligned(4)));
-    volatile bool tx_active;
-
-    uint32_t rx_dropped;
-    uint32_t rx_oversize;
+    /* One buffer is filled with reports while the other is sent */
+    uint8_t  tx_buffer[2][PIOS_USB_HID_TX_REPORTS * PIOS_USB_BOARD_HID_DATA_LENGTH] __attribute__((aligned(4)));
+    struct pios_usb_bulk_tx tx;
 };
 
 static bool PIOS_USB_HID_validate(struct pios_usb_hid_dev *usb_hid_dev)
@@ -147,9 +160,18 @@ int32_t PIOS_USB_HID_Init(uint32_t *usbhid_id, const struct pios_usb_hid_cfg *cf
     usb_hid_dev->cfg = cfg;
     usb_hid_dev->lower_id  = lower_id;
 
-    /* Rx and Tx are not active yet */
+    /* Rx and Tx are not active yet, this also clears the stats */
     usb_hid_dev->rx_active = false;
-    usb_hid_dev->tx_active = false;
+    PIOS_USB_BulkRx_Init(&usb_hid_dev->rx,
+                         usb_hid_dev->rx_packet_buffer,
+                         sizeof(usb_hid_dev->rx_packet_buffer),
+                         PIOS_USB_HID_HEADER_LEN);
+    PIOS_USB_BulkTx_Init(&usb_hid_dev->tx,
+                         usb_hid_dev->tx_buffer[0],
+                         usb_hid_dev->tx_buffer[1],
+                         sizeof(usb_hid_dev->tx_buffer[0]),
+                         PIOS_USB_BOARD_HID_DATA_LENGTH,
+                         PIOS_USB_HID_HEADER_LEN);
 
     /* Register class specific interface callbacks with the USBHOOK layer */
     usb_hid_dev->usb_if_enabled = false;
@@ -180,59 +202,34 @@ void PIOS_USB_HID_RegisterHidReport(const uint8_t *desc, uint16_t length)
     hid_report_desc.length     = length;
 }
 
-static bool PIOS_USB_HID_SendReport(struct pios_usb_hid_dev *usb_hid_dev)
+/**
+ * Start the next transfer if the endpoint is free, else get the spare buffer ready
+ * \param[in] done the previous transfer just completed
+ * \return true when a transfer was started
+ */
+static bool PIOS_USB_HID_SendReport(struct pios_usb_hid_dev *usb_hid_dev, bool done)
 {
-    uint16_t bytes_to_tx;
+    uint8_t *buf;
+    uint16_t len;
 
-    if (!usb_hid_dev->tx_out_cb) {
-        return false;
-    }
     READ_MEMORY_BARRIER();
     bool need_yield = false;
-#ifdef PIOS_USB_BOARD_BL_HID_HAS_NO_LENGTH_BYTE
-    bytes_to_tx = (usb_hid_dev->tx_out_cb)(usb_hid_dev->tx_out_context,
-                                           &usb_hid_dev->tx_packet_buffer[1],
-                                           sizeof(usb_hid_dev->tx_packet_buffer) - 1,
-                                           NULL,
-                                           &need_yield);
-#else
-    bytes_to_tx = (usb_hid_dev->tx_out_cb)(usb_hid_dev->tx_out_context,
-                                           &usb_hid_dev->tx_packet_buffer[2],
-                                           sizeof(usb_hid_dev->tx_packet_buffer) - 2,
-                                           NULL,
-                                           &need_yield);
-#endif
-    if (bytes_to_tx == 0) {
-        return false;
+    bool start = PIOS_USB_BulkTx_Next(&usb_hid_dev->tx, done,
+                                      usb_hid_dev->tx_out_cb,
+                                      usb_hid_dev->tx_out_context,
+                                      &need_yield, &buf, &len);
+    if (start) {
+        /* Whole reports, the report ID and length are filled in already */
+        PIOS_USBHOOK_EndpointTx(usb_hid_dev->cfg->data_tx_ep, buf, len);
     }
 
-    /*
-     * Mark this endpoint as being tx active _before_ actually transmitting
-     * to make sure we don't race with the Tx completion interrupt
-     */
-    usb_hid_dev->tx_active = true;
-
-    /* Always set type as report ID */
-    usb_hid_dev->tx_packet_buffer[0] = 1;
-
-#ifdef PIOS_USB_BOARD_BL_HID_HAS_NO_LENGTH_BYTE
-    PIOS_USBHOOK_EndpointTx(usb_hid_dev->cfg->data_tx_ep,
-                            usb_hid_dev->tx_packet_buffer,
-                            sizeof(usb_hid_dev->tx_packet_buffer));
-#else
-    usb_hid_dev->tx_packet_buffer[1] = bytes_to_tx;
-    PIOS_USBHOOK_EndpointTx(usb_hid_dev->cfg->data_tx_ep,
-                            usb_hid_dev->tx_packet_buffer,
-                            sizeof(usb_hid_dev->tx_packet_buffer));
-#endif
-
 #if defined(PIOS_INCLUDE_FREERTOS)
     if (need_yield) {
         vPortYield();
     }
 #endif /* PIOS_INCLUDE_FREERTOS */
 
-    return true;
+    return start;
 }
 
 static void PIOS_USB_HID_RxStart(uint32_t usbhid_id, uint16_t rx_bytes_avail)
@@ -253,13 +250,7 @@ static void PIOS_USB_HID_RxStart(uint32_t usbhid_id, uint16_t rx_bytes_avail)
     }
 
     // If endpoint was stalled and there is now space make it valid
-#ifdef PIOS_USB_BOARD_BL_HID_HAS_NO_LENGTH_BYTE
-    uint16_t max_payload_length = PIOS_USB_BOARD_HID_DATA_LENGTH - 1;
-#else
-    uint16_t max_payload_length = PIOS_USB_BOARD_HID_DATA_LENGTH - 2;
-#endif
-
-    if (!usb_hid_dev->rx_active && (rx_bytes_avail >= max_payload_length)) {
+    if (!usb_hid_dev->rx_active && (rx_bytes_avail >= PIOS_USB_BulkRx_MaxPayload(&usb_hid_dev->rx))) {
         PIOS_USBHOOK_EndpointRx(usb_hid_dev->cfg->data_rx_ep,
                                 usb_hid_dev->rx_packet_buffer,
                                 sizeof(usb_hid_dev->rx_packet_buffer));
@@ -284,10 +275,28 @@ static void PIOS_USB_HID_TxStart(uint32_t usbhid_id, __attribute__((unused)) uin
         return;
     }
 
-    if (!usb_hid_dev->tx_active) {
-        /* Transmitter is not currently active, send a report */
-        PIOS_USB_HID_SendReport(usb_hid_dev);
-    }
+    /*
+     * Starts a transfer when the transmitter is idle, or fills the spare
+     * buffer for the completion interrupt to send. Either way the endpoint
+     * interrupt must not run in between, the others may.
+     */
+    uint32_t irq_mask = PIOS_USB_IRQ_Mask(usb_hid_dev->lower_id);
+    PIOS_USB_HID_SendReport(usb_hid_dev, false);
+    PIOS_USB_IRQ_Restore(irq_mask);
+}
+
+/**
+ * Get the transfer counters of the HID interface
+ */
+void PIOS_USB_HID_GetStats(uint32_t usbhid_id, struct pios_usb_bulk_stats *stats)
+{
+    struct pios_usb_hid_dev *usb_hid_dev = (struct pios_usb_hid_dev *)usbhid_id;
+
+    bool valid = PIOS_USB_HID_validate(usb_hid_dev);
+
+    PIOS_Assert(valid);
+
+    PIOS_USB_Bulk_GetStats(&usb_hid_dev->tx, &usb_hid_dev->rx, stats);
 }
 
 static void PIOS_USB_HID_RegisterRxCallback(uint32_t usbhid_id, pios_com_callback rx_in_cb, uint32_t context)
@@ -334,7 +343,7 @@ static void PIOS_USB_HID_IF_Init(uint32_t usb_hid_id)
 
     /* Register endpoint specific callbacks with the USBHOOK layer */
     PIOS_USBHOOK_RegisterEpInCallback(usb_hid_dev->cfg->data_tx_ep,
-                                      sizeof(usb_hid_dev->tx_packet_buffer),
+                                      PIOS_USB_BOARD_HID_DATA_LENGTH,
                                       PIOS_USB_HID_EP_IN_Callback,
                                       (uint32_t)usb_hid_dev);
     PIOS_USBHOOK_RegisterEpOutCallback(usb_hid_dev->cfg->data_rx_ep,
@@ -342,7 +351,7 @@ static void PIOS_USB_HID_IF_Init(uint32_t usb_hid_id)
                                        PIOS_USB_HID_EP_OUT_Callback,
                                        (uint32_t)usb_hid_dev);
     usb_hid_dev->usb_if_enabled = true;
-    usb_hid_dev->tx_active = false;
+    PIOS_USB_BulkTx_Reset(&usb_hid_dev->tx);
     usb_hid_dev->rx_active = false;
 }
 
@@ -356,7 +365,7 @@ static void PIOS_USB_HID_IF_DeInit(uint32_t usb_hid_id)
 
     /* DeRegister endpoint specific callbacks with the USBHOOK layer */
     usb_hid_dev->usb_if_enabled = false;
-    usb_hid_dev->tx_active = false;
+    PIOS_USB_BulkTx_Reset(&usb_hid_dev->tx);
     usb_hid_dev->rx_active = false;
     PIOS_USBHOOK_DeRegisterEpInCallback(usb_hid_dev->cfg->data_tx_ep);
     PIOS_USBHOOK_DeRegisterEpOutCallback(usb_hid_dev->cfg->data_rx_ep);
@@ -462,7 +471,7 @@ static void PIOS_USB_HID_IF_CtrlDataOut(__attribute__((unused)) uint32_t usb_hid
 
 /**
  * @brief Callback used to indicate a transmission from device INto host completed
- * Checks if any data remains, pads it into HID packet and sends.
+ * Sends the reports queued up in the meantime, or as many as there is data for.
  */
 static bool PIOS_USB_HID_EP_IN_Callback(uint32_t usb_hid_id, __attribute__((unused)) uint8_t epnum, __attribute__((unused)) uint16_t len)
 {
@@ -472,15 +481,14 @@ static bool PIOS_USB_HID_EP_IN_Callback(uint32_t usb_hid_id, __attribute__((unus
         return false;
     }
 
-    if (PIOS_USB_CheckAvailable(usb_hid_dev->lower_id) &&
-        PIOS_USB_HID_SendReport(usb_hid_dev)) {
-        /* More data has been queued, leave tx_active set to true */
-        return true;
-    } else {
-        /* Nothing new sent, transmitter is now inactive */
-        usb_hid_dev->tx_active = false;
+    if (!PIOS_USB_CheckAvailable(usb_hid_dev->lower_id)) {
+        /* Drop whatever was queued, TxStart starts over once the host is back */
+        PIOS_USB_BulkTx_Reset(&usb_hid_dev->tx);
         return false;
     }
+
+    /* false leaves the transmitter idle until the next TxStart */
+    return PIOS_USB_HID_SendReport(usb_hid_dev, true);
 }
 
 /**
@@ -494,50 +502,22 @@ static bool PIOS_USB_HID_EP_OUT_Callback(uint32_t usb_hid_id, __attribute__((unu
         return false;
     }
 
-    if (len > sizeof(usb_hid_dev->rx_packet_buffer)) {
-        len = sizeof(usb_hid_dev->rx_packet_buffer);
-    }
-
-    if (!usb_hid_dev->rx_in_cb) {
-        /* No Rx call back registered, disable the receiver */
-        usb_hid_dev->rx_active = false;
-        return false;
-    }
     READ_MEMORY_BARRIER();
     /* The first byte is report ID (not checked), the second byte is the valid data length */
-    uint16_t headroom;
     bool need_yield = false;
-#ifdef PIOS_USB_BOARD_BL_HID_HAS_NO_LENGTH_BYTE
-    (usb_hid_dev->rx_in_cb)(usb_hid_dev->rx_in_context,
-                            &usb_hid_dev->rx_packet_buffer[1],
-                            len - 1,
-                            &headroom,
-                            &need_yield);
-#else
-    (usb_hid_dev->rx_in_cb)(usb_hid_dev->rx_in_context,
-                            &usb_hid_dev->rx_packet_buffer[2],
-                            usb_hid_dev->rx_packet_buffer[1],
-                            &headroom,
-                            &need_yield);
-#endif
-
-#ifdef PIOS_USB_BOARD_BL_HID_HAS_NO_LENGTH_BYTE
-    uint16_t max_payload_length = PIOS_USB_BOARD_HID_DATA_LENGTH - 1;
-#else
-    uint16_t max_payload_length = PIOS_USB_BOARD_HID_DATA_LENGTH - 2;
-#endif
+    bool rc = PIOS_USB_BulkRx_Done(&usb_hid_dev->rx, len,
+                                   usb_hid_dev->rx_in_cb,
+                                   usb_hid_dev->rx_in_context,
+                                   &need_yield);
 
-    bool rc;
-    if (headroom >= max_payload_length) {
+    if (rc) {
         /* We have room for a maximum length message */
         PIOS_USBHOOK_EndpointRx(usb_hid_dev->cfg->data_rx_ep,
                                 usb_hid_dev->rx_packet_buffer,
                                 sizeof(usb_hid_dev->rx_packet_buffer));
-        rc = true;
     } else {
-        /* Not enough room left for a message, apply backpressure */
+        /* Not enough room left for a message or nobody listening, apply backpressure */
         usb_hid_dev->rx_active = false;
-        rc = false;
     }
 
 #if defined(PIOS_INCLUDE_FREERTOS)
@@ -36,8 +36,11 @@
 #include "task.h"
 
 
-// framebuffer
+// led colors, PIOS_WS2811_BYTES_PER_LED per led in wire order
+static uint8_t *grb = 0;
+// circular DMA buffer, a half is expanded while the other one is sent
 static ledbuf_t *fb = 0;
+static struct pios_ws2811_stream stream;
 // bitmask with pin to be set/reset using dma
 static ledbuf_t dmaSource[4];
 
@@ -118,9 +121,10 @@ static void genericTIM_OCxPreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreloa
     .dmaItUpdate   = DMA_IT_TEIF5 | DMA_IT_TCIF5,
     .dmaSource     = TIM_DMA_CC1 | TIM_DMA_CC3 | TIM_DMA_Update,
 
-    // DMA streamCh1 interrupt vector, used to block timer at end of framebuffer transfer
+    // DMA streamCh1 interrupt vector, used to refill the framebuffer halves and
+    // to block timer at end of the strip
     .irq = {
-        .flags = (DMA_IT_TCIF1),
+        .flags = (DMA_IT_HTIF1 | DMA_IT_TCIF1),
         .init  = {
             .NVIC_IRQChannel    = DMA2_Stream1_IRQn,
             .NVIC_IRQChannelPreemptionPriority = PIOS_IRQ_PRIO_HIGH,
@@ -150,7 +154,12 @@ static void genericTIM_OCxPreloadConfig(TIM_TypeDef *TIMx, uint16_t TIM_OCPreloa
  * - streamUpdate dma stream, triggered by update event will produce a logic 1 on the output pin
  * - streamCh1 will bring the pin to 0 if framebuffer location is set to dmaSource value to send a "0" bit to WS281x
  * - streamCh2 will bring pin to 0 once .8us are passed to send a "1" bit to ws281x
- * Once StreamCh1 has finished to send the buffer the IRQ handler will stop the timer.
+ *
+ * The framebuffer holds PIOS_WS2811_STREAM_LEDS leds in each of its two halves,
+ * streamCh1 runs circular over it. On every half and full transfer interrupt the
+ * half just sent is expanded from the next led colors while the other one goes
+ * out. Once the half holding the last led has been sent the IRQ handler will
+ * stop the timer.
  *
  */
 
@@ -175,8 +184,11 @@ void PIOS_WS2811_Init(const struct pios_ws2811_cfg *ws2811_cfg, const struct pio
         dmaSource[i] = (ledbuf_t)pios_ws2811_pin_cfg->gpioInit.GPIO_Pin;
     }
 
-    fb = (ledbuf_t *)pios_malloc(PIOS_WS2811_BUFFER_SIZE * sizeof(ledbuf_t));
+    grb = (uint8_t *)pios_malloc(PIOS_WS2811_NUMLEDS * PIOS_WS2811_BYTES_PER_LED);
+    fb  = (ledbuf_t *)pios_malloc(PIOS_WS2811_BUFFER_SIZE * sizeof(ledbuf_t));
+    PIOS_Assert(grb && fb);
     memset(fb, 0, PIOS_WS2811_BUFFER_SIZE * sizeof(ledbuf_t));
+    PIOS_WS2811_Stream_Init(&stream, grb, PIOS_WS2811_NUMLEDS, fb, PIOS_WS2811_STREAM_LEDS, dmaSource[0]);
     const Color_t ledoff = Color_Off;
     for (uint8_t i = 0; i < PIOS_WS2811_NUMLEDS; i++) {
         PIOS_WS2811_setColorRGB(ledoff, i, false);
@@ -267,7 +279,7 @@ void setupDMA()
     pios_ws2811_cfg->streamCh1->M0AR = (uint32_t)fb;
 
     NVIC_Init((NVIC_InitTypeDef *)&(pios_ws2811_cfg->irq.init));
-    DMA_ITConfig(pios_ws2811_cfg->streamCh1, DMA_IT_TC, ENABLE);
+    DMA_ITConfig(pios_ws2811_cfg->streamCh1, DMA_IT_HT | DMA_IT_TC, ENABLE);
 
 
     DMA_Init(pios_ws2811_cfg->streamCh2, (DMA_InitTypeDef *)&pios_ws2811_cfg->dmaInitCh2);
@@ -281,19 +293,6 @@ void setupDMA()
     DMA_ClearITPendingBit(pios_ws2811_cfg->streamCh1, pios_ws2811_cfg->dmaItCh1);
     DMA_ClearITPendingBit(pios_ws2811_cfg->streamCh2, pios_ws2811_cfg->dmaItCh2);
     DMA_ClearITPendingBit(pios_ws2811_cfg->streamUpdate, pios_ws2811_cfg->dmaItUpdate);
-
-    DMA_Cmd(pios_ws2811_cfg->streamCh2, ENABLE);
-    DMA_Cmd(pios_ws2811_cfg->streamCh1, ENABLE);
-    DMA_Cmd(pios_ws2811_cfg->streamUpdate, ENABLE);
-}
-
-void setColor(uint8_t color, ledbuf_t *buf)
-{
-    uint8_t i;
-
-    for (i = 0; i < 8; i++) {
-        buf[i] = ((color << i) & 0b10000000 ? 0x0 : dmaSource[0]);
-    }
 }
 
 /**
@@ -307,9 +306,10 @@ void PIOS_WS2811_setColorRGB(Color_t c, uint8_t led, bool update)
     if (led >= PIOS_WS2811_NUMLEDS) {
         return;
     }
-    setColor(c.G, fb + (led * 24));
-    setColor(c.R, fb + 8 + (led * 24));
-    setColor(c.B, fb + 16 + (led * 24));
+    uint8_t *dst = grb + (led * PIOS_WS2811_BYTES_PER_LED);
+    dst[0] = c.G;
+    dst[1] = c.R;
+    dst[2] = c.B;
 
     if (update) {
         PIOS_WS2811_Update();
@@ -326,8 +326,14 @@ void PIOS_WS2811_Update()
         return;
     }
 
+    if (!PIOS_WS2811_Stream_Start(&stream)) {
+        return;
+    }
+
     // reset counters for synchronization
     pios_ws2811_cfg->timer->CNT = PIOS_WS2811_TIM_PERIOD - 1;
+    // the last transfer may have been stopped anywhere, always start from the first half
+    DMA_SetCurrDataCounter(pios_ws2811_cfg->streamCh1, PIOS_WS2811_BUFFER_SIZE);
 
     DMA_Cmd(pios_ws2811_cfg->streamCh2, ENABLE);
     DMA_Cmd(pios_ws2811_cfg->streamCh1, ENABLE);
@@ -337,14 +343,18 @@ void PIOS_WS2811_Update()
 }
 
 /**
- * Stop timer once the complete framebuffer has been sent
+ * Refill the framebuffer half just sent, stop timer once the last led has been sent
  */
 
 void PIOS_WS2811_DMA_irq_handler()
 {
+    DMA_ClearFlag(pios_ws2811_cfg->streamCh1, pios_ws2811_cfg->irq.flags);
+    if (PIOS_WS2811_Stream_HalfDone(&stream)) {
+        return;
+    }
+
     pios_ws2811_pin_cfg->gpio->BSRRH = dmaSource[0];
     pios_ws2811_cfg->timer->CR1 &= (uint16_t) ~TIM_CR1_CEN;
-    DMA_ClearFlag(pios_ws2811_cfg->streamCh1, pios_ws2811_cfg->irq.flags);
     DMA_Cmd(pios_ws2811_cfg->streamCh2, DISABLE);
     DMA_Cmd(pios_ws2811_cfg->streamCh1, DISABLE);
     DMA_Cmd(pios_ws2811_cfg->streamUpdate, DISABLE);
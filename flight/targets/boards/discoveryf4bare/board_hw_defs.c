@@ -1859,9 +1859,10 @@ const struct pios_ws2811_cfg pios_ws2811_cfg = {
     .dmaItUpdate   = DMA_IT_TEIF5 | DMA_IT_TCIF5,
     .dmaSource     = TIM_DMA_CC1 | TIM_DMA_CC3 | TIM_DMA_Update,
 
-    // DMA streamCh1 interrupt vector, used to block timer at end of framebuffer transfer
+    // DMA streamCh1 interrupt vector. The stream is circular (PIOS_WS2811_DMA_CH1_CONFIG), the half and full
+    // transfer interrupts refill the framebuffer half just sent and block timer at end of the strip
     .irq                                       = {
-        .flags = (DMA_IT_TCIF1),
+        .flags = (DMA_IT_HTIF1 | DMA_IT_TCIF1),
         .init  = {
             .NVIC_IRQChannel    = DMA2_Stream1_IRQn,
             .NVIC_IRQChannelPreemptionPriority = PIOS_IRQ_PRIO_HIGHEST,
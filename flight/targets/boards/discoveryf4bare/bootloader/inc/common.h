@@ -82,8 +82,8 @@ typedef enum {
 /**************************************************/
 typedef enum {
     FW, // 0
-    Descript
-// 2
+    Descript, // 1
+    FWCompressed // 2
 } DFUTransfer;
 /**************************************************/
 /* OP_DFU transfer port                           */
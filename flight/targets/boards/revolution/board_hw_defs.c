@@ -726,6 +726,80 @@ static const struct flashfs_logfs_cfg flashfs_internal_cfg = {
 /*
  * MAIN USART
  */
+
+/*
+ * Telemetry and GPS run on DMA. Receive on DMA2 Stream2, transmit on DMA2
+ * Stream7, the other USART1 receive stream (Stream5) is taken by the WS2811.
+ */
+void PIOS_USART_main_dma_irq_handler(void);
+void DMA2_Stream2_IRQHandler(void) __attribute__((alias("PIOS_USART_main_dma_irq_handler")));
+void DMA2_Stream7_IRQHandler(void) __attribute__((alias("PIOS_USART_main_dma_irq_handler")));
+
+void PIOS_USART_main_dma_irq_handler(void)
+{
+    PIOS_USART_DMA_IRQ_Handler(USART1);
+}
+
+static const struct pios_usart_dma_cfg pios_usart_main_dma_cfg = {
+    .ahb_clk = RCC_AHB1Periph_DMA2,
+    .rx_irq  = {
+        .flags = (DMA_IT_TCIF2 | DMA_IT_TEIF2 | DMA_IT_HTIF2 | DMA_IT_DMEIF2 | DMA_IT_FEIF2),
+        .init  = {
+            .NVIC_IRQChannel    = DMA2_Stream2_IRQn,
+            .NVIC_IRQChannelPreemptionPriority = PIOS_IRQ_PRIO_MID,
+            .NVIC_IRQChannelSubPriority        = 0,
+            .NVIC_IRQChannelCmd = ENABLE,
+        },
+    },
+    .tx_irq                                    = {
+        .flags = (DMA_IT_TCIF7 | DMA_IT_TEIF7 | DMA_IT_HTIF7 | DMA_IT_DMEIF7 | DMA_IT_FEIF7),
+        .init  = {
+            .NVIC_IRQChannel    = DMA2_Stream7_IRQn,
+            .NVIC_IRQChannelPreemptionPriority = PIOS_IRQ_PRIO_MID,
+            .NVIC_IRQChannelSubPriority        = 0,
+            .NVIC_IRQChannelCmd = ENABLE,
+        },
+    },
+    .rx                                        = {
+        .channel = DMA2_Stream2,
+        .init    = {
+            .DMA_Channel            = DMA_Channel_4,
+            .DMA_PeripheralBaseAddr = (uint32_t)&(USART1->DR),
+            .DMA_DIR                = DMA_DIR_PeripheralToMemory,
+            .DMA_PeripheralInc      = DMA_PeripheralInc_Disable,
+            .DMA_MemoryInc          = DMA_MemoryInc_Enable,
+            .DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte,
+            .DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte,
+            .DMA_Mode               = DMA_Mode_Circular,
+            .DMA_Priority           = DMA_Priority_Medium,
+            .DMA_FIFOMode           = DMA_FIFOMode_Disable,
+            .DMA_FIFOThreshold      = DMA_FIFOThreshold_Full,
+            .DMA_MemoryBurst        = DMA_MemoryBurst_Single,
+            .DMA_PeripheralBurst    = DMA_PeripheralBurst_Single,
+        },
+    },
+    .tx                                        = {
+        .channel = DMA2_Stream7,
+        .init    = {
+            .DMA_Channel            = DMA_Channel_4,
+            .DMA_PeripheralBaseAddr = (uint32_t)&(USART1->DR),
+            .DMA_DIR                = DMA_DIR_MemoryToPeripheral,
+            .DMA_PeripheralInc      = DMA_PeripheralInc_Disable,
+            .DMA_MemoryInc          = DMA_MemoryInc_Enable,
+            .DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte,
+            .DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte,
+            .DMA_Mode               = DMA_Mode_Normal,
+            .DMA_Priority           = DMA_Priority_Medium,
+            .DMA_FIFOMode           = DMA_FIFOMode_Disable,
+            .DMA_FIFOThreshold      = DMA_FIFOThreshold_Full,
+            .DMA_MemoryBurst        = DMA_MemoryBurst_Single,
+            .DMA_PeripheralBurst    = DMA_PeripheralBurst_Single,
+        },
+    },
+    .rx_buf_len                                = 128,
+    .tx_buf_len                                = 64,
+};
+
 static const struct pios_usart_cfg pios_usart_main_cfg = {
     .regs  = USART1,
     .remap = GPIO_AF_USART1,
@@ -765,6 +839,7 @@ static const struct pios_usart_cfg pios_usart_main_cfg = {
             .GPIO_PuPd  = GPIO_PuPd_UP
         },
     },
+    .dma = &pios_usart_main_dma_cfg,
 };
 #endif /* PIOS_INCLUDE_COM_TELEM */
 
@@ -904,6 +979,77 @@ static const struct pios_sbus_cfg pios_sbus_cfg = {
 /*
  * FLEXI PORT
  */
+
+/* Receive on DMA1 Stream1, transmit on DMA1 Stream3 */
+void PIOS_USART_flexi_dma_irq_handler(void);
+void DMA1_Stream1_IRQHandler(void) __attribute__((alias("PIOS_USART_flexi_dma_irq_handler")));
+void DMA1_Stream3_IRQHandler(void) __attribute__((alias("PIOS_USART_flexi_dma_irq_handler")));
+
+void PIOS_USART_flexi_dma_irq_handler(void)
+{
+    PIOS_USART_DMA_IRQ_Handler(USART3);
+}
+
+static const struct pios_usart_dma_cfg pios_usart_flexi_dma_cfg = {
+    .ahb_clk = RCC_AHB1Periph_DMA1,
+    .rx_irq  = {
+        .flags = (DMA_IT_TCIF1 | DMA_IT_TEIF1 | DMA_IT_HTIF1 | DMA_IT_DMEIF1 | DMA_IT_FEIF1),
+        .init  = {
+            .NVIC_IRQChannel    = DMA1_Stream1_IRQn,
+            .NVIC_IRQChannelPreemptionPriority = PIOS_IRQ_PRIO_MID,
+            .NVIC_IRQChannelSubPriority        = 0,
+            .NVIC_IRQChannelCmd = ENABLE,
+        },
+    },
+    .tx_irq                                    = {
+        .flags = (DMA_IT_TCIF3 | DMA_IT_TEIF3 | DMA_IT_HTIF3 | DMA_IT_DMEIF3 | DMA_IT_FEIF3),
+        .init  = {
+            .NVIC_IRQChannel    = DMA1_Stream3_IRQn,
+            .NVIC_IRQChannelPreemptionPriority = PIOS_IRQ_PRIO_MID,
+            .NVIC_IRQChannelSubPriority        = 0,
+            .NVIC_IRQChannelCmd = ENABLE,
+        },
+    },
+    .rx                                        = {
+        .channel = DMA1_Stream1,
+        .init    = {
+            .DMA_Channel            = DMA_Channel_4,
+            .DMA_PeripheralBaseAddr = (uint32_t)&(USART3->DR),
+            .DMA_DIR                = DMA_DIR_PeripheralToMemory,
+            .DMA_PeripheralInc      = DMA_PeripheralInc_Disable,
+            .DMA_MemoryInc          = DMA_MemoryInc_Enable,
+            .DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte,
+            .DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte,
+            .DMA_Mode               = DMA_Mode_Circular,
+            .DMA_Priority           = DMA_Priority_Medium,
+            .DMA_FIFOMode           = DMA_FIFOMode_Disable,
+            .DMA_FIFOThreshold      = DMA_FIFOThreshold_Full,
+            .DMA_MemoryBurst        = DMA_MemoryBurst_Single,
+            .DMA_PeripheralBurst    = DMA_PeripheralBurst_Single,
+        },
+    },
+    .tx                                        = {
+        .channel = DMA1_Stream3,
+        .init    = {
+            .DMA_Channel            = DMA_Channel_4,
+            .DMA_PeripheralBaseAddr = (uint32_t)&(USART3->DR),
+            .DMA_DIR                = DMA_DIR_MemoryToPeripheral,
+            .DMA_PeripheralInc      = DMA_PeripheralInc_Disable,
+            .DMA_MemoryInc          = DMA_MemoryInc_Enable,
+            .DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte,
+            .DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte,
+            .DMA_Mode               = DMA_Mode_Normal,
+            .DMA_Priority           = DMA_Priority_Medium,
+            .DMA_FIFOMode           = DMA_FIFOMode_Disable,
+            .DMA_FIFOThreshold      = DMA_FIFOThreshold_Full,
+            .DMA_MemoryBurst        = DMA_MemoryBurst_Single,
+            .DMA_PeripheralBurst    = DMA_PeripheralBurst_Single,
+        },
+    },
+    .rx_buf_len                                = 128,
+    .tx_buf_len                                = 64,
+};
+
 static const struct pios_usart_cfg pios_usart_flexi_cfg = {
     .regs  = USART3,
     .remap = GPIO_AF_USART3,
@@ -944,6 +1090,7 @@ static const struct pios_usart_cfg pios_usart_flexi_cfg = {
             .GPIO_PuPd  = GPIO_PuPd_UP
         },
     },
+    .dma = &pios_usart_flexi_dma_cfg,
 };
 
 #endif /* PIOS_INCLUDE_COM_FLEXI */
@@ -1229,6 +1376,42 @@ void PIOS_I2C_flexiport_adapter_ev_irq_handler(void);
 void PIOS_I2C_flexiport_adapter_er_irq_handler(void);
 void I2C2_EV_IRQHandler() __attribute__((alias("PIOS_I2C_flexiport_adapter_ev_irq_handler")));
 void I2C2_ER_IRQHandler() __attribute__((alias("PIOS_I2C_flexiport_adapter_er_irq_handler")));
+void PIOS_I2C_flexiport_adapter_dma_irq_handler(void);
+void DMA1_Stream2_IRQHandler(void) __attribute__((alias("PIOS_I2C_flexiport_adapter_dma_irq_handler")));
+
+/*
+ * Reads of two bytes or more are moved by DMA. The only I2C2_TX stream
+ * (DMA1 Stream7) is taken by the overo, writes stay interrupt driven.
+ */
+static const struct stm32_dma pios_i2c_flexiport_adapter_dma = {
+    .irq                                       = {
+        .flags = (DMA_IT_TCIF2 | DMA_IT_TEIF2 | DMA_IT_HTIF2 | DMA_IT_DMEIF2 | DMA_IT_FEIF2),
+        .init  = {
+            .NVIC_IRQChannel    = DMA1_Stream2_IRQn,
+            .NVIC_IRQChannelPreemptionPriority = PIOS_IRQ_PRIO_HIGHEST,
+            .NVIC_IRQChannelSubPriority        = 0,
+            .NVIC_IRQChannelCmd = ENABLE,
+        },
+    },
+    .rx                                        = {
+        .channel = DMA1_Stream2,
+        .init    = {
+            .DMA_Channel            = DMA_Channel_7,
+            .DMA_PeripheralBaseAddr = (uint32_t)&(I2C2->DR),
+            .DMA_DIR                = DMA_DIR_PeripheralToMemory,
+            .DMA_PeripheralInc      = DMA_PeripheralInc_Disable,
+            .DMA_MemoryInc          = DMA_MemoryInc_Enable,
+            .DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte,
+            .DMA_MemoryDataSize     = DMA_MemoryDataSize_Byte,
+            .DMA_Mode               = DMA_Mode_Normal,
+            .DMA_Priority           = DMA_Priority_Medium,
+            .DMA_FIFOMode           = DMA_FIFOMode_Disable,
+            .DMA_FIFOThreshold      = DMA_FIFOThreshold_Full,
+            .DMA_MemoryBurst        = DMA_MemoryBurst_Single,
+            .DMA_PeripheralBurst    = DMA_PeripheralBurst_Single,
+        },
+    },
+};
 
 static const struct pios_i2c_adapter_cfg pios_i2c_flexiport_adapter_cfg = {
     .regs  = I2C2,
@@ -1280,6 +1463,7 @@ static const struct pios_i2c_adapter_cfg pios_i2c_flexiport_adapter_cfg = {
             .NVIC_IRQChannelCmd = ENABLE,
         },
     },
+    .dma = &pios_i2c_flexiport_adapter_dma,
 };
 
 uint32_t pios_i2c_flexiport_adapter_id;
@@ -1295,6 +1479,12 @@ void PIOS_I2C_flexiport_adapter_er_irq_handler(void)
     PIOS_I2C_ER_IRQ_Handler(pios_i2c_flexiport_adapter_id);
 }
 
+void PIOS_I2C_flexiport_adapter_dma_irq_handler(void)
+{
+    /* Call into the generic code to handle the IRQ for this specific device */
+    PIOS_I2C_DMA_IRQ_Handler(pios_i2c_flexiport_adapter_id);
+}
+
 
 void PIOS_I2C_pressure_adapter_ev_irq_handler(void);
 void PIOS_I2C_pressure_adapter_er_irq_handler(void);
@@ -2127,9 +2317,9 @@ const struct pios_ws2811_cfg pios_ws2811_cfg = {
     .dmaItUpdate   = DMA_IT_TEIF5 | DMA_IT_TCIF5,
     .dmaSource     = TIM_DMA_CC1 | TIM_DMA_CC3 | TIM_DMA_Update,
 
-    // DMAInitCh1 interrupt vector, used to block timer at end of framebuffer transfer
+    // DMAInitCh1 interrupt vector, used to refill the framebuffer halves and to block timer at end of the strip
     .irq                                       = {
-        .flags = (DMA_IT_TCIF1),
+        .flags = (DMA_IT_HTIF1 | DMA_IT_TCIF1),
         .init  = {
             .NVIC_IRQChannel    = DMA2_Stream1_IRQn,
             .NVIC_IRQChannelPreemptionPriority = PIOS_IRQ_PRIO_HIGHEST,
@@ -0,0 +1,247 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <algorithm>
+#include <vector>
+
+extern "C" {
+#include "pios.h"
+#include "pios_adc_filter.h"
+}
+
+#define FULL_SCALE ((1 << PIOS_ADC_FILTER_INPUT_BITS) - 1)
+#define ONE        (1U << PIOS_ADC_FILTER_FRAC_BITS)
+
+static std::vector<uint16_t> noise(size_t len, uint32_t seed)
+{
+    std::vector<uint16_t> v(len);
+
+    for (size_t i = 0; i < len; i++) {
+        seed = seed * 1103515245 + 12345;
+        v[i] = (seed >> 16) & FULL_SCALE;
+    }
+    return v;
+}
+
+/*
+ * Straight convolution with order boxcars of length ratio, every ratio-th
+ * result divided by the gain, in 64 bits and without any recursion.
+ */
+static std::vector<uint32_t> reference(const std::vector<uint16_t> & x, uint16_t ratio, uint8_t order)
+{
+    std::vector<uint64_t> h(1, 1);
+
+    for (uint8_t k = 0; k < order; k++) {
+        std::vector<uint64_t> next(h.size() + ratio - 1, 0);
+        for (size_t i = 0; i < h.size(); i++) {
+            for (uint16_t j = 0; j < ratio; j++) {
+                next[i + j] += h[i];
+            }
+        }
+        h = next;
+    }
+
+    uint64_t gain = 1;
+    for (uint8_t k = 0; k < order; k++) {
+        gain *= ratio;
+    }
+
+    std::vector<uint32_t> out;
+    for (size_t n = ratio - 1; n < x.size(); n += ratio) {
+        uint64_t sum = 0;
+        for (size_t j = 0; j < h.size() && j <= n; j++) {
+            sum += h[j] * x[n - j];
+        }
+        out.push_back((sum * ONE + gain / 2) / gain);
+    }
+    return out;
+}
+
+class AdcFilter : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        memset(&filter, 0xa5, sizeof(filter));
+        outputs.clear();
+        timestamps.clear();
+    }
+
+    void init(uint16_t ratio, uint8_t decimation, uint8_t order = 1, uint8_t iir_shift = 0)
+    {
+        struct pios_adc_filter_cfg cfg = { ratio, decimation, order, iir_shift };
+
+        ASSERT_EQ(0, PIOS_ADC_Filter_Init(&filter, &cfg));
+    }
+
+    /*
+     * Feed in blocks like the DMA buffers, collecting the published values.
+     * Only the last one of a block is seen, ratio must not be below block.
+     */
+    void feed(const std::vector<uint16_t> & x, uint16_t block, uint32_t timestamp = 0)
+    {
+        for (size_t i = 0; i < x.size(); i += block) {
+            uint16_t n = std::min((size_t)block, x.size() - i);
+            uint32_t count = filter.count;
+            bool published = PIOS_ADC_Filter_Process(&filter, &x[i], n, 1, timestamp + i);
+            EXPECT_EQ(published, filter.count != count);
+            if (published) {
+                outputs.push_back(filter.value);
+                timestamps.push_back(filter.timestamp);
+            }
+        }
+    }
+
+    struct pios_adc_filter filter;
+    std::vector<uint32_t>  outputs;
+    std::vector<uint32_t>  timestamps;
+};
+
+TEST_F(AdcFilter, InvalidConfigurations) {
+    struct pios_adc_filter_cfg cfg;
+
+    cfg = (struct pios_adc_filter_cfg) { 16, PIOS_ADC_FILTER_CIC, 0, 0 };
+    EXPECT_EQ(-1, PIOS_ADC_Filter_Init(&filter, &cfg));
+    cfg = (struct pios_adc_filter_cfg) { 16, PIOS_ADC_FILTER_CIC, PIOS_ADC_FILTER_MAX_ORDER + 1, 0 };
+    EXPECT_EQ(-1, PIOS_ADC_Filter_Init(&filter, &cfg));
+    cfg = (struct pios_adc_filter_cfg) { 16, 7, 1, 0 };
+    EXPECT_EQ(-1, PIOS_ADC_Filter_Init(&filter, &cfg));
+    cfg = (struct pios_adc_filter_cfg) { 16, PIOS_ADC_FILTER_BOXCAR, 1, 16 };
+    EXPECT_EQ(-1, PIOS_ADC_Filter_Init(&filter, &cfg));
+
+    /* Register growth: 12 bits plus 3 * 7 bits fits, 3 * 8 does not */
+    cfg = (struct pios_adc_filter_cfg) { 101, PIOS_ADC_FILTER_CIC, 3, 0 };
+    EXPECT_EQ(0, PIOS_ADC_Filter_Init(&filter, &cfg));
+    cfg = (struct pios_adc_filter_cfg) { 102, PIOS_ADC_FILTER_CIC, 3, 0 };
+    EXPECT_EQ(-1, PIOS_ADC_Filter_Init(&filter, &cfg));
+    cfg = (struct pios_adc_filter_cfg) { 1024, PIOS_ADC_FILTER_CIC, 2, 0 };
+    EXPECT_EQ(0, PIOS_ADC_Filter_Init(&filter, &cfg));
+}
+
+TEST_F(AdcFilter, DisabledChannel) {
+    std::vector<uint16_t> x(100, 1000);
+
+    init(0, PIOS_ADC_FILTER_BOXCAR);
+    feed(x, 8);
+    EXPECT_TRUE(outputs.empty());
+    EXPECT_EQ(0U, filter.count);
+}
+
+TEST_F(AdcFilter, BoxcarAverages) {
+    std::vector<uint16_t> x;
+
+    for (int i = 0; i < 40; i++) {
+        x.push_back(i);
+    }
+    init(10, PIOS_ADC_FILTER_BOXCAR);
+    feed(x, 8);
+
+    /* 4.5, 14.5, 24.5, 34.5 */
+    ASSERT_EQ(4U, outputs.size());
+    EXPECT_EQ(4 * ONE + ONE / 2, outputs[0]);
+    EXPECT_EQ(34 * ONE + ONE / 2, outputs[3]);
+}
+
+TEST_F(AdcFilter, BoxcarMatchesReference) {
+    std::vector<uint16_t> x = noise(5000, 1);
+
+    init(24, PIOS_ADC_FILTER_BOXCAR);
+    feed(x, 8);
+    EXPECT_EQ(reference(x, 24, 1), outputs);
+}
+
+TEST_F(AdcFilter, CicMatchesReference) {
+    for (uint8_t order = 1; order <= PIOS_ADC_FILTER_MAX_ORDER; order++) {
+        for (uint16_t ratio = 7; ratio <= 40; ratio += 11) {
+            SetUp();
+            std::vector<uint16_t> x = noise(4000, order * 100 + ratio);
+            std::vector<uint32_t> expected = reference(x, ratio, order);
+
+            init(ratio, PIOS_ADC_FILTER_CIC, order);
+            feed(x, 7);
+
+            /* The first order - 1 outputs are held back while the combs fill */
+            expected.erase(expected.begin(), expected.begin() + order - 1);
+            EXPECT_EQ(expected, outputs) << "order " << (int)order << " ratio " << ratio;
+        }
+    }
+}
+
+TEST_F(AdcFilter, CicRegistersWrap) {
+    /* Full scale for long enough to wrap the integrators many times */
+    std::vector<uint16_t> x(200000, FULL_SCALE);
+
+    init(101, PIOS_ADC_FILTER_CIC, 3);
+    feed(x, 64);
+    ASSERT_FALSE(outputs.empty());
+    for (size_t i = 0; i < outputs.size(); i++) {
+        ASSERT_EQ((uint32_t)FULL_SCALE * ONE, outputs[i]) << "output " << i;
+    }
+}
+
+TEST_F(AdcFilter, CicStepSettles) {
+    std::vector<uint16_t> x(64, 0);
+
+    x.resize(256, 2000);
+    init(16, PIOS_ADC_FILTER_CIC, 3);
+    feed(x, 8);
+
+    /* Monotonic on a step, and exact once the step has filled the window */
+    for (size_t i = 1; i < outputs.size(); i++) {
+        EXPECT_GE(outputs[i], outputs[i - 1]);
+    }
+    EXPECT_EQ(2000U * ONE, outputs.back());
+}
+
+TEST_F(AdcFilter, IirSmoothing) {
+    std::vector<uint16_t> x(8, 1000);
+
+    init(8, PIOS_ADC_FILTER_BOXCAR, 1, 2);
+
+    /* The first output initializes the state */
+    feed(x, 8);
+    ASSERT_EQ(1U, outputs.size());
+    EXPECT_EQ(1000U * ONE, outputs[0]);
+
+    /* Then a quarter of the way to every new value */
+    x.assign(8 * 20, 2000);
+    feed(x, 8);
+    ASSERT_EQ(21U, outputs.size());
+    EXPECT_EQ(1250U * ONE, outputs[1]);
+    EXPECT_NEAR(1437.5 * ONE, outputs[2], 1);
+    for (size_t i = 2; i < outputs.size(); i++) {
+        EXPECT_GE(outputs[i], outputs[i - 1]);
+    }
+    EXPECT_NEAR(2000.0 * ONE, outputs.back(), 2000.0 * ONE * 0.01);
+}
+
+TEST_F(AdcFilter, InterleavedChannels) {
+    /* Scan buffer with three channels, filter only the middle one */
+    std::vector<uint16_t> scan;
+
+    for (int i = 0; i < 48; i++) {
+        scan.push_back(4000);
+        scan.push_back(i * 10);
+        scan.push_back(7);
+    }
+    init(16, PIOS_ADC_FILTER_BOXCAR);
+    for (int block = 0; block < 3; block++) {
+        EXPECT_TRUE(PIOS_ADC_Filter_Process(&filter, &scan[block * 16 * 3 + 1], 16, 3, block));
+        EXPECT_EQ((uint32_t)(block * 160 + 75) * ONE, filter.value);
+    }
+}
+
+TEST_F(AdcFilter, TimestampAndCount) {
+    std::vector<uint16_t> x(100, 5);
+
+    init(10, PIOS_ADC_FILTER_BOXCAR);
+    feed(x, 8, 1000);
+
+    /* Each value carries the timestamp of the block that completed it */
+    ASSERT_EQ(10U, timestamps.size());
+    EXPECT_EQ(1008U, timestamps[0]);
+    EXPECT_EQ(1016U, timestamps[1]);
+    EXPECT_EQ(1096U, timestamps[9]);
+    EXPECT_EQ(10U, filter.count);
+}
@@ -0,0 +1,228 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <string.h> /* memcpy */
+#include <math.h>
+#include <chrono>
+
+extern "C" {
+#include <stdint.h>
+#include "fastmath.h"
+}
+
+#define SAMPLES    2000000
+#define BENCH_RUNS 1000000
+
+// Upper bounds documented in fastmath.h
+#define SINCOS_LOW  1.3e-5
+#define SINCOS_HIGH 1.0e-7
+#define ATAN2_LOW   8.5e-5
+#define ATAN2_HIGH  6.0e-7
+#define ASIN_LOW    7.6e-5
+#define ASIN_HIGH   5.0e-7
+#define RSQRT_LOW   4.8e-6
+#define RSQRT_HIGH  2.0e-7
+
+static const fastmath_accuracy_t classes[] = { FASTMATH_LOW, FASTMATH_HIGH };
+
+static const char *className(fastmath_accuracy_t accuracy)
+{
+    return accuracy == FASTMATH_LOW ? "low" : "high";
+}
+
+static float floatFromBits(uint32_t u)
+{
+    float f;
+
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+class FastMath : public testing::Test {};
+
+static double sincosError(float x, fastmath_accuracy_t accuracy)
+{
+    float s, c;
+
+    fast_sincosf(x, &s, &c, accuracy);
+    return fmax(fabs(s - sin((double)x)), fabs(c - cos((double)x)));
+}
+
+TEST_F(FastMath, SinCosWithinBound) {
+    for (fastmath_accuracy_t accuracy : classes) {
+        double maxError = 0.0;
+
+        // The whole domain, and densely over the first turns
+        for (int n = 0; n <= SAMPLES; n++) {
+            float x = -FASTMATH_SINCOS_MAX + 2.0f * FASTMATH_SINCOS_MAX * n / SAMPLES;
+            maxError = fmax(maxError, sincosError(x, accuracy));
+        }
+        for (int n = 0; n <= SAMPLES; n++) {
+            float x = -20.0f + 40.0f * n / SAMPLES;
+            maxError = fmax(maxError, sincosError(x, accuracy));
+        }
+        printf("fast_sincosf %s: max error %g\n", className(accuracy), maxError);
+        EXPECT_LT(maxError, accuracy == FASTMATH_LOW ? SINCOS_LOW : SINCOS_HIGH);
+    }
+}
+
+TEST_F(FastMath, SinCosSymmetryAndQuadrants) {
+    for (fastmath_accuracy_t accuracy : classes) {
+        float s, c;
+
+        fast_sincosf(0.0f, &s, &c, accuracy);
+        EXPECT_EQ(0.0f, s);
+        EXPECT_EQ(1.0f, c);
+        for (int k = -8; k <= 8; k++) {
+            fast_sincosf(k * (float)M_PI_2, &s, &c, accuracy);
+            EXPECT_NEAR(sin(k * M_PI_2), s, 1e-6);
+            EXPECT_NEAR(cos(k * M_PI_2), c, 1e-6);
+        }
+    }
+}
+
+static double atan2Error(float y, float x, fastmath_accuracy_t accuracy)
+{
+    double expected = atan2((double)y, (double)x);
+    double error    = fabs(fast_atan2f(y, x, accuracy) - expected);
+
+    // -pi and pi are the same angle
+    return fmin(error, fabs(error - 2.0 * M_PI));
+}
+
+TEST_F(FastMath, Atan2WithinBound) {
+    for (fastmath_accuracy_t accuracy : classes) {
+        double maxError = 0.0;
+
+        // All the directions, at radii from 1e-30 to 1e30
+        for (int n = 0; n < SAMPLES; n++) {
+            double angle  = -M_PI + 2.0 * M_PI * n / SAMPLES;
+            double radius = pow(10.0, -30 + n % 61);
+            float y = (float)(radius * sin(angle));
+            float x = (float)(radius * cos(angle));
+            maxError = fmax(maxError, atan2Error(y, x, accuracy));
+        }
+        printf("fast_atan2f %s: max error %g\n", className(accuracy), maxError);
+        EXPECT_LT(maxError, accuracy == FASTMATH_LOW ? ATAN2_LOW : ATAN2_HIGH);
+    }
+}
+
+TEST_F(FastMath, Atan2AxesZerosAndInfinities) {
+    for (fastmath_accuracy_t accuracy : classes) {
+        EXPECT_EQ(0.0f, fast_atan2f(0.0f, 0.0f, accuracy));
+        EXPECT_EQ(0.0f, fast_atan2f(0.0f, 2.0f, accuracy));
+        EXPECT_FLOAT_EQ((float)M_PI_2, fast_atan2f(3.0f, 0.0f, accuracy));
+        EXPECT_FLOAT_EQ((float)-M_PI_2, fast_atan2f(-3.0f, 0.0f, accuracy));
+        EXPECT_FLOAT_EQ((float)M_PI, fast_atan2f(0.0f, -2.0f, accuracy));
+        EXPECT_FLOAT_EQ((float)M_PI_2, fast_atan2f(INFINITY, 1.0f, accuracy));
+        EXPECT_FLOAT_EQ((float)-M_PI_2, fast_atan2f(-INFINITY, -1.0f, accuracy));
+        EXPECT_EQ(0.0f, fast_atan2f(1.0f, INFINITY, accuracy));
+        EXPECT_FLOAT_EQ((float)M_PI, fast_atan2f(1.0f, -INFINITY, accuracy));
+    }
+}
+
+TEST_F(FastMath, AsinWithinBound) {
+    for (fastmath_accuracy_t accuracy : classes) {
+        double maxError = 0.0;
+
+        for (int n = 0; n <= SAMPLES; n++) {
+            float x = -1.0f + 2.0f * n / SAMPLES;
+            maxError = fmax(maxError, fabs(fast_asinf(x, accuracy) - asin((double)x)));
+        }
+        // Every float in the last 1e-3 before 1, where the slope is steepest
+        for (float x = 0.999f; x < 1.0f; x = nextafterf(x, 2.0f)) {
+            maxError = fmax(maxError, fabs(fast_asinf(x, accuracy) - asin((double)x)));
+            maxError = fmax(maxError, fabs(fast_asinf(-x, accuracy) - asin((double)-x)));
+        }
+        printf("fast_asinf %s: max error %g\n", className(accuracy), maxError);
+        EXPECT_LT(maxError, accuracy == FASTMATH_LOW ? ASIN_LOW : ASIN_HIGH);
+
+        // Rounding can put a rotation matrix element just past 1
+        EXPECT_FLOAT_EQ((float)M_PI_2, fast_asinf(1.0000001f, accuracy));
+        EXPECT_FLOAT_EQ((float)-M_PI_2, fast_asinf(-1.5f, accuracy));
+    }
+}
+
+TEST_F(FastMath, RsqrtWithinBound) {
+    for (fastmath_accuracy_t accuracy : classes) {
+        double maxError = 0.0;
+
+        // A regular sample of the bit patterns of all the positive normal floats
+        for (uint32_t u = 0x00800000; u < 0x7f800000; u += 251) {
+            float x = floatFromBits(u);
+            double expected = 1.0 / sqrt((double)x);
+            maxError = fmax(maxError, fabs(fast_rsqrtf(x, accuracy) - expected) / expected);
+        }
+        printf("fast_rsqrtf %s: max relative error %g\n", className(accuracy), maxError);
+        EXPECT_LT(maxError, accuracy == FASTMATH_LOW ? RSQRT_LOW : RSQRT_HIGH);
+    }
+}
+
+/*
+ * Time per call against libm, built like the rest of the unit tests (-O0)
+ */
+template<typename F> static double nsPerCall(F f)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (int n = 0; n < BENCH_RUNS; n++) {
+        f(n);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / BENCH_RUNS;
+}
+
+TEST_F(FastMath, Benchmark) {
+    volatile float sink = 0.0f;
+
+    double libm = nsPerCall([&](int n) {
+        float x = (float)n * 1e-5f;
+        sink = sinf(x) + cosf(x);
+    });
+    double low  = nsPerCall([&](int n) {
+        float s, c;
+        fast_sincosf((float)n * 1e-5f, &s, &c, FASTMATH_LOW);
+        sink = s + c;
+    });
+    double high = nsPerCall([&](int n) {
+        float s, c;
+        fast_sincosf((float)n * 1e-5f, &s, &c, FASTMATH_HIGH);
+        sink = s + c;
+    });
+    printf("sin + cos: libm %.1f ns, low %.1f ns, high %.1f ns\n", libm, low, high);
+
+    libm = nsPerCall([&](int n) {
+        sink = atan2f((float)n - 500000.0f, 1000.0f);
+    });
+    low  = nsPerCall([&](int n) {
+        sink = fast_atan2f((float)n - 500000.0f, 1000.0f, FASTMATH_LOW);
+    });
+    high = nsPerCall([&](int n) {
+        sink = fast_atan2f((float)n - 500000.0f, 1000.0f, FASTMATH_HIGH);
+    });
+    printf("atan2:     libm %.1f ns, low %.1f ns, high %.1f ns\n", libm, low, high);
+
+    libm = nsPerCall([&](int n) {
+        sink = asinf((float)n * 1e-6f);
+    });
+    low  = nsPerCall([&](int n) {
+        sink = fast_asinf((float)n * 1e-6f, FASTMATH_LOW);
+    });
+    high = nsPerCall([&](int n) {
+        sink = fast_asinf((float)n * 1e-6f, FASTMATH_HIGH);
+    });
+    printf("asin:      libm %.1f ns, low %.1f ns, high %.1f ns\n", libm, low, high);
+
+    libm = nsPerCall([&](int n) {
+        sink = 1.0f / sqrtf((float)n + 1.0f);
+    });
+    low  = nsPerCall([&](int n) {
+        sink = fast_rsqrtf((float)n + 1.0f, FASTMATH_LOW);
+    });
+    high = nsPerCall([&](int n) {
+        sink = fast_rsqrtf((float)n + 1.0f, FASTMATH_HIGH);
+    });
+    printf("1/sqrt:    libm %.1f ns, low %.1f ns, high %.1f ns\n", libm, low, high);
+
+    (void)sink;
+}
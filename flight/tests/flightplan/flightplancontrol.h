@@ -0,0 +1,27 @@
+#ifndef FLIGHTPLANCONTROL_H
+#define FLIGHTPLANCONTROL_H
+
+#include "openpilot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Only what openpilot.py uses */
+typedef enum {
+    FLIGHTPLANCONTROL_COMMAND_START = 0,
+    FLIGHTPLANCONTROL_COMMAND_STOP  = 1,
+    FLIGHTPLANCONTROL_COMMAND_KILL  = 2
+} __attribute__((packed)) FlightPlanControlCommandOptions;
+
+typedef struct __attribute__((packed)) {
+    FlightPlanControlCommandOptions Command;
+} FlightPlanControlData;
+
+void FlightPlanControlGet(FlightPlanControlData *dataOut);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLIGHTPLANCONTROL_H */
@@ -0,0 +1,22 @@
+#ifndef FLIGHTPLANSTATUS_H
+#define FLIGHTPLANSTATUS_H
+
+#include "openpilot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Only what openpilot.py uses */
+typedef struct __attribute__((packed)) {
+    float Debug[2];
+} FlightPlanStatusData;
+
+void FlightPlanStatusGet(FlightPlanStatusData *dataOut);
+void FlightPlanStatusSet(const FlightPlanStatusData *dataIn);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLIGHTPLANSTATUS_H */
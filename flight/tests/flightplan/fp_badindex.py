@@ -0,0 +1,5 @@
+# Past the last element of an array field
+
+import testobject_native
+
+testobject_native.getPosition(3)
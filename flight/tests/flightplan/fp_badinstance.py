@@ -0,0 +1,5 @@
+# An instance the object does not have
+
+import testobject_native
+
+testobject_native.setCount(1, 2)
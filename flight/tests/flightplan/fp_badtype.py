@@ -0,0 +1,5 @@
+# Only ints and floats can be written
+
+import testobject_native
+
+testobject_native.setCount("1")
@@ -0,0 +1,24 @@
+# Reads and writes single fields through the native accessors, the test
+# fills in the object data before and checks it after the run
+
+import testobject_native
+
+assert testobject_native.getPosition(0) == 1.5
+assert testobject_native.getPosition(testobject_native.POSITION_Z) == 3.25
+assert testobject_native.getCount() == 40
+assert testobject_native.getCount(1) == 7
+assert testobject_native.getUptime() == 100000
+assert testobject_native.getPeriod() == 500
+assert testobject_native.getTrim() == -3
+assert testobject_native.getMode() == testobject_native.MODE_ON
+
+testobject_native.setPosition(testobject_native.POSITION_Y, 4.5)
+testobject_native.setCount(41)
+testobject_native.setCount(8, 1)
+testobject_native.setPeriod(250.75)
+testobject_native.setTrim(-100)
+testobject_native.setMode(testobject_native.MODE_AUTO)
+
+assert testobject_native.getPosition(1) == 4.5
+assert testobject_native.getCount() == 41
+assert testobject_native.getPeriod() == 250
@@ -0,0 +1,5 @@
+# The test makes the object read only
+
+import testobject_native
+
+testobject_native.setCount(1)
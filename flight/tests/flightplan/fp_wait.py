@@ -0,0 +1,17 @@
+# Waits for updates of a watched object instead of polling it
+
+import openpilot
+import testobject_native
+
+testobject_native.watch()
+testobject_native.watch()
+
+assert openpilot.waitForObjectUpdates(20) == 0
+testobject_native.setCount(1)
+assert openpilot.waitForObjectUpdates(1000) == testobject_native.OBJID
+assert openpilot.waitForObjectUpdates(0) == 0
+
+# Negative timeouts poll instead of waiting forever
+testobject_native.setCount(2)
+assert openpilot.waitForObjectUpdates(-2.5) == testobject_native.OBJID
+assert openpilot.waitForObjectUpdates(-1) == 0
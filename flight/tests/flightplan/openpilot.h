@@ -0,0 +1,66 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The part of the RTOS the natives use, implemented by the test */
+typedef uint32_t portTickType;
+typedef void *xQueueHandle;
+
+#define portTICK_RATE_MS 1
+#define portMAX_DELAY    0xffffffff
+#define pdTRUE           1
+#define pdFALSE          0
+
+xQueueHandle xQueueCreate(uint32_t length, uint32_t itemSize);
+int32_t xQueueReceive(xQueueHandle queue, void *buffer, portTickType ticksToWait);
+void vTaskDelay(portTickType ticks);
+void vTaskDelayUntil(portTickType *previousWakeTime, portTickType ticks);
+
+/* The part of the object manager the natives use, implemented by the test */
+typedef void *UAVObjHandle;
+
+typedef enum {
+    EV_NONE     = 0x00,
+    EV_UNPACKED = 0x01,
+    EV_UPDATED  = 0x02,
+    EV_UPDATED_MANUAL   = 0x04,
+    EV_UPDATED_PERIODIC = 0x08,
+    EV_LOGGING_MANUAL   = 0x10,
+    EV_LOGGING_PERIODIC = 0x20,
+    EV_UPDATE_REQ = 0x40
+} UAVObjEventType;
+
+#define EV_MASK_ALL_UPDATES (EV_UNPACKED | EV_UPDATED | EV_UPDATED_MANUAL | EV_UPDATED_PERIODIC | EV_LOGGING_MANUAL | EV_LOGGING_PERIODIC)
+
+typedef struct {
+    UAVObjHandle    obj;
+    uint16_t        instId;
+    UAVObjEventType event;
+    bool lowPriority;
+} UAVObjEvent;
+
+UAVObjHandle UAVObjGetByID(uint32_t id);
+uint32_t UAVObjGetID(UAVObjHandle obj_handle);
+const char *UAVObjGetName(UAVObjHandle obj_handle);
+uint32_t UAVObjGetNumBytes(UAVObjHandle obj);
+uint16_t UAVObjGetNumInstances(UAVObjHandle obj_handle);
+int32_t UAVObjSetInstanceData(UAVObjHandle obj_handle, uint16_t instId, const void *dataIn);
+int32_t UAVObjSetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, const void *dataIn, uint32_t offset, uint32_t size);
+int32_t UAVObjGetInstanceData(UAVObjHandle obj_handle, uint16_t instId, void *dataOut);
+int32_t UAVObjGetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, void *dataOut, uint32_t offset, uint32_t size);
+int32_t UAVObjConnectQueue(UAVObjHandle obj_handle, xQueueHandle queue, uint8_t eventMask);
+int32_t UAVObjDisconnectQueue(UAVObjHandle obj_handle, xQueueHandle queue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPENPILOT_H */
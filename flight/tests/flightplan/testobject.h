@@ -0,0 +1,43 @@
+#ifndef TESTOBJECT_H
+#define TESTOBJECT_H
+
+#include "openpilot.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The object of testobject.xml, a multi instance object with a field of each
+ * kind, laid out the way the flight generator lays out its data (packed,
+ * largest fields first). The ID is the one the generator calculates. */
+#define TESTOBJECT_OBJID        0x0E1FA7A8
+#define TESTOBJECT_NUMINSTANCES 2
+
+typedef enum {
+    TESTOBJECT_MODE_OFF  = 0,
+    TESTOBJECT_MODE_ON   = 1,
+    TESTOBJECT_MODE_AUTO = 2
+} __attribute__((packed)) TestObjectModeOptions;
+
+typedef struct __attribute__((packed)) {
+    float    X;
+    float    Y;
+    float    Z;
+} TestObjectPositionData;
+
+typedef struct __attribute__((packed)) {
+    TestObjectPositionData Position;
+    int32_t  Count;
+    uint32_t Uptime;
+    uint16_t Period;
+    int8_t   Trim;
+    TestObjectModeOptions Mode;
+} TestObjectData;
+
+UAVObjHandle TestObjectHandle();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTOBJECT_H */
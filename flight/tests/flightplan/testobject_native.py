@@ -0,0 +1,144 @@
+##
+##############################################################################
+#
+# @file       testobject_native.py
+# @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2013.
+# @brief      Native field accessors of the TestObject object. This file has been
+#             automatically generated by the UAVObjectGenerator. For use with
+#             the PyMite VM of the FlightPlan module.
+#
+# @note       Object definition file: testobject.xml.
+#             This is an automatically generated file.
+#             DO NOT modify manually.
+#
+#             Each accessor reads or writes a single field element of the
+#             object in place, unlike the TestObject class in testobject.py no
+#             object data is built in the VM. Array fields take the element
+#             index as first argument, all accessors take the instance ID as
+#             optional last argument.
+#
+# @see        The GNU Public License (GPL) Version 3
+#
+#############################################################################/
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful, but
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+# or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+# for more details.
+#
+# You should have received a copy of the GNU General Public License along
+# with this program; if not, write to the Free Software Foundation, Inc.,
+# 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+#
+
+"""__NATIVE__
+#include "testobject.h"
+#include "flightplanuavo.h"
+"""
+
+# Object constants
+OBJID = 236955560
+
+POSITION_X = 0
+POSITION_Y = 1
+POSITION_Z = 2
+MODE_OFF = 0
+MODE_ON = 1
+MODE_AUTO = 2
+
+# Read Position
+def getPosition(index, instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOGetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_FLOAT32, offsetof(TestObjectData, Position), 3);
+    """
+    pass
+
+# Write Position
+def setPosition(index, value, instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOSetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_FLOAT32, offsetof(TestObjectData, Position), 3);
+    """
+    pass
+
+# Read Count
+def getCount(instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOGetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_INT32, offsetof(TestObjectData, Count), 1);
+    """
+    pass
+
+# Write Count
+def setCount(value, instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOSetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_INT32, offsetof(TestObjectData, Count), 1);
+    """
+    pass
+
+# Read Uptime
+def getUptime(instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOGetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_UINT32, offsetof(TestObjectData, Uptime), 1);
+    """
+    pass
+
+# Write Uptime
+def setUptime(value, instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOSetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_UINT32, offsetof(TestObjectData, Uptime), 1);
+    """
+    pass
+
+# Read Period
+def getPeriod(instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOGetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_UINT16, offsetof(TestObjectData, Period), 1);
+    """
+    pass
+
+# Write Period
+def setPeriod(value, instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOSetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_UINT16, offsetof(TestObjectData, Period), 1);
+    """
+    pass
+
+# Read Trim
+def getTrim(instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOGetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_INT8, offsetof(TestObjectData, Trim), 1);
+    """
+    pass
+
+# Write Trim
+def setTrim(value, instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOSetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_INT8, offsetof(TestObjectData, Trim), 1);
+    """
+    pass
+
+# Read Mode
+def getMode(instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOGetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_ENUM, offsetof(TestObjectData, Mode), 1);
+    """
+    pass
+
+# Write Mode
+def setMode(value, instId=0):
+    """__NATIVE__
+    return FlightPlanUAVOSetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_ENUM, offsetof(TestObjectData, Mode), 1);
+    """
+    pass
+
+
+# Queue the updates of this object for openpilot.waitForObjectUpdates()
+def watch():
+    """__NATIVE__
+    return FlightPlanUAVOWatch(TestObjectHandle());
+    """
+    pass
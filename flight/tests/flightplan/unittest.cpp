@@ -0,0 +1,287 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <deque>
+
+extern "C" {
+#include "pm.h"
+#include "flightplanuavo.h"
+#include "flightplanstatus.h"
+#include "flightplancontrol.h"
+#include "testobject.h"
+
+extern unsigned char const usrlib_img[];
+}
+
+/*
+ * The object manager and the RTOS, just enough of them for the natives: one
+ * object with two instances and the single queue the module creates.
+ */
+static TestObjectData instances[TESTOBJECT_NUMINSTANCES];
+static bool readOnly;
+static uint8_t testObject;
+static uint8_t updateQueue;
+static xQueueHandle connectedQueue;
+static uint32_t numConnects;
+static std::deque<UAVObjEvent> events;
+static portTickType maxWaitTicks;
+static FlightPlanStatusData status;
+
+UAVObjHandle TestObjectHandle()
+{
+    return &testObject;
+}
+
+xQueueHandle xQueueCreate(uint32_t length, uint32_t itemSize)
+{
+    EXPECT_LT(0U, length);
+    EXPECT_EQ(sizeof(UAVObjEvent), itemSize);
+    return &updateQueue;
+}
+
+int32_t xQueueReceive(xQueueHandle queue, void *buffer, portTickType ticksToWait)
+{
+    EXPECT_EQ(&updateQueue, queue);
+    if (events.empty()) {
+        // Nobody else runs while the script waits, so it always times out
+        if (ticksToWait > maxWaitTicks) {
+            maxWaitTicks = ticksToWait;
+        }
+        return pdFALSE;
+    }
+    memcpy(buffer, &events.front(), sizeof(UAVObjEvent));
+    events.pop_front();
+    return pdTRUE;
+}
+
+void vTaskDelay(__attribute__((unused)) portTickType ticks)
+{}
+
+void vTaskDelayUntil(portTickType *previousWakeTime, portTickType ticks)
+{
+    *previousWakeTime += ticks;
+}
+
+UAVObjHandle UAVObjGetByID(uint32_t id)
+{
+    return (id == TESTOBJECT_OBJID) ? TestObjectHandle() : NULL;
+}
+
+uint32_t UAVObjGetID(UAVObjHandle obj_handle)
+{
+    return (obj_handle == TestObjectHandle()) ? TESTOBJECT_OBJID : 0;
+}
+
+const char *UAVObjGetName(__attribute__((unused)) UAVObjHandle obj_handle)
+{
+    return "TestObject";
+}
+
+uint32_t UAVObjGetNumBytes(__attribute__((unused)) UAVObjHandle obj)
+{
+    return sizeof(TestObjectData);
+}
+
+uint16_t UAVObjGetNumInstances(__attribute__((unused)) UAVObjHandle obj_handle)
+{
+    return TESTOBJECT_NUMINSTANCES;
+}
+
+int32_t UAVObjGetInstanceData(UAVObjHandle obj_handle, uint16_t instId, void *dataOut)
+{
+    return UAVObjGetInstanceDataField(obj_handle, instId, dataOut, 0, sizeof(TestObjectData));
+}
+
+int32_t UAVObjGetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, void *dataOut, uint32_t offset, uint32_t size)
+{
+    if (obj_handle != TestObjectHandle() || instId >= TESTOBJECT_NUMINSTANCES || offset + size > sizeof(TestObjectData)) {
+        return -1;
+    }
+    memcpy(dataOut, (uint8_t *)&instances[instId] + offset, size);
+    return 0;
+}
+
+int32_t UAVObjSetInstanceData(UAVObjHandle obj_handle, uint16_t instId, const void *dataIn)
+{
+    return UAVObjSetInstanceDataField(obj_handle, instId, dataIn, 0, sizeof(TestObjectData));
+}
+
+int32_t UAVObjSetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, const void *dataIn, uint32_t offset, uint32_t size)
+{
+    if (obj_handle != TestObjectHandle() || instId >= TESTOBJECT_NUMINSTANCES || offset + size > sizeof(TestObjectData) || readOnly) {
+        return -1;
+    }
+    memcpy((uint8_t *)&instances[instId] + offset, dataIn, size);
+
+    if (connectedQueue != NULL) {
+        UAVObjEvent ev = { obj_handle, instId, EV_UPDATED, false };
+        events.push_back(ev);
+    }
+    return 0;
+}
+
+int32_t UAVObjConnectQueue(UAVObjHandle obj_handle, xQueueHandle queue, uint8_t eventMask)
+{
+    EXPECT_EQ(TestObjectHandle(), obj_handle);
+    EXPECT_EQ(EV_MASK_ALL_UPDATES, eventMask);
+    connectedQueue = queue;
+    numConnects++;
+    return 0;
+}
+
+int32_t UAVObjDisconnectQueue(UAVObjHandle obj_handle, xQueueHandle queue)
+{
+    EXPECT_EQ(TestObjectHandle(), obj_handle);
+    EXPECT_EQ(connectedQueue, queue);
+    connectedQueue = NULL;
+    return 0;
+}
+
+void FlightPlanStatusGet(FlightPlanStatusData *dataOut)
+{
+    *dataOut = status;
+}
+
+void FlightPlanStatusSet(const FlightPlanStatusData *dataIn)
+{
+    status = *dataIn;
+}
+
+void FlightPlanControlGet(FlightPlanControlData *dataOut)
+{
+    dataOut->Command = FLIGHTPLANCONTROL_COMMAND_START;
+}
+
+/*
+ * The collectors the scripts must run under: stop-the-world and the default
+ * step. The Makefile has incremental cycles start at once, the scripts are
+ * too short to fill the SITL heap.
+ */
+static const uint16_t stepWorks[] = { 0, 64 };
+
+#define NUM_STEP_WORKS (sizeof(stepWorks) / sizeof(stepWorks[0]))
+
+static PmReturn_t runScript(const char *module, uint16_t stepWork)
+{
+    PmReturn_t retval;
+    PmGcStats_t stats;
+
+    retval = pm_init(MEMSPACE_PROG, usrlib_img);
+    if (retval != PM_RET_OK) {
+        return retval;
+    }
+    heap_gcSetStepWork(stepWork);
+    heap_gcResetStats();
+
+    retval = pm_run((uint8_t const *)module);
+
+    heap_gcGetStats(&stats);
+    if (stepWork != 0) {
+        EXPECT_LT(0U, stats.steps) << module;
+    }
+
+    // As the module task does after each script
+    FlightPlanUAVOReset();
+    return retval;
+}
+
+class FlightPlanUAVO : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        resetObjects();
+        ASSERT_EQ(0, FlightPlanUAVOInitialize());
+    }
+
+    void resetObjects()
+    {
+        memset(instances, 0, sizeof(instances));
+        instances[0].Position.X = 1.5f;
+        instances[0].Position.Y = -2.0f;
+        instances[0].Position.Z = 3.25f;
+        instances[0].Count  = 40;
+        instances[0].Uptime = 100000;
+        instances[0].Period = 500;
+        instances[0].Trim   = -3;
+        instances[0].Mode   = TESTOBJECT_MODE_ON;
+        instances[1].Count  = 7;
+
+        readOnly       = false;
+        connectedQueue = NULL;
+        numConnects    = 0;
+        maxWaitTicks   = 0;
+        events.clear();
+    }
+};
+
+TEST_F(FlightPlanUAVO, ReadWriteFields) {
+    for (size_t w = 0; w < NUM_STEP_WORKS; w++) {
+        SCOPED_TRACE(stepWorks[w]);
+        resetObjects();
+        ASSERT_EQ(PM_RET_OK, runScript("fp_fields", stepWorks[w]));
+
+        // Only the written elements changed
+        EXPECT_EQ(1.5f, instances[0].Position.X);
+        EXPECT_EQ(4.5f, instances[0].Position.Y);
+        EXPECT_EQ(3.25f, instances[0].Position.Z);
+        EXPECT_EQ(41, instances[0].Count);
+        EXPECT_EQ(100000U, instances[0].Uptime);
+        EXPECT_EQ(250, instances[0].Period);
+        EXPECT_EQ(-100, instances[0].Trim);
+        EXPECT_EQ(TESTOBJECT_MODE_AUTO, instances[0].Mode);
+        EXPECT_EQ(8, instances[1].Count);
+        EXPECT_EQ(0.0f, instances[1].Position.Y);
+    }
+}
+
+TEST_F(FlightPlanUAVO, WaitForWatchedObject) {
+    for (size_t w = 0; w < NUM_STEP_WORKS; w++) {
+        SCOPED_TRACE(stepWorks[w]);
+        resetObjects();
+        ASSERT_EQ(PM_RET_OK, runScript("fp_wait", stepWorks[w]));
+
+        // Watched once however often watch() is called, and dropped when done
+        EXPECT_EQ(1U, numConnects);
+        EXPECT_EQ(NULL, connectedQueue);
+        EXPECT_TRUE(events.empty());
+
+        // The longest wait that timed out, negative timeouts only poll
+        EXPECT_EQ(20U, maxWaitTicks);
+    }
+}
+
+TEST_F(FlightPlanUAVO, BadArguments) {
+    for (size_t w = 0; w < NUM_STEP_WORKS; w++) {
+        SCOPED_TRACE(stepWorks[w]);
+        resetObjects();
+        EXPECT_EQ(PM_RET_EX_INDX, runScript("fp_badindex", stepWorks[w]));
+        EXPECT_EQ(PM_RET_EX_INDX, runScript("fp_badinstance", stepWorks[w]));
+        EXPECT_EQ(PM_RET_EX_TYPE, runScript("fp_badtype", stepWorks[w]));
+        EXPECT_EQ(40, instances[0].Count);
+
+        readOnly = true;
+        EXPECT_EQ(PM_RET_EX_IO, runScript("fp_readonly", stepWorks[w]));
+        EXPECT_EQ(40, instances[0].Count);
+    }
+}
+
+TEST_F(FlightPlanUAVO, IntFieldsDoNotAllocate) {
+    ASSERT_EQ(PM_RET_OK, pm_init(MEMSPACE_PROG, C_NULL));
+    uint32_t avail = heap_getAvail();
+
+    // Call the natives the way the interpreter does, without arguments
+    // (a scalar field of instance 0) and with a value to write
+    for (int i = 0; i < 100; i++) {
+        gVmGlobal.nativeframe.nf_numlocals = 0;
+        ASSERT_EQ(PM_RET_OK, FlightPlanUAVOGetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_INT32, offsetof(TestObjectData, Count), 1));
+        EXPECT_EQ(40, ((pPmInt_t)gVmGlobal.nativeframe.nf_stack)->val);
+
+        gVmGlobal.nativeframe.nf_numlocals = 1;
+        gVmGlobal.nativeframe.nf_locals[0] = PM_ONE;
+        ASSERT_EQ(PM_RET_OK, FlightPlanUAVOSetField(TestObjectHandle(), FLIGHTPLANUAVO_TYPE_ENUM, offsetof(TestObjectData, Mode), 1));
+    }
+    EXPECT_EQ(avail, heap_getAvail());
+    EXPECT_EQ(TESTOBJECT_MODE_ON, instances[0].Mode);
+}
@@ -0,0 +1,115 @@
+/*
+ * What the DFU handler needs from a bootloader: the board info, its flash
+ * and the hooks to send replies. These are in a .c file so that they use
+ * the same enums as op_dfu.c.
+ */
+
+#include "pios.h"
+#include "pios_bl_helper.h"
+#include <pios_board_info.h>
+#include "op_dfu.h"
+#include "fwlz.h"
+#include "dfu_ut.h"
+
+uint8_t dfu_ut_flash[DFU_UT_FW_SIZE + DFU_UT_DESC_SIZE] __attribute__((aligned(4)));
+uint8_t dfu_ut_reply[64];
+uint32_t dfu_ut_erases;
+uint32_t dfu_ut_stuck_offset;
+uint8_t dfu_ut_stuck_mask;
+
+DFUStates DeviceState;
+uint8_t JumpToApp;
+
+const struct pios_board_info pios_board_info_blob = {
+    .magic      = PIOS_BOARD_INFO_BLOB_MAGIC,
+    .board_type = 0x09,
+    .board_rev  = 0x03,
+    .bl_rev     = 5,
+    .hw_type    = 0,
+    .fw_base    = DFU_UT_FW_BASE,
+    .fw_size    = DFU_UT_FW_SIZE,
+    .desc_base  = DFU_UT_FW_BASE + DFU_UT_FW_SIZE,
+    .desc_size  = DFU_UT_DESC_SIZE,
+};
+
+void dfu_ut_reset(void)
+{
+    memset(dfu_ut_flash, 0xFF, sizeof(dfu_ut_flash));
+    memset(dfu_ut_reply, 0, sizeof(dfu_ut_reply));
+    dfu_ut_erases       = 0;
+    dfu_ut_stuck_offset = 0;
+    dfu_ut_stuck_mask   = 0;
+    DeviceState = BLidle;
+    JumpToApp   = 0;
+}
+
+uint8_t dfu_ut_state(void)
+{
+    return DeviceState;
+}
+
+int32_t platform_senddata(const uint8_t *msg, uint16_t msg_len)
+{
+    memcpy(dfu_ut_reply, msg, (msg_len < sizeof(dfu_ut_reply)) ? msg_len : sizeof(dfu_ut_reply));
+    return 0;
+}
+
+uint8_t *PIOS_BL_HELPER_FLASH_If_Read(uint32_t SectorAddress)
+{
+    return &dfu_ut_flash[SectorAddress - DFU_UT_FW_BASE];
+}
+
+uint8_t PIOS_BL_HELPER_FLASH_Ini()
+{
+    return 1;
+}
+
+uint8_t PIOS_BL_HELPER_FLASH_Start()
+{
+    memset(dfu_ut_flash, 0xFF, DFU_UT_FW_SIZE);
+    dfu_ut_erases++;
+    return 1;
+}
+
+/* The hardware CRC unit over the whole firmware area */
+uint32_t PIOS_BL_HELPER_CRC_Memory_Calc()
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (uint32_t i = 0; i < DFU_UT_FW_SIZE; i += 4) {
+        uint32_t word;
+        memcpy(&word, &dfu_ut_flash[i], sizeof(word));
+        crc = fwlz_crc32(crc, word);
+    }
+    return crc;
+}
+
+/* Programming only clears bits, as on the real flash */
+FLASH_Status FLASH_ProgramWord(uint32_t Address, uint32_t Data)
+{
+    uint32_t offset = Address - DFU_UT_FW_BASE;
+
+    if ((Address < DFU_UT_FW_BASE) || (offset + 4 > sizeof(dfu_ut_flash)) || (offset & 3)) {
+        return FLASH_ERROR_PGA;
+    }
+    for (uint8_t b = 0; b < 4; b++) {
+        uint8_t byte = Data >> (8 * b);
+        if ((offset + b == dfu_ut_stuck_offset) && dfu_ut_stuck_mask) {
+            byte |= dfu_ut_stuck_mask;
+        }
+        dfu_ut_flash[offset + b] &= byte;
+    }
+    return FLASH_COMPLETE;
+}
+
+void FLASH_Lock(void)
+{}
+
+void PIOS_SYS_Reset(void)
+{}
+
+void PIOS_IAP_WriteBootCount(__attribute__((unused)) uint16_t count)
+{}
+
+void PIOS_IAP_WriteBootCmd(__attribute__((unused)) uint8_t b, __attribute__((unused)) uint32_t cmd)
+{}
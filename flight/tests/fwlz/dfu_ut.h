@@ -0,0 +1,23 @@
+#ifndef DFU_UT_H
+#define DFU_UT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* Where the firmware of the simulated board goes, as on Revolution */
+#define DFU_UT_FW_BASE   0x08020000
+#define DFU_UT_FW_SIZE   0x000E0000
+#define DFU_UT_DESC_SIZE 100
+
+extern uint8_t dfu_ut_flash[DFU_UT_FW_SIZE + DFU_UT_DESC_SIZE];
+extern uint8_t dfu_ut_reply[64];
+extern uint32_t dfu_ut_erases;
+
+/* Bits of mask at offset stay erased whatever is programmed */
+extern uint32_t dfu_ut_stuck_offset;
+extern uint8_t dfu_ut_stuck_mask;
+
+void dfu_ut_reset(void);
+uint8_t dfu_ut_state(void);
+
+#endif /* DFU_UT_H */
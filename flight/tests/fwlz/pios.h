@@ -0,0 +1,30 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#define BOARD_READABLE true
+#define BOARD_WRITABLE true
+
+typedef enum {
+    FLASH_BUSY = 1,
+    FLASH_ERROR_PGS,
+    FLASH_ERROR_PGP,
+    FLASH_ERROR_PGA,
+    FLASH_ERROR_WRP,
+    FLASH_ERROR_PROGRAM,
+    FLASH_ERROR_OPERATION,
+    FLASH_COMPLETE
+} FLASH_Status;
+
+FLASH_Status FLASH_ProgramWord(uint32_t Address, uint32_t Data);
+void FLASH_Lock(void);
+
+void PIOS_SYS_Reset(void);
+void PIOS_IAP_WriteBootCount(uint16_t);
+void PIOS_IAP_WriteBootCmd(uint8_t b, uint32_t cmd);
+
+#endif /* PIOS_H */
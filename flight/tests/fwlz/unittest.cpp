@@ -0,0 +1,422 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* getenv */
+#include <string.h> /* memset */
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "fwlz.h"
+#include "dfu_ut.h"
+
+void processComand(uint8_t *Receive_Buffer);
+}
+
+/* As in flight/targets/boards/revolution/bootloader/inc/common.h */
+#define DFU_UPLOAD            7
+#define DFU_OP_END            8
+#define DFU_REQ_CAPABILITIES  1
+#define DFU_ENTER_DFU         3
+#define DFU_ABORT             6
+#define DFU_STATE_SUCCESS     5
+#define DFU_STATE_FAILED      8
+#define DFU_STATE_CRC_FAIL    11
+#define DFU_TRANSFER_FW       0
+#define DFU_TRANSFER_FW_LZ    2
+
+#define WORDS_PER_PACKET      14
+#define BYTES_PER_PACKET      (WORDS_PER_PACKET * 4)
+
+/*
+ * Transfer rates for the benchmark: one HID report per USB frame, and
+ * 64 byte reports over a 64 kbit/s OPLink radio link
+ */
+#define USB_PACKETS_PER_S     1000.0
+#define OPLINK_PACKETS_PER_S  (64000.0 / (64 * 8))
+
+typedef std::vector<uint8_t> Image;
+
+static Image compress(const Image & image)
+{
+    Image packed(FWLZ_COMPRESS_BOUND(image.size()));
+    std::vector<uint32_t> table(FWLZ_HASH_SIZE);
+
+    int32_t len = fwlz_compress(image.data(), image.size(), packed.data(), packed.size(), table.data());
+
+    EXPECT_GT(len, 0);
+    packed.resize(len);
+    return packed;
+}
+
+/* The CRC of the STM32 CRC unit, one bit at a time */
+static uint32_t referenceCrc(uint32_t crc, uint32_t word)
+{
+    crc ^= word;
+    for (int i = 0; i < 32; i++) {
+        crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : (crc << 1);
+    }
+    return crc;
+}
+
+/*
+ * The images that are round-tripped: this very executable, which is real
+ * machine code, and whatever FWLZ_IMAGES lists (such as build/fw_*.bin)
+ */
+static std::vector<Image> firmwareImages()
+{
+    std::vector<std::string> paths;
+    std::vector<Image> images;
+
+    paths.push_back("/proc/self/exe");
+    if (getenv("FWLZ_IMAGES")) {
+        std::stringstream list(getenv("FWLZ_IMAGES"));
+        std::string path;
+        while (std::getline(list, path, ':')) {
+            paths.push_back(path);
+        }
+    }
+    for (size_t i = 0; i < paths.size(); i++) {
+        std::ifstream file(paths[i].c_str(), std::ios::binary);
+        Image image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        EXPECT_FALSE(image.empty()) << paths[i];
+        // As much as fits on the board, in whole words like the uploader sends
+        image.resize(std::min<size_t>(image.size(), DFU_UT_FW_SIZE) & ~3);
+        images.push_back(image);
+    }
+    return images;
+}
+
+/* Flash in memory for the decoder alone, written once per word */
+struct Flash {
+    Image    bytes;
+    uint32_t programmed;
+    int32_t  failAt;
+};
+
+static bool programWord(void *ctx, uint32_t offset, uint32_t word)
+{
+    Flash *flash = (Flash *)ctx;
+
+    if (flash->failAt == (int32_t)flash->programmed++) {
+        return false;
+    }
+    EXPECT_EQ(0U, offset & 3);
+    EXPECT_LE(offset + 4, flash->bytes.size());
+    for (int b = 0; b < 4; b++) {
+        EXPECT_EQ(0xFF, flash->bytes[offset + b]) << "offset " << offset;
+        flash->bytes[offset + b] = word >> (8 * b);
+    }
+    return true;
+}
+
+static uint8_t readByte(void *ctx, uint32_t offset)
+{
+    Flash *flash = (Flash *)ctx;
+
+    EXPECT_LT(offset, flash->bytes.size());
+    return flash->bytes[offset];
+}
+
+class FWLZ : public testing::Test {
+protected:
+    struct fwlz_decoder dec;
+    Flash flash;
+
+    void SetUp()
+    {
+        flash.bytes.assign(DFU_UT_FW_SIZE, 0xFF);
+        flash.programmed = 0;
+        flash.failAt     = -1;
+        fwlz_decode_init(&dec, DFU_UT_FW_SIZE, programWord, readByte, &flash);
+    }
+
+    // Feeds the stream a packet at a time, as the bootloader gets it
+    int32_t decode(const Image & packed)
+    {
+        int32_t ret = 0;
+
+        for (size_t i = 0; (i < packed.size()) && (ret == 0); i += BYTES_PER_PACKET) {
+            ret = fwlz_decode(&dec, &packed[i], std::min<size_t>(BYTES_PER_PACKET, packed.size() - i));
+        }
+        return ret;
+    }
+
+    void roundTrip(const Image & image)
+    {
+        SetUp();
+        ASSERT_EQ(0, decode(compress(image))) << image.size() << " bytes";
+        EXPECT_TRUE(fwlz_decode_done(&dec));
+        EXPECT_TRUE(std::equal(image.begin(), image.end(), flash.bytes.begin())) << image.size() << " bytes";
+        // The last word is padded, nothing after it is touched
+        for (size_t i = image.size(); i < flash.bytes.size(); i++) {
+            ASSERT_EQ(0xFF, flash.bytes[i]) << i;
+        }
+    }
+};
+
+TEST_F(FWLZ, CrcMatchesHardware) {
+    // The example of the STM32 reference manual
+    EXPECT_EQ(0xDF8A8A2BU, fwlz_crc32(0xFFFFFFFF, 0x12345678));
+
+    uint32_t crc = 0xFFFFFFFF;
+    uint32_t ref = 0xFFFFFFFF;
+    for (uint32_t i = 0; i < 1000; i++) {
+        crc = fwlz_crc32(crc, i * 2654435761U);
+        ref = referenceCrc(ref, i * 2654435761U);
+    }
+    EXPECT_EQ(ref, crc);
+}
+
+TEST_F(FWLZ, RoundTripsFirmwareImages) {
+    std::vector<Image> images = firmwareImages();
+
+    for (size_t i = 0; i < images.size(); i++) {
+        roundTrip(images[i]);
+        EXPECT_LT(compress(images[i]).size(), images[i].size());
+    }
+}
+
+TEST_F(FWLZ, RoundTripsCornerCases) {
+    uint32_t seed = 1;
+    Image noise(20000);
+
+    for (size_t i = 0; i < noise.size(); i++) {
+        seed     = seed * 1103515245 + 12345;
+        noise[i] = seed >> 16;
+    }
+
+    roundTrip(Image());
+    roundTrip(Image(1, 0x42));
+    roundTrip(Image(3, 0x00));
+    roundTrip(Image(5, 0x00));
+    // Matches that overlap what they write, and are longer than 255
+    roundTrip(Image(65536, 0x00));
+    // Nothing but literals, in runs longer than 255
+    roundTrip(noise);
+
+    // Matches as far back as they go, and further
+    Image far(noise);
+    far.resize(200000);
+    std::copy(noise.begin(), noise.begin() + 1000, far.begin() + FWLZ_MAX_OFFSET);
+    std::copy(noise.begin(), noise.begin() + 1000, far.begin() + FWLZ_MAX_OFFSET + 50000);
+    roundTrip(far);
+}
+
+TEST_F(FWLZ, RejectsCorruptStreams) {
+    Image image(firmwareImages()[0]);
+    Image packed(compress(image));
+
+    // Not a compressed image
+    Image raw(packed);
+    raw[0] = 0x7F;
+    EXPECT_EQ(FWLZ_ERR_HEADER, decode(raw));
+    EXPECT_FALSE(fwlz_decode_done(&dec));
+
+    // Bigger than the board
+    SetUp();
+    fwlz_decode_init(&dec, image.size() - 4, programWord, readByte, &flash);
+    EXPECT_EQ(FWLZ_ERR_HEADER, decode(packed));
+    EXPECT_EQ(0U, flash.programmed);
+
+    // A match before the start of the image
+    SetUp();
+    const uint8_t before[] = { 'F', 'W', 'L', 'Z', 8, 0, 0, 0, 0, 0, 0, 0, 0x10, 'A', 2, 0 };
+    EXPECT_EQ(FWLZ_ERR_CORRUPT, fwlz_decode(&dec, before, sizeof(before)));
+
+    // A flipped bit ends up in the image, the CRC catches it
+    SetUp();
+    Image flipped(packed);
+    flipped[flipped.size() / 2] ^= 0x01;
+    EXPECT_NE(0, decode(flipped));
+    EXPECT_FALSE(fwlz_decode_done(&dec));
+
+    // Cut short
+    SetUp();
+    EXPECT_EQ(0, decode(Image(packed.begin(), packed.begin() + packed.size() / 2)));
+    EXPECT_FALSE(fwlz_decode_done(&dec));
+
+    // Errors stick
+    SetUp();
+    EXPECT_EQ(FWLZ_ERR_HEADER, decode(raw));
+    EXPECT_EQ(FWLZ_ERR_HEADER, decode(packed));
+}
+
+TEST_F(FWLZ, StopsOnProgramFailure) {
+    flash.failAt = 100;
+    EXPECT_EQ(FWLZ_ERR_PROGRAM, decode(compress(firmwareImages()[0])));
+    EXPECT_EQ(101U, flash.programmed);
+    EXPECT_FALSE(fwlz_decode_done(&dec));
+}
+
+/*
+ * The bootloader side, through the DFU handler of op_dfu.c and the packets
+ * the uploader sends
+ */
+class DFU : public testing::Test {
+protected:
+    uint32_t packets;
+
+    void SetUp()
+    {
+        dfu_ut_reset();
+        packets = 0;
+        command(DFU_REQ_CAPABILITIES, false, 0, 0);
+        command(DFU_ENTER_DFU, false, 0, 0);
+        // Forgets a transfer a previous test left half done
+        command(DFU_ABORT, false, 0, 0);
+    }
+
+    void command(uint8_t cmd, bool start, uint32_t count, uint8_t data0, uint8_t data1 = 0, uint32_t crc = 0)
+    {
+        uint8_t buf[64];
+
+        memset(buf, 0, sizeof(buf));
+        buf[0]  = cmd | (start ? 0x20 : 0);
+        buf[1]  = count >> 24;
+        buf[2]  = count >> 16;
+        buf[3]  = count >> 8;
+        buf[4]  = count;
+        buf[5]  = data0;
+        buf[6]  = data1;
+        buf[7]  = crc >> 24;
+        buf[8]  = crc >> 16;
+        buf[9]  = crc >> 8;
+        buf[10] = crc;
+        processComand(buf);
+    }
+
+    // What DFUObject::StartUpload and UploadData send, then EndOperation
+    uint8_t upload(Image payload, uint8_t type, uint32_t crc)
+    {
+        payload.resize((payload.size() + 3) & ~3, 0);
+
+        uint32_t count = (payload.size() + BYTES_PER_PACKET - 1) / BYTES_PER_PACKET;
+        uint8_t last   = (payload.size() / 4) - (count - 1) * WORDS_PER_PACKET;
+
+        command(DFU_UPLOAD, true, count, type, last, crc);
+        for (uint32_t p = 0; p < count; p++) {
+            uint8_t buf[64];
+            memset(buf, 0, sizeof(buf));
+            buf[0] = DFU_UPLOAD;
+            buf[1] = p >> 24;
+            buf[2] = p >> 16;
+            buf[3] = p >> 8;
+            buf[4] = p;
+            uint32_t words = (p == count - 1) ? last : WORDS_PER_PACKET;
+            for (uint32_t x = 0; x < words * 4; x++) {
+                // Each word big endian, see DFUObject::CopyWords
+                buf[5 + x] = payload[p * BYTES_PER_PACKET + (x & ~3) + 3 - (x & 3)];
+            }
+            processComand(buf);
+            packets++;
+        }
+        command(DFU_OP_END, false, 0, 0);
+        return dfu_ut_state();
+    }
+
+    // What DFUObject::CRCFromQBArray computes
+    static uint32_t flashCrc(const Image & image)
+    {
+        uint32_t crc = 0xFFFFFFFF;
+
+        for (uint32_t i = 0; i < DFU_UT_FW_SIZE; i += 4) {
+            uint32_t word = 0;
+            for (int b = 3; b >= 0; b--) {
+                word = (word << 8) | ((i + b < image.size()) ? image[i + b] : 0xFF);
+            }
+            crc = fwlz_crc32(crc, word);
+        }
+        return crc;
+    }
+
+    // The CRC the bootloader reports in its capabilities
+    static uint32_t reportedCrc()
+    {
+        return ((uint32_t)dfu_ut_reply[9] << 24) | ((uint32_t)dfu_ut_reply[10] << 16)
+               | ((uint32_t)dfu_ut_reply[11] << 8) | dfu_ut_reply[12];
+    }
+};
+
+TEST_F(DFU, FlashesCompressedImage) {
+    Image image = firmwareImages()[0];
+
+    ASSERT_EQ(DFU_STATE_SUCCESS, upload(compress(image), DFU_TRANSFER_FW_LZ, flashCrc(image)));
+    EXPECT_EQ(1U, dfu_ut_erases);
+    EXPECT_TRUE(std::equal(image.begin(), image.end(), dfu_ut_flash));
+
+    command(DFU_REQ_CAPABILITIES, false, 0, 1);
+    EXPECT_EQ(flashCrc(image), reportedCrc());
+}
+
+TEST_F(DFU, FlashesRawImage) {
+    Image image = firmwareImages()[0];
+
+    ASSERT_EQ(DFU_STATE_SUCCESS, upload(image, DFU_TRANSFER_FW, flashCrc(image)));
+    EXPECT_TRUE(std::equal(image.begin(), image.end(), dfu_ut_flash));
+}
+
+TEST_F(DFU, RejectsBadCompressedImage) {
+    Image image  = firmwareImages()[0];
+    Image packed = compress(image);
+
+    // The image does not match the CRC the uploader computed
+    EXPECT_EQ(DFU_STATE_CRC_FAIL, upload(packed, DFU_TRANSFER_FW_LZ, flashCrc(image) ^ 1));
+
+    // Nor does it match its own
+    SetUp();
+    Image flipped(packed);
+    flipped[flipped.size() / 2] ^= 0x01;
+    EXPECT_NE(DFU_STATE_SUCCESS, upload(flipped, DFU_TRANSFER_FW_LZ, flashCrc(image)));
+
+    // The flash does not take it
+    SetUp();
+    dfu_ut_stuck_offset = image.size() / 2;
+    while (image[dfu_ut_stuck_offset] == 0xFF) {
+        dfu_ut_stuck_offset++;
+    }
+    dfu_ut_stuck_mask = ~image[dfu_ut_stuck_offset];
+    EXPECT_EQ(DFU_STATE_FAILED, upload(packed, DFU_TRANSFER_FW_LZ, flashCrc(image)));
+
+    // Cut short
+    SetUp();
+    Image truncated(packed.begin(), packed.begin() + packed.size() / 2);
+    EXPECT_EQ(DFU_STATE_CRC_FAIL, upload(truncated, DFU_TRANSFER_FW_LZ, flashCrc(image)));
+}
+
+TEST_F(DFU, TransferTime) {
+    std::vector<Image> images = firmwareImages();
+
+    for (size_t i = 0; i < images.size(); i++) {
+        const Image & image = images[i];
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        Image packed = compress(image);
+        std::chrono::duration<double> compressTime = std::chrono::steady_clock::now() - start;
+
+        SetUp();
+        ASSERT_EQ(DFU_STATE_SUCCESS, upload(image, DFU_TRANSFER_FW, flashCrc(image)));
+        uint32_t rawPackets = packets;
+
+        SetUp();
+        start = std::chrono::steady_clock::now();
+        ASSERT_EQ(DFU_STATE_SUCCESS, upload(packed, DFU_TRANSFER_FW_LZ, flashCrc(image)));
+        std::chrono::duration<double> decodeTime = std::chrono::steady_clock::now() - start;
+        uint32_t packedPackets = packets;
+
+        EXPECT_LT(packedPackets, rawPackets);
+
+        printf("image %u: %u bytes, %u compressed (%.1f%%), compressed in %.1f ms, flashed in %.1f ms\n",
+               (unsigned)i, (unsigned)image.size(), (unsigned)packed.size(),
+               100.0 * packed.size() / image.size(), compressTime.count() * 1000, decodeTime.count() * 1000);
+        printf("  %u packets raw, %u compressed: USB %.1f s -> %.1f s, OPLink %.1f s -> %.1f s\n",
+               rawPackets, packedPackets,
+               rawPackets / USB_PACKETS_PER_S, packedPackets / USB_PACKETS_PER_S,
+               rawPackets / OPLINK_PACKETS_PER_S, packedPackets / OPLINK_PACKETS_PER_S);
+    }
+}
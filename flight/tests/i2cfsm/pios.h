@@ -0,0 +1,19 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+/* PIOS Feature Selection */
+#include "pios_config.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "openpilot.h"
+
+/* Provided by the test */
+extern int32_t PIOS_IRQ_Disable(void);
+extern int32_t PIOS_IRQ_Enable(void);
+extern uint32_t PIOS_DELAY_GetuS(void);
+extern uint32_t PIOS_DELAY_GetuSSince(uint32_t t);
+
+#endif /* PIOS_H */
@@ -0,0 +1,660 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <deque>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "pios.h"
+#include "pios_i2c_fsm.h"
+
+static int irq_nesting;
+static uint32_t now_us;
+
+int32_t PIOS_IRQ_Disable(void)
+{
+    irq_nesting++;
+    return 0;
+}
+
+int32_t PIOS_IRQ_Enable(void)
+{
+    irq_nesting--;
+    return 0;
+}
+
+uint32_t PIOS_DELAY_GetuS(void)
+{
+    return now_us;
+}
+
+uint32_t PIOS_DELAY_GetuSSince(uint32_t t)
+{
+    return now_us - t;
+}
+}
+
+/*
+ * Simulated I2C master with a single register based slave behind it. The
+ * hooks only record what the state machine asked for and queue the resulting
+ * hardware events, run() then delivers them the way the interrupt handlers
+ * of a real adapter would.
+ */
+enum sim_event {
+    SIM_SB,
+    SIM_ADDR,
+    SIM_RXNE,
+    SIM_BTF,
+    SIM_DMA_TC,
+    SIM_AF,
+    SIM_BERR,
+};
+
+#define SLAVE_ADDR 0x1e
+
+struct sim_i2c {
+    uint8_t  irqs;
+    bool     ack;
+    bool     start_pending;
+    bool     stop_pending;
+    bool     reading;
+    bool     present; /* Slave acknowledges its address */
+    int      nack_after; /* Slave NACKs after this many written bytes, -1 never */
+    bool     hung; /* Slave stretches the clock forever, no more events */
+    bool     stop_stuck; /* Stop condition never goes out */
+    bool     dma_active;
+    int      written;
+    int      resets;
+    int      faults;
+    uint8_t  mem[256];
+    uint8_t  reg;
+    bool     reg_set;
+    std::deque<enum sim_event> events;
+    std::vector<std::string> log;
+};
+
+static struct sim_i2c sim;
+static struct pios_i2c_fsm fsm;
+
+static void sim_queue(enum sim_event event)
+{
+    if (!sim.hung) {
+        sim.events.push_back(event);
+    }
+}
+
+static void sim_irq_config(__attribute__((unused)) uint32_t i2c_id, uint8_t irqs)
+{
+    sim.irqs = irqs;
+}
+
+static void sim_ack(__attribute__((unused)) uint32_t i2c_id, bool enable)
+{
+    sim.ack = enable;
+}
+
+static void sim_start(__attribute__((unused)) uint32_t i2c_id)
+{
+    /* Setting START again before it went out is a no-op on the real thing as well */
+    if (!sim.start_pending) {
+        sim.start_pending = true;
+        sim.log.push_back("start");
+        sim_queue(SIM_SB);
+    }
+}
+
+static void sim_stop(__attribute__((unused)) uint32_t i2c_id)
+{
+    sim.stop_pending = true;
+    sim.log.push_back("stop");
+}
+
+static void sim_send_address(__attribute__((unused)) uint32_t i2c_id, uint16_t addr, enum pios_i2c_txn_direction rw)
+{
+    char buf[32];
+
+    snprintf(buf, sizeof(buf), "addr%s%02x", rw == PIOS_I2C_TXN_READ ? "R" : "W", addr);
+    sim.log.push_back(buf);
+
+    sim.reading = (rw == PIOS_I2C_TXN_READ);
+    sim.reg_set = false;
+    if (!sim.present || addr != SLAVE_ADDR) {
+        sim_queue(SIM_AF);
+        return;
+    }
+    sim_queue(SIM_ADDR);
+}
+
+static void sim_write(uint8_t byte)
+{
+    if (!sim.reg_set) {
+        sim.reg     = byte;
+        sim.reg_set = true;
+    } else {
+        sim.mem[sim.reg++] = byte;
+    }
+    sim.written++;
+}
+
+static void sim_send_byte(__attribute__((unused)) uint32_t i2c_id, uint8_t byte)
+{
+    EXPECT_FALSE(sim.reading);
+    sim_write(byte);
+    if (sim.nack_after >= 0 && sim.written > sim.nack_after) {
+        sim_queue(SIM_AF);
+    } else {
+        sim_queue(SIM_BTF);
+    }
+}
+
+static uint8_t sim_receive_byte(__attribute__((unused)) uint32_t i2c_id)
+{
+    EXPECT_TRUE(sim.reading);
+    return sim.mem[sim.reg++];
+}
+
+static bool sim_wait_stopped(__attribute__((unused)) uint32_t i2c_id)
+{
+    if (sim.stop_stuck) {
+        return false;
+    }
+    sim.stop_pending = false;
+    sim.log.push_back("stopped");
+    return true;
+}
+
+static void sim_reset_bus(__attribute__((unused)) uint32_t i2c_id)
+{
+    sim.resets++;
+    sim.events.clear();
+    sim.start_pending = false;
+    sim.stop_pending  = false;
+    sim.log.push_back("reset");
+}
+
+static void sim_dma_start(__attribute__((unused)) uint32_t i2c_id, enum pios_i2c_txn_direction rw, uint8_t *buf, uint32_t len)
+{
+    char buf_log[32];
+
+    EXPECT_FALSE(sim.dma_active);
+    sim.dma_active = true;
+    snprintf(buf_log, sizeof(buf_log), "dma%s%u", rw == PIOS_I2C_TXN_READ ? "R" : "W", (unsigned)len);
+    sim.log.push_back(buf_log);
+
+    if (rw == PIOS_I2C_TXN_READ) {
+        EXPECT_TRUE(sim.reading);
+        EXPECT_TRUE(sim.ack);
+        for (uint32_t i = 0; i < len; i++) {
+            buf[i] = sim.mem[sim.reg++];
+        }
+        sim_queue(SIM_DMA_TC);
+    } else {
+        for (uint32_t i = 0; i < len; i++) {
+            sim_write(buf[i]);
+        }
+        if (sim.nack_after >= 0 && sim.written > sim.nack_after) {
+            sim_queue(SIM_AF);
+        } else {
+            sim_queue(SIM_BTF);
+        }
+    }
+}
+
+static void sim_dma_stop(__attribute__((unused)) uint32_t i2c_id)
+{
+    sim.dma_active = false;
+}
+
+static void sim_log_fault(__attribute__((unused)) uint32_t i2c_id, enum pios_i2c_error_type type)
+{
+    EXPECT_EQ(PIOS_I2C_ERROR_FSM, type);
+    sim.faults++;
+}
+
+static const struct pios_i2c_fsm_driver sim_driver = {
+    .irq_config   = sim_irq_config,
+    .ack          = sim_ack,
+    .start        = sim_start,
+    .stop         = sim_stop,
+    .send_address = sim_send_address,
+    .send_byte    = sim_send_byte,
+    .receive_byte = sim_receive_byte,
+    .wait_stopped = sim_wait_stopped,
+    .reset_bus    = sim_reset_bus,
+    .dma_start    = sim_dma_start,
+    .dma_stop     = sim_dma_stop,
+    .log_fault    = sim_log_fault,
+};
+
+/* Deliver queued hardware events until the bus goes quiet */
+static void run(void)
+{
+    while (!sim.events.empty()) {
+        enum sim_event event = sim.events.front();
+        bool woken = false;
+
+        sim.events.pop_front();
+        EXPECT_EQ(0, irq_nesting);
+
+        switch (event) {
+        case SIM_SB:
+            EXPECT_TRUE(sim.irqs & PIOS_I2C_FSM_IRQ_EVT);
+            sim.start_pending = false;
+            PIOS_I2C_FSM_Started(&fsm, &woken);
+            break;
+        case SIM_ADDR:
+            EXPECT_TRUE(sim.irqs & PIOS_I2C_FSM_IRQ_EVT);
+            PIOS_I2C_FSM_AddrSent(&fsm, &woken);
+            if (sim.reading && !sim.dma_active) {
+                sim_queue(SIM_RXNE);
+            }
+            break;
+        case SIM_RXNE:
+            EXPECT_TRUE(sim.irqs & PIOS_I2C_FSM_IRQ_BUF);
+            /* The slave keeps sending while the byte is ACKed and nobody asked for a stop or restart */
+            if (sim.ack && !sim.stop_pending && !sim.start_pending) {
+                sim_queue(SIM_RXNE);
+            }
+            PIOS_I2C_FSM_TransferDone(&fsm, &woken);
+            break;
+        case SIM_BTF:
+            EXPECT_TRUE(sim.irqs & PIOS_I2C_FSM_IRQ_EVT);
+            PIOS_I2C_FSM_TransferDone(&fsm, &woken);
+            break;
+        case SIM_DMA_TC:
+            PIOS_I2C_FSM_DMADone(&fsm, &woken);
+            break;
+        case SIM_AF:
+            EXPECT_TRUE(sim.irqs & PIOS_I2C_FSM_IRQ_ERR);
+            PIOS_I2C_FSM_Nack(&fsm, &woken);
+            break;
+        case SIM_BERR:
+            EXPECT_TRUE(sim.irqs & PIOS_I2C_FSM_IRQ_ERR);
+            PIOS_I2C_FSM_BusError(&fsm, &woken);
+            break;
+        }
+    }
+}
+
+static void done_cb(struct pios_i2c_request *req, bool *woken)
+{
+    EXPECT_NE(PIOS_I2C_REQUEST_PENDING, req->result);
+    if (woken) {
+        EXPECT_FALSE(*woken);
+    }
+    (*(int *)req->context)++;
+}
+
+class I2CFsm : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        irq_nesting = 0;
+        now_us = 1000;
+        sim.irqs       = 0;
+        sim.ack        = false;
+        sim.start_pending = false;
+        sim.stop_pending  = false;
+        sim.reading    = false;
+        sim.present    = true;
+        sim.nack_after = -1;
+        sim.hung       = false;
+        sim.stop_stuck = false;
+        sim.dma_active = false;
+        sim.written    = 0;
+        sim.resets     = 0;
+        sim.faults     = 0;
+        sim.reg_set    = false;
+        sim.reg        = 0;
+        for (int i = 0; i < 256; i++) {
+            sim.mem[i] = i ^ 0x5a;
+        }
+        sim.events.clear();
+        PIOS_I2C_FSM_Init(&fsm, &sim_driver, 0x1234, 0);
+        EXPECT_EQ(1, sim.resets);
+        sim.resets = 0;
+        sim.log.clear();
+    }
+
+    virtual void TearDown()
+    {
+        EXPECT_EQ(0, irq_nesting);
+        EXPECT_TRUE(sim.events.empty());
+    }
+
+    void setup_dma(uint8_t dma)
+    {
+        PIOS_I2C_FSM_Init(&fsm, &sim_driver, 0x1234, dma);
+        sim.resets = 0;
+        sim.log.clear();
+    }
+
+    /* Register read: write the register address, restart, read len bytes */
+    int32_t read_reg(uint8_t reg, uint8_t *buf, uint32_t len)
+    {
+        const struct pios_i2c_txn txn_list[] = {
+            { "reg", SLAVE_ADDR, PIOS_I2C_TXN_WRITE, 1, &reg },
+            { "data", SLAVE_ADDR, PIOS_I2C_TXN_READ, len, buf },
+        };
+        struct pios_i2c_request req;
+        int done = 0;
+
+        req.txn_list = txn_list;
+        req.num_txns = 2;
+        req.callback = done_cb;
+        req.context  = &done;
+        EXPECT_EQ(0, PIOS_I2C_FSM_Submit(&fsm, &req, NULL));
+        run();
+        EXPECT_EQ(1, done);
+        return req.result;
+    }
+
+    int32_t write_reg(uint8_t reg, const uint8_t *data, uint32_t len)
+    {
+        uint8_t buf[16];
+
+        buf[0] = reg;
+        memcpy(&buf[1], data, len);
+
+        const struct pios_i2c_txn txn_list[] = {
+            { "write", SLAVE_ADDR, PIOS_I2C_TXN_WRITE, len + 1, buf },
+        };
+        struct pios_i2c_request req;
+        int done = 0;
+
+        req.txn_list = txn_list;
+        req.num_txns = 1;
+        req.callback = done_cb;
+        req.context  = &done;
+        EXPECT_EQ(0, PIOS_I2C_FSM_Submit(&fsm, &req, NULL));
+        run();
+        EXPECT_EQ(1, done);
+        return req.result;
+    }
+
+    void expect_idle()
+    {
+        EXPECT_EQ(I2C_STATE_STOPPED, fsm.curr_state);
+        EXPECT_FALSE(PIOS_I2C_FSM_Running(&fsm));
+        EXPECT_EQ(0, sim.irqs);
+        EXPECT_FALSE(sim.dma_active);
+    }
+};
+
+TEST_F(I2CFsm, RegisterReadAllLengths) {
+    for (uint32_t len = 1; len <= 6; len++) {
+        uint8_t buf[8];
+
+        memset(buf, 0, sizeof(buf));
+        EXPECT_EQ(0, read_reg(0x10, buf, len)) << "len " << len;
+        for (uint32_t i = 0; i < len; i++) {
+            EXPECT_EQ((0x10 + i) ^ 0x5a, buf[i]) << "len " << len << " byte " << i;
+        }
+        EXPECT_EQ(0, buf[len]);
+        expect_idle();
+    }
+    EXPECT_EQ(0, sim.resets);
+    EXPECT_EQ(0, sim.faults);
+    EXPECT_EQ(6U, fsm.completed);
+}
+
+TEST_F(I2CFsm, WriteThenReadBack) {
+    const uint8_t data[] = { 0xde, 0xad, 0xbe, 0xef };
+    uint8_t buf[4];
+
+    for (uint32_t len = 1; len <= sizeof(data); len++) {
+        EXPECT_EQ(0, write_reg(0x40, data, len));
+        expect_idle();
+    }
+    EXPECT_EQ(0, read_reg(0x40, buf, sizeof(buf)));
+    EXPECT_EQ(0, memcmp(data, buf, sizeof(buf)));
+}
+
+TEST_F(I2CFsm, SingleByteReadSequence) {
+    uint8_t buf;
+
+    EXPECT_EQ(0, read_reg(0x20, &buf, 1));
+
+    /* A single byte is NACKed and stopped before it arrives */
+    std::vector<std::string> expected = { "start", "addrW1e", "start", "addrR1e", "stop", "stopped" };
+    EXPECT_EQ(expected, sim.log);
+    EXPECT_TRUE(sim.ack);
+}
+
+TEST_F(I2CFsm, AddressNack) {
+    uint8_t buf[2];
+
+    sim.present = false;
+    EXPECT_EQ(-3, read_reg(0x00, buf, sizeof(buf)));
+    expect_idle();
+    EXPECT_EQ(0, sim.resets);
+    EXPECT_EQ(1U, fsm.failed);
+
+    /* A NACK leaves the bus usable */
+    sim.present = true;
+    EXPECT_EQ(0, read_reg(0x00, buf, sizeof(buf)));
+}
+
+TEST_F(I2CFsm, DataNack) {
+    const uint8_t data[] = { 1, 2, 3 };
+
+    sim.nack_after = 2;
+    EXPECT_EQ(-3, write_reg(0x00, data, sizeof(data)));
+    expect_idle();
+    EXPECT_EQ(3, sim.written);
+}
+
+TEST_F(I2CFsm, BusErrorResetsBus) {
+    const struct pios_i2c_txn txn_list[] = {
+        { "data", SLAVE_ADDR, PIOS_I2C_TXN_READ, 4, sim.mem },
+    };
+    struct pios_i2c_request req;
+    int done = 0;
+
+    req.txn_list = txn_list;
+    req.num_txns = 1;
+    req.callback = done_cb;
+    req.context  = &done;
+    EXPECT_EQ(0, PIOS_I2C_FSM_Submit(&fsm, &req, NULL));
+
+    /* Slave holds SDA low while we try to address it, lost arbitration */
+    sim.events.clear();
+    sim.events.push_back(SIM_BERR);
+    run();
+
+    EXPECT_EQ(1, done);
+    EXPECT_EQ(-1, req.result);
+    EXPECT_EQ(1, sim.resets);
+    expect_idle();
+
+    uint8_t buf[2];
+    EXPECT_EQ(0, read_reg(0x00, buf, sizeof(buf)));
+}
+
+TEST_F(I2CFsm, UnexpectedEventIsFsmFault) {
+    const uint8_t data[] = { 1, 2 };
+    const struct pios_i2c_txn txn_list[] = {
+        { "write", SLAVE_ADDR, PIOS_I2C_TXN_WRITE, sizeof(data), (uint8_t *)data },
+    };
+    struct pios_i2c_request req;
+    bool woken = false;
+    int done   = 0;
+
+    req.txn_list = txn_list;
+    req.num_txns = 1;
+    req.callback = done_cb;
+    req.context  = &done;
+    EXPECT_EQ(0, PIOS_I2C_FSM_Submit(&fsm, &req, NULL));
+
+    /* DMA completion while waiting for the start condition */
+    PIOS_I2C_FSM_DMADone(&fsm, &woken);
+    EXPECT_EQ(1, done);
+    EXPECT_EQ(-1, req.result);
+    EXPECT_EQ(1, sim.faults);
+    EXPECT_EQ(1, sim.resets);
+    expect_idle();
+}
+
+TEST_F(I2CFsm, StuckStopCondition) {
+    uint8_t buf[3];
+
+    sim.stop_stuck = true;
+    EXPECT_EQ(-1, read_reg(0x00, buf, sizeof(buf)));
+    EXPECT_EQ(1, sim.resets);
+    expect_idle();
+
+    sim.stop_stuck = false;
+    EXPECT_EQ(0, read_reg(0x00, buf, sizeof(buf)));
+}
+
+TEST_F(I2CFsm, TimeoutAbortsAndStartsNext) {
+    uint8_t buf1[4], buf2[4];
+    const struct pios_i2c_txn txn1[] = {
+        { "data", SLAVE_ADDR, PIOS_I2C_TXN_READ, sizeof(buf1), buf1 },
+    };
+    const struct pios_i2c_txn txn2[] = {
+        { "data", SLAVE_ADDR, PIOS_I2C_TXN_READ, sizeof(buf2), buf2 },
+    };
+    struct pios_i2c_request req1, req2;
+    int done1 = 0, done2 = 0;
+
+    req1.txn_list = txn1;
+    req1.num_txns = 1;
+    req1.callback = done_cb;
+    req1.context  = &done1;
+    req2.txn_list = txn2;
+    req2.num_txns = 1;
+    req2.callback = done_cb;
+    req2.context  = &done2;
+
+    /* Slave stretches the clock after the start condition and never lets go */
+    sim.hung = true;
+    EXPECT_EQ(0, PIOS_I2C_FSM_Submit(&fsm, &req1, NULL));
+    EXPECT_EQ(0, PIOS_I2C_FSM_Submit(&fsm, &req2, NULL));
+    run();
+    EXPECT_EQ(PIOS_I2C_REQUEST_PENDING, req1.result);
+    EXPECT_EQ(PIOS_I2C_REQUEST_PENDING, req2.result);
+
+    now_us += 999;
+    EXPECT_FALSE(PIOS_I2C_FSM_CheckTimeout(&fsm, 1000, NULL));
+
+    /* Reset releases the slave */
+    sim.hung = false;
+    now_us  += 1;
+    EXPECT_TRUE(PIOS_I2C_FSM_CheckTimeout(&fsm, 1000, NULL));
+    EXPECT_EQ(1, done1);
+    EXPECT_EQ(-2, req1.result);
+    EXPECT_EQ(1, sim.resets);
+    EXPECT_EQ(1U, fsm.timeouts);
+
+    /* The second request has been started by the abort */
+    run();
+    EXPECT_EQ(1, done2);
+    EXPECT_EQ(0, req2.result);
+    EXPECT_EQ(sim.mem[3], buf2[3]);
+    expect_idle();
+
+    EXPECT_FALSE(PIOS_I2C_FSM_CheckTimeout(&fsm, 1000, NULL));
+}
+
+TEST_F(I2CFsm, QueuedRequestsRunInOrder) {
+    uint8_t bufs[3][2];
+    struct pios_i2c_txn txns[3];
+    struct pios_i2c_request reqs[3];
+    int done[3] = { 0, 0, 0 };
+
+    for (int i = 0; i < 3; i++) {
+        txns[i].info = "data";
+        txns[i].addr = SLAVE_ADDR;
+        txns[i].rw   = PIOS_I2C_TXN_READ;
+        txns[i].len  = 2;
+        txns[i].buf  = bufs[i];
+        reqs[i].txn_list = &txns[i];
+        reqs[i].num_txns = 1;
+        reqs[i].callback = done_cb;
+        reqs[i].context  = &done[i];
+        EXPECT_EQ(0, PIOS_I2C_FSM_Submit(&fsm, &reqs[i], NULL));
+    }
+    EXPECT_TRUE(PIOS_I2C_FSM_Running(&fsm));
+    run();
+
+    /* Reads continue where the previous one stopped */
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(1, done[i]);
+        EXPECT_EQ(0, reqs[i].result);
+        EXPECT_EQ(sim.mem[2 * i], bufs[i][0]);
+        EXPECT_EQ(sim.mem[2 * i + 1], bufs[i][1]);
+    }
+    expect_idle();
+}
+
+TEST_F(I2CFsm, MalformedRequest) {
+    struct pios_i2c_request req;
+
+    req.txn_list = NULL;
+    req.num_txns = 1;
+    EXPECT_EQ(-1, PIOS_I2C_FSM_Submit(&fsm, &req, NULL));
+    EXPECT_EQ(-1, PIOS_I2C_FSM_Submit(&fsm, NULL, NULL));
+    expect_idle();
+}
+
+TEST_F(I2CFsm, DMAReadAndWrite) {
+    const uint8_t data[] = { 9, 8, 7, 6, 5 };
+    uint8_t buf[5];
+
+    setup_dma(PIOS_I2C_FSM_DMA_READ | PIOS_I2C_FSM_DMA_WRITE);
+
+    EXPECT_EQ(0, write_reg(0x80, data, sizeof(data)));
+    expect_idle();
+    EXPECT_EQ(0, read_reg(0x80, buf, sizeof(buf)));
+    EXPECT_EQ(0, memcmp(data, buf, sizeof(buf)));
+    expect_idle();
+
+    std::vector<std::string> expected = {
+        "start", "addrW1e", "dmaW6", "stop", "stopped",
+        "start", "addrW1e", "start", "addrR1e", "dmaR5", "stop", "stopped",
+    };
+    EXPECT_EQ(expected, sim.log);
+
+    /* Single bytes never go through the DMA */
+    sim.log.clear();
+    EXPECT_EQ(0, read_reg(0x80, buf, 1));
+    EXPECT_EQ(data[0], buf[0]);
+    for (size_t i = 0; i < sim.log.size(); i++) {
+        EXPECT_EQ(std::string::npos, sim.log[i].find("dma"));
+    }
+}
+
+TEST_F(I2CFsm, DMAReadOnly) {
+    const uint8_t data[] = { 1, 2, 3 };
+    uint8_t buf[3];
+
+    setup_dma(PIOS_I2C_FSM_DMA_READ);
+
+    EXPECT_EQ(0, write_reg(0x30, data, sizeof(data)));
+    EXPECT_EQ(0, read_reg(0x30, buf, sizeof(buf)));
+    EXPECT_EQ(0, memcmp(data, buf, sizeof(buf)));
+
+    int dma_logs = 0;
+    for (size_t i = 0; i < sim.log.size(); i++) {
+        dma_logs += sim.log[i].find("dma") != std::string::npos;
+    }
+    EXPECT_EQ(1, dma_logs);
+}
+
+TEST_F(I2CFsm, DMAWriteNack) {
+    const uint8_t data[] = { 1, 2, 3 };
+
+    setup_dma(PIOS_I2C_FSM_DMA_WRITE);
+
+    /* Slave refuses the data, the pending DMA is torn down */
+    sim.nack_after = 1;
+    EXPECT_EQ(-3, write_reg(0x00, data, sizeof(data)));
+    expect_idle();
+
+    sim.nack_after = -1;
+    EXPECT_EQ(0, write_reg(0x00, data, sizeof(data)));
+}
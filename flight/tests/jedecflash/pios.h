@@ -0,0 +1,24 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+/* PIOS Feature Selection */
+#include "pios_config.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "openpilot.h"
+#include "pios_helpers.h"
+#include "pios_math.h"
+#include "pios_spi.h"
+#include "pios_flash.h"
+
+#define pios_malloc(size) (malloc(size))
+
+/* Provided by the test */
+extern int32_t PIOS_DELAY_WaituS(uint32_t uS);
+
+#endif /* PIOS_H */
@@ -0,0 +1,620 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <vector>
+
+extern "C" {
+#include "pios.h"
+#include "pios_flash_jedec_priv.h"
+#include "pios_flashfs_logfs_priv.h"
+#include "pios_flashfs.h" /* PIOS_FLASHFS_* */
+}
+
+/*
+ * Simulated JEDEC SPI flash chip on a virtual clock. Erases and programs take
+ * their datasheet time to complete, any command the real chip would ignore or
+ * corrupt data with is counted as a violation.
+ */
+
+#define FLASH_SIZE 0x200000
+#define SUSPEND_US 20
+
+struct chip_model {
+    uint8_t  id[3];
+    uint8_t  sector_erase;
+    uint32_t sector_size;
+    uint32_t erase_us;
+    uint32_t program_us;
+    bool     suspend;
+};
+
+/* 64k sectors, no erase suspend */
+static const struct chip_model m25p16  = { { 0x20, 0x20, 0x15 }, 0xD8, 0x10000, 600000, 800, false };
+/* 4k sectors with erase suspend */
+static const struct chip_model w25q16  = { { 0xEF, 0x40, 0x15 }, 0x20, 0x1000, 45000, 700, true };
+static const struct chip_model unknown = { { 0x12, 0x34, 0x56 }, 0x20, 0x1000, 45000, 700, false };
+
+static struct {
+    const struct chip_model *model;
+    std::vector<uint8_t> mem;
+    uint64_t now;
+
+    std::vector<uint8_t> cmd;
+    bool     wel;
+
+    bool     programming;
+    uint64_t program_done;
+
+    bool     erasing;
+    uint32_t erase_addr;
+    uint64_t erase_done;
+    uint64_t erase_left;
+    bool     suspended;
+    uint64_t suspend_done;
+
+    bool     claimed;
+    uint64_t claimed_at;
+    uint64_t max_hold;
+
+    uint32_t status_reads;
+    uint32_t erases;
+    uint32_t programs;
+    uint32_t suspends;
+    uint32_t resumes;
+    uint32_t violations;
+} sim;
+
+static void sim_reset(const struct chip_model *model)
+{
+    sim.model = model;
+    sim.mem.assign(FLASH_SIZE, 0xFF);
+    sim.now   = 0;
+    sim.cmd.clear();
+    sim.wel   = false;
+    sim.programming  = false;
+    sim.erasing      = false;
+    sim.suspended    = false;
+    sim.claimed      = false;
+    sim.max_hold     = 0;
+    sim.status_reads = 0;
+    sim.erases     = 0;
+    sim.programs   = 0;
+    sim.suspends   = 0;
+    sim.resumes    = 0;
+    sim.violations = 0;
+}
+
+static void sim_update()
+{
+    if (sim.programming && sim.now >= sim.program_done) {
+        sim.programming = false;
+    }
+    if (sim.erasing && !sim.suspended && sim.now >= sim.erase_done) {
+        memset(&sim.mem[sim.erase_addr], 0xFF, sim.model->sector_size);
+        sim.erasing = false;
+    }
+}
+
+static bool sim_busy()
+{
+    return sim.programming ||
+           (sim.erasing && !sim.suspended) ||
+           (sim.suspended && sim.now < sim.suspend_done);
+}
+
+static bool sim_in_erase(uint32_t addr)
+{
+    return sim.erasing && addr >= sim.erase_addr && addr < sim.erase_addr + sim.model->sector_size;
+}
+
+static uint32_t sim_addr()
+{
+    return (sim.cmd[1] << 16) | (sim.cmd[2] << 8) | sim.cmd[3];
+}
+
+/* Byte clocked out by the chip for the last byte of the current command */
+static uint8_t sim_respond()
+{
+    size_t idx = sim.cmd.size() - 1;
+
+    switch (sim.cmd[0]) {
+    case 0x05:
+        if (idx > 0) {
+            sim_update();
+            sim.status_reads++;
+            return (sim_busy() ? 0x01 : 0) | (sim.wel ? 0x02 : 0);
+        }
+        break;
+    case 0x9F:
+        if (idx >= 1 && idx <= 3) {
+            return sim.model->id[idx - 1];
+        }
+        break;
+    case 0x03:
+    case 0x0B:
+    {
+        size_t hdr = (sim.cmd[0] == 0x03) ? 4 : 5;
+        if (idx >= hdr) {
+            uint32_t addr = sim_addr() + idx - hdr;
+            sim_update();
+            if (sim_busy() || (sim.suspended && sim_in_erase(addr))) {
+                sim.violations++;
+            }
+            return sim.mem[addr % FLASH_SIZE];
+        }
+        break;
+    }
+    }
+    return 0xFF;
+}
+
+/* Command completed by raising chip select */
+static void sim_execute()
+{
+    sim_update();
+    if (sim.cmd.empty()) {
+        return;
+    }
+
+    uint8_t op = sim.cmd[0];
+    switch (op) {
+    case 0x05:
+    case 0x9F:
+        return;
+    case 0x75:
+        if (!sim.model->suspend || sim.programming) {
+            sim.violations++;
+        } else if (sim.erasing && !sim.suspended) {
+            sim.suspended    = true;
+            sim.erase_left   = sim.erase_done - sim.now;
+            sim.suspend_done = sim.now + SUSPEND_US;
+            sim.suspends++;
+        }
+        return;
+    }
+
+    if (sim_busy()) {
+        sim.violations++;
+        return;
+    }
+
+    switch (op) {
+    case 0x03:
+    case 0x0B:
+        break;
+    case 0x06:
+        sim.wel = true;
+        break;
+    case 0x04:
+        sim.wel = false;
+        break;
+    case 0x7A:
+        if (sim.suspended) {
+            sim.suspended  = false;
+            sim.erase_done = sim.now + sim.erase_left;
+            sim.resumes++;
+        }
+        break;
+    case 0x02:
+    {
+        uint32_t addr = sim_addr();
+        uint32_t len  = sim.cmd.size() - 4;
+        if (!sim.wel || (addr & 0xff) + len > 0x100 || (sim.suspended && sim_in_erase(addr))) {
+            sim.violations++;
+            break;
+        }
+        for (uint32_t i = 0; i < len; i++) {
+            sim.mem[addr + i] &= sim.cmd[4 + i];
+        }
+        sim.wel = false;
+        sim.programming  = true;
+        sim.program_done = sim.now + sim.model->program_us;
+        sim.programs++;
+        break;
+    }
+    default:
+        if (op != sim.model->sector_erase || !sim.wel || sim.suspended) {
+            sim.violations++;
+            break;
+        }
+        sim.wel = false;
+        sim.erasing    = true;
+        sim.erase_addr = sim_addr() & ~(sim.model->sector_size - 1);
+        sim.erase_done = sim.now + sim.model->erase_us;
+        sim.erases++;
+        break;
+    }
+}
+
+extern "C" int32_t PIOS_DELAY_WaituS(uint32_t uS)
+{
+    sim.now += uS;
+    return 0;
+}
+
+extern "C" int32_t PIOS_SPI_ClaimBus(__attribute__((unused)) uint32_t spi_id)
+{
+    if (sim.claimed) {
+        sim.violations++;
+    }
+    sim.claimed    = true;
+    sim.claimed_at = sim.now;
+    return 0;
+}
+
+extern "C" int32_t PIOS_SPI_ReleaseBus(__attribute__((unused)) uint32_t spi_id)
+{
+    sim.claimed  = false;
+    sim.max_hold = std::max(sim.max_hold, sim.now - sim.claimed_at);
+    return 0;
+}
+
+extern "C" int32_t PIOS_SPI_SetClockSpeed(__attribute__((unused)) uint32_t spi_id, __attribute__((unused)) SPIPrescalerTypeDef spi_prescaler)
+{
+    return 0;
+}
+
+extern "C" int32_t PIOS_SPI_RC_PinSet(__attribute__((unused)) uint32_t spi_id, __attribute__((unused)) uint32_t slave_id, uint8_t pin_value)
+{
+    if (pin_value) {
+        sim_execute();
+    }
+    sim.cmd.clear();
+    return 0;
+}
+
+extern "C" int32_t PIOS_SPI_TransferBlock(__attribute__((unused)) uint32_t spi_id, const uint8_t *send_buffer, uint8_t *receive_buffer, uint16_t len, __attribute__((unused)) void *callback)
+{
+    if (!sim.claimed) {
+        sim.violations++;
+    }
+    for (uint16_t i = 0; i < len; i++) {
+        sim.cmd.push_back(send_buffer ? send_buffer[i] : 0xFF);
+        uint8_t b = sim_respond();
+        if (receive_buffer) {
+            receive_buffer[i] = b;
+        }
+    }
+    sim.now += 1 + len / 8;
+    return 0;
+}
+
+class JedecFlash : public testing::Test {
+protected:
+    uintptr_t flash_id;
+    const struct pios_flash_driver *drv;
+
+    void init(const struct chip_model *model)
+    {
+        sim_reset(model);
+        ASSERT_EQ(0, PIOS_Flash_Jedec_Init(&flash_id, 1, 0));
+        drv = &pios_jedec_flash_driver;
+    }
+
+    void fill(uint32_t addr, uint8_t value, uint32_t len)
+    {
+        memset(&sim.mem[addr], value, len);
+    }
+
+    bool erased(uint32_t addr, uint32_t len)
+    {
+        for (uint32_t i = 0; i < len; i++) {
+            if (sim.mem[addr + i] != 0xFF) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    virtual void TearDown()
+    {
+        EXPECT_EQ(0u, sim.violations);
+        EXPECT_FALSE(sim.claimed);
+    }
+};
+
+TEST_F(JedecFlash, UnknownChip) {
+    sim_reset(&unknown);
+    EXPECT_EQ(-1, PIOS_Flash_Jedec_Init(&flash_id, 1, 0));
+}
+
+TEST_F(JedecFlash, EraseReleasesBusWhilePolling) {
+    init(&m25p16);
+    fill(0x10000, 0x00, 0x10000);
+
+    uint64_t start = sim.now;
+    EXPECT_EQ(0, drv->erase_sector(flash_id, 0x10000));
+
+    /* Returns once the erase is done, without oversleeping by much */
+    EXPECT_GE(sim.now - start, m25p16.erase_us);
+    EXPECT_LT(sim.now - start, m25p16.erase_us + 20000);
+    EXPECT_TRUE(erased(0x10000, 0x10000));
+
+    /* Status polls back off and never keep the bus */
+    EXPECT_LT(sim.status_reads, 60u);
+    EXPECT_LT(sim.max_hold, 50u);
+}
+
+TEST_F(JedecFlash, ProgramCompletesInBackground) {
+    init(&m25p16);
+
+    uint8_t data[256];
+    uint8_t buf[256];
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+
+    uint64_t start = sim.now;
+    EXPECT_EQ(0, drv->write_data(flash_id, 0x100, data, sizeof(data)));
+    EXPECT_LT(sim.now - start, m25p16.program_us);
+    EXPECT_EQ(1u, sim.programs);
+
+    /* The next command waits for the page program */
+    EXPECT_EQ(0, drv->read_data(flash_id, 0x100, buf, sizeof(buf)));
+    EXPECT_GE(sim.now - start, m25p16.program_us);
+    EXPECT_EQ(0, memcmp(data, buf, sizeof(data)));
+}
+
+TEST_F(JedecFlash, ReadWaitsForEraseWithoutSuspend) {
+    init(&m25p16);
+    fill(0x20000, 0x5A, 16);
+
+    uint8_t buf[16];
+    uint64_t start = sim.now;
+    EXPECT_EQ(0, drv->erase_sector_start(flash_id, 0));
+    EXPECT_LT(sim.now - start, 100u);
+
+    EXPECT_EQ(0, drv->read_data(flash_id, 0x20000, buf, sizeof(buf)));
+    EXPECT_GE(sim.now - start, m25p16.erase_us);
+    EXPECT_EQ(0x5A, buf[0]);
+    EXPECT_EQ(0u, sim.suspends);
+    EXPECT_TRUE(erased(0, 0x10000));
+}
+
+TEST_F(JedecFlash, ReadSuspendsErase) {
+    init(&w25q16);
+    fill(0x2000, 0x5A, 16);
+
+    uint8_t buf[16];
+    uint64_t start = sim.now;
+    EXPECT_EQ(0, drv->start_transaction(flash_id));
+    EXPECT_EQ(0, drv->erase_sector_start(flash_id, 0));
+    PIOS_DELAY_WaituS(5000);
+
+    /* Served right away, the erase stays suspended for the rest of the transaction */
+    uint64_t read = sim.now;
+    EXPECT_EQ(0, drv->read_data(flash_id, 0x2000, buf, sizeof(buf)));
+    EXPECT_EQ(0, drv->read_data(flash_id, 0x2008, buf + 8, 8));
+    EXPECT_LT(sim.now - read, 200u);
+    EXPECT_EQ(1u, sim.suspends);
+    EXPECT_EQ(0x5A, buf[0]);
+    EXPECT_EQ(0x5A, buf[15]);
+
+    EXPECT_EQ(0, drv->end_transaction(flash_id));
+    EXPECT_EQ(1u, sim.resumes);
+
+    while (drv->poll(flash_id, false) > 0) {
+        PIOS_DELAY_WaituS(1000);
+    }
+    EXPECT_GE(sim.now - start, w25q16.erase_us);
+    EXPECT_TRUE(erased(0, 0x1000));
+}
+
+TEST_F(JedecFlash, PollResumesSuspendedErase) {
+    init(&w25q16);
+
+    uint8_t buf[4];
+    EXPECT_EQ(0, drv->erase_sector_start(flash_id, 0x4000));
+    EXPECT_EQ(0, drv->read_data(flash_id, 0, buf, sizeof(buf)));
+    EXPECT_EQ(1u, sim.suspends);
+
+    EXPECT_EQ(1, drv->poll(flash_id, false));
+    EXPECT_EQ(1u, sim.resumes);
+
+    EXPECT_EQ(0, drv->poll(flash_id, true));
+    EXPECT_EQ(0, drv->poll(flash_id, false));
+    EXPECT_FALSE(sim.erasing);
+}
+
+TEST_F(JedecFlash, ProgramWhileEraseSuspended) {
+    init(&w25q16);
+    fill(0, 0x00, 0x1000);
+
+    uint8_t data[64];
+    uint8_t buf[64];
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = 0xA0 + i;
+    }
+
+    EXPECT_EQ(0, drv->erase_sector_start(flash_id, 0));
+    uint64_t start = sim.now;
+    EXPECT_EQ(0, drv->write_data(flash_id, 0x3000, data, sizeof(data)));
+    EXPECT_EQ(0, drv->read_data(flash_id, 0x3000, buf, sizeof(buf)));
+    EXPECT_LT(sim.now - start, 2000u);
+    EXPECT_EQ(0, memcmp(data, buf, sizeof(data)));
+    EXPECT_EQ(1u, sim.suspends);
+
+    /* The program has to finish before the erase is resumed */
+    EXPECT_EQ(0, drv->end_transaction(flash_id));
+    EXPECT_EQ(1u, sim.resumes);
+    EXPECT_EQ(0, drv->poll(flash_id, true));
+    EXPECT_TRUE(erased(0, 0x1000));
+    EXPECT_EQ(0xA0, sim.mem[0x3000]);
+}
+
+TEST_F(JedecFlash, AccessToErasingSectorWaits) {
+    init(&w25q16);
+    fill(0x1000, 0x00, 0x1000);
+    fill(0x3000, 0x5A, 16);
+
+    uint8_t data[16];
+    uint8_t buf[16];
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = 0xC0 + i;
+    }
+
+    /* The program waits for the erase of its own sector instead of suspending it */
+    uint64_t start = sim.now;
+    EXPECT_EQ(0, drv->start_transaction(flash_id));
+    EXPECT_EQ(0, drv->erase_sector_start(flash_id, 0x1000));
+    EXPECT_EQ(0, drv->write_data(flash_id, 0x1100, data, sizeof(data)));
+    EXPECT_GE(sim.now - start, w25q16.erase_us);
+    EXPECT_EQ(0u, sim.suspends);
+    EXPECT_TRUE(erased(0x1000, 0x100));
+
+    /* A read of another sector suspends the next erase, one of that sector resumes it */
+    EXPECT_EQ(0, drv->erase_sector_start(flash_id, 0x1000));
+    start = sim.now;
+    EXPECT_EQ(0, drv->read_data(flash_id, 0x3000, buf, sizeof(buf)));
+    EXPECT_EQ(1u, sim.suspends);
+    EXPECT_EQ(0x5A, buf[0]);
+    EXPECT_EQ(0, drv->read_data(flash_id, 0x1100, buf, sizeof(buf)));
+    EXPECT_EQ(1u, sim.resumes);
+    EXPECT_GE(sim.now - start, w25q16.erase_us);
+    EXPECT_EQ(0xFF, buf[0]);
+    EXPECT_EQ(0, drv->end_transaction(flash_id));
+    EXPECT_EQ(2u, sim.erases);
+}
+
+TEST_F(JedecFlash, EraseWaitsForProgram) {
+    init(&w25q16);
+
+    uint8_t data[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    EXPECT_EQ(0, drv->write_data(flash_id, 0x10, data, sizeof(data)));
+    EXPECT_EQ(0, drv->erase_sector(flash_id, 0x1000));
+    EXPECT_EQ(0, drv->erase_sector(flash_id, 0x2000));
+    EXPECT_EQ(2u, sim.erases);
+    EXPECT_EQ(1, sim.mem[0x10]);
+}
+
+class JedecFlashLogfs : public JedecFlash {
+protected:
+    struct flashfs_logfs_cfg cfg;
+    uintptr_t fs_id;
+    uint8_t obj[200];
+
+    void mount(const struct chip_model *model)
+    {
+        init(model);
+
+        cfg.fs_magic      = 0x89abceef;
+        cfg.total_fs_size = 0x20000;
+        cfg.arena_size    = 0x10000;
+        cfg.slot_size     = 0x100;
+        cfg.start_offset  = 0;
+        cfg.sector_size   = model->sector_size;
+        cfg.page_size     = 0x100;
+
+        ASSERT_EQ(0, PIOS_FLASHFS_Logfs_Init(&fs_id, &cfg, drv, flash_id));
+
+        for (uint32_t i = 0; i < sizeof(obj); i++) {
+            obj[i] = i;
+        }
+    }
+
+    /* What the system task does every 250ms */
+    void poll_until_erased()
+    {
+        int32_t rc;
+
+        while ((rc = PIOS_FLASHFS_Logfs_Poll(fs_id)) > 0) {
+            PIOS_DELAY_WaituS(250000);
+        }
+        EXPECT_EQ(0, rc);
+    }
+
+    /* Save until the log has been garbage collected once, returns the slowest save */
+    uint64_t save_until_gc()
+    {
+        struct PIOS_FLASHFS_Stats stats;
+        uint16_t free_slots;
+        uint64_t slowest = 0;
+
+        PIOS_FLASHFS_GetStats(fs_id, &stats);
+        do {
+            free_slots = stats.num_free_slots;
+            obj[0]++;
+
+            uint64_t start = sim.now;
+            EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, 0x12345678, 0, obj, sizeof(obj)));
+            slowest = std::max(slowest, sim.now - start);
+
+            PIOS_FLASHFS_GetStats(fs_id, &stats);
+        } while (stats.num_free_slots < free_slots);
+
+        return slowest;
+    }
+
+    virtual void TearDown()
+    {
+        PIOS_FLASHFS_Logfs_Destroy(fs_id);
+        JedecFlash::TearDown();
+    }
+};
+
+TEST_F(JedecFlashLogfs, GarbageCollectionUsesBackgroundErase) {
+    mount(&m25p16);
+
+    /* Arena 0 was erased on mount, arena 1 is left to the background */
+    EXPECT_EQ(1u, sim.erases);
+    poll_until_erased();
+    EXPECT_EQ(2u, sim.erases);
+
+    /* Nothing is erased while saving, not even by the garbage collection */
+    uint64_t slowest = save_until_gc();
+    EXPECT_EQ(2u, sim.erases);
+    EXPECT_LT(slowest, m25p16.erase_us / 2);
+
+    /* The old arena is erased in the background for the next round */
+    poll_until_erased();
+    EXPECT_EQ(3u, sim.erases);
+    EXPECT_TRUE(erased(8, 0x10000 - 8));
+
+    uint8_t buf[sizeof(obj)];
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, 0x12345678, 0, buf, sizeof(buf)));
+    EXPECT_EQ(0, memcmp(obj, buf, sizeof(obj)));
+}
+
+TEST_F(JedecFlashLogfs, GarbageCollectionFinishesPendingErase) {
+    mount(&m25p16);
+
+    /* Never polled, the garbage collection has to erase on its own */
+    uint64_t slowest = save_until_gc();
+    EXPECT_EQ(2u, sim.erases);
+    EXPECT_GE(slowest, m25p16.erase_us);
+
+    uint8_t buf[sizeof(obj)];
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, 0x12345678, 0, buf, sizeof(buf)));
+    EXPECT_EQ(0, memcmp(obj, buf, sizeof(obj)));
+}
+
+TEST_F(JedecFlashLogfs, AccessDuringBackgroundErase) {
+    mount(&w25q16);
+
+    uint8_t buf[sizeof(obj)];
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, 0x12345678, 0, obj, sizeof(obj)));
+
+    /* Starts erasing the first sector of arena 1 */
+    uint32_t erases = sim.erases;
+    EXPECT_EQ(1, PIOS_FLASHFS_Logfs_Poll(fs_id));
+    EXPECT_EQ(erases + 1, sim.erases);
+
+    /* Loads and saves suspend the erase instead of waiting for it */
+    uint64_t start = sim.now;
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, 0x12345678, 0, buf, sizeof(buf)));
+    EXPECT_EQ(0, memcmp(obj, buf, sizeof(obj)));
+    obj[0]++;
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, 0x12345678, 0, obj, sizeof(obj)));
+    EXPECT_LT(sim.now - start, w25q16.erase_us / 4);
+    EXPECT_EQ(2u, sim.suspends);
+    EXPECT_EQ(2u, sim.resumes);
+
+    poll_until_erased();
+    EXPECT_EQ(erases + 16, sim.erases);
+    EXPECT_TRUE(erased(0x10000 + 8, 0x10000 - 8));
+
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, 0x12345678, 0, buf, sizeof(buf)));
+    EXPECT_EQ(0, memcmp(obj, buf, sizeof(obj)));
+}
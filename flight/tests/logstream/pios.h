@@ -0,0 +1,9 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "pios_crc.h"
+
+#endif /* PIOS_H */
@@ -0,0 +1,708 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* getenv */
+#include <string.h> /* memset */
+#include <map>
+#include <vector>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+extern "C" {
+#include "openpilot.h"
+#include "logstream.h"
+}
+
+/*
+ * A packed DebugLogEntry, fields sorted by size as the generator does, and
+ * where its Flight and Entry fields are
+ */
+#define ENTRY_SIZE   217
+#define ENTRY_FLIGHT 8
+#define ENTRY_NUMBER 10
+
+#define SYNC_VAL     0x3C
+#define TYPE_OBJ     0x20
+#define TYPE_OBJ_REQ 0x21
+#define TYPE_STREAM  0x25
+#define HEADER_SIZE  10
+
+// Any object ID, streams are not unpacked into objects
+#define STREAM_OBJID 0xC9AB4E64
+
+/*
+ * Transfer rate for the benchmark: one 64 byte HID report per USB frame
+ * each way
+ */
+#define USB_REPORT_SIZE   64
+#define USB_FRAMES_PER_S  1000.0
+
+typedef std::vector<uint8_t> Bytes;
+
+/*
+ * The RTOS and object manager, as far as streams go: nothing blocks and
+ * there are no objects
+ */
+static uint8_t lock;
+
+xSemaphoreHandle xSemaphoreCreateRecursiveMutex(void)
+{
+    return &lock;
+}
+
+int32_t xSemaphoreTakeRecursive(__attribute__((unused)) xSemaphoreHandle sema, __attribute__((unused)) portTickType ticks)
+{
+    return pdTRUE;
+}
+
+int32_t xSemaphoreGiveRecursive(__attribute__((unused)) xSemaphoreHandle sema)
+{
+    return pdTRUE;
+}
+
+int32_t xSemaphoreTake(__attribute__((unused)) xSemaphoreHandle sema, __attribute__((unused)) portTickType ticks)
+{
+    return pdTRUE;
+}
+
+int32_t xSemaphoreGive(__attribute__((unused)) xSemaphoreHandle sema)
+{
+    return pdTRUE;
+}
+
+portTickType xTaskGetTickCount(void)
+{
+    return 0;
+}
+
+void *pios_malloc(size_t size)
+{
+    return malloc(size);
+}
+
+UAVObjHandle UAVObjGetByID(__attribute__((unused)) uint32_t id)
+{
+    return NULL;
+}
+
+uint32_t UAVObjGetID(__attribute__((unused)) UAVObjHandle obj)
+{
+    return 0;
+}
+
+uint32_t UAVObjGetNumBytes(__attribute__((unused)) UAVObjHandle obj)
+{
+    return 0;
+}
+
+uint16_t UAVObjGetNumInstances(__attribute__((unused)) UAVObjHandle obj)
+{
+    return 0;
+}
+
+bool UAVObjIsSingleInstance(__attribute__((unused)) UAVObjHandle obj)
+{
+    return true;
+}
+
+int32_t UAVObjPack(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, __attribute__((unused)) uint8_t *dataOut)
+{
+    return -1;
+}
+
+int32_t UAVObjUnpack(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, __attribute__((unused)) const uint8_t *dataIn)
+{
+    return -1;
+}
+
+/*
+ * The flash log: entries of a few flights, each filled from its number
+ */
+static std::map<uint16_t, std::vector<Bytes> > flashLog;
+static uint32_t reads;
+
+static Bytes makeEntry(uint16_t flight, uint16_t entry)
+{
+    Bytes data(ENTRY_SIZE);
+
+    for (uint32_t i = 0; i < ENTRY_SIZE; i++) {
+        data[i] = (uint8_t)(flight * 31 + entry * 7 + i);
+    }
+    data[ENTRY_FLIGHT]     = flight & 0xFF;
+    data[ENTRY_FLIGHT + 1] = flight >> 8;
+    data[ENTRY_NUMBER]     = entry & 0xFF;
+    data[ENTRY_NUMBER + 1] = entry >> 8;
+    return data;
+}
+
+static void fillLog(uint16_t flight, uint16_t entries)
+{
+    flashLog[flight].clear();
+    for (uint16_t i = 0; i < entries; i++) {
+        flashLog[flight].push_back(makeEntry(flight, i));
+    }
+}
+
+static bool readEntry(__attribute__((unused)) void *ctx, uint16_t flight, uint16_t entry, uint8_t *out)
+{
+    reads++;
+    if (!flashLog.count(flight) || entry >= flashLog[flight].size()) {
+        return false;
+    }
+    memcpy(out, &flashLog[flight][entry][0], ENTRY_SIZE);
+    return true;
+}
+
+/*
+ * The link: the bytes UAVTalk writes out
+ */
+static Bytes wire;
+static uint32_t writes;
+static int32_t failWrite;
+
+static int32_t outStream(uint8_t *data, int32_t length)
+{
+    if (++writes == (uint32_t)failWrite) {
+        return -2;
+    }
+    wire.insert(wire.end(), data, data + length);
+    return length;
+}
+
+struct Frame {
+    uint8_t  type;
+    uint32_t objId;
+    uint16_t instId;
+    Bytes    data;
+};
+
+/*
+ * Splits received bytes into UAVTalk packets, dropping whatever does not
+ * pass the checksum as the GCS does
+ */
+static std::vector<Frame> parseFrames(const Bytes & bytes)
+{
+    std::vector<Frame> frames;
+    size_t pos = 0;
+
+    while (pos + HEADER_SIZE + 1 <= bytes.size()) {
+        if (bytes[pos] != SYNC_VAL) {
+            pos++;
+            continue;
+        }
+        uint16_t size = bytes[pos + 2] | (bytes[pos + 3] << 8);
+        if (size < HEADER_SIZE || pos + size + 1 > bytes.size() ||
+            PIOS_CRC_updateCRC(0, &bytes[pos], size) != bytes[pos + size]) {
+            pos++;
+            continue;
+        }
+        Frame frame;
+        frame.type   = bytes[pos + 1];
+        frame.objId  = bytes[pos + 4] | (bytes[pos + 5] << 8) | (bytes[pos + 6] << 16) | ((uint32_t)bytes[pos + 7] << 24);
+        frame.instId = bytes[pos + 8] | (bytes[pos + 9] << 8);
+        frame.data.assign(bytes.begin() + pos + HEADER_SIZE, bytes.begin() + pos + size);
+        frames.push_back(frame);
+        pos += size + 1;
+    }
+    return frames;
+}
+
+/*
+ * The GCS side of a readout: takes the chunks in order and asks for a new
+ * stream from the first entry it lacks when one is missing or bad
+ */
+struct Reader {
+    uint16_t flight;
+    uint16_t expected;
+    bool     resyncing;
+    bool     done;
+    uint32_t restarts;
+    std::vector<Bytes> entries;
+
+    explicit Reader(uint16_t f) : flight(f), expected(0), resyncing(false), done(false), restarts(0) {}
+
+    // Returns true when a new stream is needed
+    bool receive(const Bytes & chunk)
+    {
+        struct logstream_header header;
+        int32_t count = logstream_check(&chunk[0], chunk.size(), ENTRY_SIZE, &header);
+
+        if (count < 0) {
+            return restart();
+        }
+        if (header.flight != flight || header.entry < expected || (resyncing && header.entry != expected)) {
+            // left over from a stream that was restarted
+            return false;
+        }
+        if (header.entry != expected) {
+            return restart();
+        }
+        for (int32_t i = 0; i < count; i++) {
+            entries.push_back(Bytes(chunk.begin() + LOGSTREAM_HEADER_SIZE + i * ENTRY_SIZE,
+                                    chunk.begin() + LOGSTREAM_HEADER_SIZE + (i + 1) * ENTRY_SIZE));
+        }
+        expected += count;
+        resyncing = false;
+        done = (header.flags & LOGSTREAM_FLAG_LAST) != 0;
+        return false;
+    }
+
+    bool restart()
+    {
+        resyncing = true;
+        restarts++;
+        return true;
+    }
+};
+
+static std::vector<Bytes> readAll(struct logstream *stream, uint16_t flight, uint16_t entry, uint16_t count)
+{
+    std::vector<Bytes> chunks;
+    Bytes chunk(LOGSTREAM_CHUNK_SIZE(ENTRY_SIZE));
+    uint32_t length;
+
+    logstream_start(stream, flight, entry, count);
+    while ((length = logstream_next(stream, &chunk[0])) > 0) {
+        chunks.push_back(Bytes(chunk.begin(), chunk.begin() + length));
+    }
+    return chunks;
+}
+
+class LogStream : public testing::Test {
+protected:
+    struct logstream stream;
+
+    virtual void SetUp()
+    {
+        flashLog.clear();
+        reads = 0;
+        fillLog(0, 3);
+        fillLog(1, 10);
+        fillLog(2, 0);
+        logstream_init(&stream, ENTRY_SIZE, readEntry, NULL);
+    }
+};
+
+TEST_F(LogStream, SameCrcAsPios) {
+    Bytes data(1000);
+
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = (uint8_t)(i * 13 + (i >> 3));
+    }
+    for (size_t length = 0; length < data.size(); length += 97) {
+        EXPECT_EQ(PIOS_CRC32_updateCRC(0xFFFFFFFF, &data[0], length), logstream_crc32(0xFFFFFFFF, &data[0], length));
+    }
+}
+
+TEST_F(LogStream, ChunksCoverTheFlight) {
+    std::vector<Bytes> chunks = readAll(&stream, 1, 0, 0);
+    struct logstream_header header;
+
+    ASSERT_EQ(3U, chunks.size());
+    uint16_t entry = 0;
+    for (size_t i = 0; i < chunks.size(); i++) {
+        int32_t count = logstream_check(&chunks[i][0], chunks[i].size(), ENTRY_SIZE, &header);
+        ASSERT_EQ(i < 2 ? 4 : 2, count);
+        EXPECT_EQ(1, header.flight);
+        EXPECT_EQ(entry, header.entry);
+        EXPECT_EQ(i < 2 ? 0 : LOGSTREAM_FLAG_LAST, header.flags);
+        for (int32_t n = 0; n < count; n++) {
+            EXPECT_EQ(0, memcmp(&chunks[i][LOGSTREAM_HEADER_SIZE + n * ENTRY_SIZE], &flashLog[1][entry + n][0], ENTRY_SIZE));
+        }
+        entry += count;
+    }
+
+    // Stopped at the first missing entry, and does not go on
+    EXPECT_EQ(11U, reads);
+    EXPECT_TRUE(stream.done);
+    Bytes chunk(LOGSTREAM_CHUNK_SIZE(ENTRY_SIZE));
+    EXPECT_EQ(0U, logstream_next(&stream, &chunk[0]));
+}
+
+TEST_F(LogStream, CountAndStart) {
+    struct logstream_header header;
+
+    // From the middle, for fewer entries than there are
+    std::vector<Bytes> chunks = readAll(&stream, 1, 3, 5);
+    ASSERT_EQ(2U, chunks.size());
+    EXPECT_EQ(4, logstream_check(&chunks[0][0], chunks[0].size(), ENTRY_SIZE, &header));
+    EXPECT_EQ(3, header.entry);
+    EXPECT_EQ(1, logstream_check(&chunks[1][0], chunks[1].size(), ENTRY_SIZE, &header));
+    EXPECT_EQ(7, header.entry);
+    EXPECT_EQ(LOGSTREAM_FLAG_LAST, header.flags);
+
+    // A full chunk that ends the stream needs no empty one after it
+    chunks = readAll(&stream, 1, 0, 4);
+    ASSERT_EQ(1U, chunks.size());
+    EXPECT_EQ(4, logstream_check(&chunks[0][0], chunks[0].size(), ENTRY_SIZE, &header));
+    EXPECT_EQ(LOGSTREAM_FLAG_LAST, header.flags);
+
+    // A flight without entries, and past the end of one, is a single empty chunk
+    for (uint16_t entry = 0; entry < 2; entry++) {
+        chunks = readAll(&stream, 2 - entry, entry * 10, 0);
+        ASSERT_EQ(1U, chunks.size());
+        EXPECT_EQ(0, logstream_check(&chunks[0][0], chunks[0].size(), ENTRY_SIZE, &header));
+        EXPECT_EQ(LOGSTREAM_FLAG_LAST, header.flags);
+        EXPECT_EQ((uint32_t)LOGSTREAM_HEADER_SIZE, chunks[0].size());
+    }
+}
+
+TEST_F(LogStream, BadChunks) {
+    std::vector<Bytes> chunks = readAll(&stream, 0, 0, 0);
+    struct logstream_header header;
+
+    ASSERT_EQ(1U, chunks.size());
+    Bytes chunk = chunks[0];
+
+    // Any bit flipped is caught, in the header as in the entries
+    for (size_t i = 0; i < chunk.size(); i++) {
+        for (uint8_t bit = 0; bit < 8; bit += 3) {
+            chunk[i] ^= 1 << bit;
+            EXPECT_GT(0, logstream_check(&chunk[0], chunk.size(), ENTRY_SIZE, &header)) << i;
+            chunk[i] ^= 1 << bit;
+        }
+    }
+    EXPECT_EQ(3, logstream_check(&chunk[0], chunk.size(), ENTRY_SIZE, &header));
+
+    EXPECT_EQ(LOGSTREAM_ERR_LENGTH, logstream_check(&chunk[0], chunk.size() - 1, ENTRY_SIZE, &header));
+    EXPECT_EQ(LOGSTREAM_ERR_LENGTH, logstream_check(&chunk[0], LOGSTREAM_HEADER_SIZE - 1, ENTRY_SIZE, &header));
+    EXPECT_EQ(LOGSTREAM_ERR_LENGTH, logstream_check(&chunk[0], chunk.size(), ENTRY_SIZE + 1, &header));
+    chunk[2] ^= 0x01;
+    EXPECT_EQ(LOGSTREAM_ERR_CRC, logstream_check(&chunk[0], chunk.size(), ENTRY_SIZE, &header));
+}
+
+class UAVTalkStream : public testing::Test {
+protected:
+    UAVTalkConnection connection;
+
+    virtual void SetUp()
+    {
+        wire.clear();
+        writes     = 0;
+        failWrite  = 0;
+        connection = UAVTalkInitialize(outStream);
+        ASSERT_TRUE(connection != NULL);
+    }
+};
+
+TEST_F(UAVTalkStream, Framing) {
+    Bytes data(LOGSTREAM_CHUNK_SIZE(ENTRY_SIZE));
+
+    for (size_t i = 0; i < data.size(); i++) {
+        data[i] = (uint8_t)(i ^ 0x5A);
+    }
+    ASSERT_EQ(0, UAVTalkSendStream(connection, STREAM_OBJID, 3, &data[0], data.size()));
+
+    ASSERT_EQ(HEADER_SIZE + data.size() + 1, wire.size());
+    EXPECT_EQ(SYNC_VAL, wire[0]);
+    EXPECT_EQ(TYPE_STREAM, wire[1]);
+    EXPECT_EQ(HEADER_SIZE + data.size(), (size_t)(wire[2] | (wire[3] << 8)));
+    EXPECT_EQ(0, memcmp(&wire[HEADER_SIZE], &data[0], data.size()));
+
+    std::vector<Frame> frames = parseFrames(wire);
+    ASSERT_EQ(1U, frames.size());
+    EXPECT_EQ(TYPE_STREAM, frames[0].type);
+    EXPECT_EQ(STREAM_OBJID, frames[0].objId);
+    EXPECT_EQ(3, frames[0].instId);
+    EXPECT_TRUE(frames[0].data == data);
+
+    UAVTalkStats stats;
+    UAVTalkGetStats(connection, &stats, false);
+    EXPECT_EQ(1U, stats.txObjects);
+    EXPECT_EQ(data.size(), stats.txObjectBytes);
+    EXPECT_EQ(wire.size(), stats.txBytes);
+    EXPECT_EQ(0U, stats.txErrors);
+}
+
+TEST_F(UAVTalkStream, Errors) {
+    Bytes data(UAVTALK_MAX_STREAM_LENGTH + 1);
+    UAVTalkStats stats;
+
+    // Larger than the GCS takes
+    EXPECT_EQ(-1, UAVTalkSendStream(connection, STREAM_OBJID, 0, &data[0], data.size()));
+    EXPECT_EQ(0U, writes);
+
+    // The port gives up halfway
+    failWrite = 2;
+    EXPECT_EQ(-1, UAVTalkSendStream(connection, STREAM_OBJID, 0, &data[0], 100));
+    EXPECT_EQ((size_t)HEADER_SIZE, wire.size());
+    UAVTalkGetStats(connection, &stats, true);
+    EXPECT_EQ(0U, stats.txObjects);
+    EXPECT_EQ(2U, stats.txErrors);
+
+    // No port
+    UAVTalkSetOutputStream(connection, NULL);
+    EXPECT_EQ(-1, UAVTalkSendStream(connection, STREAM_OBJID, 0, &data[0], 100));
+}
+
+/*
+ * Streams a flight over a link that loses and damages packets, restarting
+ * as the GCS does when it lacks entries or hears nothing more
+ */
+static Reader readOverLink(UAVTalkConnection connection, struct logstream *stream, uint16_t flight, uint32_t dropOneIn, uint32_t damageOneIn)
+{
+    Reader reader(flight);
+    Bytes chunk(LOGSTREAM_CHUNK_SIZE(ENTRY_SIZE));
+    uint32_t seed = 1;
+
+    logstream_start(stream, flight, 0, 0);
+    while (!reader.done) {
+        uint32_t length = logstream_next(stream, &chunk[0]);
+        if (length == 0) {
+            // Nothing comes any more, the GCS times out and asks again
+            reader.restart();
+            logstream_start(stream, flight, reader.expected, 0);
+            continue;
+        }
+        EXPECT_EQ(0, UAVTalkSendStream(connection, STREAM_OBJID, 0, &chunk[0], length));
+
+        seed = seed * 1103515245 + 12345;
+        if (dropOneIn && (seed >> 16) % dropOneIn == 0) {
+            wire.clear();
+        }
+        seed = seed * 1103515245 + 12345;
+        if (damageOneIn && (seed >> 16) % damageOneIn == 0 && !wire.empty()) {
+            wire[(seed >> 8) % wire.size()] ^= 0x10;
+        }
+
+        std::vector<Frame> frames = parseFrames(wire);
+        wire.clear();
+        for (size_t i = 0; i < frames.size(); i++) {
+            EXPECT_EQ(TYPE_STREAM, frames[i].type);
+            if (reader.receive(frames[i].data)) {
+                logstream_start(stream, flight, reader.expected, 0);
+            }
+        }
+    }
+    return reader;
+}
+
+TEST_F(UAVTalkStream, ResumeOnErrors) {
+    struct logstream stream;
+
+    flashLog.clear();
+    fillLog(4, 250);
+    logstream_init(&stream, ENTRY_SIZE, readEntry, NULL);
+
+    Reader clean = readOverLink(connection, &stream, 4, 0, 0);
+    EXPECT_EQ(0U, clean.restarts);
+    EXPECT_TRUE(clean.entries == flashLog[4]);
+
+    Reader lossy = readOverLink(connection, &stream, 4, 7, 5);
+    EXPECT_LT(0U, lossy.restarts);
+    EXPECT_TRUE(lossy.entries == flashLog[4]);
+
+    // Half of the chunks lost, a lost last one is only noticed by the timeout
+    fillLog(4, 8);
+    Reader tail = readOverLink(connection, &stream, 4, 2, 0);
+    EXPECT_LT(0U, tail.restarts);
+    EXPECT_TRUE(tail.entries == flashLog[4]);
+}
+
+static uint32_t usbFrames(uint32_t bytes)
+{
+    return (bytes + USB_REPORT_SIZE - 1) / USB_REPORT_SIZE;
+}
+
+TEST_F(UAVTalkStream, Throughput) {
+    const uint16_t entries = 2000;
+    struct logstream stream;
+
+    flashLog.clear();
+    fillLog(0, entries);
+    logstream_init(&stream, ENTRY_SIZE, readEntry, NULL);
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    Reader reader = readOverLink(connection, &stream, 0, 0, 0);
+    std::chrono::duration<double> hostTime = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(entries, reader.entries.size());
+
+    UAVTalkStats stats;
+    UAVTalkGetStats(connection, &stats, false);
+
+    // Streamed, the reports follow each other
+    uint32_t streamFrames = usbFrames(stats.txBytes);
+
+    // One entry at a time: DebugLogControl sent acked, its ack, the request
+    // for DebugLogEntry and the entry, each waiting for the one before
+    uint32_t entryFrames  = usbFrames(HEADER_SIZE + 7 + 1) + usbFrames(HEADER_SIZE + 1) +
+                            usbFrames(HEADER_SIZE + 1) + usbFrames(HEADER_SIZE + ENTRY_SIZE + 1);
+
+    double streamRate = entries / (streamFrames / USB_FRAMES_PER_S);
+    double entryRate  = USB_FRAMES_PER_S / entryFrames;
+
+    printf("%u entries, %u chunks, %u bytes in %.1f ms on the host\n",
+           entries, stats.txObjects, stats.txBytes, hostTime.count() * 1000);
+    printf("  USB: %.0f entries/s (%.1f kB/s) streamed, %.0f entries/s one at a time\n",
+           streamRate, streamRate * ENTRY_SIZE / 1000, entryRate);
+
+    // The chunks keep the link busy, where the round trips leave it idle
+    EXPECT_LT(0.9 * USB_REPORT_SIZE * USB_FRAMES_PER_S, streamRate * ENTRY_SIZE);
+    EXPECT_LT(1.5 * entryRate, streamRate);
+}
+
+/*
+ * Against a running simposix firmware, when LOGSTREAM_SIMPOSIX is set to
+ * its telemetry address (e.g. 127.0.0.1:9000). The object IDs and enum
+ * values come from the headers generated for the flight side.
+ */
+static uint32_t generatedDefine(const char *object, const char *name)
+{
+    const char *dir = getenv("OPUAVSYNTHDIR");
+    std::ifstream header((std::string(dir ? dir : ".") + "/" + object + ".h").c_str());
+    std::string line;
+    std::string define = std::string("#define ") + name + " ";
+    std::string option = std::string("    ") + name + "=";
+
+    while (std::getline(header, line)) {
+        if (line.compare(0, define.size(), define) == 0) {
+            return strtoul(line.c_str() + define.size(), NULL, 0);
+        }
+        if (line.compare(0, option.size(), option) == 0) {
+            return strtoul(line.c_str() + option.size(), NULL, 0);
+        }
+    }
+    ADD_FAILURE() << "no " << name << " in " << object << ".h";
+    return 0;
+}
+
+static Bytes packet(uint8_t type, uint32_t objId, const Bytes & data)
+{
+    Bytes bytes(HEADER_SIZE);
+
+    bytes[0] = SYNC_VAL;
+    bytes[1] = type;
+    bytes[2] = (HEADER_SIZE + data.size()) & 0xFF;
+    bytes[3] = (HEADER_SIZE + data.size()) >> 8;
+    for (int i = 0; i < 4; i++) {
+        bytes[4 + i] = (objId >> (8 * i)) & 0xFF;
+    }
+    bytes.insert(bytes.end(), data.begin(), data.end());
+    bytes.push_back(PIOS_CRC_updateCRC(0, &bytes[0], bytes.size()));
+    return bytes;
+}
+
+class Simposix {
+public:
+    int sock;
+    struct sockaddr_in addr;
+
+    Simposix() : sock(-1) {}
+    ~Simposix()
+    {
+        if (sock >= 0) {
+            close(sock);
+        }
+    }
+
+    bool open(const char *target)
+    {
+        std::string host(target);
+        size_t colon = host.find(':');
+        struct timeval timeout = { 2, 0 };
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port   = htons(colon == std::string::npos ? 9000 : atoi(host.c_str() + colon + 1));
+        if (inet_pton(AF_INET, host.substr(0, colon).c_str(), &addr.sin_addr) != 1) {
+            return false;
+        }
+        sock = socket(AF_INET, SOCK_DGRAM, 0);
+        return sock >= 0 && setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0;
+    }
+
+    void send(const Bytes & bytes)
+    {
+        ASSERT_EQ((ssize_t)bytes.size(), sendto(sock, &bytes[0], bytes.size(), 0, (struct sockaddr *)&addr, sizeof(addr)));
+    }
+
+    // Packets of one object until the timeout, datagrams may split them
+    std::vector<Frame> receive(uint32_t objId, uint8_t type, size_t wanted)
+    {
+        std::vector<Frame> frames;
+        Bytes bytes;
+        uint8_t buffer[2048];
+        ssize_t length;
+
+        while (frames.size() < wanted && (length = recv(sock, buffer, sizeof(buffer), 0)) > 0) {
+            bytes.insert(bytes.end(), buffer, buffer + length);
+            std::vector<Frame> all = parseFrames(bytes);
+            frames.clear();
+            for (size_t i = 0; i < all.size(); i++) {
+                if (all[i].objId == objId && all[i].type == type) {
+                    frames.push_back(all[i]);
+                }
+            }
+        }
+        return frames;
+    }
+};
+
+TEST(LogStreamSimposix, Readout) {
+    const char *target = getenv("LOGSTREAM_SIMPOSIX");
+
+    if (!target) {
+        printf("LOGSTREAM_SIMPOSIX not set, no simposix firmware to read from\n");
+        return;
+    }
+
+    Simposix sim;
+    ASSERT_TRUE(sim.open(target));
+
+    uint32_t settingsId = generatedDefine("debuglogsettings", "DEBUGLOGSETTINGS_OBJID");
+    uint32_t controlId  = generatedDefine("debuglogcontrol", "DEBUGLOGCONTROL_OBJID");
+    uint32_t statusId   = generatedDefine("debuglogstatus", "DEBUGLOGSTATUS_OBJID");
+    uint32_t entryId    = generatedDefine("debuglogentry", "DEBUGLOGENTRY_OBJID");
+    uint8_t always = generatedDefine("debuglogsettings", "DEBUGLOGSETTINGS_LOGGINGENABLED_ALWAYS");
+    uint8_t streamOp    = generatedDefine("debuglogcontrol", "DEBUGLOGCONTROL_OPERATION_STREAM");
+
+    // Logging on, which logs that it is, then the flight it went to
+    sim.send(packet(TYPE_OBJ, settingsId, Bytes(1, always)));
+    usleep(200000);
+    sim.send(packet(TYPE_OBJ_REQ, statusId, Bytes()));
+    std::vector<Frame> status = sim.receive(statusId, TYPE_OBJ, 1);
+    ASSERT_EQ(1U, status.size());
+    ASSERT_LE(2U, status[0].data.size());
+    uint16_t flight = status[0].data[0] | (status[0].data[1] << 8);
+
+    // Flight, Entry, Count, Operation
+    std::vector<Bytes> entries[2];
+    for (uint16_t first = 0; first < 2; first++) {
+        Bytes control(7, 0);
+        control[0] = flight & 0xFF;
+        control[1] = flight >> 8;
+        control[2] = first;
+        control[6] = streamOp;
+        sim.send(packet(TYPE_OBJ, controlId, control));
+
+        Reader reader(flight);
+        reader.expected = first;
+        while (!reader.done) {
+            std::vector<Frame> chunks = sim.receive(entryId, TYPE_STREAM, 1);
+            ASSERT_EQ(1U, chunks.size()) << "no chunk after entry " << reader.expected;
+            ASSERT_FALSE(reader.receive(chunks[0].data)) << "bad chunk after entry " << reader.expected;
+        }
+        entries[first] = reader.entries;
+
+        for (size_t i = 0; i < entries[first].size(); i++) {
+            const Bytes & entry = entries[first][i];
+            EXPECT_EQ(flight, entry[ENTRY_FLIGHT] | (entry[ENTRY_FLIGHT + 1] << 8));
+            EXPECT_EQ(first + i, (size_t)(entry[ENTRY_NUMBER] | (entry[ENTRY_NUMBER + 1] << 8)));
+        }
+    }
+
+    // At least the entry logging on wrote, and the same from the second one
+    // on, the firmware may have logged more in between
+    ASSERT_LE(1U, entries[0].size());
+    ASSERT_LE(entries[0].size(), entries[1].size() + 1);
+    for (size_t i = 0; i + 1 < entries[0].size(); i++) {
+        EXPECT_TRUE(entries[0][i + 1] == entries[1][i]);
+    }
+}
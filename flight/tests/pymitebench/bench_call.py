@@ -0,0 +1,20 @@
+# Function calls and list subscripts
+
+ITERATIONS = 5000
+
+def clamp(v, lo, hi):
+    if v < lo:
+        return lo
+    if v > hi:
+        return hi
+    return v
+
+table = [0, 3, -4, 12, 7, -9, 15, 2]
+
+i = 0
+total = 0
+while i < ITERATIONS:
+    total = total + clamp(table[i & 7] * 2, -10, 10)
+    i += 1
+
+assert total == 13750
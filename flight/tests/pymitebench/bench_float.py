@@ -0,0 +1,24 @@
+# Float arithmetic, a PID loop driving a simulated position to its setpoint
+
+ITERATIONS = 10000
+
+kp = 0.8
+ki = 0.05
+kd = 0.01
+dt = 0.01
+setpoint = 10.0
+position = 0.0
+integral = 0.0
+lasterr = 0.0
+
+i = 0
+while i < ITERATIONS:
+    err = setpoint - position
+    integral = integral + err * dt
+    deriv = (err - lasterr) / dt
+    out = kp * err + ki * integral + kd * deriv
+    position = position + out * dt
+    lasterr = err
+    i += 1
+
+assert position > 9.9 and position < 10.1
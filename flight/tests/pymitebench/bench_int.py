@@ -0,0 +1,13 @@
+# Integer arithmetic, masks and shifts, as in a flight plan's bookkeeping
+
+ITERATIONS = 20000
+
+i = 0
+acc = 0
+while i < ITERATIONS:
+    acc = (acc + i * 3 - (i >> 2)) & 0xFFFF
+    if acc % 7 == 0:
+        acc = acc ^ 0x55
+    i += 1
+
+assert acc == 2382
@@ -0,0 +1,17 @@
+# Iteration over a list of tuples and dict updates, as when walking waypoints
+
+ITERATIONS = 2000
+
+waypoints = [(0, 0), (100, 0), (100, 100), (0, 100)]
+status = {"visited": 0, "distance": 0}
+
+i = 0
+while i < ITERATIONS:
+    for north, east in waypoints:
+        d = abs(north - 50) + abs(east - 50)
+        status["distance"] = status["distance"] + d
+    status["visited"] = status["visited"] + len(waypoints)
+    i += 1
+
+assert status["visited"] == ITERATIONS * 4
+assert status["distance"] == ITERATIONS * 400
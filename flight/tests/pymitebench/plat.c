@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ *
+ * @file       plat.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      PyMite platform for the host interpreter benchmark, no I/O
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#undef __FILE_ID__
+#define __FILE_ID__ 0x70
+
+#include "pm.h"
+
+PmReturn_t plat_init(void)
+{
+    return PM_RET_OK;
+}
+
+PmReturn_t plat_deinit(void)
+{
+    return PM_RET_OK;
+}
+
+uint8_t plat_memGetByte(PmMemSpace_t memspace, uint8_t const **paddr)
+{
+    uint8_t b = 0;
+
+    switch (memspace) {
+    case MEMSPACE_RAM:
+    case MEMSPACE_PROG:
+        b = **paddr;
+        *paddr += 1;
+        return b;
+
+    default:
+        return 0;
+    }
+}
+
+PmReturn_t plat_getByte(uint8_t *b)
+{
+    PmReturn_t retval = PM_RET_OK;
+
+    *b = 0;
+    PM_RAISE(retval, PM_RET_EX_IO);
+    return retval;
+}
+
+PmReturn_t plat_putByte(__attribute__((unused)) uint8_t b)
+{
+    return PM_RET_OK;
+}
+
+PmReturn_t plat_getMsTicks(uint32_t *r_ticks)
+{
+    *r_ticks = pm_timerMsTicks;
+
+    return PM_RET_OK;
+}
+
+void plat_reportError(__attribute__((unused)) PmReturn_t result)
+{}
@@ -0,0 +1,139 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <chrono>
+
+extern "C" {
+#include "pm.h"
+
+extern unsigned char const usrlib_img[];
+}
+
+/* Runs of each script, the fastest one is reported */
+#define RUNS 5
+
+/*
+ * The benchmark scripts, each a loop of ITERATIONS passes that asserts its
+ * own result, so a wrong answer fails the run before it is timed.
+ */
+static const struct {
+    const char *module;
+    uint32_t   iterations;
+} scripts[] = {
+    { "bench_int",   20000 },
+    { "bench_float", 10000 },
+    { "bench_call",  5000  },
+    { "bench_seq",   2000  },
+};
+
+#define NUM_SCRIPTS (sizeof(scripts) / sizeof(scripts[0]))
+
+/* The collectors the scripts must run under: stop-the-world and the default step */
+static const uint16_t stepWorks[] = { 0, 64 };
+
+#define NUM_STEP_WORKS (sizeof(stepWorks) / sizeof(stepWorks[0]))
+
+static PmReturn_t runScript(const char *module)
+{
+    PmReturn_t retval;
+
+    retval = pm_init(MEMSPACE_PROG, usrlib_img);
+    if (retval != PM_RET_OK) {
+        return retval;
+    }
+    return pm_run((uint8_t const *)module);
+}
+
+static PmReturn_t runScript(const char *module, uint16_t stepWork, PmGcStats_t *stats)
+{
+    PmReturn_t retval;
+
+    retval = pm_init(MEMSPACE_PROG, usrlib_img);
+    if (retval != PM_RET_OK) {
+        return retval;
+    }
+    heap_gcSetStepWork(stepWork);
+    heap_gcResetStats();
+
+    retval = pm_run((uint8_t const *)module);
+    heap_gcGetStats(stats);
+    return retval;
+}
+
+class PyMiteBench : public testing::Test {};
+
+TEST_F(PyMiteBench, ScriptsRun) {
+    for (size_t w = 0; w < NUM_STEP_WORKS; w++) {
+        SCOPED_TRACE(stepWorks[w]);
+        for (size_t i = 0; i < NUM_SCRIPTS; i++) {
+            PmGcStats_t stats;
+
+            EXPECT_EQ(PM_RET_OK, runScript(scripts[i].module, stepWorks[w], &stats)) << scripts[i].module;
+
+            // The collector did run, in steps or whole
+            if (stepWorks[w] == 0) {
+                EXPECT_LT(0U, stats.fullRuns) << scripts[i].module;
+                EXPECT_EQ(0U, stats.steps) << scripts[i].module;
+            } else {
+                EXPECT_LT(0U, stats.steps) << scripts[i].module;
+            }
+        }
+    }
+}
+
+TEST_F(PyMiteBench, SmallIntsAreShared) {
+    pPmObj_t a;
+    pPmObj_t b;
+
+    ASSERT_EQ(PM_RET_OK, pm_init(MEMSPACE_PROG, C_NULL));
+    uint16_t avail = heap_getAvail();
+
+    for (int32_t n = PM_INT_CACHE_MIN; n <= PM_INT_CACHE_MAX; n++) {
+        ASSERT_EQ(PM_RET_OK, int_new(n, &a));
+        ASSERT_EQ(PM_RET_OK, int_new(n, &b));
+        EXPECT_EQ(a, b) << n;
+        EXPECT_EQ(n, ((pPmInt_t)a)->val);
+    }
+    EXPECT_EQ(avail, heap_getAvail());
+
+    // The constants are part of the cache
+    ASSERT_EQ(PM_RET_OK, int_new(0, &a));
+    EXPECT_EQ(PM_ZERO, a);
+    ASSERT_EQ(PM_RET_OK, int_new(1, &a));
+    EXPECT_EQ(PM_ONE, a);
+    ASSERT_EQ(PM_RET_OK, int_new(-1, &a));
+    EXPECT_EQ(PM_NEGONE, a);
+
+    // Anything else is still allocated
+    ASSERT_EQ(PM_RET_OK, int_new(PM_INT_CACHE_MAX + 1, &a));
+    ASSERT_EQ(PM_RET_OK, int_new(PM_INT_CACHE_MAX + 1, &b));
+    EXPECT_NE(a, b);
+    EXPECT_GT(avail, heap_getAvail());
+
+    // Collecting leaves the cached ints alone
+    EXPECT_EQ(PM_RET_OK, heap_gcRun());
+    ASSERT_EQ(PM_RET_OK, int_new(PM_INT_CACHE_MIN, &a));
+    EXPECT_EQ(PM_INT_CACHE_MIN, ((pPmInt_t)a)->val);
+}
+
+TEST_F(PyMiteBench, OpsPerSecond) {
+    for (size_t i = 0; i < NUM_SCRIPTS; i++) {
+        double best = 0;
+
+        for (int run = 0; run < RUNS; run++) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            ASSERT_EQ(PM_RET_OK, runScript(scripts[i].module)) << scripts[i].module;
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            if (run == 0 || elapsed.count() < best) {
+                best = elapsed.count();
+            }
+        }
+
+        printf("%-12s %8u iterations %9.3f ms %12.0f ops/s\n",
+               scripts[i].module, scripts[i].iterations,
+               best * 1000, scripts[i].iterations / best);
+    }
+}
@@ -0,0 +1,17 @@
+# A dict with short lived string keys, made anew when it grows
+
+ITERATIONS = 300
+
+d = {}
+i = 0
+while i < ITERATIONS:
+    key = "k" + chr(65 + i % 26)
+    d[key] = i
+    if i % 5 == 0:
+        del d[key]
+    if len(d) > 6:
+        d = {}
+    i += 1
+
+assert len(d) == 2
+assert d["kM"] == 298 and d["kN"] == 299
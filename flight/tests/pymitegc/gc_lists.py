@@ -0,0 +1,16 @@
+# Nested lists built and dropped, the last few kept in a ring
+
+ITERATIONS = 400
+
+keep = [None, None]
+i = 0
+while i < ITERATIONS:
+    item = [i, [i * 2000]]
+    if i % 3 == 0:
+        keep[(i / 3) % 2] = item
+    i += 1
+
+total = 0
+for item in keep:
+    total = total + item[0] + item[1][0]
+assert total == 1590795
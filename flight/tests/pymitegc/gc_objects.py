@@ -0,0 +1,29 @@
+# Objects with attributes linked in a short chain, the tail dropped as it grows
+
+ITERATIONS = 300
+
+class Node:
+    pass
+
+head = None
+length = 0
+i = 0
+while i < ITERATIONS:
+    node = Node()
+    node.n = i * 1000
+    node.nxt = head
+    head = node
+    length += 1
+    if length > 2:
+        # drop the tail
+        head.nxt.nxt = None
+        length = 2
+    i += 1
+
+total = 0
+node = head
+while node != None:
+    total = total + node.n
+    node = node.nxt
+assert length == 2
+assert total == 597000
@@ -0,0 +1,13 @@
+# Strings joined and dropped, the last few kept in a ring
+
+ITERATIONS = 200
+
+keep = ["", "", ""]
+i = 0
+while i < ITERATIONS:
+    word = chr(97 + i % 26) + chr(97 + (i / 26) % 26)
+    keep[i % 3] = word + "," + word + "," + word
+    i += 1
+
+assert len(keep[0]) == 8
+assert keep[1] == "rh,rh,rh"
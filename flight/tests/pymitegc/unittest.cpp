@@ -0,0 +1,450 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "pm.h"
+
+extern unsigned char const usrlib_img[];
+}
+
+/*
+ * Most work one step may do over its budget. A step only stops between
+ * objects, so it can overshoot by the references of the last object it
+ * scanned, the 8 slots of a segment plus its link at most here.
+ */
+#define STEP_OVERSHOOT 16
+
+/*
+ * The scripts' steps can go further over, a code object's names and consts
+ * tuples are scanned whole and the builtins' largest has 29 entries.
+ */
+#define SCRIPT_STEP_OVERSHOOT 32
+
+/*
+ * The scripts, run by the interpreter on the flight platform's heap. Each
+ * asserts its own result, so a collected live object fails the run.
+ */
+static const char *const scripts[] = {
+    "gc_lists",
+    "gc_dicts",
+    "gc_objects",
+    "gc_strings",
+};
+
+#define NUM_SCRIPTS (sizeof(scripts) / sizeof(scripts[0]))
+
+/*
+ * The workloads build their object graphs with the same object functions
+ * the interpreter uses, so every list, dict and tuple change goes through
+ * the collector's write barriers. Objects only referenced from C are kept
+ * on the temporary roots while more is allocated, like natives do.
+ */
+
+static void appendInt(pPmObj_t plist, int32_t val)
+{
+    pPmObj_t pint;
+    uint8_t objid;
+
+    ASSERT_EQ(PM_RET_OK, int_new(val, &pint));
+    heap_gcPushTempRoot(pint, &objid);
+    ASSERT_EQ(PM_RET_OK, list_append(plist, pint));
+    heap_gcPopTempRoot(objid);
+}
+
+static pPmObj_t getItem(pPmObj_t plist, int16_t index)
+{
+    pPmObj_t pobj = C_NULL;
+
+    EXPECT_EQ(PM_RET_OK, list_getItem(plist, index, &pobj));
+    return pobj;
+}
+
+static int32_t intAt(pPmObj_t plist, int16_t index)
+{
+    return ((pPmInt_t)getItem(plist, index))->val;
+}
+
+static uint16_t listLength(pPmObj_t plist)
+{
+    return ((pPmList_t)plist)->length;
+}
+
+static pPmObj_t newString(const std::string & s)
+{
+    pPmObj_t pstr = C_NULL;
+    uint8_t const *paddr = (uint8_t const *)s.c_str();
+
+    EXPECT_EQ(PM_RET_OK, string_newWithLen(&paddr, s.length(), &pstr));
+    return pstr;
+}
+
+static std::string stringValue(pPmObj_t pstr)
+{
+    return std::string((const char *)((pPmString_t)pstr)->val, ((pPmString_t)pstr)->length);
+}
+
+/* Nested lists, a few kept and moved around, the rest dropped */
+static void workloadLists()
+{
+    std::deque<std::vector<int32_t> > expected;
+    pPmObj_t pkeep;
+    pPmObj_t plist;
+    pPmObj_t pinner;
+    uint8_t keepid;
+    uint8_t objid;
+
+    ASSERT_EQ(PM_RET_OK, list_new(&pkeep));
+    heap_gcPushTempRoot(pkeep, &keepid);
+
+    for (int32_t i = 0; i < 400; i++) {
+        ASSERT_EQ(PM_RET_OK, list_new(&plist));
+        heap_gcPushTempRoot(plist, &objid);
+        appendInt(plist, i);
+        appendInt(plist, i + 1);
+        ASSERT_EQ(PM_RET_OK, list_new(&pinner));
+        ASSERT_EQ(PM_RET_OK, list_append(plist, pinner));
+        appendInt(pinner, i);
+        appendInt(pinner, i * 2);
+
+        if (i % 20 == 0) {
+            ASSERT_EQ(PM_RET_OK, list_insert(pkeep, 0, plist));
+            std::vector<int32_t> v;
+            v.push_back(i);
+            v.push_back(i + 1);
+            v.push_back(i * 2);
+            expected.push_front(v);
+        }
+        if (listLength(pkeep) > 12) {
+            ASSERT_EQ(PM_RET_OK, list_delItem(pkeep, 6));
+            expected.erase(expected.begin() + 6);
+        }
+        heap_gcPopTempRoot(objid);
+    }
+
+    ASSERT_EQ(expected.size(), listLength(pkeep));
+    for (uint16_t i = 0; i < listLength(pkeep); i++) {
+        plist = getItem(pkeep, i);
+        EXPECT_EQ(expected[i][0], intAt(plist, 0));
+        EXPECT_EQ(expected[i][1], intAt(plist, 1));
+        EXPECT_EQ(expected[i][2], intAt(getItem(plist, 2), 1));
+    }
+    heap_gcPopTempRoot(keepid);
+}
+
+/* A dict filled with short lived string keys and emptied again */
+static void workloadDicts()
+{
+    std::map<std::string, int32_t> expected;
+    pPmObj_t pdict;
+    pPmObj_t pkey;
+    pPmObj_t pval;
+    uint8_t dictid;
+    uint8_t objid;
+    uint8_t valid;
+
+    ASSERT_EQ(PM_RET_OK, dict_new(&pdict));
+    heap_gcPushTempRoot(pdict, &dictid);
+
+    for (int32_t i = 0; i < 300; i++) {
+        std::string key = "k";
+        key += (char)('A' + i % 26);
+        key += (char)('a' + i % 7);
+
+        pkey = newString(key);
+        heap_gcPushTempRoot(pkey, &objid);
+        ASSERT_EQ(PM_RET_OK, list_new(&pval));
+        heap_gcPushTempRoot(pval, &valid);
+        appendInt(pval, i);
+        ASSERT_EQ(PM_RET_OK, dict_setItem(pdict, pkey, pval));
+        expected[key] = i;
+
+        if (i % 5 == 0) {
+            ASSERT_EQ(PM_RET_OK, dict_delItem(pdict, pkey));
+            expected.erase(key);
+        }
+        if (((pPmDict_t)pdict)->length > 20) {
+            ASSERT_EQ(PM_RET_OK, dict_clear(pdict));
+            expected.clear();
+        }
+        heap_gcPopTempRoot(objid);
+    }
+
+    ASSERT_EQ((int16_t)expected.size(), ((pPmDict_t)pdict)->length);
+    for (std::map<std::string, int32_t>::iterator it = expected.begin(); it != expected.end(); ++it) {
+        pkey = newString(it->first);
+        ASSERT_EQ(PM_RET_OK, dict_getItem(pdict, pkey, &pval));
+        EXPECT_EQ(it->second, intAt(pval, 0));
+    }
+    heap_gcPopTempRoot(dictid);
+}
+
+/* Strings that mostly come back out of the string cache */
+static void workloadStrings()
+{
+    std::deque<std::string> expected;
+    pPmObj_t pwords;
+    pPmObj_t pstr;
+    uint8_t wordsid;
+    uint8_t objid;
+
+    ASSERT_EQ(PM_RET_OK, list_new(&pwords));
+    heap_gcPushTempRoot(pwords, &wordsid);
+
+    for (int32_t i = 0; i < 200; i++) {
+        std::string word;
+        word += (char)('a' + i % 26);
+        word += (char)('a' + (i / 26) % 26);
+        word += (char)('0' + i % 10);
+
+        pstr = newString(word);
+        heap_gcPushTempRoot(pstr, &objid);
+        ASSERT_EQ(PM_RET_OK, list_append(pwords, pstr));
+        heap_gcPopTempRoot(objid);
+        expected.push_back(word);
+
+        if (listLength(pwords) > 16) {
+            ASSERT_EQ(PM_RET_OK, list_delItem(pwords, 0));
+            expected.pop_front();
+        }
+    }
+
+    ASSERT_EQ(expected.size(), listLength(pwords));
+    for (uint16_t i = 0; i < listLength(pwords); i++) {
+        EXPECT_EQ(expected[i], stringValue(getItem(pwords, i)));
+    }
+    heap_gcPopTempRoot(wordsid);
+}
+
+/* Tuples filled in after they are allocated, overwritten in a ring */
+static void workloadTuples()
+{
+    pPmObj_t pring;
+    pPmObj_t ptup;
+    pPmObj_t pint;
+    uint8_t ringid;
+    uint8_t objid;
+
+    ASSERT_EQ(PM_RET_OK, list_new(&pring));
+    heap_gcPushTempRoot(pring, &ringid);
+    for (int16_t i = 0; i < 8; i++) {
+        ASSERT_EQ(PM_RET_OK, list_append(pring, PM_NONE));
+    }
+
+    for (int32_t i = 0; i < 250; i++) {
+        ASSERT_EQ(PM_RET_OK, tuple_new(6, &ptup));
+        heap_gcPushTempRoot(ptup, &objid);
+        for (int16_t j = 0; j < 6; j++) {
+            ASSERT_EQ(PM_RET_OK, int_new(i * 10 + j, &pint));
+            ((pPmTuple_t)ptup)->val[j] = pint;
+        }
+        ASSERT_EQ(PM_RET_OK, list_setItem(pring, i % 8, ptup));
+        heap_gcPopTempRoot(objid);
+    }
+
+    for (int16_t i = 0; i < 8; i++) {
+        ptup = getItem(pring, i);
+        int32_t last = 249 - (249 - i) % 8;
+        for (int16_t j = 0; j < 6; j++) {
+            EXPECT_EQ(last * 10 + j, ((pPmInt_t)((pPmTuple_t)ptup)->val[j])->val);
+        }
+    }
+    heap_gcPopTempRoot(ringid);
+}
+
+/*
+ * Old lists moved between two lists while a cycle runs, only held on the
+ * temporary roots in between like on the interpreter's stack. The roots are
+ * only scanned when a cycle starts, so this needs the deletion barrier.
+ */
+static void workloadMoves()
+{
+    std::deque<int32_t> expected[2];
+    pPmObj_t plists[2];
+    pPmObj_t pitem;
+    pPmObj_t pint;
+    uint8_t listsid;
+    uint8_t objid;
+
+    ASSERT_EQ(PM_RET_OK, list_new(&plists[0]));
+    heap_gcPushTempRoot(plists[0], &listsid);
+    ASSERT_EQ(PM_RET_OK, list_new(&plists[1]));
+    heap_gcPushTempRoot(plists[1], &objid);
+
+    for (int32_t i = 0; i < 40; i++) {
+        ASSERT_EQ(PM_RET_OK, list_new(&pitem));
+        heap_gcPushTempRoot(pitem, &objid);
+        ASSERT_EQ(PM_RET_OK, list_append(plists[0], pitem));
+        heap_gcPopTempRoot(objid);
+        appendInt(pitem, i);
+        expected[0].push_back(i);
+    }
+
+    for (int32_t i = 0; i < 800; i++) {
+        uint8_t from = (i / 40) % 2;
+        uint8_t to   = 1 - from;
+
+        pitem = getItem(plists[from], 0);
+        heap_gcPushTempRoot(pitem, &objid);
+        ASSERT_EQ(PM_RET_OK, list_delItem(plists[from], 0));
+
+        // Garbage, so the collector steps while the item is in neither list
+        for (int16_t j = 0; j < 4; j++) {
+            ASSERT_EQ(PM_RET_OK, int_new(i * 4 + j + 1000, &pint));
+        }
+
+        ASSERT_EQ(PM_RET_OK, list_append(plists[to], pitem));
+        heap_gcPopTempRoot(objid);
+        expected[to].push_back(expected[from].front());
+        expected[from].pop_front();
+    }
+
+    for (uint8_t k = 0; k < 2; k++) {
+        ASSERT_EQ(expected[k].size(), listLength(plists[k]));
+        for (uint16_t i = 0; i < listLength(plists[k]); i++) {
+            EXPECT_EQ(expected[k][i], intAt(getItem(plists[k], i), 0));
+        }
+    }
+    heap_gcPopTempRoot(listsid);
+}
+
+static const struct {
+    const char *name;
+    void       (*run)(void);
+} workloads[] = {
+    { "lists",   workloadLists   },
+    { "dicts",   workloadDicts   },
+    { "strings", workloadStrings },
+    { "tuples",  workloadTuples  },
+    { "moves",   workloadMoves   },
+};
+
+#define NUM_WORKLOADS (sizeof(workloads) / sizeof(workloads[0]))
+
+struct GcRun {
+    PmGcStats_t stats;
+    uint32_t    avail;
+};
+
+/*
+ * Runs a workload on a fresh VM, then collects everything left so the
+ * free space can be compared between collectors.
+ */
+static GcRun run(size_t workload, uint16_t stepWork)
+{
+    GcRun r;
+
+    EXPECT_EQ(PM_RET_OK, pm_init(MEMSPACE_PROG, C_NULL));
+    heap_gcSetStepWork(stepWork);
+    heap_gcResetStats();
+
+    workloads[workload].run();
+    heap_gcGetStats(&r.stats);
+
+    EXPECT_EQ(PM_RET_OK, heap_gcRun());
+    r.avail = heap_getAvail();
+    return r;
+}
+
+/* Runs a script on a fresh VM */
+static PmReturn_t runScript(size_t script, uint16_t stepWork, PmGcStats_t *stats)
+{
+    PmReturn_t retval;
+
+    retval = pm_init(MEMSPACE_PROG, usrlib_img);
+    if (retval != PM_RET_OK) {
+        return retval;
+    }
+    heap_gcSetStepWork(stepWork);
+    heap_gcResetStats();
+
+    retval = pm_run((uint8_t const *)scripts[script]);
+    heap_gcGetStats(stats);
+    return retval;
+}
+
+class PyMiteGc : public testing::Test {
+protected:
+    void runIncremental(uint16_t budget, bool keepsUp, bool scriptsKeepUp)
+    {
+        for (size_t i = 0; i < NUM_WORKLOADS; i++) {
+            GcRun ref = run(i, 0);
+            GcRun r   = run(i, budget);
+
+            // The heap was reclaimed in steps and no step paused for long
+            EXPECT_LT(0U, r.stats.cycles) << workloads[i].name;
+            EXPECT_LT(0U, r.stats.steps) << workloads[i].name;
+            EXPECT_GE((uint32_t)budget + STEP_OVERSHOOT, r.stats.maxStepWork) << workloads[i].name;
+            if (keepsUp) {
+                EXPECT_EQ(0U, r.stats.fullRuns) << workloads[i].name;
+            }
+
+            // Nothing live was lost and all garbage was found
+            EXPECT_EQ(ref.avail, r.avail) << workloads[i].name;
+        }
+
+        for (size_t i = 0; i < NUM_SCRIPTS; i++) {
+            PmGcStats_t stats;
+
+            EXPECT_EQ(PM_RET_OK, runScript(i, budget, &stats)) << scripts[i];
+            EXPECT_LT(0U, stats.steps) << scripts[i];
+            EXPECT_GE((uint32_t)budget + SCRIPT_STEP_OVERSHOOT, stats.maxStepWork) << scripts[i];
+            if (scriptsKeepUp) {
+                EXPECT_EQ(0U, stats.fullRuns) << scripts[i];
+            }
+        }
+    }
+};
+
+TEST_F(PyMiteGc, StopTheWorld) {
+    for (size_t i = 0; i < NUM_WORKLOADS; i++) {
+        GcRun r = run(i, 0);
+
+        // Only whole collections when the heap runs out
+        EXPECT_LT(0U, r.stats.fullRuns) << workloads[i].name;
+        EXPECT_EQ(0U, r.stats.steps) << workloads[i].name;
+        EXPECT_EQ(0U, r.stats.maxStepWork) << workloads[i].name;
+    }
+
+    for (size_t i = 0; i < NUM_SCRIPTS; i++) {
+        PmGcStats_t stats;
+
+        EXPECT_EQ(PM_RET_OK, runScript(i, 0, &stats)) << scripts[i];
+        EXPECT_LT(0U, stats.fullRuns) << scripts[i];
+        EXPECT_EQ(0U, stats.steps) << scripts[i];
+    }
+}
+
+// Too little work to keep up with the moves, those cycles are finished on OOM
+TEST_F(PyMiteGc, IncrementalSmallSteps) {
+    runIncremental(16, false, false);
+}
+
+// The scripts leave a fifth of the flight heap free, a cycle over the rest
+// does not finish in that at the default step
+TEST_F(PyMiteGc, IncrementalDefaultSteps) {
+    runIncremental(64, true, false);
+}
+
+TEST_F(PyMiteGc, IncrementalLargeSteps) {
+    runIncremental(256, true, true);
+}
+
+TEST_F(PyMiteGc, ResetStats) {
+    run(0, 64);
+
+    heap_gcResetStats();
+
+    PmGcStats_t stats;
+    heap_gcGetStats(&stats);
+    EXPECT_EQ(0U, stats.cycles);
+    EXPECT_EQ(0U, stats.steps);
+    EXPECT_EQ(0U, stats.maxStepWork);
+    EXPECT_EQ(0U, stats.fullRuns);
+}
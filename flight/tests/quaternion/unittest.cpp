@@ -0,0 +1,299 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* rand */
+#include <math.h>
+#include <chrono>
+
+extern "C" {
+#include <stdbool.h>
+#include <stdint.h>
+#include "pios_math.h"
+#include "CoordinateConversions.h"
+}
+
+#define SAMPLES    100000
+#define BENCH_RUNS 1000000
+
+/*
+ * Random unit quaternions with q0 >= 0, and vectors of up to 100 long
+ * (gravity, mag field in mGauss scaled down, velocities)
+ */
+static float randf(float lo, float hi)
+{
+    return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+static void randomQuaternion(float q[4])
+{
+    double n;
+
+    do {
+        for (int i = 0; i < 4; i++) {
+            q[i] = randf(-1.0f, 1.0f);
+        }
+        n = sqrt((double)q[0] * q[0] + (double)q[1] * q[1] + (double)q[2] * q[2] + (double)q[3] * q[3]);
+    } while (n < 0.1);
+    for (int i = 0; i < 4; i++) {
+        q[i] = (float)(q[i] / n);
+    }
+    if (q[0] < 0.0f) {
+        for (int i = 0; i < 4; i++) {
+            q[i] = -q[i];
+        }
+    }
+}
+
+static void randomVector(float v[3])
+{
+    for (int i = 0; i < 3; i++) {
+        v[i] = randf(-100.0f, 100.0f);
+    }
+}
+
+/*
+ * The sequences the estimators ran before, as the reference
+ */
+static void referenceIntegrate(double q[4], const float gyro[3], float dT)
+{
+    double qdot[4];
+
+    qdot[0] = (-q[1] * gyro[0] - q[2] * gyro[1] - q[3] * gyro[2]) * dT * (M_PI / 180.0 / 2.0);
+    qdot[1] = (q[0] * gyro[0] - q[3] * gyro[1] + q[2] * gyro[2]) * dT * (M_PI / 180.0 / 2.0);
+    qdot[2] = (q[3] * gyro[0] + q[0] * gyro[1] - q[1] * gyro[2]) * dT * (M_PI / 180.0 / 2.0);
+    qdot[3] = (-q[2] * gyro[0] + q[1] * gyro[1] + q[0] * gyro[2]) * dT * (M_PI / 180.0 / 2.0);
+    for (int i = 0; i < 4; i++) {
+        q[i] += qdot[i];
+    }
+    double sign = (q[0] < 0.0) ? -1.0 : 1.0;
+    double qmag = sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    for (int i = 0; i < 4; i++) {
+        q[i] = sign * q[i] / qmag;
+    }
+}
+
+static void referenceRotate(const float q[4], const float vec[3], float vec_out[3])
+{
+    float R[3][3];
+
+    Quaternion2R((float *)q, R);
+    rot_mult(R, vec, vec_out);
+}
+
+static float vectorError(const float a[3], const float b[3])
+{
+    return sqrtf((a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]) + (a[2] - b[2]) * (a[2] - b[2]));
+}
+
+class QuaternionKernels : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        srand(1);
+    }
+};
+
+TEST_F(QuaternionKernels, RAndTransposeMatchQuaternion2R) {
+    for (int n = 0; n < SAMPLES; n++) {
+        float q[4], R[3][3], Rbe[3][3], Reb[3][3];
+
+        randomQuaternion(q);
+        Quaternion2R(q, R);
+        Quaternion2RT(q, Rbe, Reb);
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                ASSERT_FLOAT_EQ(R[i][j], Rbe[i][j]);
+                ASSERT_FLOAT_EQ(R[i][j], Reb[j][i]);
+            }
+        }
+    }
+}
+
+TEST_F(QuaternionKernels, RotateVectorMatchesMatrix) {
+    float maxError = 0.0f;
+
+    for (int n = 0; n < SAMPLES; n++) {
+        float q[4], v[3], expected[3], out[3];
+
+        randomQuaternion(q);
+        randomVector(v);
+        referenceRotate(q, v, expected);
+        quat_rotate_vector(q, v, out);
+
+        float error = vectorError(expected, out) / VectorMagnitude(v);
+        maxError = fmaxf(maxError, error);
+    }
+    printf("quat_rotate_vector: max relative error %g\n", maxError);
+    EXPECT_LT(maxError, 2e-6f);
+}
+
+TEST_F(QuaternionKernels, RotateVectorTransposeIsTheInverse) {
+    float maxError = 0.0f;
+
+    for (int n = 0; n < SAMPLES; n++) {
+        float q[4], v[3], R[3][3], expected[3], body[3], out[3];
+
+        randomQuaternion(q);
+        randomVector(v);
+
+        // R transpose times v
+        Quaternion2R(q, R);
+        for (int i = 0; i < 3; i++) {
+            expected[i] = R[0][i] * v[0] + R[1][i] * v[1] + R[2][i] * v[2];
+        }
+        quat_rotate_vector_transpose(q, v, out);
+        maxError = fmaxf(maxError, vectorError(expected, out) / VectorMagnitude(v));
+
+        // and back
+        quat_rotate_vector(q, out, body);
+        maxError = fmaxf(maxError, vectorError(v, body) / VectorMagnitude(v));
+    }
+    printf("quat_rotate_vector_transpose: max relative error %g\n", maxError);
+    EXPECT_LT(maxError, 2e-6f);
+}
+
+TEST_F(QuaternionKernels, IntegrateNormalizeMatchesReference) {
+    float maxError = 0.0f;
+    float maxNormError = 0.0f;
+
+    for (int n = 0; n < SAMPLES; n++) {
+        float q[4], gyro[3];
+        double ref[4];
+        // Up to 2000 deg/s over 2 to 20 ms, the rates and steps of the estimators
+        float dT = randf(0.002f, 0.02f);
+
+        randomQuaternion(q);
+        for (int i = 0; i < 3; i++) {
+            gyro[i] = randf(-2000.0f, 2000.0f);
+        }
+        for (int i = 0; i < 4; i++) {
+            ref[i] = q[i];
+        }
+
+        ASSERT_TRUE(quat_integrate_normalize(q, gyro, dT));
+        referenceIntegrate(ref, gyro, dT);
+
+        double norm = 0.0;
+        for (int i = 0; i < 4; i++) {
+            maxError = fmaxf(maxError, fabs(ref[i] - q[i]));
+            norm    += (double)q[i] * q[i];
+        }
+        maxNormError = fmaxf(maxNormError, fabs(sqrt(norm) - 1.0));
+        ASSERT_GE(q[0], 0.0f);
+    }
+    printf("quat_integrate_normalize: max error %g, max length error %g\n", maxError, maxNormError);
+    EXPECT_LT(maxError, 1e-6f);
+    EXPECT_LT(maxNormError, 1e-6f);
+}
+
+TEST_F(QuaternionKernels, IntegrateNormalizeTracksConstantRate) {
+    float q[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+    const float gyro[3] = { 0.0f, 0.0f, 45.0f };
+    float rpy[3];
+
+    // 2 s at 500 Hz, a quarter turn in yaw
+    for (int n = 0; n < 1000; n++) {
+        ASSERT_TRUE(quat_integrate_normalize(q, gyro, 0.002f));
+    }
+    Quaternion2RPY(q, rpy);
+    EXPECT_NEAR(0.0f, rpy[0], 1e-3f);
+    EXPECT_NEAR(0.0f, rpy[1], 1e-3f);
+    EXPECT_NEAR(90.0f, rpy[2], 0.01f);
+}
+
+TEST_F(QuaternionKernels, IntegrateNormalizeRejectsBadQuaternions) {
+    float q[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    const float gyro[3] = { 1.0f, 2.0f, 3.0f };
+
+    EXPECT_FALSE(quat_integrate_normalize(q, gyro, 0.002f));
+
+    float q2[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+    const float nanGyro[3] = { NAN, 0.0f, 0.0f };
+    EXPECT_FALSE(quat_integrate_normalize(q2, nanGyro, 0.002f));
+
+    float q3[4] = { 1.0f, 0.0f, 0.0f, 0.0f };
+    const float infGyro[3] = { INFINITY, 0.0f, 0.0f };
+    EXPECT_FALSE(quat_integrate_normalize(q3, infGyro, 0.002f));
+}
+
+/*
+ * Time per call of the kernels and of the sequences they replace, built
+ * like the rest of the unit tests (-O0)
+ */
+template<typename F> static double nsPerCall(F f)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (int n = 0; n < BENCH_RUNS; n++) {
+        f(n);
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / BENCH_RUNS;
+}
+
+TEST_F(QuaternionKernels, Benchmark) {
+    float q[4], v[3], out[3] = { 0 };
+    float R[3][3], Reb[3][3];
+    volatile float sink = 0.0f;
+
+    randomQuaternion(q);
+    randomVector(v);
+
+    double matrix = nsPerCall([&](int n) {
+        v[0] = (float)n;
+        referenceRotate(q, v, out);
+        sink = out[0];
+    });
+    double fused = nsPerCall([&](int n) {
+        v[0] = (float)n;
+        quat_rotate_vector(q, v, out);
+        sink = out[0];
+    });
+    printf("rotate vector:  Quaternion2R + rot_mult %.1f ns, quat_rotate_vector %.1f ns\n", matrix, fused);
+
+    double separate = nsPerCall([&](int n) {
+        q[1] = (float)n * 1e-9f;
+        Quaternion2R(q, R);
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                Reb[j][i] = R[i][j];
+            }
+        }
+        sink = Reb[0][1];
+    });
+    double both = nsPerCall([&](int n) {
+        q[1] = (float)n * 1e-9f;
+        Quaternion2RT(q, R, Reb);
+        sink = Reb[0][1];
+    });
+    printf("R and R':       Quaternion2R + transpose %.1f ns, Quaternion2RT %.1f ns\n", separate, both);
+
+    const float gyro[3] = { 10.0f, -20.0f, 30.0f };
+    double sqrtNorm = nsPerCall([&](int) {
+        float qdot[4];
+        qdot[0] = DEG2RAD(-q[1] * gyro[0] - q[2] * gyro[1] - q[3] * gyro[2]) * 0.002f / 2;
+        qdot[1] = DEG2RAD(q[0] * gyro[0] - q[3] * gyro[1] + q[2] * gyro[2]) * 0.002f / 2;
+        qdot[2] = DEG2RAD(q[3] * gyro[0] + q[0] * gyro[1] - q[1] * gyro[2]) * 0.002f / 2;
+        qdot[3] = DEG2RAD(-q[2] * gyro[0] + q[1] * gyro[1] + q[0] * gyro[2]) * 0.002f / 2;
+        for (int i = 0; i < 4; i++) {
+            q[i] += qdot[i];
+        }
+        if (q[0] < 0.0f) {
+            for (int i = 0; i < 4; i++) {
+                q[i] = -q[i];
+            }
+        }
+        float qmag = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+        for (int i = 0; i < 4; i++) {
+            q[i] /= qmag;
+        }
+        sink = q[0];
+    });
+    double kernel = nsPerCall([&](int) {
+        quat_integrate_normalize(q, gyro, 0.002f);
+        sink = q[0];
+    });
+    printf("integrate:      step + sqrtf normalize %.1f ns, quat_integrate_normalize %.1f ns\n", sqrtNorm, kernel);
+
+    (void)sink;
+}
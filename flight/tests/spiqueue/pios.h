@@ -0,0 +1,17 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+/* PIOS Feature Selection */
+#include "pios_config.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "openpilot.h"
+
+/* Provided by the test */
+extern int32_t PIOS_IRQ_Disable(void);
+extern int32_t PIOS_IRQ_Enable(void);
+
+#endif /* PIOS_H */
@@ -0,0 +1,400 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "pios.h"
+#include "pios_spi_queue.h"
+
+static int irq_nesting;
+
+int32_t PIOS_IRQ_Disable(void)
+{
+    irq_nesting++;
+    return 0;
+}
+
+int32_t PIOS_IRQ_Enable(void)
+{
+    irq_nesting--;
+    return 0;
+}
+}
+
+/*
+ * Simulated SPI peripheral. Segments are only started, the test decides when
+ * the "DMA interrupt" fires by calling finish(). Received bytes are the sent
+ * bytes inverted so that data movement can be checked as well.
+ */
+struct sim_spi {
+    bool bus_taken;
+    int  selected;
+    SPIPrescalerTypeDef prescaler;
+    const struct pios_spi_segment *active;
+    std::vector<std::string> log;
+};
+
+static struct sim_spi sim;
+static struct pios_spi_queue queue;
+
+static bool sim_claim(__attribute__((unused)) uint32_t spi_id, __attribute__((unused)) bool *woken)
+{
+    EXPECT_GT(irq_nesting, 0);
+    if (sim.bus_taken) {
+        return false;
+    }
+    sim.bus_taken = true;
+    sim.log.push_back("claim");
+    return true;
+}
+
+static void sim_release(__attribute__((unused)) uint32_t spi_id, __attribute__((unused)) bool *woken)
+{
+    EXPECT_TRUE(sim.bus_taken);
+    sim.bus_taken = false;
+    sim.log.push_back("release");
+}
+
+static void sim_set_speed(__attribute__((unused)) uint32_t spi_id, SPIPrescalerTypeDef prescaler)
+{
+    EXPECT_TRUE(sim.bus_taken);
+    EXPECT_EQ(-1, sim.selected);
+    sim.prescaler = prescaler;
+}
+
+static void sim_select(__attribute__((unused)) uint32_t spi_id, uint32_t slave_id, bool selected)
+{
+    char buf[32];
+
+    if (selected) {
+        EXPECT_EQ(-1, sim.selected);
+        sim.selected = slave_id;
+    } else {
+        EXPECT_EQ((int)slave_id, sim.selected);
+        sim.selected = -1;
+    }
+    snprintf(buf, sizeof(buf), "%s%u", selected ? "cs_low" : "cs_high", (unsigned)slave_id);
+    sim.log.push_back(buf);
+}
+
+static void sim_start(__attribute__((unused)) uint32_t spi_id, const struct pios_spi_segment *segment)
+{
+    char buf[32];
+
+    EXPECT_TRUE(sim.bus_taken);
+    EXPECT_NE(-1, sim.selected);
+    EXPECT_EQ(NULL, sim.active);
+    sim.active = segment;
+    snprintf(buf, sizeof(buf), "start%u", (unsigned)segment->len);
+    sim.log.push_back(buf);
+}
+
+static const struct pios_spi_queue_driver sim_driver = {
+    sim_claim,
+    sim_release,
+    sim_set_speed,
+    sim_select,
+    sim_start,
+};
+
+/* Transfer complete interrupt of the simulated peripheral */
+static void finish(int32_t result)
+{
+    const struct pios_spi_segment *segment = sim.active;
+
+    ASSERT_TRUE(segment != NULL);
+    for (uint16_t i = 0; i < segment->len; i++) {
+        uint8_t out = segment->send_buffer ? segment->send_buffer[i] : 0xFF;
+        if (segment->receive_buffer) {
+            segment->receive_buffer[i] = ~out;
+        }
+    }
+    sim.active = NULL;
+
+    bool woken = false;
+    PIOS_SPI_Queue_SegmentDone(&queue, result, &woken);
+}
+
+static std::vector<struct pios_spi_txn *> completions;
+
+static void record_completion(struct pios_spi_txn *txn, __attribute__((unused)) bool *woken)
+{
+    completions.push_back(txn);
+}
+
+static void init_txn(struct pios_spi_txn *txn, uint32_t slave_id, const struct pios_spi_segment *segments, uint8_t num_segments)
+{
+    memset(txn, 0, sizeof(*txn));
+    txn->slave_id     = slave_id;
+    txn->segments     = segments;
+    txn->num_segments = num_segments;
+    txn->callback     = record_completion;
+}
+
+static std::vector<std::string> expected(const char *const *events, size_t count)
+{
+    return std::vector<std::string>(events, events + count);
+}
+
+class SpiQueueTest : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        irq_nesting   = 0;
+        sim.bus_taken = false;
+        sim.selected  = -1;
+        sim.prescaler = PIOS_SPI_PRESCALER_256;
+        sim.active    = NULL;
+        sim.log.clear();
+        completions.clear();
+        PIOS_SPI_Queue_Init(&queue, &sim_driver, 0);
+    }
+
+    virtual void TearDown()
+    {
+        EXPECT_EQ(0, irq_nesting);
+    }
+};
+
+TEST_F(SpiQueueTest, SingleTransaction) {
+    uint8_t tx[3] = { 0x80, 0x01, 0x02 };
+    uint8_t rx[3] = { 0 };
+    const struct pios_spi_segment segments[] = {
+        { tx, rx, sizeof(tx) },
+    };
+    struct pios_spi_txn txn;
+
+    init_txn(&txn, 1, segments, 1);
+
+    EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn, NULL));
+    EXPECT_TRUE(PIOS_SPI_Queue_Running(&queue));
+    EXPECT_EQ(PIOS_SPI_TXN_PENDING, txn.result);
+    EXPECT_EQ(0U, completions.size());
+
+    finish(0);
+
+    EXPECT_FALSE(PIOS_SPI_Queue_Running(&queue));
+    EXPECT_FALSE(sim.bus_taken);
+    ASSERT_EQ(1U, completions.size());
+    EXPECT_EQ(&txn, completions[0]);
+    EXPECT_EQ(0, txn.result);
+    EXPECT_EQ(0x7F, rx[0]);
+    EXPECT_EQ(0xFE, rx[1]);
+    EXPECT_EQ(0xFD, rx[2]);
+    EXPECT_EQ(1U, queue.completed);
+
+    const char *const events[] = { "claim", "cs_low1", "start3", "cs_high1", "release" };
+    EXPECT_EQ(expected(events, 5), sim.log);
+}
+
+TEST_F(SpiQueueTest, ChipSelectHeldAcrossSegments) {
+    uint8_t reg = 0xBB;
+    uint8_t data[6];
+    const struct pios_spi_segment segments[] = {
+        { &reg, NULL, 1            },
+        { NULL, data, sizeof(data) },
+    };
+    struct pios_spi_txn txn;
+
+    init_txn(&txn, 0, segments, 2);
+    EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn, NULL));
+
+    finish(0);
+    EXPECT_EQ(0U, completions.size());
+    EXPECT_EQ(0, sim.selected);
+    finish(0);
+    ASSERT_EQ(1U, completions.size());
+    EXPECT_EQ(0x00, data[0]);
+
+    const char *const events[] = { "claim", "cs_low0", "start1", "start6", "cs_high0", "release" };
+    EXPECT_EQ(expected(events, 6), sim.log);
+}
+
+TEST_F(SpiQueueTest, TransactionsAreChainedInOrder) {
+    uint8_t buf[4][2];
+    struct pios_spi_segment segments[4];
+    struct pios_spi_txn txn[4];
+
+    for (int i = 0; i < 4; i++) {
+        segments[i].send_buffer    = NULL;
+        segments[i].receive_buffer = buf[i];
+        segments[i].len = i + 1;
+        init_txn(&txn[i], i, &segments[i], 1);
+        EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn[i], NULL));
+    }
+
+    /* Only the first one is on the wire, the rest wait for the interrupt */
+    ASSERT_EQ(3U, sim.log.size());
+
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(PIOS_SPI_Queue_Running(&queue));
+        finish(0);
+    }
+
+    ASSERT_EQ(4U, completions.size());
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(&txn[i], completions[i]);
+    }
+
+    /* The bus is claimed once for the whole burst */
+    const char *const events[] = {
+        "claim",
+        "cs_low0", "start1", "cs_high0",
+        "cs_low1", "start2", "cs_high1",
+        "cs_low2", "start3", "cs_high2",
+        "cs_low3", "start4", "cs_high3",
+        "release"
+    };
+    EXPECT_EQ(expected(events, 14), sim.log);
+}
+
+TEST_F(SpiQueueTest, EachTransactionRunsAtItsOwnClock) {
+    uint8_t rx[2][4];
+    const struct pios_spi_segment segments[] = {
+        { NULL, rx[0], sizeof(rx[0]) },
+        { NULL, rx[1], sizeof(rx[1]) },
+    };
+    struct pios_spi_txn txn[2];
+
+    init_txn(&txn[0], 0, &segments[0], 1);
+    txn[0].prescaler = PIOS_SPI_PRESCALER_8;
+    init_txn(&txn[1], 1, &segments[1], 1);
+    txn[1].prescaler = PIOS_SPI_PRESCALER_64;
+
+    EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn[0], NULL));
+    EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn[1], NULL));
+    EXPECT_EQ(PIOS_SPI_PRESCALER_8, sim.prescaler);
+
+    finish(0);
+    EXPECT_EQ(PIOS_SPI_PRESCALER_64, sim.prescaler);
+
+    finish(0);
+    EXPECT_EQ(2U, completions.size());
+}
+
+TEST_F(SpiQueueTest, WaitsForBusOwner) {
+    uint8_t rx[2];
+    const struct pios_spi_segment segments[] = {
+        { NULL, rx, sizeof(rx) },
+    };
+    struct pios_spi_txn txn;
+
+    /* A task did PIOS_SPI_ClaimBus() */
+    sim.bus_taken = true;
+
+    init_txn(&txn, 0, segments, 1);
+    EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn, NULL));
+    EXPECT_FALSE(PIOS_SPI_Queue_Running(&queue));
+    EXPECT_EQ(0U, sim.log.size());
+
+    /* PIOS_SPI_ReleaseBus() */
+    sim.bus_taken = false;
+    PIOS_SPI_Queue_Kick(&queue, NULL);
+    EXPECT_TRUE(PIOS_SPI_Queue_Running(&queue));
+
+    finish(0);
+    ASSERT_EQ(1U, completions.size());
+    EXPECT_FALSE(sim.bus_taken);
+}
+
+TEST_F(SpiQueueTest, ErrorAbortsTransactionOnly) {
+    uint8_t cmd = 0x03;
+    uint8_t data[4];
+    const struct pios_spi_segment segments[] = {
+        { &cmd, NULL, 1            },
+        { NULL, data, sizeof(data) },
+    };
+    struct pios_spi_txn txn[2];
+
+    init_txn(&txn[0], 0, segments, 2);
+    init_txn(&txn[1], 1, segments, 2);
+    EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn[0], NULL));
+    EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn[1], NULL));
+
+    /* CRC error on the first segment, the second one is skipped */
+    finish(-4);
+    ASSERT_EQ(1U, completions.size());
+    EXPECT_EQ(-4, txn[0].result);
+    EXPECT_EQ(PIOS_SPI_TXN_PENDING, txn[1].result);
+
+    finish(0);
+    finish(0);
+    ASSERT_EQ(2U, completions.size());
+    EXPECT_EQ(0, txn[1].result);
+    EXPECT_EQ(1U, queue.failed);
+    EXPECT_EQ(1U, queue.completed);
+
+    const char *const events[] = {
+        "claim",
+        "cs_low0", "start1", "cs_high0",
+        "cs_low1", "start1", "start4", "cs_high1",
+        "release"
+    };
+    EXPECT_EQ(expected(events, 9), sim.log);
+}
+
+static int resubmit_count;
+
+static void resubmit(struct pios_spi_txn *txn, bool *woken)
+{
+    completions.push_back(txn);
+    if (--resubmit_count > 0) {
+        EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, txn, woken));
+    }
+}
+
+TEST_F(SpiQueueTest, CallbackCanResubmit) {
+    uint8_t rx[8];
+    const struct pios_spi_segment segments[] = {
+        { NULL, rx, sizeof(rx) },
+    };
+    struct pios_spi_txn txn;
+
+    init_txn(&txn, 2, segments, 1);
+    txn.callback   = resubmit;
+    resubmit_count = 3;
+
+    EXPECT_EQ(0, PIOS_SPI_Queue_Submit(&queue, &txn, NULL));
+    finish(0);
+    EXPECT_TRUE(PIOS_SPI_Queue_Running(&queue));
+    finish(0);
+    finish(0);
+    EXPECT_FALSE(PIOS_SPI_Queue_Running(&queue));
+    EXPECT_EQ(3U, completions.size());
+    EXPECT_EQ(3U, queue.completed);
+
+    const char *const events[] = {
+        "claim",
+        "cs_low2", "start8", "cs_high2",
+        "cs_low2", "start8", "cs_high2",
+        "cs_low2", "start8", "cs_high2",
+        "release"
+    };
+    EXPECT_EQ(expected(events, 11), sim.log);
+}
+
+TEST_F(SpiQueueTest, RejectsMalformedTransactions) {
+    uint8_t rx[2];
+    const struct pios_spi_segment empty[] = {
+        { NULL, rx, 0 },
+    };
+    struct pios_spi_txn txn;
+
+    init_txn(&txn, 0, NULL, 1);
+    EXPECT_EQ(-1, PIOS_SPI_Queue_Submit(&queue, &txn, NULL));
+
+    init_txn(&txn, 0, empty, 0);
+    EXPECT_EQ(-1, PIOS_SPI_Queue_Submit(&queue, &txn, NULL));
+
+    init_txn(&txn, 0, empty, 1);
+    EXPECT_EQ(-1, PIOS_SPI_Queue_Submit(&queue, &txn, NULL));
+
+    EXPECT_EQ(-1, PIOS_SPI_Queue_Submit(&queue, NULL, NULL));
+
+    EXPECT_FALSE(PIOS_SPI_Queue_Running(&queue));
+    EXPECT_EQ(0U, sim.log.size());
+}
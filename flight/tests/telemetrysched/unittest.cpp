@@ -0,0 +1,405 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <string.h> /* memset */
+#include <deque>
+#include <vector>
+
+extern "C" {
+#include "telemetrysched.h"
+}
+
+#define EV_PERIODIC 0x08
+#define EV_CHANGED  0x02
+#define DEPTH       8 // Updates waiting per class
+
+static struct telemetrysched_item makeItem(const void *obj, uint8_t priority, uint16_t length, uint32_t now)
+{
+    struct telemetrysched_item item;
+
+    memset(&item, 0, sizeof(item));
+    item.obj      = obj;
+    item.instId   = 0xFFFF;
+    item.event    = EV_PERIODIC;
+    item.periodic = true;
+    item.priority = priority;
+    item.length   = length;
+    item.queued   = now;
+    return item;
+}
+
+class TelemetrySched : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        telemetrysched_init(&sched, items, DEPTH, 960, 0);
+    }
+
+    int32_t push(const void *obj, uint8_t priority, uint16_t length, uint32_t now)
+    {
+        struct telemetrysched_item item = makeItem(obj, priority, length, now);
+
+        return telemetrysched_push(&sched, &item);
+    }
+
+    struct telemetrysched sched;
+    struct telemetrysched_item items[TELEMETRYSCHED_CLASSES * DEPTH];
+};
+
+TEST_F(TelemetrySched, HighestClassFirst) {
+    int objs[3] = { 0 };
+    struct telemetrysched_item item;
+
+    ASSERT_EQ(0, push(&objs[2], TELEMETRYSCHED_LOW, 20, 0));
+    ASSERT_EQ(0, push(&objs[1], TELEMETRYSCHED_NORMAL, 20, 0));
+    ASSERT_EQ(0, push(&objs[0], TELEMETRYSCHED_HIGH, 20, 0));
+
+    for (int n = 0; n < 3; n++) {
+        ASSERT_TRUE(telemetrysched_pop(&sched, 0, &item));
+        EXPECT_EQ(&objs[n], item.obj);
+    }
+    EXPECT_FALSE(telemetrysched_pop(&sched, 0, &item));
+    EXPECT_FALSE(telemetrysched_pending(&sched));
+}
+
+TEST_F(TelemetrySched, CoalescesWaitingUpdates) {
+    int obj = 0;
+    struct telemetrysched_item first = makeItem(&obj, TELEMETRYSCHED_LOW, 20, 10);
+    struct telemetrysched_item again = makeItem(&obj, TELEMETRYSCHED_LOW, 30, 50);
+    struct telemetrysched_item item;
+
+    ASSERT_EQ(0, telemetrysched_push(&sched, &first));
+    ASSERT_EQ(TELEMETRYSCHED_COALESCED, telemetrysched_push(&sched, &again));
+
+    // Another instance or event is another update
+    again.instId = 3;
+    ASSERT_EQ(0, telemetrysched_push(&sched, &again));
+
+    ASSERT_TRUE(telemetrysched_pop(&sched, 50, &item));
+    EXPECT_EQ(30u, item.length);
+    EXPECT_EQ(10u, item.queued);
+    EXPECT_EQ(0xFFFF, item.instId);
+    ASSERT_TRUE(telemetrysched_pop(&sched, 50, &item));
+    EXPECT_EQ(3, item.instId);
+    EXPECT_FALSE(telemetrysched_pending(&sched));
+}
+
+TEST_F(TelemetrySched, CountsDropsWhenFull) {
+    int objs[DEPTH + 1] = { 0 };
+    struct telemetrysched_stats stats;
+
+    for (int n = 0; n < DEPTH; n++) {
+        ASSERT_EQ(0, push(&objs[n], TELEMETRYSCHED_NORMAL, 20, 0));
+    }
+    EXPECT_EQ(TELEMETRYSCHED_ERR_FULL, push(&objs[DEPTH], TELEMETRYSCHED_NORMAL, 20, 0));
+    // Other classes have their own room
+    EXPECT_EQ(0, push(&objs[DEPTH], TELEMETRYSCHED_HIGH, 20, 0));
+
+    telemetrysched_get_stats(&sched, &stats, true);
+    EXPECT_EQ(0u, stats.dropped[TELEMETRYSCHED_HIGH]);
+    EXPECT_EQ(1u, stats.dropped[TELEMETRYSCHED_NORMAL]);
+    telemetrysched_get_stats(&sched, &stats, false);
+    EXPECT_EQ(0u, stats.dropped[TELEMETRYSCHED_NORMAL]);
+}
+
+TEST_F(TelemetrySched, KeepsChangesWhenFull) {
+    int objs[DEPTH + 1] = { 0 };
+    struct telemetrysched_item change = makeItem(&objs[DEPTH], TELEMETRYSCHED_LOW, 20, 0);
+    struct telemetrysched_item item;
+    struct telemetrysched_stats stats;
+
+    change.event    = EV_CHANGED;
+    change.periodic = false;
+    for (int n = 0; n < DEPTH; n++) {
+        ASSERT_EQ(0, push(&objs[n], TELEMETRYSCHED_LOW, 20, 0));
+    }
+
+    // Refused, not dropped, the caller keeps it until there is room
+    EXPECT_EQ(TELEMETRYSCHED_ERR_FULL, telemetrysched_push(&sched, &change));
+    telemetrysched_get_stats(&sched, &stats, true);
+    EXPECT_EQ(0u, stats.dropped[TELEMETRYSCHED_LOW]);
+
+    ASSERT_TRUE(telemetrysched_pop(&sched, 0, &item));
+    EXPECT_EQ(0, telemetrysched_push(&sched, &change));
+}
+
+TEST_F(TelemetrySched, BucketHoldsBackAllButHigh) {
+    int objs[4] = { 0 };
+    struct telemetrysched_item item;
+
+    // 100 ms at 960 bytes/s to start with
+    ASSERT_EQ(0, push(&objs[0], TELEMETRYSCHED_LOW, 200, 0));
+    ASSERT_EQ(0, push(&objs[1], TELEMETRYSCHED_LOW, 200, 0));
+    ASSERT_TRUE(telemetrysched_pop(&sched, 0, &item));
+    EXPECT_FALSE(telemetrysched_pop(&sched, 0, &item));
+
+    // High priority goes anyway, and the others wait longer: 200 bytes
+    // owed, 209 ms at 960 bytes/s
+    ASSERT_EQ(0, push(&objs[2], TELEMETRYSCHED_HIGH, 96, 0));
+    ASSERT_TRUE(telemetrysched_pop(&sched, 0, &item));
+    EXPECT_EQ(&objs[2], item.obj);
+
+    EXPECT_FALSE(telemetrysched_pop(&sched, 208, &item));
+    ASSERT_TRUE(telemetrysched_pop(&sched, 209, &item));
+    EXPECT_EQ(&objs[1], item.obj);
+}
+
+TEST_F(TelemetrySched, LatencyStatistics) {
+    int obj = 0;
+    struct telemetrysched_stats stats;
+    struct telemetrysched_item item = makeItem(&obj, TELEMETRYSCHED_NORMAL, 20, 100);
+
+    telemetrysched_sent(&sched, &item, 110);
+    telemetrysched_sent(&sched, &item, 130);
+    item.priority = TELEMETRYSCHED_HIGH;
+    telemetrysched_sent(&sched, &item, 105);
+
+    telemetrysched_get_stats(&sched, &stats, true);
+    EXPECT_EQ(5, stats.latencyMean[TELEMETRYSCHED_HIGH]);
+    EXPECT_EQ(5, stats.latencyMax[TELEMETRYSCHED_HIGH]);
+    EXPECT_EQ(20, stats.latencyMean[TELEMETRYSCHED_NORMAL]);
+    EXPECT_EQ(30, stats.latencyMax[TELEMETRYSCHED_NORMAL]);
+    EXPECT_EQ(0, stats.latencyMean[TELEMETRYSCHED_LOW]);
+    EXPECT_EQ(2u, stats.sent[TELEMETRYSCHED_NORMAL]);
+
+    telemetrysched_get_stats(&sched, &stats, false);
+    EXPECT_EQ(0, stats.latencyMax[TELEMETRYSCHED_NORMAL]);
+    EXPECT_EQ(0u, stats.sent[TELEMETRYSCHED_NORMAL]);
+}
+
+/*
+ * A flight controller talking through a modem: the port runs at 57600 baud
+ * but the radio link only carries 9600. The transmit buffer of the port
+ * fills at the port rate and drains at the link rate, and whoever writes
+ * to a full buffer blocks, as PIOS_COM_ReserveBuffer() does.
+ */
+#define PORT_RATE   5760u
+#define LINK_RATE   960u
+#define TX_BUFFER   256
+#define QUEUE_SIZE  20 // TELEM_QUEUE_SIZE
+#define HEADER_SIZE 13 // UAVTalk header and CRC
+
+struct Source {
+    const char *name;
+    uint8_t    priority;
+    uint32_t   period;
+    uint16_t   size;
+    bool       periodic;
+    uint32_t   next;
+};
+
+/*
+ * Objects the way the telemetry module ranks them: priority objects and
+ * state changes high, the fast periodic state normal, the debug and status
+ * objects low
+ */
+static std::vector<Source> flightObjects()
+{
+    return std::vector<Source> {
+               { "SystemAlarms", TELEMETRYSCHED_HIGH, 1000, 30, true, 0 },
+               { "FlightStatus", TELEMETRYSCHED_HIGH, 1500, 12, false, 0 },
+               { "AttitudeState", TELEMETRYSCHED_NORMAL, 130, 16, true, 0 },
+               { "PositionState", TELEMETRYSCHED_NORMAL, 1000, 12, true, 0 },
+               { "VelocityState", TELEMETRYSCHED_NORMAL, 1000, 12, true, 0 },
+               { "GPSPositionSensor", TELEMETRYSCHED_NORMAL, 1000, 32, true, 0 },
+               { "TaskInfo", TELEMETRYSCHED_LOW, 250, 120, true, 0 },
+               { "CallbackInfo", TELEMETRYSCHED_LOW, 250, 120, true, 0 },
+               { "I2CStats", TELEMETRYSCHED_LOW, 250, 100, true, 0 },
+    };
+}
+
+class Link {
+public:
+    Link() : used(0), credit(0) {}
+
+    void drain()
+    {
+        credit += LINK_RATE;
+        uint32_t bytes = credit / 1000;
+        credit %= 1000;
+        used    = used > bytes ? used - bytes : 0;
+    }
+
+    bool write(uint16_t length)
+    {
+        if (used + length > TX_BUFFER) {
+            return false;
+        }
+        used += length;
+        return true;
+    }
+
+private:
+    uint32_t used;
+    uint32_t credit;
+};
+
+struct Result {
+    uint32_t maxLatency[TELEMETRYSCHED_CLASSES];
+    uint64_t latencySum[TELEMETRYSCHED_CLASSES];
+    uint32_t sent[TELEMETRYSCHED_CLASSES];
+    uint32_t lost;
+
+    Result()
+    {
+        memset(this, 0, sizeof(*this));
+    }
+
+    void account(const struct telemetrysched_item &item, uint32_t now)
+    {
+        uint32_t latency = now - item.queued;
+
+        maxLatency[item.priority]  = std::max(maxLatency[item.priority], latency);
+        latencySum[item.priority] += latency;
+        sent[item.priority]++;
+    }
+
+    uint32_t mean(int priority) const
+    {
+        return sent[priority] ? (uint32_t)(latencySum[priority] / sent[priority]) : 0;
+    }
+
+    void print(const char *what) const
+    {
+        printf("%-10s latency high %4u/%5u ms, normal %4u/%5u ms, low %5u/%5u ms (mean/max), %u updates lost\n", what,
+               mean(0), maxLatency[0], mean(1), maxLatency[1], mean(2), maxLatency[2], lost);
+    }
+};
+
+/*
+ * Runs the sources for a while, one step per ms. When stopLowAt is set the
+ * low priority sources go quiet from then on. capacitySum and scaleAtEnd,
+ * when given, collect the capacity estimate over the last half of the run
+ * and the period scale at its end.
+ */
+static Result simulateScheduler(uint32_t duration, uint32_t stopLowAt, uint64_t *capacitySum, uint8_t *scaleAtEnd)
+{
+    std::vector<Source> sources = flightObjects();
+    struct telemetrysched sched;
+    struct telemetrysched_item items[TELEMETRYSCHED_CLASSES * QUEUE_SIZE];
+    struct telemetrysched_item item;
+    bool blocked = false;
+    bool congested = false;
+    Link link;
+    Result result;
+
+    telemetrysched_init(&sched, items, QUEUE_SIZE, PORT_RATE, 0);
+
+    for (uint32_t now = 0; now < duration; now++) {
+        link.drain();
+
+        for (Source &source : sources) {
+            if (now < source.next || (stopLowAt && now >= stopLowAt && source.priority == TELEMETRYSCHED_LOW)) {
+                continue;
+            }
+            struct telemetrysched_item update = makeItem(&source, source.priority, source.size + HEADER_SIZE, now);
+            update.event    = source.periodic ? EV_PERIODIC : EV_CHANGED;
+            update.periodic = source.periodic;
+            if (telemetrysched_push(&sched, &update) == TELEMETRYSCHED_ERR_FULL) {
+                result.lost++;
+            }
+            source.next = now + (source.periodic ? telemetrysched_period(&sched, source.priority, source.period) : source.period);
+        }
+
+        // The transmit task, blocked in the port or taking what it may
+        while (blocked || telemetrysched_pop(&sched, now, &item)) {
+            if (!link.write(item.length)) {
+                blocked   = true;
+                congested = true;
+                break;
+            }
+            telemetrysched_link(&sched, item.length, congested, now);
+            telemetrysched_sent(&sched, &item, now);
+            result.account(item, now);
+            blocked   = false;
+            congested = false;
+        }
+
+        if (capacitySum && now >= duration / 2) {
+            *capacitySum += sched.capacity;
+        }
+    }
+    if (scaleAtEnd) {
+        *scaleAtEnd = sched.periodScale;
+    }
+    return result;
+}
+
+/*
+ * The same sources through one event queue, sent in the order they come
+ * as the telemetry module did before
+ */
+static Result simulateFifo(uint32_t duration)
+{
+    std::vector<Source> sources = flightObjects();
+    std::deque<struct telemetrysched_item> queue;
+    Link link;
+    Result result;
+
+    for (uint32_t now = 0; now < duration; now++) {
+        link.drain();
+
+        for (Source &source : sources) {
+            if (now < source.next) {
+                continue;
+            }
+            if (queue.size() < QUEUE_SIZE) {
+                queue.push_back(makeItem(&source, source.priority, source.size + HEADER_SIZE, now));
+            } else {
+                result.lost++;
+            }
+            source.next = now + source.period;
+        }
+
+        while (!queue.empty()) {
+            if (!link.write(queue.front().length)) {
+                break;
+            }
+            result.account(queue.front(), now);
+            queue.pop_front();
+        }
+    }
+    return result;
+}
+
+TEST(TelemetrySchedSimulation, HighPriorityStaysFastOnASaturatedLink) {
+    Result fifo = simulateFifo(60000);
+    Result scheduled = simulateScheduler(60000, 0, NULL, NULL);
+
+    fifo.print("fifo");
+    scheduled.print("scheduled");
+
+    // Before: everything waits behind the full queue, and updates get lost
+    EXPECT_GT(fifo.maxLatency[TELEMETRYSCHED_HIGH], 1000u);
+    EXPECT_GT(fifo.lost, 100u);
+
+    // Now a high priority update only waits for what is already in the port
+    EXPECT_LT(scheduled.maxLatency[TELEMETRYSCHED_HIGH], 400u);
+    EXPECT_LT(scheduled.mean(TELEMETRYSCHED_HIGH), 150u);
+    EXPECT_LT(scheduled.mean(TELEMETRYSCHED_NORMAL), 400u);
+    EXPECT_EQ(0u, scheduled.lost);
+    EXPECT_GT(scheduled.sent[TELEMETRYSCHED_LOW], 0u);
+}
+
+TEST(TelemetrySchedSimulation, CapacityConvergesToTheLink) {
+    uint64_t capacitySum = 0;
+
+    simulateScheduler(60000, 0, &capacitySum, NULL);
+
+    uint32_t capacity = (uint32_t)(capacitySum / 30000);
+    printf("capacity estimate %u bytes/s for a link of %u bytes/s on a port of %u bytes/s\n", capacity, LINK_RATE, PORT_RATE);
+    EXPECT_GT(capacity, LINK_RATE * 3 / 4);
+    EXPECT_LT(capacity, LINK_RATE * 5 / 4);
+}
+
+TEST(TelemetrySchedSimulation, LowPriorityPeriodsStretchAndRecover) {
+    uint8_t scale;
+
+    simulateScheduler(30000, 0, NULL, &scale);
+    printf("period scale %u under congestion\n", scale);
+    EXPECT_GE(scale, 2);
+
+    // The load goes away, the periods come back
+    simulateScheduler(60000, 30000, NULL, &scale);
+    EXPECT_EQ(1, scale);
+}
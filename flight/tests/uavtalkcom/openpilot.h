@@ -0,0 +1,53 @@
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The part of the RTOS UAVTalk uses, implemented by the test */
+typedef uint32_t portTickType;
+typedef void *xSemaphoreHandle;
+
+#define portTICK_RATE_MS 1
+#define portMAX_DELAY    0xffffffff
+#define pdTRUE           1
+#define pdFALSE          0
+
+xSemaphoreHandle xSemaphoreCreateRecursiveMutex(void);
+int32_t xSemaphoreTakeRecursive(xSemaphoreHandle sema, portTickType ticks);
+int32_t xSemaphoreGiveRecursive(xSemaphoreHandle sema);
+int32_t xSemaphoreTake(xSemaphoreHandle sema, portTickType ticks);
+int32_t xSemaphoreGive(xSemaphoreHandle sema);
+portTickType xTaskGetTickCount(void);
+#define vSemaphoreCreateBinary(sema) ((sema) = xSemaphoreCreateRecursiveMutex())
+
+void *pios_malloc(size_t size);
+
+/* The part of the object manager UAVTalk uses, implemented by the test */
+typedef void *UAVObjHandle;
+
+#define UAVOBJ_ALL_INSTANCES 0xFFFF
+
+UAVObjHandle UAVObjGetByID(uint32_t id);
+uint32_t UAVObjGetID(UAVObjHandle obj);
+uint32_t UAVObjGetNumBytes(UAVObjHandle obj);
+uint16_t UAVObjGetNumInstances(UAVObjHandle obj);
+bool UAVObjIsSingleInstance(UAVObjHandle obj);
+int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut);
+int32_t UAVObjPackSplit(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut, uint16_t length, uint8_t *dataOutNext);
+int32_t UAVObjUnpack(UAVObjHandle obj_handle, uint16_t instId, const uint8_t *dataIn);
+
+#include "pios.h"
+#include "uavtalk.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OPENPILOT_H */
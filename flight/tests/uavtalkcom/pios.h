@@ -0,0 +1,24 @@
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+/* The posix COM layer, without the RTOS */
+#define PIOS_INCLUDE_COM
+#define PIOS_COM_MAX_DEVS 4
+
+#define PIOS_Assert(x) \
+    if (!(x)) { while (1) {; } \
+    }
+
+int32_t PIOS_IRQ_Disable(void);
+int32_t PIOS_IRQ_Enable(void);
+
+#include "pios_crc.h"
+#include "pios_com.h"
+
+#endif /* PIOS_H */
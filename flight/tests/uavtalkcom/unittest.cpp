@@ -0,0 +1,462 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* malloc */
+#include <string.h> /* memcpy */
+#include <vector>
+#include <chrono>
+
+extern "C" {
+#include "openpilot.h"
+#include "pios_com_priv.h"
+#include "pios_delay.h"
+#include "uavobjectsinit.h"
+}
+
+#define SYNC_VAL     0x3C
+#define TYPE_OBJ     0x20
+#define TYPE_STREAM  0x25
+#define HEADER_SIZE  10
+
+// Transmit buffers of the two ports: one for most packets, one too small for some
+#define BIG_RING     256
+#define SMALL_RING   64
+
+typedef std::vector<uint8_t> Bytes;
+
+/*
+ * The RTOS, as far as UAVTalk and the posix COM layer go: nothing blocks
+ */
+static uint8_t lock;
+
+xSemaphoreHandle xSemaphoreCreateRecursiveMutex(void)
+{
+    return &lock;
+}
+
+int32_t xSemaphoreTakeRecursive(__attribute__((unused)) xSemaphoreHandle sema, __attribute__((unused)) portTickType ticks)
+{
+    return pdTRUE;
+}
+
+int32_t xSemaphoreGiveRecursive(__attribute__((unused)) xSemaphoreHandle sema)
+{
+    return pdTRUE;
+}
+
+int32_t xSemaphoreTake(__attribute__((unused)) xSemaphoreHandle sema, __attribute__((unused)) portTickType ticks)
+{
+    return pdTRUE;
+}
+
+int32_t xSemaphoreGive(__attribute__((unused)) xSemaphoreHandle sema)
+{
+    return pdTRUE;
+}
+
+portTickType xTaskGetTickCount(void)
+{
+    return 0;
+}
+
+void *pios_malloc(size_t size)
+{
+    return malloc(size);
+}
+
+int32_t PIOS_IRQ_Disable(void)
+{
+    return 0;
+}
+
+int32_t PIOS_IRQ_Enable(void)
+{
+    return 0;
+}
+
+int32_t PIOS_DELAY_WaitmS(__attribute__((unused)) uint32_t mS)
+{
+    return 0;
+}
+
+/*
+ * The object manager: a few single instance objects, filled from their ID.
+ * Packing records where the payload went.
+ */
+struct TestObject {
+    uint32_t id;
+    uint16_t size;
+    uint8_t  data[UAVOBJECTS_LARGEST];
+};
+
+static TestObject objects[] = {
+    { 0x11223344, 40,  { 0 } },
+    { 0x55667788, 100, { 0 } },
+    { 0x99AABBCC, 200, { 0 } },
+};
+#define NUM_OBJECTS (sizeof(objects) / sizeof(objects[0]))
+
+static uint8_t *lastPackOut;
+static uint32_t splitPacks;
+
+static void fillObjects(void)
+{
+    for (uint32_t n = 0; n < NUM_OBJECTS; n++) {
+        for (uint32_t i = 0; i < objects[n].size; i++) {
+            objects[n].data[i] = (uint8_t)(objects[n].id * 13 + i * 7);
+        }
+    }
+}
+
+UAVObjHandle UAVObjGetByID(uint32_t id)
+{
+    for (uint32_t n = 0; n < NUM_OBJECTS; n++) {
+        if (objects[n].id == id) {
+            return &objects[n];
+        }
+    }
+    return NULL;
+}
+
+uint32_t UAVObjGetID(UAVObjHandle obj)
+{
+    return ((TestObject *)obj)->id;
+}
+
+uint32_t UAVObjGetNumBytes(UAVObjHandle obj)
+{
+    return ((TestObject *)obj)->size;
+}
+
+uint16_t UAVObjGetNumInstances(__attribute__((unused)) UAVObjHandle obj)
+{
+    return 1;
+}
+
+bool UAVObjIsSingleInstance(__attribute__((unused)) UAVObjHandle obj)
+{
+    return true;
+}
+
+int32_t UAVObjPack(UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, uint8_t *dataOut)
+{
+    TestObject *obj = (TestObject *)obj_handle;
+
+    lastPackOut = dataOut;
+    memcpy(dataOut, obj->data, obj->size);
+    return 0;
+}
+
+int32_t UAVObjPackSplit(UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, uint8_t *dataOut, uint16_t length, uint8_t *dataOutNext)
+{
+    TestObject *obj = (TestObject *)obj_handle;
+
+    lastPackOut = dataOut;
+    if (obj->size > length) {
+        splitPacks++;
+        memcpy(dataOut, obj->data, length);
+        memcpy(dataOutNext, obj->data + length, obj->size - length);
+    } else {
+        memcpy(dataOut, obj->data, obj->size);
+    }
+    return 0;
+}
+
+int32_t UAVObjUnpack(__attribute__((unused)) UAVObjHandle obj_handle, __attribute__((unused)) uint16_t instId, __attribute__((unused)) const uint8_t *dataIn)
+{
+    return 0;
+}
+
+/*
+ * A COM driver that only sends when drained, into the wire
+ */
+static pios_com_callback txOutCb[2];
+static uint32_t txOutContext[2];
+
+static void loopbackBindTxCb(uint32_t id, pios_com_callback tx_out_cb, uint32_t context)
+{
+    txOutCb[id]      = tx_out_cb;
+    txOutContext[id] = context;
+}
+
+static const struct pios_com_driver loopbackDriver = {
+    .init       = NULL,
+    .set_baud   = NULL,
+    .tx_start   = NULL,
+    .rx_start   = NULL,
+    .bind_rx_cb = NULL,
+    .bind_tx_cb = loopbackBindTxCb,
+    .available  = NULL,
+};
+
+static uint8_t bigRing[BIG_RING];
+static uint8_t smallRing[SMALL_RING];
+static uint32_t bigPort;
+static uint32_t smallPort;
+
+static Bytes wire;
+static bool keepWire = true;
+
+static void openPorts(void)
+{
+    if (!bigPort) {
+        PIOS_COM_Init(&bigPort, &loopbackDriver, 0, NULL, 0, bigRing, sizeof(bigRing));
+        PIOS_COM_Init(&smallPort, &loopbackDriver, 1, NULL, 0, smallRing, sizeof(smallRing));
+    }
+}
+
+static void drain(uint32_t lower_id)
+{
+    uint8_t buf[32];
+    uint16_t headroom;
+    bool need_yield;
+    uint16_t n;
+
+    while ((n = txOutCb[lower_id](txOutContext[lower_id], buf, sizeof(buf), &headroom, &need_yield)) > 0) {
+        if (keepWire) {
+            wire.insert(wire.end(), buf, buf + n);
+        }
+    }
+}
+
+/*
+ * Output of the connection under test: the port it writes into, and the
+ * output stream that bypasses it
+ */
+static uint32_t outPort;
+static uint32_t streamCalls;
+
+static int32_t outputStream(uint8_t *data, int32_t length)
+{
+    streamCalls++;
+    wire.insert(wire.end(), data, data + length);
+    return length;
+}
+
+static int32_t reserve(uint16_t length, struct pios_com_span *span)
+{
+    if (outPort) {
+        return PIOS_COM_ReserveBuffer(outPort, length, span, 0);
+    }
+    return -1;
+}
+
+static int32_t commit(uint16_t length)
+{
+    return PIOS_COM_CommitBuffer(outPort, length);
+}
+
+static int32_t discardStream(__attribute__((unused)) uint8_t *data, int32_t length)
+{
+    return length;
+}
+
+static Bytes packet(uint8_t type, uint32_t objId, const uint8_t *data, uint16_t length)
+{
+    Bytes p;
+
+    p.push_back(SYNC_VAL);
+    p.push_back(type);
+    p.push_back((HEADER_SIZE + length) & 0xFF);
+    p.push_back((HEADER_SIZE + length) >> 8);
+    for (int i = 0; i < 4; i++) {
+        p.push_back((objId >> (8 * i)) & 0xFF);
+    }
+    p.push_back(0);
+    p.push_back(0);
+    p.insert(p.end(), data, data + length);
+    p.push_back(PIOS_CRC_updateCRC(0, p.data(), p.size()));
+    return p;
+}
+
+static Bytes objectPacket(const TestObject &obj)
+{
+    return packet(TYPE_OBJ, obj.id, obj.data, obj.size);
+}
+
+static bool inRing(const uint8_t *p, const uint8_t *ring, uint32_t size)
+{
+    return p >= ring && p < ring + size;
+}
+
+class UAVTalkCom : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        fillObjects();
+        openPorts();
+        drain(0);
+        drain(1);
+        wire.clear();
+        keepWire    = true;
+        lastPackOut = NULL;
+        splitPacks  = 0;
+        streamCalls = 0;
+        outPort     = bigPort;
+        con = UAVTalkInitialize(&outputStream);
+        ASSERT_NE((UAVTalkConnection)0, con);
+        UAVTalkSetOutputBuffer(con, &reserve, &commit);
+    }
+
+    UAVTalkConnection con;
+};
+
+TEST_F(UAVTalkCom, PacksObjectIntoTxRing) {
+    UAVTalkStats stats;
+
+    ASSERT_EQ(0, UAVTalkSendObject(con, &objects[0], 0, 0, 0));
+
+    // Packed once, straight into the transmit buffer of the port
+    EXPECT_EQ(0u, streamCalls);
+    EXPECT_TRUE(inRing(lastPackOut, bigRing, sizeof(bigRing)));
+
+    drain(0);
+    EXPECT_EQ(objectPacket(objects[0]), wire);
+
+    UAVTalkGetStats(con, &stats, false);
+    EXPECT_EQ(1u, stats.txObjects);
+    EXPECT_EQ(objects[0].size, stats.txObjectBytes);
+    EXPECT_EQ(wire.size(), stats.txBytes);
+    EXPECT_EQ(0u, stats.txErrors);
+}
+
+TEST_F(UAVTalkCom, WrapsAroundTxRing) {
+    Bytes expected = objectPacket(objects[0]);
+
+    // The packet length is odd, so the packets start at every offset of the ring
+    ASSERT_EQ(1u, expected.size() % 2);
+    for (uint32_t i = 0; i < BIG_RING; i++) {
+        wire.clear();
+        ASSERT_EQ(0, UAVTalkSendObject(con, &objects[0], 0, 0, 0));
+        EXPECT_TRUE(inRing(lastPackOut, bigRing, sizeof(bigRing)));
+        drain(0);
+        ASSERT_EQ(expected, wire) << "packet " << i;
+    }
+
+    // Wrapped in the header, the payload and the checksum
+    EXPECT_GT(splitPacks, 0u);
+    EXPECT_EQ(0u, streamCalls);
+}
+
+TEST_F(UAVTalkCom, FallsBackWhenPacketDoesNotFit) {
+    outPort = smallPort;
+    ASSERT_EQ(0, UAVTalkSendObject(con, &objects[1], 0, 0, 0));
+
+    EXPECT_EQ(1u, streamCalls);
+    EXPECT_FALSE(inRing(lastPackOut, smallRing, sizeof(smallRing)));
+    EXPECT_EQ(objectPacket(objects[1]), wire);
+
+    // Nothing was left in the ring
+    wire.clear();
+    drain(1);
+    EXPECT_TRUE(wire.empty());
+}
+
+TEST_F(UAVTalkCom, FallsBackWithoutPort) {
+    outPort = 0;
+    ASSERT_EQ(0, UAVTalkSendObject(con, &objects[0], 0, 0, 0));
+
+    EXPECT_EQ(1u, streamCalls);
+    EXPECT_EQ(objectPacket(objects[0]), wire);
+}
+
+TEST_F(UAVTalkCom, FullRingIsAnError) {
+    UAVTalkStats stats;
+    uint8_t filler[SMALL_RING - 20];
+
+    memset(filler, 0xA5, sizeof(filler));
+    outPort = smallPort;
+    ASSERT_EQ((int32_t)sizeof(filler), PIOS_COM_SendBuffer(smallPort, filler, sizeof(filler)));
+
+    // No room, and the packet must not go around the ring through the stream
+    EXPECT_EQ(-1, UAVTalkSendObject(con, &objects[0], 0, 0, 0));
+    EXPECT_EQ(0u, streamCalls);
+    UAVTalkGetStats(con, &stats, false);
+    EXPECT_EQ(1u, stats.txErrors);
+    EXPECT_EQ(0u, stats.txBytes);
+
+    drain(1);
+    EXPECT_EQ(Bytes(filler, filler + sizeof(filler)), wire);
+}
+
+TEST_F(UAVTalkCom, RelaysPacketVerbatim) {
+    UAVTalkConnection in = UAVTalkInitialize(&discardStream);
+    Bytes input = objectPacket(objects[2]);
+    UAVTalkRxState state = UAVTALK_STATE_ERROR;
+
+    for (uint32_t i = 0; i < input.size(); i++) {
+        state = UAVTalkProcessInputStream(in, input[i]);
+    }
+    ASSERT_EQ(UAVTALK_STATE_COMPLETE, state);
+
+    // Copied from the receive buffer at every offset of the ring
+    ASSERT_EQ(1u, input.size() % 2);
+    for (uint32_t i = 0; i < BIG_RING; i++) {
+        wire.clear();
+        ASSERT_EQ(0, UAVTalkRelayPacket(in, con));
+        drain(0);
+        ASSERT_EQ(input, wire) << "packet " << i;
+    }
+    EXPECT_EQ(0u, streamCalls);
+}
+
+TEST_F(UAVTalkCom, StreamsThroughTxRing) {
+    uint8_t data[150];
+
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 3);
+    }
+    ASSERT_EQ(0, UAVTalkSendStream(con, 0xC9AB4E64, 0, data, sizeof(data)));
+    EXPECT_EQ(0u, streamCalls);
+    drain(0);
+    EXPECT_EQ(packet(TYPE_STREAM, 0xC9AB4E64, data, sizeof(data)), wire);
+
+    // Longer than the ring, in three parts through the stream
+    uint8_t longData[BIG_RING];
+    memset(longData, 0x5A, sizeof(longData));
+    wire.clear();
+    ASSERT_EQ(0, UAVTalkSendStream(con, 0xC9AB4E64, 0, longData, sizeof(longData)));
+    EXPECT_EQ(3u, streamCalls);
+    EXPECT_EQ(packet(TYPE_STREAM, 0xC9AB4E64, longData, sizeof(longData)), wire);
+}
+
+/*
+ * The same objects through the transmit buffer, packed in place or packed
+ * into the connection buffer and copied there by PIOS_COM_SendBuffer()
+ */
+static int32_t sendBufferStream(uint8_t *data, int32_t length)
+{
+    return PIOS_COM_SendBuffer(bigPort, data, length);
+}
+
+static double sendObjects(UAVTalkConnection connection, uint32_t count)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < count; i++) {
+        UAVTalkSendObject(connection, &objects[2], 0, 0, 0);
+        drain(0);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+TEST_F(UAVTalkCom, Throughput) {
+    const uint32_t count = 200000;
+    UAVTalkConnection copying = UAVTalkInitialize(&sendBufferStream);
+    UAVTalkStats inPlace, copied;
+
+    keepWire = false;
+    double inPlaceTime = sendObjects(con, count);
+    double copiedTime  = sendObjects(copying, count);
+
+    UAVTalkGetStats(con, &inPlace, false);
+    UAVTalkGetStats(copying, &copied, false);
+    ASSERT_EQ(count, inPlace.txObjects);
+    ASSERT_EQ(count, copied.txObjects);
+    EXPECT_EQ(inPlace.txBytes, copied.txBytes);
+    EXPECT_EQ(0u, streamCalls);
+
+    printf("%u objects of %u bytes: packed into the ring %.1f MB/s, copied into the ring %.1f MB/s\n",
+           count, objects[2].size, inPlace.txBytes / inPlaceTime / 1e6, copied.txBytes / copiedTime / 1e6);
+}
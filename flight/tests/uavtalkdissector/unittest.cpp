@@ -0,0 +1,307 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* fopen */
+#include <stdlib.h> /* rand */
+#include <string.h> /* memcpy */
+#include <vector>
+
+extern "C" {
+#include <stdint.h>
+#include "uavtalk-frame.h"
+#include "uavo-hash.h"
+}
+
+/*
+ * SAMPLE_STREAM_FILE is a UAVTalk byte stream as it goes over the TCP
+ * telemetry port: the telemetry handshake, the metadata and the ten
+ * instances of a multi instance object sent acked, a stream of attitude
+ * with some timestamped frames, four runs of line noise, a frame with a
+ * bad checksum and the NACK of an unknown object.
+ */
+#define SAMPLE_FRAMES      238u
+#define SAMPLE_NOISE       4u
+#define SAMPLE_BAD_CRC     1u
+#define SAMPLE_TIMESTAMPED 20u
+
+#define FLIGHTTELEMETRYSTATS_OBJID 0x2F7E2902
+#define GCSTELEMETRYSTATS_OBJID    0xABC72744
+#define ATTITUDESTATE_OBJID        0xD7E0D964
+#define WAYPOINT_OBJID             0xD23852DC
+#define FLIGHTSTATUS_OBJID         0x9B6A127E
+#define UNKNOWN_OBJID              0x12345678
+
+// The table the generator would emit for these objects
+static const uint32_t sampleIds[] = {
+    FLIGHTTELEMETRYSTATS_OBJID,
+    GCSTELEMETRYSTATS_OBJID,
+    ATTITUDESTATE_OBJID,
+    WAYPOINT_OBJID,
+    FLIGHTSTATUS_OBJID,
+};
+#define SAMPLE_OBJECTS (sizeof(sampleIds) / sizeof(sampleIds[0]))
+#define SAMPLE_BITS    4
+
+struct Pdu {
+    uint32_t offset;
+    uint32_t length;
+    bool     isFrame;
+};
+
+class UAVTalkDissector : public testing::Test {
+protected:
+    std::vector<uint8_t> stream;
+
+    virtual void SetUp()
+    {
+        FILE *sample = fopen(SAMPLE_STREAM_FILE, "rb");
+
+        ASSERT_TRUE(sample != NULL);
+        uint8_t buf[256];
+        size_t n;
+        while ((n = fread(buf, 1, sizeof(buf), sample)) > 0) {
+            stream.insert(stream.end(), buf, buf + n);
+        }
+        fclose(sample);
+        srand(1);
+    }
+
+    // The PDUs get_op_uavtalk_pdu_len() splits a complete stream into
+    std::vector<Pdu> split(const uint8_t *data, uint32_t length)
+    {
+        std::vector<Pdu> pdus;
+        uint32_t offset = 0;
+
+        while (offset < length) {
+            int32_t frameLength = uavtalk_frame_length(data + offset, length - offset);
+            Pdu pdu = { offset, 0, frameLength > 0 };
+            pdu.length = frameLength < 0 ? uavtalk_resync(data + offset, length - offset) : (uint32_t)frameLength;
+            EXPECT_GT(pdu.length, 0u);
+            EXPECT_LE(offset + pdu.length, length);
+            pdus.push_back(pdu);
+            offset += pdu.length;
+        }
+        return pdus;
+    }
+
+    /*
+     * Feeds the stream in segments of the given sizes the way
+     * tcp_dissect_pdus() does: the PDU length is asked for once
+     * UAVTALK_FRAME_PROBE_LENGTH bytes are there, and more segments are
+     * waited for until the whole PDU is
+     */
+    std::vector<Pdu> reassemble(const std::vector<uint32_t> &segments)
+    {
+        std::vector<Pdu> pdus;
+        std::vector<uint8_t> pending;
+        uint32_t consumed = 0;
+        uint32_t fed = 0;
+
+        for (uint32_t n = 0; fed < stream.size(); n++) {
+            uint32_t size = segments[n % segments.size()];
+            size = std::min<uint32_t>(size, stream.size() - fed);
+            pending.insert(pending.end(), stream.begin() + fed, stream.begin() + fed + size);
+            fed += size;
+
+            while (pending.size() >= UAVTALK_FRAME_PROBE_LENGTH) {
+                int32_t frameLength = uavtalk_frame_length(&pending[0], pending.size());
+                uint32_t length     = frameLength < 0 ? uavtalk_resync(&pending[0], pending.size()) : (uint32_t)frameLength;
+                if (length > pending.size()) {
+                    break;
+                }
+                Pdu pdu = { consumed, length, frameLength > 0 };
+                pdus.push_back(pdu);
+                pending.erase(pending.begin(), pending.begin() + length);
+                consumed += length;
+            }
+        }
+        // The stream ends on a whole frame
+        EXPECT_EQ(0u, pending.size());
+        return pdus;
+    }
+
+    bool crcMatches(const Pdu &pdu)
+    {
+        return uavtalk_crc8(0, &stream[pdu.offset], pdu.length - 1) == stream[pdu.offset + pdu.length - 1];
+    }
+
+    uint32_t objid(const Pdu &pdu)
+    {
+        const uint8_t *p = &stream[pdu.offset + 4];
+
+        return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+    }
+
+    uint16_t instid(const Pdu &pdu)
+    {
+        return stream[pdu.offset + 8] | (stream[pdu.offset + 9] << 8);
+    }
+};
+
+TEST_F(UAVTalkDissector, FrameLengthNeedsTheProbeBytes) {
+    const uint8_t header[] = { UAVTALK_SYNC_VAL, UAVTALK_TYPE_VER | UAVTALK_TYPE_OBJ, 38, 0 };
+
+    EXPECT_EQ(0, uavtalk_frame_length(header, 0));
+    EXPECT_EQ(0, uavtalk_frame_length(header, 1));
+    EXPECT_EQ(0, uavtalk_frame_length(header, 3));
+    EXPECT_EQ(39, uavtalk_frame_length(header, 4));
+
+    // Not a sync byte, the wrong version, lengths shorter than the header or too long
+    const uint8_t noSync[]  = { 0x3D, 0x20, 38, 0 };
+    const uint8_t version[] = { UAVTALK_SYNC_VAL, 0x10, 38, 0 };
+    const uint8_t shortTs[] = { UAVTALK_SYNC_VAL, UAVTALK_TIMESTAMPED | UAVTALK_TYPE_VER, 11, 0 };
+    const uint8_t tooLong[] = { UAVTALK_SYNC_VAL, UAVTALK_TYPE_VER, 0xFF, 0xFF };
+    EXPECT_EQ(-1, uavtalk_frame_length(noSync, 4));
+    EXPECT_EQ(-1, uavtalk_frame_length(version, 2));
+    EXPECT_EQ(-1, uavtalk_frame_length(shortTs, 4));
+    EXPECT_EQ(-1, uavtalk_frame_length(tooLong, 4));
+}
+
+TEST_F(UAVTalkDissector, SplitsTheSampleIntoFrames) {
+    std::vector<Pdu> pdus = split(&stream[0], stream.size());
+    uint32_t frames = 0, noise = 0, badCrc = 0, timestamped = 0;
+
+    for (const Pdu &pdu : pdus) {
+        if (!pdu.isFrame) {
+            noise++;
+            continue;
+        }
+        frames++;
+        if (!crcMatches(pdu)) {
+            badCrc++;
+        }
+        if (stream[pdu.offset + 1] & UAVTALK_TIMESTAMPED) {
+            timestamped++;
+        }
+    }
+    EXPECT_EQ(SAMPLE_FRAMES, frames);
+    EXPECT_EQ(SAMPLE_NOISE, noise);
+    EXPECT_EQ(SAMPLE_BAD_CRC, badCrc);
+    EXPECT_EQ(SAMPLE_TIMESTAMPED, timestamped);
+}
+
+/*
+ * Noise can come out in more pieces when a segment ends on what could be
+ * the start of a frame, the frames must come out the same
+ */
+static std::vector<Pdu> framesOf(const std::vector<Pdu> &pdus)
+{
+    std::vector<Pdu> frames;
+
+    for (const Pdu &pdu : pdus) {
+        if (pdu.isFrame) {
+            frames.push_back(pdu);
+        }
+    }
+    return frames;
+}
+
+TEST_F(UAVTalkDissector, ReassemblesFramesAcrossSegments) {
+    std::vector<Pdu> whole = framesOf(split(&stream[0], stream.size()));
+    const uint32_t sizes[] = { 1, 2, 3, 4, 5, 7, 13, 64, 536, 1460 };
+
+    for (uint32_t size : sizes) {
+        std::vector<Pdu> frames = framesOf(reassemble(std::vector<uint32_t>(1, size)));
+        ASSERT_EQ(whole.size(), frames.size()) << "segments of " << size;
+        for (uint32_t n = 0; n < whole.size(); n++) {
+            ASSERT_EQ(whole[n].offset, frames[n].offset);
+            ASSERT_EQ(whole[n].length, frames[n].length);
+        }
+    }
+
+    // And segments of random sizes
+    for (int run = 0; run < 100; run++) {
+        std::vector<uint32_t> segments;
+        for (int n = 0; n < 64; n++) {
+            segments.push_back(1 + rand() % 200);
+        }
+        std::vector<Pdu> frames = framesOf(reassemble(segments));
+        ASSERT_EQ(whole.size(), frames.size());
+        for (uint32_t n = 0; n < whole.size(); n++) {
+            ASSERT_EQ(whole[n].offset, frames[n].offset);
+            ASSERT_EQ(whole[n].length, frames[n].length);
+        }
+    }
+}
+
+TEST_F(UAVTalkDissector, DispatchesEveryObjectOfTheSample) {
+    int16_t slots[1 << SAMPLE_BITS];
+
+    uavo_hash_init(slots, SAMPLE_BITS);
+    for (uint32_t n = 0; n < SAMPLE_OBJECTS; n++) {
+        ASSERT_GT(uavo_hash_insert(slots, SAMPLE_BITS, sampleIds, n), 0);
+    }
+
+    uint32_t unknown = 0, meta = 0;
+    bool waypoints[10] = { false };
+    for (const Pdu &pdu : split(&stream[0], stream.size())) {
+        if (!pdu.isFrame) {
+            continue;
+        }
+        // As dissect_uavobjects() does, metadata under the ID of their object
+        uint32_t id = objid(pdu);
+        int32_t index = uavo_hash_find(slots, SAMPLE_BITS, sampleIds, id & ~0x1);
+        if (id == UNKNOWN_OBJID) {
+            EXPECT_EQ(-1, index);
+            unknown++;
+            continue;
+        }
+        ASSERT_GE(index, 0);
+        EXPECT_EQ(id & ~0x1, sampleIds[index]);
+        if (id & 0x1) {
+            meta++;
+        }
+        if (id == WAYPOINT_OBJID) {
+            ASSERT_LT(instid(pdu), 10);
+            waypoints[instid(pdu)] = true;
+        } else {
+            EXPECT_EQ(0, instid(pdu));
+        }
+    }
+    EXPECT_EQ(2u, unknown);
+    EXPECT_EQ(2u, meta);
+    for (int n = 0; n < 10; n++) {
+        EXPECT_TRUE(waypoints[n]) << "instance " << n;
+    }
+}
+
+TEST_F(UAVTalkDissector, HashKeepsProbesShortAtHalfLoad) {
+    // As many objects as the generator's tables at their fullest
+    const uint32_t bits = 8;
+    uint32_t ids[128];
+    int16_t slots[1 << bits];
+    int32_t maxProbes = 0, totalProbes = 0;
+
+    uavo_hash_init(slots, bits);
+    for (int16_t n = 0; n < 128; n++) {
+        ids[n] = ((uint32_t)rand() << 16 ^ rand()) & 0xFFFFFFFE;
+        int32_t probes = uavo_hash_insert(slots, bits, ids, n);
+        ASSERT_GT(probes, 0);
+        maxProbes    = std::max(maxProbes, probes);
+        totalProbes += probes;
+    }
+    for (int16_t n = 0; n < 128; n++) {
+        EXPECT_EQ(n, uavo_hash_find(slots, bits, ids, ids[n]));
+    }
+    EXPECT_EQ(-1, uavo_hash_find(slots, bits, ids, 0x1));
+    printf("128 objects in 256 slots: %.2f probes on average, %d at most\n", (double)totalProbes / 128, maxProbes);
+    EXPECT_LT(totalProbes, 2 * 128);
+
+    // The same ID twice is refused
+    ids[0] = ids[1];
+    EXPECT_EQ(-1, uavo_hash_insert(slots, bits, ids, 0));
+}
+
+TEST_F(UAVTalkDissector, HashFullTable) {
+    uint32_t ids[5] = { 2, 4, 6, 8, 10 };
+    int16_t slots[4];
+
+    uavo_hash_init(slots, 2);
+    for (int16_t n = 0; n < 4; n++) {
+        ASSERT_GT(uavo_hash_insert(slots, 2, ids, n), 0);
+    }
+    EXPECT_EQ(-1, uavo_hash_insert(slots, 2, ids, 4));
+    for (int16_t n = 0; n < 4; n++) {
+        EXPECT_EQ(n, uavo_hash_find(slots, 2, ids, ids[n]));
+    }
+    EXPECT_EQ(-1, uavo_hash_find(slots, 2, ids, 10));
+}
@@ -0,0 +1,351 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <vector>
+
+extern "C" {
+#include "pios.h"
+#include "pios_usart_dma.h"
+}
+
+/*
+ * Stand-in for the COM layer. Receive accepts up to `room` bytes, transmit
+ * hands out whatever is queued in `pending`. Every call is recorded so the
+ * tests can check how the data was chunked. The context is only checked,
+ * it is too narrow for a host pointer.
+ */
+struct fake_com {
+    std::vector<uint8_t>  received;
+    std::vector<uint16_t> rx_calls;
+    uint16_t room;
+    bool     rx_wakes;
+
+    std::vector<uint8_t>  pending;
+    uint16_t tx_calls;
+    bool     tx_wakes;
+};
+
+#define COM_CONTEXT 0x434f4d31U
+
+static struct fake_com com;
+
+static uint16_t fake_rx_in(uint32_t context, uint8_t *buf, uint16_t buf_len, uint16_t *headroom, bool *need_yield)
+{
+    EXPECT_EQ(COM_CONTEXT, context);
+    EXPECT_TRUE(headroom == NULL);
+
+    com.rx_calls.push_back(buf_len);
+    uint16_t n = (buf_len < com.room) ? buf_len : com.room;
+    com.received.insert(com.received.end(), buf, buf + n);
+    com.room -= n;
+
+    /* Like the COM layer, only written when something was woken */
+    if (n > 0 && com.rx_wakes) {
+        *need_yield = true;
+    }
+    return n;
+}
+
+static uint16_t fake_tx_out(uint32_t context, uint8_t *buf, uint16_t buf_len, uint16_t *headroom, bool *need_yield)
+{
+    EXPECT_EQ(COM_CONTEXT, context);
+    EXPECT_TRUE(headroom == NULL);
+
+    com.tx_calls++;
+    uint16_t n = (buf_len < com.pending.size()) ? buf_len : com.pending.size();
+    memcpy(buf, &com.pending[0], n);
+    com.pending.erase(com.pending.begin(), com.pending.begin() + n);
+
+    *need_yield = com.tx_wakes;
+    return n;
+}
+
+#define RING_SIZE 16
+
+/*
+ * Circular receive stream: writes bytes into the ring the way the DMA
+ * controller does and keeps the remaining transfer count (NDTR) in step.
+ */
+class UsartDmaRx : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        memset(ring_buf, 0, sizeof(ring_buf));
+        PIOS_USART_RxRing_Init(&ring, ring_buf, sizeof(ring_buf));
+        pos        = 0;
+        next_byte  = 0;
+        expected.clear();
+        com.received.clear();
+        com.rx_calls.clear();
+        com.room     = 0xffff;
+        com.rx_wakes = false;
+    }
+
+    void receive(uint16_t len)
+    {
+        for (uint16_t i = 0; i < len; i++) {
+            ring_buf[pos] = next_byte;
+            expected.push_back(next_byte);
+            next_byte++;
+            pos = (pos + 1) % RING_SIZE;
+        }
+    }
+
+    uint16_t ndtr()
+    {
+        /* Reloads to the full size on wrap */
+        return RING_SIZE - pos;
+    }
+
+    uint16_t drain(bool *need_yield)
+    {
+        return PIOS_USART_RxRing_Drain(&ring, ndtr(), fake_rx_in, COM_CONTEXT, need_yield);
+    }
+
+    struct pios_usart_rx_ring ring;
+    uint8_t  ring_buf[RING_SIZE];
+    uint16_t pos;
+    uint8_t  next_byte;
+    std::vector<uint8_t> expected;
+};
+
+TEST_F(UsartDmaRx, NothingReceived) {
+    bool need_yield = false;
+
+    EXPECT_EQ(0, drain(&need_yield));
+    EXPECT_EQ(0U, com.rx_calls.size());
+    EXPECT_FALSE(need_yield);
+}
+
+TEST_F(UsartDmaRx, SingleChunk) {
+    bool need_yield = false;
+
+    receive(5);
+    EXPECT_EQ(5, drain(&need_yield));
+    ASSERT_EQ(1U, com.rx_calls.size());
+    EXPECT_EQ(5, com.rx_calls[0]);
+    EXPECT_EQ(expected, com.received);
+    EXPECT_EQ(5, ring.tail);
+
+    /* Draining again without new data does nothing */
+    EXPECT_EQ(0, drain(&need_yield));
+    EXPECT_EQ(1U, com.rx_calls.size());
+}
+
+TEST_F(UsartDmaRx, FullTransferEndsAtRingEnd) {
+    bool need_yield = false;
+
+    /* Transfer complete with the counter already reloaded */
+    receive(RING_SIZE);
+    EXPECT_EQ(RING_SIZE, ndtr());
+    EXPECT_EQ(0, drain(&need_yield));
+
+    /* Only the half transfer in between makes the full lap visible */
+    SetUp();
+    receive(RING_SIZE / 2);
+    EXPECT_EQ(RING_SIZE / 2, drain(&need_yield));
+    receive(RING_SIZE / 2);
+    EXPECT_EQ(RING_SIZE / 2, drain(&need_yield));
+    EXPECT_EQ(0, ring.tail);
+    EXPECT_EQ(expected, com.received);
+}
+
+TEST_F(UsartDmaRx, CounterAtZero) {
+    bool need_yield = false;
+
+    /* Read in passing, before the stream reloaded */
+    receive(RING_SIZE - 4);
+    EXPECT_EQ(RING_SIZE - 4, drain(&need_yield));
+    receive(4);
+    EXPECT_EQ(4, PIOS_USART_RxRing_Drain(&ring, 0, fake_rx_in, COM_CONTEXT, &need_yield));
+    EXPECT_EQ(0, ring.tail);
+    EXPECT_EQ(expected, com.received);
+}
+
+TEST_F(UsartDmaRx, WrapIsTwoChunks) {
+    bool need_yield = false;
+
+    receive(12);
+    EXPECT_EQ(12, drain(&need_yield));
+
+    /* 4 bytes up to the end of the ring and 6 from the start */
+    receive(10);
+    EXPECT_EQ(10, drain(&need_yield));
+    ASSERT_EQ(3U, com.rx_calls.size());
+    EXPECT_EQ(4, com.rx_calls[1]);
+    EXPECT_EQ(6, com.rx_calls[2]);
+    EXPECT_EQ(6, ring.tail);
+    EXPECT_EQ(expected, com.received);
+}
+
+TEST_F(UsartDmaRx, ManyLaps) {
+    bool need_yield = false;
+
+    for (int i = 0; i < 100; i++) {
+        receive(1 + (i % (RING_SIZE - 1)));
+        drain(&need_yield);
+    }
+    EXPECT_EQ(expected, com.received);
+    EXPECT_EQ(0U, ring.dropped);
+}
+
+TEST_F(UsartDmaRx, FullComDropsTheRest) {
+    bool need_yield = false;
+
+    com.room = 3;
+    receive(8);
+    EXPECT_EQ(3, drain(&need_yield));
+    EXPECT_EQ(5U, ring.dropped);
+    EXPECT_EQ(8, ring.tail);
+
+    /* Dropped bytes are gone, later ones come through once there is room */
+    com.room = 0xffff;
+    receive(2);
+    EXPECT_EQ(2, drain(&need_yield));
+    ASSERT_EQ(5U, com.received.size());
+    EXPECT_EQ(expected[0], com.received[0]);
+    EXPECT_EQ(expected[2], com.received[2]);
+    EXPECT_EQ(expected[8], com.received[3]);
+    EXPECT_EQ(expected[9], com.received[4]);
+}
+
+TEST_F(UsartDmaRx, NoCallbackDropsEverything) {
+    bool need_yield = false;
+
+    receive(7);
+    EXPECT_EQ(0, PIOS_USART_RxRing_Drain(&ring, ndtr(), NULL, 0, &need_yield));
+    EXPECT_EQ(7U, ring.dropped);
+    EXPECT_EQ(7, ring.tail);
+    EXPECT_FALSE(need_yield);
+}
+
+TEST_F(UsartDmaRx, YieldIsAccumulated) {
+    bool need_yield = false;
+
+    /* The first chunk wakes a task, the second one must not hide that */
+    receive(12);
+    drain(&need_yield);
+    com.rx_wakes = true;
+    com.room     = 4;
+    receive(10);
+    drain(&need_yield);
+    EXPECT_TRUE(need_yield);
+    EXPECT_EQ(6U, ring.dropped);
+
+    /* Never cleared by a drain that woke nobody */
+    com.rx_wakes = false;
+    receive(1);
+    drain(&need_yield);
+    EXPECT_TRUE(need_yield);
+}
+
+#define TX_SIZE 8
+
+class UsartDmaTx : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        PIOS_USART_DMA_TxInit(&tx, tx_buf, sizeof(tx_buf));
+        com.pending.clear();
+        com.tx_calls = 0;
+        com.tx_wakes = false;
+    }
+
+    void queue(uint16_t len)
+    {
+        for (uint16_t i = 0; i < len; i++) {
+            com.pending.push_back(0x40 + i);
+        }
+    }
+
+    uint16_t next(bool done, bool *need_yield)
+    {
+        return PIOS_USART_DMA_TxNext(&tx, done, fake_tx_out, COM_CONTEXT, need_yield);
+    }
+
+    struct pios_usart_dma_tx tx;
+    uint8_t tx_buf[TX_SIZE];
+};
+
+TEST_F(UsartDmaTx, StartWithNothingQueued) {
+    bool need_yield = false;
+
+    EXPECT_EQ(0, next(false, &need_yield));
+    EXPECT_FALSE(tx.busy);
+    EXPECT_EQ(1, com.tx_calls);
+}
+
+TEST_F(UsartDmaTx, StartSendsQueuedData) {
+    bool need_yield = false;
+
+    queue(5);
+    EXPECT_EQ(5, next(false, &need_yield));
+    EXPECT_TRUE(tx.busy);
+    EXPECT_EQ(0x40, tx_buf[0]);
+    EXPECT_EQ(0x44, tx_buf[4]);
+    EXPECT_EQ(1U, tx.transfers);
+
+    /* Completion with the COM layer drained releases the stream */
+    EXPECT_EQ(0, next(true, &need_yield));
+    EXPECT_FALSE(tx.busy);
+}
+
+TEST_F(UsartDmaTx, StartWhileBusyIsLeftToCompletion) {
+    bool need_yield = false;
+
+    queue(3);
+    EXPECT_EQ(3, next(false, &need_yield));
+
+    /* More data queued while the transfer runs, the buffer must not change */
+    queue(4);
+    tx_buf[0] = 0xaa;
+    EXPECT_EQ(0, next(false, &need_yield));
+    EXPECT_EQ(1, com.tx_calls);
+    EXPECT_EQ(0xaa, tx_buf[0]);
+    EXPECT_TRUE(tx.busy);
+
+    /* Transfer complete picks it up */
+    EXPECT_EQ(4, next(true, &need_yield));
+    EXPECT_TRUE(tx.busy);
+    EXPECT_EQ(2U, tx.transfers);
+}
+
+TEST_F(UsartDmaTx, LargeQueueIsChunked) {
+    bool need_yield = false;
+    uint16_t total  = 0;
+    uint16_t len;
+
+    queue(TX_SIZE * 2 + 3);
+    len = next(false, &need_yield);
+    while (len > 0) {
+        EXPECT_LE(len, TX_SIZE);
+        total += len;
+        len    = next(true, &need_yield);
+    }
+    EXPECT_EQ(TX_SIZE * 2 + 3, total);
+    EXPECT_EQ(3U, tx.transfers);
+    EXPECT_FALSE(tx.busy);
+}
+
+TEST_F(UsartDmaTx, NoCallback) {
+    bool need_yield = false;
+
+    EXPECT_EQ(0, PIOS_USART_DMA_TxNext(&tx, false, NULL, 0, &need_yield));
+    EXPECT_FALSE(tx.busy);
+}
+
+TEST_F(UsartDmaTx, YieldIsReported) {
+    bool need_yield = false;
+
+    com.tx_wakes = true;
+    queue(2);
+    next(false, &need_yield);
+    EXPECT_TRUE(need_yield);
+
+    /* A later call that wakes nobody leaves it alone */
+    com.tx_wakes = false;
+    next(true, &need_yield);
+    EXPECT_TRUE(need_yield);
+}
@@ -0,0 +1,534 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+extern "C" {
+#include "pios.h"
+#include "pios_usb_bulk.h"
+}
+
+#define PACKET_SIZE 64
+#define COM_CONTEXT 0x55534231U
+
+/*
+ * Stand-in for the COM layer: transmit hands out the bytes queued in
+ * `pending`, receive accepts up to `room` bytes.
+ */
+struct fake_com {
+    std::deque<uint8_t>  pending;
+    uint16_t tx_calls;
+
+    std::vector<uint8_t> received;
+    uint16_t room;
+    bool     wakes;
+};
+
+static struct fake_com com;
+
+static uint16_t fake_tx_out(uint32_t context, uint8_t *buf, uint16_t buf_len, uint16_t *headroom, bool *need_yield)
+{
+    EXPECT_EQ(COM_CONTEXT, context);
+    EXPECT_TRUE(headroom == NULL);
+
+    com.tx_calls++;
+    uint16_t n = 0;
+    while (n < buf_len && !com.pending.empty()) {
+        buf[n++] = com.pending.front();
+        com.pending.pop_front();
+    }
+
+    if (n > 0 && com.wakes) {
+        *need_yield = true;
+    }
+    return n;
+}
+
+static uint16_t fake_rx_in(uint32_t context, uint8_t *buf, uint16_t buf_len, uint16_t *headroom, bool *need_yield)
+{
+    EXPECT_EQ(COM_CONTEXT, context);
+
+    uint16_t n = (buf_len < com.room) ? buf_len : com.room;
+    com.received.insert(com.received.end(), buf, buf + n);
+    com.room -= n;
+
+    if (headroom) {
+        *headroom = com.room;
+    }
+    if (n > 0 && com.wakes) {
+        *need_yield = true;
+    }
+    return n;
+}
+
+/*
+ * Simulated IN endpoint and host. A started transfer goes out as packets
+ * of at most PACKET_SIZE bytes, the host collects them and considers a
+ * read complete on the first short packet, like a bulk URB.
+ */
+class UsbBulkTx : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        memset(buf0, 0xee, sizeof(buf0));
+        memset(buf1, 0xee, sizeof(buf1));
+        com.pending.clear();
+        com.tx_calls = 0;
+        com.wakes    = false;
+        host_pending.clear();
+        host_reads.clear();
+        host_packets.clear();
+        in_flight    = false;
+        next_byte    = 0;
+        need_yield   = false;
+    }
+
+    void init(uint16_t buf_size, uint8_t header_len)
+    {
+        PIOS_USB_BulkTx_Init(&tx, buf0, buf1, buf_size, PACKET_SIZE, header_len);
+    }
+
+    void queue(uint16_t len)
+    {
+        for (uint16_t i = 0; i < len; i++) {
+            com.pending.push_back(next_byte++);
+        }
+    }
+
+    /* TxStart in the driver */
+    void start()
+    {
+        call(false);
+    }
+
+    /* Transfer complete interrupt, false when the endpoint was idle */
+    bool complete()
+    {
+        if (!in_flight) {
+            return false;
+        }
+        deliver();
+        call(true);
+        return true;
+    }
+
+    void run()
+    {
+        while (complete()) {
+            ;
+        }
+    }
+
+    void call(bool done)
+    {
+        uint8_t *buf = NULL;
+        uint16_t len = 0xffff;
+
+        if (PIOS_USB_BulkTx_Next(&tx, done, fake_tx_out, COM_CONTEXT, &need_yield, &buf, &len)) {
+            ASSERT_FALSE(in_flight) << "transfer started while one is on the bus";
+            ASSERT_TRUE(buf == buf0 || buf == buf1);
+            ASSERT_LE(len, tx.buf_size);
+            in_flight = true;
+            /* Copy now, the buffer must not change until completion */
+            xfer.assign(buf, buf + len);
+            xfer_buf  = buf;
+        } else {
+            ASSERT_EQ(0xffff, len);
+        }
+    }
+
+    void deliver()
+    {
+        ASSERT_TRUE(std::equal(xfer.begin(), xfer.end(), xfer_buf)) << "buffer changed while on the bus";
+        size_t off = 0;
+        do {
+            size_t n = std::min((size_t)PACKET_SIZE, xfer.size() - off);
+            host_packets.push_back(n);
+            host_pending.insert(host_pending.end(), xfer.begin() + off, xfer.begin() + off + n);
+            off += n;
+            if (n < PACKET_SIZE) {
+                host_reads.push_back(host_pending);
+                host_pending.clear();
+            }
+        } while (off < xfer.size());
+        in_flight = false;
+    }
+
+    std::vector<uint8_t> host_stream()
+    {
+        std::vector<uint8_t> all;
+        for (size_t i = 0; i < host_reads.size(); i++) {
+            all.insert(all.end(), host_reads[i].begin(), host_reads[i].end());
+        }
+        return all;
+    }
+
+    std::vector<uint8_t> sent(size_t from, size_t len)
+    {
+        std::vector<uint8_t> v;
+        for (size_t i = 0; i < len; i++) {
+            v.push_back((uint8_t)(from + i));
+        }
+        return v;
+    }
+
+    struct pios_usb_bulk_tx tx;
+    uint8_t buf0[4 * PACKET_SIZE];
+    uint8_t buf1[4 * PACKET_SIZE];
+
+    bool    in_flight;
+    std::vector<uint8_t> xfer;
+    uint8_t *xfer_buf;
+
+    std::vector<uint8_t> host_pending;
+    std::vector<std::vector<uint8_t> > host_reads;
+    std::vector<size_t>  host_packets;
+
+    uint8_t next_byte;
+    bool    need_yield;
+};
+
+TEST_F(UsbBulkTx, IdleWithoutData) {
+    init(sizeof(buf0), 0);
+
+    start();
+    EXPECT_FALSE(in_flight);
+    EXPECT_FALSE(tx.busy);
+    EXPECT_EQ(0U, tx.transfers);
+}
+
+TEST_F(UsbBulkTx, ShortTransfer) {
+    init(sizeof(buf0), 0);
+
+    queue(10);
+    start();
+    EXPECT_TRUE(in_flight);
+    run();
+
+    ASSERT_EQ(1U, host_reads.size());
+    EXPECT_EQ(sent(0, 10), host_reads[0]);
+    EXPECT_EQ(1U, tx.transfers);
+    EXPECT_EQ(1U, tx.packets);
+    EXPECT_EQ(0U, tx.zlps);
+    EXPECT_FALSE(tx.busy);
+}
+
+TEST_F(UsbBulkTx, ManyPacketsPerTransfer) {
+    init(sizeof(buf0), 0);
+
+    /* 3.5 packets leave in a single transfer from a single COM callback */
+    queue(3 * PACKET_SIZE + 32);
+    start();
+    EXPECT_EQ(2, com.tx_calls); /* The second one found nothing to prefill */
+    run();
+
+    EXPECT_EQ(1U, tx.transfers);
+    EXPECT_EQ(4U, tx.packets);
+    ASSERT_EQ(1U, host_reads.size());
+    EXPECT_EQ(sent(0, 3 * PACKET_SIZE + 32), host_reads[0]);
+}
+
+TEST_F(UsbBulkTx, ExactMultipleEndsWithZlp) {
+    init(sizeof(buf0), 0);
+
+    queue(2 * PACKET_SIZE);
+    start();
+    run();
+
+    EXPECT_EQ(2U, tx.transfers);
+    EXPECT_EQ(1U, tx.zlps);
+    ASSERT_EQ(3U, host_packets.size());
+    EXPECT_EQ(0U, host_packets[2]);
+    ASSERT_EQ(1U, host_reads.size());
+    EXPECT_EQ(sent(0, 2 * PACKET_SIZE), host_reads[0]);
+    EXPECT_FALSE(tx.busy);
+}
+
+TEST_F(UsbBulkTx, NoZlpWhenMoreDataFollows) {
+    init(sizeof(buf0), 0);
+
+    /* Full buffer, then a short one queued while the first is on the bus */
+    queue(sizeof(buf0));
+    start();
+    queue(5);
+    start();
+    run();
+
+    EXPECT_EQ(0U, tx.zlps);
+    EXPECT_EQ(2U, tx.transfers);
+    ASSERT_EQ(1U, host_reads.size());
+    EXPECT_EQ(sent(0, sizeof(buf0) + 5), host_reads[0]);
+}
+
+TEST_F(UsbBulkTx, SpareIsFilledWhileBusy) {
+    init(sizeof(buf0), 0);
+
+    queue(20);
+    start();
+    EXPECT_EQ(0, tx.len[tx.active ^ 1]);
+
+    /* TxStart while the transfer runs only prepares the next one */
+    queue(30);
+    start();
+    EXPECT_EQ(30, tx.len[tx.active ^ 1]);
+    EXPECT_EQ(1U, tx.transfers);
+
+    /* And completion starts it without asking the COM layer first */
+    uint16_t calls = com.tx_calls;
+    complete();
+    EXPECT_TRUE(in_flight);
+    EXPECT_EQ(2U, tx.transfers);
+    EXPECT_EQ(calls + 1, com.tx_calls); /* Only the refill of the spare */
+    run();
+    EXPECT_EQ(sent(0, 50), host_stream());
+}
+
+TEST_F(UsbBulkTx, StreamUnderLoad) {
+    init(sizeof(buf0), 0);
+
+    /* The application keeps writing odd sized chunks while transfers complete */
+    size_t total = 0;
+    for (int i = 0; i < 200; i++) {
+        uint16_t len = (i * 37) % 300;
+        queue(len);
+        total += len;
+        start();
+        if (i % 3) {
+            complete();
+        }
+    }
+    run();
+
+    EXPECT_EQ(sent(0, total), host_stream());
+    EXPECT_TRUE(host_pending.empty()) << "data stuck at the host without a short packet";
+    EXPECT_EQ(total, tx.bytes);
+    EXPECT_FALSE(tx.busy);
+}
+
+TEST_F(UsbBulkTx, ResetDropsQueuedData) {
+    init(sizeof(buf0), 0);
+
+    queue(10);
+    start();
+    queue(10);
+    start();
+    PIOS_USB_BulkTx_Reset(&tx);
+    in_flight = false;
+
+    EXPECT_FALSE(tx.busy);
+    EXPECT_EQ(0, tx.len[0]);
+    EXPECT_EQ(0, tx.len[1]);
+
+    queue(3);
+    start();
+    EXPECT_TRUE(in_flight);
+    EXPECT_EQ(3U, xfer.size());
+}
+
+TEST_F(UsbBulkTx, NoCallback) {
+    uint8_t *buf;
+    uint16_t len;
+
+    init(sizeof(buf0), 0);
+    EXPECT_FALSE(PIOS_USB_BulkTx_Next(&tx, false, NULL, 0, &need_yield, &buf, &len));
+    EXPECT_FALSE(tx.busy);
+}
+
+TEST_F(UsbBulkTx, YieldIsReported) {
+    init(sizeof(buf0), 0);
+
+    com.wakes = true;
+    queue(3);
+    start();
+    EXPECT_TRUE(need_yield);
+
+    /* Never cleared */
+    com.wakes = false;
+    complete();
+    EXPECT_TRUE(need_yield);
+}
+
+TEST_F(UsbBulkTx, ReportsWithLength) {
+    const uint16_t payload = PACKET_SIZE - 2;
+
+    init(sizeof(buf0), 2);
+
+    /* Two and a half reports worth of data in one transfer */
+    queue(2 * payload + 10);
+    start();
+    ASSERT_TRUE(in_flight);
+    ASSERT_EQ(3U * PACKET_SIZE, xfer.size());
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(PIOS_USB_BULK_REPORT_ID, xfer[i * PACKET_SIZE]);
+    }
+    EXPECT_EQ(payload, xfer[1]);
+    EXPECT_EQ(payload, xfer[PACKET_SIZE + 1]);
+    EXPECT_EQ(10, xfer[2 * PACKET_SIZE + 1]);
+    EXPECT_EQ(0, xfer[2]);
+    EXPECT_EQ((uint8_t)payload, xfer[PACKET_SIZE + 2]);
+    EXPECT_EQ((uint8_t)(2 * payload + 9), xfer[2 * PACKET_SIZE + 11]);
+
+    run();
+    EXPECT_EQ(3U, tx.packets);
+    EXPECT_EQ(0U, tx.zlps); /* Reports are never terminated */
+    EXPECT_EQ(2U * payload + 10, tx.bytes);
+}
+
+TEST_F(UsbBulkTx, ReportsStopAtBufferEnd) {
+    const uint16_t payload = PACKET_SIZE - 1;
+
+    init(2 * PACKET_SIZE, 1);
+
+    queue(5 * payload);
+    start();
+    ASSERT_EQ(2U * PACKET_SIZE, xfer.size());
+    EXPECT_EQ(2 * PACKET_SIZE, tx.len[tx.active ^ 1]);
+    EXPECT_EQ((uint8_t)payload, xfer[PACKET_SIZE + 1]); /* No length byte */
+    run();
+    EXPECT_EQ(3U, tx.transfers);
+    EXPECT_EQ(5U, tx.packets);
+    EXPECT_TRUE(com.pending.empty());
+}
+
+class UsbBulkRx : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        memset(buf, 0, sizeof(buf));
+        com.received.clear();
+        com.room   = 1000;
+        com.wakes  = false;
+        need_yield = false;
+    }
+
+    bool packet(const uint8_t *data, uint16_t len)
+    {
+        memcpy(buf, data, std::min((size_t)len, sizeof(buf)));
+        return PIOS_USB_BulkRx_Done(&rx, len, fake_rx_in, COM_CONTEXT, &need_yield);
+    }
+
+    struct pios_usb_bulk_rx rx;
+    uint8_t buf[PACKET_SIZE];
+    bool    need_yield;
+};
+
+TEST_F(UsbBulkRx, StreamPacket) {
+    uint8_t data[PACKET_SIZE];
+
+    for (int i = 0; i < PACKET_SIZE; i++) {
+        data[i] = i;
+    }
+
+    PIOS_USB_BulkRx_Init(&rx, buf, sizeof(buf), 0);
+    EXPECT_EQ(PACKET_SIZE, PIOS_USB_BulkRx_MaxPayload(&rx));
+
+    EXPECT_TRUE(packet(data, 40));
+    ASSERT_EQ(40U, com.received.size());
+    EXPECT_EQ(39, com.received[39]);
+    EXPECT_EQ(40U, rx.bytes);
+    EXPECT_EQ(1U, rx.transfers);
+}
+
+TEST_F(UsbBulkRx, Backpressure) {
+    uint8_t data[PACKET_SIZE] = { 0 };
+
+    PIOS_USB_BulkRx_Init(&rx, buf, sizeof(buf), 0);
+
+    /* Still room for a full packet afterwards */
+    com.room = 2 * PACKET_SIZE;
+    EXPECT_TRUE(packet(data, PACKET_SIZE));
+
+    /* Fits but leaves less than a packet, stop arming */
+    com.room = PACKET_SIZE + 10;
+    EXPECT_FALSE(packet(data, PACKET_SIZE));
+    EXPECT_EQ(0U, rx.dropped);
+
+    /* Does not fit, the rest is dropped */
+    com.room = 10;
+    EXPECT_FALSE(packet(data, PACKET_SIZE));
+    EXPECT_EQ(PACKET_SIZE - 10U, rx.dropped);
+}
+
+TEST_F(UsbBulkRx, NoCallbackDisablesReceiver) {
+    uint8_t data[4] = { 1, 2, 3, 4 };
+
+    PIOS_USB_BulkRx_Init(&rx, buf, sizeof(buf), 0);
+    memcpy(buf, data, sizeof(data));
+    EXPECT_FALSE(PIOS_USB_BulkRx_Done(&rx, sizeof(data), NULL, 0, &need_yield));
+    EXPECT_EQ(0U, rx.transfers);
+}
+
+TEST_F(UsbBulkRx, ReportWithLength) {
+    uint8_t report[PACKET_SIZE] = { PIOS_USB_BULK_REPORT_ID, 3, 0xa1, 0xa2, 0xa3, 0xff };
+
+    PIOS_USB_BulkRx_Init(&rx, buf, sizeof(buf), 2);
+    EXPECT_EQ(PACKET_SIZE - 2, PIOS_USB_BulkRx_MaxPayload(&rx));
+
+    EXPECT_TRUE(packet(report, PACKET_SIZE));
+    ASSERT_EQ(3U, com.received.size());
+    EXPECT_EQ(0xa3, com.received[2]);
+}
+
+TEST_F(UsbBulkRx, BogusReportLengthIsClamped) {
+    uint8_t report[PACKET_SIZE] = { PIOS_USB_BULK_REPORT_ID, 0xff };
+
+    PIOS_USB_BulkRx_Init(&rx, buf, sizeof(buf), 2);
+
+    packet(report, PACKET_SIZE);
+    EXPECT_EQ(PACKET_SIZE - 2U, com.received.size());
+    EXPECT_EQ(1U, rx.oversize);
+
+    /* Length byte beyond a short report */
+    com.received.clear();
+    report[1] = 20;
+    packet(report, 12);
+    EXPECT_EQ(10U, com.received.size());
+    EXPECT_EQ(2U, rx.oversize);
+}
+
+TEST_F(UsbBulkRx, ReportWithoutLength) {
+    uint8_t report[PACKET_SIZE] = { PIOS_USB_BULK_REPORT_ID, 0x11, 0x22 };
+
+    PIOS_USB_BulkRx_Init(&rx, buf, sizeof(buf), 1);
+
+    packet(report, PACKET_SIZE);
+    ASSERT_EQ(PACKET_SIZE - 1U, com.received.size());
+    EXPECT_EQ(0x11, com.received[0]);
+    EXPECT_EQ(0x22, com.received[1]);
+}
+
+TEST_F(UsbBulkRx, Stats) {
+    struct pios_usb_bulk_stats stats;
+    struct pios_usb_bulk_tx tx;
+    uint8_t tx_buf[2][PACKET_SIZE];
+    uint8_t data[8] = { 0 };
+    uint8_t *xfer;
+    uint16_t len;
+
+    PIOS_USB_BulkRx_Init(&rx, buf, sizeof(buf), 0);
+    PIOS_USB_BulkTx_Init(&tx, tx_buf[0], tx_buf[1], PACKET_SIZE, PACKET_SIZE, 0);
+
+    com.room = 5;
+    packet(data, sizeof(data));
+    com.pending.assign(PACKET_SIZE, 0x5a);
+    ASSERT_TRUE(PIOS_USB_BulkTx_Next(&tx, false, fake_tx_out, COM_CONTEXT, &need_yield, &xfer, &len));
+    ASSERT_TRUE(PIOS_USB_BulkTx_Next(&tx, true, fake_tx_out, COM_CONTEXT, &need_yield, &xfer, &len));
+    EXPECT_EQ(0, len);
+
+    PIOS_USB_Bulk_GetStats(&tx, &rx, &stats);
+    EXPECT_EQ((uint32_t)PACKET_SIZE, stats.tx_bytes);
+    EXPECT_EQ(2U, stats.tx_transfers);
+    EXPECT_EQ(2U, stats.tx_packets);
+    EXPECT_EQ(1U, stats.tx_zlps);
+    EXPECT_EQ(5U, stats.rx_bytes);
+    EXPECT_EQ(1U, stats.rx_transfers);
+    EXPECT_EQ(3U, stats.rx_dropped);
+    EXPECT_EQ(0U, stats.rx_oversize);
+
+    PIOS_USB_Bulk_GetStats(NULL, &rx, &stats);
+    EXPECT_EQ(0U, stats.tx_bytes);
+}
@@ -0,0 +1,203 @@
+#include "gtest/gtest.h"
+
+#include <stdio.h> /* printf */
+#include <stdlib.h> /* abort */
+#include <string.h> /* memset */
+#include <algorithm>
+#include <vector>
+
+extern "C" {
+#include "pios.h"
+#include "pios_ws2811_stream.h"
+}
+
+#define PIN_MASK 0x2000
+
+/*
+ * The framebuffer expansion the driver used before it streamed: every bit
+ * of every led written up front, G, R, B, most significant bit first.
+ */
+static void legacy_setColor(uint8_t color, ledbuf_t *buf)
+{
+    uint8_t i;
+
+    for (i = 0; i < 8; i++) {
+        buf[i] = ((color << i) & 0b10000000 ? 0x0 : PIN_MASK);
+    }
+}
+
+static std::vector<ledbuf_t> legacy_framebuffer(const std::vector<uint8_t> & grb)
+{
+    uint16_t numleds = grb.size() / 3;
+    std::vector<ledbuf_t> fb(numleds * 24);
+
+    for (uint16_t led = 0; led < numleds; led++) {
+        legacy_setColor(grb[led * 3 + 0], &fb[led * 24]);
+        legacy_setColor(grb[led * 3 + 1], &fb[led * 24 + 8]);
+        legacy_setColor(grb[led * 3 + 2], &fb[led * 24 + 16]);
+    }
+    return fb;
+}
+
+/*
+ * Circular DMA stream over the two halves: one word per timer period goes
+ * to the wire, the half and full transfer interrupts call into the encoder
+ * and the timer stops when it says so. `leak` words more are sent after the
+ * stop, for the interrupt latency.
+ */
+class WS2811Stream : public testing::Test {
+protected:
+    virtual void SetUp()
+    {
+        grb.clear();
+        wire.clear();
+        interrupts = 0;
+    }
+
+    void strip(uint16_t numleds, uint32_t seed)
+    {
+        grb.resize(numleds * 3);
+        for (size_t i = 0; i < grb.size(); i++) {
+            seed   = seed * 1103515245 + 12345;
+            grb[i] = seed >> 16;
+        }
+    }
+
+    void send(uint8_t half_leds, uint16_t leak = 0)
+    {
+        uint16_t half_words = half_leds * PIOS_WS2811_BITS_PER_LED;
+
+        buf.assign(2 * half_words, 0xdead);
+        PIOS_WS2811_Stream_Init(&stream, grb.empty() ? dummy : &grb[0], grb.size() / 3, &buf[0], half_leds, PIN_MASK);
+        send_again(leak);
+    }
+
+    void send_again(uint16_t leak = 0)
+    {
+        uint16_t half_words = stream.half_leds * PIOS_WS2811_BITS_PER_LED;
+
+        wire.clear();
+        if (!PIOS_WS2811_Stream_Start(&stream)) {
+            return;
+        }
+
+        size_t pos = 0;
+        bool running = true;
+        while (running) {
+            ASSERT_LT(interrupts, 100000U) << "stream never stopped";
+            wire.push_back(buf[pos]);
+            pos = (pos + 1) % buf.size();
+            if (pos % half_words == 0) {
+                interrupts++;
+                running = PIOS_WS2811_Stream_HalfDone(&stream);
+            }
+        }
+        for (uint16_t i = 0; i < leak; i++) {
+            wire.push_back(buf[pos]);
+            pos = (pos + 1) % buf.size();
+        }
+    }
+
+    std::vector<uint8_t>  grb;
+    std::vector<ledbuf_t> buf;
+    std::vector<ledbuf_t> wire;
+    struct pios_ws2811_stream stream;
+    uint8_t  dummy[1];
+    uint32_t interrupts;
+};
+
+TEST_F(WS2811Stream, EncodeByteMatchesLegacy) {
+    ledbuf_t legacy[8];
+    ledbuf_t encoded[8];
+
+    for (int value = 0; value < 256; value++) {
+        legacy_setColor(value, legacy);
+        PIOS_WS2811_EncodeByte(encoded, value, PIN_MASK);
+        ASSERT_EQ(0, memcmp(legacy, encoded, sizeof(legacy))) << "value " << value;
+    }
+}
+
+TEST_F(WS2811Stream, EmptyStripSendsNothing) {
+    send(2);
+    EXPECT_TRUE(wire.empty());
+    EXPECT_EQ(0U, interrupts);
+}
+
+TEST_F(WS2811Stream, SingleLed) {
+    strip(1, 1);
+    send(1);
+
+    EXPECT_EQ(legacy_framebuffer(grb), wire);
+    EXPECT_EQ(1U, interrupts);
+}
+
+TEST_F(WS2811Stream, StripFitsTheBuffer) {
+    strip(4, 2);
+    send(2);
+
+    EXPECT_EQ(legacy_framebuffer(grb), wire);
+    EXPECT_EQ(2U, interrupts);
+}
+
+TEST_F(WS2811Stream, LongStripMatchesLegacy) {
+    /* Many laps around the buffer with every half refilled in the interrupt */
+    for (uint8_t half_leds = 1; half_leds <= 4; half_leds++) {
+        SetUp();
+        strip(96, half_leds);
+        send(half_leds);
+
+        std::vector<ledbuf_t> expected = legacy_framebuffer(grb);
+        ASSERT_EQ(expected.size(), wire.size()) << "half_leds " << (int)half_leds;
+        EXPECT_EQ(expected, wire) << "half_leds " << (int)half_leds;
+        EXPECT_EQ(96U / half_leds, interrupts);
+    }
+}
+
+TEST_F(WS2811Stream, PartialLastHalfIsPadded) {
+    strip(7, 3);
+    send(3);
+
+    /* Seven leds, then two more worth of zero bits to complete the half */
+    std::vector<ledbuf_t> expected = legacy_framebuffer(grb);
+    ASSERT_EQ(9U * 24, wire.size());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), wire.begin()));
+    for (size_t i = expected.size(); i < wire.size(); i++) {
+        EXPECT_EQ(PIN_MASK, wire[i]);
+    }
+}
+
+TEST_F(WS2811Stream, LeakAfterStopIsZeroBits) {
+    /* Interrupt latency lets the stream run on into the next half */
+    for (uint16_t numleds = 1; numleds <= 6; numleds++) {
+        SetUp();
+        strip(numleds, numleds);
+        send(2, 8);
+
+        size_t sent = wire.size() - 8;
+        for (size_t i = sent; i < wire.size(); i++) {
+            EXPECT_EQ(PIN_MASK, wire[i]) << numleds << " leds, word " << i;
+        }
+    }
+}
+
+TEST_F(WS2811Stream, UpdateAfterColorChange) {
+    strip(10, 4);
+    send(2, 5);
+    EXPECT_EQ(legacy_framebuffer(grb), std::vector<ledbuf_t>(wire.begin(), wire.end() - 5));
+
+    /* The next update starts over from the first led and the first half */
+    grb[0]  = 0xff;
+    grb[29] = 0x00;
+    send_again();
+    EXPECT_EQ(legacy_framebuffer(grb), wire);
+}
+
+TEST_F(WS2811Stream, SpuriousInterruptAfterStop) {
+    strip(3, 5);
+    send(2);
+
+    /* A late flag must not restart or refill anything */
+    std::vector<ledbuf_t> before = buf;
+    EXPECT_FALSE(PIOS_WS2811_Stream_HalfDone(&stream));
+    EXPECT_EQ(before, buf);
+}
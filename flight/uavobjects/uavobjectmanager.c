@@ -553,6 +553,21 @@ unlock_exit:
  * \return 0 if success or -1 if failure
  */
 int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut)
+{
+    return UAVObjPackSplit(obj_handle, instId, dataOut, UINT16_MAX, NULL);
+}
+
+/**
+ * Pack an object to a byte array that is split in two, such as the room
+ * left at the end of a ring buffer and its start
+ * \param[in] obj The object handle
+ * \param[in] instId The instance ID
+ * \param[out] dataOut The first part of the byte array
+ * \param[in] length The length of the first part
+ * \param[out] dataOutNext The second part, for what does not fit in the first
+ * \return 0 if success or -1 if failure
+ */
+int32_t UAVObjPackSplit(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut, uint16_t length, uint8_t *dataOutNext)
 {
     PIOS_Assert(obj_handle);
 
@@ -560,12 +575,15 @@ int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut)
     xSemaphoreTakeRecursive(mutex, portMAX_DELAY);
 
     int32_t rc = -1;
+    const uint8_t *data;
+    uint16_t size;
 
     if (UAVObjIsMetaobject(obj_handle)) {
         if (instId != 0) {
             goto unlock_exit;
         }
-        memcpy(dataOut, MetaDataPtr((struct UAVOMeta *)obj_handle), MetaNumBytes);
+        data = (const uint8_t *)MetaDataPtr((struct UAVOMeta *)obj_handle);
+        size = MetaNumBytes;
     } else {
         struct UAVOData *obj;
         InstanceHandle instEntry;
@@ -578,8 +596,17 @@ int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t *dataOut)
         if (instEntry == NULL) {
             goto unlock_exit;
         }
-        // Pack data
-        memcpy(dataOut, InstanceData(instEntry), obj->instance_size);
+        data = (const uint8_t *)InstanceData(instEntry);
+        size = obj->instance_size;
+    }
+
+    // Pack data
+    if (size > length) {
+        PIOS_Assert(dataOutNext);
+        memcpy(dataOut, data, length);
+        memcpy(dataOutNext, data + length, size - length);
+    } else {
+        memcpy(dataOut, data, size);
     }
 
     rc = 0;
@@ -32,6 +32,11 @@
 // Public types
 typedef int32_t (*UAVTalkOutputStream)(uint8_t *data, int32_t length);
 
+// Output straight into the buffer of a port, see UAVTalkSetOutputBuffer()
+struct pios_com_span;
+typedef int32_t (*UAVTalkOutputReserve)(uint16_t length, struct pios_com_span *span);
+typedef int32_t (*UAVTalkOutputCommit)(uint16_t length);
+
 typedef struct {
     uint32_t txBytes;
     uint32_t txObjectBytes;
@@ -48,15 +53,20 @@ typedef struct {
 
 typedef void *UAVTalkConnection;
 
+// Largest payload of a stream packet, see UAVTalkSendStream()
+#define UAVTALK_MAX_STREAM_LENGTH 1024
+
 typedef enum { UAVTALK_STATE_ERROR = 0, UAVTALK_STATE_SYNC, UAVTALK_STATE_TYPE, UAVTALK_STATE_SIZE, UAVTALK_STATE_OBJID, UAVTALK_STATE_INSTID, UAVTALK_STATE_TIMESTAMP, UAVTALK_STATE_DATA, UAVTALK_STATE_CS, UAVTALK_STATE_COMPLETE } UAVTalkRxState;
 
 // Public functions
 UAVTalkConnection UAVTalkInitialize(UAVTalkOutputStream outputStream);
 int32_t UAVTalkSetOutputStream(UAVTalkConnection connection, UAVTalkOutputStream outputStream);
 UAVTalkOutputStream UAVTalkGetOutputStream(UAVTalkConnection connection);
+int32_t UAVTalkSetOutputBuffer(UAVTalkConnection connection, UAVTalkOutputReserve reserve, UAVTalkOutputCommit commit);
 int32_t UAVTalkSendObject(UAVTalkConnection connection, UAVObjHandle obj, uint16_t instId, uint8_t acked, int32_t timeoutMs);
 int32_t UAVTalkSendObjectTimestamped(UAVTalkConnection connectionHandle, UAVObjHandle obj, uint16_t instId, uint8_t acked, int32_t timeoutMs);
 int32_t UAVTalkSendObjectRequest(UAVTalkConnection connection, UAVObjHandle obj, uint16_t instId, int32_t timeoutMs);
+int32_t UAVTalkSendStream(UAVTalkConnection connectionHandle, uint32_t objId, uint16_t instId, const uint8_t *data, uint16_t length);
 UAVTalkRxState UAVTalkProcessInputStream(UAVTalkConnection connection, uint8_t rxbyte);
 UAVTalkRxState UAVTalkProcessInputStreamQuiet(UAVTalkConnection connection, uint8_t rxbyte);
 int32_t UAVTalkRelayPacket(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle);
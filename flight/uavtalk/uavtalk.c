@@ -53,6 +53,7 @@ static int32_t sendObject(UAVTalkConnectionData *connection, uint8_t type, uint3
 static int32_t sendSingleObject(UAVTalkConnectionData *connection, uint8_t type, uint32_t objId, uint16_t instId, UAVObjHandle obj);
 static int32_t receiveObject(UAVTalkConnectionData *connection, uint8_t type, uint32_t objId, uint16_t instId, uint8_t *data);
 static void updateAck(UAVTalkConnectionData *connection, uint8_t type, uint32_t objId, uint16_t instId);
+static int32_t writePacket(UAVTalkConnectionData *connection, const uint8_t *header, uint16_t headerLength, UAVObjHandle obj, uint16_t instId, const uint8_t *data, uint16_t length, const uint8_t *cs);
 
 /**
  * Initialize the UAVTalk library
@@ -73,6 +74,8 @@ UAVTalkConnection UAVTalkInitialize(UAVTalkOutputStream outputStream)
     connection->iproc.rxPacketLength = 0;
     connection->iproc.state = UAVTALK_STATE_SYNC;
     connection->outStream   = outputStream;
+    connection->outReserve  = NULL;
+    connection->outCommit   = NULL;
     connection->lock = xSemaphoreCreateRecursiveMutex();
     connection->transLock   = xSemaphoreCreateRecursiveMutex();
     // allocate buffers
@@ -115,6 +118,37 @@ int32_t UAVTalkSetOutputStream(UAVTalkConnection connectionHandle, UAVTalkOutput
     return 0;
 }
 
+/**
+ * Set the buffer the connection writes its packets into, instead of handing
+ * them to the output stream. reserve returns 0 once the room is in span, -1
+ * when the packet has to go through the output stream after all (it is too
+ * long, or the port is down), and any other negative value when it can not
+ * be sent now.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] reserve Function pointer that is called for room in the buffer
+ * \param[in] commit Function pointer that is called to send what was written there
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t UAVTalkSetOutputBuffer(UAVTalkConnection connectionHandle, UAVTalkOutputReserve reserve, UAVTalkOutputCommit commit)
+{
+    UAVTalkConnectionData *connection;
+
+    CHECKCONHANDLE(connectionHandle, connection, return -1);
+
+    // Lock
+    xSemaphoreTakeRecursive(connection->lock, portMAX_DELAY);
+
+    // set output buffer
+    connection->outReserve = reserve;
+    connection->outCommit  = commit;
+
+    // Release lock
+    xSemaphoreGiveRecursive(connection->lock);
+
+    return 0;
+}
+
 /**
  * Get current output stream
  * \param[in] connection UAVTalkConnection to be used
@@ -289,6 +323,88 @@ int32_t UAVTalkSendObjectTimestamped(UAVTalkConnection connectionHandle, UAVObjH
     }
 }
 
+/**
+ * Send a block of data that is not an object through the telemetry link,
+ * without ack. Used for bulk transfers, the objId tells the receiver what
+ * the data is.
+ * The data can be larger than any object, so it is not copied to the
+ * transmit buffer but written out between the header and the checksum.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] objId The object ID the data belongs to
+ * \param[in] instId The instance ID
+ * \param[in] data The data to send
+ * \param[in] length Length of the data, at most UAVTALK_MAX_STREAM_LENGTH
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t UAVTalkSendStream(UAVTalkConnection connectionHandle, uint32_t objId, uint16_t instId, const uint8_t *data, uint16_t length)
+{
+    UAVTalkConnectionData *connection;
+    uint8_t header[UAVTALK_MIN_HEADER_LENGTH];
+    uint8_t cs;
+    int32_t rc;
+    int32_t sent = 0;
+
+    CHECKCONHANDLE(connectionHandle, connection, return -1);
+
+    if (length > UAVTALK_MAX_STREAM_LENGTH) {
+        connection->stats.txErrors++;
+        return -1;
+    }
+
+    header[0] = UAVTALK_SYNC_VAL;
+    header[1] = UAVTALK_TYPE_STREAM;
+    header[2] = (uint8_t)((UAVTALK_MIN_HEADER_LENGTH + length) & 0xFF);
+    header[3] = (uint8_t)(((UAVTALK_MIN_HEADER_LENGTH + length) >> 8) & 0xFF);
+    header[4] = (uint8_t)(objId & 0xFF);
+    header[5] = (uint8_t)((objId >> 8) & 0xFF);
+    header[6] = (uint8_t)((objId >> 16) & 0xFF);
+    header[7] = (uint8_t)((objId >> 24) & 0xFF);
+    header[8] = (uint8_t)(instId & 0xFF);
+    header[9] = (uint8_t)((instId >> 8) & 0xFF);
+
+    cs = PIOS_CRC_updateCRC(0, header, UAVTALK_MIN_HEADER_LENGTH);
+    cs = PIOS_CRC_updateCRC(cs, data, length);
+
+    xSemaphoreTakeRecursive(connection->lock, portMAX_DELAY);
+    if (!connection->outStream) {
+        connection->stats.txErrors++;
+        xSemaphoreGiveRecursive(connection->lock);
+        return -1;
+    }
+
+    rc = writePacket(connection, header, UAVTALK_MIN_HEADER_LENGTH, NULL, 0, data, length, &cs);
+    if (rc == 0) {
+        // The three parts go out back to back under the lock, so that no other
+        // packet of this connection can come in between
+        rc = (*connection->outStream)(header, UAVTALK_MIN_HEADER_LENGTH);
+        if (rc == UAVTALK_MIN_HEADER_LENGTH) {
+            sent += rc;
+            rc    = (length > 0) ? (*connection->outStream)((uint8_t *)data, length) : 0;
+            if (rc == length) {
+                sent += rc;
+                rc    = (*connection->outStream)(&cs, UAVTALK_CHECKSUM_LENGTH);
+            }
+        }
+    }
+    if (rc > 0) {
+        sent += rc;
+    }
+
+    if (sent == UAVTALK_MIN_HEADER_LENGTH + length + UAVTALK_CHECKSUM_LENGTH) {
+        ++connection->stats.txObjects;
+        connection->stats.txObjectBytes += length;
+        connection->stats.txBytes += sent;
+        xSemaphoreGiveRecursive(connection->lock);
+        return 0;
+    }
+
+    connection->stats.txErrors++;
+    connection->stats.txBytes += sent;
+    xSemaphoreGiveRecursive(connection->lock);
+    return -1;
+}
+
 /**
  * Execute the requested transaction on an object.
  * \param[in] connection UAVTalkConnection to be used
@@ -647,20 +763,24 @@ int32_t UAVTalkRelayPacket(UAVTalkConnection inConnectionHandle, UAVTalkConnecti
         headerLength += 2;
     }
 
-    // Copy data (if any)
-    if (inIproc->length > 0) {
-        memcpy(&outConnection->txBuffer[headerLength], inConnection->rxBuffer, inIproc->length);
-    }
-
     // Store the packet length
     outConnection->txBuffer[2] = (uint8_t)((headerLength + inIproc->length) & 0xFF);
     outConnection->txBuffer[3] = (uint8_t)(((headerLength + inIproc->length) >> 8) & 0xFF);
 
-    // Copy the checksum
-    outConnection->txBuffer[headerLength + inIproc->length] = inIproc->cs;
+    // Copy the data straight into the output buffer if there is one
+    int32_t rc = writePacket(outConnection, outConnection->txBuffer, headerLength, NULL, 0, inConnection->rxBuffer, inIproc->length, &inIproc->cs);
+    if (rc == 0) {
+        // Copy data (if any)
+        if (inIproc->length > 0) {
+            memcpy(&outConnection->txBuffer[headerLength], inConnection->rxBuffer, inIproc->length);
+        }
 
-    // Send the buffer.
-    int32_t rc = (*outConnection->outStream)(outConnection->txBuffer, headerLength + inIproc->length + UAVTALK_CHECKSUM_LENGTH);
+        // Copy the checksum
+        outConnection->txBuffer[headerLength + inIproc->length] = inIproc->cs;
+
+        // Send the buffer.
+        rc = (*outConnection->outStream)(outConnection->txBuffer, headerLength + inIproc->length + UAVTALK_CHECKSUM_LENGTH);
+    }
 
     // Update stats
     outConnection->stats.txBytes += (rc > 0) ? rc : 0;
@@ -965,24 +1085,28 @@ static int32_t sendSingleObject(UAVTalkConnectionData *connection, uint8_t type,
         return -1;
     }
 
-    // Copy data (if any)
-    if (length > 0) {
-        if (UAVObjPack(obj, instId, &connection->txBuffer[headerLength]) == -1) {
-            connection->stats.txErrors++;
-            return -1;
-        }
-    }
-
     // Store the packet length
     connection->txBuffer[2] = (uint8_t)((headerLength + length) & 0xFF);
     connection->txBuffer[3] = (uint8_t)(((headerLength + length) >> 8) & 0xFF);
 
-    // Calculate and store checksum
-    connection->txBuffer[headerLength + length] = PIOS_CRC_updateCRC(0, connection->txBuffer, headerLength + length);
-
-    // Send object
+    // Pack the object straight into the output buffer if there is one
     uint16_t tx_msg_len = headerLength + length + UAVTALK_CHECKSUM_LENGTH;
-    int32_t rc = (*connection->outStream)(connection->txBuffer, tx_msg_len);
+    int32_t rc = writePacket(connection, connection->txBuffer, headerLength, obj, instId, NULL, length, NULL);
+    if (rc == 0) {
+        // Copy data (if any)
+        if (length > 0) {
+            if (UAVObjPack(obj, instId, &connection->txBuffer[headerLength]) == -1) {
+                connection->stats.txErrors++;
+                return -1;
+            }
+        }
+
+        // Calculate and store checksum
+        connection->txBuffer[headerLength + length] = PIOS_CRC_updateCRC(0, connection->txBuffer, headerLength + length);
+
+        // Send object
+        rc = (*connection->outStream)(connection->txBuffer, tx_msg_len);
+    }
 
     // Update stats
     if (rc == tx_msg_len) {
@@ -1000,6 +1124,99 @@ static int32_t sendSingleObject(UAVTalkConnectionData *connection, uint8_t type,
     return 0;
 }
 
+#if defined(PIOS_INCLUDE_COM)
+/**
+ * Copy into the room from the output buffer, which may wrap around
+ */
+static void spanWrite(const struct pios_com_span *span, uint16_t offset, const uint8_t *data, uint16_t length)
+{
+    if (offset < span->first_len) {
+        uint16_t n = span->first_len - offset;
+        if (n > length) {
+            n = length;
+        }
+        memcpy(span->first + offset, data, n);
+        offset += n;
+        data   += n;
+        length -= n;
+    }
+    if (length > 0) {
+        memcpy(span->second + (offset - span->first_len), data, length);
+    }
+}
+
+/**
+ * Write a packet into the output buffer of the connection: the header, the
+ * payload packed from obj or copied from data, and the checksum, which is
+ * computed over what was written unless cs is given. This way the payload is
+ * copied once, from where it is to where the port sends it from.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] header The header, with the packet length filled in
+ * \param[in] headerLength Length of the header
+ * \param[in] obj Object to pack the payload from, or NULL to copy it from data
+ * \param[in] instId The instance ID
+ * \param[in] data The payload when obj is NULL
+ * \param[in] length Length of the payload
+ * \param[in] cs The checksum of the packet, or NULL to compute it
+ * \return the number of bytes sent
+ * \return 0 when there is no output buffer, the packet has to go through the output stream
+ * \return <0 Failure
+ */
+static int32_t writePacket(UAVTalkConnectionData *connection, const uint8_t *header, uint16_t headerLength, UAVObjHandle obj, uint16_t instId, const uint8_t *data, uint16_t length, const uint8_t *cs)
+{
+    struct pios_com_span span;
+    uint16_t packetLength = headerLength + length + UAVTALK_CHECKSUM_LENGTH;
+
+    if (!connection->outReserve || !connection->outCommit) {
+        return 0;
+    }
+
+    int32_t rc = (*connection->outReserve)(packetLength, &span);
+    if (rc == -1) {
+        return 0;
+    } else if (rc < 0) {
+        return rc;
+    }
+
+    spanWrite(&span, 0, header, headerLength);
+    if (obj && length > 0) {
+        if (headerLength >= span.first_len) {
+            rc = UAVObjPack(obj, instId, span.second + (headerLength - span.first_len));
+        } else {
+            rc = UAVObjPackSplit(obj, instId, span.first + headerLength, span.first_len - headerLength, span.second);
+        }
+        if (rc != 0) {
+            (*connection->outCommit)(0);
+            return -1;
+        }
+    } else if (length > 0) {
+        spanWrite(&span, headerLength, data, length);
+    }
+
+    uint8_t crc;
+    if (cs) {
+        crc = *cs;
+    } else if (headerLength + length <= span.first_len) {
+        crc = PIOS_CRC_updateCRC(0, span.first, headerLength + length);
+    } else {
+        crc = PIOS_CRC_updateCRC(0, span.first, span.first_len);
+        crc = PIOS_CRC_updateCRC(crc, span.second, headerLength + length - span.first_len);
+    }
+    spanWrite(&span, headerLength + length, &crc, UAVTALK_CHECKSUM_LENGTH);
+
+    return (*connection->outCommit)(packetLength);
+}
+#else /* if defined(PIOS_INCLUDE_COM) */
+/**
+ * Without COM ports there is no output buffer, packets go through the
+ * output stream
+ */
+static int32_t writePacket(__attribute__((unused)) UAVTalkConnectionData *connection, __attribute__((unused)) const uint8_t *header, __attribute__((unused)) uint16_t headerLength, __attribute__((unused)) UAVObjHandle obj, __attribute__((unused)) uint16_t instId, __attribute__((unused)) const uint8_t *data, __attribute__((unused)) uint16_t length, __attribute__((unused)) const uint8_t *cs)
+{
+    return 0;
+}
+#endif /* if defined(PIOS_INCLUDE_COM) */
+
 /**
  * @}
  * @}
@@ -21,6 +21,7 @@ HEADERS += opmaps.h \
     size.h \
     maptype.h \
     pureimagecache.h \
+    mbtilesprogress.h \
     pureimage.h \
     rawtile.h \
     memorycache.h \
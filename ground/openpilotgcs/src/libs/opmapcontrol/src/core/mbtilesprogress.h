@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ *
+ * @file       mbtilesprogress.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
+ * @brief      Progress and cancellation of an MBTiles import or export
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef MBTILESPROGRESS_H
+#define MBTILESPROGRESS_H
+
+#include <QObject>
+#include <QAtomicInt>
+
+namespace core {
+/**
+ * @brief Reports the progress of PureImageCache::ImportMBTiles and
+ *       PureImageCache::ExportMBTiles, once per committed batch
+ *
+ * The transfer runs in the calling thread, Cancel() may be called from any
+ * thread and stops it after the current batch.
+ */
+class MBTilesProgress : public QObject {
+    Q_OBJECT
+public:
+    MBTilesProgress(QObject *parent = 0) : QObject(parent), cancelled(0)
+    {}
+    bool IsCancelled() const
+    {
+        return cancelled.load() != 0;
+    }
+    void Report(int const & done, int const & total)
+    {
+        emit progressChanged(done, total);
+    }
+public slots:
+    void Cancel()
+    {
+        cancelled.store(1);
+    }
+signals:
+    /**
+     * @brief Tiles processed so far, imported, exported or already there
+     *
+     * @param done tiles processed
+     * @param total tiles to process
+     */
+    void progressChanged(int done, int total);
+private:
+    QAtomicInt cancelled;
+};
+}
+#endif // MBTILESPROGRESS_H
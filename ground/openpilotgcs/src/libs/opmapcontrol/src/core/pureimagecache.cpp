@@ -27,10 +27,15 @@
 #include "pureimagecache.h"
 #include <QDateTime>
 #include <QSettings>
+#include <QRect>
+#include <QtCore/qmath.h>
 // #define DEBUG_PUREIMAGECACHE
 namespace core {
 qlonglong PureImageCache::ConnCounter = 0;
 
+// Tiles are looked up by position, caches created before the index get it on the first import
+static const char *const TilesIndex = "CREATE INDEX IF NOT EXISTS TilesPosition ON Tiles (X, Y, Zoom, Type)";
+
 PureImageCache::PureImageCache()
 {}
 
@@ -101,6 +106,14 @@ bool PureImageCache::CreateEmptyDB(const QString &file)
     if (query.numRowsAffected() == -1) {
 #ifdef DEBUG_PUREIMAGECACHE
         qDebug() << "CreateEmptyDB: " << query.lastError().driverText();
+#endif // DEBUG_PUREIMAGECACHE
+        db.close();
+        return false;
+    }
+    query.exec(TilesIndex);
+    if (query.numRowsAffected() == -1) {
+#ifdef DEBUG_PUREIMAGECACHE
+        qDebug() << "CreateEmptyDB: " << query.lastError().driverText();
 #endif // DEBUG_PUREIMAGECACHE
         db.close();
         return false;
@@ -328,4 +341,261 @@ bool PureImageCache::ExportMapDataToDB(QString sourceFile, QString destFile)
     QSqlDatabase::removeDatabase("cb");
     return true;
 }
+
+int PureImageCache::ImportMBTiles(QString const & file, MapType::Types const & type, MBTilesProgress *progress)
+{
+    if (gtilecache.isEmpty() || !QFileInfo(file).exists()) {
+        return -1;
+    }
+    // a read lock like PutImageToCache, the tile loaders keep running between batches
+    lock.lockForRead();
+    Mcounter.lock();
+    QString sourceConn = QString::number(++ConnCounter);
+    QString cacheConn  = QString::number(++ConnCounter);
+    Mcounter.unlock();
+
+    int imported = -1;
+    {
+        QSqlDatabase source = QSqlDatabase::addDatabase("QSQLITE", sourceConn);
+        source.setDatabaseName(file);
+        source.setConnectOptions("QSQLITE_OPEN_READONLY");
+        QSqlDatabase cn     = QSqlDatabase::addDatabase("QSQLITE", cacheConn);
+        cn.setDatabaseName(gtilecache + "Data.qmdb");
+        cn.setConnectOptions("QSQLITE_BUSY_TIMEOUT=5000");
+        if (source.open() && cn.open()) {
+            int total = 0;
+            int done  = 0;
+            {
+                QSqlQuery query(source);
+                if (query.exec("SELECT COUNT(*) FROM tiles") && query.next()) {
+                    total = query.value(0).toInt();
+                }
+            }
+            {
+                QSqlQuery query(cn);
+                query.exec(TilesIndex);
+            }
+            QSqlQuery tiles(source);
+            tiles.setForwardOnly(true);
+            if (tiles.exec("SELECT zoom_level, tile_column, tile_row, tile_data FROM tiles")) {
+                QSqlQuery find(cn);
+                find.prepare("SELECT id FROM Tiles WHERE X=? AND Y=? AND Zoom=? AND Type=?");
+                QSqlQuery insertTile(cn);
+                insertTile.prepare("INSERT INTO Tiles(X, Y, Zoom, Type, Date) VALUES(?, ?, ?, ?, ?)");
+                QSqlQuery insertData(cn);
+                insertData.prepare("INSERT INTO TilesData(id, Tile) VALUES(?, ?)");
+                QString date = QDateTime::currentDateTime().toString();
+
+                imported = 0;
+                cn.transaction();
+                while (tiles.next()) {
+                    int zoom = tiles.value(0).toInt();
+                    int x    = tiles.value(1).toInt();
+                    int row  = tiles.value(2).toInt();
+
+                    if (zoom >= 0 && zoom < 31 && x >= 0 && row >= 0 && row < (1 << zoom)) {
+                        // MBTiles rows count from the bottom of the map (TMS), ours from the top
+                        int y = (1 << zoom) - 1 - row;
+                        find.addBindValue(x);
+                        find.addBindValue(y);
+                        find.addBindValue(zoom);
+                        find.addBindValue((int)type);
+                        bool exists = find.exec() && find.next();
+                        find.finish();
+
+                        if (!exists) {
+                            insertTile.addBindValue(x);
+                            insertTile.addBindValue(y);
+                            insertTile.addBindValue(zoom);
+                            insertTile.addBindValue((int)type);
+                            insertTile.addBindValue(date);
+                            bool ok = insertTile.exec();
+                            if (ok) {
+                                insertData.addBindValue(insertTile.lastInsertId());
+                                insertData.addBindValue(tiles.value(3).toByteArray());
+                                ok = insertData.exec();
+                            }
+                            if (!ok) {
+#ifdef DEBUG_PUREIMAGECACHE
+                                qDebug() << "ImportMBTiles: " << cn.lastError().driverText();
+#endif // DEBUG_PUREIMAGECACHE
+                                cn.rollback();
+                                imported = -1;
+                                break;
+                            }
+                            ++imported;
+                        }
+                    }
+                    if (++done % MBTilesBatch == 0) {
+                        cn.commit();
+                        cn.transaction();
+                        if (progress) {
+                            progress->Report(done, total);
+                            if (progress->IsCancelled()) {
+                                break;
+                            }
+                        }
+                    }
+                }
+                if (imported >= 0) {
+                    cn.commit();
+                    if (progress) {
+                        progress->Report(done, total);
+                    }
+                }
+            }
+        }
+        source.close();
+        cn.close();
+    }
+    QSqlDatabase::removeDatabase(sourceConn);
+    QSqlDatabase::removeDatabase(cacheConn);
+    lock.unlock();
+    return imported;
+}
+
+int PureImageCache::ExportMBTiles(QString const & file, MapType::Types const & type, int const & minZoom, int const & maxZoom, MBTilesProgress *progress)
+{
+    if (gtilecache.isEmpty()) {
+        return -1;
+    }
+    lock.lockForRead();
+    Mcounter.lock();
+    QString cacheConn = QString::number(++ConnCounter);
+    QString destConn  = QString::number(++ConnCounter);
+    Mcounter.unlock();
+
+    int exported = -1;
+    {
+        QSqlDatabase cn   = QSqlDatabase::addDatabase("QSQLITE", cacheConn);
+        cn.setDatabaseName(gtilecache + "Data.qmdb");
+        cn.setConnectOptions("QSQLITE_OPEN_READONLY;QSQLITE_BUSY_TIMEOUT=5000");
+        QSqlDatabase dest = QSqlDatabase::addDatabase("QSQLITE", destConn);
+        dest.setDatabaseName(file);
+        if (cn.open() && dest.open() && CreateEmptyMBTiles(dest)) {
+            int total = 0;
+            int done  = 0;
+            {
+                QSqlQuery query(cn);
+                query.prepare("SELECT COUNT(*) FROM Tiles WHERE Type=? AND Zoom BETWEEN ? AND ?");
+                query.addBindValue((int)type);
+                query.addBindValue(minZoom);
+                query.addBindValue(maxZoom);
+                if (query.exec() && query.next()) {
+                    total = query.value(0).toInt();
+                }
+            }
+            QSqlQuery tiles(cn);
+            tiles.setForwardOnly(true);
+            tiles.prepare("SELECT Tiles.X, Tiles.Y, Tiles.Zoom, TilesData.Tile FROM Tiles JOIN TilesData ON TilesData.id = Tiles.id "
+                          "WHERE Tiles.Type=? AND Tiles.Zoom BETWEEN ? AND ?");
+            tiles.addBindValue((int)type);
+            tiles.addBindValue(minZoom);
+            tiles.addBindValue(maxZoom);
+            if (tiles.exec()) {
+                // the cache may hold a tile more than once, the unique index keeps the last one
+                QSqlQuery insert(dest);
+                insert.prepare("INSERT OR REPLACE INTO tiles(zoom_level, tile_column, tile_row, tile_data) VALUES(?, ?, ?, ?)");
+                QString format;
+                int lowZoom  = maxZoom;
+                int highZoom = minZoom;
+                QRect extent;
+
+                exported = 0;
+                dest.transaction();
+                while (tiles.next()) {
+                    int x    = tiles.value(0).toInt();
+                    int y    = tiles.value(1).toInt();
+                    int zoom = tiles.value(2).toInt();
+                    QByteArray tile = tiles.value(3).toByteArray();
+
+                    if (format.isEmpty()) {
+                        format = tile.startsWith("\x89PNG") ? "png" : "jpg";
+                    }
+                    if (zoom < lowZoom) {
+                        lowZoom = zoom;
+                        extent  = QRect();
+                    }
+                    if (zoom == lowZoom) {
+                        extent |= QRect(x, y, 1, 1);
+                    }
+                    highZoom = qMax(highZoom, zoom);
+
+                    insert.addBindValue(zoom);
+                    insert.addBindValue(x);
+                    insert.addBindValue((1 << zoom) - 1 - y);
+                    insert.addBindValue(tile);
+                    if (!insert.exec()) {
+#ifdef DEBUG_PUREIMAGECACHE
+                        qDebug() << "ExportMBTiles: " << insert.lastError().driverText();
+#endif // DEBUG_PUREIMAGECACHE
+                        dest.rollback();
+                        exported = -1;
+                        break;
+                    }
+                    ++exported;
+                    if (++done % MBTilesBatch == 0) {
+                        dest.commit();
+                        dest.transaction();
+                        if (progress) {
+                            progress->Report(done, total);
+                            if (progress->IsCancelled()) {
+                                break;
+                            }
+                        }
+                    }
+                }
+                if (exported >= 0) {
+                    if (exported > 0) {
+                        // bounds of the lowest zoom tiles, spherical mercator like all MBTiles
+                        double n     = 1 << lowZoom;
+                        double west  = extent.left() / n * 360.0 - 180.0;
+                        double east  = (extent.right() + 1) / n * 360.0 - 180.0;
+                        double north = qAtan(sinh(M_PI * (1 - 2 * extent.top() / n))) * 180.0 / M_PI;
+                        double south = qAtan(sinh(M_PI * (1 - 2 * (extent.bottom() + 1) / n))) * 180.0 / M_PI;
+                        QList<QPair<QString, QString> > metadata;
+                        metadata << qMakePair(QString("name"), MapType::StrByType(type))
+                                 << qMakePair(QString("type"), QString("baselayer"))
+                                 << qMakePair(QString("version"), QString("1.1"))
+                                 << qMakePair(QString("description"), QString("OpenPilot GCS map cache"))
+                                 << qMakePair(QString("format"), format)
+                                 << qMakePair(QString("minzoom"), QString::number(lowZoom))
+                                 << qMakePair(QString("maxzoom"), QString::number(highZoom))
+                                 << qMakePair(QString("bounds"), QString("%1,%2,%3,%4").arg(west).arg(south).arg(east).arg(north));
+                        QSqlQuery remove(dest);
+                        remove.prepare("DELETE FROM metadata WHERE name=?");
+                        QSqlQuery add(dest);
+                        add.prepare("INSERT INTO metadata(name, value) VALUES(?, ?)");
+                        for (int i = 0; i < metadata.count(); ++i) {
+                            remove.addBindValue(metadata.at(i).first);
+                            remove.exec();
+                            add.addBindValue(metadata.at(i).first);
+                            add.addBindValue(metadata.at(i).second);
+                            add.exec();
+                        }
+                    }
+                    dest.commit();
+                    if (progress) {
+                        progress->Report(done, total);
+                    }
+                }
+            }
+        }
+        cn.close();
+        dest.close();
+    }
+    QSqlDatabase::removeDatabase(cacheConn);
+    QSqlDatabase::removeDatabase(destConn);
+    lock.unlock();
+    return exported;
+}
+
+bool PureImageCache::CreateEmptyMBTiles(QSqlDatabase & db)
+{
+    QSqlQuery query(db);
+
+    return query.exec("CREATE TABLE IF NOT EXISTS metadata (name TEXT, value TEXT)")
+           && query.exec("CREATE TABLE IF NOT EXISTS tiles (zoom_level INTEGER, tile_column INTEGER, tile_row INTEGER, tile_data BLOB)")
+           && query.exec("CREATE UNIQUE INDEX IF NOT EXISTS tile_index ON tiles (zoom_level, tile_column, tile_row)");
+}
 }
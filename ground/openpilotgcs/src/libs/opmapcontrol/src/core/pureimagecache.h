@@ -39,6 +39,7 @@
 #include "point.h"
 #include <QVariant>
 #include "pureimage.h"
+#include "mbtilesprogress.h"
 #include <QList>
 #include <QMutex>
 #include <QReadWriteLock>
@@ -53,7 +54,36 @@ public:
     void setGtileCache(const QString &value);
     static bool ExportMapDataToDB(QString sourceFile, QString destFile);
     void deleteOlderTiles(int const & days);
+
+    /**
+     * @brief Tiles written per transaction by the MBTiles import and export
+     */
+    static const int MBTilesBatch = 500;
+    /**
+     * @brief Imports the tiles of an MBTiles file as tiles of a map type.
+     *       Tiles already in the cache for the same zoom, x and y are kept.
+     *
+     * @param file MBTiles file
+     * @param type map type the tiles are stored as
+     * @param progress optional progress report and cancellation
+     * @return int tiles imported, -1 on error
+     */
+    int ImportMBTiles(QString const & file, MapType::Types const & type, MBTilesProgress *progress = 0);
+    /**
+     * @brief Exports the cached tiles of a map type to an MBTiles file, created
+     *       if needed. Tiles already in the file for the same zoom, x and y are
+     *       replaced.
+     *
+     * @param file MBTiles file
+     * @param type map type to export
+     * @param minZoom lowest zoom exported
+     * @param maxZoom highest zoom exported
+     * @param progress optional progress report and cancellation
+     * @return int tiles exported, -1 on error
+     */
+    int ExportMBTiles(QString const & file, MapType::Types const & type, int const & minZoom, int const & maxZoom, MBTilesProgress *progress = 0);
 private:
+    static bool CreateEmptyMBTiles(QSqlDatabase & db);
     QString gtilecache;
     QMutex Mcounter;
     QReadWriteLock lock;
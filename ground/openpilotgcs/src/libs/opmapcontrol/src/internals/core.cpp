@@ -125,9 +125,12 @@ void Core::run()
                                 }
 
                                 if (img.length() != 0) {
+                                    // decode here rather than on the first paint
+                                    QImage image = QImage::fromData(img);
                                     Moverlays.lock();
                                     {
                                         t->Overlays.append(img);
+                                        t->Images.append(image);
 #ifdef DEBUG_CORE
                                         qDebug() << "Core::run append img:" << img.length() << " to tile:" << t->GetPos().ToString() << " now has " << t->Overlays.count() << " overlays" << " ID=" << debug;
 #endif // DEBUG_CORE
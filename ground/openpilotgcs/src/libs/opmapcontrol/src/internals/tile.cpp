@@ -43,6 +43,7 @@ void Tile::Clear()
         img.~QByteArray();
     }
     Overlays.clear();
+    Images.clear();
     mutex.unlock();
 }
 Tile::Tile() : zoom(0), pos(0, 0)
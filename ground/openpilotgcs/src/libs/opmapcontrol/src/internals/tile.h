@@ -67,6 +67,11 @@ public:
         return !(zoom == 0);
     }
     QList<QByteArray> Overlays;
+    /**
+     * @brief Overlays decoded by the loader thread, taken by the map when it
+     *       first paints the tile
+     */
+    QList<QImage> Images;
 protected:
 
     QMutex mutex;
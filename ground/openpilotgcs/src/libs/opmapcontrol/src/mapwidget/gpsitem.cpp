@@ -126,7 +126,7 @@ int GPSItem::type() const
 
 void GPSItem::RefreshPos()
 {
-    localposition = map->FromLatLngToLocal(coord);
+    localposition = map->FromLatLngToLocal(coord, projected);
     this->setPos(localposition.X(), localposition.Y());
     emit setChildPosition();
     emit setChildLine();
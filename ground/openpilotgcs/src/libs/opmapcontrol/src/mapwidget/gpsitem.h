@@ -241,6 +241,7 @@ private:
     internals::PointLatLng lastcoord;
     QPixmap pic;
     core::Point localposition;
+    ProjectedCoord projected;
     OPMapWidget *mapwidget;
     QGraphicsItemGroup *trail;
     QGraphicsItemGroup *trailLine;
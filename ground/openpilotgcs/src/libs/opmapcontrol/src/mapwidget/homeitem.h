@@ -88,6 +88,7 @@ private:
     QPixmap pic;
     core::Point localposition;
     internals::PointLatLng coord;
+    ProjectedCoord projected;
     bool showsafearea;
     bool toggleRefresh;
     int safearea;
@@ -27,17 +27,21 @@
 #include "uavitem.h"
 #include "gpsitem.h"
 #include "homeitem.h"
+#include "waypointcircle.h"
+#include "waypointpath.h"
 #include "mapgraphicitem.h"
 #include <QGraphicsSceneMouseEvent>
 
 namespace mapcontrol {
 MapGraphicItem::MapGraphicItem(internals::Core *core, Configuration *configuration) : core(core), config(configuration), MapRenderTransform(1),
-    maxZoom(17), minZoom(2), zoomReal(0), zoomDigi(0), isSelected(false), rotation(0)
+    wpPath(0), refreshingOverlays(false), overlayPasses(0), projectionVersion(0), projectedZoom(-1), projectedWith(0),
+    viewValid(false), viewZoom(-1), viewProjection(0), viewTransform(1), maxZoom(17), minZoom(2), zoomReal(0), zoomDigi(0), isSelected(false), rotation(0)
 {
     dragons.load(QString::fromUtf8(":/markers/images/dragons1.jpg"));
     showTileGridLines = false;
     isMouseOverMarker = false;
     maprect = QRectF(0, 0, 1022, 680);
+    wpPath  = new WayPointPath(this);
     core->SetCurrentRegion(internals::Rectangle(0, 0, maprect.width(), maprect.height()));
     core->SetMapType(MapType::GoogleHybrid);
     this->SetZoom(2);
@@ -69,6 +73,7 @@ void MapGraphicItem::resize(const QRectF &rect)
     if (isVisible()) {
         core->GoToCurrentPosition();
     }
+    RefreshOverlays();
 }
 
 QRectF MapGraphicItem::boundingRect() const
@@ -80,11 +85,49 @@ QRectF MapGraphicItem::boundingRect() const
 void MapGraphicItem::Core_OnNeedInvalidation()
 {
     this->update();
-    emit childRefreshPosition();
+    RefreshOverlays();
 }
 void MapGraphicItem::childPosRefresh()
 {
+    RefreshOverlays();
+}
+void MapGraphicItem::RefreshOverlays()
+{
+    // the core asks for a repaint on each loaded tile and twice per drag step,
+    // the overlays only move when the view does
+    core::Point offset = core->GetrenderOffset();
+
+    if (viewValid && offset == viewOffset && core->Zoom() == viewZoom && core->Projection() == viewProjection
+        && MapRenderTransform == viewTransform && maprect == viewRect) {
+        return;
+    }
+    viewValid      = true;
+    viewOffset     = offset;
+    viewZoom       = core->Zoom();
+    viewProjection = core->Projection();
+    viewTransform  = MapRenderTransform;
+    viewRect       = maprect;
+    ++overlayPasses;
+    // home, UAV and GPS first, circles and lines may end there
     emit childRefreshPosition();
+
+    // one pass over the waypoints rather than a slot call each, those out of
+    // view are left where they are
+    refreshingOverlays = true;
+    foreach(QGraphicsItem * item, childItems()) {
+        WayPointItem *wp = qgraphicsitem_cast<WayPointItem *>(item);
+
+        if (wp) {
+            wp->RefreshPos();
+        } else {
+            WayPointCircle *circle = qgraphicsitem_cast<WayPointCircle *>(item);
+            if (circle) {
+                circle->refreshLocations();
+            }
+        }
+    }
+    refreshingOverlays = false;
+    wpPath->Invalidate();
 }
 void MapGraphicItem::setOverlayOpacity(qreal value)
 {
@@ -144,6 +187,8 @@ void MapGraphicItem::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
     } else {
         DrawMap2D(painter);
     }
+    // here rather than in DrawMap2D, ConstructLastImage draws at another scale
+    tileCache.Retain(core->GetMapType(), core->Zoom(), painter->device()->devicePixelRatio(), drawnTiles);
 }
 void MapGraphicItem::mouseMoveEvent(QGraphicsSceneMouseEvent *event)
 {
@@ -296,6 +341,9 @@ void MapGraphicItem::wheelEvent(QGraphicsSceneWheelEvent *event)
 }
 void MapGraphicItem::DrawMap2D(QPainter *painter)
 {
+    int dpr = painter->device()->devicePixelRatio();
+
+    drawnTiles = QRect();
     painter->drawImage(this->boundingRect(), dragons.toImage());
     if (!lastimage.isNull()) {
         painter->drawImage(core->GetrenderOffset().X() - lastimagepoint.X(), core->GetrenderOffset().Y() - lastimagepoint.Y(), lastimage);
@@ -312,20 +360,14 @@ void MapGraphicItem::DrawMap2D(QPainter *painter)
                     core->tileRect.SetY(core->GettilePoint().Y() * core->tileRect.Height());
                     core->tileRect.Offset(core->GetrenderOffset());
                     if (core->GetCurrentRegion().IntersectsWith(core->tileRect)) {
-                        bool found = false;
+                        drawnTiles |= QRect(core->GettilePoint().X(), core->GettilePoint().Y(), 1, 1);
 
-                        // render tile
-                        // lock(t.Overlays)
+                        // render tile, all its overlays composed in one pixmap
                         if (t != 0) {
-                            foreach(QByteArray img, t->Overlays) {
-                                if (img.count() != 0) {
-                                    if (!found) {
-                                        found = true;
-                                    }
-                                    {
-                                        painter->drawPixmap(core->tileRect.X(), core->tileRect.Y(), core->tileRect.Width(), core->tileRect.Height(), PureImageProxy::FromStream(img));
-                                    }
-                                }
+                            QPixmap pixmap = tileCache.Pixmap(core->GetMapType(), core->Zoom(), core->GettilePoint(), t,
+                                                              QSize(core->tileRect.Width(), core->tileRect.Height()), dpr);
+                            if (!pixmap.isNull()) {
+                                painter->drawPixmap(QRect(core->tileRect.X(), core->tileRect.Y(), core->tileRect.Width(), core->tileRect.Height()), pixmap);
                             }
                         }
 
@@ -372,15 +414,40 @@ void MapGraphicItem::DrawMap2D(QPainter *painter)
 
 core::Point MapGraphicItem::FromLatLngToLocal(internals::PointLatLng const & point)
 {
-    core::Point ret = core->FromLatLngToLocal(point);
-
+    return ApplyRenderTransform(core->FromLatLngToLocal(point));
+}
+core::Point MapGraphicItem::FromLatLngToLocal(internals::PointLatLng const & point, ProjectedCoord & projected)
+{
+    if (core->Zoom() != projectedZoom || core->Projection() != projectedWith) {
+        projectedZoom = core->Zoom();
+        projectedWith = core->Projection();
+        ++projectionVersion;
+    }
+    if (projected.version != projectionVersion || projected.coord != point) {
+        projected.pixel   = core->Projection()->FromLatLngToPixel(point, core->Zoom());
+        projected.coord   = point;
+        projected.version = projectionVersion;
+    }
+    core::Point ret = projected.pixel;
+    ret.Offset(core->GetrenderOffset());
+    return ApplyRenderTransform(ret);
+}
+core::Point MapGraphicItem::ApplyRenderTransform(core::Point point)
+{
     if (MapRenderTransform != 1) {
-        ret.SetX((int)(ret.X() * MapRenderTransform));
-        ret.SetY((int)(ret.Y() * MapRenderTransform));
-        ret.SetX(ret.X() - ((boundingRect().width() * MapRenderTransform) - (boundingRect().width())) / 2);
-        ret.SetY(ret.Y() - ((boundingRect().height() * MapRenderTransform) - (boundingRect().height())) / 2);
+        point.SetX((int)(point.X() * MapRenderTransform));
+        point.SetY((int)(point.Y() * MapRenderTransform));
+        point.SetX(point.X() - ((boundingRect().width() * MapRenderTransform) - (boundingRect().width())) / 2);
+        point.SetY(point.Y() - ((boundingRect().height() * MapRenderTransform) - (boundingRect().height())) / 2);
     }
-    return ret;
+    return point;
+}
+bool MapGraphicItem::IsNearView(QPointF const & point) const
+{
+    // room for the marker and its labels around the point
+    const int Margin = 64;
+
+    return boundingRect().adjusted(-Margin, -Margin, Margin, Margin).contains(point);
 }
 internals::PointLatLng MapGraphicItem::FromLocalToLatLng(int x, int y)
 {
@@ -440,6 +507,8 @@ void MapGraphicItem::SetZoom(double const & value)
             zoomReal = ZoomStep();
             this->update();
         }
+        // a digital zoom leaves the core zoom as it is
+        RefreshOverlays();
     }
 }
 int MapGraphicItem::ZoomStep() const
@@ -39,10 +39,13 @@
 #include <QFont>
 #include <QObject>
 #include "waypointitem.h"
+#include "tilepixmapcache.h"
+#include "projectedcoord.h"
 // #include "uavitem.h"
 
 namespace mapcontrol {
 class WayPointItem;
+class WayPointPath;
 class OPMapWidget;
 /**
  * @brief The main graphicsItem used on the widget, contains the map and map logic
@@ -76,6 +79,50 @@ public:
      * @return core::Point Local item point
      */
     core::Point FromLatLngToLocal(internals::PointLatLng const & point);
+    /**
+     * @brief Convertes LatLong coordinates to local item coordinates, projecting
+     *       the point only if it, the zoom or the projection changed since the
+     *       last conversion with the same cache
+     *
+     * @param point LatLong point to be converted
+     * @param projected projection of the point, kept by the overlay item
+     * @return core::Point Local item point
+     */
+    core::Point FromLatLngToLocal(internals::PointLatLng const & point, ProjectedCoord & projected);
+    /**
+     * @brief Returns true if an overlay at this local point could show on the map
+     *
+     * @param point local item point
+     * @return
+     */
+    bool IsNearView(QPointF const & point) const;
+    /**
+     * @brief Returns true while the overlays are moved after a change of the view
+     *
+     * @return
+     */
+    bool IsRefreshingOverlays() const
+    {
+        return refreshingOverlays;
+    }
+    /**
+     * @brief Number of overlay refreshes so far, one per change of the view
+     *
+     * @return int
+     */
+    int OverlayPasses() const
+    {
+        return overlayPasses;
+    }
+    /**
+     * @brief The item drawing all the waypoint lines
+     *
+     * @return WayPointPath
+     */
+    WayPointPath *WPPath() const
+    {
+        return wpPath;
+    }
     /**
      * @brief Converts from local item coordinates to LatLong point
      *
@@ -145,6 +192,44 @@ private:
     bool showTileGridLines;
     qreal MapRenderTransform;
     void DrawMap2D(QPainter *painter);
+    /**
+     * @brief Decoded tiles, kept around the visible region
+     *
+     * @var tileCache
+     */
+    TilePixmapCache tileCache;
+    /**
+     * @brief Tiles drawn by the last DrawMap2D
+     *
+     * @var drawnTiles
+     */
+    QRect drawnTiles;
+    /**
+     * @brief Moves the overlays if the view changed since the last call
+     */
+    void RefreshOverlays();
+    core::Point ApplyRenderTransform(core::Point point);
+    WayPointPath *wpPath;
+    bool refreshingOverlays;
+    int overlayPasses;
+    /**
+     * @brief Bumped when the zoom or the projection change, invalidates all the
+     *       ProjectedCoord
+     *
+     * @var projectionVersion
+     */
+    int projectionVersion;
+    int projectedZoom;
+    internals::PureProjection *projectedWith;
+    /**
+     * @brief The view the overlays were last moved for
+     */
+    bool viewValid;
+    core::Point viewOffset;
+    int viewZoom;
+    internals::PureProjection *viewProjection;
+    qreal viewTransform;
+    QRectF viewRect;
     /**
      * @brief Maximum possible zoom
      *
@@ -227,6 +312,7 @@ private:
     void start();
     void  ReloadMap()
     {
+        tileCache.Clear();
         core->ReloadMap();
     }
     GeoCoderStatusCode::Types SetCurrentPositionByKeywords(QString const & keys)
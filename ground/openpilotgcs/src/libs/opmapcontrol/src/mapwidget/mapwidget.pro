@@ -16,7 +16,9 @@ SOURCES += mapgraphicitem.cpp \
     mapripper.cpp \
     traillineitem.cpp \
     waypointline.cpp \
-    waypointcircle.cpp
+    waypointcircle.cpp \
+    waypointpath.cpp \
+    tilepixmapcache.cpp
 
 LIBS += -L../build \
     -lcore \
@@ -43,7 +45,10 @@ HEADERS += mapgraphicitem.h \
     mapripper.h \
     traillineitem.h \
     waypointline.h \
-    waypointcircle.h
+    waypointcircle.h \
+    waypointpath.h \
+    projectedcoord.h \
+    tilepixmapcache.h
 QT += opengl
 QT += network
 QT += sql
@@ -0,0 +1,52 @@
+/**
+ ******************************************************************************
+ *
+ * @file       projectedcoord.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
+ * @brief      Projection of an overlay coordinate, kept between view changes
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef PROJECTEDCOORD_H
+#define PROJECTEDCOORD_H
+
+#include "../internals/pointlatlng.h"
+#include "../core/point.h"
+
+namespace mapcontrol {
+/**
+ * @brief Pixel position of a coordinate on the whole map, as last projected by
+ *       MapGraphicItem::FromLatLngToLocal
+ *
+ * Panning only moves the render offset, the pixel stays valid until the
+ * coordinate, the zoom or the projection change.
+ */
+struct ProjectedCoord {
+    ProjectedCoord() : version(-1)
+    {}
+    internals::PointLatLng coord;
+    core::Point pixel;
+    /**
+     * @brief Projection version the pixel was computed with, -1 if never projected
+     */
+    int version;
+};
+}
+#endif // PROJECTEDCOORD_H
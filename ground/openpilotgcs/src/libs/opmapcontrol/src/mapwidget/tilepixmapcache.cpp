@@ -0,0 +1,112 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tilepixmapcache.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
+ * @brief      Cache of the decoded map tiles, ready to be painted
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "tilepixmapcache.h"
+#include <QPainter>
+
+namespace mapcontrol {
+TilePixmapCache::TilePixmapCache(int maxCost) : cache(maxCost), hits(0), misses(0)
+{}
+
+QPixmap TilePixmapCache::Pixmap(core::MapType::Types const & type, int const & zoom, core::Point const & pos,
+                                internals::Tile *tile, QSize const & size, int const & dpr)
+{
+    Key key = { (int)type, zoom, pos.X(), pos.Y(), dpr };
+    QPixmap *pixmap = cache.object(key);
+    if (pixmap != 0 && pixmap->size() == size * dpr) {
+        ++hits;
+        return *pixmap;
+    }
+
+    ++misses;
+    QPixmap composed = Compose(tile, size, dpr);
+    if (!composed.isNull()) {
+        // cost in kB of pixels
+        int cost = composed.width() * composed.height() * composed.depth() / 8 / 1024;
+        cache.insert(key, new QPixmap(composed), qMax(cost, 1));
+    }
+    return composed;
+}
+
+void TilePixmapCache::Retain(core::MapType::Types const & type, int const & zoom, int const & dpr, QRect const & visible)
+{
+    QRect kept = visible.adjusted(-RetainMargin, -RetainMargin, RetainMargin, RetainMargin);
+
+    foreach(Key key, cache.keys()) {
+        if (key.type != (int)type || key.zoom != zoom || key.dpr != dpr || !kept.contains(key.x, key.y)) {
+            cache.remove(key);
+        }
+    }
+}
+
+void TilePixmapCache::Clear()
+{
+    cache.clear();
+}
+
+QPixmap TilePixmapCache::Compose(internals::Tile *tile, QSize const & size, int const & dpr)
+{
+    if (tile == 0 || tile->Overlays.isEmpty()) {
+        return QPixmap();
+    }
+
+    // the loader decodes the tiles it fetches, decode here only the tiles that
+    // were evicted and come back into view
+    QList<QImage> images = tile->Images;
+    if (images.count() != tile->Overlays.count()) {
+        images.clear();
+        foreach(QByteArray img, tile->Overlays) {
+            images.append(QImage::fromData(img));
+        }
+    }
+    // the pixmap keeps the pixels from now on
+    tile->Images.clear();
+
+    QPixmap pixmap(size * dpr);
+    pixmap.fill(Qt::transparent);
+    {
+        QPainter painter(&pixmap);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+        foreach(QImage image, images) {
+            if (!image.isNull()) {
+                painter.drawImage(pixmap.rect(), image);
+            }
+        }
+    }
+    pixmap.setDevicePixelRatio(dpr);
+    return pixmap;
+}
+
+bool operator==(TilePixmapCache::Key const & lhs, TilePixmapCache::Key const & rhs)
+{
+    return lhs.type == rhs.type && lhs.zoom == rhs.zoom && lhs.x == rhs.x && lhs.y == rhs.y && lhs.dpr == rhs.dpr;
+}
+
+uint qHash(TilePixmapCache::Key const & key)
+{
+    return qHash(key.x) ^ (qHash(key.y) << 16) ^ (qHash(key.zoom) << 8) ^ qHash(key.type) ^ (qHash(key.dpr) << 24);
+}
+}
@@ -0,0 +1,130 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tilepixmapcache.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
+ * @brief      Cache of the decoded map tiles, ready to be painted
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef TILEPIXMAPCACHE_H
+#define TILEPIXMAPCACHE_H
+
+#include <QCache>
+#include <QPixmap>
+#include <QRect>
+#include "../internals/tile.h"
+#include "../core/maptype.h"
+
+namespace mapcontrol {
+/**
+ * @brief Cache of the map tiles as pixmaps, all layers of a tile composed and
+ *       scaled to the device pixels of the painter
+ *
+ * The tiles are compressed images, decoding them on each paint costs more than
+ * all the rest of the map drawing. The tiles arriving from the loader threads
+ * are decoded there (see internals::Tile::Images), the cache turns them into
+ * pixmaps once and keeps them while they stay around the visible region.
+ *
+ * @class TilePixmapCache tilepixmapcache.h "tilepixmapcache.h"
+ */
+class TilePixmapCache {
+public:
+    /**
+     * @brief Default bound of the cache, in kB of pixels. About a hundred and
+     *       fifty 256x256 tiles, two screens of tiles at a device pixel ratio of 2
+     */
+    static const int DefaultMaxCost = 40 * 1024;
+    /**
+     * @brief Tiles kept around the visible region, in tiles
+     */
+    static const int RetainMargin   = 2;
+
+    TilePixmapCache(int maxCost = DefaultMaxCost);
+
+    /**
+     * @brief Returns the pixmap of a tile, decoding it if not cached yet
+     *
+     * @param type map type of the tile
+     * @param zoom zoom of the tile
+     * @param pos tile position
+     * @param tile the tile, its overlays are decoded on a miss
+     * @param size size of the tile on the map
+     * @param dpr device pixel ratio of the painter
+     * @return QPixmap null if the tile has no image
+     */
+    QPixmap Pixmap(core::MapType::Types const & type, int const & zoom, core::Point const & pos,
+                   internals::Tile *tile, QSize const & size, int const & dpr);
+    /**
+     * @brief Drops the pixmaps of other map types, zooms and device pixel ratios
+     *       and those farther than RetainMargin from the visible tiles
+     *
+     * @param type current map type
+     * @param zoom current zoom
+     * @param dpr device pixel ratio of the view
+     * @param visible tiles drawn by the last paint
+     */
+    void Retain(core::MapType::Types const & type, int const & zoom, int const & dpr, QRect const & visible);
+    /**
+     * @brief Drops all the pixmaps, to be called when the tiles are reloaded
+     */
+    void Clear();
+
+    int Count() const
+    {
+        return cache.count();
+    }
+    int TotalCost() const
+    {
+        return cache.totalCost();
+    }
+    int MaxCost() const
+    {
+        return cache.maxCost();
+    }
+    int Hits() const
+    {
+        return hits;
+    }
+    int Misses() const
+    {
+        return misses;
+    }
+
+    struct Key {
+        int type;
+        int zoom;
+        int x;
+        int y;
+        int dpr;
+    };
+
+private:
+    static QPixmap Compose(internals::Tile *tile, QSize const & size, int const & dpr);
+
+    QCache<Key, QPixmap> cache;
+    int hits;
+    int misses;
+};
+
+bool operator==(TilePixmapCache::Key const & lhs, TilePixmapCache::Key const & rhs);
+uint qHash(TilePixmapCache::Key const & key);
+}
+#endif // TILEPIXMAPCACHE_H
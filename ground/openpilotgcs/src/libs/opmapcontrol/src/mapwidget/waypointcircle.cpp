@@ -29,6 +29,21 @@
 #include "homeitem.h"
 
 namespace mapcontrol {
+// waypoints out of view keep an old pos(), see WayPointItem::RefreshPos
+static QPointF localPosition(QGraphicsItem *item)
+{
+    WayPointItem *waypoint = qgraphicsitem_cast<WayPointItem *>(item);
+
+    return waypoint ? waypoint->LocalPosition() : item->pos();
+}
+
+static QRectF circleBounds(QLineF const & line)
+{
+    qreal radius = line.length();
+
+    return QRectF(line.p1().x() - radius, line.p1().y() - radius, 2 * radius, 2 * radius);
+}
+
 WayPointCircle::WayPointCircle(WayPointItem *center, WayPointItem *radius, bool clockwise, MapGraphicItem *map, QColor color, bool dashed, int width) : QGraphicsEllipseItem(map),
     my_center(center), my_radius(radius), my_map(map), myColor(color), myClockWise(clockwise), dashed(dashed), width(width)
 {
@@ -44,7 +59,7 @@ WayPointCircle::WayPointCircle(HomeItem *radius, WayPointItem *center, bool cloc
     my_center(center), my_radius(radius), my_map(map), myColor(color), myClockWise(clockwise), dashed(dashed), width(width)
 {
     connect(radius, SIGNAL(homePositionChanged(internals::PointLatLng, float)), this, SLOT(refreshLocations()));
-    connect(center, SIGNAL(localPositionChanged(QPointF)), this, SLOT(refreshLocations()));
+    connect(center, SIGNAL(localPositionChanged(QPointF, WayPointItem *)), this, SLOT(refreshLocations()));
     connect(center, SIGNAL(aboutToBeDeleted(WayPointItem *)), this, SLOT(waypointdeleted()));
     refreshLocations();
     connect(map, SIGNAL(childSetOpacity(qreal)), this, SLOT(setOpacitySlot(qreal)));
@@ -107,13 +122,27 @@ void WayPointCircle::paint(QPainter *painter, const QStyleOptionGraphicsItem *op
 
 void WayPointCircle::refreshLocations()
 {
-    line = QLineF(my_center->pos(), my_radius->pos());
-    this->setRect(my_center->pos().x(), my_center->pos().y(), 2 * line.length(), 2 * line.length());
+    if (!my_center || !my_radius) {
+        return;
+    }
+    qreal arrowSize = 10;
+    QLineF location = QLineF(localPosition(my_center), localPosition(my_radius));
+    QRectF view     = my_map->boundingRect().adjusted(-arrowSize, -arrowSize, arrowSize, arrowSize);
+
+    // out of view before and after, moving it would only update the scene index
+    if (!view.intersects(circleBounds(location)) && !view.intersects(circleBounds(line))) {
+        return;
+    }
+    line = location;
+    this->setRect(line.p1().x(), line.p1().y(), 2 * line.length(), 2 * line.length());
     this->update();
 }
 
 void WayPointCircle::waypointdeleted()
 {
+    // the map may refresh the circle before it is deleted
+    my_center = 0;
+    my_radius = 0;
     this->deleteLater();
 }
 
@@ -60,7 +60,6 @@ WayPointItem::WayPointItem(const internals::PointLatLng &coord, int const & alti
     }
     connect(this, SIGNAL(waypointdoubleclick(WayPointItem *)), map, SIGNAL(wpdoubleclicked(WayPointItem *)));
     emit manualCoordChange(this);
-    connect(map, SIGNAL(childRefreshPosition()), this, SLOT(RefreshPos()));
     connect(map, SIGNAL(childSetOpacity(qreal)), this, SLOT(setOpacitySlot(qreal)));
 }
 
@@ -104,7 +103,6 @@ WayPointItem::WayPointItem(MapGraphicItem *map, bool magicwaypoint) : reached(fa
     }
     connect(this, SIGNAL(waypointdoubleclick(WayPointItem *)), map, SIGNAL(wpdoubleclicked(WayPointItem *)));
     emit manualCoordChange(this);
-    connect(map, SIGNAL(childRefreshPosition()), this, SLOT(RefreshPos()));
     connect(map, SIGNAL(childSetOpacity(qreal)), this, SLOT(setOpacitySlot(qreal)));
 }
 WayPointItem::WayPointItem(const internals::PointLatLng &coord, int const & altitude, const QString &description, MapGraphicItem *map, wptype type) : coord(coord), reached(false), description(description), shownumber(true), isDragging(false), altitude(altitude), map(map), myType(type)
@@ -137,7 +135,6 @@ WayPointItem::WayPointItem(const internals::PointLatLng &coord, int const & alti
     }
     connect(this, SIGNAL(waypointdoubleclick(WayPointItem *)), map, SIGNAL(wpdoubleclicked(WayPointItem *)));
     emit manualCoordChange(this);
-    connect(map, SIGNAL(childRefreshPosition()), this, SLOT(RefreshPos()));
     connect(map, SIGNAL(childSetOpacity(qreal)), this, SLOT(setOpacitySlot(qreal)));
 }
 
@@ -172,7 +169,6 @@ WayPointItem::WayPointItem(const distBearingAltitude &relativeCoordenate, const
     RefreshPos();
     connect(this, SIGNAL(waypointdoubleclick(WayPointItem *)), map, SIGNAL(wpdoubleclicked(WayPointItem *)));
     emit manualCoordChange(this);
-    connect(map, SIGNAL(childRefreshPosition()), this, SLOT(RefreshPos()));
     connect(map, SIGNAL(childSetOpacity(qreal)), this, SLOT(setOpacitySlot(qreal)));
 }
 
@@ -433,10 +429,25 @@ WayPointItem::~WayPointItem()
 }
 void WayPointItem::RefreshPos()
 {
-    core::Point point = map->FromLatLngToLocal(coord);
+    core::Point point = map->FromLatLngToLocal(coord, projected);
+    QPointF local(point.X(), point.Y());
 
-    this->setPos(point.X(), point.Y());
-    emit localPositionChanged(this->pos(), this);
+    if (map->IsRefreshingOverlays() && !map->IsNearView(local) && !map->IsNearView(this->pos())) {
+        // out of view before and after the pan or zoom, moving it would only
+        // update the scene index
+        return;
+    }
+    // a new or edited waypoint is placed wherever it is
+    this->setPos(local);
+    emit localPositionChanged(local, this);
+}
+QPointF WayPointItem::LocalPosition()
+{
+    if (isDragging) {
+        return this->pos();
+    }
+    core::Point point = map->FromLatLngToLocal(coord, projected);
+    return QPointF(point.X(), point.Y());
 }
 
 void WayPointItem::setOpacitySlot(qreal opacity)
@@ -32,6 +32,7 @@
 #include <QLabel>
 #include "../internals/pointlatlng.h"
 #include "mapgraphicitem.h"
+#include "projectedcoord.h"
 #include <QObject>
 #include <QPoint>
 
@@ -144,6 +145,13 @@ public:
      * @param value
      */
     void SetCoord(internals::PointLatLng const & value);
+    /**
+     * @brief Returns the position of the waypoint on the map, also when it is
+     *       out of view and pos() was left behind
+     *
+     * @return QPointF local map point
+     */
+    QPointF LocalPosition();
     /**
      * @brief Used if WayPoint number is to be drawn on screen
      *
@@ -226,6 +234,7 @@ private:
     HomeItem *myHome;
     wptype myType;
     QString myCustomString;
+    ProjectedCoord projected;
 
 public slots:
     /**
@@ -25,79 +25,69 @@
  * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
  */
 #include "waypointline.h"
+#include "waypointpath.h"
 #include <math.h>
 #include "homeitem.h"
 
 namespace mapcontrol {
+// waypoints out of view keep an old pos(), see WayPointItem::RefreshPos
+static QPointF localPosition(QGraphicsItem *item)
+{
+    WayPointItem *waypoint = qgraphicsitem_cast<WayPointItem *>(item);
+
+    return waypoint ? waypoint->LocalPosition() : item->pos();
+}
+
 WayPointLine::WayPointLine(WayPointItem *from, WayPointItem *to, MapGraphicItem *map, QColor color, bool dashed, int width) : QGraphicsLineItem(map),
-    source(from), destination(to), my_map(map), myColor(color), dashed(dashed), lineWidth(width)
+    source(from), destination(to), my_map(map), path(map->WPPath()), myColor(color), dashed(dashed), lineWidth(width)
 {
-    this->setLine(to->pos().x(), to->pos().y(), from->pos().x(), from->pos().y());
+    this->setFlag(QGraphicsItem::ItemHasNoContents, true);
     connect(from, SIGNAL(localPositionChanged(QPointF, WayPointItem *)), this, SLOT(refreshLocations()));
     connect(to, SIGNAL(localPositionChanged(QPointF, WayPointItem *)), this, SLOT(refreshLocations()));
     connect(from, SIGNAL(aboutToBeDeleted(WayPointItem *)), this, SLOT(waypointdeleted()));
     connect(to, SIGNAL(aboutToBeDeleted(WayPointItem *)), this, SLOT(waypointdeleted()));
-    if (myColor == Qt::green) {
-        this->setZValue(10);
-    } else if (myColor == Qt::yellow) {
-        this->setZValue(9);
-    } else if (myColor == Qt::red) {
-        this->setZValue(8);
-    }
     connect(map, SIGNAL(childSetOpacity(qreal)), this, SLOT(setOpacitySlot(qreal)));
+    path->AddLine(this);
 }
 
 WayPointLine::WayPointLine(HomeItem *from, WayPointItem *to, MapGraphicItem *map, QColor color, bool dashed, int width) : QGraphicsLineItem(map),
-    source(from), destination(to), my_map(map), myColor(color), dashed(dashed), lineWidth(width)
+    source(from), destination(to), my_map(map), path(map->WPPath()), myColor(color), dashed(dashed), lineWidth(width)
 {
-    this->setLine(to->pos().x(), to->pos().y(), from->pos().x(), from->pos().y());
+    this->setFlag(QGraphicsItem::ItemHasNoContents, true);
     connect(from, SIGNAL(homePositionChanged(internals::PointLatLng, float)), this, SLOT(refreshLocations()));
     connect(to, SIGNAL(localPositionChanged(QPointF, WayPointItem *)), this, SLOT(refreshLocations()));
     connect(to, SIGNAL(aboutToBeDeleted(WayPointItem *)), this, SLOT(waypointdeleted()));
-    if (myColor == Qt::green) {
-        this->setZValue(10);
-    } else if (myColor == Qt::yellow) {
-        this->setZValue(9);
-    } else if (myColor == Qt::red) {
-        this->setZValue(8);
-    }
     connect(map, SIGNAL(childSetOpacity(qreal)), this, SLOT(setOpacitySlot(qreal)));
+    path->AddLine(this);
+}
+
+WayPointLine::~WayPointLine()
+{
+    if (path) {
+        path->RemoveLine(this);
+    }
 }
+
 int WayPointLine::type() const
 {
     // Enable the use of qgraphicsitem_cast with this item.
     return Type;
 }
-QPainterPath WayPointLine::shape() const
-{
-    QPainterPath path = QGraphicsLineItem::shape();
 
-    path.addPolygon(arrowHead);
-    return path;
-}
-void WayPointLine::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+void WayPointLine::setColor(const QColor &color)
 {
-    Q_UNUSED(option);
-    Q_UNUSED(widget);
-
-    QPen myPen = pen();
-    myPen.setColor(myColor);
-    qreal arrowSize = 10;
-    painter->setPen(myPen);
-    painter->setBrush(myColor);
+    myColor = color;
+    refreshLocations();
+}
 
-    double angle = ::acos(line().dx() / line().length());
-    if (line().dy() >= 0) {
-        angle = (M_PI * 2) - angle;
-    }
+QLineF WayPointLine::Locations()
+{
+    return QLineF(localPosition(destination), localPosition(source));
+}
 
-    QPointF arrowP1 = line().pointAt(0.5) + QPointF(sin(angle + M_PI / 3) * arrowSize,
-                                                    cos(angle + M_PI / 3) * arrowSize);
-    QPointF arrowP2 = line().pointAt(0.5) + QPointF(sin(angle + M_PI - M_PI / 3) * arrowSize,
-                                                    cos(angle + M_PI - M_PI / 3) * arrowSize);
-    arrowHead.clear();
-    arrowHead << line().pointAt(0.5) << arrowP1 << arrowP2;
-    painter->drawPolygon(arrowHead);
+QPen WayPointLine::Pen() const
+{
+    QPen myPen(myColor);
 
     if (dashed) {
         QVector<qreal> dashes;
@@ -116,17 +106,35 @@ void WayPointLine::paint(QPainter *painter, const QStyleOptionGraphicsItem *opti
     } else {
         myPen.setWidth(lineWidth);
     }
-    painter->setPen(myPen);
-    painter->drawLine(line());
+    return myPen;
+}
+
+int WayPointLine::Layer() const
+{
+    if (myColor == Qt::green) {
+        return 10;
+    } else if (myColor == Qt::yellow) {
+        return 9;
+    } else if (myColor == Qt::red) {
+        return 8;
+    }
+    return 0;
 }
 
 void WayPointLine::refreshLocations()
 {
-    this->setLine(destination->pos().x(), destination->pos().y(), source->pos().x(), source->pos().y());
+    if (path) {
+        path->Invalidate();
+    }
 }
 
 void WayPointLine::waypointdeleted()
 {
+    // the waypoint is going away, the path must not ask it for its position
+    if (path) {
+        path->RemoveLine(this);
+        path = 0;
+    }
     this->deleteLater();
 }
 
@@ -34,30 +34,54 @@
 #include "waypointitem.h"
 #include <QObject>
 #include <QPoint>
+#include <QPointer>
 
 namespace mapcontrol {
+class WayPointPath;
+/**
+ * @brief A line between two waypoints, or from home to a waypoint
+ *
+ * The lines draw nothing themselves, all of them are drawn by the single
+ * WayPointPath of the map.
+ *
+ * @class WayPointLine waypointline.h "waypointline.h"
+ */
 class WayPointLine : public QObject, public QGraphicsLineItem {
     Q_OBJECT Q_INTERFACES(QGraphicsItem)
 public:
     enum { Type = UserType + 8 };
     WayPointLine(WayPointItem *from, WayPointItem *to, MapGraphicItem *map, QColor color = Qt::green, bool dashed = false, int width = -1);
     WayPointLine(HomeItem *from, WayPointItem *to, MapGraphicItem *map, QColor color = Qt::green, bool dashed = false, int width = -1);
+    ~WayPointLine();
     int type() const;
-    QPainterPath shape() const;
-    void setColor(const QColor &color)
-    {
-        myColor = color;
-    }
+    void setColor(const QColor &color);
+    /**
+     * @brief Returns the line in local map coordinates, from the destination
+     *       to the source
+     *
+     * @return QLineF
+     */
+    QLineF Locations();
+    /**
+     * @brief Returns the pen the line is drawn with
+     *
+     * @return QPen
+     */
+    QPen Pen() const;
+    /**
+     * @brief Returns the stacking order of the line, thicker lines go below
+     *
+     * @return int
+     */
+    int Layer() const;
 private:
     QGraphicsItem *source;
     QGraphicsItem *destination;
     MapGraphicItem *my_map;
-    QPolygonF arrowHead;
+    QPointer<WayPointPath> path;
     QColor myColor;
     bool dashed;
     int lineWidth;
-protected:
-    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget);
 public slots:
     void refreshLocations();
     void waypointdeleted();
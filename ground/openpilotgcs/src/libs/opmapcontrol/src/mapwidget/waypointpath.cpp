@@ -0,0 +1,157 @@
+/**
+ ******************************************************************************
+ *
+ * @file       waypointpath.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
+ * @brief      A graphicsItem drawing all the lines between waypoints
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "waypointpath.h"
+#include "waypointline.h"
+#include <math.h>
+
+namespace mapcontrol {
+WayPointPath::WayPointPath(MapGraphicItem *map) : QGraphicsItem(map), map(map), rect(map->boundingRect()), dirty(true), drawnLines(0)
+{
+    this->setZValue(10);
+    this->setAcceptedMouseButtons(Qt::NoButton);
+    connect(map, SIGNAL(childSetOpacity(qreal)), this, SLOT(setOpacitySlot(qreal)));
+}
+
+int WayPointPath::type() const
+{
+    // Enable the use of qgraphicsitem_cast with this item.
+    return Type;
+}
+
+QRectF WayPointPath::boundingRect() const
+{
+    // the path holds the lines in view only
+    return rect;
+}
+
+QPainterPath WayPointPath::shape() const
+{
+    // not to be picked in place of the map or the waypoints
+    return QPainterPath();
+}
+
+void WayPointPath::paint(QPainter *painter, const QStyleOptionGraphicsItem *option, QWidget *widget)
+{
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    if (dirty) {
+        Rebuild();
+        dirty = false;
+    }
+    foreach(Stroke stroke, strokes) {
+        painter->setPen(QPen(stroke.pen.color()));
+        painter->setBrush(stroke.pen.color());
+        painter->drawPath(stroke.arrows);
+        painter->setPen(stroke.pen);
+        painter->setBrush(Qt::NoBrush);
+        painter->drawPath(stroke.lines);
+    }
+}
+
+void WayPointPath::AddLine(WayPointLine *line)
+{
+    lines.append(line);
+    Invalidate();
+}
+
+void WayPointPath::RemoveLine(WayPointLine *line)
+{
+    lines.removeOne(line);
+    Invalidate();
+}
+
+void WayPointPath::Invalidate()
+{
+    if (rect != map->boundingRect()) {
+        prepareGeometryChange();
+        rect = map->boundingRect();
+    }
+    dirty = true;
+    this->update();
+}
+
+bool WayPointPath::IsBelow(Stroke const & lhs, Stroke const & rhs)
+{
+    return lhs.layer < rhs.layer;
+}
+
+void WayPointPath::Rebuild()
+{
+    qreal arrowSize = 10;
+    QRectF view     = rect.adjusted(-arrowSize, -arrowSize, arrowSize, arrowSize);
+
+    strokes.clear();
+    drawnLines = 0;
+    foreach(WayPointLine * line, lines) {
+        QLineF location = line->Locations();
+
+        // adjusted, the bounds of a horizontal or vertical line are empty
+        if (!view.intersects(QRectF(location.p1(), location.p2()).normalized().adjusted(-1, -1, 1, 1))) {
+            continue;
+        }
+        QPen pen = line->Pen();
+        int i    = 0;
+        while (i < strokes.count() && strokes.at(i).pen != pen) {
+            ++i;
+        }
+        if (i == strokes.count()) {
+            Stroke stroke;
+            stroke.pen   = pen;
+            stroke.layer = line->Layer();
+            strokes.append(stroke);
+        }
+        Stroke & stroke = strokes[i];
+        stroke.lines.moveTo(location.p1());
+        stroke.lines.lineTo(location.p2());
+
+        if (location.length() > 0) {
+            double angle = ::acos(location.dx() / location.length());
+            if (location.dy() >= 0) {
+                angle = (M_PI * 2) - angle;
+            }
+            QPointF middle  = location.pointAt(0.5);
+            QPointF arrowP1 = middle + QPointF(sin(angle + M_PI / 3) * arrowSize,
+                                               cos(angle + M_PI / 3) * arrowSize);
+            QPointF arrowP2 = middle + QPointF(sin(angle + M_PI - M_PI / 3) * arrowSize,
+                                               cos(angle + M_PI - M_PI / 3) * arrowSize);
+            QPolygonF arrowHead;
+            arrowHead << middle << arrowP1 << arrowP2;
+            stroke.arrows.addPolygon(arrowHead);
+            stroke.arrows.closeSubpath();
+        }
+        ++drawnLines;
+    }
+    // as the line items were stacked, by color
+    qStableSort(strokes.begin(), strokes.end(), IsBelow);
+}
+
+void WayPointPath::setOpacitySlot(qreal opacity)
+{
+    setOpacity(opacity);
+}
+}
@@ -0,0 +1,95 @@
+/**
+ ******************************************************************************
+ *
+ * @file       waypointpath.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2012.
+ * @brief      A graphicsItem drawing all the lines between waypoints
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef WAYPOINTPATH_H
+#define WAYPOINTPATH_H
+#include <QGraphicsItem>
+#include <QPainter>
+#include <QObject>
+#include "mapgraphicitem.h"
+
+namespace mapcontrol {
+class WayPointLine;
+/**
+ * @brief Draws all the WayPointLine of the map as one path per pen
+ *
+ * A mission of hundreds of waypoints made as many line items, each moved
+ * through the scene index and painted on its own on every pan. The path is
+ * built once per change, from the lines in view only.
+ *
+ * @class WayPointPath waypointpath.h "waypointpath.h"
+ */
+class WayPointPath : public QObject, public QGraphicsItem {
+    Q_OBJECT Q_INTERFACES(QGraphicsItem)
+public:
+    enum { Type = UserType + 10 };
+    WayPointPath(MapGraphicItem *map);
+    int type() const;
+    QRectF boundingRect() const;
+    QPainterPath shape() const;
+    void paint(QPainter *painter, const QStyleOptionGraphicsItem *option,
+               QWidget *widget);
+    void AddLine(WayPointLine *line);
+    void RemoveLine(WayPointLine *line);
+    /**
+     * @brief To be called when a line or the view changed, the path is rebuilt
+     *       on the next paint
+     */
+    void Invalidate();
+    int LineCount() const
+    {
+        return lines.count();
+    }
+    /**
+     * @brief Returns the number of lines in view on the last paint
+     *
+     * @return int
+     */
+    int DrawnLines() const
+    {
+        return drawnLines;
+    }
+private:
+    struct Stroke {
+        QPen pen;
+        int  layer;
+        QPainterPath lines;
+        QPainterPath arrows;
+    };
+    static bool IsBelow(Stroke const & lhs, Stroke const & rhs);
+    void Rebuild();
+
+    MapGraphicItem *map;
+    QList<WayPointLine *> lines;
+    QList<Stroke> strokes;
+    QRectF rect;
+    bool dirty;
+    int drawnLines;
+public slots:
+    void setOpacitySlot(qreal opacity);
+};
+}
+#endif // WAYPOINTPATH_H
@@ -0,0 +1,19 @@
+CONFIG += qtestlib
+TEMPLATE = app
+CONFIG -= app_bundle
+
+QT += sql
+
+include(../../../../../openpilotgcs.pri)
+
+INCLUDEPATH += ../../src/core
+
+HEADERS += ../../src/core/pureimagecache.h \
+    ../../src/core/mbtilesprogress.h \
+    ../../src/core/maptype.h
+
+SOURCES += tst_mbtiles.cpp \
+    ../../src/core/pureimagecache.cpp \
+    ../../src/core/pureimage.cpp \
+    ../../src/core/point.cpp \
+    ../../src/core/size.cpp
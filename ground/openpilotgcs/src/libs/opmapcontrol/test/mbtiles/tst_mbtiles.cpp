@@ -0,0 +1,282 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_mbtiles.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      MBTiles import into and export from the tile cache
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "pureimagecache.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QObject>
+#include <QTemporaryDir>
+
+// The fixture: 30x20 tiles at zoom 12 and the 15x10 tiles over them at zoom 11
+#define FIXTURE_ZOOM 12
+#define FIXTURE_X    2000
+#define FIXTURE_Y    1300
+#define FIXTURE_W    30
+#define FIXTURE_H    20
+#define FIXTURE_SIZE (FIXTURE_W * FIXTURE_H + FIXTURE_W / 2 * FIXTURE_H / 2)
+
+using namespace core;
+
+class tst_MBTiles : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void init();
+    void cleanup();
+
+    void importFlipsRows();
+    void importKeepsCachedTiles();
+    void progressPerBatch();
+    void cancelAfterBatch();
+    void exportRoundTrip();
+    void exportOtherTypeIsEmpty();
+
+    void benchmarkImport();
+    void benchmarkExport();
+
+private:
+    static QByteArray fixtureTile(int zoom, int x, int y);
+    void createFixture(QString const & file);
+    int countRows(QString const & file, QString const & sql);
+
+    QTemporaryDir *m_dir;
+    QString m_fixture;
+    PureImageCache *m_cache;
+};
+
+/*
+ * PNG signature followed by the tile coordinates, the cache never decodes them
+ */
+QByteArray tst_MBTiles::fixtureTile(int zoom, int x, int y)
+{
+    return QByteArray("\x89PNG\r\n\x1a\n") + QString("%1/%2/%3").arg(zoom).arg(x).arg(y).toLatin1();
+}
+
+void tst_MBTiles::createFixture(QString const & file)
+{
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "fixture");
+        db.setDatabaseName(file);
+        QVERIFY(db.open());
+
+        QSqlQuery query(db);
+        QVERIFY(query.exec("CREATE TABLE metadata (name TEXT, value TEXT)"));
+        QVERIFY(query.exec("CREATE TABLE tiles (zoom_level INTEGER, tile_column INTEGER, tile_row INTEGER, tile_data BLOB)"));
+        QVERIFY(query.exec("CREATE UNIQUE INDEX tile_index ON tiles (zoom_level, tile_column, tile_row)"));
+        QVERIFY(query.exec("INSERT INTO metadata VALUES('name', 'fixture')"));
+        QVERIFY(query.exec("INSERT INTO metadata VALUES('format', 'png')"));
+
+        db.transaction();
+        query.prepare("INSERT INTO tiles VALUES(?, ?, ?, ?)");
+        for (int zoom = FIXTURE_ZOOM - 1; zoom <= FIXTURE_ZOOM; zoom++) {
+            int shift = FIXTURE_ZOOM - zoom;
+            for (int x = FIXTURE_X >> shift; x < (FIXTURE_X + FIXTURE_W) >> shift; x++) {
+                for (int y = FIXTURE_Y >> shift; y < (FIXTURE_Y + FIXTURE_H) >> shift; y++) {
+                    query.addBindValue(zoom);
+                    query.addBindValue(x);
+                    query.addBindValue((1 << zoom) - 1 - y);
+                    query.addBindValue(fixtureTile(zoom, x, y));
+                    QVERIFY(query.exec());
+                }
+            }
+        }
+        db.commit();
+        db.close();
+    }
+    QSqlDatabase::removeDatabase("fixture");
+}
+
+int tst_MBTiles::countRows(QString const & file, QString const & sql)
+{
+    int count = -1;
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "count");
+        db.setDatabaseName(file);
+        if (db.open()) {
+            QSqlQuery query(db);
+            if (query.exec(sql) && query.next()) {
+                count = query.value(0).toInt();
+            }
+            db.close();
+        }
+    }
+    QSqlDatabase::removeDatabase("count");
+    return count;
+}
+
+void tst_MBTiles::initTestCase()
+{
+    QCOMPARE(FIXTURE_SIZE, 750);
+}
+
+void tst_MBTiles::init()
+{
+    m_dir     = new QTemporaryDir();
+    QVERIFY(m_dir->isValid());
+    m_fixture = m_dir->path() + "/fixture.mbtiles";
+    createFixture(m_fixture);
+
+    m_cache   = new PureImageCache();
+    m_cache->setGtileCache(m_dir->path() + "/cache/");
+}
+
+void tst_MBTiles::cleanup()
+{
+    delete m_cache;
+    delete m_dir;
+}
+
+void tst_MBTiles::importFlipsRows()
+{
+    QCOMPARE(m_cache->ImportMBTiles(m_fixture, MapType::GoogleSatellite), FIXTURE_SIZE);
+
+    int x = FIXTURE_X + 3;
+    int y = FIXTURE_Y + 7;
+    QCOMPARE(m_cache->GetImageFromCache(MapType::GoogleSatellite, Point(x, y), FIXTURE_ZOOM), fixtureTile(FIXTURE_ZOOM, x, y));
+    QCOMPARE(m_cache->GetImageFromCache(MapType::GoogleSatellite, Point(x / 2, y / 2), FIXTURE_ZOOM - 1), fixtureTile(FIXTURE_ZOOM - 1, x / 2, y / 2));
+    QVERIFY(m_cache->GetImageFromCache(MapType::GoogleMap, Point(x, y), FIXTURE_ZOOM).isEmpty());
+}
+
+void tst_MBTiles::importKeepsCachedTiles()
+{
+    QByteArray fetched("fetched");
+
+    m_cache->PutImageToCache(fetched, MapType::GoogleSatellite, Point(FIXTURE_X, FIXTURE_Y), FIXTURE_ZOOM);
+    QCOMPARE(m_cache->ImportMBTiles(m_fixture, MapType::GoogleSatellite), FIXTURE_SIZE - 1);
+    QCOMPARE(m_cache->GetImageFromCache(MapType::GoogleSatellite, Point(FIXTURE_X, FIXTURE_Y), FIXTURE_ZOOM), fetched);
+
+    // a second import adds nothing
+    QCOMPARE(m_cache->ImportMBTiles(m_fixture, MapType::GoogleSatellite), 0);
+    QCOMPARE(countRows(m_dir->path() + "/cache/Data.qmdb", "SELECT COUNT(*) FROM Tiles"), FIXTURE_SIZE);
+}
+
+void tst_MBTiles::progressPerBatch()
+{
+    MBTilesProgress progress;
+    QSignalSpy spy(&progress, SIGNAL(progressChanged(int, int)));
+
+    QCOMPARE(m_cache->ImportMBTiles(m_fixture, MapType::GoogleSatellite, &progress), FIXTURE_SIZE);
+
+    // one report per full batch and a last one
+    QCOMPARE(spy.count(), FIXTURE_SIZE / PureImageCache::MBTilesBatch + 1);
+    QCOMPARE(spy.first().at(0).toInt(), (int)PureImageCache::MBTilesBatch);
+    QCOMPARE(spy.last().at(0).toInt(), FIXTURE_SIZE);
+    QCOMPARE(spy.last().at(1).toInt(), FIXTURE_SIZE);
+}
+
+void tst_MBTiles::cancelAfterBatch()
+{
+    MBTilesProgress progress;
+
+    connect(&progress, SIGNAL(progressChanged(int, int)), &progress, SLOT(Cancel()));
+    QCOMPARE(m_cache->ImportMBTiles(m_fixture, MapType::GoogleSatellite, &progress), (int)PureImageCache::MBTilesBatch);
+    QCOMPARE(countRows(m_dir->path() + "/cache/Data.qmdb", "SELECT COUNT(*) FROM Tiles"), (int)PureImageCache::MBTilesBatch);
+}
+
+void tst_MBTiles::exportRoundTrip()
+{
+    QString exported = m_dir->path() + "/exported.mbtiles";
+
+    QCOMPARE(m_cache->ImportMBTiles(m_fixture, MapType::GoogleSatellite), FIXTURE_SIZE);
+    // a tile fetched twice is in the cache twice
+    m_cache->PutImageToCache(fixtureTile(FIXTURE_ZOOM, FIXTURE_X, FIXTURE_Y), MapType::GoogleSatellite, Point(FIXTURE_X, FIXTURE_Y), FIXTURE_ZOOM);
+
+    QCOMPARE(m_cache->ExportMBTiles(exported, MapType::GoogleSatellite, 0, 20), FIXTURE_SIZE + 1);
+    QCOMPARE(countRows(exported, "SELECT COUNT(*) FROM tiles"), FIXTURE_SIZE);
+
+    {
+        QSqlDatabase db = QSqlDatabase::addDatabase("QSQLITE", "exported");
+        db.setDatabaseName(exported);
+        QVERIFY(db.open());
+        QSqlQuery query(db);
+        // same rows and data as the fixture
+        QVERIFY(query.exec(QString("ATTACH DATABASE '%1' AS fixture").arg(m_fixture)));
+        QVERIFY(query.exec("SELECT COUNT(*) FROM tiles JOIN fixture.tiles AS f USING (zoom_level, tile_column, tile_row) WHERE f.tile_data = tiles.tile_data"));
+        QVERIFY(query.next());
+        QCOMPARE(query.value(0).toInt(), FIXTURE_SIZE);
+
+        QMap<QString, QString> metadata;
+        QVERIFY(query.exec("SELECT name, value FROM metadata"));
+        while (query.next()) {
+            metadata.insert(query.value(0).toString(), query.value(1).toString());
+        }
+        QCOMPARE(metadata.value("format"), QString("png"));
+        QCOMPARE(metadata.value("minzoom"), QString::number(FIXTURE_ZOOM - 1));
+        QCOMPARE(metadata.value("maxzoom"), QString::number(FIXTURE_ZOOM));
+        QCOMPARE(metadata.value("name"), MapType::StrByType(MapType::GoogleSatellite));
+
+        // west,south,east,north of the zoom 11 tiles
+        QStringList bounds = metadata.value("bounds").split(",");
+        QCOMPARE(bounds.count(), 4);
+        QVERIFY(qAbs(bounds.at(0).toDouble() - ((FIXTURE_X / 2) / 2048.0 * 360.0 - 180.0)) < 1e-6);
+        QVERIFY(qAbs(bounds.at(2).toDouble() - ((FIXTURE_X + FIXTURE_W) / 2 / 2048.0 * 360.0 - 180.0)) < 1e-6);
+        QVERIFY(bounds.at(1).toDouble() < bounds.at(3).toDouble());
+        db.close();
+    }
+    QSqlDatabase::removeDatabase("exported");
+
+    // exporting again replaces the tiles
+    QCOMPARE(m_cache->ExportMBTiles(exported, MapType::GoogleSatellite, FIXTURE_ZOOM, FIXTURE_ZOOM), FIXTURE_W * FIXTURE_H + 1);
+    QCOMPARE(countRows(exported, "SELECT COUNT(*) FROM tiles"), FIXTURE_SIZE);
+    QCOMPARE(countRows(exported, "SELECT COUNT(*) FROM metadata WHERE name = 'minzoom'"), 1);
+}
+
+void tst_MBTiles::exportOtherTypeIsEmpty()
+{
+    QString exported = m_dir->path() + "/empty.mbtiles";
+
+    QCOMPARE(m_cache->ImportMBTiles(m_fixture, MapType::GoogleSatellite), FIXTURE_SIZE);
+    QCOMPARE(m_cache->ExportMBTiles(exported, MapType::GoogleMap, 0, 20), 0);
+    QCOMPARE(countRows(exported, "SELECT COUNT(*) FROM tiles"), 0);
+}
+
+void tst_MBTiles::benchmarkImport()
+{
+    int run = 0;
+
+    QBENCHMARK {
+        // a new cache each time, an import into a full cache only looks tiles up
+        PureImageCache cache;
+        cache.setGtileCache(m_dir->path() + QString("/bench%1/").arg(run++));
+        QCOMPARE(cache.ImportMBTiles(m_fixture, MapType::GoogleSatellite), FIXTURE_SIZE);
+    }
+}
+
+void tst_MBTiles::benchmarkExport()
+{
+    QString exported = m_dir->path() + "/bench.mbtiles";
+
+    QCOMPARE(m_cache->ImportMBTiles(m_fixture, MapType::GoogleSatellite), FIXTURE_SIZE);
+    QBENCHMARK {
+        QCOMPARE(m_cache->ExportMBTiles(exported, MapType::GoogleSatellite, 0, 20), FIXTURE_SIZE);
+    }
+}
+
+QTEST_MAIN(tst_MBTiles)
+
+#include "tst_mbtiles.moc"
@@ -0,0 +1,14 @@
+CONFIG += qtestlib
+TEMPLATE = app
+CONFIG -= app_bundle
+
+QT += widgets
+
+include(../../../../../openpilotgcs.pri)
+
+# Links the built map widget, it brings the core and internals along
+include(../../opmapcontrol.pri)
+
+INCLUDEPATH += ../../src/mapwidget
+
+SOURCES += tst_overlays.cpp
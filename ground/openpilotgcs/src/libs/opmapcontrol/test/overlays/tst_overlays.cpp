@@ -0,0 +1,247 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_overlays.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Waypoint overlays of a large mission while panning and zooming
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "mapgraphicitem.h"
+#include "waypointitem.h"
+#include "waypointline.h"
+#include "waypointpath.h"
+#include "configuration.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QObject>
+#include <QGraphicsScene>
+#include <QPainter>
+
+// A survey of 80x50 waypoints, several screens wide at ZOOM
+#define COLUMNS     80
+#define ROWS        50
+#define SPACING     0.005
+#define CENTER_LAT  46.5
+#define CENTER_LNG  6.6
+#define ZOOM        14
+#define VIEW_WIDTH  1024
+#define VIEW_HEIGHT 768
+#define PAN_STEP    32
+#define PAN_STEPS   16
+
+using namespace mapcontrol;
+
+class tst_Overlays : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void invalidationKeepsOverlays();
+    void onePassPerDragStep();
+    void offscreenWaypointsAreNotMoved();
+    void offscreenWaypointIsPlaced();
+    void linesAreOnePath();
+
+    void benchmarkPan();
+    void benchmarkZoom();
+
+private:
+    void drag(int x, int y);
+    void render();
+
+    Configuration *m_config;
+    internals::Core *m_core;
+    MapGraphicItem *m_map;
+    QGraphicsScene m_scene;
+    QList<WayPointItem *> m_waypoints;
+    QImage m_view;
+};
+
+void tst_Overlays::initTestCase()
+{
+    m_config = new Configuration;
+    m_config->SetAccessMode(core::AccessMode::CacheOnly);
+    m_config->SetCacheLocation(QDir::tempPath() + "/tst_overlays/");
+
+    m_core   = new internals::Core;
+    m_map    = new MapGraphicItem(m_core, m_config);
+    m_scene.setSceneRect(0, 0, VIEW_WIDTH, VIEW_HEIGHT);
+    m_scene.addItem(m_map);
+    m_map->resize();
+    m_core->SetCurrentPosition(internals::PointLatLng(CENTER_LAT, CENTER_LNG));
+    m_core->SetZoom(ZOOM);
+    m_core->StartSystem();
+
+    // back and forth along the rows, the lines as the plugin makes them
+    WayPointItem *previous = 0;
+    for (int row = 0; row < ROWS; row++) {
+        for (int i = 0; i < COLUMNS; i++) {
+            int column = (row % 2) ? COLUMNS - 1 - i : i;
+            internals::PointLatLng coord(CENTER_LAT + (row - ROWS / 2) * SPACING, CENTER_LNG + (column - COLUMNS / 2) * SPACING);
+            WayPointItem *waypoint = new WayPointItem(coord, 0, QString::number(m_waypoints.count()), m_map);
+            waypoint->setParentItem(m_map);
+            if (previous) {
+                new WayPointLine(previous, waypoint, m_map, Qt::green);
+            }
+            m_waypoints.append(waypoint);
+            previous = waypoint;
+        }
+    }
+    m_view = QImage(VIEW_WIDTH, VIEW_HEIGHT, QImage::Format_ARGB32_Premultiplied);
+    render();
+}
+
+void tst_Overlays::cleanupTestCase()
+{
+    delete m_map;
+    delete m_core;
+    delete m_config;
+}
+
+void tst_Overlays::drag(int x, int y)
+{
+    m_core->DragOffset(core::Point(x, y));
+}
+
+void tst_Overlays::render()
+{
+    QPainter painter(&m_view);
+
+    m_scene.render(&painter);
+}
+
+/*
+ * Each loaded tile asks for a repaint, the overlays stay where they are
+ */
+void tst_Overlays::invalidationKeepsOverlays()
+{
+    int passes = m_map->OverlayPasses();
+
+    for (int i = 0; i < 100; i++) {
+        emit m_core->OnNeedInvalidation();
+    }
+    QCOMPARE(m_map->OverlayPasses(), passes);
+}
+
+/*
+ * The core signals a drag step twice, as invalidations and drags
+ */
+void tst_Overlays::onePassPerDragStep()
+{
+    int passes = m_map->OverlayPasses();
+
+    drag(PAN_STEP, 0);
+    QCOMPARE(m_map->OverlayPasses(), passes + 1);
+    drag(-PAN_STEP, 0);
+    QCOMPARE(m_map->OverlayPasses(), passes + 2);
+}
+
+void tst_Overlays::offscreenWaypointsAreNotMoved()
+{
+    QList<QPointF> before;
+    foreach(WayPointItem * waypoint, m_waypoints) {
+        before.append(waypoint->pos());
+    }
+
+    drag(PAN_STEP, PAN_STEP);
+
+    int moved = 0;
+    for (int i = 0; i < m_waypoints.count(); i++) {
+        WayPointItem *waypoint = m_waypoints.at(i);
+        core::Point point = m_map->FromLatLngToLocal(waypoint->Coord());
+        QPointF local(point.X(), point.Y());
+
+        // the cached projection matches a full one, in view or not
+        QCOMPARE(waypoint->LocalPosition(), local);
+        if (m_map->IsNearView(local)) {
+            QCOMPARE(waypoint->pos(), local);
+        }
+        if (waypoint->pos() != before.at(i)) {
+            moved++;
+        }
+    }
+    QVERIFY(moved > 0);
+    QVERIFY(moved < m_waypoints.count() / 4);
+
+    drag(-PAN_STEP, -PAN_STEP);
+}
+
+/*
+ * Outside of a pan or zoom a waypoint goes where it is, in view or not
+ */
+void tst_Overlays::offscreenWaypointIsPlaced()
+{
+    internals::PointLatLng coord(CENTER_LAT + ROWS * SPACING, CENTER_LNG + COLUMNS * SPACING);
+    WayPointItem *waypoint = new WayPointItem(coord, 0, QString("offscreen"), m_map);
+
+    waypoint->setParentItem(m_map);
+    core::Point point = m_map->FromLatLngToLocal(coord);
+    QPointF local(point.X(), point.Y());
+    QVERIFY(!m_map->IsNearView(local));
+    QCOMPARE(waypoint->pos(), local);
+    delete waypoint;
+}
+
+void tst_Overlays::linesAreOnePath()
+{
+    QCOMPARE(m_map->WPPath()->LineCount(), m_waypoints.count() - 1);
+
+    foreach(QGraphicsItem * item, m_map->childItems()) {
+        WayPointLine *line = qgraphicsitem_cast<WayPointLine *>(item);
+        if (line) {
+            QVERIFY(line->flags() & QGraphicsItem::ItemHasNoContents);
+        }
+    }
+
+    render();
+    QVERIFY(m_map->WPPath()->DrawnLines() > 0);
+    QVERIFY(m_map->WPPath()->DrawnLines() < m_map->WPPath()->LineCount() / 4);
+}
+
+void tst_Overlays::benchmarkPan()
+{
+    QBENCHMARK {
+        for (int i = 0; i < PAN_STEPS; i++) {
+            drag(PAN_STEP, PAN_STEP / 2);
+            render();
+        }
+        for (int i = 0; i < PAN_STEPS; i++) {
+            drag(-PAN_STEP, -PAN_STEP / 2);
+            render();
+        }
+    }
+}
+
+void tst_Overlays::benchmarkZoom()
+{
+    QBENCHMARK {
+        m_core->SetZoom(ZOOM - 1);
+        render();
+        m_core->SetZoom(ZOOM);
+        render();
+    }
+}
+
+QTEST_MAIN(tst_Overlays)
+#include "tst_overlays.moc"
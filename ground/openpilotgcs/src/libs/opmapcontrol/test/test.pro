@@ -0,0 +1,5 @@
+TEMPLATE = subdirs
+
+SUBDIRS = tilepixmapcache \
+    mbtiles \
+    overlays
@@ -0,0 +1,19 @@
+CONFIG += qtestlib
+TEMPLATE = app
+CONFIG -= app_bundle
+
+QT += widgets
+
+include(../../../../../openpilotgcs.pri)
+
+INCLUDEPATH += ../../src/mapwidget
+
+HEADERS += ../../src/mapwidget/tilepixmapcache.h \
+    ../../src/internals/tile.h \
+    ../../src/core/maptype.h
+
+SOURCES += tst_tilepixmapcache.cpp \
+    ../../src/mapwidget/tilepixmapcache.cpp \
+    ../../src/internals/tile.cpp \
+    ../../src/core/point.cpp \
+    ../../src/core/size.cpp
@@ -0,0 +1,300 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_tilepixmapcache.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Map tile drawing while panning, with and without the pixmap cache
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup   OPMapWidget
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "tilepixmapcache.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QObject>
+#include <QBuffer>
+#include <QPainter>
+
+// The fixed tile set, 4096x3072 pixels, panned through a 1024x768 view
+#define TILE_SIZE   256
+#define TILES_X     16
+#define TILES_Y     12
+#define VIEW_WIDTH  1024
+#define VIEW_HEIGHT 768
+#define PAN_STEP    32
+#define ZOOM        12
+
+using namespace mapcontrol;
+
+class tst_TilePixmapCache : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void secondPaintHitsCache();
+    void loaderImagesAreUsed();
+    void overlaysAreComposed();
+    void devicePixelRatio();
+    void retainDropsFarTiles();
+    void costIsBounded();
+
+    void benchmarkPanDecodeEachPaint();
+    void benchmarkPanCached();
+
+private:
+    QByteArray encodeTile(int x, int y, bool transparent);
+    internals::Tile *tileAt(int x, int y);
+    void paintView(QPainter *painter, int offsetX, int offsetY, TilePixmapCache *cache);
+    void pan(TilePixmapCache *cache);
+
+    QList<internals::Tile *> m_tiles;
+    QImage m_view;
+};
+
+/*
+ * Tiles with some noise so that they compress and decode like map tiles rather
+ * than like flat color fills
+ */
+QByteArray tst_TilePixmapCache::encodeTile(int x, int y, bool transparent)
+{
+    QImage image(TILE_SIZE, TILE_SIZE, transparent ? QImage::Format_ARGB32 : QImage::Format_RGB32);
+
+    qsrand(x * TILES_Y + y);
+    for (int row = 0; row < TILE_SIZE; row++) {
+        QRgb *line = (QRgb *)image.scanLine(row);
+        for (int col = 0; col < TILE_SIZE; col++) {
+            int noise = qrand() % 32;
+            if (transparent) {
+                // labels over the right half only
+                line[col] = qRgba(255, 255, 255 - noise, col < TILE_SIZE / 2 ? 0 : 128);
+            } else {
+                line[col] = qRgb(x * 15 + noise, y * 20 + noise, (row + col) / 2);
+            }
+        }
+    }
+
+    QByteArray bytes;
+    QBuffer buffer(&bytes);
+    buffer.open(QIODevice::WriteOnly);
+    image.save(&buffer, "PNG");
+    return bytes;
+}
+
+void tst_TilePixmapCache::initTestCase()
+{
+    for (int y = 0; y < TILES_Y; y++) {
+        for (int x = 0; x < TILES_X; x++) {
+            internals::Tile *tile = new internals::Tile(ZOOM, core::Point(x, y));
+            tile->Overlays.append(encodeTile(x, y, false));
+            m_tiles.append(tile);
+        }
+    }
+    m_view = QImage(VIEW_WIDTH, VIEW_HEIGHT, QImage::Format_ARGB32_Premultiplied);
+}
+
+void tst_TilePixmapCache::cleanupTestCase()
+{
+    qDeleteAll(m_tiles);
+}
+
+internals::Tile *tst_TilePixmapCache::tileAt(int x, int y)
+{
+    if (x < 0 || y < 0 || x >= TILES_X || y >= TILES_Y) {
+        return 0;
+    }
+    return m_tiles.at(y * TILES_X + x);
+}
+
+/*
+ * The tile loop of MapGraphicItem::DrawMap2D, without the core
+ */
+void tst_TilePixmapCache::paintView(QPainter *painter, int offsetX, int offsetY, TilePixmapCache *cache)
+{
+    QRect drawn;
+
+    for (int y = offsetY / TILE_SIZE; y * TILE_SIZE < offsetY + VIEW_HEIGHT; y++) {
+        for (int x = offsetX / TILE_SIZE; x * TILE_SIZE < offsetX + VIEW_WIDTH; x++) {
+            internals::Tile *tile = tileAt(x, y);
+            QRect rect(x * TILE_SIZE - offsetX, y * TILE_SIZE - offsetY, TILE_SIZE, TILE_SIZE);
+            drawn |= QRect(x, y, 1, 1);
+            if (tile == 0) {
+                continue;
+            }
+            if (cache) {
+                QPixmap pixmap = cache->Pixmap(core::MapType::GoogleSatellite, ZOOM, core::Point(x, y), tile, rect.size(), 1);
+                painter->drawPixmap(rect, pixmap);
+            } else {
+                foreach(QByteArray img, tile->Overlays) {
+                    painter->drawPixmap(rect, QPixmap::fromImage(QImage::fromData(img)));
+                }
+            }
+        }
+    }
+    if (cache) {
+        cache->Retain(core::MapType::GoogleSatellite, ZOOM, 1, drawn);
+    }
+}
+
+/*
+ * Diagonally across the tile set and back, one repaint per step
+ */
+void tst_TilePixmapCache::pan(TilePixmapCache *cache)
+{
+    const int steps = (TILES_X * TILE_SIZE - VIEW_WIDTH) / PAN_STEP;
+    QPainter painter(&m_view);
+
+    for (int step = 0; step <= 2 * steps; step++) {
+        int position = step <= steps ? step : 2 * steps - step;
+        paintView(&painter, position * PAN_STEP, position * (TILES_Y * TILE_SIZE - VIEW_HEIGHT) / steps, cache);
+    }
+}
+
+void tst_TilePixmapCache::secondPaintHitsCache()
+{
+    TilePixmapCache cache;
+    QPainter painter(&m_view);
+
+    paintView(&painter, 100, 100, &cache);
+    int misses = cache.Misses();
+    QCOMPARE(cache.Hits(), 0);
+    QCOMPARE(misses, 5 * 4);
+
+    paintView(&painter, 100, 100, &cache);
+    QCOMPARE(cache.Misses(), misses);
+    QCOMPARE(cache.Hits(), misses);
+
+    // panning by less than a tile decodes nothing new
+    paintView(&painter, 200, 150, &cache);
+    QCOMPARE(cache.Misses(), misses);
+}
+
+void tst_TilePixmapCache::loaderImagesAreUsed()
+{
+    TilePixmapCache cache;
+    internals::Tile tile(ZOOM, core::Point(0, 0));
+    QImage decoded(TILE_SIZE, TILE_SIZE, QImage::Format_RGB32);
+
+    // the bytes would decode to a null image, the pixels must come from the loader
+    decoded.fill(qRgb(10, 200, 30));
+    tile.Overlays.append(QByteArray("not an image"));
+    tile.Images.append(decoded);
+
+    QPixmap pixmap = cache.Pixmap(core::MapType::GoogleMap, ZOOM, core::Point(0, 0), &tile, QSize(TILE_SIZE, TILE_SIZE), 1);
+    QCOMPARE(pixmap.toImage().pixel(10, 10), qRgb(10, 200, 30));
+    QVERIFY(tile.Images.isEmpty());
+}
+
+void tst_TilePixmapCache::overlaysAreComposed()
+{
+    TilePixmapCache cache;
+    internals::Tile tile(ZOOM, core::Point(3, 4));
+
+    tile.Overlays.append(encodeTile(3, 4, false));
+    tile.Overlays.append(encodeTile(3, 4, true));
+
+    QImage base   = QImage::fromData(tile.Overlays.at(0));
+    QImage labels = QImage::fromData(tile.Overlays.at(1));
+    QImage expected(TILE_SIZE, TILE_SIZE, QImage::Format_ARGB32_Premultiplied);
+    expected.fill(Qt::transparent);
+    {
+        QPainter painter(&expected);
+        painter.drawImage(0, 0, base);
+        painter.drawImage(0, 0, labels);
+    }
+
+    QImage composed = cache.Pixmap(core::MapType::GoogleHybrid, ZOOM, core::Point(3, 4), &tile, QSize(TILE_SIZE, TILE_SIZE), 1).toImage();
+    // left half shows the base only, right half the labels over it
+    QCOMPARE(composed.pixel(10, 10), expected.pixel(10, 10));
+    QCOMPARE(composed.pixel(200, 10), expected.pixel(200, 10));
+    QVERIFY(composed.pixel(200, 10) != base.pixel(200, 10));
+}
+
+void tst_TilePixmapCache::devicePixelRatio()
+{
+    TilePixmapCache cache;
+    internals::Tile *tile = tileAt(1, 1);
+
+    QPixmap normal = cache.Pixmap(core::MapType::GoogleMap, ZOOM, core::Point(1, 1), tile, QSize(TILE_SIZE, TILE_SIZE), 1);
+    QPixmap retina = cache.Pixmap(core::MapType::GoogleMap, ZOOM, core::Point(1, 1), tile, QSize(TILE_SIZE, TILE_SIZE), 2);
+
+    QCOMPARE(normal.size(), QSize(TILE_SIZE, TILE_SIZE));
+    QCOMPARE(retina.size(), QSize(2 * TILE_SIZE, 2 * TILE_SIZE));
+    QCOMPARE((int)retina.devicePixelRatio(), 2);
+    QCOMPARE(cache.Count(), 2);
+
+    // the view moved to the high resolution screen
+    cache.Retain(core::MapType::GoogleMap, ZOOM, 2, QRect(0, 0, 4, 3));
+    QCOMPARE(cache.Count(), 1);
+    cache.Pixmap(core::MapType::GoogleMap, ZOOM, core::Point(1, 1), tile, QSize(TILE_SIZE, TILE_SIZE), 2);
+    QCOMPARE(cache.Hits(), 1);
+}
+
+void tst_TilePixmapCache::retainDropsFarTiles()
+{
+    // room for the whole tile set
+    TilePixmapCache cache(2 * TILES_X * TILES_Y * TILE_SIZE * TILE_SIZE * 4 / 1024);
+
+    for (int y = 0; y < TILES_Y; y++) {
+        for (int x = 0; x < TILES_X; x++) {
+            cache.Pixmap(core::MapType::GoogleMap, ZOOM, core::Point(x, y), tileAt(x, y), QSize(TILE_SIZE, TILE_SIZE), 1);
+        }
+    }
+    cache.Pixmap(core::MapType::GoogleMap, ZOOM + 1, core::Point(0, 0), tileAt(0, 0), QSize(TILE_SIZE, TILE_SIZE), 1);
+    cache.Pixmap(core::MapType::GoogleSatellite, ZOOM, core::Point(0, 0), tileAt(0, 0), QSize(TILE_SIZE, TILE_SIZE), 1);
+    QCOMPARE(cache.Count(), TILES_X * TILES_Y + 2);
+
+    // a 4x3 view in the middle keeps 8x7 tiles around it
+    cache.Retain(core::MapType::GoogleMap, ZOOM, 1, QRect(6, 4, 4, 3));
+    QCOMPARE(cache.Count(), (4 + 2 * TilePixmapCache::RetainMargin) * (3 + 2 * TilePixmapCache::RetainMargin));
+
+    cache.Clear();
+    QCOMPARE(cache.Count(), 0);
+}
+
+void tst_TilePixmapCache::costIsBounded()
+{
+    // room for 10 tiles
+    TilePixmapCache cache(10 * TILE_SIZE * TILE_SIZE * 4 / 1024);
+
+    pan(&cache);
+    QVERIFY(cache.TotalCost() <= cache.MaxCost());
+    QVERIFY(cache.Count() <= 10);
+}
+
+void tst_TilePixmapCache::benchmarkPanDecodeEachPaint()
+{
+    QBENCHMARK {
+        pan(0);
+    }
+}
+
+void tst_TilePixmapCache::benchmarkPanCached()
+{
+    QBENCHMARK {
+        TilePixmapCache cache;
+        pan(&cache);
+    }
+}
+
+QTEST_MAIN(tst_TilePixmapCache)
+
+#include "tst_tilepixmapcache.moc"
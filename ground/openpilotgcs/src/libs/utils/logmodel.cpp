@@ -0,0 +1,240 @@
+/**
+ ******************************************************************************
+ *
+ * @file       logmodel.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Bounded log messages for the debug and console gadgets
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "logmodel.h"
+
+#include <QColor>
+#include <QMetaObject>
+
+namespace Utils {
+LogModel::LogModel(int capacity, QObject *parent) : QAbstractListModel(parent),
+    m_capacity(qMax(capacity, 1)), m_first(0), m_count(0), m_flushQueued(false), m_dropped(0)
+{
+    m_entries.resize(m_capacity);
+}
+
+int LogModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_count;
+}
+
+QVariant LogModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_count) {
+        return QVariant();
+    }
+    const Entry &e = entry(index.row());
+
+    switch (role) {
+    case Qt::DisplayRole:
+        // formatted for the rows shown only
+        return QString("[%1] [%2] %3").arg(e.time.toString("hh:mm:ss.zzz"), levelName(e.level), e.message);
+
+    case Qt::ForegroundRole:
+        if (e.level >= WarningLevel) {
+            return QColor(Qt::red);
+        }
+        return QVariant();
+
+    case LevelRole:
+        return (int)e.level;
+
+    case CategoryRole:
+        return e.category;
+
+    case MessageRole:
+        return e.message;
+
+    case TimeRole:
+        return e.time;
+
+    default:
+        return QVariant();
+    }
+}
+
+void LogModel::append(Level level, const QString &category, const QString &message)
+{
+    Entry e;
+
+    e.time     = QTime::currentTime();
+    e.level    = level;
+    e.category = category;
+    e.message  = message;
+
+    QMutexLocker lock(&m_pendingLock);
+    if (m_pending.count() >= m_capacity) {
+        // it would not survive the next flush anyway
+        m_pending.removeFirst();
+        ++m_dropped;
+    }
+    m_pending.append(e);
+    if (!m_flushQueued) {
+        m_flushQueued = true;
+        QMetaObject::invokeMethod(this, "flush", Qt::QueuedConnection);
+    }
+}
+
+void LogModel::flush()
+{
+    QList<Entry> pending;
+    {
+        QMutexLocker lock(&m_pendingLock);
+        pending.swap(m_pending);
+        m_flushQueued = false;
+    }
+    if (pending.isEmpty()) {
+        return;
+    }
+
+    int overflow = m_count + pending.count() - m_capacity;
+    if (overflow > 0) {
+        beginRemoveRows(QModelIndex(), 0, overflow - 1);
+        m_first  = (m_first + overflow) % m_capacity;
+        m_count -= overflow;
+        endRemoveRows();
+
+        QMutexLocker lock(&m_pendingLock);
+        m_dropped += overflow;
+    }
+
+    QStringList added;
+    beginInsertRows(QModelIndex(), m_count, m_count + pending.count() - 1);
+    foreach(const Entry &e, pending) {
+        m_entries[(m_first + m_count) % m_capacity] = e;
+        ++m_count;
+        if (!e.category.isEmpty() && !m_categories.contains(e.category)) {
+            m_categories.append(e.category);
+            added.append(e.category);
+        }
+    }
+    endInsertRows();
+
+    foreach(const QString &category, added) {
+        emit categoryAdded(category);
+    }
+}
+
+void LogModel::clear()
+{
+    beginResetModel();
+    m_entries.fill(Entry());
+    m_first = 0;
+    m_count = 0;
+    endResetModel();
+}
+
+quint64 LogModel::droppedCount() const
+{
+    QMutexLocker lock(&m_pendingLock);
+
+    return m_dropped;
+}
+
+QString LogModel::toText() const
+{
+    QString text;
+
+    for (int row = 0; row < m_count; row++) {
+        text.append(data(index(row), Qt::DisplayRole).toString());
+        text.append('\n');
+    }
+    return text;
+}
+
+QString LogModel::levelName(Level level)
+{
+    switch (level) {
+    case TraceLevel:
+        return "Trace";
+
+    case DebugLevel:
+        return "Debug";
+
+    case InfoLevel:
+        return "Info";
+
+    case WarningLevel:
+        return "Warning";
+
+    case ErrorLevel:
+        return "Error";
+
+    case CriticalLevel:
+        return "Critical";
+
+    case FatalLevel:
+        return "Fatal";
+    }
+    return QString();
+}
+
+LogFilterModel::LogFilterModel(QObject *parent) : QSortFilterProxyModel(parent),
+    m_minimumLevel(LogModel::TraceLevel)
+{}
+
+void LogFilterModel::setMinimumLevel(int level)
+{
+    m_minimumLevel = (LogModel::Level)level;
+    invalidateFilter();
+}
+
+void LogFilterModel::setCategory(const QString &category)
+{
+    m_category = category;
+    invalidateFilter();
+}
+
+int LogFilterModel::find(const QString &text, int from, bool backward) const
+{
+    int count = rowCount();
+
+    if (text.isEmpty()) {
+        return -1;
+    }
+    if (backward && from < 0) {
+        from = count;
+    }
+    int step = backward ? -1 : 1;
+    for (int row = from + step; row >= 0 && row < count; row += step) {
+        if (index(row, 0).data(LogModel::MessageRole).toString().contains(text, Qt::CaseInsensitive)) {
+            return row;
+        }
+    }
+    return -1;
+}
+
+bool LogFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+    QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
+
+    if (index.data(LogModel::LevelRole).toInt() < m_minimumLevel) {
+        return false;
+    }
+    return m_category.isEmpty() || index.data(LogModel::CategoryRole).toString() == m_category;
+}
+}
@@ -0,0 +1,147 @@
+/**
+ ******************************************************************************
+ *
+ * @file       logmodel.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Bounded log messages for the debug and console gadgets
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef LOGMODEL_H
+#define LOGMODEL_H
+
+#include "utils_global.h"
+#include <QAbstractListModel>
+#include <QSortFilterProxyModel>
+#include <QVector>
+#include <QList>
+#include <QStringList>
+#include <QMutex>
+#include <QTime>
+
+namespace Utils {
+/*
+ * The last messages of the application, for a list view.
+ *
+ * append() may be called from any thread, the messages are queued and moved
+ * to the model at most once per event loop pass, so a burst of messages costs
+ * the view one insertion. The model keeps at most capacity() messages, the
+ * oldest are dropped, and the queue is bounded the same way.
+ */
+class QTCREATOR_UTILS_EXPORT LogModel : public QAbstractListModel {
+    Q_OBJECT
+
+public:
+    enum Level { TraceLevel, DebugLevel, InfoLevel, WarningLevel, ErrorLevel, CriticalLevel, FatalLevel };
+    enum Roles { LevelRole = Qt::UserRole, CategoryRole, MessageRole, TimeRole };
+
+    static const int DefaultCapacity = 10000;
+
+    explicit LogModel(int capacity = DefaultCapacity, QObject *parent = 0);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+
+    void append(Level level, const QString &category, const QString &message);
+
+    int capacity() const
+    {
+        return m_capacity;
+    }
+    // Messages dropped so far, from the model or from the queue
+    quint64 droppedCount() const;
+    QStringList categories() const
+    {
+        return m_categories;
+    }
+    // The whole log as text, one message per line
+    QString toText() const;
+
+    static QString levelName(Level level);
+
+public slots:
+    void flush();
+    void clear();
+
+signals:
+    void categoryAdded(const QString &category);
+
+private:
+    struct Entry {
+        QTime   time;
+        Level   level;
+        QString category;
+        QString message;
+    };
+
+    const Entry &entry(int row) const
+    {
+        return m_entries.at((m_first + row) % m_capacity);
+    }
+
+    int m_capacity;
+    QVector<Entry> m_entries;
+    int m_first;
+    int m_count;
+    QStringList m_categories;
+
+    mutable QMutex m_pendingLock;
+    QList<Entry> m_pending;
+    bool m_flushQueued;
+    quint64 m_dropped;
+};
+
+/*
+ * Filters a LogModel by lowest level and category, and finds text in the
+ * filtered messages.
+ */
+class QTCREATOR_UTILS_EXPORT LogFilterModel : public QSortFilterProxyModel {
+    Q_OBJECT
+
+public:
+    explicit LogFilterModel(QObject *parent = 0);
+
+    LogModel::Level minimumLevel() const
+    {
+        return m_minimumLevel;
+    }
+    QString category() const
+    {
+        return m_category;
+    }
+    // Row of the next message containing text after row from, -1 if none
+    int find(const QString &text, int from = -1, bool backward = false) const;
+
+public slots:
+    void setMinimumLevel(int level);
+    // An empty category shows them all
+    void setCategory(const QString &category);
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const;
+
+private:
+    LogModel::Level m_minimumLevel;
+    QString m_category;
+};
+}
+
+#endif // LOGMODEL_H
@@ -0,0 +1,15 @@
+CONFIG += qtestlib
+TEMPLATE = app
+CONFIG -= app_bundle
+
+QT += widgets
+
+include(../../../../openpilotgcs.pri)
+
+# Built in, not linked against the Utils library
+DEFINES += QTCREATOR_UTILS_STATIC_LIB
+
+HEADERS += ../logmodel.h
+
+SOURCES += tst_logmodel.cpp \
+    ../logmodel.cpp
@@ -0,0 +1,279 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_logmodel.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @brief      Log model under bursts of messages, with a view attached
+ * @see        The GNU Public License (GPL) Version 3
+ * @defgroup
+ * @{
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "../logmodel.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QObject>
+#include <QThread>
+#include <QListView>
+#include <QElapsedTimer>
+
+#define CAPACITY    1000
+#define BURST       200000
+#define WRITERS     4
+// the longest the event loop may be kept busy by a burst, in ms
+#define MAX_LATENCY 250
+
+using namespace Utils;
+
+class Writer : public QThread {
+public:
+    Writer(LogModel *model, int count) : m_model(model), m_count(count)
+    {}
+
+protected:
+    void run()
+    {
+        for (int i = 0; i < m_count; i++) {
+            m_model->append(LogModel::DebugLevel, "writer", QString("message %1").arg(i));
+        }
+    }
+
+private:
+    LogModel *m_model;
+    int m_count;
+};
+
+class tst_LogModel : public QObject {
+    Q_OBJECT
+
+private slots:
+    void keepsNewestMessages();
+    void appendsAreBatched();
+    void queueIsBounded();
+    void appendFromThreads();
+    void filterByLevelAndCategory();
+    void findWithoutView();
+    void qDebugBurstLatency();
+
+    void benchmarkAppend();
+
+private:
+    static void messageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg);
+    static LogModel *s_model;
+};
+
+LogModel *tst_LogModel::s_model = 0;
+
+void tst_LogModel::messageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg)
+{
+    s_model->append(type == QtDebugMsg ? LogModel::DebugLevel : LogModel::WarningLevel,
+                    context.category ? QString::fromLatin1(context.category) : QString(), msg);
+}
+
+void tst_LogModel::keepsNewestMessages()
+{
+    LogModel model(CAPACITY);
+
+    for (int i = 0; i < CAPACITY * 5 / 2; i++) {
+        model.append(LogModel::InfoLevel, "test", QString::number(i));
+        if (i % 300 == 0) {
+            model.flush();
+        }
+    }
+    model.flush();
+
+    QCOMPARE(model.rowCount(), CAPACITY);
+    QCOMPARE(model.index(0).data(LogModel::MessageRole).toString(), QString::number(CAPACITY * 3 / 2));
+    QCOMPARE(model.index(CAPACITY - 1).data(LogModel::MessageRole).toString(), QString::number(CAPACITY * 5 / 2 - 1));
+    QCOMPARE(model.droppedCount(), (quint64)CAPACITY * 3 / 2);
+}
+
+void tst_LogModel::appendsAreBatched()
+{
+    LogModel model(CAPACITY);
+    QSignalSpy inserted(&model, SIGNAL(rowsInserted(QModelIndex, int, int)));
+
+    for (int i = 0; i < CAPACITY / 2; i++) {
+        model.append(LogModel::InfoLevel, "test", QString::number(i));
+    }
+    // nothing reaches the model before the event loop runs
+    QCOMPARE(model.rowCount(), 0);
+
+    QCoreApplication::processEvents();
+    QCOMPARE(inserted.count(), 1);
+    QCOMPARE(model.rowCount(), CAPACITY / 2);
+}
+
+void tst_LogModel::queueIsBounded()
+{
+    LogModel model(CAPACITY);
+
+    for (int i = 0; i < CAPACITY * 3; i++) {
+        model.append(LogModel::InfoLevel, "test", QString::number(i));
+    }
+    QCOMPARE(model.droppedCount(), (quint64)CAPACITY * 2);
+
+    QCoreApplication::processEvents();
+    QCOMPARE(model.rowCount(), CAPACITY);
+    QCOMPARE(model.index(0).data(LogModel::MessageRole).toString(), QString::number(CAPACITY * 2));
+}
+
+void tst_LogModel::appendFromThreads()
+{
+    LogModel model(CAPACITY);
+    QList<Writer *> writers;
+
+    for (int i = 0; i < WRITERS; i++) {
+        writers.append(new Writer(&model, CAPACITY));
+        writers.last()->start();
+    }
+    foreach(Writer * writer, writers) {
+        writer->wait();
+    }
+    qDeleteAll(writers);
+    QCoreApplication::processEvents();
+
+    QCOMPARE(model.rowCount(), CAPACITY);
+    QCOMPARE(model.droppedCount() + model.rowCount(), (quint64)CAPACITY * WRITERS);
+}
+
+void tst_LogModel::filterByLevelAndCategory()
+{
+    LogModel model(CAPACITY);
+    LogFilterModel filter;
+    QSignalSpy categories(&model, SIGNAL(categoryAdded(QString)));
+
+    filter.setSourceModel(&model);
+    for (int i = 0; i < 100; i++) {
+        model.append(i % 10 ? LogModel::DebugLevel : LogModel::WarningLevel, i % 2 ? "telemetry" : "map", QString::number(i));
+    }
+    model.flush();
+    QCOMPARE(filter.rowCount(), 100);
+    QCOMPARE(categories.count(), 2);
+
+    filter.setMinimumLevel(LogModel::WarningLevel);
+    QCOMPARE(filter.rowCount(), 10);
+
+    filter.setMinimumLevel(LogModel::TraceLevel);
+    filter.setCategory("telemetry");
+    QCOMPARE(filter.rowCount(), 50);
+
+    // new messages go through the filter too
+    model.append(LogModel::DebugLevel, "telemetry", "late");
+    model.append(LogModel::DebugLevel, "map", "late");
+    model.flush();
+    QCOMPARE(filter.rowCount(), 51);
+}
+
+void tst_LogModel::findWithoutView()
+{
+    LogModel model(CAPACITY);
+    LogFilterModel filter;
+
+    filter.setSourceModel(&model);
+    for (int i = 0; i < 100; i++) {
+        model.append(LogModel::InfoLevel, "test", i % 25 ? QString("message %1").arg(i) : QString("Link lost %1").arg(i));
+    }
+    model.flush();
+
+    QCOMPARE(filter.find("link lost"), 0);
+    QCOMPARE(filter.find("link lost", 0), 25);
+    QCOMPARE(filter.find("link lost", 75), -1);
+    QCOMPARE(filter.find("link lost", -1, true), 75);
+    QCOMPARE(filter.find("link lost", 75, true), 50);
+    QCOMPARE(filter.find(""), -1);
+}
+
+/*
+ * A burst of qDebug output from threads, as telemetry errors make it, while a
+ * view shows the log: the event loop must keep turning
+ */
+void tst_LogModel::qDebugBurstLatency()
+{
+    LogModel model(LogModel::DefaultCapacity);
+    LogFilterModel filter;
+    QListView view;
+
+    filter.setSourceModel(&model);
+    view.setUniformItemSizes(true);
+    view.setModel(&filter);
+    view.resize(640, 480);
+    view.show();
+    QTest::qWaitForWindowExposed(&view);
+
+    s_model = &model;
+    QtMessageHandler previous = qInstallMessageHandler(messageHandler);
+
+    class Burst : public QThread {
+protected:
+        void run()
+        {
+            for (int i = 0; i < BURST / WRITERS; i++) {
+                qDebug() << "telemetry error" << i;
+            }
+        }
+    };
+    QList<Burst *> bursts;
+    for (int i = 0; i < WRITERS; i++) {
+        bursts.append(new Burst);
+        bursts.last()->start();
+    }
+
+    QElapsedTimer pass;
+    qint64 latency = 0;
+    int passes     = 0;
+    bool running   = true;
+    while (running) {
+        running = false;
+        foreach(Burst * burst, bursts) {
+            running |= burst->isRunning();
+        }
+        pass.start();
+        QCoreApplication::processEvents();
+        latency = qMax(latency, pass.elapsed());
+        passes++;
+    }
+    QCoreApplication::processEvents();
+
+    qInstallMessageHandler(previous);
+    qDeleteAll(bursts);
+
+    qDebug() << "burst of" << BURST << "messages, event loop passes" << passes << ", longest" << latency << "ms";
+    QCOMPARE(model.rowCount(), (int)LogModel::DefaultCapacity);
+    QCOMPARE(model.droppedCount() + model.rowCount(), (quint64)BURST);
+    QVERIFY(latency < MAX_LATENCY);
+}
+
+void tst_LogModel::benchmarkAppend()
+{
+    LogModel model(LogModel::DefaultCapacity);
+    LogFilterModel filter;
+
+    filter.setSourceModel(&model);
+
+    QBENCHMARK {
+        for (int i = 0; i < LogModel::DefaultCapacity; i++) {
+            model.append(LogModel::DebugLevel, "benchmark", "telemetry error");
+        }
+        QCoreApplication::processEvents();
+    }
+}
+
+QTEST_MAIN(tst_LogModel)
+#include "tst_logmodel.moc"
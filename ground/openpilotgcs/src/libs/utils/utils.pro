@@ -56,6 +56,7 @@ SOURCES += reloadpromptutils.cpp \
     svgimageprovider.cpp \
     hostosinfo.cpp \
     logfile.cpp \
+    logmodel.cpp \
     crc.cpp \
     mustache.cpp
 
@@ -116,6 +117,7 @@ HEADERS += utils_global.h \
     svgimageprovider.h \
     hostosinfo.h \
     logfile.h \
+    logmodel.h \
     crc.h \
     mustache.h
 
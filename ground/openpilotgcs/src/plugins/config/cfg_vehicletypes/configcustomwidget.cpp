@@ -26,6 +26,7 @@
  */
 #include "configcustomwidget.h"
 #include "mixersettings.h"
+#include "mixergeometrydialog.h"
 
 #include <QDebug>
 #include <QStringList>
@@ -148,6 +149,8 @@ ConfigCustomWidget::ConfigCustomWidget(QWidget *parent) :
     for (int i = 1; i < (int)VehicleConfig::CHANNEL_NUMELEM; i++) {
         m_aircraft->customMixerTable->setItemDelegateForRow(i, sbd);
     }
+
+    connect(m_aircraft->geometryEditorButton, SIGNAL(clicked()), this, SLOT(openGeometryEditor()));
 }
 
 ConfigCustomWidget::~ConfigCustomWidget()
@@ -217,8 +220,10 @@ void ConfigCustomWidget::refreshWidgetsValues(QString frameType)
     // First save set AirframeType to 'Custom' and next modify.
     if (field->getValue().toString() != "Custom") {
         m_aircraft->customMixerTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+        m_aircraft->geometryEditorButton->setEnabled(false);
     } else {
         m_aircraft->customMixerTable->setEditTriggers(QAbstractItemView::AllEditTriggers);
+        m_aircraft->geometryEditorButton->setEnabled(true);
     }
 
     UAVDataObject *mixer = dynamic_cast<UAVDataObject *>(getObjectManager()->getObject(QString("MixerSettings")));
@@ -413,6 +418,35 @@ bool ConfigCustomWidget::throwConfigError(int numMotors)
     return false;
 }
 
+/**
+   Fills the mixer table from the airframe geometry. Channels the geometry
+   does not use are left alone, the whole table then goes to MixerSettings
+   in one update when saved.
+ */
+void ConfigCustomWidget::openGeometryEditor()
+{
+    MixerGeometryDialog dialog((int)VehicleConfig::CHANNEL_NUMELEM, this);
+
+    if (dialog.exec() != QDialog::Accepted) {
+        return;
+    }
+
+    QTableWidget *table = m_aircraft->customMixerTable;
+    foreach(const MixerGeometry::Mix &mix, dialog.mixerGeometry().mixes()) {
+        int channel  = mix.channel;
+        QComboBox *q = (QComboBox *)table->cellWidget(0, channel);
+        if (!q) {
+            continue;
+        }
+        setComboCurrentIndex(q, q->findText((mix.type == MixerGeometry::ACTUATOR_MOTOR) ? "Motor" : "Servo"));
+        table->item(1, channel)->setText(QString::number(MixerGeometry::mixerValue(mix.throttle)));
+        table->item(2, channel)->setText(QString::number(0));
+        table->item(3, channel)->setText(QString::number(MixerGeometry::mixerValue(mix.axis[MixerGeometry::AXIS_ROLL])));
+        table->item(4, channel)->setText(QString::number(MixerGeometry::mixerValue(mix.axis[MixerGeometry::AXIS_PITCH])));
+        table->item(5, channel)->setText(QString::number(MixerGeometry::mixerValue(mix.axis[MixerGeometry::AXIS_YAW])));
+    }
+}
+
 /**
    WHAT DOES THIS DO???
  */
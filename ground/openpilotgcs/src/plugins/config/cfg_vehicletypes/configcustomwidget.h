@@ -65,6 +65,7 @@ private:
 private slots:
     virtual void setupUI(QString airframeType);
     virtual bool throwConfigError(int numMotors);
+    void openGeometryEditor();
 };
 
 class SpinBoxDelegate : public QItemDelegate {
@@ -0,0 +1,294 @@
+/**
+ ******************************************************************************
+ *
+ * @file       mixergeometry.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Mixer matrix computed from the airframe geometry
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "mixergeometry.h"
+
+#include <Eigen/Core>
+#include <Eigen/SVD>
+#include <QObject>
+#include <QSet>
+#include <math.h>
+
+// Singular values below this fraction of the largest are taken as zero
+#define PINV_TOLERANCE 1e-9
+// Mixer values closer to zero than this are rounding noise
+#define MIX_EPSILON    1e-9
+
+MixerGeometry::MixerGeometry()
+{
+    clear();
+}
+
+void MixerGeometry::clear()
+{
+    m_actuators.clear();
+    m_mixes.clear();
+    m_error.clear();
+    for (int i = 0; i < AXIS_NUMELEM; i++) {
+        m_authority[i] = false;
+    }
+}
+
+void MixerGeometry::addMotor(int channel, double x, double y, Rotation rotation)
+{
+    Actuator motor;
+
+    motor.type     = ACTUATOR_MOTOR;
+    motor.channel  = channel;
+    motor.x        = x;
+    motor.y        = y;
+    motor.rotation = rotation;
+    for (int i = 0; i < AXIS_NUMELEM; i++) {
+        motor.effect[i] = 0;
+    }
+    m_actuators.append(motor);
+}
+
+/**
+   Motor on an arm, angle in degrees clockwise from the nose
+ */
+void MixerGeometry::addMotorAt(int channel, double angle, double arm, Rotation rotation)
+{
+    double rad = angle * M_PI / 180.0;
+
+    addMotor(channel, arm * cos(rad), arm * sin(rad), rotation);
+}
+
+void MixerGeometry::addServo(int channel, double roll, double pitch, double yaw)
+{
+    Actuator servo;
+
+    servo.type     = ACTUATOR_SERVO;
+    servo.channel  = channel;
+    servo.x        = 0;
+    servo.y        = 0;
+    servo.rotation = ROTATION_NONE;
+    servo.effect[AXIS_ROLL]  = roll;
+    servo.effect[AXIS_PITCH] = pitch;
+    servo.effect[AXIS_YAW]   = yaw;
+    m_actuators.append(servo);
+}
+
+const QList<MixerGeometry::Actuator> &MixerGeometry::actuators() const
+{
+    return m_actuators;
+}
+
+void MixerGeometry::setActuators(const QList<Actuator> &actuators)
+{
+    clear();
+    m_actuators = actuators;
+}
+
+/**
+   Builds the mixer from the actuators, returns false with error() set when
+   the geometry can not be used.
+ */
+bool MixerGeometry::compute()
+{
+    m_mixes.clear();
+    m_error.clear();
+    for (int i = 0; i < AXIS_NUMELEM; i++) {
+        m_authority[i] = false;
+    }
+
+    int count = m_actuators.length();
+    if (count == 0) {
+        m_error = QObject::tr("No actuators defined");
+        return false;
+    }
+
+    QSet<int> channels;
+    foreach(const Actuator &actuator, m_actuators) {
+        if (channels.contains(actuator.channel)) {
+            m_error = QObject::tr("Channel %1 is used twice").arg(actuator.channel + 1);
+            return false;
+        }
+        channels.insert(actuator.channel);
+    }
+
+    // Effect of each actuator on the frame, one column per actuator. The
+    // last row is lift, so the attitude columns leave the total thrust alone.
+    Eigen::MatrixXd effect(AXIS_NUMELEM + 1, count);
+    for (int i = 0; i < count; i++) {
+        const Actuator &actuator = m_actuators.at(i);
+        if (actuator.type == ACTUATOR_MOTOR) {
+            effect(AXIS_ROLL, i)  = -actuator.y;
+            effect(AXIS_PITCH, i) = actuator.x;
+            effect(AXIS_YAW, i)   = (actuator.rotation == ROTATION_CW) ? -1.0 :
+                                    (actuator.rotation == ROTATION_CCW) ? 1.0 : 0.0;
+            effect(AXIS_NUMELEM, i) = 1.0;
+        } else {
+            for (int axis = 0; axis < AXIS_NUMELEM; axis++) {
+                effect(axis, i) = actuator.effect[axis];
+            }
+            effect(AXIS_NUMELEM, i) = 0.0;
+        }
+    }
+
+    // Moore-Penrose pseudo-inverse, V * S^-1 * U^T
+    Eigen::JacobiSVD<Eigen::MatrixXd> svd(effect, Eigen::ComputeThinU | Eigen::ComputeThinV);
+    Eigen::VectorXd singular = svd.singularValues();
+    double tolerance = PINV_TOLERANCE * (singular.size() ? singular(0) : 0);
+    Eigen::VectorXd inverse(singular.size());
+    for (int i = 0; i < singular.size(); i++) {
+        inverse(i) = (singular(i) > tolerance) ? 1.0 / singular(i) : 0.0;
+    }
+    Eigen::MatrixXd mixer = svd.matrixV() * inverse.asDiagonal() * svd.matrixU().transpose();
+
+    // Scale each axis so its largest value is full range
+    for (int axis = 0; axis < AXIS_NUMELEM; axis++) {
+        double max = mixer.col(axis).cwiseAbs().maxCoeff();
+        if (max > MIX_EPSILON) {
+            mixer.col(axis) /= max;
+            m_authority[axis] = true;
+        } else {
+            mixer.col(axis).setZero();
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        Mix mix;
+        mix.type     = m_actuators.at(i).type;
+        mix.channel  = m_actuators.at(i).channel;
+        mix.throttle = (mix.type == ACTUATOR_MOTOR) ? 1.0 : 0.0;
+        for (int axis = 0; axis < AXIS_NUMELEM; axis++) {
+            double value = mixer(i, axis);
+            mix.axis[axis] = (fabs(value) < MIX_EPSILON) ? 0.0 : value;
+        }
+        m_mixes.append(mix);
+    }
+
+    if (!m_authority[AXIS_ROLL] || !m_authority[AXIS_PITCH] || !m_authority[AXIS_YAW]) {
+        m_error = QObject::tr("The actuators can not control every axis");
+    }
+    return true;
+}
+
+const QList<MixerGeometry::Mix> &MixerGeometry::mixes() const
+{
+    return m_mixes;
+}
+
+bool MixerGeometry::hasAuthority(Axis axis) const
+{
+    return m_authority[axis];
+}
+
+QString MixerGeometry::error() const
+{
+    return m_error;
+}
+
+/**
+   Mixer value as stored in MixerSettings, rounded away from zero the way
+   VehicleConfig::setMixerVectorValue() does
+ */
+int MixerGeometry::mixerValue(double value)
+{
+    value *= 127;
+    value  = (value < 0) ? floor(value) : ceil(value);
+    if (value > 127) {
+        return 127;
+    } else if (value < -127) {
+        return -127;
+    }
+    return (int)value;
+}
+
+/**
+   Frames of the multirotor page which follow from their geometry alone
+ */
+QStringList MixerGeometry::frameNames()
+{
+    QStringList names;
+
+    names << "Tricopter Y" << "Quad +" << "Quad X" << "Hexacopter" << "Hexacopter X"
+          << "Hexacopter Y6" << "Octocopter" << "Octocopter X" << "Octo Coax +" << "Octo Coax X";
+    return names;
+}
+
+/**
+   Replaces the actuators with a standard frame, motors on the first channels
+ */
+bool MixerGeometry::loadFrame(const QString &name, MixerGeometry *geometry)
+{
+    int motors;
+    double firstAngle;
+    bool coax = false;
+
+    if (name == "Tricopter Y") {
+        geometry->clear();
+        geometry->addMotorAt(0, -60, 1, ROTATION_NONE);
+        geometry->addMotorAt(1, 60, 1, ROTATION_NONE);
+        geometry->addMotorAt(2, 180, 1, ROTATION_NONE);
+        geometry->addServo(3, 0, 0, 1);
+        return true;
+    } else if (name == "Quad +") {
+        motors     = 4;
+        firstAngle = 0;
+    } else if (name == "Quad X") {
+        motors     = 4;
+        firstAngle = -45;
+    } else if (name == "Hexacopter") {
+        motors     = 6;
+        firstAngle = 0;
+    } else if (name == "Hexacopter X") {
+        motors     = 6;
+        firstAngle = 30;
+    } else if (name == "Hexacopter Y6") {
+        motors     = 6;
+        firstAngle = -60;
+        coax       = true;
+    } else if (name == "Octocopter") {
+        motors     = 8;
+        firstAngle = 0;
+    } else if (name == "Octocopter X") {
+        motors     = 8;
+        firstAngle = 22.5;
+    } else if (name == "Octo Coax +") {
+        motors     = 8;
+        firstAngle = 0;
+        coax       = true;
+    } else if (name == "Octo Coax X") {
+        motors     = 8;
+        firstAngle = -45;
+        coax       = true;
+    } else {
+        return false;
+    }
+
+    // Arms clockwise from the first one, rotations alternate starting CW,
+    // a coaxial pair shares its arm
+    int arms = coax ? motors / 2 : motors;
+    geometry->clear();
+    for (int i = 0; i < motors; i++) {
+        int arm = coax ? i / 2 : i;
+        geometry->addMotorAt(i, firstAngle + arm * 360.0 / arms, 1, (i % 2) ? ROTATION_CCW : ROTATION_CW);
+    }
+    return true;
+}
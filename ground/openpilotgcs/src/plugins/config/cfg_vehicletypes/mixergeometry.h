@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ *
+ * @file       mixergeometry.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Mixer matrix computed from the airframe geometry
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MIXERGEOMETRY_H
+#define MIXERGEOMETRY_H
+
+#include <QList>
+#include <QString>
+#include <QStringList>
+
+/*
+ * Describes an airframe by where its actuators are and what they do, and
+ * turns that into the roll/pitch/yaw columns of the mixer.
+ *
+ * Motors are placed in the body frame, x forward and y to the right, or by
+ * their angle clockwise from the nose. A motor lifts its side of the frame
+ * and its rotation yaws the frame the other way, a CW motor yaws left.
+ * Control surfaces and other servos give their effect on each axis directly.
+ *
+ * The mixer is the pseudo-inverse of that effect matrix, so an over-actuated
+ * frame shares each axis over all the actuators with the least effort and a
+ * command on one axis leaves the others alone. Each axis is then scaled so
+ * the strongest actuator gets the full range, the same normalisation as the
+ * multirotor frame tables.
+ */
+class MixerGeometry {
+public:
+    typedef enum {
+        ROTATION_NONE = 0,
+        ROTATION_CW   = 1,
+        ROTATION_CCW  = 2
+    } Rotation;
+
+    typedef enum {
+        ACTUATOR_MOTOR = 0,
+        ACTUATOR_SERVO = 1
+    } ActuatorType;
+
+    typedef enum {
+        AXIS_ROLL  = 0,
+        AXIS_PITCH = 1,
+        AXIS_YAW   = 2,
+        AXIS_NUMELEM
+    } Axis;
+
+    struct Actuator {
+        ActuatorType type;
+        int      channel;
+        // Motors
+        double   x;
+        double   y;
+        Rotation rotation;
+        // Servos
+        double   effect[AXIS_NUMELEM];
+    };
+
+    // One mixer column per actuator, values in [-1, 1]
+    struct Mix {
+        ActuatorType type;
+        int    channel;
+        double throttle;
+        double axis[AXIS_NUMELEM];
+    };
+
+    MixerGeometry();
+
+    void clear();
+
+    void addMotor(int channel, double x, double y, Rotation rotation);
+    void addMotorAt(int channel, double angle, double arm, Rotation rotation);
+    void addServo(int channel, double roll, double pitch, double yaw);
+
+    const QList<Actuator> &actuators() const;
+    void setActuators(const QList<Actuator> &actuators);
+
+    bool compute();
+
+    const QList<Mix> &mixes() const;
+    bool hasAuthority(Axis axis) const;
+    QString error() const;
+
+    static int mixerValue(double value);
+
+    static QStringList frameNames();
+    static bool loadFrame(const QString &name, MixerGeometry *geometry);
+
+private:
+    QList<Actuator> m_actuators;
+    QList<Mix> m_mixes;
+    bool m_authority[AXIS_NUMELEM];
+    QString m_error;
+};
+
+#endif // MIXERGEOMETRY_H
@@ -0,0 +1,322 @@
+/**
+ ******************************************************************************
+ *
+ * @file       mixergeometrydialog.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Airframe geometry editor with a live preview of its mixer
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "mixergeometrydialog.h"
+#include "dblspindelegate.h"
+
+#include <QComboBox>
+#include <QDialogButtonBox>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QLabel>
+#include <QPushButton>
+#include <QSpinBox>
+#include <QTableWidget>
+#include <QVBoxLayout>
+
+static QTableWidgetItem *numberItem(double value)
+{
+    QTableWidgetItem *item = new QTableWidgetItem(QString::number(value, 'f', 3));
+
+    item->setTextAlignment(Qt::AlignCenter);
+    return item;
+}
+
+static QTableWidgetItem *previewItem(const QString &text)
+{
+    QTableWidgetItem *item = new QTableWidgetItem(text);
+
+    item->setTextAlignment(Qt::AlignCenter);
+    item->setFlags(Qt::ItemIsEnabled);
+    return item;
+}
+
+MixerGeometryDialog::MixerGeometryDialog(int channels, QWidget *parent) :
+    QDialog(parent), m_channels(channels), m_updating(false)
+{
+    setWindowTitle(tr("Airframe Geometry"));
+
+    m_frameCombo = new QComboBox;
+    m_frameCombo->addItem(tr("Start from a frame..."));
+    m_frameCombo->addItems(MixerGeometry::frameNames());
+
+    QPushButton *addMotorButton = new QPushButton(tr("Add Motor"));
+    QPushButton *addServoButton = new QPushButton(tr("Add Servo"));
+    QPushButton *removeButton   = new QPushButton(tr("Remove"));
+
+    QHBoxLayout *tools = new QHBoxLayout;
+    tools->addWidget(m_frameCombo);
+    tools->addStretch();
+    tools->addWidget(addMotorButton);
+    tools->addWidget(addServoButton);
+    tools->addWidget(removeButton);
+
+    // Motors use their position and rotation, x forward and y right,
+    // servos their effect on each axis
+    m_actuatorTable = new QTableWidget(0, COLUMN_NUMELEM);
+    m_actuatorTable->setHorizontalHeaderLabels(QStringList() << tr("Channel") << tr("Type") << tr("X") << tr("Y")
+                                               << tr("Rotation") << tr("Roll") << tr("Pitch") << tr("Yaw"));
+    m_actuatorTable->setSelectionBehavior(QAbstractItemView::SelectRows);
+    m_actuatorTable->setSelectionMode(QAbstractItemView::SingleSelection);
+    m_actuatorTable->verticalHeader()->hide();
+
+    DoubleSpinDelegate *positionDelegate = new DoubleSpinDelegate(this);
+    positionDelegate->setRange(-10.0, 10.0);
+    positionDelegate->setDecimals(3);
+    positionDelegate->setStep(0.05);
+    m_actuatorTable->setItemDelegateForColumn(COLUMN_X, positionDelegate);
+    m_actuatorTable->setItemDelegateForColumn(COLUMN_Y, positionDelegate);
+
+    DoubleSpinDelegate *effectDelegate = new DoubleSpinDelegate(this);
+    effectDelegate->setRange(-1.0, 1.0);
+    effectDelegate->setDecimals(3);
+    effectDelegate->setStep(0.05);
+    m_actuatorTable->setItemDelegateForColumn(COLUMN_ROLL, effectDelegate);
+    m_actuatorTable->setItemDelegateForColumn(COLUMN_PITCH, effectDelegate);
+    m_actuatorTable->setItemDelegateForColumn(COLUMN_YAW, effectDelegate);
+
+    // What will be written to MixerSettings
+    m_previewTable = new QTableWidget(0, 5);
+    m_previewTable->setHorizontalHeaderLabels(QStringList() << tr("Channel") << tr("Throttle")
+                                              << tr("Roll") << tr("Pitch") << tr("Yaw"));
+    m_previewTable->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_previewTable->setSelectionMode(QAbstractItemView::NoSelection);
+    m_previewTable->verticalHeader()->hide();
+
+    m_status = new QLabel;
+
+    QDialogButtonBox *buttons = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel);
+    m_okButton = buttons->button(QDialogButtonBox::Ok);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(tools);
+    layout->addWidget(m_actuatorTable);
+    layout->addWidget(new QLabel(tr("Mixer preview")));
+    layout->addWidget(m_previewTable);
+    layout->addWidget(m_status);
+    layout->addWidget(buttons);
+
+    connect(m_frameCombo, SIGNAL(activated(int)), this, SLOT(loadFrame(int)));
+    connect(addMotorButton, SIGNAL(clicked()), this, SLOT(addMotor()));
+    connect(addServoButton, SIGNAL(clicked()), this, SLOT(addServo()));
+    connect(removeButton, SIGNAL(clicked()), this, SLOT(removeActuator()));
+    connect(m_actuatorTable, SIGNAL(cellChanged(int, int)), this, SLOT(updatePreview()));
+    connect(buttons, SIGNAL(accepted()), this, SLOT(accept()));
+    connect(buttons, SIGNAL(rejected()), this, SLOT(reject()));
+
+    resize(700, 550);
+    updatePreview();
+}
+
+void MixerGeometryDialog::setMixerGeometry(const MixerGeometry &geometry)
+{
+    m_updating = true;
+    m_actuatorTable->setRowCount(0);
+    foreach(const MixerGeometry::Actuator &actuator, geometry.actuators()) {
+        appendRow(actuator);
+    }
+    m_updating = false;
+    updatePreview();
+}
+
+const MixerGeometry &MixerGeometryDialog::mixerGeometry() const
+{
+    return m_geometry;
+}
+
+void MixerGeometryDialog::loadFrame(int index)
+{
+    MixerGeometry geometry;
+
+    if (index > 0 && MixerGeometry::loadFrame(m_frameCombo->itemText(index), &geometry)) {
+        setMixerGeometry(geometry);
+    }
+    m_frameCombo->setCurrentIndex(0);
+}
+
+void MixerGeometryDialog::addMotor()
+{
+    MixerGeometry geometry;
+
+    geometry.addMotor(freeChannel(), 0, 0, MixerGeometry::ROTATION_CW);
+    appendRow(geometry.actuators().first());
+    updatePreview();
+}
+
+void MixerGeometryDialog::addServo()
+{
+    MixerGeometry geometry;
+
+    geometry.addServo(freeChannel(), 0, 0, 0);
+    appendRow(geometry.actuators().first());
+    updatePreview();
+}
+
+void MixerGeometryDialog::removeActuator()
+{
+    int row = m_actuatorTable->currentRow();
+
+    if (row >= 0) {
+        m_actuatorTable->removeRow(row);
+        updatePreview();
+    }
+}
+
+/**
+   Recomputes the mixer on every edit
+ */
+void MixerGeometryDialog::updatePreview()
+{
+    if (m_updating) {
+        return;
+    }
+    m_updating = true;
+
+    QList<MixerGeometry::Actuator> actuators;
+    for (int row = 0; row < m_actuatorTable->rowCount(); row++) {
+        enableRow(row);
+        actuators.append(rowActuator(row));
+    }
+    m_geometry.setActuators(actuators);
+    bool valid = m_geometry.compute();
+
+    const QList<MixerGeometry::Mix> &mixes = m_geometry.mixes();
+    m_previewTable->setRowCount(mixes.length());
+    for (int row = 0; row < mixes.length(); row++) {
+        const MixerGeometry::Mix &mix = mixes.at(row);
+        m_previewTable->setItem(row, 0, previewItem(QString("Channel%1").arg(mix.channel + 1)));
+        m_previewTable->setItem(row, 1, previewItem(QString::number(MixerGeometry::mixerValue(mix.throttle))));
+        m_previewTable->setItem(row, 2, previewItem(QString::number(MixerGeometry::mixerValue(mix.axis[MixerGeometry::AXIS_ROLL]))));
+        m_previewTable->setItem(row, 3, previewItem(QString::number(MixerGeometry::mixerValue(mix.axis[MixerGeometry::AXIS_PITCH]))));
+        m_previewTable->setItem(row, 4, previewItem(QString::number(MixerGeometry::mixerValue(mix.axis[MixerGeometry::AXIS_YAW]))));
+    }
+
+    if (!valid) {
+        m_status->setText(m_geometry.error());
+        m_status->setStyleSheet("QLabel { color: red; }");
+    } else if (!m_geometry.error().isEmpty()) {
+        m_status->setText(m_geometry.error());
+        m_status->setStyleSheet("QLabel { color: orange; }");
+    } else {
+        m_status->setText(tr("Configuration OK"));
+        m_status->setStyleSheet("QLabel { color: green; }");
+    }
+    m_okButton->setEnabled(valid);
+
+    m_updating = false;
+}
+
+void MixerGeometryDialog::appendRow(const MixerGeometry::Actuator &actuator)
+{
+    bool updating = m_updating;
+    int row = m_actuatorTable->rowCount();
+
+    m_updating = true;
+    m_actuatorTable->insertRow(row);
+
+    QSpinBox *channel = new QSpinBox;
+    channel->setRange(1, m_channels);
+    channel->setValue(actuator.channel + 1);
+    m_actuatorTable->setCellWidget(row, COLUMN_CHANNEL, channel);
+
+    QComboBox *type = new QComboBox;
+    type->addItems(QStringList() << tr("Motor") << tr("Servo"));
+    type->setCurrentIndex(actuator.type);
+    m_actuatorTable->setCellWidget(row, COLUMN_TYPE, type);
+
+    QComboBox *rotation = new QComboBox;
+    rotation->addItems(QStringList() << tr("None") << tr("CW") << tr("CCW"));
+    rotation->setCurrentIndex(actuator.rotation);
+    m_actuatorTable->setCellWidget(row, COLUMN_ROTATION, rotation);
+
+    m_actuatorTable->setItem(row, COLUMN_X, numberItem(actuator.x));
+    m_actuatorTable->setItem(row, COLUMN_Y, numberItem(actuator.y));
+    m_actuatorTable->setItem(row, COLUMN_ROLL, numberItem(actuator.effect[MixerGeometry::AXIS_ROLL]));
+    m_actuatorTable->setItem(row, COLUMN_PITCH, numberItem(actuator.effect[MixerGeometry::AXIS_PITCH]));
+    m_actuatorTable->setItem(row, COLUMN_YAW, numberItem(actuator.effect[MixerGeometry::AXIS_YAW]));
+
+    connect(channel, SIGNAL(valueChanged(int)), this, SLOT(updatePreview()));
+    connect(type, SIGNAL(currentIndexChanged(int)), this, SLOT(updatePreview()));
+    connect(rotation, SIGNAL(currentIndexChanged(int)), this, SLOT(updatePreview()));
+
+    m_updating = updating;
+}
+
+/**
+   Only the columns that apply to the type of the actuator can be edited
+ */
+void MixerGeometryDialog::enableRow(int row)
+{
+    QComboBox *type = qobject_cast<QComboBox *>(m_actuatorTable->cellWidget(row, COLUMN_TYPE));
+    bool motor = (type->currentIndex() == MixerGeometry::ACTUATOR_MOTOR);
+    Qt::ItemFlags enabled  = Qt::ItemIsEnabled | Qt::ItemIsSelectable | Qt::ItemIsEditable;
+    Qt::ItemFlags disabled = Qt::ItemIsSelectable;
+
+    m_actuatorTable->item(row, COLUMN_X)->setFlags(motor ? enabled : disabled);
+    m_actuatorTable->item(row, COLUMN_Y)->setFlags(motor ? enabled : disabled);
+    m_actuatorTable->cellWidget(row, COLUMN_ROTATION)->setEnabled(motor);
+    m_actuatorTable->item(row, COLUMN_ROLL)->setFlags(motor ? disabled : enabled);
+    m_actuatorTable->item(row, COLUMN_PITCH)->setFlags(motor ? disabled : enabled);
+    m_actuatorTable->item(row, COLUMN_YAW)->setFlags(motor ? disabled : enabled);
+}
+
+MixerGeometry::Actuator MixerGeometryDialog::rowActuator(int row) const
+{
+    QSpinBox *channel   = qobject_cast<QSpinBox *>(m_actuatorTable->cellWidget(row, COLUMN_CHANNEL));
+    QComboBox *type     = qobject_cast<QComboBox *>(m_actuatorTable->cellWidget(row, COLUMN_TYPE));
+    QComboBox *rotation = qobject_cast<QComboBox *>(m_actuatorTable->cellWidget(row, COLUMN_ROTATION));
+
+    MixerGeometry::Actuator actuator;
+
+    actuator.type     = (MixerGeometry::ActuatorType)type->currentIndex();
+    actuator.channel  = channel->value() - 1;
+    actuator.rotation = (MixerGeometry::Rotation)rotation->currentIndex();
+    actuator.x = m_actuatorTable->item(row, COLUMN_X)->text().toDouble();
+    actuator.y = m_actuatorTable->item(row, COLUMN_Y)->text().toDouble();
+    actuator.effect[MixerGeometry::AXIS_ROLL]  = m_actuatorTable->item(row, COLUMN_ROLL)->text().toDouble();
+    actuator.effect[MixerGeometry::AXIS_PITCH] = m_actuatorTable->item(row, COLUMN_PITCH)->text().toDouble();
+    actuator.effect[MixerGeometry::AXIS_YAW]   = m_actuatorTable->item(row, COLUMN_YAW)->text().toDouble();
+    return actuator;
+}
+
+/**
+   Lowest channel no row uses yet
+ */
+int MixerGeometryDialog::freeChannel() const
+{
+    for (int channel = 0; channel < m_channels; channel++) {
+        bool used = false;
+        for (int row = 0; row < m_actuatorTable->rowCount() && !used; row++) {
+            QSpinBox *box = qobject_cast<QSpinBox *>(m_actuatorTable->cellWidget(row, COLUMN_CHANNEL));
+            used = (box->value() - 1 == channel);
+        }
+        if (!used) {
+            return channel;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ *
+ * @file       mixergeometrydialog.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Airframe geometry editor with a live preview of its mixer
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MIXERGEOMETRYDIALOG_H
+#define MIXERGEOMETRYDIALOG_H
+
+#include "mixergeometry.h"
+
+#include <QDialog>
+
+class QComboBox;
+class QLabel;
+class QPushButton;
+class QTableWidget;
+
+class MixerGeometryDialog : public QDialog {
+    Q_OBJECT
+
+public:
+    MixerGeometryDialog(int channels, QWidget *parent = 0);
+
+    void setMixerGeometry(const MixerGeometry &geometry);
+    const MixerGeometry &mixerGeometry() const;
+
+private slots:
+    void loadFrame(int index);
+    void addMotor();
+    void addServo();
+    void removeActuator();
+    void updatePreview();
+
+private:
+    enum {
+        COLUMN_CHANNEL = 0,
+        COLUMN_TYPE,
+        COLUMN_X,
+        COLUMN_Y,
+        COLUMN_ROTATION,
+        COLUMN_ROLL,
+        COLUMN_PITCH,
+        COLUMN_YAW,
+        COLUMN_NUMELEM
+    };
+
+    int m_channels;
+    MixerGeometry m_geometry;
+    bool m_updating;
+
+    QComboBox *m_frameCombo;
+    QTableWidget *m_actuatorTable;
+    QTableWidget *m_previewTable;
+    QLabel *m_status;
+    QPushButton *m_okButton;
+
+    void appendRow(const MixerGeometry::Actuator &actuator);
+    void enableRow(int row);
+    MixerGeometry::Actuator rowActuator(int row) const;
+    int freeChannel() const;
+};
+
+#endif // MIXERGEOMETRYDIALOG_H
@@ -38,6 +38,8 @@ HEADERS += \
     cfg_vehicletypes/configfixedwingwidget.h \
     cfg_vehicletypes/configgroundvehiclewidget.h \
     cfg_vehicletypes/configcustomwidget.h \
+    cfg_vehicletypes/mixergeometry.h \
+    cfg_vehicletypes/mixergeometrydialog.h \
     configrevowidget.h \
     config_global.h \
     mixercurve.h \
@@ -84,6 +86,8 @@ SOURCES += \
     cfg_vehicletypes/configfixedwingwidget.cpp \
     cfg_vehicletypes/configgroundvehiclewidget.cpp \
     cfg_vehicletypes/configcustomwidget.cpp \
+    cfg_vehicletypes/mixergeometry.cpp \
+    cfg_vehicletypes/mixergeometrydialog.cpp \
     outputchannelform.cpp \
     mixercurve.cpp \
     dblspindelegate.cpp \
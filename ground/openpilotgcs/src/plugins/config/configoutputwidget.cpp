@@ -121,7 +121,7 @@ ConfigOutputWidget::ConfigOutputWidget(QWidget *parent) : ConfigTaskWidget(paren
     SystemAlarms *systemAlarmsObj = SystemAlarms::GetInstance(getObjectManager());
     connect(systemAlarmsObj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateWarnings(UAVObject *)));
 
-    disconnect(this, SLOT(refreshWidgetsValues(UAVObject *)));
+    disconnect(this, SLOT(queueRefreshWidgetsValues(UAVObject *)));
 
     populateWidgets();
     refreshWidgetsValues();
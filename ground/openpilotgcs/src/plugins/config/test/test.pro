@@ -0,0 +1,12 @@
+CONFIG += qtestlib
+TEMPLATE = app
+CONFIG -= app_bundle
+
+include(../../../../openpilotgcs.pri)
+
+INCLUDEPATH += ../cfg_vehicletypes ../../../libs/eigen
+
+HEADERS += ../cfg_vehicletypes/mixergeometry.h
+
+SOURCES += tst_mixergeometry.cpp \
+    ../cfg_vehicletypes/mixergeometry.cpp
@@ -0,0 +1,286 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_mixergeometry.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup ConfigPlugin Config Plugin
+ * @{
+ * @brief Geometry mixers against the multirotor frame tables
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "mixergeometry.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QObject>
+#include <math.h>
+
+// The tables print 0.71 and 0.41 for sin(45) and tan(22.5)
+#define TABLE_TOLERANCE 0.01
+
+// Copied from ConfigMultiRotorWidget::updateConfigObjectsFromWidgets(),
+// one row per motor: pitch, roll, yaw
+struct FrameTable {
+    const char *name;
+    int    motors;
+    double mixer[8][3];
+};
+
+static const FrameTable frameTables[] = {
+    { "Tricopter Y",   3, {
+          { 0.5, 1, 0 }, { 0.5, -1, 0 }, { -1, 0, 0 }
+      } },
+    { "Quad +",        4, {
+          { 1, 0, -1 }, { 0, -1, 1 }, { -1, 0, -1 }, { 0, 1, 1 }
+      } },
+    { "Quad X",        4, {
+          { 1, 1, -1 }, { 1, -1, 1 }, { -1, -1, -1 }, { -1, 1, 1 }
+      } },
+    { "Hexacopter",    6, {
+          { 1, 0, -1 }, { 0.5, -1, 1 }, { -0.5, -1, -1 }, { -1, 0, 1 }, { -0.5, 1, -1 }, { 0.5, 1, 1 }
+      } },
+    { "Hexacopter X",  6, {
+          { 1, -0.5, -1 }, { 0, -1, 1 }, { -1, -0.5, -1 }, { -1, 0.5, 1 }, { 0, 1, -1 }, { 1, 0.5, 1 }
+      } },
+    { "Hexacopter Y6", 6, {
+          { 0.5, 1, -1 }, { 0.5, 1, 1 }, { 0.5, -1, -1 }, { 0.5, -1, 1 }, { -1, 0, -1 }, { -1, 0, 1 }
+      } },
+    { "Octocopter",    8, {
+          { 1, 0, -1 }, { 0.71, -0.71, 1 }, { 0, -1, -1 }, { -0.71, -0.71, 1 },
+          { -1, 0, -1 }, { -0.71, 0.71, 1 }, { 0, 1, -1 }, { 0.71, 0.71, 1 }
+      } },
+    { "Octocopter X",  8, {
+          { 1, -0.41, -1 }, { 0.41, -1, 1 }, { -0.41, -1, -1 }, { -1, -0.41, 1 },
+          { -1, 0.41, -1 }, { -0.41, 1, 1 }, { 0.41, 1, -1 }, { 1, 0.41, 1 }
+      } },
+    { "Octo Coax +",   8, {
+          { 1, 0, -1 }, { 1, 0, 1 }, { 0, -1, -1 }, { 0, -1, 1 },
+          { -1, 0, -1 }, { -1, 0, 1 }, { 0, 1, -1 }, { 0, 1, 1 }
+      } },
+    { "Octo Coax X",   8, {
+          { 1, 1, -1 }, { 1, 1, 1 }, { 1, -1, -1 }, { 1, -1, 1 },
+          { -1, -1, -1 }, { -1, -1, 1 }, { -1, 1, -1 }, { -1, 1, 1 }
+      } }
+};
+
+class tst_MixerGeometry : public QObject {
+    Q_OBJECT
+
+private slots:
+    void standardFrames_data();
+    void standardFrames();
+    void tricopterYawServo();
+    void overActuatedDecouples();
+    void asymmetricFrameDecouples();
+    void missingAxisReported();
+    void duplicateChannelRejected();
+
+private:
+    static double effect(const MixerGeometry::Actuator &actuator, int axis);
+    static void verifyDecoupled(const MixerGeometry &geometry);
+};
+
+/**
+   What a full command on one actuator does to the frame, the inverse of the
+   convention MixerGeometry documents
+ */
+double tst_MixerGeometry::effect(const MixerGeometry::Actuator &actuator, int axis)
+{
+    if (actuator.type == MixerGeometry::ACTUATOR_SERVO) {
+        return actuator.effect[axis];
+    }
+    switch (axis) {
+    case MixerGeometry::AXIS_ROLL:
+        return -actuator.y;
+
+    case MixerGeometry::AXIS_PITCH:
+        return actuator.x;
+
+    default:
+        return (actuator.rotation == MixerGeometry::ROTATION_CW) ? -1 :
+               (actuator.rotation == MixerGeometry::ROTATION_CCW) ? 1 : 0;
+    }
+}
+
+/**
+   A command on one axis moves the frame on that axis only, the right way
+   and without changing the lift
+ */
+void tst_MixerGeometry::verifyDecoupled(const MixerGeometry &geometry)
+{
+    const QList<MixerGeometry::Actuator> &actuators = geometry.actuators();
+    const QList<MixerGeometry::Mix> &mixes = geometry.mixes();
+
+    QCOMPARE(mixes.length(), actuators.length());
+    for (int command = 0; command < MixerGeometry::AXIS_NUMELEM; command++) {
+        for (int axis = 0; axis < MixerGeometry::AXIS_NUMELEM; axis++) {
+            double response = 0;
+            for (int i = 0; i < actuators.length(); i++) {
+                response += effect(actuators[i], axis) * mixes[i].axis[command];
+            }
+            if (axis == command) {
+                QVERIFY(response > 0.1);
+            } else {
+                QVERIFY(fabs(response) < 1e-6);
+            }
+        }
+
+        double lift = 0;
+        for (int i = 0; i < actuators.length(); i++) {
+            if (actuators[i].type == MixerGeometry::ACTUATOR_MOTOR) {
+                lift += mixes[i].axis[command];
+            }
+        }
+        QVERIFY(fabs(lift) < 1e-6);
+    }
+}
+
+void tst_MixerGeometry::standardFrames_data()
+{
+    QTest::addColumn<int>("table");
+
+    for (unsigned int i = 0; i < sizeof(frameTables) / sizeof(frameTables[0]); i++) {
+        QTest::newRow(frameTables[i].name) << (int)i;
+    }
+}
+
+void tst_MixerGeometry::standardFrames()
+{
+    QFETCH(int, table);
+    const FrameTable &frame = frameTables[table];
+
+    MixerGeometry geometry;
+    QVERIFY(MixerGeometry::loadFrame(frame.name, &geometry));
+    QVERIFY(geometry.compute());
+
+    const QList<MixerGeometry::Mix> &mixes = geometry.mixes();
+    int motors = 0;
+    for (int i = 0; i < mixes.length(); i++) {
+        if (mixes[i].type != MixerGeometry::ACTUATOR_MOTOR) {
+            continue;
+        }
+        QCOMPARE(mixes[i].channel, motors);
+        QCOMPARE(mixes[i].throttle, 1.0);
+        QVERIFY(fabs(mixes[i].axis[MixerGeometry::AXIS_PITCH] - frame.mixer[motors][0]) < TABLE_TOLERANCE);
+        QVERIFY(fabs(mixes[i].axis[MixerGeometry::AXIS_ROLL] - frame.mixer[motors][1]) < TABLE_TOLERANCE);
+        QVERIFY(fabs(mixes[i].axis[MixerGeometry::AXIS_YAW] - frame.mixer[motors][2]) < TABLE_TOLERANCE);
+        motors++;
+    }
+    QCOMPARE(motors, frame.motors);
+    verifyDecoupled(geometry);
+}
+
+void tst_MixerGeometry::tricopterYawServo()
+{
+    MixerGeometry geometry;
+
+    QVERIFY(MixerGeometry::loadFrame("Tricopter Y", &geometry));
+    QVERIFY(geometry.compute());
+
+    const MixerGeometry::Mix &servo = geometry.mixes().last();
+    QCOMPARE(servo.type, MixerGeometry::ACTUATOR_SERVO);
+    QCOMPARE(servo.channel, 3);
+    QCOMPARE(servo.throttle, 0.0);
+    QCOMPARE(servo.axis[MixerGeometry::AXIS_ROLL], 0.0);
+    QCOMPARE(servo.axis[MixerGeometry::AXIS_PITCH], 0.0);
+    QVERIFY(fabs(servo.axis[MixerGeometry::AXIS_YAW] - 1.0) < 1e-9);
+}
+
+/**
+   A quad with ailerons, rudder and elevator: both sets share every axis
+ */
+void tst_MixerGeometry::overActuatedDecouples()
+{
+    MixerGeometry geometry;
+
+    geometry.addMotorAt(0, -45, 1, MixerGeometry::ROTATION_CW);
+    geometry.addMotorAt(1, 45, 1, MixerGeometry::ROTATION_CCW);
+    geometry.addMotorAt(2, 135, 1, MixerGeometry::ROTATION_CW);
+    geometry.addMotorAt(3, -135, 1, MixerGeometry::ROTATION_CCW);
+    geometry.addServo(4, 1, 0, 0);
+    geometry.addServo(5, -1, 0, 0);
+    geometry.addServo(6, 0, 1, 0);
+    geometry.addServo(7, 0, 0.5, 0.5);
+    QVERIFY(geometry.compute());
+    QVERIFY(geometry.error().isEmpty());
+
+    const QList<MixerGeometry::Mix> &mixes = geometry.mixes();
+    for (int axis = 0; axis < MixerGeometry::AXIS_NUMELEM; axis++) {
+        double max = 0;
+        for (int i = 0; i < mixes.length(); i++) {
+            max = qMax(max, fabs(mixes[i].axis[axis]));
+        }
+        QVERIFY(fabs(max - 1.0) < 1e-9);
+    }
+    // Opposite ailerons move opposite ways
+    QVERIFY(mixes[4].axis[MixerGeometry::AXIS_ROLL] > 0);
+    QVERIFY(fabs(mixes[4].axis[MixerGeometry::AXIS_ROLL] + mixes[5].axis[MixerGeometry::AXIS_ROLL]) < 1e-9);
+    verifyDecoupled(geometry);
+}
+
+/**
+   Dead cat quad, front arms wider and longer than the rear ones
+ */
+void tst_MixerGeometry::asymmetricFrameDecouples()
+{
+    MixerGeometry geometry;
+
+    geometry.addMotor(0, 1.0, -1.2, MixerGeometry::ROTATION_CW);
+    geometry.addMotor(1, 1.0, 1.2, MixerGeometry::ROTATION_CCW);
+    geometry.addMotor(2, -0.6, 0.7, MixerGeometry::ROTATION_CW);
+    geometry.addMotor(3, -0.6, -0.7, MixerGeometry::ROTATION_CCW);
+    QVERIFY(geometry.compute());
+
+    const QList<MixerGeometry::Mix> &mixes = geometry.mixes();
+    // Unlike a Quad X the motors do not share yaw evenly
+    QVERIFY(fabs(mixes[0].axis[MixerGeometry::AXIS_YAW]) < fabs(mixes[2].axis[MixerGeometry::AXIS_YAW]) - 0.1);
+    verifyDecoupled(geometry);
+}
+
+void tst_MixerGeometry::missingAxisReported()
+{
+    MixerGeometry geometry;
+
+    // Coaxial pair on the centre line, yaw only
+    geometry.addMotor(0, 0, 0, MixerGeometry::ROTATION_CW);
+    geometry.addMotor(1, 0, 0, MixerGeometry::ROTATION_CCW);
+    QVERIFY(geometry.compute());
+    QVERIFY(!geometry.error().isEmpty());
+    QVERIFY(!geometry.hasAuthority(MixerGeometry::AXIS_ROLL));
+    QVERIFY(!geometry.hasAuthority(MixerGeometry::AXIS_PITCH));
+    QVERIFY(geometry.hasAuthority(MixerGeometry::AXIS_YAW));
+    QCOMPARE(geometry.mixes()[0].axis[MixerGeometry::AXIS_ROLL], 0.0);
+    QCOMPARE(geometry.mixes()[0].axis[MixerGeometry::AXIS_YAW], -1.0);
+}
+
+void tst_MixerGeometry::duplicateChannelRejected()
+{
+    MixerGeometry geometry;
+
+    QVERIFY(!geometry.compute());
+
+    geometry.addMotorAt(0, 0, 1, MixerGeometry::ROTATION_CW);
+    geometry.addServo(0, 0, 0, 1);
+    QVERIFY(!geometry.compute());
+    QVERIFY(geometry.mixes().isEmpty());
+}
+
+QTEST_MAIN(tst_MixerGeometry)
+
+#include "tst_mixergeometry.moc"
@@ -1,9 +1,9 @@
 #include "debugengine.h"
 
-debugengine::debugengine()
-{
-    mut_lock = new QMutex(QMutex::Recursive);
-}
+#include <stdio.h>
+
+debugengine::debugengine() : m_previousHandler(0), m_installed(false)
+{}
 
 debugengine *debugengine::getInstance()
 {
@@ -14,31 +14,54 @@ debugengine *debugengine::getInstance()
 
 debugengine::~debugengine()
 {
-    delete mut_lock;
-    mut_lock = NULL;
+    removeMessageHandler();
 }
 
-void debugengine::setTextEdit(QTextBrowser *textEdit)
+void debugengine::installMessageHandler()
 {
-    QMutexLocker lock(mut_lock);
-
-    _textEdit = textEdit;
+    if (!m_installed) {
+        m_previousHandler = qInstallMessageHandler(messageHandler);
+        m_installed = true;
+    }
 }
 
-void debugengine::writeMessage(const QString &message)
+void debugengine::removeMessageHandler()
 {
-    QMutexLocker lock(mut_lock);
-
-    if (_textEdit) {
-        _textEdit->append(message);
+    if (m_installed) {
+        qInstallMessageHandler(m_previousHandler);
+        m_installed = false;
     }
 }
 
-void debugengine::setColor(const QColor &c)
+void debugengine::messageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg)
 {
-    QMutexLocker lock(mut_lock);
+    debugengine *engine = getInstance();
+    Utils::LogModel::Level level = Utils::LogModel::DebugLevel;
+
+    switch (type) {
+    case QtDebugMsg:
+        level = Utils::LogModel::DebugLevel;
+        break;
+    case QtWarningMsg:
+        level = Utils::LogModel::WarningLevel;
+        break;
+    case QtCriticalMsg:
+        level = Utils::LogModel::CriticalLevel;
+        break;
+    case QtFatalMsg:
+        level = Utils::LogModel::FatalLevel;
+        break;
+    }
+
+    // from any thread, the model takes it in on the next event loop pass
+    engine->m_model.append(level, context.category ? QString::fromLatin1(context.category) : QString(), msg);
 
-    if (_textEdit) {
-        _textEdit->setTextColor(c);
+    // the log file still gets everything
+    if (engine->m_previousHandler) {
+        engine->m_previousHandler(type, context, msg);
+    } else {
+        // what Qt's own handler would have printed
+        fprintf(stderr, "%s\n", qPrintable(qFormatLogMessage(type, context, msg)));
+        fflush(stderr);
     }
 }
@@ -1,8 +1,7 @@
 #ifndef DEBUGENGINE_H
 #define DEBUGENGINE_H
-#include <QTextBrowser>
-#include <QPointer>
-#include <QMutex>
+#include <QtGlobal>
+#include "utils/logmodel.h"
 
 class debugengine {
 // Add all missing constructor etc... to have singleton
@@ -10,12 +9,18 @@ class debugengine {
     ~debugengine();
 public:
     static debugengine *getInstance();
-    void setTextEdit(QTextBrowser *textEdit);
-    void writeMessage(const QString &message);
-    void setColor(const QColor &c);
-    QMutex *mut_lock;
+    // The messages of the whole application, shared by the debug gadgets
+    Utils::LogModel *model()
+    {
+        return &m_model;
+    }
+    void installMessageHandler();
+    void removeMessageHandler();
 private:
-    QPointer<QTextBrowser> _textEdit;
+    static void messageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg);
+    Utils::LogModel m_model;
+    QtMessageHandler m_previousHandler;
+    bool m_installed;
 };
 
 #endif // DEBUGENGINE_H
@@ -29,58 +29,38 @@
 #include <QDebug>
 #include <QStringList>
 #include <QWidget>
-#include <QTextEdit>
-#include <QVBoxLayout>
 #include <QPushButton>
 #include "debugengine.h"
 #include <QFile>
 #include <QFileDialog>
 #include <QMessageBox>
 #include <QScrollBar>
-#include <QTime>
 
-QPointer<QTextBrowser> m_textedit;
-
-void DebugGadgetWidget::customMessageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg)
-{
-    Q_UNUSED(context);
-    QString txt;
-    QColor color = Qt::black;
-
-    switch (type) {
-    case QtDebugMsg:
-        txt   = QString("Debug: %1").arg(msg);
-        color = Qt::black;
-        break;
-    case QtWarningMsg:
-        txt   = QString("Warning: %1").arg(msg);
-        color = Qt::red;
-        break;
-    case QtCriticalMsg:
-        txt   = QString("Critical: %1").arg(msg);
-        color = Qt::red;
-        break;
-    case QtFatalMsg:
-        txt   = QString("Fatal: %1").arg(msg);
-        abort();
-    }
-
-    debugengine::getInstance()->setTextEdit(m_textedit);
-    debugengine::getInstance()->setColor(color);
-    debugengine::getInstance()->writeMessage(txt);
-}
-
-DebugGadgetWidget::DebugGadgetWidget(QWidget *parent) : QLabel(parent)
+DebugGadgetWidget::DebugGadgetWidget(QWidget *parent) : QLabel(parent), m_followTail(true)
 {
     m_config = new Ui_Form();
     m_config->setupUi(this);
 
-    // m_textedit = m_config->plainTextEdit;
-    // MyplainTextEdit=m_config->plainTextEdit;
-    // debugengine *de = new debugengine();
-    // qInstallMessageHandler(customMessageHandler);
-    // connect(de, SIGNAL(dbgMsg(QString, QList<QVariant>)), this, SLOT(dbgMsg(QString, QList<QVariant>)));
-    // connect(de, SIGNAL(dbgMsgError(QString, QList<QVariant>)), this, SLOT(dbgMsgError(QString, QList<QVariant>)));
+    Utils::LogModel *model = debugengine::getInstance()->model();
+    m_filter = new Utils::LogFilterModel(this);
+    m_filter->setSourceModel(model);
+    m_config->logView->setModel(m_filter);
+    m_config->logView->scrollToBottom();
+
+    for (int level = Utils::LogModel::TraceLevel; level <= Utils::LogModel::FatalLevel; level++) {
+        m_config->levelComboBox->addItem(Utils::LogModel::levelName((Utils::LogModel::Level)level), level);
+    }
+    m_config->categoryComboBox->addItem(tr("All categories"), QString());
+    foreach(const QString &category, model->categories()) {
+        addCategory(category);
+    }
+
+    connect(model, SIGNAL(categoryAdded(QString)), this, SLOT(addCategory(QString)));
+    connect(m_filter, SIGNAL(rowsAboutToBeInserted(QModelIndex, int, int)), this, SLOT(rowsAboutToBeInserted()));
+    connect(m_filter, SIGNAL(rowsInserted(QModelIndex, int, int)), this, SLOT(rowsInserted()));
+    connect(m_config->levelComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(levelChanged(int)));
+    connect(m_config->categoryComboBox, SIGNAL(currentIndexChanged(int)), this, SLOT(categoryChanged(int)));
+    connect(m_config->searchLineEdit, SIGNAL(returnPressed()), this, SLOT(find()));
     connect(m_config->pushButton, SIGNAL(clicked()), this, SLOT(saveLog()));
 }
 
@@ -89,26 +69,51 @@ DebugGadgetWidget::~DebugGadgetWidget()
     // Do nothing
 }
 
-void DebugGadgetWidget::dbgMsg(const QString &level, const QList<QVariant> &msgs)
+void DebugGadgetWidget::addCategory(const QString &category)
 {
-    m_config->plainTextEdit->setTextColor(Qt::red);
+    m_config->categoryComboBox->addItem(category, category);
+}
 
-    m_config->plainTextEdit->append(QString("%2[%0]%1").arg(level).arg(msgs[0].toString()).arg(QTime::currentTime().toString()));
+void DebugGadgetWidget::levelChanged(int index)
+{
+    m_filter->setMinimumLevel(m_config->levelComboBox->itemData(index).toInt());
+}
 
-    QScrollBar *sb = m_config->plainTextEdit->verticalScrollBar();
-    sb->setValue(sb->maximum());
+void DebugGadgetWidget::categoryChanged(int index)
+{
+    m_filter->setCategory(m_config->categoryComboBox->itemData(index).toString());
 }
 
-void DebugGadgetWidget::dbgMsgError(const QString &level, const QList<QVariant> &msgs)
+void DebugGadgetWidget::rowsAboutToBeInserted()
 {
-    m_config->plainTextEdit->setTextColor(Qt::black);
+    QScrollBar *sb = m_config->logView->verticalScrollBar();
 
+    m_followTail = sb->value() == sb->maximum();
+}
 
-    m_config->plainTextEdit->append(QString("%2[%0]%1").arg(level).arg(msgs[0].toString()).arg(QTime::currentTime().toString()));
+void DebugGadgetWidget::rowsInserted()
+{
+    if (m_followTail) {
+        m_config->logView->scrollToBottom();
+    }
+}
 
-    QScrollBar *sb = m_config->plainTextEdit->verticalScrollBar();
-    sb->setValue(sb->maximum());
+void DebugGadgetWidget::find()
+{
+    QString text = m_config->searchLineEdit->text();
+    int row = m_filter->find(text, m_config->logView->currentIndex().row());
+
+    if (row < 0) {
+        // wrap around
+        row = m_filter->find(text);
+    }
+    if (row >= 0) {
+        QModelIndex index = m_filter->index(row, 0);
+        m_config->logView->setCurrentIndex(index);
+        m_config->logView->scrollTo(index);
+    }
 }
+
 void DebugGadgetWidget::saveLog()
 {
     QString fileName = QFileDialog::getSaveFileName(0, tr("Save log File As"), "");
@@ -119,7 +124,7 @@ void DebugGadgetWidget::saveLog()
 
     QFile file(fileName);
     if (file.open(QIODevice::WriteOnly) &&
-        (file.write(m_config->plainTextEdit->toHtml().toLatin1()) != -1)) {
+        (file.write(debugengine::getInstance()->model()->toText().toUtf8()) != -1)) {
         file.close();
     } else {
         QMessageBox::critical(0,
@@ -30,20 +30,26 @@
 
 #include <QLabel>
 #include "ui_debug.h"
-#include "debugengine.h"
+#include "utils/logmodel.h"
+
 class DebugGadgetWidget : public QLabel {
     Q_OBJECT
 
 public:
     DebugGadgetWidget(QWidget *parent = 0);
     ~DebugGadgetWidget();
-    static void customMessageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg);
 private:
     Ui_Form *m_config;
+    Utils::LogFilterModel *m_filter;
+    bool m_followTail;
 private slots:
     void saveLog();
-    void dbgMsgError(const QString & level, const QList<QVariant> & msgs);
-    void dbgMsg(const QString & level, const QList<QVariant> & msgs);
+    void find();
+    void addCategory(const QString &category);
+    void levelChanged(int index);
+    void categoryChanged(int index);
+    void rowsAboutToBeInserted();
+    void rowsInserted();
 };
 
 #endif /* DEBUGGADGETWIDGET_H_ */
@@ -61,6 +61,10 @@ DialGadgetWidget::DialGadgetWidget(QWidget *parent) : QGraphicsView(parent)
 
     // This timer mechanism makes needles rotate smoothly
     connect(&dialTimer, SIGNAL(timeout()), this, SLOT(rotateNeedles()));
+
+    // Needles follow the latest value, one update per event loop pass is enough
+    subscription = new UAVObjectSubscription(this);
+    connect(subscription, SIGNAL(objectChanged(UAVObject *)), this, SLOT(updateNeedles(UAVObject *)));
 }
 
 DialGadgetWidget::~DialGadgetWidget()
@@ -87,15 +91,10 @@ void DialGadgetWidget::connectNeedles(QString object1, QString nfield1,
                                       QString object2, QString nfield2,
                                       QString object3, QString nfield3)
 {
-    if (obj1 != NULL) {
-        disconnect(obj1, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateNeedle1(UAVObject *)));
-    }
-    if (obj2 != NULL) {
-        disconnect(obj2, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateNeedle2(UAVObject *)));
-    }
-    if (obj3 != NULL) {
-        disconnect(obj3, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateNeedle3(UAVObject *)));
-    }
+    subscription->unsubscribeAll();
+    obj1 = NULL;
+    obj2 = NULL;
+    obj3 = NULL;
 
     ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
     UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
@@ -105,7 +104,6 @@ void DialGadgetWidget::connectNeedles(QString object1, QString nfield1,
         obj1 = dynamic_cast<UAVDataObject *>(objManager->getObject(object1));
         if (obj1 != NULL) {
             // qDebug() << "Connected Object 1 (" << object1 << ").";
-            connect(obj1, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateNeedle1(UAVObject *)));
             if (nfield1.contains("-")) {
                 QStringList fieldSubfield = nfield1.split("-", QString::SkipEmptyParts);
                 field1        = fieldSubfield.at(0);
@@ -115,6 +113,7 @@ void DialGadgetWidget::connectNeedles(QString object1, QString nfield1,
                 field1 = nfield1;
                 haveSubField1 = false;
             }
+            subscription->subscribe(obj1, QStringList() << field1);
         } else {
             qDebug() << "Error: Object is unknown (" << object1 << ").";
         }
@@ -125,7 +124,6 @@ void DialGadgetWidget::connectNeedles(QString object1, QString nfield1,
         obj2 = dynamic_cast<UAVDataObject *>(objManager->getObject(object2));
         if (obj2 != NULL) {
             // qDebug() << "Connected Object 2 (" << object2 << ").";
-            connect(obj2, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateNeedle2(UAVObject *)));
             if (nfield2.contains("-")) {
                 QStringList fieldSubfield = nfield2.split("-", QString::SkipEmptyParts);
                 field2        = fieldSubfield.at(0);
@@ -135,6 +133,7 @@ void DialGadgetWidget::connectNeedles(QString object1, QString nfield1,
                 field2 = nfield2;
                 haveSubField2 = false;
             }
+            subscription->subscribe(obj2, QStringList() << field2);
         } else {
             qDebug() << "Error: Object is unknown (" << object2 << ").";
         }
@@ -145,7 +144,6 @@ void DialGadgetWidget::connectNeedles(QString object1, QString nfield1,
         obj3 = dynamic_cast<UAVDataObject *>(objManager->getObject(object3));
         if (obj3 != NULL) {
             // qDebug() << "Connected Object 3 (" << object3 << ").";
-            connect(obj3, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateNeedle3(UAVObject *)));
             if (nfield3.contains("-")) {
                 QStringList fieldSubfield = nfield3.split("-", QString::SkipEmptyParts);
                 field3        = fieldSubfield.at(0);
@@ -155,12 +153,30 @@ void DialGadgetWidget::connectNeedles(QString object1, QString nfield1,
                 field3 = nfield3;
                 haveSubField3 = false;
             }
+            subscription->subscribe(obj3, QStringList() << field3);
         } else {
             qDebug() << "Error: Object is unknown (" << object3 << ").";
         }
     }
 }
 
+/*!
+   \brief Called once per event loop pass when a field shown by a needle changed,
+   several needles may show the same object
+ */
+void DialGadgetWidget::updateNeedles(UAVObject *object)
+{
+    if (object == obj1) {
+        updateNeedle1(object);
+    }
+    if (object == obj2) {
+        updateNeedle2(object);
+    }
+    if (object == obj3) {
+        updateNeedle3(object);
+    }
+}
+
 /*!
    \brief Called by the UAVObject which got updated
  */
@@ -33,6 +33,7 @@
 #include "extensionsystem/pluginmanager.h"
 #include "uavobjectmanager.h"
 #include "uavobject.h"
+#include "uavobjectsubscription.h"
 #include <QGraphicsView>
 #include <QtSvg/QSvgRenderer>
 #include <QtSvg/QGraphicsSvgItem>
@@ -105,6 +106,7 @@ public slots:
     void updateNeedle1(UAVObject *object1); // Called by the UAVObject
     void updateNeedle2(UAVObject *object2); // Called by the UAVObject
     void updateNeedle3(UAVObject *object3); // Called by the UAVObject
+    void updateNeedles(UAVObject *object); // Called by the subscription
 
 protected:
     void paintEvent(QPaintEvent *event);
@@ -164,6 +166,7 @@ private:
     UAVDataObject *obj1;
     UAVDataObject *obj2;
     UAVDataObject *obj3;
+    UAVObjectSubscription *subscription;
     QString field1;
     QString subfield1;
     bool haveSubField1;
@@ -9,10 +9,14 @@ include(../../plugins/uavobjects/uavobjects.pri)
 include(../../plugins/uavobjectutil/uavobjectutil.pri)
 include(../../plugins/uavtalk/uavtalk.pri)
 
+INCLUDEPATH += $$ROOT_DIR/flight/libraries/inc
+
 HEADERS += flightlogplugin.h \
-    flightlogmanager.h
+    flightlogmanager.h \
+    $$ROOT_DIR/flight/libraries/inc/logstream.h
 SOURCES += flightlogplugin.cpp \
-    flightlogmanager.cpp
+    flightlogmanager.cpp \
+    $$ROOT_DIR/flight/libraries/logstream.c
 
 OTHER_FILES += Flightlog.pluginspec \
     FlightLogDialog.qml \
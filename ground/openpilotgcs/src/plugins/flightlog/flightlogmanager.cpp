@@ -32,6 +32,8 @@
 #include <QFileDialog>
 #include <QXmlStreamReader>
 #include <QMessageBox>
+#include <QElapsedTimer>
+#include <QTimer>
 #include <QDebug>
 
 #include "debuglogcontrol.h"
@@ -41,8 +43,10 @@
 #include "uavdataobject.h"
 #include <uavobjectutil/uavobjectutilmanager.h>
 
+#include "logstream.h"
+
 FlightLogManager::FlightLogManager(QObject *parent) :
-    QObject(parent), m_disableControls(false),
+    QObject(parent), m_streamLoop(0), m_disableControls(false),
     m_disableExport(true), m_cancelDownload(false),
     m_adjustExportedTimestamps(true)
 {
@@ -83,6 +87,7 @@ FlightLogManager::FlightLogManager(QObject *parent) :
 
     connect(m_telemtryManager, SIGNAL(connected()), this, SLOT(connectionStatusChanged()));
     connect(m_telemtryManager, SIGNAL(disconnected()), this, SLOT(connectionStatusChanged()));
+    connect(m_telemtryManager, SIGNAL(streamReceived(quint32, quint16, QByteArray)), this, SLOT(streamReceived(quint32, quint16, QByteArray)));
     connectionStatusChanged();
 }
 
@@ -200,12 +205,24 @@ void FlightLogManager::retrieveLogs(int flightToRetrieve)
     int startFlight = (flightToRetrieve == -1) ? 0 : flightToRetrieve;
     int endFlight   = (flightToRetrieve == -1) ? m_flightLogStatus->getFlight() : flightToRetrieve;
 
-    // Prepare to send request for event retrieval
-    m_flightLogControl->setOperation(DebugLogControl::OPERATION_RETRIEVE);
+    QElapsedTimer timer;
+    timer.start();
+
     for (int flight = startFlight; flight <= endFlight; flight++) {
+        // Stream the flight, and only if that fails go on one entry at a time
+        int slot = 0;
+        if (streamFlight(flight, slot)) {
+            continue;
+        }
+        if (m_cancelDownload) {
+            break;
+        }
+        qWarning() << "FlightLogManager - streaming flight" << flight << "failed at entry" << slot << ", retrieving entries one at a time";
+
+        // Prepare to send request for event retrieval
+        m_flightLogControl->setOperation(DebugLogControl::OPERATION_RETRIEVE);
         m_flightLogControl->setFlight(flight);
         bool gotLast = false;
-        int slot     = 0;
         while (!gotLast) {
             // Send request for loading flight entry on flight side and wait for ack/nack
             m_flightLogControl->setEntry(slot);
@@ -214,35 +231,7 @@ void FlightLogManager::retrieveLogs(int flightToRetrieve)
                 requestHelper.doObjectAndWait(m_flightLogEntry, UAVTALK_TIMEOUT) == UAVObjectUpdaterHelper::SUCCESS) {
                 if (m_flightLogEntry->getType() != DebugLogEntry::TYPE_EMPTY) {
                     // Ok, we retrieved the entry, and it was the correct one. clone it and add it to the list
-                    ExtendedDebugLogEntry *logEntry = new ExtendedDebugLogEntry();
-
-                    logEntry->setData(m_flightLogEntry->getData(), m_objectManager);
-                    m_logEntries << logEntry;
-                    if (logEntry->getData().Type == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
-                        const quint32 total_len  = sizeof(DebugLogEntry::DataFields);
-                        const quint32 data_len   = sizeof(((DebugLogEntry::DataFields *)0)->Data);
-                        const quint32 header_len = total_len - data_len;
-
-                        DebugLogEntry::DataFields fields;
-                        quint32 start = logEntry->getData().Size;
-
-                        // cycle until there is space for another object
-                        while (start + header_len + 1 < data_len) {
-                            memset(&fields, 0xFF, total_len);
-                            memcpy(&fields, &logEntry->getData().Data[start], header_len);
-                            // check wether a packed object is found
-                            // note that empty data blocks are set as 0xFF in flight side to minimize flash wearing
-                            // thus as soon as this read outside of used area, the test will fail as lenght would be 0xFFFF
-                            quint32 toread = header_len + fields.Size;
-                            if (!(toread + start > data_len)) {
-                                memcpy(&fields, &logEntry->getData().Data[start], toread);
-                                ExtendedDebugLogEntry *subEntry = new ExtendedDebugLogEntry();
-                                subEntry->setData(fields, m_objectManager);
-                                m_logEntries << subEntry;
-                            }
-                            start += toread;
-                        }
-                    }
+                    addLogEntry(m_flightLogEntry->getData());
 
                     // Increment to get next entry from flight side
                     slot++;
@@ -266,6 +255,9 @@ void FlightLogManager::retrieveLogs(int flightToRetrieve)
     if (m_cancelDownload) {
         clearLogList();
         m_cancelDownload = false;
+    } else if (timer.elapsed() > 0) {
+        qDebug() << "FlightLogManager - retrieved" << m_logEntries.count() << "entries in" << timer.elapsed() << "ms,"
+                 << (m_logEntries.count() * 1000 / timer.elapsed()) << "entries/s";
     }
 
     emit logEntriesChanged();
@@ -275,6 +267,135 @@ void FlightLogManager::retrieveLogs(int flightToRetrieve)
     setDisableControls(false);
 }
 
+/**
+ * Streams the entries of a flight from entry on, in chunks the flight side
+ * sends back to back. A chunk that is damaged or missing makes us ask for a
+ * new stream from the first entry we lack, and anything already in flight
+ * from the previous stream is dropped until the one we asked for shows up.
+ * \param[in,out] entry first entry to stream, the first one still missing on return
+ * \return true once the last entry of the flight was received
+ */
+bool FlightLogManager::streamFlight(int flight, int &entry)
+{
+    const quint16 entrySize = sizeof(DebugLogEntry::DataFields);
+    UAVObjectUpdaterHelper updateHelper;
+    QEventLoop loop;
+    QTimer timeout;
+    bool requested = false;
+    bool resync    = false;
+    int retries    = 0;
+
+    timeout.setSingleShot(true);
+    connect(&timeout, SIGNAL(timeout()), &loop, SLOT(quit()));
+    m_streamLoop = &loop;
+    m_streamChunks.clear();
+
+    bool done = false;
+    while (!done && !m_cancelDownload) {
+        if (!requested) {
+            if (retries++ > STREAM_RETRIES) {
+                break;
+            }
+            m_flightLogControl->setOperation(DebugLogControl::OPERATION_STREAM);
+            m_flightLogControl->setFlight(flight);
+            m_flightLogControl->setEntry(entry);
+            m_flightLogControl->setCount(0);
+            if (updateHelper.doObjectAndWait(m_flightLogControl, UAVTALK_TIMEOUT) != UAVObjectUpdaterHelper::SUCCESS) {
+                continue;
+            }
+            requested = true;
+            resync    = true;
+        }
+
+        if (m_streamChunks.isEmpty()) {
+            timeout.start(STREAM_TIMEOUT);
+            loop.exec();
+            timeout.stop();
+            if (m_streamChunks.isEmpty()) {
+                // Nothing came, ask again
+                requested = false;
+                continue;
+            }
+        }
+
+        QByteArray chunk = m_streamChunks.takeFirst();
+        logstream_header header;
+        int32_t count    = logstream_check((const uint8_t *)chunk.constData(), chunk.size(), entrySize, &header);
+        if (count < 0) {
+            qWarning() << "FlightLogManager - bad log chunk" << count;
+            requested = false;
+            continue;
+        }
+        if (header.flight != flight || header.entry < entry || (resync && header.entry != entry)) {
+            // Left over from an earlier stream
+            continue;
+        }
+        if (header.entry > entry) {
+            // We missed a chunk
+            requested = false;
+            continue;
+        }
+
+        resync  = false;
+        retries = 0;
+        for (int i = 0; i < count; i++) {
+            DebugLogEntry::DataFields fields;
+            memcpy(&fields, chunk.constData() + LOGSTREAM_HEADER_SIZE + i * entrySize, entrySize);
+            addLogEntry(fields);
+        }
+        entry += count;
+        done   = (header.flags & LOGSTREAM_FLAG_LAST) != 0;
+    }
+
+    m_streamLoop = 0;
+    m_streamChunks.clear();
+    return done;
+}
+
+void FlightLogManager::streamReceived(quint32 objId, quint16 instId, QByteArray data)
+{
+    Q_UNUSED(instId);
+
+    if (objId != DebugLogEntry::OBJID || !m_streamLoop) {
+        return;
+    }
+    m_streamChunks << data;
+    m_streamLoop->quit();
+}
+
+void FlightLogManager::addLogEntry(const DebugLogEntry::DataFields &data)
+{
+    ExtendedDebugLogEntry *logEntry = new ExtendedDebugLogEntry();
+
+    logEntry->setData(data, m_objectManager);
+    m_logEntries << logEntry;
+    if (logEntry->getData().Type == DebugLogEntry::TYPE_MULTIPLEUAVOBJECTS) {
+        const quint32 total_len  = sizeof(DebugLogEntry::DataFields);
+        const quint32 data_len   = sizeof(((DebugLogEntry::DataFields *)0)->Data);
+        const quint32 header_len = total_len - data_len;
+
+        DebugLogEntry::DataFields fields;
+        quint32 start = logEntry->getData().Size;
+
+        // cycle until there is space for another object
+        while (start + header_len + 1 < data_len) {
+            memset(&fields, 0xFF, total_len);
+            memcpy(&fields, &logEntry->getData().Data[start], header_len);
+            // check wether a packed object is found
+            // note that empty data blocks are set as 0xFF in flight side to minimize flash wearing
+            // thus as soon as this read outside of used area, the test will fail as lenght would be 0xFFFF
+            quint32 toread = header_len + fields.Size;
+            if (!(toread + start > data_len)) {
+                memcpy(&fields, &logEntry->getData().Data[start], toread);
+                ExtendedDebugLogEntry *subEntry = new ExtendedDebugLogEntry();
+                subEntry->setData(fields, m_objectManager);
+                m_logEntries << subEntry;
+            }
+            start += toread;
+        }
+    }
+}
+
 void FlightLogManager::exportToOPL(QString fileName)
 {
     // Fix the file name
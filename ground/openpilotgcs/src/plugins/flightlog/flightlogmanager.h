@@ -35,6 +35,7 @@
 #include <QSemaphore>
 #include <QXmlStreamWriter>
 #include <QTextStream>
+#include <QEventLoop>
 
 #include "uavobjectmanager.h"
 #include "uavobjectutilmanager.h"
@@ -319,6 +320,7 @@ private slots:
     void setupLogStatuses();
     void connectionStatusChanged();
     bool updateLogWrapper(QString name, int level, int period);
+    void streamReceived(quint32 objId, quint16 instId, QByteArray data);
 
 private:
     UAVObjectManager *m_objectManager;
@@ -338,11 +340,19 @@ private:
     QList<UAVOLogSettingsWrapper *> m_uavoEntries;
     QHash<QString, UAVOLogSettingsWrapper *> m_uavoEntriesHash;
 
+    QList<QByteArray> m_streamChunks;
+    QEventLoop *m_streamLoop;
+
+    bool streamFlight(int flight, int &entry);
+    void addLogEntry(const DebugLogEntry::DataFields &data);
+
     void exportToOPL(QString fileName);
     void exportToCSV(QString fileName);
     void exportToXML(QString fileName);
 
     static const int UAVTALK_TIMEOUT = 4000;
+    static const int STREAM_TIMEOUT  = 1000;
+    static const int STREAM_RETRIES  = 3;
     static const int LOG_SETTINGS_FILE_VERSION = 1;
     bool m_disableControls;
     bool m_disableExport;
@@ -53,6 +53,10 @@ LineardialGadgetWidget::LineardialGadgetWidget(QWidget *parent) : QGraphicsView(
     // This timer mechanism makes the index rotate smoothly
     connect(&dialTimer, SIGNAL(timeout()), this, SLOT(moveIndex()));
     dialTimer.start(30);
+
+    // The index follows the latest value, one update per event loop pass is enough
+    subscription = new UAVObjectSubscription(this);
+    connect(subscription, SIGNAL(objectChanged(UAVObject *)), this, SLOT(updateIndex(UAVObject *)));
 }
 
 LineardialGadgetWidget::~LineardialGadgetWidget()
@@ -77,9 +81,7 @@ void LineardialGadgetWidget::enableOpenGL(bool flag)
  */
 void LineardialGadgetWidget::connectInput(QString object1, QString nfield1)
 {
-    if (obj1 != NULL) {
-        disconnect(obj1, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateIndex(UAVObject *)));
-    }
+    subscription->unsubscribeAll();
     ExtensionSystem::PluginManager *pm = ExtensionSystem::PluginManager::instance();
     UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
 
@@ -89,7 +91,6 @@ void LineardialGadgetWidget::connectInput(QString object1, QString nfield1)
     if (!(object1.isEmpty() || nfield1.isEmpty())) {
         obj1 = dynamic_cast<UAVDataObject *>(objManager->getObject(object1));
         if (obj1 != NULL) {
-            connect(obj1, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateIndex(UAVObject *)));
             if (nfield1.contains("-")) {
                 QStringList fieldSubfield = nfield1.split("-", QString::SkipEmptyParts);
                 field1        = fieldSubfield.at(0);
@@ -99,6 +100,7 @@ void LineardialGadgetWidget::connectInput(QString object1, QString nfield1)
                 field1 = nfield1;
                 haveSubField1 = false;
             }
+            subscription->subscribe(obj1, QStringList() << field1);
             if (fieldName) {
                 fieldName->setPlainText(nfield1);
             }
@@ -32,6 +32,7 @@
 #include "extensionsystem/pluginmanager.h"
 #include "uavobjectmanager.h"
 #include "uavobject.h"
+#include "uavobjectsubscription.h"
 #include <QGraphicsView>
 #include <QtSvg/QSvgRenderer>
 #include <QtSvg/QGraphicsSvgItem>
@@ -133,6 +134,7 @@ private:
 
     // Name of the fields to read when an update is received:
     UAVDataObject *obj1;
+    UAVObjectSubscription *subscription;
     QString field1;
     QString subfield1;
     bool haveSubField1;
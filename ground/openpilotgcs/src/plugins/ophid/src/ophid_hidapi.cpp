@@ -212,6 +212,49 @@ int opHID_hidapi::open(int max, int vid, int pid, int usage_page, int usage)
 }
 
 
+/**
+ * \brief Open one particular HID device by its serial number
+ *
+ * \note Lets several boards with the same vid/pid be opened side by side,
+ *      one opHID_hidapi instance per board.
+ *
+ * \param[in] vid USB vendor id of the device to open.
+ * \param[in] pid USB product id of the device to open.
+ * \param[in] serial USB serial number string of the device to open.
+ * \return Number of opened device.
+ * \retval 0 or 1.
+ */
+int opHID_hidapi::open(int vid, int pid, const QString &serial)
+{
+    wchar_t serial_buf[USB_MAX_STRING_SIZE];
+
+    OPHID_TRACE("IN");
+
+    if (handle) {
+        OPHID_WARNING("HID device seems already open.");
+    }
+
+    int len = serial.left(USB_MAX_STRING_SIZE - 1).toWCharArray(serial_buf);
+    serial_buf[len] = 0;
+
+    // Without a serial number, the first device with these ids
+    handle = hid_open(vid, pid, serial.isEmpty() ? NULL : serial_buf);
+
+    if (!handle) {
+        OPHID_ERROR("Unable to open device %s.", qPrintable(serial));
+        return 0;
+    }
+
+    OPHID_DEBUG("HID Device Found");
+    OPHID_DEBUG("  type:............VID(%04hx).PID(%04hx)", vid, pid);
+    OPHID_DEBUG("  serial:..........%s", qPrintable(serial));
+
+    OPHID_TRACE("OUT");
+
+    return 1;
+}
+
+
 /**
  * \brief Read an Input report from a HID device.
  *
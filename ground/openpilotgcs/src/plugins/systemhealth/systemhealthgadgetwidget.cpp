@@ -58,7 +58,14 @@ SystemHealthGadgetWidget::SystemHealthGadgetWidget(QWidget *parent) : QGraphicsV
     UAVObjectManager *objManager = pm->getObject<UAVObjectManager>();
 
     SystemAlarms *obj = dynamic_cast<SystemAlarms *>(objManager->getObject(QString("SystemAlarms")));
-    connect(obj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(updateAlarms(UAVObject *)));
+    // The scene is rebuilt on each update, only do it when an alarm changed
+    QStringList fieldNames;
+    foreach(UAVObjectField * field, obj->getFields()) {
+        fieldNames.append(field->getName());
+    }
+    subscription = new UAVObjectSubscription(this);
+    subscription->subscribe(obj, fieldNames);
+    connect(subscription, SIGNAL(objectChanged(UAVObject *)), this, SLOT(updateAlarms(UAVObject *)));
 
     // Listen to autopilot connection events
     TelemetryManager *telMngr = pm->getObject<TelemetryManager>();
@@ -30,6 +30,7 @@
 
 #include "systemhealthgadgetconfiguration.h"
 #include "uavobject.h"
+#include "uavobjectsubscription.h"
 
 #include <QGraphicsView>
 #include <QtSvg/QSvgRenderer>
@@ -65,6 +66,7 @@ private:
     QGraphicsSvgItem *foreground;
     QGraphicsSvgItem *nolink;
     QStringList *missingElements;
+    UAVObjectSubscription *subscription;
     // Simple flag to skip rendering if the
     bool fgenabled; // layer does not exist.
 
@@ -42,6 +42,7 @@ class UAVDataObject;
 class UAVMetaObject;
 class UAVObjectField;
 class UAVObjectManager;
+class UAVObjectSubscription;
 class QSignalMapper;
 class QTimer;
 
@@ -126,6 +127,8 @@ private:
 
     // Highlight manager to handle highlighting of tree items.
     HighLightManager *m_highlightManager;
+
+    UAVObjectSubscription *m_subscription;
 };
 
 #endif // UAVOBJECTTREEMODEL_H
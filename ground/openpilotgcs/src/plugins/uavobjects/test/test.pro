@@ -0,0 +1,11 @@
+CONFIG += qtestlib
+TEMPLATE = app
+CONFIG -= app_bundle
+
+include(../../../../openpilotgcs.pri)
+
+# Links the built plugin and the libraries it depends on
+LIBS += -L$$GCS_PLUGIN_PATH/OpenPilot
+include(../uavobjects.pri)
+
+SOURCES += tst_uavobjectsubscription.cpp
@@ -0,0 +1,375 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_uavobjectsubscription.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief Coalesced object notifications under fast telemetry
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "uavobjectsubscription.h"
+#include "uavdataobject.h"
+#include "uavobjectfield.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QObject>
+#include <QtEndian>
+
+// Gadgets watching the object in the throughput benchmarks
+#define GADGETS 8
+// Updates received in one event loop pass, a telemetry burst
+#define BURST   50
+
+/*
+ * A data object with two fields, built the same way as the generated objects.
+ */
+class SyntheticObject : public UAVDataObject {
+public:
+    SyntheticObject() : UAVDataObject(0x5E7B1D01, true, false, "SyntheticObject")
+    {
+        QList<UAVObjectField *> fields;
+        fields.append(new UAVObjectField("Attitude", "", "deg", UAVObjectField::FLOAT32, 3, QStringList()));
+        fields.append(new UAVObjectField("Status", "", "", UAVObjectField::UINT8, 1, QStringList()));
+        memset(&m_data, 0, sizeof(m_data));
+        initializeFields(fields, (quint8 *)&m_data, sizeof(m_data));
+    }
+
+    Metadata getDefaultMetadata()
+    {
+        Metadata metadata;
+
+        memset(&metadata, 0, sizeof(metadata));
+        return metadata;
+    }
+
+    UAVDataObject *clone(quint32 instID)
+    {
+        Q_UNUSED(instID);
+        return new SyntheticObject();
+    }
+
+    UAVDataObject *dirtyClone()
+    {
+        return new SyntheticObject();
+    }
+
+    int updateReceivers()
+    {
+        return receivers(SIGNAL(objectUpdated(UAVObject *)));
+    }
+
+private:
+    struct {
+        float   attitude[3];
+        quint8  status;
+    } __attribute__((packed)) m_data;
+};
+
+/*
+ * Stands for a gadget: reads the attitude on each notification.
+ */
+class Gadget : public QObject {
+    Q_OBJECT
+
+public:
+    Gadget() : m_count(0), m_roll(0)
+    {}
+
+    int m_count;
+    double m_roll;
+
+public slots:
+    void update(UAVObject *obj)
+    {
+        m_count++;
+        m_roll = obj->getField("Attitude")->getDouble(0);
+    }
+};
+
+class tst_UAVObjectSubscription : public QObject {
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+
+    void updatesAreCoalesced();
+    void manualUpdatesNotify();
+    void subscriptionsShareObjects();
+    void fieldsAreFiltered();
+    void unsubscribeStopsNotifications();
+    void deletedSubscriptionIsSafe();
+    void deletedObjectIsForgotten();
+
+    void benchmarkDirectSignals();
+    void benchmarkSubscriptions();
+    void benchmarkFieldSubscriptions();
+
+private:
+    void unpack(float roll, quint8 status);
+
+    SyntheticObject *m_object;
+};
+
+void tst_UAVObjectSubscription::init()
+{
+    m_object = new SyntheticObject();
+}
+
+void tst_UAVObjectSubscription::cleanup()
+{
+    delete m_object;
+}
+
+/*
+ * Unpacks the object as telemetry does
+ */
+void tst_UAVObjectSubscription::unpack(float roll, quint8 status)
+{
+    QByteArray buffer(m_object->getNumBytes(), 0);
+    quint32 value;
+
+    memcpy(&value, &roll, sizeof(value));
+    qToLittleEndian<quint32>(value, (uchar *)buffer.data());
+    buffer[3 * sizeof(float)] = status;
+    m_object->unpack((const quint8 *)buffer.constData());
+}
+
+void tst_UAVObjectSubscription::updatesAreCoalesced()
+{
+    UAVObjectSubscription subscription;
+    Gadget gadget;
+
+    connect(&subscription, SIGNAL(objectChanged(UAVObject *)), &gadget, SLOT(update(UAVObject *)));
+    subscription.subscribe(m_object);
+
+    for (int i = 0; i < BURST; i++) {
+        unpack(i, 0);
+    }
+    QCOMPARE(gadget.m_count, 0);
+
+    QCoreApplication::processEvents();
+    QCOMPARE(gadget.m_count, 1);
+    QCOMPARE(gadget.m_roll, (double)BURST - 1);
+
+    // Nothing left for the next pass
+    QCoreApplication::processEvents();
+    QCOMPARE(gadget.m_count, 1);
+}
+
+void tst_UAVObjectSubscription::manualUpdatesNotify()
+{
+    UAVObjectSubscription subscription;
+    Gadget gadget;
+
+    connect(&subscription, SIGNAL(objectChanged(UAVObject *)), &gadget, SLOT(update(UAVObject *)));
+    subscription.subscribe(m_object);
+
+    m_object->getField("Attitude")->setDouble(12.5, 0);
+    m_object->updated();
+    m_object->updated();
+    QCoreApplication::processEvents();
+
+    QCOMPARE(gadget.m_count, 1);
+    QCOMPARE(gadget.m_roll, 12.5);
+}
+
+void tst_UAVObjectSubscription::subscriptionsShareObjects()
+{
+    UAVObjectSubscription subscriptions[GADGETS];
+    Gadget gadgets[GADGETS];
+
+    for (int i = 0; i < GADGETS; i++) {
+        connect(&subscriptions[i], SIGNAL(objectChanged(UAVObject *)), &gadgets[i], SLOT(update(UAVObject *)));
+        subscriptions[i].subscribe(m_object);
+    }
+    // One connection to the object, whatever the number of subscriptions
+    QCOMPARE(m_object->updateReceivers(), 1);
+
+    quint64 notifications = UAVObjectNotifier::instance()->notificationCount();
+    for (int i = 0; i < BURST; i++) {
+        unpack(i, 0);
+    }
+    QCoreApplication::processEvents();
+
+    for (int i = 0; i < GADGETS; i++) {
+        QCOMPARE(gadgets[i].m_count, 1);
+    }
+    QCOMPARE(UAVObjectNotifier::instance()->notificationCount() - notifications, (quint64)GADGETS);
+}
+
+void tst_UAVObjectSubscription::fieldsAreFiltered()
+{
+    UAVObjectSubscription subscription;
+    Gadget gadget;
+
+    connect(&subscription, SIGNAL(objectChanged(UAVObject *)), &gadget, SLOT(update(UAVObject *)));
+    subscription.subscribe(m_object, QStringList() << "Attitude");
+
+    // The first update after subscribing always notifies
+    unpack(0, 0);
+    QCoreApplication::processEvents();
+    QCOMPARE(gadget.m_count, 1);
+
+    // Same attitude
+    unpack(0, 0);
+    QCoreApplication::processEvents();
+    QCOMPARE(gadget.m_count, 1);
+
+    // Another field changed
+    unpack(0, 3);
+    QCoreApplication::processEvents();
+    QCOMPARE(gadget.m_count, 1);
+
+    unpack(5, 3);
+    QCoreApplication::processEvents();
+    QCOMPARE(gadget.m_count, 2);
+    QCOMPARE(gadget.m_roll, 5.0);
+
+    // Changed and back within a pass is no change
+    unpack(6, 3);
+    unpack(5, 3);
+    QCoreApplication::processEvents();
+    QCOMPARE(gadget.m_count, 2);
+
+    // Subscribing the whole object notifies every update again
+    subscription.subscribe(m_object);
+    unpack(5, 3);
+    QCoreApplication::processEvents();
+    QCOMPARE(gadget.m_count, 3);
+}
+
+void tst_UAVObjectSubscription::unsubscribeStopsNotifications()
+{
+    UAVObjectSubscription subscription;
+    Gadget gadget;
+
+    connect(&subscription, SIGNAL(objectChanged(UAVObject *)), &gadget, SLOT(update(UAVObject *)));
+    subscription.subscribe(m_object);
+
+    unpack(1, 0);
+    subscription.unsubscribe(m_object);
+    QCoreApplication::processEvents();
+
+    QCOMPARE(gadget.m_count, 0);
+    QVERIFY(!subscription.isSubscribed(m_object));
+    QCOMPARE(m_object->updateReceivers(), 0);
+}
+
+void tst_UAVObjectSubscription::deletedSubscriptionIsSafe()
+{
+    UAVObjectSubscription *subscription = new UAVObjectSubscription();
+    UAVObjectSubscription other;
+    Gadget gadget;
+
+    connect(&other, SIGNAL(objectChanged(UAVObject *)), &gadget, SLOT(update(UAVObject *)));
+    subscription->subscribe(m_object);
+    other.subscribe(m_object);
+
+    unpack(1, 0);
+    delete subscription;
+    QCoreApplication::processEvents();
+
+    QCOMPARE(gadget.m_count, 1);
+}
+
+void tst_UAVObjectSubscription::deletedObjectIsForgotten()
+{
+    SyntheticObject *object = new SyntheticObject();
+    UAVObjectSubscription subscription;
+
+    subscription.subscribe(object);
+    object->updated();
+    delete object;
+    QCoreApplication::processEvents();
+
+    QVERIFY(!subscription.isSubscribed(object));
+}
+
+/*
+ * Every gadget connected to the object, as before: each update reaches each
+ * gadget
+ */
+void tst_UAVObjectSubscription::benchmarkDirectSignals()
+{
+    Gadget gadgets[GADGETS];
+
+    for (int i = 0; i < GADGETS; i++) {
+        connect(m_object, SIGNAL(objectUpdated(UAVObject *)), &gadgets[i], SLOT(update(UAVObject *)));
+    }
+
+    int i = 0;
+    QBENCHMARK {
+        for (int j = 0; j < BURST; j++) {
+            unpack(i++, 0);
+        }
+        QCoreApplication::processEvents();
+    }
+}
+
+/*
+ * Every gadget subscribed to the object: one notification per gadget and pass
+ */
+void tst_UAVObjectSubscription::benchmarkSubscriptions()
+{
+    UAVObjectSubscription subscriptions[GADGETS];
+    Gadget gadgets[GADGETS];
+
+    for (int i = 0; i < GADGETS; i++) {
+        connect(&subscriptions[i], SIGNAL(objectChanged(UAVObject *)), &gadgets[i], SLOT(update(UAVObject *)));
+        subscriptions[i].subscribe(m_object);
+    }
+
+    int i = 0;
+    QBENCHMARK {
+        for (int j = 0; j < BURST; j++) {
+            unpack(i++, 0);
+        }
+        QCoreApplication::processEvents();
+    }
+}
+
+/*
+ * Every gadget subscribed to a field that does not change: the values are
+ * compared once per gadget and pass, nothing is delivered
+ */
+void tst_UAVObjectSubscription::benchmarkFieldSubscriptions()
+{
+    UAVObjectSubscription subscriptions[GADGETS];
+    Gadget gadgets[GADGETS];
+
+    for (int i = 0; i < GADGETS; i++) {
+        connect(&subscriptions[i], SIGNAL(objectChanged(UAVObject *)), &gadgets[i], SLOT(update(UAVObject *)));
+        subscriptions[i].subscribe(m_object, QStringList() << "Status");
+    }
+
+    int i = 0;
+    QBENCHMARK {
+        for (int j = 0; j < BURST; j++) {
+            unpack(i++, 0);
+        }
+        QCoreApplication::processEvents();
+    }
+}
+
+QTEST_MAIN(tst_UAVObjectSubscription)
+
+#include "tst_uavobjectsubscription.moc"
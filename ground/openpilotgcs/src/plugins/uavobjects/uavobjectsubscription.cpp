@@ -0,0 +1,250 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectsubscription.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      The UAVUObjects GCS plugin
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#include "uavobjectsubscription.h"
+
+#include <QDebug>
+
+UAVObjectSubscription::UAVObjectSubscription(QObject *parent) : QObject(parent)
+{}
+
+UAVObjectSubscription::~UAVObjectSubscription()
+{
+    unsubscribeAll();
+}
+
+/**
+ * Notify the object's updates, once per event loop pass
+ */
+void UAVObjectSubscription::subscribe(UAVObject *obj)
+{
+    Q_ASSERT(obj);
+    if (!m_watches.contains(obj)) {
+        UAVObjectNotifier::instance()->add(this, obj);
+    }
+    Watch &watch = m_watches[obj];
+    watch.all = true;
+    watch.fields.clear();
+    watch.values.clear();
+}
+
+/**
+ * Notify the changes of the given fields of the object, once per event loop pass.
+ * Fields are added to the ones already subscribed, an object subscribed
+ * whole stays so.
+ */
+void UAVObjectSubscription::subscribe(UAVObject *obj, const QStringList & fieldNames)
+{
+    Q_ASSERT(obj);
+    if (!m_watches.contains(obj)) {
+        UAVObjectNotifier::instance()->add(this, obj);
+    }
+    Watch &watch = m_watches[obj];
+    if (watch.all) {
+        return;
+    }
+    foreach(QString fieldName, fieldNames) {
+        UAVObjectField *field = obj->getField(fieldName);
+        if (field == NULL) {
+            qDebug() << "UAVObjectSubscription: unknown field" << fieldName << "in" << obj->getName();
+        } else if (!watch.fields.contains(field)) {
+            watch.fields.append(field);
+        }
+    }
+    // The next update notifies, whatever the values
+    watch.values.clear();
+}
+
+void UAVObjectSubscription::unsubscribe(UAVObject *obj)
+{
+    if (m_watches.remove(obj) > 0) {
+        UAVObjectNotifier::instance()->remove(this, obj);
+    }
+}
+
+void UAVObjectSubscription::unsubscribeAll()
+{
+    foreach(UAVObject * obj, m_watches.keys()) {
+        unsubscribe(obj);
+    }
+}
+
+bool UAVObjectSubscription::isSubscribed(UAVObject *obj) const
+{
+    return m_watches.contains(obj);
+}
+
+/**
+ * Called by the notifier once per pass for each updated object
+ * @returns True if objectChanged() was emitted
+ */
+bool UAVObjectSubscription::notify(UAVObject *obj)
+{
+    QHash<UAVObject *, Watch>::iterator watch = m_watches.find(obj);
+
+    if (watch == m_watches.end()) {
+        return false;
+    }
+    if (!watch->all) {
+        if (watch->fields.isEmpty()) {
+            return false;
+        }
+        QByteArray values;
+        {
+            QMutexLocker locker(obj->getMutex());
+            foreach(UAVObjectField * field, watch->fields) {
+                int offset = values.size();
+                values.resize(offset + field->getNumBytes());
+                field->pack((quint8 *)values.data() + offset);
+            }
+        }
+        if (values == watch->values) {
+            return false;
+        }
+        watch->values = values;
+    }
+    emit objectChanged(obj);
+    return true;
+}
+
+/**
+ * Called by the notifier when a subscribed object is destroyed
+ */
+void UAVObjectSubscription::forget(UAVObject *obj)
+{
+    m_watches.remove(obj);
+}
+
+UAVObjectNotifier::UAVObjectNotifier() : m_updateCount(0), m_notificationCount(0)
+{
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(0);
+    connect(&m_flushTimer, SIGNAL(timeout()), this, SLOT(flush()));
+}
+
+/**
+ * The notifier of the GUI thread, created on the first subscription
+ */
+UAVObjectNotifier *UAVObjectNotifier::instance()
+{
+    // Never deleted, subscriptions may outlive any owner
+    static UAVObjectNotifier *notifier = new UAVObjectNotifier();
+
+    return notifier;
+}
+
+void UAVObjectNotifier::add(UAVObjectSubscription *subscription, UAVObject *obj)
+{
+    QHash<UAVObject *, Entry>::iterator entry = m_entries.find(obj);
+
+    if (entry == m_entries.end()) {
+        // One connection per object, whatever the number of subscriptions
+        connect(obj, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(objectUpdated(UAVObject *)));
+        connect(obj, SIGNAL(destroyed(QObject *)), this, SLOT(objectDestroyed(QObject *)));
+        entry = m_entries.insert(obj, Entry());
+    }
+    if (!entry->subscriptions.contains(subscription)) {
+        entry->subscriptions.append(subscription);
+    }
+}
+
+void UAVObjectNotifier::remove(UAVObjectSubscription *subscription, UAVObject *obj)
+{
+    QHash<UAVObject *, Entry>::iterator entry = m_entries.find(obj);
+
+    if (entry == m_entries.end()) {
+        return;
+    }
+    entry->subscriptions.removeAll(subscription);
+    if (entry->subscriptions.isEmpty()) {
+        disconnect(obj, 0, this, 0);
+        if (entry->pending) {
+            m_pending.removeAll(obj);
+        }
+        m_entries.erase(entry);
+    }
+}
+
+void UAVObjectNotifier::objectUpdated(UAVObject *obj)
+{
+    QHash<UAVObject *, Entry>::iterator entry = m_entries.find(obj);
+
+    ++m_updateCount;
+    if (entry == m_entries.end() || entry->pending) {
+        return;
+    }
+    entry->pending = true;
+    m_pending.append(obj);
+    if (!m_flushTimer.isActive()) {
+        m_flushTimer.start();
+    }
+}
+
+void UAVObjectNotifier::objectDestroyed(QObject *object)
+{
+    // Only the address is left, the object is not a UAVObject anymore
+    UAVObject *obj = static_cast<UAVObject *>(object);
+    QHash<UAVObject *, Entry>::iterator entry = m_entries.find(obj);
+
+    if (entry == m_entries.end()) {
+        return;
+    }
+    foreach(UAVObjectSubscription * subscription, entry->subscriptions) {
+        subscription->forget(obj);
+    }
+    m_pending.removeAll(obj);
+    m_entries.erase(entry);
+}
+
+/**
+ * Notify the subscriptions of the objects updated since the last pass
+ */
+void UAVObjectNotifier::flush()
+{
+    QList<UAVObject *> pending;
+
+    m_flushTimer.stop();
+    pending.swap(m_pending);
+    foreach(UAVObject * obj, pending) {
+        QHash<UAVObject *, Entry>::iterator entry = m_entries.find(obj);
+        if (entry == m_entries.end()) {
+            continue;
+        }
+        entry->pending = false;
+        // A slot may subscribe or unsubscribe, check each subscription is still there
+        QList<UAVObjectSubscription *> subscriptions = entry->subscriptions;
+        foreach(UAVObjectSubscription * subscription, subscriptions) {
+            entry = m_entries.find(obj);
+            if (entry == m_entries.end()) {
+                break;
+            }
+            if (entry->subscriptions.contains(subscription) && subscription->notify(obj)) {
+                ++m_notificationCount;
+            }
+        }
+    }
+}
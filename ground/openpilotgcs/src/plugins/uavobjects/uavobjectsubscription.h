@@ -0,0 +1,137 @@
+/**
+ ******************************************************************************
+ *
+ * @file       uavobjectsubscription.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @see        The GNU Public License (GPL) Version 3
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectsPlugin UAVObjects Plugin
+ * @{
+ * @brief      The UAVUObjects GCS plugin
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+#ifndef UAVOBJECTSUBSCRIPTION_H
+#define UAVOBJECTSUBSCRIPTION_H
+
+#include "uavobjects_global.h"
+#include "uavobject.h"
+#include "uavobjectfield.h"
+#include <QObject>
+#include <QHash>
+#include <QList>
+#include <QStringList>
+#include <QByteArray>
+#include <QTimer>
+
+/*
+ * Change notifications for a set of objects, for the gadgets that only show
+ * the latest value.
+ *
+ * objectChanged() is emitted at most once per object and event loop pass,
+ * however many times the object was unpacked or updated in between. An object
+ * subscribed with field names only notifies when one of those fields changed
+ * since the last notification.
+ *
+ * Subscriptions belong to the GUI thread; the objects may be updated from any
+ * thread.
+ */
+class UAVOBJECTS_EXPORT UAVObjectSubscription : public QObject {
+    Q_OBJECT
+
+public:
+    explicit UAVObjectSubscription(QObject *parent = 0);
+    ~UAVObjectSubscription();
+
+    // Every update of the object
+    void subscribe(UAVObject *obj);
+    // Changes of the given fields, added to the fields already subscribed
+    void subscribe(UAVObject *obj, const QStringList & fieldNames);
+    void unsubscribe(UAVObject *obj);
+    void unsubscribeAll();
+    bool isSubscribed(UAVObject *obj) const;
+
+signals:
+    void objectChanged(UAVObject *obj);
+
+private:
+    friend class UAVObjectNotifier;
+
+    struct Watch {
+        Watch() : all(false)
+        {}
+        bool all;
+        QList<UAVObjectField *> fields;
+        // Packed values of the fields at the last notification
+        QByteArray values;
+    };
+
+    bool notify(UAVObject *obj);
+    void forget(UAVObject *obj);
+
+    QHash<UAVObject *, Watch> m_watches;
+};
+
+/*
+ * Shared by all the subscriptions: connected once to each subscribed object,
+ * it queues the updated objects and notifies their subscriptions on the next
+ * event loop pass.
+ */
+class UAVOBJECTS_EXPORT UAVObjectNotifier : public QObject {
+    Q_OBJECT
+
+public:
+    static UAVObjectNotifier *instance();
+
+    void add(UAVObjectSubscription *subscription, UAVObject *obj);
+    void remove(UAVObjectSubscription *subscription, UAVObject *obj);
+
+    // Updates received and notifications delivered so far
+    quint64 updateCount() const
+    {
+        return m_updateCount;
+    }
+    quint64 notificationCount() const
+    {
+        return m_notificationCount;
+    }
+
+public slots:
+    void flush();
+
+private slots:
+    void objectUpdated(UAVObject *obj);
+    void objectDestroyed(QObject *obj);
+
+private:
+    UAVObjectNotifier();
+
+    struct Entry {
+        Entry() : pending(false)
+        {}
+        bool pending;
+        QList<UAVObjectSubscription *> subscriptions;
+    };
+
+    QHash<UAVObject *, Entry> m_entries;
+    QList<UAVObject *> m_pending;
+    QTimer m_flushTimer;
+    quint64 m_updateCount;
+    quint64 m_notificationCount;
+};
+
+#endif // UAVOBJECTSUBSCRIPTION_H
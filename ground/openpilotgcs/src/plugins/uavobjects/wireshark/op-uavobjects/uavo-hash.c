@@ -0,0 +1,87 @@
+/* uavo-hash.c
+ * Open addressed table from the object IDs to the generated UAVObject
+ * dissectors, kept free of the epan API for the unit tests
+ * Copyright 2014 The OpenPilot Team, http://www.openpilot.org
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#include "uavo-hash.h"
+
+/*
+ * The table has 1 << bits slots holding indexes into ids, or
+ * UAVO_HASH_EMPTY. The object IDs are hashes already but always even, so
+ * the slot comes from the top bits of a Fibonacci hash rather than the
+ * bottom ones.
+ */
+static uint32_t slotOf(uint32_t objid, uint32_t bits)
+{
+    return (uint32_t)(objid * 2654435761u) >> (32 - bits);
+}
+
+void uavo_hash_init(int16_t *slots, uint32_t bits)
+{
+    uint32_t n;
+
+    for (n = 0; n < (1u << bits); n++) {
+        slots[n] = UAVO_HASH_EMPTY;
+    }
+}
+
+/*
+ * Adds ids[index], returns the number of slots probed or -1 when the table
+ * is full or already has the ID
+ */
+int32_t uavo_hash_insert(int16_t *slots, uint32_t bits, const uint32_t *ids, int16_t index)
+{
+    uint32_t mask = (1u << bits) - 1;
+    uint32_t slot = slotOf(ids[index], bits);
+    uint32_t n;
+
+    for (n = 0; n <= mask; n++, slot = (slot + 1) & mask) {
+        if (slots[slot] == UAVO_HASH_EMPTY) {
+            slots[slot] = index;
+            return n + 1;
+        }
+        if (ids[slots[slot]] == ids[index]) {
+            return -1;
+        }
+    }
+    return -1;
+}
+
+/*
+ * Index of objid in ids, or -1
+ */
+int32_t uavo_hash_find(const int16_t *slots, uint32_t bits, const uint32_t *ids, uint32_t objid)
+{
+    uint32_t mask = (1u << bits) - 1;
+    uint32_t slot = slotOf(objid, bits);
+    uint32_t n;
+
+    for (n = 0; n <= mask; n++, slot = (slot + 1) & mask) {
+        if (slots[slot] == UAVO_HASH_EMPTY) {
+            break;
+        }
+        if (ids[slots[slot]] == objid) {
+            return slots[slot];
+        }
+    }
+    return -1;
+}
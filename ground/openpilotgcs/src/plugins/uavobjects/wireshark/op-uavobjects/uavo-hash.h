@@ -0,0 +1,35 @@
+/* uavo-hash.h
+ * Object ID to UAVObject dissector lookup
+ * Copyright 2014 The OpenPilot Team, http://www.openpilot.org
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef UAVO_HASH_H
+#define UAVO_HASH_H
+
+#include <stdint.h>
+
+#define UAVO_HASH_EMPTY -1
+
+void uavo_hash_init(int16_t *slots, uint32_t bits);
+int32_t uavo_hash_insert(int16_t *slots, uint32_t bits, const uint32_t *ids, int16_t index);
+int32_t uavo_hash_find(const int16_t *slots, uint32_t bits, const uint32_t *ids, uint32_t objid);
+
+#endif /* UAVO_HASH_H */
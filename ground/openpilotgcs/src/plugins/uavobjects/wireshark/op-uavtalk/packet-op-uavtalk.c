@@ -30,68 +30,77 @@
 
 #include <epan/packet.h>
 #include <epan/prefs.h>
+#include <epan/expert.h>
 #include <epan/ptvcursor.h> /* ptvcursor_* */
+#include <epan/dissectors/packet-tcp.h> /* tcp_dissect_pdus */
 
 #include <glib.h>
 #include <string.h>
 
+#include "uavtalk-frame.h"
+
 static guint global_op_uavtalk_port = 9000;
+static guint global_op_uavtalk_tcp_port = 9000;
+static gboolean op_uavtalk_desegment = TRUE;
 
 static int proto_op_uavtalk = -1;
 
 static gint ett_op_uavtalk  = -1;
 
 static dissector_handle_t data_handle;
+static dissector_handle_t uavobjects_handle;
 static dissector_table_t uavtalk_subdissector_table;
 
-static int hf_op_uavtalk_sync    = -1;
-static int hf_op_uavtalk_version = -1;
-static int hf_op_uavtalk_type    = -1;
-static int hf_op_uavtalk_len     = -1;
-static int hf_op_uavtalk_objid   = -1;
-static int hf_op_uavtalk_crc8    = -1;
-
-#define UAVTALK_SYNC_VAL 0x3C
+static int hf_op_uavtalk_sync      = -1;
+static int hf_op_uavtalk_version   = -1;
+static int hf_op_uavtalk_timestamped = -1;
+static int hf_op_uavtalk_type      = -1;
+static int hf_op_uavtalk_len       = -1;
+static int hf_op_uavtalk_objid     = -1;
+static int hf_op_uavtalk_instid    = -1;
+static int hf_op_uavtalk_timestamp = -1;
+static int hf_op_uavtalk_crc8      = -1;
 
 static const value_string uavtalk_packet_types[] = {
-    { 0, "TxObj"      },
-    { 1, "GetObj"     },
-    { 2, "SetObjAckd" },
-    { 3, "Ack"        },
-    { 4, "Nack"       },
-    { 0, NULL         }
+    { UAVTALK_TYPE_OBJ,     "TxObj"      },
+    { UAVTALK_TYPE_OBJ_REQ, "GetObj"     },
+    { UAVTALK_TYPE_OBJ_ACK, "SetObjAckd" },
+    { UAVTALK_TYPE_ACK,     "Ack"        },
+    { UAVTALK_TYPE_NACK,    "Nack"       },
+    { UAVTALK_TYPE_STREAM,  "Stream"     },
+    { 0,                    NULL         }
 };
 
 void proto_reg_handoff_op_uavtalk(void);
 
-#define UAVTALK_HEADER_SIZE  8
-#define UAVTALK_TRAILER_SIZE 1
-static int dissect_op_uavtalk(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
+/* Dissects one frame, tvb starting at its sync byte and ending with its checksum */
+static int dissect_op_uavtalk_frame(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
 {
-    gint offset   = 0;
-
-    guint8 packet_type = tvb_get_guint8(tvb, 1) & 0x7;
-    guint32 objid = tvb_get_letohl(tvb, 4);
-    guint32 payload_length  = tvb_get_letohs(tvb, 2) - UAVTALK_HEADER_SIZE - UAVTALK_TRAILER_SIZE;
-    guint32 reported_length = tvb_reported_length(tvb);
-
-    col_set_str(pinfo->cinfo, COL_PROTOCOL, "UAVTALK");
-    /* Clear out stuff in the info column */
-    col_clear(pinfo->cinfo, COL_INFO);
-
-    col_append_fstr(pinfo->cinfo, COL_INFO, "%s: 0x%08x", val_to_str_const(packet_type, uavtalk_packet_types, ""), objid);
+    guint8 type_byte = tvb_get_guint8(tvb, 1);
+    guint8 packet_type = type_byte & UAVTALK_TYPE_MASK_PACKET;
+    guint32 frame_length  = tvb_get_letohs(tvb, 2) + UAVTALK_CHECKSUM_LENGTH;
+    guint32 objid  = tvb_get_letohl(tvb, 4);
+    guint16 instid = tvb_get_letohs(tvb, 8);
+    guint32 header_length = UAVTALK_MIN_HEADER_LENGTH + ((type_byte & UAVTALK_TIMESTAMPED) ? UAVTALK_TIMESTAMP_LENGTH : 0);
+    guint32 payload_length = frame_length - header_length - UAVTALK_CHECKSUM_LENGTH;
+    guint8 crc = uavtalk_crc8(0, tvb_get_ptr(tvb, 0, frame_length - UAVTALK_CHECKSUM_LENGTH), frame_length - UAVTALK_CHECKSUM_LENGTH);
+    guint8 frame_crc = tvb_get_guint8(tvb, frame_length - UAVTALK_CHECKSUM_LENGTH);
+    struct uavtalk_object_ref ref;
+    void *saved_private_data;
+
+    col_append_sep_fstr(pinfo->cinfo, COL_INFO, ", ", "%s: 0x%08x", val_to_str_const(packet_type, uavtalk_packet_types, ""), objid);
     if (objid & 0x1) {
         col_append_str(pinfo->cinfo, COL_INFO, "(META)");
     }
 
-
     if (tree) { /* we are being asked for details */
         proto_tree *op_uavtalk_tree = NULL;
         ptvcursor_t *cursor;
         proto_item *ti = NULL;
+        proto_item *crc_item;
 
         /* Add a top-level entry to the dissector tree for this protocol */
-        ti = proto_tree_add_item(tree, proto_op_uavtalk, tvb, 0, -1, ENC_NA);
+        ti = proto_tree_add_item(tree, proto_op_uavtalk, tvb, 0, frame_length, ENC_NA);
 
         /* Create a subtree to contain the dissection of this protocol */
         op_uavtalk_tree = proto_item_add_subtree(ti, ett_op_uavtalk);
@@ -101,39 +110,125 @@ static int dissect_op_uavtalk(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tre
 
         /* Populate the fields in this protocol */
         ptvcursor_add(cursor, hf_op_uavtalk_sync, 1, ENC_LITTLE_ENDIAN);
+        ptvcursor_add_no_advance(cursor, hf_op_uavtalk_timestamped, 1, ENC_LITTLE_ENDIAN);
         ptvcursor_add_no_advance(cursor, hf_op_uavtalk_version, 1, ENC_LITTLE_ENDIAN);
         ptvcursor_add(cursor, hf_op_uavtalk_type, 1, ENC_LITTLE_ENDIAN);
         ptvcursor_add(cursor, hf_op_uavtalk_len, 2, ENC_LITTLE_ENDIAN);
         ptvcursor_add(cursor, hf_op_uavtalk_objid, 4, ENC_LITTLE_ENDIAN);
-
-        offset = ptvcursor_current_offset(cursor);
+        ptvcursor_add(cursor, hf_op_uavtalk_instid, 2, ENC_LITTLE_ENDIAN);
+        if (type_byte & UAVTALK_TIMESTAMPED) {
+            ptvcursor_add(cursor, hf_op_uavtalk_timestamp, 2, ENC_LITTLE_ENDIAN);
+        }
 
         ptvcursor_free(cursor);
 
-        proto_tree_add_item(op_uavtalk_tree, hf_op_uavtalk_crc8, tvb, reported_length - UAVTALK_TRAILER_SIZE, UAVTALK_TRAILER_SIZE, ENC_LITTLE_ENDIAN);
-    } else {
-        offset = UAVTALK_HEADER_SIZE;
+        crc_item = proto_tree_add_item(op_uavtalk_tree, hf_op_uavtalk_crc8, tvb, frame_length - UAVTALK_CHECKSUM_LENGTH, UAVTALK_CHECKSUM_LENGTH, ENC_LITTLE_ENDIAN);
+        if (crc == frame_crc) {
+            proto_item_append_text(crc_item, " [correct]");
+        } else {
+            proto_item_append_text(crc_item, " [incorrect, should be 0x%02x]", crc);
+        }
+    }
+    if (crc != frame_crc) {
+        expert_add_info_format(pinfo, NULL, PI_CHECKSUM, PI_ERROR, "Bad UAVTalk checksum");
     }
 
     {
-        tvbuff_t *next_tvb = tvb_new_subset(tvb, offset,
-                                            reported_length - UAVTALK_HEADER_SIZE - UAVTALK_TRAILER_SIZE,
-                                            payload_length);
-
-        /* Check if we have an embedded objid to decode */
-        if ((packet_type == 0) || (packet_type == 2)) {
-            /* Call any registered subdissector for this objid */
-            if (!dissector_try_uint(uavtalk_subdissector_table, objid, next_tvb, pinfo, tree)) {
-                /* No subdissector registered, use the default data dissector */
-                call_dissector(data_handle, next_tvb, pinfo, tree);
+        tvbuff_t *next_tvb = tvb_new_subset(tvb, header_length, payload_length, payload_length);
+
+        /* Name the object, and decode it when the frame carries it */
+        ref.objid    = objid;
+        ref.instid   = instid;
+        ref.has_data = (packet_type == UAVTALK_TYPE_OBJ) || (packet_type == UAVTALK_TYPE_OBJ_ACK);
+
+        saved_private_data = pinfo->private_data;
+        pinfo->private_data = &ref;
+        if (packet_type == UAVTALK_TYPE_STREAM ||
+            uavobjects_handle == NULL ||
+            !call_dissector_only(uavobjects_handle, next_tvb, pinfo, tree)) {
+            /* Call any registered subdissector for this objid, or render the raw bytes */
+            if (!ref.has_data || !dissector_try_uint(uavtalk_subdissector_table, objid, next_tvb, pinfo, tree)) {
+                if (payload_length > 0) {
+                    call_dissector(data_handle, next_tvb, pinfo, tree);
+                }
             }
+        }
+        pinfo->private_data = saved_private_data;
+    }
+
+    return frame_length;
+}
+
+/* Bytes that do not start a frame, up to the next sync byte */
+static int dissect_op_uavtalk_noise(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
+{
+    col_append_sep_str(pinfo->cinfo, COL_INFO, ", ", "[Not UAVTalk]");
+    call_dissector(data_handle, tvb, pinfo, tree);
+    return tvb_length(tvb);
+}
+
+static guint get_op_uavtalk_pdu_len(packet_info *pinfo _U_, tvbuff_t *tvb, int offset)
+{
+    guint available = tvb_length_remaining(tvb, offset);
+    const guint8 *data = tvb_get_ptr(tvb, offset, available);
+    gint32 length = uavtalk_frame_length(data, available);
+
+    /* Line noise goes up to the next possible frame as one PDU */
+    if (length < 0) {
+        return uavtalk_resync(data, available);
+    }
+    return length;
+}
+
+static void dissect_op_uavtalk_pdu(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
+{
+    if (uavtalk_frame_length(tvb_get_ptr(tvb, 0, tvb_length(tvb)), tvb_length(tvb)) > 0) {
+        dissect_op_uavtalk_frame(tvb, pinfo, tree);
+    } else {
+        dissect_op_uavtalk_noise(tvb, pinfo, tree);
+    }
+}
+
+/* TCP carries a stream: frames span segments and segments hold several frames */
+static void dissect_op_uavtalk_tcp(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
+{
+    col_set_str(pinfo->cinfo, COL_PROTOCOL, "UAVTALK");
+    /* Clear out stuff in the info column */
+    col_clear(pinfo->cinfo, COL_INFO);
+
+    tcp_dissect_pdus(tvb, pinfo, tree, op_uavtalk_desegment, UAVTALK_FRAME_PROBE_LENGTH,
+                     get_op_uavtalk_pdu_len, dissect_op_uavtalk_pdu);
+}
+
+/* A UDP datagram holds whole frames, as many as fitted in the write */
+static int dissect_op_uavtalk_udp(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree)
+{
+    guint offset = 0;
+    guint reported_length = tvb_reported_length(tvb);
+
+    col_set_str(pinfo->cinfo, COL_PROTOCOL, "UAVTALK");
+    /* Clear out stuff in the info column */
+    col_clear(pinfo->cinfo, COL_INFO);
+
+    while (offset < reported_length) {
+        guint available = tvb_length_remaining(tvb, offset);
+        const guint8 *data = tvb_get_ptr(tvb, offset, available);
+        gint32 length = uavtalk_frame_length(data, available);
+
+        if (length < 0) {
+            length = uavtalk_resync(data, available);
+            dissect_op_uavtalk_noise(tvb_new_subset(tvb, offset, length, length), pinfo, tree);
+        } else if (length == 0 || (guint)length > available) {
+            /* Truncated frame */
+            dissect_op_uavtalk_noise(tvb_new_subset_remaining(tvb, offset), pinfo, tree);
+            break;
         } else {
-            /* Render any remaining data as raw bytes */
-            call_dissector(data_handle, next_tvb, pinfo, tree);
+            dissect_op_uavtalk_frame(tvb_new_subset(tvb, offset, length, length), pinfo, tree);
         }
+        offset += length;
     }
 
-    return UAVTALK_HEADER_SIZE + UAVTALK_TRAILER_SIZE;
+    return offset;
 }
 
 void proto_register_op_uavtalk(void)
@@ -145,13 +240,17 @@ void proto_register_op_uavtalk(void)
             { "Sync Byte",           "uavtalk.sync",   FT_UINT8,
             BASE_HEX, NULL, 0x0, NULL, HFILL }
         },
+        { &hf_op_uavtalk_timestamped,
+            { "Timestamped",         "uavtalk.timestamped", FT_BOOLEAN,
+            8, NULL, UAVTALK_TIMESTAMPED, NULL, HFILL }
+        },
         { &hf_op_uavtalk_version,
             { "Version",             "uavtalk.ver",    FT_UINT8,
-            BASE_DEC, NULL, 0xf8, NULL, HFILL }
+            BASE_HEX, NULL, UAVTALK_TYPE_MASK, NULL, HFILL }
         },
         { &hf_op_uavtalk_type,
             { "Type",                "uavtalk.type",   FT_UINT8,
-            BASE_HEX, VALS(uavtalk_packet_types), 0x07, NULL, HFILL }
+            BASE_HEX, VALS(uavtalk_packet_types), UAVTALK_TYPE_MASK_PACKET, NULL, HFILL }
         },
         { &hf_op_uavtalk_len,
             { "Length",              "uavtalk.len",    FT_UINT16,
@@ -161,6 +260,14 @@ void proto_register_op_uavtalk(void)
             { "ObjID",               "uavtalk.objid",  FT_UINT32,
             BASE_HEX, NULL, 0x0, NULL, HFILL }
         },
+        { &hf_op_uavtalk_instid,
+            { "InstID",              "uavtalk.instid", FT_UINT16,
+            BASE_DEC, NULL, 0x0, NULL, HFILL }
+        },
+        { &hf_op_uavtalk_timestamp,
+            { "Timestamp",           "uavtalk.timestamp", FT_UINT16,
+            BASE_DEC, NULL, 0x0, NULL, HFILL }
+        },
         { &hf_op_uavtalk_crc8,
             { "Crc8",                "uavtalk.crc8",   FT_UINT8,
             BASE_HEX, NULL, 0x0, NULL, HFILL }
@@ -187,19 +294,52 @@ void proto_register_op_uavtalk(void)
 
     prefs_register_uint_preference(op_uavtalk_module, "udp.port", "UAVTALK UDP port",
                                    "UAVTALK port (default 9000)", 10, &global_op_uavtalk_port);
+    prefs_register_uint_preference(op_uavtalk_module, "tcp.port", "UAVTALK TCP port",
+                                   "UAVTALK port (default 9000)", 10, &global_op_uavtalk_tcp_port);
+    prefs_register_bool_preference(op_uavtalk_module, "desegment",
+                                   "Reassemble UAVTalk frames spanning multiple TCP segments",
+                                   "Whether the UAVTalk dissector should reassemble frames spanning multiple TCP segments. "
+                                   "To use this option, you must also enable \"Allow subdissectors to reassemble TCP streams\" in the TCP protocol settings.",
+                                   &op_uavtalk_desegment);
 }
 
 void proto_reg_handoff_op_uavtalk(void)
 {
+    static gboolean initialized = FALSE;
     static dissector_handle_t op_uavtalk_handle;
+    static dissector_handle_t op_uavtalk_tcp_handle;
+    static guint udp_port;
+    static guint tcp_port;
 
-    op_uavtalk_handle = new_create_dissector_handle(dissect_op_uavtalk, proto_op_uavtalk);
-    dissector_add_handle("udp.port", op_uavtalk_handle); /* for "decode as" */
+    if (!initialized) {
+        op_uavtalk_handle     = new_create_dissector_handle(dissect_op_uavtalk_udp, proto_op_uavtalk);
+        op_uavtalk_tcp_handle = create_dissector_handle(dissect_op_uavtalk_tcp, proto_op_uavtalk);
+        dissector_add_handle("udp.port", op_uavtalk_handle); /* for "decode as" */
+        dissector_add_handle("tcp.port", op_uavtalk_tcp_handle);
 
-    if (global_op_uavtalk_port != 0) {
-        dissector_add_uint("udp.port", global_op_uavtalk_port, op_uavtalk_handle);
+        /* Lookup the default dissector for raw data */
+        data_handle = find_dissector("data");
+
+        /* The generated UAVObject dissectors, when their plugin is installed */
+        uavobjects_handle = find_dissector("op-uavobjects");
+
+        initialized = TRUE;
+    } else {
+        /* The ports changed in the preferences */
+        if (udp_port != 0) {
+            dissector_delete_uint("udp.port", udp_port, op_uavtalk_handle);
+        }
+        if (tcp_port != 0) {
+            dissector_delete_uint("tcp.port", tcp_port, op_uavtalk_tcp_handle);
+        }
     }
 
-    /* Lookup the default dissector for raw data */
-    data_handle = find_dissector("data");
+    udp_port = global_op_uavtalk_port;
+    tcp_port = global_op_uavtalk_tcp_port;
+    if (udp_port != 0) {
+        dissector_add_uint("udp.port", udp_port, op_uavtalk_handle);
+    }
+    if (tcp_port != 0) {
+        dissector_add_uint("tcp.port", tcp_port, op_uavtalk_tcp_handle);
+    }
 }
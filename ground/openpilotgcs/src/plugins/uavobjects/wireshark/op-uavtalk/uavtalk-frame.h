@@ -0,0 +1,67 @@
+/* uavtalk-frame.h
+ * UAVTalk frame layout, shared by the UAVTalk and UAVObject dissectors
+ * Copyright 2014 The OpenPilot Team, http://www.openpilot.org
+ *
+ * Wireshark - Network traffic analyzer
+ * By Gerald Combs <gerald@wireshark.org>
+ * Copyright 1998 Gerald Combs
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA  02111-1307, USA.
+ */
+
+#ifndef UAVTALK_FRAME_H
+#define UAVTALK_FRAME_H
+
+#include <stdint.h>
+
+/* Same values as flight/uavtalk/inc/uavtalk_priv.h */
+#define UAVTALK_SYNC_VAL           0x3C
+#define UAVTALK_TYPE_MASK          0x78
+#define UAVTALK_TYPE_VER           0x20
+#define UAVTALK_TIMESTAMPED        0x80
+#define UAVTALK_TYPE_MASK_PACKET   0x07
+
+#define UAVTALK_TYPE_OBJ           0
+#define UAVTALK_TYPE_OBJ_REQ       1
+#define UAVTALK_TYPE_OBJ_ACK       2
+#define UAVTALK_TYPE_ACK           3
+#define UAVTALK_TYPE_NACK          4
+#define UAVTALK_TYPE_STREAM        5
+
+#define UAVTALK_MIN_HEADER_LENGTH  10
+#define UAVTALK_TIMESTAMP_LENGTH   2
+#define UAVTALK_CHECKSUM_LENGTH    1
+
+/* Sync, type and the length, what is needed to know the length of a frame */
+#define UAVTALK_FRAME_PROBE_LENGTH 4
+
+/* Well above the largest UAVObject, a longer length is a false sync */
+#define UAVTALK_MAX_FRAME_LENGTH   4096
+
+/*
+ * What the UAVTalk dissector hands to the UAVObject dissector in
+ * pinfo->private_data along with the payload
+ */
+struct uavtalk_object_ref {
+    uint32_t objid;
+    uint16_t instid;
+    uint8_t  has_data;
+};
+
+uint8_t uavtalk_crc8(uint8_t crc, const uint8_t *data, uint32_t length);
+int32_t uavtalk_frame_length(const uint8_t *data, uint32_t available);
+uint32_t uavtalk_resync(const uint8_t *data, uint32_t available);
+
+#endif /* UAVTALK_FRAME_H */
@@ -32,6 +32,7 @@
 #include <QWidget>
 #include <QLineEdit>
 #include <QToolButton>
+#include <QTimer>
 
 ConfigTaskWidget::ConfigTaskWidget(QWidget *parent) : QWidget(parent), m_currentBoardId(-1), m_isConnected(false), m_isWidgetUpdatesAllowed(true),
     m_saveButton(NULL), m_isDirty(false), m_outOfLimitsStyle("background-color: rgb(255, 0, 0);"), m_realtimeUpdateTimer(NULL)
@@ -45,6 +46,12 @@ ConfigTaskWidget::ConfigTaskWidget(QWidget *parent) : QWidget(parent), m_current
     connect(telMngr, SIGNAL(disconnected()), this, SIGNAL(autoPilotDisconnected()), Qt::UniqueConnection);
     UAVSettingsImportExportFactory *importexportplugin = m_pluginManager->getObject<UAVSettingsImportExportFactory>();
     connect(importexportplugin, SIGNAL(importAboutToBegin()), this, SLOT(invalidateObjects()));
+
+    // Object updates are queued and the widgets refreshed once per event loop pass
+    m_refreshTimer = new QTimer(this);
+    m_refreshTimer->setSingleShot(true);
+    m_refreshTimer->setInterval(0);
+    connect(m_refreshTimer, SIGNAL(timeout()), this, SLOT(refreshQueuedWidgetsValues()));
 }
 
 void ConfigTaskWidget::addWidget(QWidget *widget)
@@ -133,8 +140,8 @@ void ConfigTaskWidget::doAddWidgetBinding(QString objectName, QString fieldName,
         object = getObject(QString(objectName), instID);
         Q_ASSERT(object);
         m_updatedObjects.insert(object, true);
-        connect(object, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(objectUpdated(UAVObject *)));
-        connect(object, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(refreshWidgetsValues(UAVObject *)), Qt::UniqueConnection);
+        connect(object, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(objectUpdated(UAVObject *)), Qt::UniqueConnection);
+        connect(object, SIGNAL(objectUpdated(UAVObject *)), this, SLOT(queueRefreshWidgetsValues(UAVObject *)), Qt::UniqueConnection);
     }
 
     if (!fieldName.isEmpty() && object) {
@@ -181,6 +188,7 @@ void ConfigTaskWidget::setWidgetBindingObjectEnabled(QString objectName, bool en
 
     foreach(WidgetBinding * binding, m_widgetBindingsPerObject.values(object)) {
         binding->setIsEnabled(enabled);
+        binding->setAppliedValue(QVariant());
         if (enabled) {
             if (binding->value().isValid() && !binding->value().isNull()) {
                 setWidgetFromVariant(binding->widget(), binding->value(), binding);
@@ -241,6 +249,7 @@ void ConfigTaskWidget::onAutopilotDisconnect()
     foreach(WidgetBinding * binding, m_widgetBindingsPerObject) {
         QComboBox *cb;
 
+        binding->setAppliedValue(QVariant());
         if (binding->widget() && (cb = qobject_cast<QComboBox *>(binding->widget()))) {
             cb->clear();
         }
@@ -297,7 +306,10 @@ void ConfigTaskWidget::refreshWidgetsValues(UAVObject *obj)
     foreach(WidgetBinding * binding, bindings) {
         if (binding->field() != NULL && binding->widget() != NULL) {
             if (binding->isEnabled()) {
-                setWidgetFromField(binding->widget(), binding->field(), binding);
+                // An object update only touches the widgets whose field value changed
+                if (obj == NULL || !binding->isApplied(binding->field()->getValue(binding->index()))) {
+                    setWidgetFromField(binding->widget(), binding->field(), binding);
+                }
             } else {
                 binding->updateValueFromObjectField();
             }
@@ -420,6 +432,8 @@ void ConfigTaskWidget::widgetsContentsChanged()
                 }
             }
             binding->setValue(value);
+            // The widget no longer shows the field, the next refresh has to set it again
+            binding->setAppliedValue(QVariant());
 
             if (binding->widget() != emitter) {
                 disconnectWidgetUpdatesToSlot(binding->widget(), SLOT(widgetsContentsChanged()));
@@ -473,10 +487,14 @@ bool ConfigTaskWidget::isDirty()
 
 void ConfigTaskWidget::disableObjectUpdates()
 {
+    // Updates received before this point are still shown
+    m_refreshTimer->stop();
+    refreshQueuedWidgetsValues();
+
     m_isWidgetUpdatesAllowed = false;
     foreach(WidgetBinding * binding, m_widgetBindingsPerWidget) {
         if (binding->object()) {
-            disconnect(binding->object(), SIGNAL(objectUpdated(UAVObject *)), this, SLOT(refreshWidgetsValues(UAVObject *)));
+            disconnect(binding->object(), SIGNAL(objectUpdated(UAVObject *)), this, SLOT(queueRefreshWidgetsValues(UAVObject *)));
         }
     }
 }
@@ -486,7 +504,7 @@ void ConfigTaskWidget::enableObjectUpdates()
     m_isWidgetUpdatesAllowed = true;
     foreach(WidgetBinding * binding, m_widgetBindingsPerWidget) {
         if (binding->object()) {
-            connect(binding->object(), SIGNAL(objectUpdated(UAVObject *)), this, SLOT(refreshWidgetsValues(UAVObject *)), Qt::UniqueConnection);
+            connect(binding->object(), SIGNAL(objectUpdated(UAVObject *)), this, SLOT(queueRefreshWidgetsValues(UAVObject *)), Qt::UniqueConnection);
         }
     }
 }
@@ -496,6 +514,26 @@ void ConfigTaskWidget::objectUpdated(UAVObject *object)
     m_updatedObjects[object] = true;
 }
 
+void ConfigTaskWidget::queueRefreshWidgetsValues(UAVObject *object)
+{
+    if (!m_refreshQueue.contains(object)) {
+        m_refreshQueue.append(object);
+    }
+    if (!m_refreshTimer->isActive()) {
+        m_refreshTimer->start();
+    }
+}
+
+void ConfigTaskWidget::refreshQueuedWidgetsValues()
+{
+    QList<UAVObject *> objects = m_refreshQueue;
+
+    m_refreshQueue.clear();
+    foreach(UAVObject * object, objects) {
+        refreshWidgetsValues(object);
+    }
+}
+
 bool ConfigTaskWidget::allObjectsUpdated()
 {
     bool result = true;
@@ -944,6 +982,7 @@ bool ConfigTaskWidget::setWidgetFromField(QWidget *widget, UAVObjectField *field
     checkWidgetsLimits(widget, field, binding->index(), binding->isLimited(), value, binding->scale());
     bool result    = setWidgetFromVariant(widget, value, binding);
     if (result) {
+        binding->setAppliedValue(value);
         return true;
     } else {
         qDebug() << __FUNCTION__ << "widget to uavobject relation not implemented" << widget->metaObject()->className();
@@ -1100,9 +1139,15 @@ bool ConfigTaskWidget::eventFilter(QObject *obj, QEvent *evt)
 WidgetBinding::WidgetBinding(QWidget *widget, UAVObject *object, UAVObjectField *field, int index, double scale, bool isLimited) :
     ShadowWidgetBinding(widget, scale, isLimited), m_isEnabled(true)
 {
-    m_object = object;
-    m_field  = field;
-    m_index  = index;
+    m_object    = object;
+    m_field     = field;
+    m_index     = index;
+    // Looked up on every widget update, so taken from the field once
+    m_units     = field ? field->getUnits() : QString();
+    m_isInteger = field ? field->isInteger() : false;
+
+    m_appliedScale     = scale;
+    m_appliedIsLimited = isLimited;
 }
 
 WidgetBinding::~WidgetBinding()
@@ -1110,10 +1155,7 @@ WidgetBinding::~WidgetBinding()
 
 QString WidgetBinding::units() const
 {
-    if (m_field) {
-        return m_field->getUnits();
-    }
-    return QString();
+    return m_units;
 }
 
 QString WidgetBinding::type() const
@@ -1126,10 +1168,7 @@ QString WidgetBinding::type() const
 
 bool WidgetBinding::isInteger() const
 {
-    if (m_field) {
-        return m_field->isInteger();
-    }
-    return false;
+    return m_isInteger;
 }
 
 UAVObject *WidgetBinding::object() const
@@ -1163,6 +1202,8 @@ void WidgetBinding::addShadow(QWidget *widget, double scale, bool isLimited)
         m_isLimited = isLimited;
         m_scale     = scale;
         m_widget    = widget;
+        // The new widget has not been set from the field yet
+        m_appliedValue = QVariant();
     } else {
         shadow = new ShadowWidgetBinding(widget, scale, isLimited);
     }
@@ -1204,6 +1245,24 @@ void WidgetBinding::setValue(const QVariant &value)
      */
 }
 
+QVariant WidgetBinding::appliedValue() const
+{
+    return m_appliedValue;
+}
+
+void WidgetBinding::setAppliedValue(const QVariant &value)
+{
+    m_appliedValue     = value;
+    m_appliedScale     = m_scale;
+    m_appliedIsLimited = m_isLimited;
+}
+
+bool WidgetBinding::isApplied(const QVariant &value) const
+{
+    return m_appliedValue.isValid() && value == m_appliedValue &&
+           m_scale == m_appliedScale && m_isLimited == m_appliedIsLimited;
+}
+
 void WidgetBinding::updateObjectFieldFromValue()
 {
     if (m_value.isValid()) {
@@ -85,6 +85,10 @@ public:
     QVariant value() const;
     void setValue(const QVariant &value);
 
+    QVariant appliedValue() const;
+    void setAppliedValue(const QVariant &value);
+    bool isApplied(const QVariant &value) const;
+
     void updateObjectFieldFromValue();
     void updateValueFromObjectField();
 
@@ -95,6 +99,12 @@ private:
     bool m_isEnabled;
     QList<ShadowWidgetBinding *> m_shadows;
     QVariant m_value;
+    // Field value, scale and limits the widget was last set from
+    QVariant m_appliedValue;
+    double m_appliedScale;
+    bool m_appliedIsLimited;
+    QString m_units;
+    bool m_isInteger;
 };
 
 class UAVOBJECTWIDGETUTILS_EXPORT ConfigTaskWidget : public QWidget {
@@ -178,6 +188,8 @@ signals:
 
 private slots:
     void objectUpdated(UAVObject *object);
+    void queueRefreshWidgetsValues(UAVObject *object);
+    void refreshQueuedWidgetsValues();
     void defaultButtonClicked();
     void reloadButtonClicked();
 
@@ -222,6 +234,8 @@ private:
     bool m_isDirty;
     QString m_outOfLimitsStyle;
     QTimer *m_realtimeUpdateTimer;
+    QTimer *m_refreshTimer;
+    QList<UAVObject *> m_refreshQueue;
 
     bool setWidgetFromField(QWidget *widget, UAVObjectField *field, WidgetBinding *binding);
 
@@ -0,0 +1,13 @@
+CONFIG += qtestlib
+TEMPLATE = app
+CONFIG -= app_bundle
+
+QT += widgets
+
+include(../../../../openpilotgcs.pri)
+
+# Links the built plugin and the plugins it depends on
+LIBS += -L$$GCS_PLUGIN_PATH/OpenPilot
+include(../uavobjectwidgetutils.pri)
+
+SOURCES += tst_configtaskwidget.cpp
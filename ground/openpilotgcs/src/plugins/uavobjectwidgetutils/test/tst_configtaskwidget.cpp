@@ -0,0 +1,261 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_configtaskwidget.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup UAVObjectWidgetUtils Plugin
+ * @{
+ * @brief Widget refresh of a page with hundreds of bindings
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "configtaskwidget.h"
+#include "uavdataobject.h"
+#include "uavobjectfield.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QObject>
+#include <QDoubleSpinBox>
+
+// Elements of the synthetic object, one bound spin box each
+#define BINDINGS 400
+
+/*
+ * A settings object with one float field of BINDINGS elements, built the
+ * same way as the generated objects.
+ */
+class SyntheticObject : public UAVDataObject {
+public:
+    SyntheticObject() : UAVDataObject(0x5E7B1D00, true, true, "SyntheticObject")
+    {
+        QList<UAVObjectField *> fields;
+        fields.append(new UAVObjectField("Values", "", "", UAVObjectField::FLOAT32, BINDINGS, QStringList()));
+        memset(m_data, 0, sizeof(m_data));
+        initializeFields(fields, (quint8 *)m_data, sizeof(m_data));
+    }
+
+    Metadata getDefaultMetadata()
+    {
+        Metadata metadata;
+
+        memset(&metadata, 0, sizeof(metadata));
+        return metadata;
+    }
+
+    UAVDataObject *clone(quint32 instID)
+    {
+        Q_UNUSED(instID);
+        return new SyntheticObject();
+    }
+
+    UAVDataObject *dirtyClone()
+    {
+        return new SyntheticObject();
+    }
+
+private:
+    float m_data[BINDINGS];
+};
+
+/*
+ * A config page binding a spin box to every element, with the object served
+ * directly instead of through the object manager.
+ */
+class SyntheticPage : public ConfigTaskWidget {
+public:
+    SyntheticPage(UAVObject *object) : ConfigTaskWidget(), m_object(object), m_refreshCount(0)
+    {
+        UAVObjectField *field = object->getField("Values");
+
+        for (int i = 0; i < BINDINGS; i++) {
+            QDoubleSpinBox *spinBox = new QDoubleSpinBox(this);
+            spinBox->setRange(-1e6, 1e6);
+            m_spinBoxes.append(spinBox);
+            addWidgetBinding(object, field, spinBox, i);
+        }
+        populateWidgets();
+    }
+
+    void refresh(UAVObject *object)
+    {
+        refreshWidgetsValues(object);
+    }
+
+    QList<QDoubleSpinBox *> m_spinBoxes;
+    UAVObject *m_object;
+    int m_refreshCount;
+
+protected:
+    UAVObject *getObject(const QString name, quint32 instId)
+    {
+        Q_UNUSED(instId);
+        return name == m_object->getName() ? m_object : NULL;
+    }
+
+    void refreshWidgetsValues(UAVObject *object)
+    {
+        m_refreshCount++;
+        ConfigTaskWidget::refreshWidgetsValues(object);
+    }
+};
+
+class tst_ConfigTaskWidget : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+    void init();
+    void cleanup();
+
+    void changedFieldReachesWidget();
+    void editedWidgetIsRefreshed();
+    void updatesAreCoalesced();
+    void fullRefreshSetsEveryWidget();
+
+    void benchmarkRefreshUnchanged();
+    void benchmarkRefreshOneChanged();
+    void benchmarkRefreshAllChanged();
+    void benchmarkUpdateBurst();
+
+private:
+    ExtensionSystem::PluginManager *m_pluginManager;
+    SyntheticObject *m_object;
+    UAVObjectField *m_field;
+    SyntheticPage *m_page;
+};
+
+void tst_ConfigTaskWidget::initTestCase()
+{
+    // ConfigTaskWidget looks up the telemetry manager through the plugin manager
+    m_pluginManager = new ExtensionSystem::PluginManager();
+}
+
+void tst_ConfigTaskWidget::cleanupTestCase()
+{
+    delete m_pluginManager;
+}
+
+void tst_ConfigTaskWidget::init()
+{
+    m_object = new SyntheticObject();
+    m_field  = m_object->getField("Values");
+    m_page   = new SyntheticPage(m_object);
+    QCoreApplication::processEvents();
+    m_page->m_refreshCount = 0;
+}
+
+void tst_ConfigTaskWidget::cleanup()
+{
+    delete m_page;
+    delete m_object;
+}
+
+void tst_ConfigTaskWidget::changedFieldReachesWidget()
+{
+    m_field->setValue(12.5, 7);
+    m_object->updated();
+    QCoreApplication::processEvents();
+
+    QCOMPARE(m_page->m_spinBoxes.at(7)->value(), 12.5);
+    QCOMPARE(m_page->m_spinBoxes.at(8)->value(), 0.0);
+}
+
+void tst_ConfigTaskWidget::editedWidgetIsRefreshed()
+{
+    // An update puts the object value back even when the field did not change
+    m_page->m_spinBoxes.at(3)->setValue(42);
+    m_object->updated();
+    QCoreApplication::processEvents();
+
+    QCOMPARE(m_page->m_spinBoxes.at(3)->value(), 0.0);
+}
+
+void tst_ConfigTaskWidget::updatesAreCoalesced()
+{
+    for (int i = 0; i < 10; i++) {
+        m_field->setValue(i, 0);
+        m_object->updated();
+    }
+    QCOMPARE(m_page->m_refreshCount, 0);
+
+    QCoreApplication::processEvents();
+    QCOMPARE(m_page->m_refreshCount, 1);
+    QCOMPARE(m_page->m_spinBoxes.at(0)->value(), 9.0);
+}
+
+void tst_ConfigTaskWidget::fullRefreshSetsEveryWidget()
+{
+    for (int i = 0; i < BINDINGS; i++) {
+        m_page->m_spinBoxes.at(i)->blockSignals(true);
+        m_page->m_spinBoxes.at(i)->setValue(1);
+        m_page->m_spinBoxes.at(i)->blockSignals(false);
+    }
+    m_page->refresh(NULL);
+
+    for (int i = 0; i < BINDINGS; i++) {
+        QCOMPARE(m_page->m_spinBoxes.at(i)->value(), 0.0);
+    }
+}
+
+void tst_ConfigTaskWidget::benchmarkRefreshUnchanged()
+{
+    QBENCHMARK {
+        m_page->refresh(m_object);
+    }
+}
+
+void tst_ConfigTaskWidget::benchmarkRefreshOneChanged()
+{
+    int i = 0;
+
+    QBENCHMARK {
+        i++;
+        m_field->setValue(i, i % BINDINGS);
+        m_page->refresh(m_object);
+    }
+}
+
+void tst_ConfigTaskWidget::benchmarkRefreshAllChanged()
+{
+    int i = 0;
+
+    QBENCHMARK {
+        i++;
+        for (int j = 0; j < BINDINGS; j++) {
+            m_field->setValue(i, j);
+        }
+        m_page->refresh(m_object);
+    }
+}
+
+void tst_ConfigTaskWidget::benchmarkUpdateBurst()
+{
+    // A telemetry burst of updates handled in one event loop pass
+    QBENCHMARK {
+        for (int i = 0; i < 10; i++) {
+            m_object->updated();
+        }
+        QCoreApplication::processEvents();
+    }
+}
+
+QTEST_MAIN(tst_ConfigTaskWidget)
+
+#include "tst_configtaskwidget.moc"
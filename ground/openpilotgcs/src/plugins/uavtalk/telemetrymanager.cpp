@@ -96,6 +96,10 @@ void TelemetryManager::onStart()
         connect(m_telemetryDevice, SIGNAL(readyRead()), m_uavTalk, SLOT(processInputStream()));
     }
 
+    // Stream payloads go straight to whoever requested them
+    connect(m_uavTalk, SIGNAL(streamReceived(quint32, quint16, QByteArray)),
+            this, SIGNAL(streamReceived(quint32, quint16, QByteArray)));
+
     m_telemetry = new Telemetry(m_uavTalk, m_uavobjectManager);
     m_telemetryMonitor = new TelemetryMonitor(m_uavobjectManager, m_telemetry);
 
@@ -62,6 +62,7 @@ signals:
     void disconnecting();
     void disconnected();
     void telemetryUpdated(double txRate, double rxRate);
+    void streamReceived(quint32 objId, quint16 instId, QByteArray data);
     void myStart();
     void myStop();
 
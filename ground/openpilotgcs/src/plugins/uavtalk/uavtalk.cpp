@@ -317,7 +317,8 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
         rxCount     = 0;
 
 
-        if (packetSize < HEADER_LENGTH || packetSize > HEADER_LENGTH + MAX_PAYLOAD_LENGTH) {
+        if (packetSize < HEADER_LENGTH ||
+            packetSize > HEADER_LENGTH + (rxType == TYPE_STREAM ? MAX_STREAM_PAYLOAD_LENGTH : MAX_PAYLOAD_LENGTH)) {
             // incorrect packet size
             qWarning() << "UAVTalk - error : incorrect packet size";
             stats.rxErrors++;
@@ -362,7 +363,7 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
         // Search for object, if not found reset state machine
         {
             UAVObject *rxObj = objMngr->getObject(rxObjId);
-            if (rxObj == NULL && rxType != TYPE_OBJ_REQ) {
+            if (rxObj == NULL && rxType != TYPE_OBJ_REQ && rxType != TYPE_STREAM) {
                 qWarning() << "UAVTalk - error : unknown object" << rxObjId;
                 stats.rxErrors++;
                 rxState = STATE_ERROR;
@@ -372,6 +373,8 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
             // Determine data length
             if (rxType == TYPE_OBJ_REQ || rxType == TYPE_ACK || rxType == TYPE_NACK) {
                 rxLength = 0;
+            } else if (rxType == TYPE_STREAM) {
+                rxLength = packetSize - rxPacketLength;
             } else {
                 if (rxObj) {
                     rxLength = rxObj->getNumBytes();
@@ -381,7 +384,7 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
             }
 
             // Check length and determine next state
-            if (rxLength >= MAX_PAYLOAD_LENGTH) {
+            if (rxType == TYPE_STREAM ? rxLength > MAX_STREAM_PAYLOAD_LENGTH : rxLength >= MAX_PAYLOAD_LENGTH) {
                 // packet error - exceeded payload max length
                 qWarning() << "UAVTalk - error : exceeded payload max length" << rxObjId;
                 stats.rxErrors++;
@@ -474,8 +477,6 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
  */
 bool UAVTalk::receiveObject(quint8 type, quint32 objId, quint16 instId, quint8 *data, qint32 length)
 {
-    Q_UNUSED(length);
-
     UAVObject *obj    = NULL;
     bool error        = false;
     bool allInstances = (instId == ALL_INSTANCES);
@@ -567,6 +568,14 @@ bool UAVTalk::receiveObject(quint8 type, quint32 objId, quint16 instId, quint8 *
         }
         break;
 
+    case TYPE_STREAM:
+        // Raw payload, handed over as is to whoever asked for the stream
+#ifdef VERBOSE_UAVTALK
+        VERBOSE_FILTER(objId) qDebug() << "UAVTalk - received stream" << objId << instId << length;
+#endif
+        emit streamReceived(objId, instId, QByteArray((const char *)data, length));
+        break;
+
     case TYPE_NACK:
         // All instances, not allowed for NACK messages
         if (!allInstances) {
@@ -896,6 +905,11 @@ const char *UAVTalk::typeToString(quint8 type)
     case TYPE_NACK:
         return "nack";
 
+        break;
+
+    case TYPE_STREAM:
+        return "stream";
+
         break;
     }
     return "<error>";
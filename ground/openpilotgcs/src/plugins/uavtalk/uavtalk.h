@@ -72,6 +72,7 @@ public:
 
 signals:
     void transactionCompleted(UAVObject *obj, bool success);
+    void streamReceived(quint32 objId, quint16 instId, QByteArray data);
 
 private slots:
     void processInputStream();
@@ -93,12 +94,16 @@ private:
     static const int TYPE_OBJ_ACK  = (TYPE_VER | 0x02);
     static const int TYPE_ACK      = (TYPE_VER | 0x03);
     static const int TYPE_NACK     = (TYPE_VER | 0x04);
+    static const int TYPE_STREAM   = (TYPE_VER | 0x05);
 
     // header : sync(1), type (1), size(2), object ID(4), instance ID(2)
     static const int HEADER_LENGTH = 10;
 
     static const int MAX_PAYLOAD_LENGTH = 256;
 
+    // stream messages carry a raw payload, not an object
+    static const int MAX_STREAM_PAYLOAD_LENGTH = 1024;
+
     static const int CHECKSUM_LENGTH    = 1;
 
     static const int MAX_PACKET_LENGTH  = (HEADER_LENGTH + MAX_PAYLOAD_LENGTH + CHECKSUM_LENGTH);
@@ -121,7 +126,7 @@ private:
 
     QMap<quint32, QMap<quint32, Transaction *> *> transMap;
 
-    quint8 rxBuffer[MAX_PACKET_LENGTH];
+    quint8 rxBuffer[HEADER_LENGTH + MAX_STREAM_PAYLOAD_LENGTH + CHECKSUM_LENGTH];
 
     quint8 txBuffer[MAX_PACKET_LENGTH];
 
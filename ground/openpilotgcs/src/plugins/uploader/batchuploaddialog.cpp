@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ *
+ * @file       batchuploaddialog.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup Uploader Uploader Plugin
+ * @{
+ * @brief Progress of a batch upload, one row per board
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "batchuploaddialog.h"
+#include "dfubatch.h"
+
+#include <QGridLayout>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QProgressBar>
+#include <QPushButton>
+#include <QVBoxLayout>
+
+BatchUploadDialog::BatchUploadDialog(DFUBatch *batch, QWidget *parent) :
+    QDialog(parent), m_batch(batch)
+{
+    setWindowTitle(tr("Batch Upload"));
+
+    QGridLayout *grid = new QGridLayout;
+    for (int i = 0; i < m_batch->count(); i++) {
+        QProgressBar *bar = new QProgressBar;
+        bar->setRange(0, 100);
+        bar->setValue(0);
+        QLabel *status    = new QLabel(tr("Waiting"));
+        status->setMinimumWidth(250);
+
+        grid->addWidget(new QLabel(m_batch->boardName(i)), i, 0);
+        grid->addWidget(bar, i, 1);
+        grid->addWidget(status, i, 2);
+        m_progress.append(bar);
+        m_status.append(status);
+    }
+
+    m_summary     = new QLabel(tr("%1 board(s) found").arg(m_batch->count()));
+    m_startButton = new QPushButton(tr("Start"));
+    m_closeButton = new QPushButton(tr("Close"));
+
+    QHBoxLayout *buttons = new QHBoxLayout;
+    buttons->addWidget(m_summary);
+    buttons->addStretch();
+    buttons->addWidget(m_startButton);
+    buttons->addWidget(m_closeButton);
+
+    QVBoxLayout *layout = new QVBoxLayout(this);
+    layout->addLayout(grid);
+    layout->addLayout(buttons);
+
+    connect(m_startButton, SIGNAL(clicked()), this, SLOT(start()));
+    connect(m_closeButton, SIGNAL(clicked()), this, SLOT(accept()));
+    connect(m_batch, SIGNAL(boardProgress(int, int)), this, SLOT(boardProgress(int, int)));
+    connect(m_batch, SIGNAL(boardStatus(int, QString)), this, SLOT(boardStatus(int, QString)));
+    connect(m_batch, SIGNAL(boardFinished(int, bool)), this, SLOT(boardFinished(int, bool)));
+    connect(m_batch, SIGNAL(finished(int, int)), this, SLOT(finished(int, int)));
+}
+
+void BatchUploadDialog::start()
+{
+    if (!m_batch->start()) {
+        return;
+    }
+    m_startButton->setEnabled(false);
+    m_closeButton->setEnabled(false);
+    m_summary->setText(tr("Uploading..."));
+}
+
+void BatchUploadDialog::reject()
+{
+    // The workers hold the boards until they are done
+    if (m_batch->isRunning()) {
+        return;
+    }
+    QDialog::reject();
+}
+
+void BatchUploadDialog::boardProgress(int board, int percent)
+{
+    m_progress[board]->setValue(percent);
+}
+
+void BatchUploadDialog::boardStatus(int board, QString status)
+{
+    m_status[board]->setText(status);
+}
+
+void BatchUploadDialog::boardFinished(int board, bool success)
+{
+    m_status[board]->setStyleSheet(success ? "QLabel { color: green; }" : "QLabel { color: red; }");
+}
+
+void BatchUploadDialog::finished(int succeeded, int failed)
+{
+    m_summary->setText(tr("%1 board(s) flashed, %2 failed").arg(succeeded).arg(failed));
+    m_closeButton->setEnabled(true);
+}
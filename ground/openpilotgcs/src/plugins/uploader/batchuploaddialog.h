@@ -0,0 +1,64 @@
+/**
+ ******************************************************************************
+ *
+ * @file       batchuploaddialog.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup Uploader Uploader Plugin
+ * @{
+ * @brief Progress of a batch upload, one row per board
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef BATCHUPLOADDIALOG_H
+#define BATCHUPLOADDIALOG_H
+
+#include <QDialog>
+#include <QList>
+
+class QLabel;
+class QProgressBar;
+class QPushButton;
+class DFUBatch;
+
+class BatchUploadDialog : public QDialog {
+    Q_OBJECT
+
+public:
+    BatchUploadDialog(DFUBatch *batch, QWidget *parent = 0);
+
+public slots:
+    void start();
+    void reject();
+
+private slots:
+    void boardProgress(int board, int percent);
+    void boardStatus(int board, QString status);
+    void boardFinished(int board, bool success);
+    void finished(int succeeded, int failed);
+
+private:
+    DFUBatch *m_batch;
+    QList<QProgressBar *> m_progress;
+    QList<QLabel *> m_status;
+    QLabel *m_summary;
+    QPushButton *m_startButton;
+    QPushButton *m_closeButton;
+};
+
+#endif // BATCHUPLOADDIALOG_H
@@ -359,13 +359,7 @@ void DeviceWidget::uploadFirmware()
         descriptionArray = desc;
         // Now do sanity checking:
         // - Check whether board type matches firmware:
-        int board = m_dfu->devices[deviceID].ID;
-        int firmwareBoard = ((desc.at(12) & 0xff) << 8) + (desc.at(13) & 0xff);
-        if ((board == 0x401 && firmwareBoard == 0x402) ||
-            (board == 0x901 && firmwareBoard == 0x902) || // L3GD20 revo supports Revolution firmware
-            (board == 0x902 && firmwareBoard == 0x903)) { // RevoMini1 supporetd by RevoMini2 firmware
-            // These firmwares are designed to be backwards compatible
-        } else if (firmwareBoard != board) {
+        if (!DFUObject::FirmwareMatchesBoard(m_dfu->devices[deviceID].ID, desc)) {
             status("Error: firmware does not match board", STATUSICON_FAIL);
             updateButtons(true);
             return;
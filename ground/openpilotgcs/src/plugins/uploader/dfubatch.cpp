@@ -0,0 +1,242 @@
+/**
+ ******************************************************************************
+ *
+ * @file       dfubatch.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup Uploader Uploader Plugin
+ * @{
+ * @brief Flashes the same firmware into several boards at once
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "dfubatch.h"
+#include <QFile>
+#include <QCryptographicHash>
+
+using namespace OP_DFU;
+
+DFUBatchWorker::DFUBatchWorker(int board, const QString &name, DFUObject *dfu, QObject *parent) :
+    QThread(parent), m_board(board), m_name(name), m_dfu(dfu), m_success(false)
+{
+    // The DFUObject belongs to the thread that made it but is only used from
+    // run(), and emits from there. Its signals are passed on right away, the
+    // batch gets them queued, in its own thread.
+    connect(m_dfu, SIGNAL(progressUpdated(int)), this, SLOT(dfuProgress(int)), Qt::DirectConnection);
+    connect(m_dfu, SIGNAL(operationProgress(QString)), this, SLOT(dfuStatus(QString)), Qt::DirectConnection);
+}
+
+DFUBatchWorker::~DFUBatchWorker()
+{
+    wait();
+    delete m_dfu;
+}
+
+void DFUBatchWorker::setImage(const QByteArray &firmware, const QByteArray &description)
+{
+    // Implicitly shared, all the workers read the same copy
+    m_firmware    = firmware;
+    m_description = description;
+}
+
+void DFUBatchWorker::dfuProgress(int percent)
+{
+    emit boardProgress(m_board, percent);
+}
+
+void DFUBatchWorker::dfuStatus(QString status)
+{
+    emit boardStatus(m_board, status);
+}
+
+void DFUBatchWorker::run()
+{
+    QString status;
+
+    m_success = flash(status);
+    emit boardDone(m_board, m_success, status);
+}
+
+/**
+   Same steps as the rescue procedure and the device widget, except
+   that the upload is checked with a CRC readback instead of a full
+   download, and that nothing waits on the user.
+ */
+bool DFUBatchWorker::flash(QString &status)
+{
+    if (!m_dfu->ready()) {
+        status = tr("Could not open the board");
+        return false;
+    }
+
+    emit boardStatus(m_board, tr("Entering DFU"));
+    m_dfu->AbortOperation();
+    if (!m_dfu->enterDFU(0)) {
+        status = tr("Could not enter DFU mode");
+        return false;
+    }
+    if (!m_dfu->findDevices() || (m_dfu->numberOfDevices < 1)) {
+        status = tr("Could not detect the board");
+        return false;
+    }
+
+    const device &dev = m_dfu->devices[0];
+    if (!dev.Writable) {
+        status = tr("Device not writable!");
+        return false;
+    }
+    if (dev.SizeOfCode < (quint32)m_firmware.length()) {
+        status = tr("Firmware too big for the board");
+        return false;
+    }
+    if (!m_description.isEmpty() && !DFUObject::FirmwareMatchesBoard(dev.ID, m_description)) {
+        status = tr("Firmware does not match the board");
+        return false;
+    }
+
+    OP_DFU::Status ret = m_dfu->UploadImage(m_firmware, 0);
+    if (ret != OP_DFU::Last_operation_Success) {
+        status = tr("Upload failed with code: ") + m_dfu->StatusToString(ret);
+        return false;
+    }
+
+    if (!m_description.isEmpty()) {
+        emit boardStatus(m_board, tr("Updating description"));
+        ret = m_dfu->UploadDescription(m_description);
+        if (ret != OP_DFU::Last_operation_Success) {
+            status = tr("Description upload failed with code: ") + m_dfu->StatusToString(ret);
+            return false;
+        }
+    }
+
+    status = tr("Upload successful");
+    return true;
+}
+
+
+DFUBatch::DFUBatch(bool debug, QObject *parent) :
+    QObject(parent), m_debug(debug), m_running(0), m_succeeded(0)
+{}
+
+DFUBatch::~DFUBatch()
+{
+    qDeleteAll(m_workers);
+}
+
+/**
+   Reads the firmware file, the only time it is read for the whole batch
+ */
+bool DFUBatch::loadFirmware(const QString &filename)
+{
+    QFile file(filename);
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        m_error = tr("Can't open file");
+        return false;
+    }
+    return setFirmware(file.readAll());
+}
+
+/**
+   Checks a firmware image, packaged with its OpFw description or not
+ */
+bool DFUBatch::setFirmware(const QByteArray &firmware)
+{
+    if (firmware.isEmpty()) {
+        m_error = tr("Empty firmware");
+        return false;
+    }
+
+    QByteArray desc = firmware.right(100);
+    if (desc.startsWith("OpFw")) {
+        QByteArray firmwareHash = desc.mid(40, 20);
+        QByteArray fileHash     = QCryptographicHash::hash(firmware.left(firmware.length() - 100), QCryptographicHash::Sha1);
+        if (firmwareHash != fileHash) {
+            m_error = tr("Error: firmware file corrupt");
+            return false;
+        }
+        m_description = desc;
+    } else {
+        m_description.clear();
+    }
+    m_firmware = firmware;
+    return true;
+}
+
+int DFUBatch::addBootloaders()
+{
+    QList<USBPortInfo> ports = USBMonitor::instance()->availableDevices(0x20a0, -1, -1, USBMonitor::Bootloader);
+
+    foreach(USBPortInfo port, ports) {
+        addBoard(QString("%1 %2").arg(port.product).arg(port.serialNumber), new DFUObject(m_debug, port));
+    }
+    return ports.length();
+}
+
+int DFUBatch::addBoard(const QString &name, DFUObject *dfu)
+{
+    int board = m_workers.length();
+    DFUBatchWorker *worker = new DFUBatchWorker(board, name, dfu);
+
+    connect(worker, SIGNAL(boardProgress(int, int)), this, SIGNAL(boardProgress(int, int)));
+    connect(worker, SIGNAL(boardStatus(int, QString)), this, SIGNAL(boardStatus(int, QString)));
+    connect(worker, SIGNAL(boardDone(int, bool, QString)), this, SLOT(workerDone(int, bool, QString)));
+    m_workers.append(worker);
+    return board;
+}
+
+QString DFUBatch::boardName(int board) const
+{
+    return m_workers[board]->name();
+}
+
+bool DFUBatch::boardSucceeded(int board) const
+{
+    return m_workers[board]->succeeded();
+}
+
+/**
+   Starts all the boards at once, finished is emitted after the last one
+ */
+bool DFUBatch::start()
+{
+    if (isRunning() || m_firmware.isEmpty() || m_workers.isEmpty()) {
+        return false;
+    }
+
+    m_running   = m_workers.length();
+    m_succeeded = 0;
+    foreach(DFUBatchWorker * worker, m_workers) {
+        worker->setImage(m_firmware, m_description);
+        worker->start();
+    }
+    return true;
+}
+
+void DFUBatch::workerDone(int board, bool success, QString status)
+{
+    if (success) {
+        m_succeeded++;
+    }
+    emit boardStatus(board, status);
+    emit boardFinished(board, success);
+
+    if (--m_running == 0) {
+        emit finished(m_succeeded, m_workers.length() - m_succeeded);
+    }
+}
@@ -0,0 +1,135 @@
+/**
+ ******************************************************************************
+ *
+ * @file       dfubatch.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup Uploader Uploader Plugin
+ * @{
+ * @brief Flashes the same firmware into several boards at once
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef DFUBATCH_H
+#define DFUBATCH_H
+
+#include <QObject>
+#include <QThread>
+#include <QByteArray>
+#include <QString>
+#include <QList>
+#include "op_dfu.h"
+
+// Flashes one board: enter DFU, erase, upload, CRC readback and description,
+// all from its own thread. Owns the DFUObject of the board, which nothing
+// else may use until the worker is done.
+class DFUBatchWorker : public QThread {
+    Q_OBJECT
+
+public:
+    DFUBatchWorker(int board, const QString &name, OP_DFU::DFUObject *dfu, QObject *parent = 0);
+    ~DFUBatchWorker();
+
+    void setImage(const QByteArray &firmware, const QByteArray &description);
+    QString name() const
+    {
+        return m_name;
+    }
+    bool succeeded() const
+    {
+        return m_success;
+    }
+
+signals:
+    void boardProgress(int board, int percent);
+    void boardStatus(int board, QString status);
+    void boardDone(int board, bool success, QString status);
+
+protected:
+    void run();
+
+private slots:
+    void dfuProgress(int percent);
+    void dfuStatus(QString status);
+
+private:
+    int m_board;
+    QString m_name;
+    OP_DFU::DFUObject *m_dfu;
+    QByteArray m_firmware;
+    QByteArray m_description;
+    bool m_success;
+
+    bool flash(QString &status);
+};
+
+// Reads the firmware once and hands the same image to one worker per board.
+// Progress and results are reported per board, in the thread of the batch.
+class DFUBatch : public QObject {
+    Q_OBJECT
+
+public:
+    DFUBatch(bool debug, QObject *parent = 0);
+    ~DFUBatch();
+
+    bool loadFirmware(const QString &filename);
+    bool setFirmware(const QByteArray &firmware);
+    QString errorString() const
+    {
+        return m_error;
+    }
+
+    // Opens every board sitting in its bootloader on the USB bus
+    int addBootloaders();
+    // Takes ownership of the DFUObject
+    int addBoard(const QString &name, OP_DFU::DFUObject *dfu);
+
+    int count() const
+    {
+        return m_workers.length();
+    }
+    QString boardName(int board) const;
+    bool boardSucceeded(int board) const;
+    bool isRunning() const
+    {
+        return m_running > 0;
+    }
+
+public slots:
+    bool start();
+
+signals:
+    void boardProgress(int board, int percent);
+    void boardStatus(int board, QString status);
+    void boardFinished(int board, bool success);
+    void finished(int succeeded, int failed);
+
+private slots:
+    void workerDone(int board, bool success, QString status);
+
+private:
+    bool m_debug;
+    QByteArray m_firmware;
+    QByteArray m_description;
+    QString m_error;
+    QList<DFUBatchWorker *> m_workers;
+    int m_running;
+    int m_succeeded;
+};
+
+#endif // DFUBATCH_H
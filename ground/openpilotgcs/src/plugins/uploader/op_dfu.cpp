@@ -26,17 +26,20 @@
  */
 
 #include "op_dfu.h"
+#include "fwlz.h"
 #include <cmath>
 #include <qwaitcondition.h>
 #include <QMetaType>
+#include <QVector>
 #include <QtWidgets/QApplication>
 
 using namespace OP_DFU;
 
 DFUObject::DFUObject(bool _debug, bool _use_serial, QString portname) :
-    debug(_debug), use_serial(_use_serial), mready(true)
+    debug(_debug), use_serial(_use_serial), mready(true), compression(true)
 {
     info = NULL;
+    transport = NULL;
     numberOfDevices = 0;
 
     qRegisterMetaType<OP_DFU::Status>("Status");
@@ -120,6 +123,32 @@ DFUObject::DFUObject(bool _debug, bool _use_serial, QString portname) :
     }
 }
 
+DFUObject::DFUObject(bool _debug, const USBPortInfo &port) :
+    debug(_debug), use_serial(false), mready(false), compression(true)
+{
+    info = NULL;
+    transport = NULL;
+    numberOfDevices = 0;
+
+    qRegisterMetaType<OP_DFU::Status>("Status");
+
+    if (hidHandle.open(port.vendorID, port.productID, port.serialNumber) == 1) {
+        mready = true;
+    } else {
+        hidHandle.close(0);
+    }
+}
+
+DFUObject::DFUObject(bool _debug, DFUTransport *_transport) :
+    debug(_debug), use_serial(false), mready(true), compression(true)
+{
+    info = NULL;
+    transport = _transport;
+    numberOfDevices = 0;
+
+    qRegisterMetaType<OP_DFU::Status>("Status");
+}
+
 DFUObject::~DFUObject()
 {
     if (use_serial) {
@@ -127,7 +156,7 @@ DFUObject::~DFUObject()
             delete serialhandle;
             delete info;
         }
-    } else {
+    } else if (!transport) {
         hidHandle.close(0);
     }
 }
@@ -253,7 +282,7 @@ bool DFUObject::UploadData(qint32 const & numberOfBytes, QByteArray & data)
             printProgBar((int)percentage, "UPLOADING");
         }
         laspercentage = (int)percentage;
-        if (packetcount == numberOfPackets) {
+        if (packetcount == numberOfPackets - 1) {
             packetsize = lastPacketCount;
         } else {
             packetsize = 14;
@@ -582,7 +611,7 @@ OP_DFU::Status DFUObject::StatusRequest()
     if (debug) {
         qDebug() << "StatusRequest: " << result << " bytes received";
     }
-    if (buf[1] == OP_DFU::Status_Rep) {
+    if ((result > 0) && (buf[1] == OP_DFU::Status_Rep)) {
         return (OP_DFU::Status)buf[6];
     } else {
         return OP_DFU::abort;
@@ -722,8 +751,6 @@ bool DFUObject::UploadFirmware(const QString &sfile, const bool &verify, int dev
 
 OP_DFU::Status DFUObject::UploadFirmwareT(const QString &sfile, const bool &verify, int device)
 {
-    OP_DFU::Status ret;
-
     if (debug) {
         qDebug() << "Starting Firmware Uploading...";
     }
@@ -742,6 +769,13 @@ OP_DFU::Status DFUObject::UploadFirmwareT(const QString &sfile, const bool &veri
     if (debug) {
         qDebug() << "Bytes Loaded=" << arr.length();
     }
+    return UploadFirmwareT(arr, verify, device);
+}
+
+OP_DFU::Status DFUObject::UploadFirmwareT(QByteArray arr, const bool &verify, int device)
+{
+    OP_DFU::Status ret;
+
     if (arr.length() % 4 != 0) {
         int pad = arr.length() / 4;
         ++pad;
@@ -761,7 +795,35 @@ OP_DFU::Status DFUObject::UploadFirmwareT(const QString &sfile, const bool &veri
         qDebug() << "NEW FIRMWARE CRC=" << crc;
     }
 
-    if (!StartUpload(arr.length(), OP_DFU::FW, crc)) {
+    // The bootloader decompresses straight into flash, only worth it when
+    // that saves packets
+    QByteArray packed;
+    if (compression) {
+        packed = CompressFirmware(arr);
+    }
+    bool compressed = !packed.isEmpty() && (packed.length() < arr.length());
+    if (compressed) {
+        if (debug) {
+            qDebug() << "Compressed to" << packed.length() << "bytes";
+        }
+        if (!StartUpload(packed.length(), OP_DFU::FWCompressed, crc)) {
+            ret = StatusRequest();
+            if (debug) {
+                qDebug() << "StartUpload failed";
+                qDebug() << "StartUpload returned:" << StatusToString(ret);
+            }
+            return ret;
+        }
+        // Older bootloaders turn the transfer down before erasing anything
+        if (StatusRequest() == OP_DFU::outsideDevCapabilities) {
+            if (debug) {
+                qDebug() << "No compressed transfers, uploading the plain image";
+            }
+            AbortOperation();
+            compressed = false;
+        }
+    }
+    if (!compressed && !StartUpload(arr.length(), OP_DFU::FW, crc)) {
         ret = StatusRequest();
         if (debug) {
             qDebug() << "StartUpload failed";
@@ -794,7 +856,8 @@ OP_DFU::Status DFUObject::UploadFirmwareT(const QString &sfile, const bool &veri
     }
 
     emit operationProgress(QString("Uploading firmware"));
-    if (!UploadData(arr.length(), arr)) {
+    QByteArray &payload = compressed ? packed : arr;
+    if (!UploadData(payload.length(), payload)) {
         ret = StatusRequest();
         if (debug) {
             qDebug() << "Upload failed (upload data)";
@@ -833,6 +896,37 @@ OP_DFU::Status DFUObject::UploadFirmwareT(const QString &sfile, const bool &veri
     return ret;
 }
 
+/**
+   Uploads an image and checks it without downloading it again: once
+   the upload is done, the bootloader is asked for its capabilities
+   again, which carry the CRC it computes over the whole flash.
+   You have to call enterDFU and findDevices before calling this function.
+ */
+OP_DFU::Status DFUObject::UploadImage(const QByteArray &image, int device)
+{
+    if (device >= devices.length()) {
+        return OP_DFU::abort;
+    }
+
+    OP_DFU::Status ret = UploadFirmwareT(image, false, device);
+    if (ret != OP_DFU::Last_operation_Success) {
+        return ret;
+    }
+
+    emit operationProgress(QString("Verifying firmware"));
+    quint32 crc = DFUObject::CRCFromQBArray(image, devices[device].SizeOfCode);
+    if (!findDevices() || (device >= devices.length())) {
+        return OP_DFU::abort;
+    }
+    if (devices[device].FW_CRC != crc) {
+        if (debug) {
+            qDebug() << "Verify: CRC read back" << devices[device].FW_CRC << "expected" << crc;
+        }
+        return OP_DFU::CRC_Fail;
+    }
+    return ret;
+}
+
 
 OP_DFU::Status DFUObject::CompareFirmware(const QString &sfile, const CompareType &type, int device)
 {
@@ -995,6 +1089,45 @@ quint32 DFUObject::CRC32WideFast(quint32 Crc, quint32 Size, quint32 *Buffer)
     return Crc;
 }
 
+/**
+   Checks the board ID in an OpFw description against a board, some
+   firmwares are designed to be backwards compatible with older boards.
+ */
+bool DFUObject::FirmwareMatchesBoard(int board, const QByteArray &description)
+{
+    int firmwareBoard = ((description.at(12) & 0xff) << 8) + (description.at(13) & 0xff);
+
+    if ((board == 0x401 && firmwareBoard == 0x402) ||
+        (board == 0x901 && firmwareBoard == 0x902) || // L3GD20 revo supports Revolution firmware
+        (board == 0x902 && firmwareBoard == 0x903)) { // RevoMini1 supporetd by RevoMini2 firmware
+        return true;
+    }
+    return firmwareBoard == board;
+}
+
+/**
+   Compresses an image for a FWCompressed transfer, see flight/libraries/fwlz.c.
+   Returns an empty array if that fails.
+ */
+QByteArray DFUObject::CompressFirmware(const QByteArray &image)
+{
+    QByteArray packed(FWLZ_COMPRESS_BOUND(image.length()), 0);
+    QVector<quint32> table(FWLZ_HASH_SIZE);
+
+    int32_t len = fwlz_compress((const uint8_t *)image.constData(), image.length(),
+                                (uint8_t *)packed.data(), packed.length(), table.data());
+
+    if (len < 0) {
+        return QByteArray();
+    }
+    packed.resize(len);
+    // Sent in whole words, the bootloader ignores what follows the image
+    while (packed.length() % 4 != 0) {
+        packed.append((char)0);
+    }
+    return packed;
+}
+
 /**
    Utility function
  */
@@ -1029,6 +1162,9 @@ quint32 DFUObject::CRCFromQBArray(QByteArray array, quint32 Size)
  */
 int DFUObject::sendData(void *data, int size)
 {
+    if (transport) {
+        return transport->send(data, size);
+    }
     if (!use_serial) {
         return hidHandle.send(0, data, size, 5000);
     }
@@ -1053,6 +1189,9 @@ int DFUObject::sendData(void *data, int size)
  */
 int DFUObject::receiveData(void *data, int size)
 {
+    if (transport) {
+        return transport->receive(data, size);
+    }
     if (!use_serial) {
         return hidHandle.receive(0, data, size, 10000);
     }
@@ -33,7 +33,8 @@ using namespace std;
 namespace OP_DFU {
 enum TransferTypes {
     FW,
-    Descript
+    Descript,
+    FWCompressed
 };
 
 enum CompareType {
@@ -106,6 +107,15 @@ struct device {
     bool    Writable;
 };
 
+// Raw access to a bootloader, one BUF_LEN report at a time. Lets the
+// protocol run against something else than a HID handle, such as the
+// simulated bootloader used by the tests.
+class DFUTransport {
+public:
+    virtual ~DFUTransport() {}
+    virtual int send(void *data, int size)    = 0;
+    virtual int receive(void *data, int size) = 0;
+};
 
 class DFUObject : public QThread {
     Q_OBJECT;
@@ -114,6 +124,10 @@ public:
     static quint32 CRCFromQBArray(QByteArray array, quint32 Size);
     // DFUObject(bool debug);
     DFUObject(bool debug, bool use_serial, QString port);
+    // Opens one particular bootloader, several can be open at once
+    DFUObject(bool debug, const USBPortInfo &port);
+    // Talks through the given transport, which stays owned by the caller
+    DFUObject(bool debug, DFUTransport *transport);
 
     virtual ~DFUObject();
 
@@ -133,6 +147,16 @@ public:
     // Upload (send to device) commands
     OP_DFU::Status UploadDescription(QVariant description);
     bool UploadFirmware(const QString &sfile, const bool &verify, int device);
+    // Synchronous upload of an image already in memory, verified by reading
+    // back the CRC the bootloader computes over the whole flash
+    OP_DFU::Status UploadImage(const QByteArray &image, int device);
+    // Firmware is sent compressed unless disabled, or when the bootloader
+    // does not know about compressed transfers
+    void setCompression(bool enable)
+    {
+        compression = enable;
+    }
+    static QByteArray CompressFirmware(const QByteArray &image);
 
     // Download (get from device) commands:
     // DownloadDescription is synchronous
@@ -158,6 +182,7 @@ public:
     // Helper functions:
     QString StatusToString(OP_DFU::Status const & status);
     static quint32 CRC32WideFast(quint32 Crc, quint32 Size, quint32 *Buffer);
+    static bool FirmwareMatchesBoard(int board, const QByteArray &description);
     OP_DFU::eBoardType GetBoardType(int boardNum);
 
 
@@ -172,6 +197,7 @@ private:
     bool debug;
     bool use_serial;
     bool mready;
+    bool compression;
     int RWFlags;
     qsspt *serialhandle;
     int sendData(void *, int);
@@ -179,6 +205,7 @@ private:
     uint8_t sspTxBuf[MAX_PACKET_BUF_SIZE];
     uint8_t sspRxBuf[MAX_PACKET_BUF_SIZE];
     port *info;
+    DFUTransport *transport;
 
 
     // USB Bootloader:
@@ -197,6 +224,7 @@ private:
     // Same as startDownload except that we store in an external array:
     bool StartDownloadT(QByteArray *fw, qint32 const & numberOfBytes, TransferTypes const & type);
     OP_DFU::Status UploadFirmwareT(const QString &sfile, const bool &verify, int device);
+    OP_DFU::Status UploadFirmwareT(QByteArray arr, const bool &verify, int device);
     QMutex mutex;
     OP_DFU::Commands requestedOperation;
     qint32 requestSize;
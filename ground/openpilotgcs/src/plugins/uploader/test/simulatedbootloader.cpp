@@ -0,0 +1,390 @@
+/**
+ ******************************************************************************
+ *
+ * @file       simulatedbootloader.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup Uploader Uploader Plugin
+ * @{
+ * @brief In memory stand-in for a board sitting in its bootloader
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "simulatedbootloader.h"
+#include "delay.h"
+#include <string.h>
+
+using namespace OP_DFU;
+
+#define WORDS_PER_PACKET 14
+
+static quint32 unpack_uint32(const quint8 *buffer)
+{
+    return ((quint32)buffer[0] << 24) | ((quint32)buffer[1] << 16) | ((quint32)buffer[2] << 8) | buffer[3];
+}
+
+static void pack_uint32(quint32 value, quint8 *buffer)
+{
+    buffer[0] = value >> 24;
+    buffer[1] = value >> 16;
+    buffer[2] = value >> 8;
+    buffer[3] = value;
+}
+
+SimulatedBootloader::SimulatedBootloader(int _boardID, quint32 sizeOfCode, int sizeOfDesc, int _blVersion) :
+    boardID(_boardID), blVersion(_blVersion),
+    code(sizeOfCode, (char)0xFF), desc(sizeOfDesc, (char)0xFF),
+    stuckOffset(0), stuckMask(0), unplugAfter(-1), latency(0), eraseCount(0),
+    compressedTransfers(true), packetCount(0),
+    state(OP_DFU::DFUidle), transferType(0), sizeOfTransfer(0), sizeOfLastPacket(0),
+    nextPacket(0), expectedCrc(0), downType(0), downTotal(0), downLast(0), downCurrent(0)
+{}
+
+/**
+   A board powered with USB connected starts out in DFUidle and stays there
+ */
+int SimulatedBootloader::send(void *data, int size)
+{
+    QMutexLocker locker(&mutex);
+
+    if (unplugAfter == 0) {
+        return -1;
+    }
+    if (unplugAfter > 0) {
+        unplugAfter--;
+    }
+    if (latency) {
+        delay::msleep(latency);
+    }
+
+    quint8 buf[BUF_LEN];
+    memset(buf, 0, sizeof(buf));
+    memcpy(buf, data, qMin(size, BUF_LEN));
+    process(buf);
+    return size;
+}
+
+int SimulatedBootloader::receive(void *data, int size)
+{
+    QMutexLocker locker(&mutex);
+
+    if (unplugAfter == 0) {
+        return -1;
+    }
+    if (replies.isEmpty() && state == OP_DFU::downloading) {
+        downloadPacket();
+    }
+    if (replies.isEmpty()) {
+        // hid_read would have timed out
+        return -1;
+    }
+
+    QByteArray report = replies.takeFirst();
+    int len = qMin(size, report.length());
+    memcpy(data, report.constData(), len);
+    return len;
+}
+
+QByteArray SimulatedBootloader::flash() const
+{
+    QMutexLocker locker(&mutex);
+
+    return code;
+}
+
+QByteArray SimulatedBootloader::description() const
+{
+    QMutexLocker locker(&mutex);
+
+    return desc;
+}
+
+/**
+   Bits of mask at offset stay erased whatever is programmed
+ */
+void SimulatedBootloader::setStuckBits(quint32 offset, quint8 mask)
+{
+    QMutexLocker locker(&mutex);
+
+    stuckOffset = offset;
+    stuckMask   = mask;
+}
+
+/**
+   Stops answering after that many more reports, like a pulled cable
+ */
+void SimulatedBootloader::setUnplugAfter(int reports)
+{
+    QMutexLocker locker(&mutex);
+
+    unplugAfter = reports;
+}
+
+void SimulatedBootloader::setLatency(int ms)
+{
+    QMutexLocker locker(&mutex);
+
+    latency = ms;
+}
+
+void SimulatedBootloader::setCompressedTransfers(bool enable)
+{
+    QMutexLocker locker(&mutex);
+
+    compressedTransfers = enable;
+}
+
+int SimulatedBootloader::erases() const
+{
+    QMutexLocker locker(&mutex);
+
+    return eraseCount;
+}
+
+int SimulatedBootloader::uploadPackets() const
+{
+    QMutexLocker locker(&mutex);
+
+    return packetCount;
+}
+
+bool SimulatedBootloader::isFirmware(quint32 type) const
+{
+    return (type == OP_DFU::FW) || (compressedTransfers && (type == OP_DFU::FWCompressed));
+}
+
+QByteArray &SimulatedBootloader::area(quint32 type)
+{
+    return isFirmware(type) ? code : desc;
+}
+
+/**
+   The flash callbacks of the decompressor, as in flight/libraries/op_dfu.c
+ */
+bool SimulatedBootloader::programWord(void *ctx, uint32_t offset, uint32_t word)
+{
+    SimulatedBootloader *board = (SimulatedBootloader *)ctx;
+
+    for (int b = 0; b < 4; b++) {
+        quint8 byte = word >> (8 * b);
+        if (offset + b == board->stuckOffset) {
+            byte |= board->stuckMask;
+        }
+        board->code[offset + b] = byte;
+    }
+    return (quint8)board->code[offset + 0] == (quint8)word
+           && (quint8)board->code[offset + 1] == (quint8)(word >> 8)
+           && (quint8)board->code[offset + 2] == (quint8)(word >> 16)
+           && (quint8)board->code[offset + 3] == (quint8)(word >> 24);
+}
+
+uint8_t SimulatedBootloader::readByte(void *ctx, uint32_t offset)
+{
+    SimulatedBootloader *board = (SimulatedBootloader *)ctx;
+
+    return board->code[offset];
+}
+
+quint32 SimulatedBootloader::flashCrc() const
+{
+    return DFUObject::CRCFromQBArray(code, code.length());
+}
+
+void SimulatedBootloader::reply(const quint8 *buf)
+{
+    // What the host reads starts with the report ID of the bootloader
+    QByteArray report(BUF_LEN, 0);
+
+    report[0] = 0x01;
+    memcpy(report.data() + 1, buf + 1, BUF_LEN - 1);
+    replies.append(report);
+}
+
+void SimulatedBootloader::downloadPacket()
+{
+    quint8 buf[BUF_LEN];
+    QByteArray &src = area(downType);
+    quint32 words   = (downCurrent == downTotal - 1) ? downLast : WORDS_PER_PACKET;
+
+    memset(buf, 0, sizeof(buf));
+    buf[1] = OP_DFU::Download;
+    pack_uint32(downCurrent, &buf[2]);
+    for (quint32 x = 0; x < words * 4; x++) {
+        quint32 offset = downCurrent * WORDS_PER_PACKET * 4 + x;
+        buf[6 + x] = (offset < (quint32)src.length()) ? src[offset] : 0xFF;
+    }
+    if (++downCurrent >= downTotal) {
+        state = OP_DFU::Last_operation_Success;
+    }
+    reply(buf);
+}
+
+void SimulatedBootloader::process(const quint8 *rx)
+{
+    quint8 buf[BUF_LEN];
+    quint8 command   = rx[1] & 0x1F;
+    bool startFlag   = (rx[1] >> 5) & 0x01;
+    quint32 count    = unpack_uint32(&rx[2]);
+    quint8 data0     = rx[6];
+    quint8 data1     = rx[7];
+
+    memset(buf, 0, sizeof(buf));
+
+    switch (command) {
+    case OP_DFU::EnterDFU:
+        if (((state == OP_DFU::idle) && (data0 < 1)) || (state == OP_DFU::DFUidle)) {
+            state = OP_DFU::DFUidle;
+        }
+        break;
+
+    case OP_DFU::Upload:
+        if ((state != OP_DFU::DFUidle) && (state != OP_DFU::uploading)) {
+            break;
+        }
+        if (startFlag && (nextPacket == 0)) {
+            transferType     = data0;
+            sizeOfTransfer   = count;
+            sizeOfLastPacket = data1;
+            expectedCrc      = unpack_uint32(&rx[8]);
+            nextPacket = 1;
+            quint32 bytes = (sizeOfTransfer - 1) * WORDS_PER_PACKET * 4 + sizeOfLastPacket * 4;
+            // Like op_dfu.c, unknown transfer types are too big for the board
+            if ((transferType > OP_DFU::Descript && !isFirmware(transferType))
+                || (bytes > (quint32)area(transferType).length())) {
+                state = OP_DFU::outsideDevCapabilities;
+            } else {
+                if (isFirmware(transferType)) {
+                    code.fill((char)0xFF);
+                    eraseCount++;
+                }
+                if (transferType == OP_DFU::FWCompressed) {
+                    fwlz_decode_init(&decoder, code.length(), programWord, readByte, this);
+                }
+                packetCount = 0;
+                state = OP_DFU::uploading;
+            }
+        } else if (!startFlag && (nextPacket != 0)) {
+            if (count > sizeOfTransfer) {
+                state = OP_DFU::too_many_packets;
+            } else if (count == nextPacket - 1) {
+                QByteArray &dst = area(transferType);
+                quint32 words   = (count == sizeOfTransfer - 1) ? sizeOfLastPacket : WORDS_PER_PACKET;
+                packetCount++;
+                if (transferType == OP_DFU::FWCompressed) {
+                    quint8 bytes[WORDS_PER_PACKET * 4];
+                    for (quint32 x = 0; x < words; x++) {
+                        quint32 word = unpack_uint32(&rx[6 + x * 4]);
+                        for (int b = 0; b < 4; b++) {
+                            bytes[x * 4 + b] = word >> (8 * b);
+                        }
+                    }
+                    if (fwlz_decode(&decoder, bytes, words * 4) < 0) {
+                        state = OP_DFU::Last_operation_failed;
+                    }
+                    ++nextPacket;
+                    break;
+                }
+                for (quint32 x = 0; x < words; x++) {
+                    // Unpacked big endian, stored little endian like FLASH_ProgramWord
+                    quint32 word   = unpack_uint32(&rx[6 + x * 4]);
+                    quint32 offset = count * WORDS_PER_PACKET * 4 + x * 4;
+                    for (int b = 0; b < 4; b++) {
+                        quint8 byte = word >> (8 * b);
+                        if ((transferType == OP_DFU::FW) && (offset + b == stuckOffset)) {
+                            byte |= stuckMask;
+                        }
+                        dst[offset + b] = byte;
+                    }
+                }
+                ++nextPacket;
+            } else {
+                state = OP_DFU::wrong_packet_received;
+            }
+        } else {
+            state = OP_DFU::Last_operation_failed;
+        }
+        break;
+
+    case OP_DFU::Req_Capabilities:
+        buf[1] = OP_DFU::Rep_Capabilities;
+        if (data0 == 0) {
+            buf[7] = 1;
+            buf[9] = 0x03; // Readable and writable
+        } else {
+            pack_uint32(code.length(), &buf[2]);
+            buf[6]  = data0;
+            buf[7]  = blVersion;
+            buf[8]  = desc.length();
+            buf[9]  = boardID;
+            pack_uint32(flashCrc(), &buf[10]);
+            buf[14] = boardID >> 8;
+            buf[15] = boardID;
+        }
+        reply(buf);
+        break;
+
+    case OP_DFU::Abort_Operation:
+        nextPacket = 0;
+        state = OP_DFU::DFUidle;
+        break;
+
+    case OP_DFU::Op_END:
+        if (state == OP_DFU::uploading) {
+            if (nextPacket - 1 == sizeOfTransfer) {
+                nextPacket = 0;
+                if ((transferType == OP_DFU::FWCompressed) && !fwlz_decode_done(&decoder)) {
+                    state = OP_DFU::CRC_Fail;
+                } else if (!isFirmware(transferType) || (expectedCrc == flashCrc())) {
+                    state = OP_DFU::Last_operation_Success;
+                } else {
+                    state = OP_DFU::CRC_Fail;
+                }
+            }
+            if (nextPacket - 1 < sizeOfTransfer) {
+                nextPacket = 0;
+                state = OP_DFU::too_few_packets;
+            }
+        }
+        break;
+
+    case OP_DFU::Download_Req:
+        if (state == OP_DFU::DFUidle) {
+            downType    = data0;
+            downTotal   = count;
+            downLast    = data1;
+            downCurrent = 0;
+            state = (downTotal > 0) ? OP_DFU::downloading : OP_DFU::Last_operation_Success;
+        } else {
+            state = OP_DFU::Last_operation_failed;
+        }
+        break;
+
+    case OP_DFU::Status_Request:
+        buf[1] = OP_DFU::Status_Rep;
+        buf[6] = state;
+        reply(buf);
+        if (state == OP_DFU::Last_operation_Success) {
+            state = OP_DFU::DFUidle;
+        }
+        break;
+
+    default:
+        // JumpFW and Reset leave the bootloader, nothing more to simulate
+        break;
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ ******************************************************************************
+ *
+ * @file       simulatedbootloader.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup Uploader Uploader Plugin
+ * @{
+ * @brief In memory stand-in for a board sitting in its bootloader
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef SIMULATEDBOOTLOADER_H
+#define SIMULATEDBOOTLOADER_H
+
+#include <QByteArray>
+#include <QList>
+#include <QMutex>
+#include "op_dfu.h"
+#include "fwlz.h"
+
+// Answers the DFU reports the way flight/libraries/op_dfu.c does, with a
+// single device whose flash and description live in memory. The flash
+// keeps the byte order of the real one, so its CRC matches CRCFromQBArray.
+class SimulatedBootloader : public OP_DFU::DFUTransport {
+public:
+    SimulatedBootloader(int boardID, quint32 sizeOfCode, int sizeOfDesc = 100, int blVersion = 4);
+
+    int send(void *data, int size);
+    int receive(void *data, int size);
+
+    QByteArray flash() const;
+    QByteArray description() const;
+
+    // Fault injection
+    void setStuckBits(quint32 offset, quint8 mask);
+    void setUnplugAfter(int reports);
+    void setLatency(int ms);
+    // Turns compressed transfers down, as bootloaders before them did
+    void setCompressedTransfers(bool enable);
+
+    int erases() const;
+    // Data reports of the last upload
+    int uploadPackets() const;
+
+private:
+    mutable QMutex mutex;
+    QList<QByteArray> replies;
+
+    int boardID;
+    int blVersion;
+    QByteArray code;
+    QByteArray desc;
+    quint32 stuckOffset;
+    quint8 stuckMask;
+    int unplugAfter;
+    int latency;
+    int eraseCount;
+    bool compressedTransfers;
+    int packetCount;
+    struct fwlz_decoder decoder;
+
+    OP_DFU::Status state;
+    quint32 transferType;
+    quint32 sizeOfTransfer;
+    quint32 sizeOfLastPacket;
+    quint32 nextPacket;
+    quint32 expectedCrc;
+    quint32 downType;
+    quint32 downTotal;
+    quint32 downLast;
+    quint32 downCurrent;
+
+    void process(const quint8 *buf);
+    void reply(const quint8 *buf);
+    void downloadPacket();
+    QByteArray &area(quint32 type);
+    quint32 flashCrc() const;
+    bool isFirmware(quint32 type) const;
+
+    static bool programWord(void *ctx, uint32_t offset, uint32_t word);
+    static uint8_t readByte(void *ctx, uint32_t offset);
+};
+
+#endif // SIMULATEDBOOTLOADER_H
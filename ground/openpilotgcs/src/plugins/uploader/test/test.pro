@@ -0,0 +1,31 @@
+CONFIG += qtestlib
+TEMPLATE = app
+CONFIG -= app_bundle
+
+QT += widgets serialport
+
+include(../../../../openpilotgcs.pri)
+
+# The protocol sources are built in, the HID plugin is linked for USBMonitor
+INCLUDEPATH += .. $$GCS_SOURCE_TREE/src/plugins $$ROOT_DIR/flight/libraries/inc
+LIBS += -L$$GCS_PLUGIN_PATH/OpenPilot -l$$qtLibraryName(opHID)
+
+HEADERS += simulatedbootloader.h \
+    ../op_dfu.h \
+    ../delay.h \
+    ../dfubatch.h \
+    ../SSP/port.h \
+    ../SSP/qssp.h \
+    ../SSP/qsspt.h \
+    ../SSP/common.h \
+    $$ROOT_DIR/flight/libraries/inc/fwlz.h
+
+SOURCES += tst_dfubatch.cpp \
+    simulatedbootloader.cpp \
+    ../op_dfu.cpp \
+    ../delay.cpp \
+    ../dfubatch.cpp \
+    ../SSP/port.cpp \
+    ../SSP/qssp.cpp \
+    ../SSP/qsspt.cpp \
+    $$ROOT_DIR/flight/libraries/fwlz.c
@@ -0,0 +1,356 @@
+/**
+ ******************************************************************************
+ *
+ * @file       tst_dfubatch.cpp
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2015.
+ * @addtogroup GCSPlugins GCS Plugins
+ * @{
+ * @addtogroup Uploader Uploader Plugin
+ * @{
+ * @brief Batch upload against simulated bootloaders
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "dfubatch.h"
+#include "simulatedbootloader.h"
+
+#include <QtTest/QtTest>
+#include <QtCore/QObject>
+#include <QCryptographicHash>
+#include <QElapsedTimer>
+#include <QSet>
+
+using namespace OP_DFU;
+
+#define BOARD_REVOMINI 0x0903
+#define SIZE_OF_CODE   (64 * 1024)
+
+// Notes the threads the signals it is connected to are emitted from
+class ThreadRecorder : public QObject {
+    Q_OBJECT
+
+public:
+    QSet<QThread *> threads;
+
+public slots:
+    void record()
+    {
+        threads.insert(QThread::currentThread());
+    }
+};
+
+class tst_DFUBatch : public QObject {
+    Q_OBJECT
+
+private slots:
+    void init();
+    void cleanup();
+    void flashesAllBoardsAtOnce();
+    void reportsInBatchThread();
+    void plainBinaryHasNoDescription();
+    void corruptFileRejected();
+    void wrongBoardNotErased();
+    void stuckBitsFailVerify();
+    void unpluggedBoardFails();
+    void compressedImageUploads();
+    void olderBootloaderGetsPlainImage();
+    void compressedTransferTime();
+
+private:
+    QList<SimulatedBootloader *> m_boards;
+    DFUBatch *m_batch;
+
+    SimulatedBootloader *addBoard(int boardID = BOARD_REVOMINI);
+    QByteArray firmware(int length, int boardID = BOARD_REVOMINI);
+    QByteArray firmware(const QByteArray &code, int boardID = BOARD_REVOMINI);
+    QByteArray realCode(int length);
+    bool run(int timeout = 30000);
+};
+
+void tst_DFUBatch::init()
+{
+    m_batch = new DFUBatch(false);
+}
+
+void tst_DFUBatch::cleanup()
+{
+    // Waits for the workers, which still talk to the boards
+    delete m_batch;
+    qDeleteAll(m_boards);
+    m_boards.clear();
+}
+
+SimulatedBootloader *tst_DFUBatch::addBoard(int boardID)
+{
+    SimulatedBootloader *board = new SimulatedBootloader(boardID, SIZE_OF_CODE);
+
+    m_boards.append(board);
+    m_batch->addBoard(QString("sim%1").arg(m_boards.length()), new DFUObject(false, board));
+    return board;
+}
+
+/**
+   An .opfw image: code followed by its 100 bytes description
+ */
+QByteArray tst_DFUBatch::firmware(int length, int boardID)
+{
+    QByteArray code(length, 0);
+    quint32 seed = length;
+
+    for (int i = 0; i < length; i++) {
+        seed    = seed * 1103515245 + 12345;
+        code[i] = seed >> 16;
+    }
+    return firmware(code, boardID);
+}
+
+QByteArray tst_DFUBatch::firmware(const QByteArray &code, int boardID)
+{
+    QByteArray desc(100, 0);
+    desc.replace(0, 4, "OpFw");
+    desc[12] = boardID >> 8;
+    desc[13] = boardID;
+    desc.replace(40, 20, QCryptographicHash::hash(code, QCryptographicHash::Sha1));
+
+    return code + desc;
+}
+
+/**
+   The start of this very executable, machine code that compresses like
+   firmware does, unlike the noise of firmware(int)
+ */
+QByteArray tst_DFUBatch::realCode(int length)
+{
+    QFile file(QCoreApplication::applicationFilePath());
+
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray();
+    }
+    return file.read(length);
+}
+
+bool tst_DFUBatch::run(int timeout)
+{
+    QSignalSpy spy(m_batch, SIGNAL(finished(int, int)));
+
+    if (!m_batch->start()) {
+        return false;
+    }
+    return spy.wait(timeout);
+}
+
+void tst_DFUBatch::flashesAllBoardsAtOnce()
+{
+    QByteArray image = firmware(20000);
+
+    for (int i = 0; i < 4; i++) {
+        addBoard();
+    }
+    QVERIFY(m_batch->setFirmware(image));
+
+    QSignalSpy progress(m_batch, SIGNAL(boardProgress(int, int)));
+    QSignalSpy done(m_batch, SIGNAL(boardFinished(int, bool)));
+    QElapsedTimer timer;
+    timer.start();
+    QVERIFY(run());
+
+    // Each board waits two seconds on the erase and the description,
+    // one after the other that would be at least eight
+    QVERIFY(timer.elapsed() < 6000);
+
+    QCOMPARE(done.count(), 4);
+    for (int i = 0; i < 4; i++) {
+        QVERIFY(m_batch->boardSucceeded(i));
+
+        QByteArray flash = m_boards[i]->flash();
+        QCOMPARE(flash.left(image.length()), image);
+        QCOMPARE(flash.mid(image.length()), QByteArray(SIZE_OF_CODE - image.length(), (char)0xFF));
+        QCOMPARE(m_boards[i]->description(), image.right(100));
+        QCOMPARE(m_boards[i]->erases(), 1);
+    }
+
+    // Every board reports its own progress up to completion
+    QSet<int> complete;
+    for (int i = 0; i < progress.count(); i++) {
+        if (progress[i][1].toInt() == 100) {
+            complete.insert(progress[i][0].toInt());
+        }
+    }
+    QCOMPARE(complete.size(), 4);
+}
+
+void tst_DFUBatch::reportsInBatchThread()
+{
+    for (int i = 0; i < 3; i++) {
+        addBoard();
+    }
+    QVERIFY(m_batch->setFirmware(firmware(8000)));
+
+    // Called in the thread that emits, which must not be a worker
+    ThreadRecorder recorder;
+    connect(m_batch, SIGNAL(boardProgress(int, int)), &recorder, SLOT(record()), Qt::DirectConnection);
+    connect(m_batch, SIGNAL(boardStatus(int, QString)), &recorder, SLOT(record()), Qt::DirectConnection);
+    connect(m_batch, SIGNAL(boardFinished(int, bool)), &recorder, SLOT(record()), Qt::DirectConnection);
+    QVERIFY(run());
+
+    QCOMPARE(recorder.threads.size(), 1);
+    QVERIFY(recorder.threads.contains(QThread::currentThread()));
+    for (int i = 0; i < 3; i++) {
+        QVERIFY(m_batch->boardSucceeded(i));
+    }
+}
+
+void tst_DFUBatch::plainBinaryHasNoDescription()
+{
+    QByteArray image(1234 * 4 + 2, 0x5A);
+
+    addBoard();
+    QVERIFY(m_batch->setFirmware(image));
+    QVERIFY(run());
+
+    QVERIFY(m_batch->boardSucceeded(0));
+    // Padded to whole words with erased bytes
+    QCOMPARE(m_boards[0]->flash().left(image.length() + 2), image + QByteArray(2, (char)0xFF));
+    QCOMPARE(m_boards[0]->description(), QByteArray(100, (char)0xFF));
+}
+
+void tst_DFUBatch::corruptFileRejected()
+{
+    QByteArray image = firmware(4000);
+
+    image[10] = image[10] ^ 1;
+    QVERIFY(!m_batch->setFirmware(image));
+    QVERIFY(!m_batch->start());
+}
+
+void tst_DFUBatch::wrongBoardNotErased()
+{
+    SimulatedBootloader *cc3d = addBoard(0x0401);
+    SimulatedBootloader *revo = addBoard();
+
+    QVERIFY(m_batch->setFirmware(firmware(8000)));
+    QVERIFY(run());
+
+    QVERIFY(!m_batch->boardSucceeded(0));
+    QCOMPARE(cc3d->erases(), 0);
+    QVERIFY(m_batch->boardSucceeded(1));
+    QCOMPARE(revo->erases(), 1);
+}
+
+void tst_DFUBatch::stuckBitsFailVerify()
+{
+    QByteArray image = firmware(8000);
+    int offset = image.indexOf((char)0x00, 100);
+
+    QVERIFY(offset >= 0);
+    addBoard()->setStuckBits(offset, 0x10);
+    addBoard();
+    QVERIFY(m_batch->setFirmware(image));
+
+    QSignalSpy status(m_batch, SIGNAL(boardStatus(int, QString)));
+    QVERIFY(run());
+
+    QVERIFY(!m_batch->boardSucceeded(0));
+    QVERIFY(m_batch->boardSucceeded(1));
+
+    QString last;
+    for (int i = 0; i < status.count(); i++) {
+        if (status[i][0].toInt() == 0) {
+            last = status[i][1].toString();
+        }
+    }
+    QVERIFY(last.contains("CRC"));
+}
+
+void tst_DFUBatch::unpluggedBoardFails()
+{
+    addBoard()->setUnplugAfter(60);
+    addBoard();
+    QVERIFY(m_batch->setFirmware(firmware(20000)));
+    QVERIFY(run());
+
+    QVERIFY(!m_batch->boardSucceeded(0));
+    QVERIFY(m_batch->boardSucceeded(1));
+}
+
+void tst_DFUBatch::compressedImageUploads()
+{
+    QByteArray code  = realCode(40000);
+    QByteArray image = firmware(code);
+
+    QCOMPARE(code.length(), 40000);
+    SimulatedBootloader *board = addBoard();
+    QVERIFY(m_batch->setFirmware(image));
+    QVERIFY(run());
+
+    QVERIFY(m_batch->boardSucceeded(0));
+    QCOMPARE(board->flash().left(code.length()), code);
+    QCOMPARE(board->flash().mid(code.length()), QByteArray(SIZE_OF_CODE - code.length(), (char)0xFF));
+    QCOMPARE(board->erases(), 1);
+    // Fewer reports than the 715 of the plain image
+    QVERIFY(board->uploadPackets() < (code.length() + 55) / 56);
+}
+
+void tst_DFUBatch::olderBootloaderGetsPlainImage()
+{
+    QByteArray code = realCode(40000);
+
+    SimulatedBootloader *board = addBoard();
+    board->setCompressedTransfers(false);
+    QVERIFY(m_batch->setFirmware(firmware(code)));
+    QVERIFY(run());
+
+    QVERIFY(m_batch->boardSucceeded(0));
+    QCOMPARE(board->flash().left(code.length()), code);
+    QCOMPARE(board->erases(), 1);
+    QCOMPARE(board->uploadPackets(), (code.length() + 55) / 56);
+}
+
+/**
+   One report per millisecond, as many as a full speed USB HID endpoint
+   takes. Over the OPLink radio each one takes about eight times longer.
+ */
+void tst_DFUBatch::compressedTransferTime()
+{
+    QByteArray code = realCode(SIZE_OF_CODE);
+    qint64 elapsed[2];
+    int packets[2];
+
+    for (int compressed = 0; compressed < 2; compressed++) {
+        SimulatedBootloader board(BOARD_REVOMINI, SIZE_OF_CODE);
+        DFUObject dfu(false, &board);
+
+        dfu.setCompression(compressed);
+        QVERIFY(dfu.enterDFU(0));
+        QVERIFY(dfu.findDevices());
+        board.setLatency(1);
+
+        QElapsedTimer timer;
+        timer.start();
+        QVERIFY(dfu.UploadImage(code, 0) == OP_DFU::Last_operation_Success);
+        elapsed[compressed] = timer.elapsed();
+        packets[compressed] = board.uploadPackets();
+        QCOMPARE(board.flash(), code);
+    }
+    qDebug() << code.length() << "bytes:" << packets[0] << "reports in" << elapsed[0] << "ms plain,"
+             << packets[1] << "reports in" << elapsed[1] << "ms compressed";
+    QVERIFY(packets[1] < packets[0]);
+}
+
+QTEST_MAIN(tst_DFUBatch)
+
+#include "tst_dfubatch.moc"
@@ -32,7 +32,9 @@ HEADERS += uploadergadget.h \
     uploader_global.h \
     enums.h \
     rebootdialog.h \
-    oplinkwatchdog.h
+    oplinkwatchdog.h \
+    dfubatch.h \
+    batchuploaddialog.h
 
 SOURCES += uploadergadget.cpp \
     uploadergadgetconfiguration.cpp \
@@ -48,7 +50,14 @@ SOURCES += uploadergadget.cpp \
     SSP/qsspt.cpp \
     runningdevicewidget.cpp \
     rebootdialog.cpp \
-    oplinkwatchdog.cpp
+    oplinkwatchdog.cpp \
+    dfubatch.cpp \
+    batchuploaddialog.cpp
+
+# The compressor for compressed firmware transfers, shared with the bootloader
+INCLUDEPATH += $$ROOT_DIR/flight/libraries/inc
+HEADERS += $$ROOT_DIR/flight/libraries/inc/fwlz.h
+SOURCES += $$ROOT_DIR/flight/libraries/fwlz.c
 
 OTHER_FILES += Uploader.pluginspec
 
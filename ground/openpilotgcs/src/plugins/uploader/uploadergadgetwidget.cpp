@@ -43,6 +43,8 @@
 #include <QProgressBar>
 #include <QDebug>
 #include "rebootdialog.h"
+#include "dfubatch.h"
+#include "batchuploaddialog.h"
 
 #define DFU_DEBUG true
 
@@ -159,6 +161,7 @@ UploaderGadgetWidget::UploaderGadgetWidget(QWidget *parent) : QWidget(parent)
     connect(m_config->safeBootButton, SIGNAL(clicked()), this, SLOT(systemSafeBoot()));
     connect(m_config->eraseBootButton, SIGNAL(clicked()), this, SLOT(systemEraseBoot()));
     connect(m_config->rescueButton, SIGNAL(clicked()), this, SLOT(systemRescue()));
+    connect(m_config->batchUploadButton, SIGNAL(clicked()), this, SLOT(systemBatchUpload()));
 
     getSerialPorts();
 
@@ -964,6 +967,66 @@ void UploaderGadgetWidget::systemRescue()
     m_currentIAPStep = IAP_STATE_BOOTLOADER;
 }
 
+/**
+   Flashes the same firmware into every board sitting in its bootloader,
+   each one from its own thread
+ */
+void UploaderGadgetWidget::systemBatchUpload()
+{
+    QString filename = QFileDialog::getOpenFileName(this,
+                                                    tr("Select firmware file"),
+                                                    QString(),
+                                                    tr("Firmware Files (*.opfw *.bin)"));
+
+    if (filename.isEmpty()) {
+        return;
+    }
+
+    // The image is read and checked once for all the boards
+    DFUBatch batch(DFU_DEBUG);
+    if (!batch.loadFirmware(filename)) {
+        QMessageBox::warning(this, tr("Batch Upload"), batch.errorString());
+        return;
+    }
+
+    Core::ConnectionManager *cm = Core::ICore::instance()->connectionManager();
+    cm->disconnectDevice();
+    // stop the polling thread: otherwise it will mess up DFU
+    cm->suspendPolling();
+
+    // Delete all previous tabs:
+    while (m_config->systemElements->count()) {
+        QWidget *qw = m_config->systemElements->widget(0);
+        m_config->systemElements->removeTab(0);
+        delete qw;
+    }
+
+    // Existing DFU objects hold one of the boards
+    if (m_dfu) {
+        delete m_dfu;
+        m_dfu = NULL;
+    }
+    m_config->rescueButton->setEnabled(false);
+    m_config->batchUploadButton->setEnabled(false);
+
+    clearLog();
+    if (batch.addBootloaders() == 0) {
+        QMessageBox::warning(this, tr("Batch Upload"),
+                             tr("No board in bootloader mode was found. Connect the boards to USB before powering them."));
+    } else {
+        log(QString("Found %1 board(s).").arg(batch.count()));
+        BatchUploadDialog dialog(&batch, this);
+        dialog.exec();
+        for (int i = 0; i < batch.count(); i++) {
+            log(QString("%1: %2").arg(batch.boardName(i)).arg(batch.boardSucceeded(i) ? "OK" : "FAILED"));
+        }
+    }
+
+    cm->resumePolling();
+    m_config->rescueButton->setEnabled(true);
+    m_config->batchUploadButton->setEnabled(true);
+}
+
 void UploaderGadgetWidget::uploadStarted()
 {
     m_config->haltButton->setEnabled(false);
@@ -29,12 +29,17 @@ using namespace std;
 
 bool UAVObjectGeneratorPython::generate(UAVObjectParser *parser, QString templatepath, QString outputpath)
 {
+    fieldTypeStrNative << "FLIGHTPLANUAVO_TYPE_INT8" << "FLIGHTPLANUAVO_TYPE_INT16" << "FLIGHTPLANUAVO_TYPE_INT32"
+                       << "FLIGHTPLANUAVO_TYPE_UINT8" << "FLIGHTPLANUAVO_TYPE_UINT16" << "FLIGHTPLANUAVO_TYPE_UINT32"
+                       << "FLIGHTPLANUAVO_TYPE_FLOAT32" << "FLIGHTPLANUAVO_TYPE_ENUM";
+
     // Load template and setup output directory
     pythonCodePath     = QDir(templatepath + QString("flight/modules/FlightPlan/lib"));
     pythonOutputPath   = QDir(outputpath + QString("python"));
     pythonOutputPath.mkpath(pythonOutputPath.absolutePath());
-    pythonCodeTemplate = readFile(pythonCodePath.absoluteFilePath("uavobject.pyt.template"));
-    if (pythonCodeTemplate.isEmpty()) {
+    pythonCodeTemplate   = readFile(pythonCodePath.absoluteFilePath("uavobject.pyt.template"));
+    pythonNativeTemplate = readFile(pythonCodePath.absoluteFilePath("uavobjectnative.pyt.template"));
+    if (pythonCodeTemplate.isEmpty() || pythonNativeTemplate.isEmpty()) {
         std::cerr << "Problem reading python templates" << endl;
         return false;
     }
@@ -43,6 +48,7 @@ bool UAVObjectGeneratorPython::generate(UAVObjectParser *parser, QString templat
     for (int objidx = 0; objidx < parser->getNumObjects(); ++objidx) {
         ObjectInfo *info = parser->getObjectByIndex(objidx);
         process_object(info);
+        process_object_native(info);
     }
 
     return true; // if we come here everything should be fine
@@ -118,3 +124,70 @@ bool UAVObjectGeneratorPython::process_object(ObjectInfo *info)
 
     return true;
 }
+
+/**
+ * Generate the python module of native field accessors
+ */
+bool UAVObjectGeneratorPython::process_object_native(ObjectInfo *info)
+{
+    if (info == NULL) {
+        return false;
+    }
+
+    // Prepare output strings
+    QString outCode = pythonNativeTemplate;
+
+    // Replace common tags
+    replaceCommonTags(outCode, info);
+
+    // Replace the $(NATIVECONSTANTS) tag, enum options and element names
+    // as FIELD_NAME constants
+    QString constants;
+    for (int n = 0; n < info->fields.length(); ++n) {
+        QStringList names;
+        if (info->fields[n]->type == FIELDTYPE_ENUM) {
+            names = info->fields[n]->options;
+        } else if (info->fields[n]->numElements > 1 && !info->fields[n]->defaultElementNames) {
+            names = info->fields[n]->elementNames;
+        }
+        for (int m = 0; m < names.length(); ++m) {
+            QString name = names[m].toUpper().replace(QRegExp(ENUM_SPECIAL_CHARS), "");
+            constants.append(QString("%1_%2 = %3\n").arg(info->fields[n]->name.toUpper()).arg(name).arg(m));
+        }
+    }
+    outCode.replace(QString("$(NATIVECONSTANTS)"), constants);
+
+    // Replace the $(NATIVEACCESSORS) tag, a getter and a setter per field
+    QString accessors;
+    for (int n = 0; n < info->fields.length(); ++n) {
+        QString index = (info->fields[n]->numElements > 1) ? QString("index, ") : QString("");
+        QString args  = QString("%1Handle(), %2, offsetof(%1Data, %3), %4")
+                        .arg(info->name)
+                        .arg(fieldTypeStrNative[info->fields[n]->type])
+                        .arg(info->fields[n]->name)
+                        .arg(info->fields[n]->numElements);
+
+        accessors.append(QString("# Read %1\n").arg(info->fields[n]->name));
+        accessors.append(QString("def get%1(%2instId=0):\n").arg(info->fields[n]->name).arg(index));
+        accessors.append(QString("    \"\"\"__NATIVE__\n"));
+        accessors.append(QString("    return FlightPlanUAVOGetField(%1);\n").arg(args));
+        accessors.append(QString("    \"\"\"\n"));
+        accessors.append(QString("    pass\n\n"));
+
+        accessors.append(QString("# Write %1\n").arg(info->fields[n]->name));
+        accessors.append(QString("def set%1(%2value, instId=0):\n").arg(info->fields[n]->name).arg(index));
+        accessors.append(QString("    \"\"\"__NATIVE__\n"));
+        accessors.append(QString("    return FlightPlanUAVOSetField(%1);\n").arg(args));
+        accessors.append(QString("    \"\"\"\n"));
+        accessors.append(QString("    pass\n\n"));
+    }
+    outCode.replace(QString("$(NATIVEACCESSORS)"), accessors);
+
+    bool res = writeFileIfDiffrent(pythonOutputPath.absolutePath() + "/" + info->namelc + "_native.py", outCode);
+    if (!res) {
+        cout << "Error: Could not write Python output files" << endl;
+        return false;
+    }
+
+    return true;
+}
@@ -35,8 +35,11 @@ public:
 
 private:
     bool process_object(ObjectInfo *info);
+    bool process_object_native(ObjectInfo *info);
 
+    QStringList fieldTypeStrNative;
     QString pythonCodeTemplate;
+    QString pythonNativeTemplate;
     QDir pythonCodePath;
     QDir pythonOutputPath;
 };
@@ -40,10 +40,11 @@ bool UAVObjectGeneratorWireshark::generate(UAVObjectParser *parser, QString temp
     wiresharkOutputPath   = QDir(outputpath + QString("wireshark"));
     wiresharkOutputPath.mkpath(wiresharkOutputPath.absolutePath());
 
-    wiresharkCodeTemplate = readFile(wiresharkCodePath.absoluteFilePath("op-uavobjects/packet-op-uavobjects.c.template"));
-    wiresharkMakeTemplate = readFile(wiresharkCodePath.absoluteFilePath("op-uavobjects/Makefile.common.template"));
+    wiresharkCodeTemplate     = readFile(wiresharkCodePath.absoluteFilePath("op-uavobjects/packet-op-uavobjects.c.template"));
+    wiresharkDispatchTemplate = readFile(wiresharkCodePath.absoluteFilePath("op-uavobjects/packet-op-uavobjects-dispatch.c.template"));
+    wiresharkMakeTemplate     = readFile(wiresharkCodePath.absoluteFilePath("op-uavobjects/Makefile.common.template"));
 
-    if (wiresharkCodeTemplate.isNull() || wiresharkMakeTemplate.isNull()) {
+    if (wiresharkCodeTemplate.isNull() || wiresharkDispatchTemplate.isNull() || wiresharkMakeTemplate.isNull()) {
         cerr << "Error: Could not open wireshark template files." << endl;
         return false;
     }
@@ -65,6 +66,7 @@ bool UAVObjectGeneratorWireshark::generate(UAVObjectParser *parser, QString temp
     uavtalkstaticfiles << "Makefile.am" << "moduleinfo.h" << "moduleinfo.nmake";
     uavtalkstaticfiles << "plugin.rc.in";
     uavtalkstaticfiles << "Makefile.common" << "packet-op-uavtalk.c";
+    uavtalkstaticfiles << "uavtalk-frame.c" << "uavtalk-frame.h";
     for (int i = 0; i < uavtalkstaticfiles.length(); ++i) {
         QFile::copy(wiresharkCodePath.absoluteFilePath("op-uavtalk/" + uavtalkstaticfiles[i]),
                     uavtalkOutputPath.absoluteFilePath(uavtalkstaticfiles[i]));
@@ -78,6 +80,7 @@ bool UAVObjectGeneratorWireshark::generate(UAVObjectParser *parser, QString temp
     uavostaticfiles << "CMakeLists.txt" << "Makefile.nmake";
     uavostaticfiles << "Makefile.am" << "moduleinfo.h" << "moduleinfo.nmake";
     uavostaticfiles << "plugin.rc.in";
+    uavostaticfiles << "uavo-hash.c" << "uavo-hash.h";
     for (int i = 0; i < uavostaticfiles.length(); ++i) {
         QFile::copy(wiresharkCodePath.absoluteFilePath("op-uavobjects/" + uavostaticfiles[i]),
                     uavobjectsOutputPath.absoluteFilePath(uavostaticfiles[i]));
@@ -91,6 +94,11 @@ bool UAVObjectGeneratorWireshark::generate(UAVObjectParser *parser, QString temp
         objFileNames.append(" packet-op-uavobjects-" + info->namelc + ".c");
     }
 
+    /* Generate the dispatch from the object IDs to the per-object dissectors */
+    if (!process_dispatch(parser, uavobjectsOutputPath)) {
+        return false;
+    }
+
     /* Write the uavobject dissector's Makefile.common */
     wiresharkMakeTemplate.replace(QString("$(UAVOBJFILENAMES)"), objFileNames);
     bool res = writeFileIfDiffrent(uavobjectsOutputPath.absolutePath() + "/Makefile.common",
@@ -104,6 +112,52 @@ bool UAVObjectGeneratorWireshark::generate(UAVObjectParser *parser, QString temp
 }
 
 
+/**
+ * Generate the table of all the objects, hashed by object ID at startup
+ **/
+bool UAVObjectGeneratorWireshark::process_dispatch(UAVObjectParser *parser, QDir outputpath)
+{
+    QString outCode = wiresharkDispatchTemplate;
+    QString decls;
+    QString ids;
+    QString entries;
+    int numObjects  = parser->getNumObjects();
+    int hashBits    = 2;
+
+    // At most half full, for short probe sequences
+    while ((1 << hashBits) < 2 * numObjects) {
+        ++hashBits;
+    }
+
+    for (int objidx = 0; objidx < numObjects; ++objidx) {
+        ObjectInfo *info = parser->getObjectByIndex(objidx);
+        decls.append(QString("int dissect_uavo_%1(tvbuff_t *tvb, packet_info *pinfo, proto_tree *tree, guint16 instid);\r\n")
+                     .arg(info->namelc));
+        ids.append(QString("  0x%1, /* %2 */\r\n")
+                   .arg(QString().setNum(info->id, 16).toUpper())
+                   .arg(info->name));
+        entries.append(QString("  { \"%1\", %2, dissect_uavo_%3 },\r\n")
+                       .arg(info->name)
+                       .arg(boolToTRUEFALSEString(info->isSingleInst))
+                       .arg(info->namelc));
+    }
+
+    replaceCommonTags(outCode);
+    outCode.replace(QString("$(DISSECTORDECLS)"), decls);
+    outCode.replace(QString("$(OBJECTCOUNT)"), QString().setNum(numObjects));
+    outCode.replace(QString("$(HASHBITS)"), QString().setNum(hashBits));
+    outCode.replace(QString("$(OBJECTIDS)"), ids);
+    outCode.replace(QString("$(OBJECTENTRIES)"), entries);
+
+    bool res = writeFileIfDiffrent(outputpath.absolutePath() + "/packet-op-uavobjects.c", outCode);
+    if (!res) {
+        cout << "Error: Could not write wireshark dispatch file" << endl;
+        return false;
+    }
+
+    return true;
+}
+
 /**
  * Generate the Flight object files
  **/
@@ -138,6 +192,13 @@ bool UAVObjectGeneratorWireshark::process_object(ObjectInfo *info, QDir outputpa
     outCode.replace(QString("$(SUBTREES)"), subtrees);
     outCode.replace(QString("$(SUBTREESTATICS)"), subtreestatics);
 
+    // Replace the $(INSTANCETEXT) tag, the instance ID only means something for multi instance objects
+    if (info->isSingleInst) {
+        outCode.replace(QString("$(INSTANCETEXT)"), QString(""));
+    } else {
+        outCode.replace(QString("$(INSTANCETEXT)"), QString("    proto_item_append_text(ti, \", Instance %u\", instid);"));
+    }
+
     // Replace the $(FIELDHANDLES) tag
     QString type;
     QString fields;
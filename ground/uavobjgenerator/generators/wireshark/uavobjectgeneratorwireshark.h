@@ -34,12 +34,13 @@ public:
     bool generate(UAVObjectParser *gen, QString templatepath, QString outputpath);
     QStringList fieldTypeStrHf;
     QStringList fieldTypeStrGlib;
-    QString wiresharkCodeTemplate, wiresharkMakeTemplate;
+    QString wiresharkCodeTemplate, wiresharkDispatchTemplate, wiresharkMakeTemplate;
     QDir wiresharkCodePath;
     QDir wiresharkOutputPath;
 
 private:
     bool process_object(ObjectInfo *info, QDir outputpath);
+    bool process_dispatch(UAVObjectParser *parser, QDir outputpath);
 };
 
 #endif
@@ -86,8 +86,11 @@ SRC += $(PIOSCOMMON)/pios_sensors.c
 ## Misc library functions
 SRC += $(FLIGHTLIB)/sanitycheck.c
 SRC += $(FLIGHTLIB)/CoordinateConversions.c
+SRC += $(FLIGHTLIB)/logstream.c
+SRC += $(FLIGHTLIB)/telemetrysched.c
 SRC += $(MATHLIB)/sin_lookup.c
 SRC += $(MATHLIB)/pid.c
+SRC += $(MATHLIB)/fastmath.c
 
 ## PIOS Hardware (Common)
 SRC += $(PIOSCOMMON)/pios_flashfs_logfs.c
@@ -101,12 +104,18 @@ SRC += $(PIOSCOMMON)/pios_com_msg.c
 SRC += $(PIOSCOMMON)/pios_crc.c
 SRC += $(PIOSCOMMON)/pios_deltatime.c
 SRC += $(PIOSCOMMON)/pios_led.c
+SRC += $(PIOSCOMMON)/pios_spi_queue.c
+SRC += $(PIOSCOMMON)/pios_i2c_fsm.c
+SRC += $(PIOSCOMMON)/pios_usart_dma.c
+SRC += $(PIOSCOMMON)/pios_ws2811_stream.c
+SRC += $(PIOSCOMMON)/pios_adc_filter.c
 
 ifneq ($(PIOS_OMITS_USB),YES)
 ## PIOS USB related files
 SRC += $(PIOSCOMMON)/pios_usb_desc_hid_cdc.c
 SRC += $(PIOSCOMMON)/pios_usb_desc_hid_only.c
 SRC += $(PIOSCOMMON)/pios_usb_util.c
+SRC += $(PIOSCOMMON)/pios_usb_bulk.c
 endif
 ## PIOS system code
 SRC += $(PIOSCOMMON)/pios_task_monitor.c
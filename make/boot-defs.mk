@@ -59,11 +59,13 @@ ifneq ($(PIOS_OMITS_USB),YES)
 SRC += ../pios_usb_board_data.c
 SRC += $(PIOSCOMMON)/pios_usb_desc_hid_only.c
 SRC += $(PIOSCOMMON)/pios_usb_util.c
+SRC += $(PIOSCOMMON)/pios_usb_bulk.c
 endif
 SRC += $(PIOSCOMMON)/pios_led.c
 
 ## Misc library functions
 SRC += $(FLIGHTLIB)/op_dfu.c
+SRC += $(FLIGHTLIB)/fwlz.c
 SRC += $(FLIGHTLIB)/printf-stdarg.c
 
 # List C source files here which must be compiled in ARM-Mode (no -mthumb).